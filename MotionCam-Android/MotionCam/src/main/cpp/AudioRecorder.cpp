@@ -1,10 +1,15 @@
 #include "AudioRecorder.h"
 #include "camera/Logger.h"
 
+#include <chrono>
+
 AudioRecorder::AudioRecorder(int audioDeviceId) :
     mRunning(false),
+    mSampleRing(new SampleRing()),
+    mOverrunSamples(0),
     mAudioDeviceId(audioDeviceId),
     mAudioDataOffset(0),
+    mDrainedOffset(0),
     mSampleRate(0),
     mChannelCount(0)
 {
@@ -43,6 +48,9 @@ bool AudioRecorder::start(const int sampleRateHz, const int channels) {
     const size_t bufferFrames = channels * sampleRateHz * 60 * 5;
 
     mAudioData.resize(bufferFrames);
+    mAudioDataOffset = 0;
+    mDrainedOffset = 0;
+    mOverrunSamples = 0;
 
     result = mActiveAudioStream->requestStart();
     if(result != oboe::Result::OK) {
@@ -58,6 +66,11 @@ bool AudioRecorder::start(const int sampleRateHz, const int channels) {
     LOGD("Audio recorder started with sample rate: %d and channels: %d", mSampleRate, mChannelCount);
 
     mRunning = true;
+
+    // The drain thread moves samples from the ring into the backing buffer
+    // and owns the resizing, so the audio callback never allocates
+    mDrainThread = std::unique_ptr<std::thread>(new std::thread(&AudioRecorder::doDrain, this));
+
     return true;
 }
 
@@ -72,6 +85,51 @@ void AudioRecorder::destroy() {
     }
 
     mRunning = false;
+
+    if(mDrainThread && mDrainThread->joinable())
+        mDrainThread->join();
+    mDrainThread = nullptr;
+
+    const uint64_t overruns = mOverrunSamples;
+    if(overruns > 0)
+        LOGW("Audio ring overran, dropped %lld samples", (long long) overruns);
+}
+
+void AudioRecorder::drainRing() {
+    std::lock_guard<std::mutex> lock(mDataMutex);
+    int16_t sample;
+
+    while(mSampleRing->try_pop(sample)) {
+        if(mAudioDataOffset >= mAudioData.size()) {
+            // Increase by 5 minutes at a time
+            const size_t bufferFrames = (size_t) mChannelCount * mSampleRate * 60 * 5;
+
+            mAudioData.resize(mAudioData.size() + bufferFrames);
+        }
+
+        mAudioData[mAudioDataOffset++] = sample;
+    }
+}
+
+bool AudioRecorder::drainAudioData(std::vector<int16_t>& outSamples) {
+    std::lock_guard<std::mutex> lock(mDataMutex);
+
+    outSamples.assign(mAudioData.begin() + mDrainedOffset, mAudioData.begin() + mAudioDataOffset);
+    mDrainedOffset = mAudioDataOffset;
+
+    return true;
+}
+
+void AudioRecorder::doDrain() {
+    while(mRunning) {
+        drainRing();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    // The stream has stopped by the time the running flag clears, so one
+    // last drain empties the ring
+    drainRing();
 }
 
 const std::vector<int16_t>& AudioRecorder::getAudioData(uint32_t& outNumFrames) const {
@@ -84,6 +142,10 @@ const std::vector<int16_t>& AudioRecorder::getAudioData(uint32_t& outNumFrames)
     return mAudioData;
 }
 
+uint64_t AudioRecorder::getOverrunSamples() const {
+    return mOverrunSamples;
+}
+
 int AudioRecorder::getSampleRate() const {
     return mSampleRate;
 }
@@ -93,21 +155,18 @@ int AudioRecorder::getChannels() const {
 }
 
 oboe::DataCallbackResult AudioRecorder::onAudioReady(oboe::AudioStream* audioStream, void* audioData, int32_t numFrames) {
-    // Resize in large chunks
-    // TODO: move out of audio callback
-    if(mAudioDataOffset + numFrames >= mAudioData.size()) {
-        // Increase by 5 minutes at a time
-        const size_t bufferFrames = mChannelCount * mSampleRate * 60 * 5;
-
-        mAudioData.resize(mAudioData.size() + bufferFrames);
-    }
-
-    uint32_t numBytes = numFrames * audioStream->getBytesPerFrame();
-
-    if(numBytes > 0) {
-        std::memcpy(mAudioData.data() + mAudioDataOffset, audioData, numBytes);
-        mAudioDataOffset += numBytes / audioStream->getBytesPerSample();
+    const int32_t numSamples = numFrames * audioStream->getChannelCount();
+    const int16_t* samples = static_cast<const int16_t*>(audioData);
+
+    // Real time callback; no locks or allocation here. When the ring is
+    // full the remaining samples are dropped and counted instead of
+    // blocking.
+    for(int32_t i = 0; i < numSamples; i++) {
+        if(!mSampleRing->try_push(samples[i])) {
+            mOverrunSamples.fetch_add(numSamples - i, std::memory_order_relaxed);
+            break;
+        }
     }
 
     return mRunning ? oboe::DataCallbackResult::Continue : oboe::DataCallbackResult::Stop;
-}
\ No newline at end of file
+}
@@ -4,6 +4,12 @@
 #include <motioncam/AudioInterface.h>
 
 #include <oboe/Oboe.h>
+#include <atomic_queue/atomic_queue.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 class AudioRecorder : public motioncam::AudioInterface, public oboe::AudioStreamDataCallback {
@@ -17,17 +23,42 @@ public:
     int getSampleRate() const;
     int getChannels() const;
     const std::vector<int16_t>& getAudioData(uint32_t& outNumFrames) const;
+    bool drainAudioData(std::vector<int16_t>& outSamples);
+
+    // Number of samples dropped because the ring between the audio
+    // callback and the drain thread was full
+    uint64_t getOverrunSamples() const;
 
 private:
     void destroy();
+    void doDrain();
+    void drainRing();
 
     oboe::DataCallbackResult onAudioReady(oboe::AudioStream *audioStream, void *audioData, int32_t numFrames);
 
 private:
+    // Capacity of the wait-free SPSC ring between the real time audio
+    // callback and the drain thread, ~2.7 seconds of 48 kHz stereo. The
+    // drain thread wakes every 100ms, so the ring only fills if it is
+    // starved for seconds; overruns are counted rather than blocking the
+    // callback.
+    static const unsigned RING_CAPACITY = 262144;
+
+    using SampleRing = atomic_queue::AtomicQueue2<int16_t, RING_CAPACITY, true, true, false, true>;
+
     std::shared_ptr<oboe::AudioStream> mActiveAudioStream;
     std::atomic<bool> mRunning;
+    std::unique_ptr<SampleRing> mSampleRing;
+    std::unique_ptr<std::thread> mDrainThread;
+    std::atomic<uint64_t> mOverrunSamples;
+
+    // The backing buffer is written by the drain thread and read
+    // incrementally through drainAudioData(); the mutex covers both.
+    // mDrainedOffset marks how far drainAudioData() has consumed.
+    std::mutex mDataMutex;
     std::vector<int16_t> mAudioData;
     size_t mAudioDataOffset;
+    size_t mDrainedOffset;
     int mSampleRate;
     int mChannelCount;
     int mAudioDeviceId;
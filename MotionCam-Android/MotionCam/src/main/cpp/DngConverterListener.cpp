@@ -1,7 +1,13 @@
 #include "DngConverterListener.h"
 
+// Minimum time between forwarded progress updates. The export workers tick
+// progress for every frame, which adds up to thousands of Java transitions
+// per clip if forwarded individually.
+static const int PROGRESS_INTERVAL_MS = 100;
+
 DngConverterListener::DngConverterListener(_JNIEnv * env, _jobject *progressListener) :
-        mEnv(env), mProgressListenerRef(env->NewGlobalRef(progressListener)) {
+        mEnv(env), mProgressListenerRef(env->NewGlobalRef(progressListener)),
+        mLastProgress(-1), mLastProgressResult(true) {
 }
 
 DngConverterListener::~DngConverterListener() {
@@ -18,6 +24,24 @@ int DngConverterListener::onNeedFd(int frameNumber) {
 }
 
 bool DngConverterListener::onProgressUpdate(int progress) {
+    // Deliver coalesced snapshots. Unchanged or rate-limited ticks are
+    // dropped and the terminal value always goes through.
+    auto now = std::chrono::steady_clock::now();
+
+    if(progress < 100) {
+        if(progress == mLastProgress)
+            return mLastProgressResult;
+
+        auto elapsedMs =
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - mLastProgressTime).count();
+
+        if(elapsedMs < PROGRESS_INTERVAL_MS)
+            return mLastProgressResult;
+    }
+
+    mLastProgress = progress;
+    mLastProgressTime = now;
+
     struct _jmethodID *onProgressUpdate = mEnv->GetMethodID(
             mEnv->GetObjectClass(mProgressListenerRef),
             "onProgressUpdate",
@@ -25,7 +49,9 @@ bool DngConverterListener::onProgressUpdate(int progress) {
 
     uint8_t result = mEnv->CallBooleanMethod(mProgressListenerRef, onProgressUpdate, progress);
 
-    return result == 1;
+    mLastProgressResult = (result == 1);
+
+    return mLastProgressResult;
 }
 
 void DngConverterListener::onCompleted() {
@@ -4,6 +4,7 @@
 #include <motioncam/DngProcessorProgress.h>
 #include <jni.h>
 #include <string>
+#include <chrono>
 
 class DngConverterListener : public motioncam::DngProcessorProgress {
 public:
@@ -19,6 +20,12 @@ public:
 private:
     _JNIEnv * mEnv;
     _jobject *mProgressListenerRef;
+
+    // Progress ticks are coalesced to the latest value and forwarded at a
+    // bounded rate; skipped ticks return the last result from Java
+    std::chrono::steady_clock::time_point mLastProgressTime;
+    int mLastProgress;
+    bool mLastProgressResult;
 };
 
 
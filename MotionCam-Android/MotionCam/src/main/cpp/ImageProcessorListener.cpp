@@ -1,7 +1,12 @@
 #include "ImageProcessorListener.h"
 
+// Minimum time between forwarded progress updates; every tick forwarded
+// individually is a Java transition that can wake the UI thread
+static const int PROGRESS_INTERVAL_MS = 100;
+
 ImageProcessListener::ImageProcessListener(_JNIEnv * env, _jobject *progressListener) :
-    mEnv(env), mProgressListenerRef(env->NewGlobalRef(progressListener)) {
+    mEnv(env), mProgressListenerRef(env->NewGlobalRef(progressListener)),
+    mLastProgress(-1), mLastProgressResult(true) {
 }
 
 ImageProcessListener::~ImageProcessListener() {
@@ -26,6 +31,24 @@ std::string ImageProcessListener::onPreviewSaved(const std::string& outputPath)
 }
 
 bool ImageProcessListener::onProgressUpdate(int progress) const {
+    // Deliver coalesced snapshots. Unchanged or rate-limited ticks are
+    // dropped and the terminal value always goes through.
+    auto now = std::chrono::steady_clock::now();
+
+    if(progress < 100) {
+        if(progress == mLastProgress)
+            return mLastProgressResult;
+
+        auto elapsedMs =
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - mLastProgressTime).count();
+
+        if(elapsedMs < PROGRESS_INTERVAL_MS)
+            return mLastProgressResult;
+    }
+
+    mLastProgress = progress;
+    mLastProgressTime = now;
+
     struct _jmethodID *onProgressMethod = mEnv->GetMethodID(
             mEnv->GetObjectClass(mProgressListenerRef),
             "onProgressUpdate",
@@ -33,7 +56,9 @@ bool ImageProcessListener::onProgressUpdate(int progress) const {
 
     uint8_t result = mEnv->CallBooleanMethod(mProgressListenerRef, onProgressMethod, progress);
 
-    return result == 1;
+    mLastProgressResult = (result == 1);
+
+    return mLastProgressResult;
 }
 
 void ImageProcessListener::onCompleted() const {
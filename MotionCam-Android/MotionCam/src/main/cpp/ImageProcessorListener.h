@@ -4,6 +4,7 @@
 #include <motioncam/ImageProcessorProgress.h>
 #include <jni.h>
 #include <string>
+#include <chrono>
 
 class ImageProcessListener : public motioncam::ImageProcessorProgress {
 public:
@@ -18,6 +19,12 @@ public:
 private:
     _JNIEnv * mEnv;
     _jobject *mProgressListenerRef;
+
+    // Progress ticks are coalesced to the latest value and forwarded at a
+    // bounded rate; skipped ticks return the last result from Java
+    mutable std::chrono::steady_clock::time_point mLastProgressTime;
+    mutable int mLastProgress;
+    mutable bool mLastProgressResult;
 };
 
 #endif //MOTIONCAM_ANDROID_IMAGEPROCESSORLISTENER_H
@@ -33,8 +33,17 @@ namespace {
     static std::shared_ptr<CaptureSessionManager> gCaptureSessionManager = nullptr;
     static std::shared_ptr<CameraDescription> gActiveCameraDescription = nullptr;
     static std::shared_ptr<CameraSession> gCameraSession = nullptr;
+
+    // Kept so PollCameraEvents() can drain the per-frame event queue
+    static std::shared_ptr<NativeCameraBridgeListener> gCameraStateListener = nullptr;
     static std::shared_ptr<motioncam::AudioInterface> gAudioRecorder = nullptr;
 
+    // Recycled across GenerateStats() calls. The stats overlay polls while
+    // the camera is running and reallocating these every tick is avoidable
+    // churn; the Java side already reuses its bitmaps the same way.
+    static Halide::Runtime::Buffer<uint8_t> gWhiteLevelStats;
+    static Halide::Runtime::Buffer<uint8_t> gBlackLevelStats;
+
     static std::string gLastError;
 }
 
@@ -71,6 +80,8 @@ void JNICALL Java_com_motioncam_camera_NativeCamera_Destroy(JNIEnv *env, jobject
     if(gCameraSession) {
         gCameraSession = nullptr;
     }
+
+    gCameraStateListener = nullptr;
 }
 
 extern "C" JNIEXPORT
@@ -143,8 +154,23 @@ jboolean JNICALL Java_com_motioncam_camera_NativeCamera_StartCapture(
         LOGD("Preview output %dx%d format: %d",
              previewOutputConfig.outputSize.width(), previewOutputConfig.outputSize.height(), outputConfig.format);
 
+        // When the RAW preview is in use, try to get a smaller RAW stream to feed it so
+        // the preview pipeline does not consume full resolution frames
+        OutputConfiguration previewRawOutputConfig;
+        bool hasPreviewRawStream = false;
+
+        if(setupForRawPreview &&
+           gCaptureSessionManager->getPreviewRawConfiguration(*cameraDesc, outputConfig, previewRawOutputConfig))
+        {
+            hasPreviewRawStream = true;
+
+            LOGD("Preview RAW output %dx%d format: %d",
+                 previewRawOutputConfig.outputSize.width(), previewRawOutputConfig.outputSize.height(), previewRawOutputConfig.format);
+        }
+
         // Create image consumer if we have not done so
         auto nativeListener = std::make_shared<NativeCameraBridgeListener>(env, listener);
+        gCameraStateListener = nativeListener;
 
         std::shared_ptr<ANativeWindow> window(ANativeWindow_fromSurface(env, previewSurface), ANativeWindow_release);
 
@@ -158,6 +184,8 @@ jboolean JNICALL Java_com_motioncam_camera_NativeCamera_StartCapture(
                 cameraDesc,
                 outputConfig,
                 previewOutputConfig,
+                previewRawOutputConfig,
+                hasPreviewRawStream,
                 gCaptureSessionManager->cameraManager(),
                 window,
                 setupForRawPreview,
@@ -189,6 +217,11 @@ JNIEXPORT jboolean JNICALL Java_com_motioncam_camera_NativeCamera_StopCapture(JN
 
     LOGD("Clearing camera session");
     gCameraSession = nullptr;
+    gCameraStateListener = nullptr;
+
+    // Release the recycled stats buffers
+    gWhiteLevelStats = Halide::Runtime::Buffer<uint8_t>();
+    gBlackLevelStats = Halide::Runtime::Buffer<uint8_t>();
 
     LOGD("Stop capture completed");
 
@@ -246,18 +279,37 @@ jboolean JNICALL Java_com_motioncam_camera_NativeCamera_SetAutoExposure(JNIEnv *
 
 extern "C" JNIEXPORT
 jboolean JNICALL Java_com_motioncam_camera_NativeCamera_EnableRawPreview(
-        JNIEnv *env, jobject thiz, jobject listener, jint previewQuality, jboolean overrideWb)
+        JNIEnv *env, jobject thiz, jobject listener, jobject previewOutputSurface, jint previewQuality, jboolean overrideWb)
 {
     if(!gCameraSession) {
         return JNI_FALSE;
     }
 
-    auto rawListener = std::make_shared<NativeRawPreviewListener>(env, listener);
+    auto rawListener = std::make_shared<NativeRawPreviewListener>(env, listener, previewOutputSurface);
     gCameraSession->enableRawPreview(rawListener, previewQuality);
 
     return JNI_TRUE;
 }
 
+extern "C" JNIEXPORT
+jint JNICALL Java_com_motioncam_camera_NativeCamera_PollCameraEvents(
+        JNIEnv *env, jobject thiz, jobject eventBuffer)
+{
+    if(!gCameraStateListener) {
+        return 0;
+    }
+
+    auto* dst = reinterpret_cast<uint8_t*>(env->GetDirectBufferAddress(eventBuffer));
+    if(!dst) {
+        return 0;
+    }
+
+    const jlong capacity = env->GetDirectBufferCapacity(eventBuffer);
+
+    return gCameraStateListener->pollEvents(
+        dst, (int) (capacity / NativeCameraBridgeListener::EVENT_PACKED_SIZE));
+}
+
 extern "C" JNIEXPORT
 jboolean JNICALL Java_com_motioncam_camera_NativeCamera_DisableRawPreview(JNIEnv *env, jobject thiz) {
     if(!gCameraSession) {
@@ -438,27 +490,59 @@ JNIEXPORT jdouble JNICALL Java_com_motioncam_camera_NativeCamera_MeasureSharpnes
 }
 
 extern "C"
-JNIEXPORT jstring JNICALL Java_com_motioncam_camera_NativeCamera_EstimatePostProcessSettings(
-        JNIEnv *env, jobject thiz, jfloat shadowsBias)
+JNIEXPORT jdouble JNICALL Java_com_motioncam_camera_NativeCamera_MeasureSharpnessRoi(
+        JNIEnv *env,
+        jobject thiz,
+        jfloat roiX,
+        jfloat roiY,
+        jfloat roiWidth,
+        jfloat roiHeight)
 {
     if(!gActiveCameraDescription)
-        return nullptr;
+        return 0;
+
+    // Polled per preview frame, so operate on the latest frame instead of
+    // requiring the caller to enumerate buffer handles
+    auto lockedBuffer = RawBufferManager::get().consumeLatestBuffer();
+    if(!lockedBuffer || lockedBuffer->getBuffers().empty())
+        return -1e10;
+
+    auto imageBuffer = lockedBuffer->getBuffers().front();
+
+    return ImageProcessor::measureSharpnessRoi(
+            gActiveCameraDescription->metadata, *imageBuffer, roiX, roiY, roiWidth, roiHeight);
+}
+
+extern "C"
+JNIEXPORT jboolean JNICALL Java_com_motioncam_camera_NativeCamera_EstimatePostProcessSettings(
+        JNIEnv *env, jobject thiz, jfloat shadowsBias, jobject dst)
+{
+    if(!gActiveCameraDescription)
+        return JNI_FALSE;
+
+    // Settings cross the boundary as a packed struct in a direct ByteBuffer
+    // instead of a json string
+    auto* packed = reinterpret_cast<motioncam::PackedPostProcessSettings*>(env->GetDirectBufferAddress(dst));
+
+    if(packed == nullptr ||
+       env->GetDirectBufferCapacity(dst) < (jlong) sizeof(motioncam::PackedPostProcessSettings))
+    {
+        return JNI_FALSE;
+    }
 
     motioncam::PostProcessSettings settings;
 
     auto lockedBuffer = RawBufferManager::get().consumeLatestBuffer();
     if(!lockedBuffer || lockedBuffer->getBuffers().empty())
-        return nullptr;
+        return JNI_FALSE;
 
     auto imageBuffer = lockedBuffer->getBuffers().front();
 
     ImageProcessor::estimateSettings(*imageBuffer, gActiveCameraDescription->metadata, settings);
 
-    json11::Json::object settingsJson;
+    settings.pack(*packed);
 
-    settings.toJson(settingsJson);
-
-    return env->NewStringUTF(json11::Json(settingsJson).dump().c_str());
+    return JNI_TRUE;
 }
 
 extern "C" JNIEXPORT
@@ -676,20 +760,27 @@ jboolean JNICALL Java_com_motioncam_camera_NativeCamera_CaptureHdrImage(
 }
 
 extern "C" JNIEXPORT
-jstring JNICALL Java_com_motioncam_camera_NativeCamera_GetRawPreviewEstimatedSettings(JNIEnv* env, jobject thiz)
+jboolean JNICALL Java_com_motioncam_camera_NativeCamera_GetRawPreviewEstimatedSettings(JNIEnv* env, jobject thiz, jobject dst)
 {
     if(!gCameraSession) {
         return JNI_FALSE;
     }
 
+    auto* packed = reinterpret_cast<motioncam::PackedPostProcessSettings*>(env->GetDirectBufferAddress(dst));
+
+    if(packed == nullptr ||
+       env->GetDirectBufferCapacity(dst) < (jlong) sizeof(motioncam::PackedPostProcessSettings))
+    {
+        return JNI_FALSE;
+    }
+
     PostProcessSettings settings;
 
     gCameraSession->getEstimatedPostProcessSettings(settings);
 
-    json11::Json::object settingsJson;
-    settings.toJson(settingsJson);
+    settings.pack(*packed);
 
-    return env->NewStringUTF(json11::Json(settingsJson).dump().c_str());
+    return JNI_TRUE;
 }
 
 extern "C" JNIEXPORT
@@ -709,7 +800,7 @@ void JNICALL Java_com_motioncam_camera_NativeCamera_PrepareHdrCapture(
 extern "C"
 JNIEXPORT jboolean JNICALL Java_com_motioncam_camera_NativeCamera_StartStreamToFile(
         JNIEnv *env, jobject thiz,
-        jintArray jfds, jint audioFd, jint audioDeviceId, jint numThreads)
+        jintArray jfds, jint audioFd, jint audioDeviceId, jint numThreads, jint preRollMs)
 {
     if(!gActiveCameraDescription) {
         return JNI_FALSE;
@@ -734,7 +825,7 @@ JNIEXPORT jboolean JNICALL Java_com_motioncam_camera_NativeCamera_StartStreamToF
     gAudioRecorder = std::make_shared<AudioRecorder>(audioDeviceId);
 
     RawBufferManager::get().enableStreaming(
-            fds, audioFd, gAudioRecorder, numThreads, gActiveCameraDescription->metadata);
+            fds, audioFd, gAudioRecorder, numThreads, gActiveCameraDescription->metadata, preRollMs);
 
     return JNI_TRUE;
 }
@@ -881,25 +972,22 @@ JNIEXPORT void JNICALL Java_com_motioncam_camera_NativeCamera_GenerateStats(
 
     auto imageBuffer = lockedBuffer->getBuffers().front();
 
-    Halide::Runtime::Buffer<uint8_t> whiteLevelBuffer;
-    Halide::Runtime::Buffer<uint8_t> blackLevelBuffer;
-
-    ImageProcessor::generateStats(*imageBuffer, 8, 8, gActiveCameraDescription->metadata, whiteLevelBuffer, blackLevelBuffer);
+    ImageProcessor::generateStats(*imageBuffer, 8, 8, gActiveCameraDescription->metadata, gWhiteLevelStats, gBlackLevelStats);
 
     jobject whiteLevelDst = env->CallObjectMethod(
-            listener, callbackMethod, whiteLevelBuffer.width(), whiteLevelBuffer.height(), TYPE_WHITE_LEVEL);
+            listener, callbackMethod, gWhiteLevelStats.width(), gWhiteLevelStats.height(), TYPE_WHITE_LEVEL);
 
     if(!whiteLevelDst)
         return;
 
     jobject blackLevelDst = env->CallObjectMethod(
-            listener, callbackMethod, blackLevelBuffer.width(), blackLevelBuffer.height(), TYPE_BLACK_LEVEL);
+            listener, callbackMethod, gBlackLevelStats.width(), gBlackLevelStats.height(), TYPE_BLACK_LEVEL);
 
     if(!blackLevelDst)
         return;
 
-    motioncam::CopyAlphaBitmap(env, whiteLevelBuffer, whiteLevelDst);
-    motioncam::CopyAlphaBitmap(env, blackLevelBuffer, blackLevelDst);
+    motioncam::CopyAlphaBitmap(env, gWhiteLevelStats, whiteLevelDst);
+    motioncam::CopyAlphaBitmap(env, gBlackLevelStats, blackLevelDst);
 }
 
 extern "C"
@@ -942,8 +1030,18 @@ JNIEXPORT jboolean JNICALL Java_com_motioncam_camera_NativeCamera_ActivateCamera
 //
 
 extern "C"
-JNIEXPORT void JNICALL Java_com_motioncam_camera_NativeCameraManager_CreateCameraManager(JNIEnv *env, jobject thiz) {
-    gCaptureSessionManager = std::make_shared<CaptureSessionManager>();
+JNIEXPORT void JNICALL Java_com_motioncam_camera_NativeCameraManager_CreateCameraManager(JNIEnv *env, jobject thiz, jstring jcachePath) {
+    std::string cachePath;
+
+    if(jcachePath != nullptr) {
+        const char* cachePathChars = env->GetStringUTFChars(jcachePath, nullptr);
+
+        cachePath = cachePathChars;
+
+        env->ReleaseStringUTFChars(jcachePath, cachePathChars);
+    }
+
+    gCaptureSessionManager = std::make_shared<CaptureSessionManager>(cachePath);
 }
 
 extern "C"
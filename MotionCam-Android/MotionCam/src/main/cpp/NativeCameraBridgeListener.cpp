@@ -3,6 +3,8 @@
 
 #include "camera/Logger.h"
 
+#include <cstring>
+
 namespace motioncam {
     NativeCameraBridgeListener::NativeCameraBridgeListener(JNIEnv* env, jobject listener) :
         mJavaVm(nullptr) {
@@ -23,6 +25,17 @@ namespace motioncam {
         mListenerClass = reinterpret_cast<jclass>(env->NewGlobalRef(listenerClass));
         if(!mListenerClass)
             throw std::runtime_error("Failed to get listener class reference");
+
+        // Resolve the callback methods up front
+        mOnCameraSessionStateChangedMethod      = env->GetMethodID(mListenerClass, "onCameraSessionStateChanged", "(I)V");
+        mOnCameraErrorMethod                    = env->GetMethodID(mListenerClass, "onCameraError", "(I)V");
+        mOnCameraStartedMethod                  = env->GetMethodID(mListenerClass, "onCameraStarted", "()V");
+        mOnCameraDisconnectedMethod             = env->GetMethodID(mListenerClass, "onCameraDisconnected", "()V");
+        mOnCameraHdrImageCaptureProgressMethod  = env->GetMethodID(mListenerClass, "onCameraHdrImageCaptureProgress", "(I)V");
+        mOnCameraHdrImageCaptureCompletedMethod = env->GetMethodID(mListenerClass, "onCameraHdrImageCaptureCompleted", "()V");
+        mOnCameraHdrImageCaptureFailedMethod    = env->GetMethodID(mListenerClass, "onCameraHdrImageCaptureFailed", "()V");
+        mOnMemoryAdjustingMethod                = env->GetMethodID(mListenerClass, "onMemoryAdjusting", "()V");
+        mOnMemoryStableMethod                   = env->GetMethodID(mListenerClass, "onMemoryStable", "()V");
     }
 
     NativeCameraBridgeListener::~NativeCameraBridgeListener() {
@@ -46,9 +59,8 @@ namespace motioncam {
             return;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraSessionStateChanged", "(I)V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod, (int) state);
+        if(mOnCameraSessionStateChangedMethod)
+            env.getEnv()->CallVoidMethod(mListenerInstance, mOnCameraSessionStateChangedMethod, (int) state);
     }
 
     void NativeCameraBridgeListener::onCameraError(int error) {
@@ -58,9 +70,8 @@ namespace motioncam {
             return;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraError", "(I)V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod, error);
+        if(mOnCameraErrorMethod)
+            env.getEnv()->CallVoidMethod(mListenerInstance, mOnCameraErrorMethod, error);
     }
 
     void NativeCameraBridgeListener::onCameraStarted() {
@@ -70,9 +81,8 @@ namespace motioncam {
             return;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraStarted", "()V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod);
+        if(mOnCameraStartedMethod)
+            env.getEnv()->CallVoidMethod(mListenerInstance, mOnCameraStartedMethod);
     }
 
     void NativeCameraBridgeListener::onCameraDisconnected() {
@@ -82,45 +92,51 @@ namespace motioncam {
             return;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraDisconnected", "()V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod);
+        if(mOnCameraDisconnectedMethod)
+            env.getEnv()->CallVoidMethod(mListenerInstance, mOnCameraDisconnectedMethod);
     }
 
     void NativeCameraBridgeListener::onCameraExposureStatus(const int32_t iso, const int64_t exposureTime) {
-        JavaEnv env(mJavaVm);
-        if (!env.getEnv()) {
-            LOGE("Dropped onCameraExposureStatus()");
-            return;
-        }
+        CameraEvent event;
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraExposureStatus", "(IJ)V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod, iso, exposureTime);
+        event.type = EVENT_EXPOSURE_STATUS;
+        event.intArg = iso;
+        event.longArg = exposureTime;
+
+        mEvents.enqueue(event);
     }
 
     void NativeCameraBridgeListener::onCameraAutoFocusStateChanged(const CameraFocusState state, const float focusDistance) {
-        JavaEnv env(mJavaVm);
-        if (!env.getEnv()) {
-            LOGE("Dropped onCameraAutoFocusStateChanged()");
-            return;
-        }
+        CameraEvent event;
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraAutoFocusStateChanged", "(IF)V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod, (int) state, focusDistance);
+        event.type = EVENT_AUTO_FOCUS_STATE;
+        event.intArg = (int32_t) state;
+        event.floatArg = focusDistance;
+
+        mEvents.enqueue(event);
     }
 
     void NativeCameraBridgeListener::onCameraAutoExposureStateChanged(const CameraExposureState state) {
-        JavaEnv env(mJavaVm);
-        if (!env.getEnv()) {
-            LOGE("Dropped onCameraAutoExposureStateChanged()");
-            return;
+        CameraEvent event;
+
+        event.type = EVENT_AUTO_EXPOSURE_STATE;
+        event.intArg = (int32_t) state;
+
+        mEvents.enqueue(event);
+    }
+
+    int NativeCameraBridgeListener::pollEvents(uint8_t* dst, const int maxEvents) {
+        static_assert(sizeof(CameraEvent) == EVENT_PACKED_SIZE, "CameraEvent layout mismatch");
+
+        CameraEvent event;
+        int count = 0;
+
+        while(count < maxEvents && mEvents.try_dequeue(event)) {
+            std::memcpy(dst + count * EVENT_PACKED_SIZE, &event, EVENT_PACKED_SIZE);
+            ++count;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraAutoExposureStateChanged", "(I)V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod, (int) state);
+        return count;
     }
 
     void NativeCameraBridgeListener::onCameraHdrImageCaptureProgress(int progress) {
@@ -130,9 +146,8 @@ namespace motioncam {
             return;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraHdrImageCaptureProgress", "(I)V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod, progress);
+        if(mOnCameraHdrImageCaptureProgressMethod)
+            env.getEnv()->CallVoidMethod(mListenerInstance, mOnCameraHdrImageCaptureProgressMethod, progress);
     }
 
     void NativeCameraBridgeListener::onCameraHdrImageCaptureCompleted() {
@@ -142,9 +157,8 @@ namespace motioncam {
             return;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraHdrImageCaptureCompleted", "()V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod);
+        if(mOnCameraHdrImageCaptureCompletedMethod)
+            env.getEnv()->CallVoidMethod(mListenerInstance, mOnCameraHdrImageCaptureCompletedMethod);
     }
 
     void NativeCameraBridgeListener::onCameraHdrImageCaptureFailed() {
@@ -154,9 +168,8 @@ namespace motioncam {
             return;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onCameraHdrImageCaptureFailed", "()V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod);
+        if(mOnCameraHdrImageCaptureFailedMethod)
+            env.getEnv()->CallVoidMethod(mListenerInstance, mOnCameraHdrImageCaptureFailedMethod);
     }
 
     void NativeCameraBridgeListener::onMemoryAdjusting() {
@@ -166,9 +179,8 @@ namespace motioncam {
             return;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onMemoryAdjusting", "()V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod);
+        if(mOnMemoryAdjustingMethod)
+            env.getEnv()->CallVoidMethod(mListenerInstance, mOnMemoryAdjustingMethod);
     }
 
     void NativeCameraBridgeListener::onMemoryStable() {
@@ -178,8 +190,7 @@ namespace motioncam {
             return;
         }
 
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onMemoryStable", "()V");
-        if(callbackMethod)
-            env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod);
+        if(mOnMemoryStableMethod)
+            env.getEnv()->CallVoidMethod(mListenerInstance, mOnMemoryStableMethod);
     }
 }
\ No newline at end of file
@@ -2,11 +2,33 @@
 #define MOTIONCAM_ANDROID_NATIVECAMERABRIDGELISTENER_H
 
 #include <jni.h>
+
+#include <queue/concurrentqueue.h>
+
 #include "camera/CameraSessionListener.h"
 
 namespace motioncam {
     class NativeCameraBridgeListener : public CameraSessionListener {
     public:
+        // High rate per-frame events are queued here and drained by Java
+        // through pollEvents() in one JNI crossing, instead of a transition
+        // per event. The packed layout is mirrored on the Java side.
+        enum CameraEventType : int32_t {
+            EVENT_EXPOSURE_STATUS       = 1,
+            EVENT_AUTO_FOCUS_STATE      = 2,
+            EVENT_AUTO_EXPOSURE_STATE   = 3
+        };
+
+        struct CameraEvent {
+            int32_t type{0};
+            int32_t intArg{0};
+            float floatArg{0};
+            int32_t reserved{0};
+            int64_t longArg{0};
+        };
+
+        static const int EVENT_PACKED_SIZE = 24;
+
         NativeCameraBridgeListener(JNIEnv *env, jobject listener);
         ~NativeCameraBridgeListener();
 
@@ -23,10 +45,29 @@ namespace motioncam {
         void onMemoryAdjusting();
         void onMemoryStable();
 
+        // Copies up to maxEvents packed events into dst, returning the
+        // number written
+        int pollEvents(uint8_t* dst, const int maxEvents);
+
     private:
         JavaVM *mJavaVm;
         jobject mListenerInstance;
         jclass mListenerClass;
+
+        // Per-frame events waiting for the next Java poll
+        moodycamel::ConcurrentQueue<CameraEvent> mEvents;
+
+        // Method ids resolved once at construction. Looking them up per
+        // callback costs a JNI reflection call on every camera event.
+        jmethodID mOnCameraSessionStateChangedMethod;
+        jmethodID mOnCameraErrorMethod;
+        jmethodID mOnCameraStartedMethod;
+        jmethodID mOnCameraDisconnectedMethod;
+        jmethodID mOnCameraHdrImageCaptureProgressMethod;
+        jmethodID mOnCameraHdrImageCaptureCompletedMethod;
+        jmethodID mOnCameraHdrImageCaptureFailedMethod;
+        jmethodID mOnMemoryAdjustingMethod;
+        jmethodID mOnMemoryStableMethod;
     };
 }
 
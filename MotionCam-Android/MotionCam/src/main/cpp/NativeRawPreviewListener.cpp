@@ -3,12 +3,25 @@
 #include "camera/Logger.h"
 #include "JavaUtils.h"
 
+#include <cstring>
+
+#include <android/native_window_jni.h>
+
 namespace motioncam {
 
-    NativeRawPreviewListener::NativeRawPreviewListener(JNIEnv *env, jobject listener) :
+    NativeRawPreviewListener::NativeRawPreviewListener(JNIEnv *env, jobject listener, jobject previewSurface) :
         mJavaVm(nullptr),
-        mBitmap(nullptr)
+        mBitmap(nullptr),
+        mWindow(nullptr),
+        mWindowWidth(0),
+        mWindowHeight(0)
     {
+        if(previewSurface) {
+            mWindow = ANativeWindow_fromSurface(env, previewSurface);
+            if(!mWindow)
+                LOGW("Failed to get preview window, falling back to bitmap preview");
+        }
+
         if (env->GetJavaVM(&mJavaVm) != 0) {
             LOGE("Failed to get Java VM!");
             throw std::runtime_error("Failed to obtain java vm");
@@ -25,9 +38,18 @@ namespace motioncam {
         mListenerClass = reinterpret_cast<jclass>(env->NewGlobalRef(listenerClass));
         if(!mListenerClass)
             throw std::runtime_error("Failed to get listener class reference");
+
+        // Resolve the callback methods up front
+        mBitmapNeededMethod = env->GetMethodID(mListenerClass, "onRawPreviewBitmapNeeded", "(II)Landroid/graphics/Bitmap;");
+        mPreviewUpdatedMethod = env->GetMethodID(mListenerClass, "onRawPreviewUpdated", "()V");
     }
 
     NativeRawPreviewListener::~NativeRawPreviewListener() {
+        if(mWindow) {
+            ANativeWindow_release(mWindow);
+            mWindow = nullptr;
+        }
+
         JavaEnv env(mJavaVm);
         if (!env.getEnv()) {
             LOGE("~NativeRawPreviewListener() no environment");
@@ -44,7 +66,52 @@ namespace motioncam {
             env.getEnv()->DeleteGlobalRef(mBitmap);
     }
 
+    void NativeRawPreviewListener::postToWindow(const void* data, const int width, const int height) {
+        // Match the buffer geometry to the frame; the compositor scales the
+        // posted buffers to the view
+        if(mWindowWidth != width || mWindowHeight != height) {
+            if(ANativeWindow_setBuffersGeometry(mWindow, width, height, WINDOW_FORMAT_RGBA_8888) != 0) {
+                LOGE("ANativeWindow_setBuffersGeometry() failed");
+                return;
+            }
+
+            mWindowWidth = width;
+            mWindowHeight = height;
+        }
+
+        ANativeWindow_Buffer windowBuffer;
+
+        if(ANativeWindow_lock(mWindow, &windowBuffer, nullptr) != 0) {
+            LOGE("ANativeWindow_lock() failed");
+            return;
+        }
+
+        const auto* src = reinterpret_cast<const uint8_t*>(data);
+        auto* dst = reinterpret_cast<uint8_t*>(windowBuffer.bits);
+
+        if(windowBuffer.stride == width) {
+            std::memcpy(dst, src, static_cast<size_t>(width) * height * 4);
+        }
+        else {
+            for(int y = 0; y < height; y++) {
+                std::memcpy(dst + static_cast<size_t>(y) * windowBuffer.stride * 4,
+                            src + static_cast<size_t>(y) * width * 4,
+                            static_cast<size_t>(width) * 4);
+            }
+        }
+
+        if(ANativeWindow_unlockAndPost(mWindow) != 0)
+            LOGE("ANativeWindow_unlockAndPost() failed");
+    }
+
     void NativeRawPreviewListener::onPreviewGenerated(const void* data, const int len, const int width, const int height) {
+        // Posting to the display surface directly skips the bitmap copy and
+        // the per-frame JNI round trip
+        if(mWindow) {
+            postToWindow(data, width, height);
+            return;
+        }
+
         JavaEnv env(mJavaVm);
         if (!env.getEnv()) {
             LOGE("Dropped onPreviewGenerated()");
@@ -53,13 +120,12 @@ namespace motioncam {
 
         // Create bitmap if we don't have one
         if(!mBitmap) {
-            jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onRawPreviewBitmapNeeded", "(II)Landroid/graphics/Bitmap;");
-            if(!callbackMethod) {
+            if(!mBitmapNeededMethod) {
                 LOGE("onRawPreviewBitmapNeeded() missing");
                 return;
             }
 
-            jobject bitmap = env.getEnv()->CallObjectMethod(mListenerInstance, callbackMethod, width, height);
+            jobject bitmap = env.getEnv()->CallObjectMethod(mListenerInstance, mBitmapNeededMethod, width, height);
             if(!bitmap) {
                 LOGE("Failed to create RAW preview bitmap");
                 return;
@@ -124,13 +190,12 @@ namespace motioncam {
         }
 
         // Report bitmap updated
-        jmethodID callbackMethod = env.getEnv()->GetMethodID(mListenerClass, "onRawPreviewUpdated", "()V");
-        if(!callbackMethod) {
+        if(!mPreviewUpdatedMethod) {
             LOGE("onRawPreviewUpdated() missing");
             return;
         }
 
-        env.getEnv()->CallVoidMethod(mListenerInstance, callbackMethod);
+        env.getEnv()->CallVoidMethod(mListenerInstance, mPreviewUpdatedMethod);
     }
 
 } // namespace motioncam
@@ -3,6 +3,7 @@
 
 #include <jni.h>
 #include <android/bitmap.h>
+#include <android/native_window.h>
 
 #include "camera/RawPreviewListener.h"
 
@@ -10,16 +11,33 @@ namespace motioncam {
     class NativeRawPreviewListener : public RawPreviewListener {
 
     public:
-        NativeRawPreviewListener(JNIEnv *env, jobject listener);
+        // When previewSurface is given, frames are posted straight to its
+        // ANativeWindow and the bitmap callbacks are never invoked
+        NativeRawPreviewListener(JNIEnv *env, jobject listener, jobject previewSurface);
         ~NativeRawPreviewListener();
 
         void onPreviewGenerated(const void* data, const int len, const int width, const int height);
 
+    private:
+        void postToWindow(const void* data, const int width, const int height);
+
     private:
         JavaVM *mJavaVm;
         jobject mListenerInstance;
         jclass mListenerClass;
         jobject mBitmap;
+
+        // Display surface the preview renders into, bypassing the bitmap
+        // copy and the per-frame JNI round trip. Null when the caller didn't
+        // provide a surface; the bitmap path is used instead.
+        ANativeWindow* mWindow;
+        int32_t mWindowWidth;
+        int32_t mWindowHeight;
+
+        // Resolved once at construction; onPreviewGenerated() runs per
+        // preview frame and a GetMethodID there is pure reflection overhead
+        jmethodID mBitmapNeededMethod;
+        jmethodID mPreviewUpdatedMethod;
     };
 
 } // namespace motioncam
@@ -10,13 +10,79 @@
 #include "ImageProcessorListener.h"
 #include "DngConverterListener.h"
 #include "JavaUtils.h"
+#include "VideoEncoder.h"
 #include "camera/Logger.h"
 
 #include <android/bitmap.h>
 #include <unistd.h>
+#include <sys/stat.h>
+
+#include <deque>
+#include <mutex>
 
 static std::string gLastError;
 
+namespace {
+    // Opening a clip from the review UI queries the same container several
+    // times in a row (metadata, preview, export). Keep the last few parsed
+    // containers around, keyed by the identity of the underlying file, so
+    // repeated queries don't re-read the index and camera metadata.
+    struct CachedContainer {
+        dev_t dev;
+        ino_t ino;
+        off_t size;
+        time_t mtime;
+        std::shared_ptr<motioncam::RawContainer> container;
+    };
+
+    const size_t MaxCachedContainers = 4;
+
+    std::mutex gContainerCacheMutex;
+    std::deque<CachedContainer> gContainerCache;
+
+    std::shared_ptr<motioncam::RawContainer> OpenCachedContainer(const int fd) {
+        struct stat st{};
+
+        if(fstat(fd, &st) != 0)
+            return std::shared_ptr<motioncam::RawContainer>(motioncam::RawContainer::Open(fd));
+
+        std::lock_guard<std::mutex> lock(gContainerCacheMutex);
+
+        for(auto it = gContainerCache.begin(); it != gContainerCache.end(); ++it) {
+            if(it->dev != st.st_dev || it->ino != st.st_ino)
+                continue;
+
+            // Drop the entry if the file has changed since it was parsed
+            if(it->size != st.st_size || it->mtime != st.st_mtime) {
+                gContainerCache.erase(it);
+                break;
+            }
+
+            auto entry = *it;
+
+            // Move to the front of the cache
+            gContainerCache.erase(it);
+            gContainerCache.push_front(entry);
+
+            // The container owns its own descriptor
+            close(fd);
+
+            return entry.container;
+        }
+
+        std::shared_ptr<motioncam::RawContainer> container = motioncam::RawContainer::Open(fd);
+        if(!container)
+            return nullptr;
+
+        gContainerCache.push_front({ st.st_dev, st.st_ino, st.st_size, st.st_mtime, container });
+
+        while(gContainerCache.size() > MaxCachedContainers)
+            gContainerCache.pop_back();
+
+        return container;
+    }
+}
+
 extern "C" JNIEXPORT
 jboolean JNICALL Java_com_motioncam_processor_NativeProcessor_ProcessInMemory(
         JNIEnv *env,
@@ -141,16 +207,28 @@ extern "C" JNIEXPORT jobject JNICALL Java_com_motioncam_processor_NativeProcesso
     float duration = 0;
     int numFrames = 0;
     int numSegments = 0;
+    int droppedFrames = 0;
 
     try {
         jsize len = env->GetArrayLength(jfds);
         jint* fdsArray = env->GetIntArrayElements(jfds, 0);
 
-        std::vector<int> fds;
-        for(int i = 0; i < len; i++)
-            fds.push_back(fdsArray[i]);
+        std::vector<std::shared_ptr<motioncam::RawContainer>> containers;
+        std::vector<motioncam::RawContainer*> containerPtrs;
 
-        motioncam::MotionCam::GetMetadata(fds, duration, frameRate, numFrames, numSegments);
+        for(int i = 0; i < len; i++) {
+            auto container = OpenCachedContainer(fdsArray[i]);
+            if(!container) {
+                containers.clear();
+                break;
+            }
+
+            containers.push_back(container);
+            containerPtrs.push_back(container.get());
+        }
+
+        if(!containers.empty())
+            motioncam::MotionCam::GetMetadata(containerPtrs, duration, frameRate, numFrames, numSegments, droppedFrames);
     }
     catch(std::runtime_error& error) {
         gLastError = error.what();
@@ -181,23 +259,52 @@ JNIEXPORT jboolean JNICALL Java_com_motioncam_processor_NativeProcessor_Generate
         return JNI_FALSE;
 
     try {
-        auto container = motioncam::RawContainer::Open(fd);
+        auto container = OpenCachedContainer(fd);
         if(!container)
             return JNI_FALSE;
 
         motioncam::PostProcessSettings settings;
 
+        // For a single preview, use the embedded thumbnail when one is
+        // available instead of decoding a frame
+        if(numPreviews == 1) {
+            std::vector<uint8_t> thumbnailJpeg;
+
+            if(container->getThumbnail(thumbnailJpeg)) {
+                cv::Mat thumbnail = cv::imdecode(thumbnailJpeg, cv::IMREAD_COLOR);
+
+                if(!thumbnail.empty()) {
+                    jobject dst = env->CallObjectMethod(listener, callbackMethod, thumbnail.cols, thumbnail.rows, 0);
+                    if(!dst)
+                        return JNI_FALSE;
+
+                    auto output = Halide::Runtime::Buffer<uint8_t>::make_interleaved(thumbnail.cols, thumbnail.rows, 4);
+                    cv::Mat wrapped(thumbnail.rows, thumbnail.cols, CV_8UC4, output.data());
+
+                    cv::cvtColor(thumbnail, wrapped, cv::COLOR_BGR2RGBA);
+
+                    if(!motioncam::CopyBitmap(env, output, dst))
+                        return JNI_FALSE;
+
+                    return JNI_TRUE;
+                }
+            }
+        }
+
         auto& cameraMetadata = container->getCameraMetadata();
         auto frames = container->getFrames();
 
         int step = std::max(1, (int) frames.size() / numPreviews);
 
+        // Recycled across the preview frames
+        Halide::Runtime::Buffer<uint8_t> output;
+
         for(int i = 0; i < frames.size(); i+=step) {
             auto frame = container->loadFrame(frames[i]);
             if(!frame)
                 continue;
 
-            auto output = motioncam::ImageProcessor::createFastPreview(*frame, 8, 8, cameraMetadata);
+            motioncam::ImageProcessor::createFastPreview(*frame, 8, 8, cameraMetadata, output);
             jobject dst = env->CallObjectMethod(listener, callbackMethod, output.width(), output.height(), 0);
 
             if(!dst)
@@ -214,6 +321,120 @@ JNIEXPORT jboolean JNICALL Java_com_motioncam_processor_NativeProcessor_Generate
     return JNI_TRUE;
 }
 
+extern "C"
+JNIEXPORT jboolean JNICALL Java_com_motioncam_processor_NativeProcessor_ExportRawVideo(
+        JNIEnv *env,
+        jobject thiz,
+        jintArray jfds,
+        jint outputFd,
+        jint downscale,
+        jboolean useHevc,
+        jobject progressListener)
+{
+    try {
+        DngConverterListener listener(env, progressListener);
+
+        jsize len = env->GetArrayLength(jfds);
+        jint* fdsArray = env->GetIntArrayElements(jfds, 0);
+
+        std::vector<std::unique_ptr<motioncam::RawContainer>> containers;
+
+        for(int i = 0; i < len; i++)
+            containers.push_back(motioncam::RawContainer::Open(fdsArray[i]));
+
+        env->ReleaseIntArrayElements(jfds, fdsArray, 0);
+
+        std::vector<motioncam::util::ContainerFrame> orderedFrames;
+        motioncam::util::GetOrderedFrames(containers, orderedFrames);
+
+        if(orderedFrames.empty()) {
+            gLastError = "No frames to export";
+            return JNI_FALSE;
+        }
+
+        float frameRate = 30.0f;
+
+        if(orderedFrames.size() > 1) {
+            const double durationNs =
+                    static_cast<double>(orderedFrames.back().timestamp - orderedFrames.front().timestamp);
+
+            if(durationNs > 0)
+                frameRate = static_cast<float>((orderedFrames.size() - 1) * 1e9 / durationNs);
+        }
+
+        // Recycled across frames
+        Halide::Runtime::Buffer<uint8_t> output;
+
+        std::unique_ptr<VideoEncoder> encoder;
+        int evenWidth = 0;
+        int evenHeight = 0;
+
+        const int64_t firstTimestamp = orderedFrames.front().timestamp;
+
+        for(size_t i = 0; i < orderedFrames.size(); i++) {
+            auto& container = containers[orderedFrames[i].containerIndex];
+
+            auto frame = container->loadFrame(orderedFrames[i].frameName);
+            if(!frame)
+                continue;
+
+            motioncam::ImageProcessor::createFastPreview(
+                    *frame, downscale, downscale, container->getCameraMetadata(), output);
+
+            // The first rendered frame sizes the encoder. 4:2:0 needs even
+            // dimensions.
+            if(!encoder) {
+                evenWidth = output.width() & ~1;
+                evenHeight = output.height() & ~1;
+
+                encoder = std::unique_ptr<VideoEncoder>(
+                        new VideoEncoder(evenWidth, evenHeight, frameRate, outputFd, useHevc));
+
+                if(!encoder->isValid()) {
+                    gLastError = encoder->error();
+                    return JNI_FALSE;
+                }
+            }
+
+            cv::Mat rgba(output.height(), output.width(), CV_8UC4, output.data());
+            const int64_t presentationTimeUs = (orderedFrames[i].timestamp - firstTimestamp) / 1000;
+
+            if(!encoder->encodeFrame(rgba(cv::Rect(0, 0, evenWidth, evenHeight)), presentationTimeUs)) {
+                gLastError = encoder->error();
+                return JNI_FALSE;
+            }
+
+            // Cancelled from Java
+            if(!listener.onProgressUpdate(static_cast<int>(i * 100 / orderedFrames.size())))
+                return JNI_FALSE;
+        }
+
+        if(!encoder || !encoder->finish()) {
+            gLastError = encoder ? encoder->error() : "No frames decoded";
+            return JNI_FALSE;
+        }
+
+        listener.onCompleted();
+    }
+    catch(std::runtime_error& e) {
+        jclass exClass = env->FindClass("java/lang/RuntimeException");
+        if (exClass == nullptr) {
+            return JNI_FALSE;
+        }
+
+        gLastError = e.what();
+        env->ThrowNew(exClass, e.what());
+    }
+
+    return JNI_TRUE;
+}
+
+extern "C"
+JNIEXPORT void JNICALL Java_com_motioncam_processor_NativeProcessor_SetExportThrottle(
+        JNIEnv *env, jclass thiz, jfloat throttle) {
+    motioncam::MotionCam::SetExportThrottle(throttle);
+}
+
 extern "C"
 JNIEXPORT void JNICALL Java_com_motioncam_processor_NativeProcessor_CloseFd(JNIEnv *env, jclass thiz, jint fd) {
     close(fd);
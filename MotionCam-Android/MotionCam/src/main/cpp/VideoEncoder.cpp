@@ -0,0 +1,252 @@
+#include "VideoEncoder.h"
+#include "camera/Logger.h"
+
+#include <media/NdkMediaFormat.h>
+
+#include <cstring>
+
+namespace {
+    // COLOR_FormatYUV420Planar. The NDK media headers don't export the
+    // MediaCodecInfo constants.
+    const int32_t ColorFormatYuv420Planar = 19;
+
+    const int64_t DequeueTimeoutUs  = 10000;
+    const int32_t IFrameIntervalSec = 1;
+
+    // Proxy quality target. Works out to roughly 30 Mbit/s for 4K30.
+    const float BitsPerPixel        = 0.12f;
+    const int32_t MinBitRate        = 2000000;
+}
+
+VideoEncoder::VideoEncoder(const int width,
+                           const int height,
+                           const float frameRate,
+                           const int outputFd,
+                           const bool useHevc) :
+    mCodec(nullptr),
+    mMuxer(nullptr),
+    mTrackIdx(-1),
+    mMuxerStarted(false),
+    mFinished(false),
+    mWidth(width),
+    mHeight(height),
+    mStride(width),
+    mSliceHeight(height)
+{
+    const char* mimeType = useHevc ? "video/hevc" : "video/avc";
+
+    mCodec = AMediaCodec_createEncoderByType(mimeType);
+
+    // Fall back to H.264 when the device has no HEVC encoder
+    if(!mCodec && useHevc) {
+        mimeType = "video/avc";
+        mCodec = AMediaCodec_createEncoderByType(mimeType);
+    }
+
+    if(!mCodec) {
+        fail("No hardware encoder available");
+        return;
+    }
+
+    const int32_t bitRate =
+        (std::max)(MinBitRate, static_cast<int32_t>(width * height * frameRate * BitsPerPixel));
+
+    AMediaFormat* format = AMediaFormat_new();
+
+    AMediaFormat_setString(format, AMEDIAFORMAT_KEY_MIME, mimeType);
+    AMediaFormat_setInt32(format, AMEDIAFORMAT_KEY_WIDTH, width);
+    AMediaFormat_setInt32(format, AMEDIAFORMAT_KEY_HEIGHT, height);
+    AMediaFormat_setInt32(format, AMEDIAFORMAT_KEY_COLOR_FORMAT, ColorFormatYuv420Planar);
+    AMediaFormat_setInt32(format, AMEDIAFORMAT_KEY_BIT_RATE, bitRate);
+    AMediaFormat_setFloat(format, AMEDIAFORMAT_KEY_FRAME_RATE, frameRate);
+    AMediaFormat_setInt32(format, AMEDIAFORMAT_KEY_I_FRAME_INTERVAL, IFrameIntervalSec);
+
+    media_status_t status =
+        AMediaCodec_configure(mCodec, format, nullptr, nullptr, AMEDIACODEC_CONFIGURE_FLAG_ENCODE);
+
+    AMediaFormat_delete(format);
+
+    if(status != AMEDIA_OK) {
+        fail("Failed to configure encoder (" + std::to_string(status) + ")");
+        return;
+    }
+
+    if(AMediaCodec_start(mCodec) != AMEDIA_OK) {
+        fail("Failed to start encoder");
+        return;
+    }
+
+    // The encoder may want padded input rows
+    AMediaFormat* inputFormat = AMediaCodec_getInputFormat(mCodec);
+
+    if(inputFormat) {
+        AMediaFormat_getInt32(inputFormat, "stride", &mStride);
+        AMediaFormat_getInt32(inputFormat, "slice-height", &mSliceHeight);
+
+        AMediaFormat_delete(inputFormat);
+    }
+
+    mMuxer = AMediaMuxer_new(outputFd, AMEDIAMUXER_OUTPUT_FORMAT_MPEG_4);
+
+    if(!mMuxer) {
+        fail("Failed to create muxer");
+        return;
+    }
+
+    LOGI("Video encoder %s %dx%d @ %.2f fps, %d bps (stride=%d, sliceHeight=%d)",
+         mimeType, width, height, frameRate, bitRate, mStride, mSliceHeight);
+}
+
+VideoEncoder::~VideoEncoder() {
+    if(mCodec) {
+        AMediaCodec_stop(mCodec);
+        AMediaCodec_delete(mCodec);
+    }
+
+    if(mMuxer) {
+        if(mMuxerStarted && mFinished)
+            AMediaMuxer_stop(mMuxer);
+
+        AMediaMuxer_delete(mMuxer);
+    }
+}
+
+bool VideoEncoder::isValid() const {
+    return mError.empty();
+}
+
+const std::string& VideoEncoder::error() const {
+    return mError;
+}
+
+bool VideoEncoder::fail(const std::string& error) {
+    LOGE("VideoEncoder: %s", error.c_str());
+    mError = error;
+
+    return false;
+}
+
+bool VideoEncoder::encodeFrame(const cv::Mat& rgba, const int64_t presentationTimeUs) {
+    if(!isValid() || mFinished)
+        return false;
+
+    if(rgba.cols != mWidth || rgba.rows != mHeight)
+        return fail("Frame size does not match encoder");
+
+    cv::cvtColor(rgba, mYuv, cv::COLOR_RGBA2YUV_I420);
+
+    return queueConvertedFrame(presentationTimeUs) && drainEncoder(false);
+}
+
+bool VideoEncoder::queueConvertedFrame(const int64_t presentationTimeUs) {
+    const ssize_t inputIdx = AMediaCodec_dequeueInputBuffer(mCodec, DequeueTimeoutUs);
+
+    if(inputIdx < 0)
+        return fail("Timed out waiting for an input buffer");
+
+    size_t capacity = 0;
+    uint8_t* dst = AMediaCodec_getInputBuffer(mCodec, inputIdx, &capacity);
+
+    const int chromaStride = mStride / 2;
+    const int chromaSliceHeight = mSliceHeight / 2;
+    const size_t requiredBytes = mStride * mSliceHeight + 2 * chromaStride * chromaSliceHeight;
+
+    if(!dst || capacity < requiredBytes)
+        return fail("Input buffer too small");
+
+    // The conversion output is tightly packed I420; the encoder may want
+    // padded rows, so planes are copied a row at a time
+    const uint8_t* srcY = mYuv.data;
+    const uint8_t* srcU = srcY + mWidth * mHeight;
+    const uint8_t* srcV = srcU + (mWidth / 2) * (mHeight / 2);
+
+    uint8_t* dstY = dst;
+    uint8_t* dstU = dstY + mStride * mSliceHeight;
+    uint8_t* dstV = dstU + chromaStride * chromaSliceHeight;
+
+    for(int y = 0; y < mHeight; y++)
+        std::memcpy(dstY + y * mStride, srcY + y * mWidth, mWidth);
+
+    for(int y = 0; y < mHeight / 2; y++) {
+        std::memcpy(dstU + y * chromaStride, srcU + y * (mWidth / 2), mWidth / 2);
+        std::memcpy(dstV + y * chromaStride, srcV + y * (mWidth / 2), mWidth / 2);
+    }
+
+    media_status_t status = AMediaCodec_queueInputBuffer(
+        mCodec, inputIdx, 0, requiredBytes, presentationTimeUs, 0);
+
+    if(status != AMEDIA_OK)
+        return fail("Failed to queue input buffer (" + std::to_string(status) + ")");
+
+    return true;
+}
+
+bool VideoEncoder::drainEncoder(const bool endOfStream) {
+    AMediaCodecBufferInfo bufferInfo;
+
+    while(true) {
+        const ssize_t outputIdx =
+            AMediaCodec_dequeueOutputBuffer(mCodec, &bufferInfo, endOfStream ? DequeueTimeoutUs : 0);
+
+        if(outputIdx == AMEDIACODEC_INFO_TRY_AGAIN_LATER) {
+            if(!endOfStream)
+                return true;
+
+            return fail("Timed out draining encoder");
+        }
+        else if(outputIdx == AMEDIACODEC_INFO_OUTPUT_FORMAT_CHANGED) {
+            if(mMuxerStarted)
+                return fail("Encoder format changed twice");
+
+            AMediaFormat* outputFormat = AMediaCodec_getOutputFormat(mCodec);
+
+            mTrackIdx = AMediaMuxer_addTrack(mMuxer, outputFormat);
+            AMediaFormat_delete(outputFormat);
+
+            if(mTrackIdx < 0)
+                return fail("Failed to add muxer track");
+
+            if(AMediaMuxer_start(mMuxer) != AMEDIA_OK)
+                return fail("Failed to start muxer");
+
+            mMuxerStarted = true;
+        }
+        else if(outputIdx >= 0) {
+            // The codec config buffer is carried by the track format
+            if(!(bufferInfo.flags & AMEDIACODEC_BUFFER_FLAG_CODEC_CONFIG) && bufferInfo.size > 0) {
+                if(!mMuxerStarted)
+                    return fail("Encoded data before the output format");
+
+                size_t capacity = 0;
+                uint8_t* data = AMediaCodec_getOutputBuffer(mCodec, outputIdx, &capacity);
+
+                AMediaMuxer_writeSampleData(mMuxer, mTrackIdx, data, &bufferInfo);
+            }
+
+            AMediaCodec_releaseOutputBuffer(mCodec, outputIdx, false);
+
+            if(bufferInfo.flags & AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM)
+                return true;
+        }
+    }
+}
+
+bool VideoEncoder::finish() {
+    if(!isValid() || mFinished)
+        return false;
+
+    const ssize_t inputIdx = AMediaCodec_dequeueInputBuffer(mCodec, DequeueTimeoutUs);
+
+    if(inputIdx < 0)
+        return fail("Timed out queueing end of stream");
+
+    AMediaCodec_queueInputBuffer(
+        mCodec, inputIdx, 0, 0, 0, AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM);
+
+    if(!drainEncoder(true))
+        return false;
+
+    mFinished = true;
+
+    return true;
+}
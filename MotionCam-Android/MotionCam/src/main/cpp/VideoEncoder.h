@@ -0,0 +1,57 @@
+#ifndef MOTIONCAM_ANDROID_VIDEOENCODER_H
+#define MOTIONCAM_ANDROID_VIDEOENCODER_H
+
+#include <media/NdkMediaCodec.h>
+#include <media/NdkMediaMuxer.h>
+
+#include <opencv2/opencv.hpp>
+#include <string>
+
+// Hardware HEVC/H.264 encoder with an MP4 muxer attached. Frames go in as
+// RGBA, are converted to the encoder's YUV input layout, and come out as a
+// playable file on the given descriptor.
+class VideoEncoder {
+public:
+    VideoEncoder(const int width,
+                 const int height,
+                 const float frameRate,
+                 const int outputFd,
+                 const bool useHevc);
+
+    ~VideoEncoder();
+
+    bool isValid() const;
+    const std::string& error() const;
+
+    // Encodes a single RGBA frame. Presentation times are in microseconds
+    // and must be increasing.
+    bool encodeFrame(const cv::Mat& rgba, const int64_t presentationTimeUs);
+
+    // Signals end of stream, drains the encoder and finalizes the muxer.
+    // The output file is not playable until this has returned true.
+    bool finish();
+
+private:
+    bool fail(const std::string& error);
+    bool queueConvertedFrame(const int64_t presentationTimeUs);
+    bool drainEncoder(const bool endOfStream);
+
+private:
+    AMediaCodec* mCodec;
+    AMediaMuxer* mMuxer;
+    ssize_t mTrackIdx;
+    bool mMuxerStarted;
+    bool mFinished;
+
+    int mWidth;
+    int mHeight;
+    int mStride;
+    int mSliceHeight;
+
+    // Reused I420 conversion buffer
+    cv::Mat mYuv;
+
+    std::string mError;
+};
+
+#endif //MOTIONCAM_ANDROID_VIDEOENCODER_H
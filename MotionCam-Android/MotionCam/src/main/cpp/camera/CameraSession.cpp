@@ -21,55 +21,19 @@
 namespace motioncam {
     const static uint32_t MAX_BUFFERED_RAW_IMAGES = 8;
 
-    enum class EventAction : int {
-        ACTION_OPEN_CAMERA = 0,
-        ACTION_CLOSE_CAMERA,
-        ACTION_PAUSE_CAPTURE,
-        ACTION_RESUME_CAPTURE,
-
-        ACTION_SET_AUTO_EXPOSURE,
-        ACTION_SET_MANUAL_EXPOSURE,
-        ACTION_SET_EXPOSURE_COMP_VALUE,
-        ACTION_SET_FRAME_RATE,
-        ACTION_SET_AWB_LOCK,
-        ACTION_SET_AE_LOCK,
-        ACTION_SET_OIS,
-        ACTION_SET_LENS_APERTURE,
-        ACTION_SET_TORCH,
-        ACTION_SET_FOCUS_DISTANCE,
-        ACTION_SET_FOCUS_FOR_VIDEO,
-        ACTION_SET_AUTO_FOCUS,
-        ACTION_SET_FOCUS_POINT,
-        ACTION_UPDATE_PREVIEW,
-        ACTION_ACTIVATE_CAMERA_SETTINGS,
-        ACTION_PRECAPTURE_HDR,
-        ACTION_CAPTURE_HDR,
-
-        EVENT_SAVE,
-        EVENT_SAVE_HDR_DATA,
-
-        EVENT_CAMERA_ERROR,
-        EVENT_CAMERA_DISCONNECTED,
-        EVENT_CAMERA_SESSION_CHANGED,
-        EVENT_CAMERA_SEQUENCE_COMPLETED,
-
-        EVENT_CAMERA_EXPOSURE_STATUS_CHANGED,
-        EVENT_CAMERA_AUTO_EXPOSURE_STATE_CHANGED,
-        EVENT_CAMERA_AUTO_FOCUS_STATE_CHANGED,
-
-        STOP
-    };
-
-    struct EventLoopData {
-        EventLoopData(EventAction eventAction, json11::Json data) :
-                eventAction(eventAction),
-                data(std::move(data))
-        {
-        }
+    // The preview stream only ever needs the newest frame, so its reader can
+    // be much shallower than the recording reader
+    const static uint32_t MAX_BUFFERED_PREVIEW_RAW_IMAGES = 4;
+
+    // Initial capacity of the event queue. Sized so the queue's block pool
+    // is warmed up front and posting events doesn't allocate blocks.
+    const static size_t EVENT_LOOP_QUEUE_SIZE = 128;
 
-        const EventAction eventAction;
-        const json11::Json data;
-    };
+    // Minimum time between resubmissions of the repeating capture request,
+    // roughly one frame interval at 30fps. Slider UIs activate the camera
+    // settings dozens of times a second; activations inside the window are
+    // deferred and coalesced into one resubmit.
+    const static int ACTIVATE_COALESCE_TIME_MS = 33;
 
     CameraFocusState GetFocusState(acamera_metadata_enum_android_control_af_state_t state) {
         switch(state) {
@@ -125,6 +89,10 @@ namespace motioncam {
             reinterpret_cast<CameraSession *>(context)->onRawImageAvailable(reader);
         }
 
+        void OnPreviewImageAvailable(void *context, AImageReader *reader) {
+            reinterpret_cast<CameraSession *>(context)->onPreviewRawImageAvailable(reader);
+        }
+
         void OnCameraError(void* context, ACameraDevice* device, int error) {
             reinterpret_cast<CameraSession *>(context)->onCameraError(error);
         }
@@ -189,6 +157,17 @@ namespace motioncam {
         return std::max(std::min(x, max), min);
     }
 
+    size_t hashTonemapSettings(float shadows, float contrast, float blackPoint, float whitePoint, int pts) {
+        size_t hash = std::hash<float>()(shadows);
+
+        hash = hash * 31 + std::hash<float>()(contrast);
+        hash = hash * 31 + std::hash<float>()(blackPoint);
+        hash = hash * 31 + std::hash<float>()(whitePoint);
+        hash = hash * 31 + std::hash<int>()(pts);
+
+        return hash;
+    }
+
     void generateTonemapCurve(float shadows, float brightness, float contrast, float blackPoint, float whitePoint, int pts, std::vector<float>& output) {
         output.clear();
 
@@ -229,11 +208,20 @@ namespace motioncam {
             mLastFocusState(CameraFocusState::INACTIVE),
             mLastExposureState(CameraExposureState::INACTIVE),
             mScreenOrientation(ScreenOrientation::PORTRAIT),
+            mMaxDrainedImages(1),
             mRequestedHdrCaptures(0),
             mRequestHdrCaptureTimestamp(-1),
+            mHdrBurstNumImages(0),
+            mHdrBurstBaseIso(-1),
+            mHdrBurstBaseExposure(-1),
+            mHdrBurstHdrIso(-1),
+            mHdrBurstHdrExposure(-1),
             mLongHdrCaptureInProgress(false),
             mHdrCaptureSequenceCompleted(true),
-            mAcceptEvents(false)
+            mAcceptEvents(false),
+            mEventLoopQueue(EVENT_LOOP_QUEUE_SIZE),
+            mTonemapCurveHash(0),
+            mHaveDeferredActivation(false)
     {
     }
 
@@ -250,6 +238,8 @@ namespace motioncam {
         std::shared_ptr<CameraDescription> cameraDescription,
         const OutputConfiguration& rawOutputConfig,
         const OutputConfiguration& previewOutputConfig,
+        const OutputConfiguration& previewRawOutputConfig,
+        bool hasPreviewRawStream,
         std::shared_ptr<ACameraManager> cameraManager,
         std::shared_ptr<ANativeWindow> previewOutputWindow,
         bool setupForRawPreview,
@@ -265,13 +255,15 @@ namespace motioncam {
         mCameraManager = std::move(cameraManager);
         mSessionListener = std::move(sessionListener);
         mCameraDescription = std::move(cameraDescription);
-        mImageConsumer = std::make_shared<RawImageConsumer>(mCameraDescription, mSessionListener, maxMemoryUsageBytes);
+        mImageConsumer = std::make_shared<RawImageConsumer>(mCameraDescription, mSessionListener, hasPreviewRawStream, maxMemoryUsageBytes);
 
         // Create new session context and set up callbacks
         mSessionContext = std::make_shared<CameraCaptureSessionContext>();
 
         mSessionContext->outputConfig = rawOutputConfig;
         mSessionContext->previewOutputConfig = previewOutputConfig;
+        mSessionContext->previewRawOutputConfig = previewRawOutputConfig;
+        mSessionContext->hasPreviewRawStream = hasPreviewRawStream;
         mSessionContext->nativeWindow = std::move(previewOutputWindow);
 
         setupCallbacks();
@@ -612,12 +604,98 @@ namespace motioncam {
                 throw CameraSessionException("Failed to add HDR RAW output target");
     }
 
+    void CameraSession::setupPreviewRawCaptureOutput(CameraCaptureSessionContext& state) {
+        AImageReader* imageReader = nullptr;
+
+        media_status_t result =
+                AImageReader_new(
+                        state.previewRawOutputConfig.outputSize.originalWidth(),
+                        state.previewRawOutputConfig.outputSize.originalHeight(),
+                        state.previewRawOutputConfig.format,
+                        MAX_BUFFERED_PREVIEW_RAW_IMAGES,
+                        &imageReader);
+
+        if (result != AMEDIA_OK) {
+            throw CameraSessionException(std::string("Failed to create preview RAW image reader") + " (" + std::to_string(result) + ")");
+        }
+
+        state.previewRawImageReader = std::shared_ptr<AImageReader>(imageReader, AImageReader_delete);
+
+        state.previewRawImageListener.context = this;
+        state.previewRawImageListener.onImageAvailable = OnPreviewImageAvailable;
+
+        // Set up image listener callback
+        AImageReader_setImageListener(state.previewRawImageReader.get(), &state.previewRawImageListener);
+
+        // Set up preview RAW output
+        ANativeWindow* nativeWindow = nullptr;
+        AImageReader_getWindow(state.previewRawImageReader.get(), &nativeWindow);
+
+        ACaptureSessionOutput* sessionOutput = nullptr;
+        ACameraOutputTarget* outputTarget = nullptr;
+
+        if (ACaptureSessionOutput_create(nativeWindow, &sessionOutput) != ACAMERA_OK)
+            throw CameraSessionException("Failed to create preview raw image reader capture session output");
+
+        state.previewRawSessionOutput = std::shared_ptr<ACaptureSessionOutput>(sessionOutput, ACaptureSessionOutput_free);
+
+        if (ACameraOutputTarget_create(nativeWindow, &outputTarget) != ACAMERA_OK)
+            throw CameraSessionException("Failed to create preview raw target");
+
+        state.previewRawOutputTarget = std::shared_ptr<ACameraOutputTarget>(outputTarget, ACameraOutputTarget_free);
+
+        if (ACaptureSessionOutputContainer_add(state.captureSessionContainer.get(), state.previewRawSessionOutput.get()) != ACAMERA_OK)
+            throw CameraSessionException("Failed to add preview raw session output to container");
+
+        // Only the repeating request feeds the preview. The HDR captures keep
+        // writing into the full resolution stream alone.
+        if (ACaptureRequest_addTarget(mSessionContext->repeatCaptureRequest->captureRequest, outputTarget) != ACAMERA_OK)
+            throw CameraSessionException("Failed to add preview RAW output target");
+    }
+
+    // Expected size of a RAW buffer from the HAL for the given output
+    // configuration, assuming unpadded rows. Used to preallocate the buffer
+    // pool before the first frame arrives; a HAL that pads its rows makes
+    // the estimate miss and the pool is rebuilt from the real size instead.
+    static size_t EstimateRawBufferSize(const OutputConfiguration& outputConfig) {
+        const int64_t width = outputConfig.outputSize.originalWidth();
+        const int64_t height = outputConfig.outputSize.originalHeight();
+
+        int64_t rowBytes;
+
+        switch(outputConfig.format) {
+            case AIMAGE_FORMAT_RAW10:
+                rowBytes = (width * 10) / 8;
+                break;
+
+            case AIMAGE_FORMAT_RAW12:
+                rowBytes = (width * 12) / 8;
+                break;
+
+            case AIMAGE_FORMAT_RAW16:
+                rowBytes = width * 2;
+                break;
+
+            default:
+                return 0;
+        }
+
+        return static_cast<size_t>(rowBytes * height);
+    }
+
     void CameraSession::doOpenCamera(bool setupForRawPreview, const json11::Json& startupSettings) {
         if(mState != CameraCaptureSessionState::CLOSED) {
             LOGE("Trying to open camera that isn't closed");
             return;
         }
 
+        // Warm up the image consumer while the HAL opens the camera device;
+        // the two together dominate the cold start time and neither depends
+        // on the other.
+        std::thread preallocateThread([this] {
+            mImageConsumer->preallocate(EstimateRawBufferSize(mSessionContext->outputConfig));
+        });
+
         // Open the camera
         LOGD("Opening camera");
         ACameraDevice* device = nullptr;
@@ -628,6 +706,8 @@ namespace motioncam {
                 &mSessionContext->deviceStateCallbacks,
                 &device) != ACAMERA_OK)
         {
+            preallocateThread.join();
+
             throw CameraSessionException("Failed to open camera");
         }
 
@@ -635,6 +715,8 @@ namespace motioncam {
 
         LOGD("Camera has opened");
 
+        preallocateThread.join();
+
         // Create output container
         ACaptureSessionOutputContainer* container = nullptr;
 
@@ -657,6 +739,10 @@ namespace motioncam {
         // Set up output for capture
         setupRawCaptureOutput(*mSessionContext);
 
+        // Set up the smaller RAW output for preview, when the camera has one
+        if(mSessionContext->hasPreviewRawStream)
+            setupPreviewRawCaptureOutput(*mSessionContext);
+
         // Set up output for preview
         setupPreviewCaptureOutput(*mSessionContext, setupForRawPreview);
 
@@ -711,6 +797,7 @@ namespace motioncam {
 
         LOGD("Closing RAW image reader");
         mSessionContext->rawImageReader = nullptr;
+        mSessionContext->previewRawImageReader = nullptr;
 
         // Free capture request
         if(mSessionContext->previewOutputTarget && mSessionContext->repeatCaptureRequest->isPreviewOutput)
@@ -719,8 +806,12 @@ namespace motioncam {
         if(mSessionContext->rawOutputTarget)
             ACaptureRequest_removeTarget(mSessionContext->repeatCaptureRequest->captureRequest, mSessionContext->rawOutputTarget.get());
 
+        if(mSessionContext->previewRawOutputTarget)
+            ACaptureRequest_removeTarget(mSessionContext->repeatCaptureRequest->captureRequest, mSessionContext->previewRawOutputTarget.get());
+
         mSessionContext->previewOutputTarget    = nullptr;
         mSessionContext->rawOutputTarget        = nullptr;
+        mSessionContext->previewRawOutputTarget = nullptr;
 
         // Clear session container
         if(mSessionContext->captureSessionContainer) {
@@ -729,11 +820,15 @@ namespace motioncam {
 
             if(mSessionContext->rawSessionOutput)
                 ACaptureSessionOutputContainer_remove(mSessionContext->captureSessionContainer.get(), mSessionContext->rawSessionOutput.get());
+
+            if(mSessionContext->previewRawSessionOutput)
+                ACaptureSessionOutputContainer_remove(mSessionContext->captureSessionContainer.get(), mSessionContext->previewRawSessionOutput.get());
         }
 
         mSessionContext->captureSessionContainer    = nullptr;
         mSessionContext->previewSessionOutput       = nullptr;
         mSessionContext->rawSessionOutput           = nullptr;
+        mSessionContext->previewRawSessionOutput    = nullptr;
         mSessionContext->nativeWindow               = nullptr;
 
         LOGD("Camera closed");
@@ -745,6 +840,9 @@ namespace motioncam {
             return;
         }
 
+        // A deferred activation would restart the repeating request
+        mHaveDeferredActivation = false;
+
         mCameraStateManager->requestPause();
     }
 
@@ -764,10 +862,20 @@ namespace motioncam {
         }
 
         if (mState == CameraCaptureSessionState::ACTIVE) {
+            // Don't rebuild and resubmit the curve if the settings haven't changed. This is the
+            // common case when dragging a slider generates repeated updates with the same values.
+            size_t curveHash =
+                hashTonemapSettings(shadows, contrast, blackPoint, whitePoint, mCameraDescription->maxTonemapCurvePts);
+
+            if(curveHash == mTonemapCurveHash)
+                return;
+
             generateTonemapCurve(shadows, 1.0f, contrast, blackPoint, whitePoint, mCameraDescription->maxTonemapCurvePts, mTonemapCurvePts);
 
+            mTonemapCurveHash = curveHash;
+
             mCameraStateManager->requestUpdatePreview(std::move(mTonemapCurvePts));
-            mCameraStateManager->activate();
+            doActivateCameraSettings();
         }
     }
 
@@ -843,6 +951,10 @@ namespace motioncam {
 
         LOGI("Initiating HDR precapture (hdrIso=%d, hdrExposure=%ld)", iso, exposure);
 
+        // The precapture mutates the shared HDR capture requests, so any previously
+        // compiled bracket is stale
+        mHdrBurstRequests.clear();
+
         // Keep timestamp of latest buffer as our reference
         mRequestHdrCaptureTimestamp = RawBufferManager::get().latestTimeStamp();
         mRequestedHdrCaptures = 1;
@@ -855,9 +967,16 @@ namespace motioncam {
                 &mSessionContext->captureCallbacks[CaptureEvent::HDR_CAPTURE]->sequenceId);
     }
 
-    void CameraSession::doCaptureHdr(int numImages, int baseIso, int64_t baseExposure, int hdrIso, int64_t hdrExposure) {
-        if(numImages < 1) {
-            LOGE("Invalid HDR capture requested (numImages < 1)");
+    void CameraSession::buildHdrBurstRequests(int numImages, int baseIso, int64_t baseExposure, int hdrIso, int64_t hdrExposure) {
+        // Skip rebuilding the bracket when it has already been compiled with the same
+        // parameters (e.g. during prepareHdr() ahead of the shutter press)
+        if( mHdrBurstNumImages == numImages      &&
+            mHdrBurstBaseIso == baseIso          &&
+            mHdrBurstBaseExposure == baseExposure&&
+            mHdrBurstHdrIso == hdrIso            &&
+            mHdrBurstHdrExposure == hdrExposure  &&
+            !mHdrBurstRequests.empty() )
+        {
             return;
         }
 
@@ -875,18 +994,33 @@ namespace motioncam {
         ACaptureRequest_setEntry_i32(mSessionContext->hdrCaptureRequests[1]->captureRequest, ACAMERA_SENSOR_SENSITIVITY, 1, &hdrIso);
         ACaptureRequest_setEntry_i64(mSessionContext->hdrCaptureRequests[1]->captureRequest, ACAMERA_SENSOR_EXPOSURE_TIME, 1, &hdrExposure);
 
-        std::vector<ACaptureRequest*> captureRequests;
-
         // Allocate enough for numImages + 1 underexposed images
-        mRequestedHdrCaptures = numImages + 1;
-
-        captureRequests.resize(mRequestedHdrCaptures);
+        mHdrBurstRequests.resize(numImages + 1);
 
-        for (int i = 0; i < mRequestedHdrCaptures; i++)
-            captureRequests[i] = mSessionContext->hdrCaptureRequests[0]->captureRequest;
+        for (size_t i = 0; i < mHdrBurstRequests.size(); i++)
+            mHdrBurstRequests[i] = mSessionContext->hdrCaptureRequests[0]->captureRequest;
 
         // Second capture is underexposed image
-        captureRequests[1] = mSessionContext->hdrCaptureRequests[1]->captureRequest;
+        mHdrBurstRequests[1] = mSessionContext->hdrCaptureRequests[1]->captureRequest;
+
+        mHdrBurstNumImages = numImages;
+        mHdrBurstBaseIso = baseIso;
+        mHdrBurstBaseExposure = baseExposure;
+        mHdrBurstHdrIso = hdrIso;
+        mHdrBurstHdrExposure = hdrExposure;
+    }
+
+    void CameraSession::doCaptureHdr(int numImages, int baseIso, int64_t baseExposure, int hdrIso, int64_t hdrExposure) {
+        if(numImages < 1) {
+            LOGE("Invalid HDR capture requested (numImages < 1)");
+            return;
+        }
+
+        // The bracket is usually precompiled by prepareHdr(); in that case this is a no-op
+        // and the burst is submitted without any per-request work on the shutter path.
+        buildHdrBurstRequests(numImages, baseIso, baseExposure, hdrIso, hdrExposure);
+
+        mRequestedHdrCaptures = numImages + 1;
 
         LOGI("Initiating HDR capture (numImages=%d, baseIso=%d, baseExposure=%ld, hdrIso=%d, hdrExposure=%ld)",
                 numImages, baseIso, baseExposure, hdrIso, hdrExposure);
@@ -897,8 +1031,8 @@ namespace motioncam {
         ACameraCaptureSession_capture(
             mSessionContext->captureSession.get(),
             &mSessionContext->captureCallbacks[CaptureEvent::HDR_CAPTURE]->callbacks,
-            captureRequests.size(),
-            captureRequests.data(),
+            mHdrBurstRequests.size(),
+            mHdrBurstRequests.data(),
             &mSessionContext->captureCallbacks[CaptureEvent::HDR_CAPTURE]->sequenceId);
     }
 
@@ -1018,6 +1152,37 @@ namespace motioncam {
     }
 
     void CameraSession::doActivateCameraSettings() {
+        const auto now = std::chrono::steady_clock::now();
+        const double elapsedMs =
+            std::chrono::duration <double, std::milli>(now - mLastActivationTime).count();
+
+        // Too soon since the last resubmit; the request mutations have
+        // already been recorded by the state manager, so defer the rebuild
+        // and let one activation cover all of them.
+        if(elapsedMs < ACTIVATE_COALESCE_TIME_MS) {
+            mHaveDeferredActivation = true;
+            return;
+        }
+
+        mLastActivationTime = now;
+        mHaveDeferredActivation = false;
+
+        mCameraStateManager->activate();
+    }
+
+    void CameraSession::flushDeferredActivation() {
+        if(!mHaveDeferredActivation || !mCameraStateManager)
+            return;
+
+        const double elapsedMs =
+            std::chrono::duration <double, std::milli>(std::chrono::steady_clock::now() - mLastActivationTime).count();
+
+        if(elapsedMs < ACTIVATE_COALESCE_TIME_MS)
+            return;
+
+        mLastActivationTime = std::chrono::steady_clock::now();
+        mHaveDeferredActivation = false;
+
         mCameraStateManager->activate();
     }
 
@@ -1093,12 +1258,7 @@ namespace motioncam {
         mLastFocusDistance = focusDistance;
 
         if (iso != mLastIso || exposure != mLastExposureTime) {
-            json11::Json::object data = {
-                    {"iso",          iso},
-                    {"exposureTime", std::to_string(exposure)}
-            };
-
-            pushEvent(EventAction::EVENT_CAMERA_EXPOSURE_STATUS_CHANGED, data);
+            pushEvent(EventAction::EVENT_CAMERA_EXPOSURE_STATUS_CHANGED, iso, exposure, 0);
 
             mLastIso = iso;
             mLastExposureTime = exposure;
@@ -1110,11 +1270,7 @@ namespace motioncam {
 
             auto focusState = GetFocusState(afState);
             if(focusState != mLastFocusState) {
-                json11::Json::object data = {
-                        { "state", static_cast<int>(focusState) }
-                };
-
-                pushEvent(EventAction::EVENT_CAMERA_AUTO_FOCUS_STATE_CHANGED, data);
+                pushEvent(EventAction::EVENT_CAMERA_AUTO_FOCUS_STATE_CHANGED, 0, 0, static_cast<int>(focusState));
             }
 
             mLastFocusState = focusState;
@@ -1126,11 +1282,7 @@ namespace motioncam {
             auto exposureState = GetExposureState(aeState);
 
             if(exposureState != mLastExposureState) {
-                json11::Json::object data = {
-                        { "state", static_cast<int>(exposureState) }
-                };
-
-                pushEvent(EventAction::EVENT_CAMERA_AUTO_EXPOSURE_STATE_CHANGED, data);
+                pushEvent(EventAction::EVENT_CAMERA_AUTO_EXPOSURE_STATE_CHANGED, 0, 0, static_cast<int>(exposureState));
             }
 
             mLastExposureState = exposureState;
@@ -1153,11 +1305,7 @@ namespace motioncam {
             mHdrCaptureSequenceCompleted = true;
         }
         else {
-            json11::Json::object data = {
-                { "sequenceId", sequenceId }
-            };
-
-            pushEvent(EventAction::EVENT_CAMERA_SEQUENCE_COMPLETED, data);
+            pushEvent(EventAction::EVENT_CAMERA_SEQUENCE_COMPLETED, 0, 0, sequenceId);
         }
     }
 
@@ -1171,11 +1319,8 @@ namespace motioncam {
 
     void CameraSession::onCameraError(int error) {
         LOGE("Camera has failed with error %d", error);
-        json11::Json::object data = {
-            { "error", error }
-        };
 
-        pushEvent(EventAction::EVENT_CAMERA_ERROR, data);
+        pushEvent(EventAction::EVENT_CAMERA_ERROR, 0, 0, error);
     }
 
     void CameraSession::onCameraDisconnected() {
@@ -1183,27 +1328,15 @@ namespace motioncam {
     }
 
     void CameraSession::onCameraSessionStateActive() {
-        json11::Json::object data = {
-            { "state", static_cast<int>(CameraCaptureSessionState::ACTIVE) }
-        };
-
-        pushEvent(EventAction::EVENT_CAMERA_SESSION_CHANGED, data);
+        pushEvent(EventAction::EVENT_CAMERA_SESSION_CHANGED, 0, 0, static_cast<int>(CameraCaptureSessionState::ACTIVE));
     }
 
     void CameraSession::onCameraSessionStateReady() {
-        json11::Json::object data = {
-            { "state", static_cast<int>(CameraCaptureSessionState::READY) }
-        };
-
-        pushEvent(EventAction::EVENT_CAMERA_SESSION_CHANGED, data);
+        pushEvent(EventAction::EVENT_CAMERA_SESSION_CHANGED, 0, 0, static_cast<int>(CameraCaptureSessionState::READY));
     }
 
     void CameraSession::onCameraSessionStateClosed() {
-        json11::Json::object data = {
-            { "state", static_cast<int>(CameraCaptureSessionState::CLOSED) }
-        };
-
-        pushEvent(EventAction::EVENT_CAMERA_SESSION_CHANGED, data);
+        pushEvent(EventAction::EVENT_CAMERA_SESSION_CHANGED, 0, 0, static_cast<int>(CameraCaptureSessionState::CLOSED));
     }
 
     //
@@ -1211,15 +1344,43 @@ namespace motioncam {
     void CameraSession::onRawImageAvailable(AImageReader *imageReader) {
         AImage *image = nullptr;
 
+        // Drain everything the reader holds and hand it over as one batch.
+        // The reader only has MAX_BUFFERED_RAW_IMAGES slots; images left in
+        // it after a delayed wakeup are what stall the HAL.
+        mDrainedImages.clear();
+
         while (AImageReader_acquireNextImage(imageReader, &image) == AMEDIA_OK) {
-            mImageConsumer->queueImage(image);
+            mDrainedImages.emplace_back(image, AImage_delete);
+        }
+
+        // More than one image per wakeup means the callback fell behind;
+        // track the high water mark as a proxy for reader occupancy
+        if(mDrainedImages.size() > mMaxDrainedImages) {
+            mMaxDrainedImages = mDrainedImages.size();
+
+            LOGW("Image reader backed up, drained %d images (%d slots)",
+                 (int) mMaxDrainedImages, MAX_BUFFERED_RAW_IMAGES);
         }
 
+        mImageConsumer->queueImages(mDrainedImages);
+
         if(mLongHdrCaptureInProgress) {
             pushEvent(EventAction::EVENT_SAVE_HDR_DATA);
         }
     }
 
+    void CameraSession::onPreviewRawImageAvailable(AImageReader *imageReader) {
+        AImage *image = nullptr;
+
+        // Only the newest frame matters for preview. Acquiring the latest
+        // image also frees up the older reader slots in one call.
+        if (AImageReader_acquireLatestImage(imageReader, &image) != AMEDIA_OK) {
+            return;
+        }
+
+        mImageConsumer->queuePreviewImage(image);
+    }
+
     //
 
     void CameraSession::doOnCameraError(int error) {
@@ -1268,9 +1429,7 @@ namespace motioncam {
             return;
         }
 
-        auto eventLoopData = std::make_shared<EventLoopData>(eventAction, data);
-
-        mEventLoopQueue.enqueue(eventLoopData);
+        mEventLoopQueue.enqueue(EventLoopData(eventAction, data));
     }
 
     void CameraSession::pushEvent(const EventAction eventAction) {
@@ -1279,21 +1438,27 @@ namespace motioncam {
             return;
         }
 
-        json11::Json data;
-        auto eventLoopData = std::make_shared<EventLoopData>(eventAction, data);
+        mEventLoopQueue.enqueue(EventLoopData(eventAction, json11::Json()));
+    }
+
+    void CameraSession::pushEvent(const EventAction eventAction, const int iso, const int64_t exposureTime, const int value) {
+        if(!mSessionContext) {
+            LOGW("Failed to queue event, event loop is gone (%d)", eventAction);
+            return;
+        }
 
-        mEventLoopQueue.enqueue(eventLoopData);
+        mEventLoopQueue.enqueue(EventLoopData(eventAction, iso, exposureTime, value));
     }
 
-    void CameraSession::doProcessEvent(const EventLoopDataPtr& eventLoopData) {
-        switch(eventLoopData->eventAction) {
+    void CameraSession::doProcessEvent(const EventLoopData& eventLoopData) {
+        switch(eventLoopData.eventAction) {
             //
             // Actions
             //
 
             case EventAction::ACTION_OPEN_CAMERA: {
-                auto setupForRawPreview = eventLoopData->data["setupForRawPreview"].bool_value();
-                auto startupSettings = eventLoopData->data["cameraStartupSettings"];
+                auto setupForRawPreview = eventLoopData.data["setupForRawPreview"].bool_value();
+                auto startupSettings = eventLoopData.data["cameraStartupSettings"];
 
                 doOpenCamera(setupForRawPreview, startupSettings);
                 break;
@@ -1315,10 +1480,10 @@ namespace motioncam {
             }
 
             case EventAction::ACTION_UPDATE_PREVIEW: {
-                float shadows = static_cast<float>(eventLoopData->data["shadows"].number_value());
-                float contrast = static_cast<float>(eventLoopData->data["contrast"].number_value());
-                float blackPoint = static_cast<float>(eventLoopData->data["blackPoint"].number_value());
-                float whitePoint = static_cast<float>(eventLoopData->data["whitePoint"].number_value());
+                float shadows = static_cast<float>(eventLoopData.data["shadows"].number_value());
+                float contrast = static_cast<float>(eventLoopData.data["contrast"].number_value());
+                float blackPoint = static_cast<float>(eventLoopData.data["blackPoint"].number_value());
+                float whitePoint = static_cast<float>(eventLoopData.data["whitePoint"].number_value());
 
                 doUpdatePreview(shadows, contrast, blackPoint, whitePoint);
                 break;
@@ -1330,55 +1495,55 @@ namespace motioncam {
             }
 
             case EventAction::ACTION_SET_EXPOSURE_COMP_VALUE: {
-                float expComp = static_cast<float>(eventLoopData->data["value"].number_value());
+                float expComp = static_cast<float>(eventLoopData.data["value"].number_value());
                 doSetExposureCompensation(expComp);
                 break;
             }
 
             case EventAction::ACTION_SET_FRAME_RATE: {
-                int frameRate = eventLoopData->data["value"].int_value();
+                int frameRate = eventLoopData.data["value"].int_value();
                 doSetFrameRate(frameRate);
                 break;
             }
 
             case EventAction::ACTION_SET_AWB_LOCK: {
-                bool value = eventLoopData->data["value"].bool_value();
+                bool value = eventLoopData.data["value"].bool_value();
                 doSetAWBLock(value);
                 break;
             }
 
             case EventAction::ACTION_SET_AE_LOCK: {
-                bool value = eventLoopData->data["value"].bool_value();
+                bool value = eventLoopData.data["value"].bool_value();
                 doSetAELock(value);
                 break;
             }
 
             case EventAction::ACTION_SET_OIS: {
-                bool value = eventLoopData->data["value"].bool_value();
+                bool value = eventLoopData.data["value"].bool_value();
                 doSetOIS(value);
                 break;
             }
 
             case EventAction::ACTION_SET_FOCUS_DISTANCE: {
-                float value = eventLoopData->data["value"].number_value();
+                float value = eventLoopData.data["value"].number_value();
                 doSetFocusDistance(value);
                 break;
             }
 
             case EventAction::ACTION_SET_FOCUS_FOR_VIDEO: {
-                bool value = eventLoopData->data["value"].bool_value();
+                bool value = eventLoopData.data["value"].bool_value();
                 doSetFocusForVideo(value);
                 break;
             }
 
             case EventAction::ACTION_SET_LENS_APERTURE: {
-                float value = eventLoopData->data["value"].number_value();
+                float value = eventLoopData.data["value"].number_value();
                 doSetLensAperture(value);
                 break;
             }
 
             case EventAction::ACTION_SET_TORCH: {
-                bool value = eventLoopData->data["value"].bool_value();
+                bool value = eventLoopData.data["value"].bool_value();
                 doEnableTorch(value);
                 break;
             }
@@ -1389,10 +1554,10 @@ namespace motioncam {
             }
 
             case EventAction::ACTION_SET_MANUAL_EXPOSURE: {
-                auto exposureTimeStr = eventLoopData->data["exposureTime"].string_value();
+                auto exposureTimeStr = eventLoopData.data["exposureTime"].string_value();
                 auto exposureTime = std::stol(exposureTimeStr);
 
-                doSetManualExposure(eventLoopData->data["iso"].int_value(), exposureTime);
+                doSetManualExposure(eventLoopData.data["iso"].int_value(), exposureTime);
                 break;
             }
 
@@ -1402,19 +1567,19 @@ namespace motioncam {
             }
 
             case EventAction::ACTION_CAPTURE_HDR: {
-                int numImages = eventLoopData->data["numImages"].int_value();
-                int baseIso = eventLoopData->data["baseIso"].int_value();
-                int64_t baseExposure = std::stol(eventLoopData->data["baseExposure"].string_value());
-                int hdrIso = eventLoopData->data["hdrIso"].int_value();
-                int64_t hdrExposure = std::stol(eventLoopData->data["hdrExposure"].string_value());
+                int numImages = eventLoopData.data["numImages"].int_value();
+                int baseIso = eventLoopData.data["baseIso"].int_value();
+                int64_t baseExposure = std::stol(eventLoopData.data["baseExposure"].string_value());
+                int hdrIso = eventLoopData.data["hdrIso"].int_value();
+                int64_t hdrExposure = std::stol(eventLoopData.data["hdrExposure"].string_value());
 
                 doCaptureHdr(numImages, baseIso, baseExposure, hdrIso, hdrExposure);
                 break;
             }
 
             case EventAction::ACTION_PRECAPTURE_HDR: {
-                int iso = eventLoopData->data["iso"].int_value();
-                int64_t exposure = std::stol(eventLoopData->data["exposure"].string_value());
+                int iso = eventLoopData.data["iso"].int_value();
+                int64_t exposure = std::stol(eventLoopData.data["exposure"].string_value());
 
                 doPrecaptureCaptureHdr(iso, exposure);
                 break;
@@ -1422,10 +1587,10 @@ namespace motioncam {
 
             case EventAction::ACTION_SET_FOCUS_POINT: {
                 doSetFocusPoint(
-                        eventLoopData->data["focusX"].number_value(),
-                        eventLoopData->data["focusY"].number_value(),
-                        eventLoopData->data["exposureX"].number_value(),
-                        eventLoopData->data["exposureY"].number_value());
+                        eventLoopData.data["focusX"].number_value(),
+                        eventLoopData.data["focusY"].number_value(),
+                        eventLoopData.data["exposureX"].number_value(),
+                        eventLoopData.data["exposureY"].number_value());
                 break;
             }
 
@@ -1434,7 +1599,7 @@ namespace motioncam {
             //
 
             case EventAction::EVENT_SAVE: {
-                int numImages = eventLoopData->data["numImages"].int_value();
+                int numImages = eventLoopData.data["numImages"].int_value();
 
                 doSave(numImages);
                 break;
@@ -1446,7 +1611,7 @@ namespace motioncam {
             }
 
             case EventAction::EVENT_CAMERA_ERROR: {
-                doOnCameraError(eventLoopData->data["error"].int_value());
+                doOnCameraError(eventLoopData.value);
                 break;
             }
 
@@ -1456,31 +1621,27 @@ namespace motioncam {
             }
 
             case EventAction::EVENT_CAMERA_SESSION_CHANGED: {
-                doOnCameraSessionStateChanged(static_cast<CameraCaptureSessionState>(eventLoopData->data["state"].int_value()));
+                doOnCameraSessionStateChanged(static_cast<CameraCaptureSessionState>(eventLoopData.value));
                 break;
             }
 
             case EventAction::EVENT_CAMERA_EXPOSURE_STATUS_CHANGED: {
-                auto iso = eventLoopData->data["iso"].int_value();
-                auto exposureTimeStr = eventLoopData->data["exposureTime"].string_value();
-                auto exposureTime = std::stol(exposureTimeStr);
-
-                doOnCameraExposureStatusChanged(iso, exposureTime);
+                doOnCameraExposureStatusChanged(eventLoopData.iso, eventLoopData.exposureTime);
                 break;
             }
 
             case EventAction::EVENT_CAMERA_AUTO_EXPOSURE_STATE_CHANGED: {
-                doCameraAutoExposureStateChanged(static_cast<CameraExposureState>(eventLoopData->data["state"].int_value()));
+                doCameraAutoExposureStateChanged(static_cast<CameraExposureState>(eventLoopData.value));
                 break;
             }
 
             case EventAction::EVENT_CAMERA_AUTO_FOCUS_STATE_CHANGED: {
-                doCameraAutoFocusStateChanged(static_cast<CameraFocusState>(eventLoopData->data["state"].int_value()));
+                doCameraAutoFocusStateChanged(static_cast<CameraFocusState>(eventLoopData.value));
                 break;
             }
 
             case EventAction::EVENT_CAMERA_SEQUENCE_COMPLETED: {
-                mCameraStateManager->onCameraCaptureSequenceCompleted(eventLoopData->data["sequenceId"].int_value());
+                mCameraStateManager->onCameraCaptureSequenceCompleted(eventLoopData.value);
                 break;
             }
 
@@ -1495,20 +1656,28 @@ namespace motioncam {
         bool recvdStop = false;
 
         while(eventLoopRunning) {
-            EventLoopDataPtr eventLoopData;
+            EventLoopData eventLoopData;
+
+            // Wake up sooner when an activation is waiting to be flushed
+            const auto timeout = mHaveDeferredActivation
+                ? std::chrono::milliseconds(ACTIVATE_COALESCE_TIME_MS)
+                : std::chrono::milliseconds(100);
 
             // Try to get event
-            if(!mEventLoopQueue.wait_dequeue_timed(eventLoopData, std::chrono::milliseconds(100))) {
+            if(!mEventLoopQueue.wait_dequeue_timed(eventLoopData, timeout)) {
+                flushDeferredActivation();
                 continue;
             }
 
-            if(eventLoopData->eventAction == EventAction::STOP) {
+            if(eventLoopData.eventAction == EventAction::STOP) {
                 eventLoopRunning = false;
             }
             else {
                 try {
                     if(mAcceptEvents)
                         doProcessEvent(eventLoopData);
+
+                    flushDeferredActivation();
                 }
                 catch (std::exception &e) {
                     doOnInternalError(e.what());
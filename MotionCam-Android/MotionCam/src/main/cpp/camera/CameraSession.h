@@ -7,6 +7,8 @@
 #include <motioncam/RawImageMetadata.h>
 #include <motioncam/Settings.h>
 
+#include <json11/json11.hpp>
+
 #include <vector>
 #include <string>
 #include <map>
@@ -24,12 +26,87 @@ namespace motioncam {
     struct RawImageBuffer;
     struct CameraCaptureSessionContext;
     struct CaptureCallbackContext;
-    struct EventLoopData;
     class CameraStateManager;
     class RawPreviewListener;
-    enum class EventAction : int;
 
-    typedef std::shared_ptr<EventLoopData> EventLoopDataPtr;
+    enum class EventAction : int {
+        ACTION_OPEN_CAMERA = 0,
+        ACTION_CLOSE_CAMERA,
+        ACTION_PAUSE_CAPTURE,
+        ACTION_RESUME_CAPTURE,
+
+        ACTION_SET_AUTO_EXPOSURE,
+        ACTION_SET_MANUAL_EXPOSURE,
+        ACTION_SET_EXPOSURE_COMP_VALUE,
+        ACTION_SET_FRAME_RATE,
+        ACTION_SET_AWB_LOCK,
+        ACTION_SET_AE_LOCK,
+        ACTION_SET_OIS,
+        ACTION_SET_LENS_APERTURE,
+        ACTION_SET_TORCH,
+        ACTION_SET_FOCUS_DISTANCE,
+        ACTION_SET_FOCUS_FOR_VIDEO,
+        ACTION_SET_AUTO_FOCUS,
+        ACTION_SET_FOCUS_POINT,
+        ACTION_UPDATE_PREVIEW,
+        ACTION_ACTIVATE_CAMERA_SETTINGS,
+        ACTION_PRECAPTURE_HDR,
+        ACTION_CAPTURE_HDR,
+
+        EVENT_SAVE,
+        EVENT_SAVE_HDR_DATA,
+
+        EVENT_CAMERA_ERROR,
+        EVENT_CAMERA_DISCONNECTED,
+        EVENT_CAMERA_SESSION_CHANGED,
+        EVENT_CAMERA_SEQUENCE_COMPLETED,
+
+        EVENT_CAMERA_EXPOSURE_STATUS_CHANGED,
+        EVENT_CAMERA_AUTO_EXPOSURE_STATE_CHANGED,
+        EVENT_CAMERA_AUTO_FOCUS_STATE_CHANGED,
+
+        STOP
+    };
+
+    // Events are queued by value so posting one never allocates. Status
+    // events from the HAL callback threads carry their payload in the inline
+    // fields; the json payload is reserved for control actions coming from
+    // the UI thread, which build their objects off the hot path.
+    struct EventLoopData {
+        EventLoopData() :
+                eventAction(EventAction::STOP),
+                iso(0),
+                exposureTime(0),
+                value(0)
+        {
+        }
+
+        EventLoopData(EventAction eventAction, json11::Json data) :
+                eventAction(eventAction),
+                data(std::move(data)),
+                iso(0),
+                exposureTime(0),
+                value(0)
+        {
+        }
+
+        EventLoopData(EventAction eventAction, int iso, int64_t exposureTime, int value) :
+                eventAction(eventAction),
+                iso(iso),
+                exposureTime(exposureTime),
+                value(value)
+        {
+        }
+
+        EventAction eventAction;
+        json11::Json data;
+
+        // Inline payload. 'value' holds the single integer of the state
+        // change events (session state, sequence id, error code).
+        int iso;
+        int64_t exposureTime;
+        int value;
+    };
 
     class CameraSession {
     public:
@@ -43,6 +120,8 @@ namespace motioncam {
                 std::shared_ptr<CameraDescription> cameraDescription,
                 const OutputConfiguration& rawOutputConfig,
                 const OutputConfiguration& previewOutputConfig,
+                const OutputConfiguration& previewRawOutputConfig,
+                bool hasPreviewRawStream,
                 std::shared_ptr<ACameraManager> cameraManager,
                 std::shared_ptr<ANativeWindow> previewOutputWindow,
                 bool setupForRawPreview,
@@ -110,13 +189,18 @@ namespace motioncam {
         void onCameraCaptureSequenceAborted(const CaptureCallbackContext& context, int sequenceId);
 
         void onRawImageAvailable(AImageReader* imageReader);
+        void onPreviewRawImageAvailable(AImageReader* imageReader);
 
     private:
         void pushEvent(const EventAction event, const json11::Json& data);
         void pushEvent(const EventAction event);
 
+        // Allocation-free variant for events posted from the HAL callback
+        // threads
+        void pushEvent(const EventAction event, const int iso, const int64_t exposureTime, const int value);
+
         void doEventLoop();
-        void doProcessEvent(const EventLoopDataPtr& eventLoopData);
+        void doProcessEvent(const EventLoopData& eventLoopData);
 
         void doOpenCamera(bool setupForRawPreview, const json11::Json& startupSettings);
         void doCloseCamera();
@@ -147,10 +231,12 @@ namespace motioncam {
         void doSetLensAperture(float lensAperture);
         void doEnableTorch(bool enable);
         void doActivateCameraSettings();
+        void flushDeferredActivation();
         void doSetAWBLock(bool lock);
         void doSave(int numImages);
         void doAttemptSaveHdrData();
         void doPrecaptureCaptureHdr(int iso, int64_t exposure);
+        void buildHdrBurstRequests(int numImages, int baseIso, int64_t baseExposure, int hdrIso, int64_t hdrExposure);
         void doCaptureHdr(int numImages, int baseIso, int64_t baseExposure, int hdrIso, int64_t hdrExposure);
 
         void setupCallbacks();
@@ -159,6 +245,7 @@ namespace motioncam {
         ACaptureRequest* createCaptureRequest(const ACameraDevice_request_template requestTemplate);
 
         void setupRawCaptureOutput(CameraCaptureSessionContext& state);
+        void setupPreviewRawCaptureOutput(CameraCaptureSessionContext& state);
         void setupPreviewCaptureOutput(CameraCaptureSessionContext& state, bool enableCameraPreview);
 
     private:
@@ -173,13 +260,32 @@ namespace motioncam {
         std::atomic<bool> mLongHdrCaptureInProgress;
         std::atomic<bool> mHdrCaptureSequenceCompleted;
         std::chrono::steady_clock::time_point mHdrSequenceCompletedTimePoint;
+
+        // Coalescing state for capture request activations; only touched
+        // from the event loop thread
+        std::chrono::steady_clock::time_point mLastActivationTime;
+        bool mHaveDeferredActivation;
+
         PostProcessSettings mHdrCaptureSettings;
         std::string mHdrCaptureOutputPath;
         int mRequestedHdrCaptures;
         int64_t mRequestHdrCaptureTimestamp;
 
+        // Reused drain batch for the image reader callback plus the reader
+        // occupancy high water mark
+        std::vector<std::shared_ptr<AImage>> mDrainedImages;
+        size_t mMaxDrainedImages;
+
+        // Precompiled HDR bracket burst
+        std::vector<ACaptureRequest*> mHdrBurstRequests;
+        int mHdrBurstNumImages;
+        int mHdrBurstBaseIso;
+        int64_t mHdrBurstBaseExposure;
+        int mHdrBurstHdrIso;
+        int64_t mHdrBurstHdrExposure;
+
         bool mAcceptEvents;
-        moodycamel::BlockingConcurrentQueue<EventLoopDataPtr> mEventLoopQueue;
+        moodycamel::BlockingConcurrentQueue<EventLoopData> mEventLoopQueue;
         std::unique_ptr<std::thread> mEventLoopThread;
 
         std::shared_ptr<CameraDescription> mCameraDescription;
@@ -189,6 +295,7 @@ namespace motioncam {
         std::unique_ptr<CameraStateManager> mCameraStateManager;
 
         std::vector<float> mTonemapCurvePts;
+        size_t mTonemapCurveHash;
     };
 }
 
@@ -36,9 +36,14 @@ namespace motioncam {
     };
 
     struct CameraCaptureSessionContext {
+        CameraCaptureSessionContext() : hasPreviewRawStream(false) {
+        }
+
         // Setup
         OutputConfiguration outputConfig;
         OutputConfiguration previewOutputConfig;
+        OutputConfiguration previewRawOutputConfig;
+        bool hasPreviewRawStream;
         std::shared_ptr<ANativeWindow> nativeWindow;
 
         // Callbacks
@@ -61,10 +66,15 @@ namespace motioncam {
         std::shared_ptr<ACaptureSessionOutput> rawSessionOutput;
         std::shared_ptr<ACameraOutputTarget> rawOutputTarget;
 
-        // Image reader
+        std::shared_ptr<ACaptureSessionOutput> previewRawSessionOutput;
+        std::shared_ptr<ACameraOutputTarget> previewRawOutputTarget;
+
+        // Image readers
         std::shared_ptr<AImageReader> rawImageReader;
+        std::shared_ptr<AImageReader> previewRawImageReader;
 
         AImageReader_ImageListener rawImageListener;
+        AImageReader_ImageListener previewRawImageListener;
     };
 }
 
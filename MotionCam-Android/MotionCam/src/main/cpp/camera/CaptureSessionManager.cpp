@@ -1,6 +1,9 @@
 #include <camera/NdkCameraMetadata.h>
 #include <opencv2/opencv.hpp>
 #include <utility>
+#include <fstream>
+
+#include <sys/system_properties.h>
 
 #include <motioncam/Color.h>
 #include <motioncam/Logger.h>
@@ -18,6 +21,11 @@
 namespace motioncam {
     const int MAX_PREVIEW_PIXELS = 1920*1080;
 
+    // Serialized camera enumeration, reused across sessions to skip the
+    // full characteristics parse on cold start
+    const int CAMERA_CACHE_VERSION = 1;
+    const char* CAMERA_CACHE_FILENAME = "camera_cache.json";
+
     namespace {
         color::Illuminant getIlluminant(acamera_metadata_enum_android_sensor_reference_illuminant1_t illuminant) {
             switch(illuminant) {
@@ -85,13 +93,158 @@ namespace motioncam {
                     return ColorFilterArrangment::RGGB;
             }
         }
+
+        std::string getBuildFingerprint() {
+            char value[PROP_VALUE_MAX] = { 0 };
+
+            if(__system_property_get("ro.build.fingerprint", value) > 0)
+                return value;
+
+            return "";
+        }
+
+        json11::Json::object toJson(CameraDescription& desc) {
+            json11::Json::array supportedCaps;
+            for(auto cap : desc.supportedCaps)
+                supportedCaps.push_back(static_cast<int>(cap));
+
+            json11::Json::array oisModes;
+            for(auto mode : desc.oisModes)
+                oisModes.push_back(static_cast<int>(mode));
+
+            json11::Json::array tonemapModes;
+            for(auto mode : desc.tonemapModes)
+                tonemapModes.push_back(static_cast<int>(mode));
+
+            json11::Json::array outputConfigs;
+            for(const auto& formatConfigs : desc.outputConfigs) {
+                for(const auto& config : formatConfigs.second) {
+                    outputConfigs.push_back(json11::Json::object {
+                        { "format", static_cast<int>(config.format) },
+                        { "width",  config.outputSize.originalWidth() },
+                        { "height", config.outputSize.originalHeight() }
+                    });
+                }
+            }
+
+            json11::Json::array fpsRanges;
+            for(const auto& range : desc.availableFpsRange)
+                fpsRanges.push_back(json11::Json::array { range.first, range.second });
+
+            json11::Json::object metadata;
+            desc.metadata.toJson(metadata);
+
+            return json11::Json::object {
+                { "id",                 desc.id },
+                { "supportedCaps",      supportedCaps },
+                { "hardwareLevel",      static_cast<int>(desc.hardwareLevel) },
+                { "lensFacing",         static_cast<int>(desc.lensFacing) },
+                { "outputConfigs",      outputConfigs },
+                { "oisModes",           oisModes },
+                { "tonemapModes",       tonemapModes },
+                { "metadata",           metadata },
+                { "exposureCompensationStepFraction",
+                    json11::Json::array { desc.exposureCompensationStepFraction[0], desc.exposureCompensationStepFraction[1] } },
+                { "exposureCompensationRange",
+                    json11::Json::array { desc.exposureCompensationRange[0], desc.exposureCompensationRange[1] } },
+                { "isoRange",           json11::Json::array { desc.isoRange[0], desc.isoRange[1] } },
+                { "exposureRange",
+                    json11::Json::array { static_cast<double>(desc.exposureRange[0]), static_cast<double>(desc.exposureRange[1]) } },
+                { "minimumFocusDistance", desc.minimumFocusDistance },
+                { "hyperFocalDistance",   desc.hyperFocalDistance },
+                { "focalLength",          desc.focalLength },
+                { "availableFpsRange",    fpsRanges },
+                { "sensorSize",
+                    json11::Json::array { desc.sensorSize.left, desc.sensorSize.top, desc.sensorSize.width, desc.sensorSize.height } },
+                { "maxAfRegions",         desc.maxAfRegions },
+                { "maxAeRegions",         desc.maxAeRegions },
+                { "maxAwbRegions",        desc.maxAwbRegions },
+                { "sensorOrientation",    desc.sensorOrientation },
+                { "maxTonemapCurvePts",   static_cast<int>(desc.maxTonemapCurvePts) }
+            };
+        }
+
+        std::shared_ptr<CameraDescription> parseCameraDescription(const json11::Json& json) {
+            auto desc = std::make_shared<CameraDescription>();
+
+            desc->id = json["id"].string_value();
+
+            for(const auto& cap : json["supportedCaps"].array_items())
+                desc->supportedCaps.push_back(
+                    static_cast<acamera_metadata_enum_android_request_available_capabilities_t>(cap.int_value()));
+
+            desc->hardwareLevel =
+                static_cast<acamera_metadata_enum_android_info_supported_hardware_level_t>(json["hardwareLevel"].int_value());
+
+            desc->lensFacing =
+                static_cast<acamera_metadata_enum_android_lens_facing_t>(json["lensFacing"].int_value());
+
+            for(const auto& config : json["outputConfigs"].array_items()) {
+                const int32_t format = config["format"].int_value();
+
+                desc->outputConfigs[format].push_back(
+                    { format, DisplayDimension(config["width"].int_value(), config["height"].int_value()) });
+            }
+
+            for(const auto& mode : json["oisModes"].array_items())
+                desc->oisModes.push_back(
+                    static_cast<acamera_metadata_enum_android_lens_optical_stabilization_mode_t>(mode.int_value()));
+
+            for(const auto& mode : json["tonemapModes"].array_items())
+                desc->tonemapModes.push_back(
+                    static_cast<acamera_metadata_enum_android_tonemap_mode_t>(mode.int_value()));
+
+            desc->metadata.parse(json["metadata"]);
+
+            desc->exposureCompensationStepFraction[0] = json["exposureCompensationStepFraction"][0].int_value();
+            desc->exposureCompensationStepFraction[1] = json["exposureCompensationStepFraction"][1].int_value();
+
+            desc->exposureCompensationRange[0] = json["exposureCompensationRange"][0].int_value();
+            desc->exposureCompensationRange[1] = json["exposureCompensationRange"][1].int_value();
+
+            desc->isoRange[0] = json["isoRange"][0].int_value();
+            desc->isoRange[1] = json["isoRange"][1].int_value();
+
+            desc->exposureRange[0] = static_cast<int64_t>(json["exposureRange"][0].number_value());
+            desc->exposureRange[1] = static_cast<int64_t>(json["exposureRange"][1].number_value());
+
+            desc->minimumFocusDistance = json["minimumFocusDistance"].number_value();
+            desc->hyperFocalDistance = json["hyperFocalDistance"].number_value();
+
+            for(const auto& focalLength : json["focalLength"].array_items())
+                desc->focalLength.push_back(focalLength.number_value());
+
+            for(const auto& range : json["availableFpsRange"].array_items())
+                desc->availableFpsRange.push_back(std::make_pair(range[0].int_value(), range[1].int_value()));
+
+            desc->sensorSize = {
+                json["sensorSize"][0].int_value(),
+                json["sensorSize"][1].int_value(),
+                json["sensorSize"][2].int_value(),
+                json["sensorSize"][3].int_value()
+            };
+
+            desc->maxAfRegions = json["maxAfRegions"].int_value();
+            desc->maxAeRegions = json["maxAeRegions"].int_value();
+            desc->maxAwbRegions = json["maxAwbRegions"].int_value();
+
+            desc->sensorOrientation = json["sensorOrientation"].int_value();
+            desc->maxTonemapCurvePts = static_cast<uint32_t>(json["maxTonemapCurvePts"].int_value());
+
+            return desc;
+        }
     }
 
-    CaptureSessionManager::CaptureSessionManager() :
+    CaptureSessionManager::CaptureSessionManager(const std::string& cachePath) :
+        mCachePath(cachePath),
         mCameraManager(std::shared_ptr<ACameraManager>(ACameraManager_create(), ACameraManager_delete))
     {
-        // Get list of cameras on the device
-        enumerateCameras();
+        // Use the cached enumeration when one exists for this build;
+        // otherwise do the full characteristics parse and refresh the cache
+        if(!loadCameraCache()) {
+            enumerateCameras();
+            saveCameraCache();
+        }
 
         // Set up supported cameras
         for (const auto& cameraDescription : mCameras) {
@@ -104,6 +257,82 @@ namespace motioncam {
         LOGI("Found %d supported cameras", (int) mSupportedCameras.size());
     }
 
+    bool CaptureSessionManager::loadCameraCache() {
+        if(mCachePath.empty())
+            return false;
+
+        std::ifstream file(mCachePath + "/" + CAMERA_CACHE_FILENAME);
+        if(!file.is_open())
+            return false;
+
+        std::string contents(
+            (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        std::string err;
+        json11::Json json = json11::Json::parse(contents, err);
+
+        if(!err.empty()) {
+            LOGE("Ignoring camera cache (%s)", err.c_str());
+            return false;
+        }
+
+        // The characteristics can't be hashed without fetching them, which
+        // is the cost the cache avoids. Key it to the build fingerprint
+        // instead, which changes with every vendor/HAL image update.
+        if(json["version"].int_value() != CAMERA_CACHE_VERSION ||
+           json["fingerprint"].string_value() != getBuildFingerprint() ||
+           !json["cameras"].is_array())
+        {
+            return false;
+        }
+
+        std::vector<std::shared_ptr<CameraDescription>> cameras;
+
+        try {
+            for(const auto& cameraJson : json["cameras"].array_items())
+                cameras.push_back(parseCameraDescription(cameraJson));
+        }
+        catch(const std::exception& e) {
+            LOGE("Ignoring camera cache (%s)", e.what());
+            return false;
+        }
+
+        if(cameras.empty())
+            return false;
+
+        mCameras = std::move(cameras);
+
+        LOGI("Loaded %d cameras from cache", (int) mCameras.size());
+
+        return true;
+    }
+
+    void CaptureSessionManager::saveCameraCache() const {
+        if(mCachePath.empty())
+            return;
+
+        json11::Json::array cameras;
+
+        for(const auto& camera : mCameras)
+            cameras.push_back(toJson(*camera));
+
+        json11::Json::object cache = {
+            { "version",     CAMERA_CACHE_VERSION },
+            { "fingerprint", getBuildFingerprint() },
+            { "cameras",     cameras }
+        };
+
+        const std::string path = mCachePath + "/" + CAMERA_CACHE_FILENAME;
+
+        std::ofstream file(path, std::ios::trunc);
+        if(!file.is_open()) {
+            LOGE("Failed to write camera cache to %s", path.c_str());
+            return;
+        }
+
+        file << json11::Json(cache).dump();
+    }
+
     bool CaptureSessionManager::isCameraSupported(const CameraDescription& cameraDescription) {
         bool supportsRaw = false;
 
@@ -493,6 +722,49 @@ namespace motioncam {
         return false;
     }
 
+    bool CaptureSessionManager::getPreviewRawConfiguration(
+            const CameraDescription& cameraDesc,
+            const OutputConfiguration& rawConfiguration,
+            OutputConfiguration& outConfiguration)
+    {
+        auto outputConfigs = cameraDesc.outputConfigs;
+
+        // Look for a smaller resolution of the same RAW format to drive the preview
+        // pipeline, so it doesn't have to consume full resolution frames
+        auto rawIt = outputConfigs.find(rawConfiguration.format);
+
+        if (rawIt == outputConfigs.end())
+            return false;
+
+        auto configurations = (*rawIt).second;
+
+        OutputConfiguration closestConfig = { rawConfiguration.format, DisplayDimension() };
+        bool foundConfig = false;
+
+        const int capturePixels =
+            rawConfiguration.outputSize.width() * rawConfiguration.outputSize.height();
+
+        for (const auto& config : configurations) {
+            const int pixels = config.outputSize.width() * config.outputSize.height();
+
+            if (pixels < capturePixels &&
+                pixels <= MAX_PREVIEW_PIXELS &&
+                config.outputSize.isCloseRatio(rawConfiguration.outputSize))
+            {
+                if (config.outputSize > closestConfig.outputSize) {
+                    closestConfig = config;
+                    foundConfig = true;
+                }
+            }
+        }
+
+        if (foundConfig) {
+            outConfiguration = closestConfig;
+        }
+
+        return foundConfig;
+    }
+
     bool CaptureSessionManager::getPreviewConfiguration(
             const CameraDescription& cameraDesc,
             const DisplayDimension& captureSize,
@@ -6,6 +6,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 namespace motioncam {
     struct CameraDescription;
@@ -19,7 +20,10 @@ namespace motioncam {
 
     class CaptureSessionManager {
     public:
-        CaptureSessionManager();
+        // Camera descriptions are cached in cachePath across sessions so a
+        // cold start can skip the full characteristics parse. Pass an empty
+        // path to disable the cache.
+        CaptureSessionManager(const std::string& cachePath = std::string());
 
         static bool getPreviewConfiguration(
                 const CameraDescription& cameraDesc,
@@ -33,6 +37,11 @@ namespace motioncam {
                 const bool preferRaw16,
                 OutputConfiguration& rawConfiguration);
 
+        static bool getPreviewRawConfiguration(
+                const CameraDescription& cameraDesc,
+                const OutputConfiguration& rawConfiguration,
+                OutputConfiguration& outConfiguration);
+
         std::shared_ptr<CameraDescription> getCameraDescription(const std::string& cameraId) const;
         std::vector<std::string> getSupportedCameras() const;
 
@@ -43,7 +52,11 @@ namespace motioncam {
         void enumerateCameras();
         static void updateCameraMetadata(const std::shared_ptr<ACameraMetadata>& cameraChars, CameraDescription& cameraDescription);
 
+        bool loadCameraCache();
+        void saveCameraCache() const;
+
     private:
+        const std::string mCachePath;
         std::shared_ptr<ACameraManager> mCameraManager;
         std::vector<std::shared_ptr<CameraDescription>> mCameras;
         std::map<std::string, std::shared_ptr<CameraDescription>> mSupportedCameras;
@@ -23,6 +23,23 @@ namespace motioncam {
         return ((createBuffer) func)(context, flags, size, hostPtr, errCode);
     }
 
+    cl_mem CL_importMemoryARM(cl_context context, cl_mem_flags flags, void* hostPtr, size_t size, cl_int* errCode) {
+        // From cl_arm_import_memory; the OpenCL 1.2 headers don't carry the
+        // extension definitions
+        typedef intptr_t cl_import_properties_arm;
+        typedef cl_mem (*importMemoryARM)(cl_context, cl_mem_flags, const cl_import_properties_arm*, void*, size_t, cl_int*);
+
+        void* func = halide_opencl_get_symbol(nullptr, "clImportMemoryARM");
+        if(!func) {
+            if(errCode)
+                *errCode = CL_INVALID_OPERATION;
+
+            return nullptr;
+        }
+
+        return ((importMemoryARM) func)(context, flags, nullptr, hostPtr, size, errCode);
+    }
+
     cl_int CL_releaseMemObject(cl_mem mem) {
         typedef cl_int (*releaseMemObject)(cl_mem);
 
@@ -19,6 +19,12 @@ namespace motioncam {
     cl_mem CL_createBuffer(cl_context context, cl_mem_flags flags, size_t size, void* hostPtr, cl_int* errCode);
     cl_int CL_releaseMemObject(cl_mem mem);
 
+    // cl_arm_import_memory. Wraps an existing host allocation as a cl_mem
+    // without copying it; imported memory is coherent so the host can access
+    // it directly with no map/unmap. Returns nullptr and sets errCode when
+    // the driver doesn't expose the extension.
+    cl_mem CL_importMemoryARM(cl_context context, cl_mem_flags flags, void* hostPtr, size_t size, cl_int* errCode);
+
     void* CL_enqueueMapBuffer(
             cl_command_queue command_queue,
             cl_mem buffer,
@@ -4,12 +4,37 @@
 #include <string>
 #include <android/log.h>
 
+// MOTIONCAM_LOG_LEVEL + logger::shouldLog
+#include <motioncam/Logger.h>
+
 namespace motioncam {
 
     #define LOG_TAG "libMotionCam"
 
+// Stripped levels compile away entirely, including their argument
+// expressions - see motioncam/Logger.h
+#if MOTIONCAM_LOG_LEVEL <= 0
     #define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+#else
+    #define LOGD(...) do { } while(false)
+#endif
+
+#if MOTIONCAM_LOG_LEVEL <= 1
     #define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+
+    // For per-frame sites: logs at most once per intervalMs
+    #define LOGI_EVERY_MS(intervalMs, ...)                                          \
+        do {                                                                        \
+            static std::atomic<int64_t> logger_lastLogMs(0);                        \
+            if(::motioncam::logger::shouldLog(logger_lastLogMs, (intervalMs)))      \
+                __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__);        \
+        } while(false)
+#else
+    #define LOGI(...) do { } while(false)
+    #define LOGI_EVERY_MS(intervalMs, ...) do { } while(false)
+#endif
+
+    // Warnings and errors are never stripped
     #define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
     #define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
 
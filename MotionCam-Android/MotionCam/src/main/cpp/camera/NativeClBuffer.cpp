@@ -17,8 +17,21 @@ namespace motioncam {
         if (halide_error != 0) {
         }
 
-        mClBuffer = CL_createBuffer(clContext, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, bufferLength, nullptr, &errCode);
-        if(errCode != 0) {
+        // Prefer importing our own host allocation. The driver aliases the
+        // pages instead of copying them, and imported memory is coherent so
+        // the capture copy writes straight into memory the preview kernels
+        // read.
+        mImportedHostMemory.resize(bufferLength);
+
+        mClBuffer = CL_importMemoryARM(clContext, CL_MEM_READ_WRITE, mImportedHostMemory.data(), bufferLength, &errCode);
+
+        if(!mClBuffer || errCode != 0) {
+            // No import extension on this driver
+            mImportedHostMemory = std::vector<uint8_t>();
+
+            mClBuffer = CL_createBuffer(clContext, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, bufferLength, nullptr, &errCode);
+            if(errCode != 0) {
+            }
         }
 
         CL_release();
@@ -31,6 +44,9 @@ namespace motioncam {
     }
 
     uint8_t* NativeClBuffer::lock(bool write) {
+        if(!mImportedHostMemory.empty())
+            return mImportedHostMemory.data();
+
         cl_int errCode = 0;
         cl_context clContext = nullptr;
         cl_command_queue clQueue = nullptr;
@@ -49,6 +65,9 @@ namespace motioncam {
     }
 
     void NativeClBuffer::unlock() {
+        if(!mImportedHostMemory.empty())
+            return;
+
         if(!mLockedBuffer)
             return;
 
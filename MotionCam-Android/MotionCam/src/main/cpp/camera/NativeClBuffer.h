@@ -40,6 +40,11 @@ namespace motioncam {
         cl_mem mClBuffer;
         void* mLockedBuffer;
         std::vector<uint8_t> mHostBuffer;
+
+        // When the driver supports cl_arm_import_memory the cl_mem aliases
+        // this allocation and lock()/unlock() are pointer accesses instead
+        // of a map/unmap round trip on every frame
+        std::vector<uint8_t> mImportedHostMemory;
     };
 }
 
@@ -0,0 +1,96 @@
+#include "NativeImageBuffer.h"
+
+#include <atomic>
+
+namespace motioncam {
+    static std::atomic<int> gOutstandingImages(0);
+
+    NativeImageBuffer::NativeImageBuffer(std::shared_ptr<AImage> image, uint8_t* data, size_t length) :
+        mImage(std::move(image)),
+        mData(data),
+        mBufferLength(length)
+    {
+        ++gOutstandingImages;
+    }
+
+    NativeImageBuffer::~NativeImageBuffer() {
+        release();
+    }
+
+    void NativeImageBuffer::detach() {
+        if(!mImage)
+            return;
+
+        // Copy the frame out and return the image to its reader. From here
+        // on the buffer behaves like a host buffer.
+        mOwnedBuffer.assign(mData, mData + mBufferLength);
+
+        mData = mOwnedBuffer.data();
+        mImage = nullptr;
+
+        --gOutstandingImages;
+    }
+
+    uint8_t* NativeImageBuffer::lock(bool write) {
+        if(write)
+            detach();
+
+        return mData;
+    }
+
+    void NativeImageBuffer::unlock() {
+    }
+
+    uint64_t NativeImageBuffer::nativeHandle() {
+        return 0;
+    }
+
+    size_t NativeImageBuffer::len() {
+        return mBufferLength;
+    }
+
+    void NativeImageBuffer::allocate(size_t len) {
+    }
+
+    const std::vector<uint8_t>& NativeImageBuffer::hostData() {
+        if(!mImage && mOwnedBuffer.size() == mBufferLength)
+            return mOwnedBuffer;
+
+        mHostBuffer.resize(mBufferLength);
+        mHostBuffer.assign(mData, mData + mBufferLength);
+
+        return mHostBuffer;
+    }
+
+    void NativeImageBuffer::copyHostData(const std::vector<uint8_t>& other) {
+    }
+
+    std::unique_ptr<NativeBuffer> NativeImageBuffer::clone() {
+        return std::make_unique<NativeHostBuffer>(mData, mBufferLength);
+    }
+
+    void NativeImageBuffer::shrink(size_t newSize) {
+        if(newSize > mBufferLength) {
+            throw std::runtime_error("Buffer expansion not supported");
+        }
+
+        mBufferLength = newSize;
+    }
+
+    void NativeImageBuffer::release() {
+        if(mImage) {
+            mImage = nullptr;
+            --gOutstandingImages;
+        }
+
+        mData = nullptr;
+        mBufferLength = 0;
+
+        mOwnedBuffer = std::vector<uint8_t>();
+        mHostBuffer = std::vector<uint8_t>();
+    }
+
+    int NativeImageBuffer::numOutstanding() {
+        return gOutstandingImages;
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef MOTIONCAM_ANDROID_NATIVEIMAGEBUFFER_H
+#define MOTIONCAM_ANDROID_NATIVEIMAGEBUFFER_H
+
+#include <motioncam/NativeBuffer.h>
+
+#include <media/NdkImage.h>
+#include <memory>
+
+namespace motioncam {
+    // Wraps the plane memory of an acquired AImage so a captured frame can
+    // enter the pipeline without being copied out of the HAL buffer first.
+    // The image stays checked out of its AImageReader for as long as the
+    // buffer holds it, so the number of these alive at once has to stay
+    // well under the reader's image quota; numOutstanding() is what the
+    // capture path checks before wrapping another frame.
+    //
+    // The HAL memory is treated as read only. The first lock() for writing
+    // detaches the buffer into an owned host copy and returns the image to
+    // the reader, so the in place stages (the streamer's compression, the
+    // spill ring) behave exactly as they do on pooled buffers.
+    class NativeImageBuffer : public NativeBuffer {
+    public:
+        NativeImageBuffer(std::shared_ptr<AImage> image, uint8_t* data, size_t length);
+        ~NativeImageBuffer();
+
+        uint8_t* lock(bool write);
+        void unlock();
+
+        uint64_t nativeHandle();
+
+        size_t len();
+        void allocate(size_t len);
+
+        const std::vector<uint8_t>& hostData();
+        void copyHostData(const std::vector<uint8_t>& other);
+
+        std::unique_ptr<NativeBuffer> clone();
+
+        void shrink(size_t newSize);
+
+        void release();
+
+        // Number of images currently held out of their readers
+        static int numOutstanding();
+
+    private:
+        void detach();
+
+    private:
+        std::shared_ptr<AImage> mImage;
+        uint8_t* mData;
+        size_t mBufferLength;
+
+        // Filled when a writer detaches the buffer from the image
+        std::vector<uint8_t> mOwnedBuffer;
+
+        std::vector<uint8_t> mHostBuffer;
+    };
+}
+
+#endif //MOTIONCAM_ANDROID_NATIVEIMAGEBUFFER_H
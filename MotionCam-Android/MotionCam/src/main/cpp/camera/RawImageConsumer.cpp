@@ -5,6 +5,7 @@
 #include "Logger.h"
 #include "ClHelper.h"
 #include "NativeClBuffer.h"
+#include "NativeImageBuffer.h"
 #include "Exceptions.h"
 
 #ifdef GPU_CAMERA_PREVIEW
@@ -33,12 +34,42 @@ namespace motioncam {
     static const int MINIMUM_BUFFERS = 16;
     static const int ESTIMATE_SHADOWS_FRAME_INTERVAL = 12;
 
+    // A full settings estimate reruns the measurement pass over the frame, so
+    // between cadence refreshes it is skipped unless the exposure or white
+    // balance reported by the camera's 3A moved by more than these deltas
+    // since the last estimate.
+    static const float ESTIMATE_EV_CHANGE_THRESHOLD = 0.25f;
+    static const float ESTIMATE_WB_CHANGE_THRESHOLD = 0.02f;
+
+    // Target pacing for the RAW preview. Frames arriving faster than this
+    // are returned unrendered, and frames queued behind the newest one are
+    // always skipped, so the preview latency stays flat when the device is
+    // loaded instead of growing with the backlog.
+    static const int PREVIEW_TARGET_FRAME_INTERVAL_MS = 33;
+
+    // Ceiling on captured frames that may wrap their AImage instead of
+    // being copied into a pool buffer. The reader only has
+    // MAX_BUFFERED_RAW_IMAGES slots and the drain path needs headroom, so
+    // no more than half of them may be parked inside the pipeline at once;
+    // frames past the cap fall back to the copy path.
+    static const int MAX_WRAPPED_IMAGES = 4;
+
 #ifdef GPU_CAMERA_PREVIEW
     void VERIFY_RESULT(int32_t errCode, const std::string& errString)
     {
         if(errCode != 0)
             throw RawPreviewException(errString);
     }
+
+    static void WarmUpHalideOpenCL()
+    {
+        // Make sure the OpenCL library is loaded/symbols looked up in Halide
+        Halide::Runtime::Buffer<int32_t> buf(32);
+        buf.device_malloc(halide_opencl_device_interface());
+
+        // Use relaxed math
+        halide_opencl_set_build_options("-cl-fast-relaxed-math -cl-mad-enable");
+    }
 #endif
 
     //
@@ -46,15 +77,21 @@ namespace motioncam {
     RawImageConsumer::RawImageConsumer(
             std::shared_ptr<CameraDescription> cameraDescription,
             std::shared_ptr<CameraSessionListener> listener,
+            const bool usePreviewRawStream,
             const uint64_t maxMemoryUsageBytes) :
             mListener(std::move(listener)),
             mMaximumMemoryUsageBytes(maxMemoryUsageBytes),
             mRunning(false),
             mEnableRawPreview(false),
+            mUsePreviewRawStream(usePreviewRawStream),
             mRawPreviewQuality(4),
             mCopyCaptureColorTransform(true),
             mRequestSetupBuffers(false),
+            mPreallocatedBufferSize(0),
             mFramesSinceEstimatedSettings(0),
+            mEstimateFrameInterval(ESTIMATE_SHADOWS_FRAME_INTERVAL),
+            mLastEstimateEv(-1e5f),
+            mLastEstimateAsShot(0, 0, 0),
             mCameraDesc(std::move(cameraDescription))
     {
     }
@@ -63,6 +100,40 @@ namespace motioncam {
         stop();
     }
 
+    void RawImageConsumer::preallocate(const size_t estimatedBufferSize) {
+        Measure measure("preallocate()");
+
+#ifdef GPU_CAMERA_PREVIEW
+        WarmUpHalideOpenCL();
+#endif
+
+        if(estimatedBufferSize == 0)
+            return;
+
+        const size_t memoryUseBytes = RawBufferManager::get().memoryUseBytes();
+
+        if(memoryUseBytes + estimatedBufferSize >= mMaximumMemoryUsageBytes)
+            return;
+
+#ifdef GPU_CAMERA_PREVIEW
+        while(RawBufferManager::get().memoryUseBytes() + estimatedBufferSize < mMaximumMemoryUsageBytes) {
+            auto buffer = std::make_shared<RawImageBuffer>(std::make_unique<NativeClBuffer>(estimatedBufferSize));
+
+            RawBufferManager::get().addBuffer(buffer);
+        }
+#else
+        // warmUp() touches every page as well, so the first frames don't
+        // stall on the allocator
+        const int numBuffers = (int) ((mMaximumMemoryUsageBytes - memoryUseBytes) / estimatedBufferSize);
+
+        RawBufferManager::get().warmUp(estimatedBufferSize, numBuffers);
+#endif
+
+        mPreallocatedBufferSize = estimatedBufferSize;
+
+        LOGD("Preallocated %zu bytes of camera buffers", RawBufferManager::get().memoryUseBytes());
+    }
+
     void RawImageConsumer::start() {
         LOGD("Starting image consumer");
 
@@ -97,6 +168,11 @@ namespace motioncam {
             mConsumerThread->join();
         mConsumerThread = nullptr;
 
+        {
+            std::lock_guard<std::mutex> lock(mPreviewImageMutex);
+            mLatestPreviewImage = nullptr;
+        }
+
         LOGD("Raw image consumer has stopped");
     }
 
@@ -112,6 +188,25 @@ namespace motioncam {
         mImageQueue.enqueue(std::shared_ptr<AImage>(image, AImage_delete));
     }
 
+    void RawImageConsumer::queueImages(std::vector<std::shared_ptr<AImage>>& images) {
+        if(images.empty())
+            return;
+
+        // One queue operation for the whole drain batch
+        mImageQueue.enqueue_bulk(std::make_move_iterator(images.begin()), images.size());
+
+        images.clear();
+    }
+
+    void RawImageConsumer::queuePreviewImage(AImage* image) {
+        std::shared_ptr<AImage> previewImage(image, AImage_delete);
+
+        // Replacing the slot drops the previous frame, returning its slot to
+        // the preview image reader
+        std::lock_guard<std::mutex> lock(mPreviewImageMutex);
+        mLatestPreviewImage = std::move(previewImage);
+    }
+
     void RawImageConsumer::queueMetadata(const ACameraMetadata* cameraMetadata, ScreenOrientation screenOrientation, RawType rawType) {
         using namespace std::chrono;
 
@@ -283,8 +378,21 @@ namespace motioncam {
     }
 
     void RawImageConsumer::onBufferReady(const std::shared_ptr<RawImageBuffer>& buffer) {
-        // Estimate settings every few frames
-        if(mFramesSinceEstimatedSettings >= ESTIMATE_SHADOWS_FRAME_INTERVAL)
+        // Cheap scene change test against the last full estimate. Exposure
+        // and white balance shifts from the camera's own 3A are a good proxy
+        // for the scene changing without touching the pixels.
+        const auto ev = (float) ImageProcessor::calcEv(mCameraDesc->metadata, buffer->metadata);
+        const cv::Vec3f asShotDelta = buffer->metadata.asShot - mLastEstimateAsShot;
+
+        const bool sceneChanged =
+            std::abs(ev - mLastEstimateEv) >= ESTIMATE_EV_CHANGE_THRESHOLD ||
+            std::abs(asShotDelta[0]) >= ESTIMATE_WB_CHANGE_THRESHOLD ||
+            std::abs(asShotDelta[1]) >= ESTIMATE_WB_CHANGE_THRESHOLD ||
+            std::abs(asShotDelta[2]) >= ESTIMATE_WB_CHANGE_THRESHOLD;
+
+        // Re-estimate on scene changes and on the refresh cadence; in
+        // between, the previous frame's statistics carry over
+        if(sceneChanged || mFramesSinceEstimatedSettings >= mEstimateFrameInterval)
         {
             motioncam::ImageProcessor::estimateSettings(*buffer, mCameraDesc->metadata, mEstimatedSettings);
 
@@ -293,6 +401,8 @@ namespace motioncam {
                 mEstimatedSettings.noiseSigma = 1024 * sqrt(0.18f * buffer->metadata.noiseProfile[0] + buffer->metadata.noiseProfile[1]);
             }
 
+            mLastEstimateEv = ev;
+            mLastEstimateAsShot = buffer->metadata.asShot;
             mFramesSinceEstimatedSettings = 0;
         }
         else {
@@ -302,6 +412,27 @@ namespace motioncam {
         RawBufferManager::get().enqueueReadyBuffer(buffer);
     }
 
+    void RawImageConsumer::setEstimateSettingsInterval(const int frames) {
+        mEstimateFrameInterval = frames < 1 ? 1 : frames;
+    }
+
+    void RawImageConsumer::dispatchMatchedBuffer(const std::shared_ptr<RawImageBuffer>& buffer) {
+        // Return buffer to either preprocess queue or normal queue if raw preview is not enabled.
+        // When a dedicated preview stream is configured the preview is fed from
+        // queuePreviewImage() instead, and every full resolution frame goes
+        // straight to the recording queue.
+        if( mEnableRawPreview &&
+            !mUsePreviewRawStream &&
+            mPreprocessQueue.size_approx() < 2 &&
+            buffer->metadata.rawType == RawType::ZSL)
+        {
+            mPreprocessQueue.enqueue(buffer);
+        }
+        else {
+            onBufferReady(buffer);
+        }
+    }
+
     void RawImageConsumer::doMatchMetadata() {
         using namespace std::chrono;
 
@@ -309,55 +440,71 @@ namespace motioncam {
 
         RawImageMetadata metadata;
 
-        std::vector<RawImageMetadata> unmatched;
-
         while(mPendingMetadata.try_dequeue(metadata)) {
-            auto pendingBufferIt = mPendingBuffers.find(metadata.timestampNs);
-
-            // Found a match, set it to the image and remove from pending list
-            if(pendingBufferIt != mPendingBuffers.end()) {
-                // Update the metadata of the image
-                pendingBufferIt->second->metadata = metadata;
-
-                // Return buffer to either preprocess queue or normal queue if raw preview is not enabled
-                if( mEnableRawPreview &&
-                    mPreprocessQueue.size_approx() < 2 &&
-                    pendingBufferIt->second->metadata.rawType == RawType::ZSL)
-                {
-                    mPreprocessQueue.enqueue(pendingBufferIt->second);
-                }
-                else {
-                    onBufferReady(pendingBufferIt->second);
+            // Probe the pending frames for a matching timestamp
+            bool matched = false;
+
+            for(size_t i = 0; i < mPendingBuffers.size(); i++) {
+                auto& slot = mPendingBuffers[(static_cast<uint64_t>(metadata.timestampNs) + i) % mPendingBuffers.size()];
+
+                if(slot && slot->metadata.timestampNs == metadata.timestampNs) {
+                    // Update the metadata of the image and dispatch it
+                    slot->metadata = std::move(metadata);
+
+                    dispatchMatchedBuffer(slot);
+                    slot = nullptr;
+
+                    matched = true;
+                    break;
                 }
+            }
+
+            if(matched)
+                continue;
 
-                // Erase from pending buffer and metadata
-                mPendingBuffers.erase(pendingBufferIt);
+            if(now - metadata.recvdTimestampMs >= 5000) {
+                LOGD("Discarding %ld metadata, too old.", metadata.recvdTimestampMs);
+                continue;
             }
-            else {
-                // If the metadata has not been matched within a reasonable amount of time we can
-                // return it to the queue
-                if(now - metadata.recvdTimestampMs < 5000) {
-                    unmatched.push_back(std::move(metadata));
-                }
-                else {
-                    LOGD("Discarding %ld metadata, too old.", metadata.recvdTimestampMs);
+
+            // Hold it until its frame arrives, taking the oldest entry's
+            // slot when the table is full
+            HeldMetadata* insertAt = nullptr;
+            HeldMetadata* oldest = nullptr;
+
+            for(size_t i = 0; i < mPendingMetadataSlots.size(); i++) {
+                auto& slot = mPendingMetadataSlots[(static_cast<uint64_t>(metadata.timestampNs) + i) % mPendingMetadataSlots.size()];
+
+                if(!slot.valid) {
+                    insertAt = &slot;
+                    break;
                 }
+
+                if(!oldest || slot.metadata.recvdTimestampMs < oldest->metadata.recvdTimestampMs)
+                    oldest = &slot;
+            }
+
+            if(!insertAt) {
+                LOGD("Discarding %ld metadata, too many pending.", oldest->metadata.recvdTimestampMs);
+                insertAt = oldest;
             }
+
+            insertAt->metadata = std::move(metadata);
+            insertAt->valid = true;
         }
 
-        mPendingMetadata.enqueue_bulk(unmatched.begin(), unmatched.size());
+        // Drop held metadata whose frame never arrived
+        for(auto& slot : mPendingMetadataSlots) {
+            if(slot.valid && now - slot.metadata.recvdTimestampMs >= 5000) {
+                LOGD("Discarding %ld metadata, too old.", slot.metadata.recvdTimestampMs);
+                slot.valid = false;
+            }
+        }
     }
 
     void RawImageConsumer::doSetupBuffers(const size_t bufferSize) {
 #ifdef GPU_CAMERA_PREVIEW
-        {
-            // Make sure the OpenCL library is loaded/symbols looked up in Halide
-            Halide::Runtime::Buffer<int32_t> buf(32);
-            buf.device_malloc(halide_opencl_device_interface());
-
-            // Use relaxed math
-            halide_opencl_set_build_options("-cl-fast-relaxed-math -cl-mad-enable");
-        }
+        WarmUpHalideOpenCL();
 #endif
 
         // Do we need to allocate more buffers?
@@ -386,14 +533,14 @@ namespace motioncam {
 
                 memoryUseBytes = RawBufferManager::get().memoryUseBytes();
 
-                LOGI("Memory use: %zu, max: %zu", memoryUseBytes, mMaximumMemoryUsageBytes);
+                LOGI_EVERY_MS(1000, "Memory use: %zu, max: %zu", memoryUseBytes, mMaximumMemoryUsageBytes);
             }
             else if(grow < 0 && memoryUseBytes > mMaximumMemoryUsageBytes) {
                 // Shrink memory
                 RawBufferManager::get().removeBuffer();
                 memoryUseBytes = RawBufferManager::get().memoryUseBytes();
 
-                logger::log("Shrunk memory to " + std::to_string(memoryUseBytes));
+                LOGI_EVERY_MS(1000, "Shrunk memory to %zu", memoryUseBytes);
             }
             else {
                 break;
@@ -481,108 +628,121 @@ namespace motioncam {
 #endif
 
     void RawImageConsumer::doPreprocess() {
-//#ifdef GPU_CAMERA_PREVIEW
-//        Halide::Runtime::Buffer<uint8_t> outputBuffer;
-//        std::shared_ptr<RawImageBuffer> buffer;
-//
-//        std::chrono::steady_clock::time_point fpsTimestamp = std::chrono::steady_clock::now();
-//        std::chrono::steady_clock::time_point previewTimestamp;
-//
-//        cl_int errCode = -1;
-//
-//        bool outputCreated = false;
-//        int downscaleFactor = mRawPreviewQuality;
-//        int processedFrames = 0;
-//        double totalPreviewTimeMs = 0;
-//
-//        while(mEnableRawPreview) {
-//            if(!mPreprocessQueue.wait_dequeue_timed(buffer, std::chrono::milliseconds(100))) {
-//                continue;
-//            }
-//
-//            if(!outputCreated) {
-//                outputBuffer = createCameraPreviewOutputBuffer(*buffer, downscaleFactor);
-//                outputCreated = true;
-//            }
-//
-//            Halide::Runtime::Buffer<uint8_t> inputBuffer = wrapCameraPreviewInputBuffer(*buffer);
-//
-//            previewTimestamp = std::chrono::steady_clock::now();
-//
-//            if(mUseVideoPreview) {
-//                motioncam::CameraPreview::generate(*buffer, mCameraDesc->metadata, downscaleFactor, mShadingMapCorrection, inputBuffer, outputBuffer);
-//            }
-//            else {
-//                motioncam::CameraPreview::generate(
-//                        *buffer,
-//                        mCameraDesc->metadata,
-//                        downscaleFactor,
-//                        mShadingMapCorrection,
-//                        mCameraDesc->lensFacing == ACAMERA_LENS_FACING_FRONT,
-//                        mPreviewShadows,
-//                        mEstimatedSettings.contrast,
-//                        mEstimatedSettings.saturation,
-//                        mEstimatedSettings.blacks,
-//                        mEstimatedSettings.whitePoint,
-//                        mTempOffset,
-//                        mTintOffset,
-//                        0.25f,
-//                        inputBuffer,
-//                        outputBuffer);
-//            }
-//
-//            totalPreviewTimeMs +=
-//                    std::chrono::duration <double, std::milli>(std::chrono::steady_clock::now() - previewTimestamp).count();
-//
-//            unwrapCameraPreviewInputBuffer(inputBuffer);
-//
-//            cl_context clContext = nullptr;
-//            cl_command_queue clQueue = nullptr;
-//
-//            VERIFY_RESULT(CL_acquire(&clContext, &clQueue), "Failed to acquire CL context");
-//
-//            auto clOutputBuffer = (cl_mem) halide_opencl_get_cl_mem(nullptr, outputBuffer.raw_buffer());
-//            auto data = CL_enqueueMapBuffer(
-//                    clQueue, clOutputBuffer, CL_TRUE, CL_MAP_READ, 0, outputBuffer.size_in_bytes(), 0, nullptr, nullptr, &errCode);
-//
-//            VERIFY_RESULT(errCode, "Failed to map output buffer");
-//
-//            mPreviewListener->onPreviewGenerated(data, outputBuffer.size_in_bytes(), outputBuffer.width(), outputBuffer.height());
-//
-//            errCode = CL_enqueueUnmapMemObject(clQueue, clOutputBuffer, data, 0, nullptr, nullptr);
-//            VERIFY_RESULT(errCode, "Failed to unmap output buffer");
-//
-//            VERIFY_RESULT(CL_release(), "Failed to release CL context");
-//
-//            // Return buffer
-//            onBufferReady(buffer);
-//
-//            processedFrames += 1;
-//
-//            auto now = std::chrono::steady_clock::now();
-//            double durationMs = std::chrono::duration <double, std::milli>(now - fpsTimestamp).count();
-//
-//            // Print camera FPS + stats
-//            if(durationMs > 3000.0f) {
-//                double avgProcessTimeMs = totalPreviewTimeMs / processedFrames;
-//
-//                LOGI("Camera FPS: %d, cameraQuality=%d processTimeMs=%.2f", processedFrames / 3, downscaleFactor, avgProcessTimeMs);
-//
-//                processedFrames = 0;
-//                totalPreviewTimeMs = 0;
-//
-//                fpsTimestamp = now;
-//            }
-//        }
-//
-//        if(outputCreated)
-//            releaseCameraPreviewOutputBuffer(outputBuffer);
-//
-//        while(mPreprocessQueue.try_dequeue(buffer)) {
-//            RawBufferManager::get().discardBuffer(buffer);
-//        }
-//#endif
-//        LOGD("Exiting preprocess thread");
+#ifdef GPU_CAMERA_PREVIEW
+        Halide::Runtime::Buffer<uint8_t> outputBuffer;
+
+        cl_int errCode = -1;
+        bool outputCreated = false;
+#endif
+        std::shared_ptr<RawImageBuffer> buffer;
+
+        std::chrono::steady_clock::time_point fpsTimestamp = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point nextDeadline = std::chrono::steady_clock::now();
+
+        int downscaleFactor = mRawPreviewQuality;
+        int processedFrames = 0;
+        int skippedFrames = 0;
+        double totalPreviewTimeMs = 0;
+
+        while(mEnableRawPreview) {
+            if(!mPreprocessQueue.wait_dequeue_timed(buffer, std::chrono::milliseconds(100))) {
+                continue;
+            }
+
+            // Always render the newest available frame. Anything queued
+            // behind it is already stale, so return it to the buffer manager
+            // straight away instead of displaying it late.
+            std::shared_ptr<RawImageBuffer> newerBuffer;
+
+            while(mPreprocessQueue.try_dequeue(newerBuffer)) {
+                onBufferReady(buffer);
+                buffer = std::move(newerBuffer);
+
+                ++skippedFrames;
+            }
+
+            // Pace the renders against the display deadline. A frame arriving
+            // before the next slot would only sit waiting behind the previous
+            // one, so skip it rather than queue it.
+            auto now = std::chrono::steady_clock::now();
+
+            if(now < nextDeadline) {
+                onBufferReady(buffer);
+                ++skippedFrames;
+                continue;
+            }
+
+            nextDeadline = now + std::chrono::milliseconds(PREVIEW_TARGET_FRAME_INTERVAL_MS);
+
+#ifdef GPU_CAMERA_PREVIEW
+            if(!outputCreated) {
+                outputBuffer = createCameraPreviewOutputBuffer(*buffer, downscaleFactor);
+                outputCreated = true;
+            }
+
+            Halide::Runtime::Buffer<uint8_t> inputBuffer = wrapCameraPreviewInputBuffer(*buffer);
+
+            auto previewTimestamp = std::chrono::steady_clock::now();
+
+            motioncam::CameraPreview::generate(
+                *buffer, mCameraDesc->metadata, downscaleFactor, 1.0f, inputBuffer, outputBuffer);
+
+            totalPreviewTimeMs +=
+                    std::chrono::duration <double, std::milli>(std::chrono::steady_clock::now() - previewTimestamp).count();
+
+            unwrapCameraPreviewInputBuffer(inputBuffer);
+
+            cl_context clContext = nullptr;
+            cl_command_queue clQueue = nullptr;
+
+            VERIFY_RESULT(CL_acquire(&clContext, &clQueue), "Failed to acquire CL context");
+
+            auto clOutputBuffer = (cl_mem) halide_opencl_get_cl_mem(nullptr, outputBuffer.raw_buffer());
+            auto data = CL_enqueueMapBuffer(
+                    clQueue, clOutputBuffer, CL_TRUE, CL_MAP_READ, 0, outputBuffer.size_in_bytes(), 0, nullptr, nullptr, &errCode);
+
+            VERIFY_RESULT(errCode, "Failed to map output buffer");
+
+            mPreviewListener->onPreviewGenerated(data, outputBuffer.size_in_bytes(), outputBuffer.width(), outputBuffer.height());
+
+            errCode = CL_enqueueUnmapMemObject(clQueue, clOutputBuffer, data, 0, nullptr, nullptr);
+            VERIFY_RESULT(errCode, "Failed to unmap output buffer");
+
+            VERIFY_RESULT(CL_release(), "Failed to release CL context");
+#endif
+
+            // Return buffer
+            onBufferReady(buffer);
+
+            processedFrames += 1;
+
+            auto durationMs = std::chrono::duration <double, std::milli>(std::chrono::steady_clock::now() - fpsTimestamp).count();
+
+            // Print camera FPS + stats
+            if(durationMs > 3000.0f) {
+                double avgProcessTimeMs = processedFrames > 0 ? totalPreviewTimeMs / processedFrames : 0;
+
+                LOGI("Camera FPS: %d, skippedFrames=%d, cameraQuality=%d, processTimeMs=%.2f",
+                     processedFrames / 3, skippedFrames, downscaleFactor, avgProcessTimeMs);
+
+                processedFrames = 0;
+                skippedFrames = 0;
+                totalPreviewTimeMs = 0;
+
+                fpsTimestamp = std::chrono::steady_clock::now();
+            }
+        }
+
+#ifdef GPU_CAMERA_PREVIEW
+        if(outputCreated)
+            releaseCameraPreviewOutputBuffer(outputBuffer);
+#endif
+
+        while(mPreprocessQueue.try_dequeue(buffer)) {
+            RawBufferManager::get().discardBuffer(buffer);
+        }
+
+        LOGD("Exiting preprocess thread");
     }
 
     void RawImageConsumer::enableRawPreview(std::shared_ptr<RawPreviewListener> listener, const int previewQuality) {
@@ -639,25 +799,24 @@ namespace motioncam {
                     LOGE("Failed to get size of camera buffer!");
                 }
 
-                doSetupBuffers(length);
-            }
+                // If the pool was preallocated from the configured output
+                // size and the HAL's buffer layout doesn't match the
+                // estimate, rebuild it from the real size
+                const size_t preallocatedBufferSize = mPreallocatedBufferSize.exchange(0);
 
-            std::shared_ptr<RawImageBuffer> dst = RawBufferManager::get().dequeueUnusedBuffer();
+                if(preallocatedBufferSize > 0 && preallocatedBufferSize != (size_t) length) {
+                    LOGW("Preallocated buffer size %zu does not match camera buffer size %d, rebuilding pool",
+                         preallocatedBufferSize, length);
 
-            // If there are no buffers available, we can't do anything useful here
-            if(!dst) {
-                continue;
-            }
+                    while(RawBufferManager::get().removeBuffer())
+                        ;
+                }
 
-            // Reset buffer
-            dst->width     = 0;
-            dst->height    = 0;
-            dst->rowStride = 0;
-            dst->metadata.timestampNs = 0;
-            dst->isCompressed = false;
+                doSetupBuffers(length);
+            }
 
             //
-            // Copy buffer
+            // Read frame layout
             //
 
             int32_t format      = 0;
@@ -679,74 +838,207 @@ namespace motioncam {
             result &= (AImage_getTimestamp(image, &timestamp)           == AMEDIA_OK);
             result &= (AImage_getPlaneData(image, 0, &data, &length)    == AMEDIA_OK);
 
-            // Copy raw data if were able to acquire it successfully
-            if(result) {
-                switch(format) {
-                    default:
-                    case AIMAGE_FORMAT_RAW10:
-                        dst->pixelFormat = PixelFormat::RAW10;
-                        break;
+            if(!result) {
+                LOGW("Failed to read image!");
+
+                doMatchMetadata();
+                continue;
+            }
+
+            const auto copyStartTime = std::chrono::steady_clock::now();
 
-                    case AIMAGE_FORMAT_RAW12:
-                        dst->pixelFormat = PixelFormat::RAW12;
+            std::shared_ptr<RawImageBuffer> dst;
+
+#ifndef GPU_CAMERA_PREVIEW
+            // Wrap the HAL buffer instead of copying it out while the
+            // reader can spare the slot. The image goes back to the reader
+            // when the buffer is discarded, or earlier if an in-place
+            // stage detaches it. With the GPU preview the pool buffers are
+            // CL buffers the preview kernels read directly, so every frame
+            // is copied there.
+            if(NativeImageBuffer::numOutstanding() < MAX_WRAPPED_IMAGES) {
+                dst = std::make_shared<RawImageBuffer>(
+                    std::make_unique<NativeImageBuffer>(pendingImage, data, length));
+
+                dst->isForeign = true;
+            }
+#endif
+
+            if(!dst) {
+                dst = RawBufferManager::get().dequeueUnusedBuffer();
+
+                // If there are no buffers available, we can't do anything useful here
+                if(!dst) {
+                    RawBufferManager::get().recordCopyDrop();
+                    continue;
+                }
+            }
+
+            // Reset buffer
+            dst->width     = 0;
+            dst->height    = 0;
+            dst->rowStride = 0;
+            dst->metadata.timestampNs = 0;
+            dst->isCompressed = false;
+
+            switch(format) {
+                default:
+                case AIMAGE_FORMAT_RAW10:
+                    dst->pixelFormat = PixelFormat::RAW10;
+                    break;
+
+                case AIMAGE_FORMAT_RAW12:
+                    dst->pixelFormat = PixelFormat::RAW12;
+                    break;
+
+                case AIMAGE_FORMAT_RAW16:
+                    dst->pixelFormat = PixelFormat::RAW16;
+                    break;
+
+                case AIMAGE_FORMAT_YUV_420_888:
+                    dst->pixelFormat = PixelFormat::YUV_420_888;
+                    break;
+
+                case AIMAGE_FORMAT_RAW_PRIVATE:
+                    dst->pixelFormat = PixelFormat::RAW10;
+                    break;
+            }
+
+            dst->width                  = width;
+            dst->height                 = height;
+            dst->originalWidth          = width;
+            dst->originalHeight         = height;
+            dst->isBinned               = false;
+            dst->rowStride              = rowStride;
+            dst->metadata.timestampNs   = timestamp;
+            dst->compressionType        = CompressionType::UNCOMPRESSED;
+            dst->offset                 = 0;
+
+            if(dst->isForeign) {
+                // The frame is already where it needs to be; the row
+                // padding, if any, stays and downstream stages work from
+                // rowStride as usual
+                dst->data->setValidRange(0, length);
+            }
+            else {
+                // Bytes of payload per row. The camera HAL may pad rows out
+                // to rowStride; the padding carries no pixels.
+                int32_t packedRowBytes;
+
+                switch(dst->pixelFormat) {
+                    case PixelFormat::RAW10:
+                        packedRowBytes = (width * 10) / 8;
                         break;
 
-                    case AIMAGE_FORMAT_RAW16:
-                        dst->pixelFormat = PixelFormat::RAW16;
+                    case PixelFormat::RAW12:
+                        packedRowBytes = (width * 12) / 8;
                         break;
 
-                    case AIMAGE_FORMAT_YUV_420_888:
-                        dst->pixelFormat = PixelFormat::YUV_420_888;
+                    case PixelFormat::RAW16:
+                        packedRowBytes = width * 2;
                         break;
 
-                    case AIMAGE_FORMAT_RAW_PRIVATE:
-                        dst->pixelFormat = PixelFormat::RAW10;
+                    default:
+                        // Unknown layout, keep the padding
+                        packedRowBytes = rowStride;
                         break;
                 }
 
-                dst->width                  = width;
-                dst->height                 = height;
-                dst->originalWidth          = width;
-                dst->originalHeight         = height;
-                dst->isBinned               = false;
-                dst->rowStride              = rowStride;
-                dst->metadata.timestampNs   = timestamp;
-                dst->compressionType        = CompressionType::UNCOMPRESSED;
-                dst->offset                 = 0;
-
                 if(dst->data->len() != length) {
                     LOGE("Unexpected buffer size!!");
                 }
                 else {
                     auto dstBuffer = dst->data->lock(true);
 
-                    if(dstBuffer)
-                        std::copy(data, data + length, dstBuffer);
+                    if(dstBuffer) {
+                        if(packedRowBytes >= rowStride) {
+                            std::copy(data, data + length, dstBuffer);
+
+                            dst->data->setValidRange(0, length);
+                        }
+                        else {
+                            // Drop the row padding while copying. This copy
+                            // runs at capture rate, and every stage
+                            // downstream of it (compression, disk writes)
+                            // then works on packed rows instead of the
+                            // padded stride.
+                            const uint8_t* srcRow = data;
+                            uint8_t* dstRow = dstBuffer;
+
+                            for(int32_t y = 0; y < height; y++) {
+                                std::copy(srcRow, srcRow + packedRowBytes, dstRow);
+
+                                srcRow += rowStride;
+                                dstRow += packedRowBytes;
+                            }
+
+                            dst->rowStride = packedRowBytes;
+                            dst->data->setValidRange(0, static_cast<size_t>(packedRowBytes) * height);
+                        }
+                    }
 
                     dst->data->unlock();
-                    dst->data->setValidRange(0, length);
                 }
             }
-            else {
-                LOGW("Failed to copy image!");
-            }
 
-            // Insert back
-            if(!result) {
-                LOGW("Got error, discarding buffer");
-                RawBufferManager::get().discardBuffer(dst);
+            RawBufferManager::get().recordCopy(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - copyStartTime).count());
+
+            // Probe the held metadata for this frame; when it has
+            // already arrived the buffer is dispatched immediately
+            bool matched = false;
+
+            for(size_t i = 0; i < mPendingMetadataSlots.size(); i++) {
+                auto& slot = mPendingMetadataSlots[(static_cast<uint64_t>(timestamp) + i) % mPendingMetadataSlots.size()];
+
+                if(slot.valid && slot.metadata.timestampNs == timestamp) {
+                    dst->metadata = std::move(slot.metadata);
+                    slot.valid = false;
+
+                    dispatchMatchedBuffer(dst);
+
+                    matched = true;
+                    break;
+                }
             }
-            else {
-                auto imageIt = mPendingBuffers.find(timestamp);
 
-                if (imageIt != mPendingBuffers.end()) {
-                    LOGW("Pending timestamp already exists!");
+            if(!matched) {
+                // Hold the frame until its metadata arrives
+                std::shared_ptr<RawImageBuffer>* insertAt = nullptr;
+                std::shared_ptr<RawImageBuffer>* oldest = nullptr;
+
+                for(size_t i = 0; i < mPendingBuffers.size(); i++) {
+                    auto& slot = mPendingBuffers[(static_cast<uint64_t>(timestamp) + i) % mPendingBuffers.size()];
+
+                    if(slot) {
+                        if(slot->metadata.timestampNs == timestamp) {
+                            LOGW("Pending timestamp already exists!");
+
+                            RawBufferManager::get().discardBuffer(slot);
+                            slot = nullptr;
 
-                    RawBufferManager::get().discardBuffer(imageIt->second);
-                    mPendingBuffers.erase(imageIt);
+                            insertAt = &slot;
+                            break;
+                        }
+
+                        if(!oldest || slot->metadata.timestampNs < (*oldest)->metadata.timestampNs)
+                            oldest = &slot;
+                    }
+                    else if(!insertAt) {
+                        insertAt = &slot;
+                        break;
+                    }
                 }
 
-                mPendingBuffers.insert(std::make_pair(timestamp, dst));
+                if(!insertAt) {
+                    // Table full; the oldest frame's metadata evidently
+                    // isn't coming
+                    RawBufferManager::get().discardBuffer(*oldest);
+                    insertAt = oldest;
+                }
+
+                *insertAt = dst;
             }
 
             // Match buffers
@@ -760,13 +1052,15 @@ namespace motioncam {
         }
 
         // Return all pending buffers
-        auto it = mPendingBuffers.begin();
-        while(it != mPendingBuffers.end()) {
-            RawBufferManager::get().discardBuffer(it->second);
-            ++it;
+        for(auto& slot : mPendingBuffers) {
+            if(slot) {
+                RawBufferManager::get().discardBuffer(slot);
+                slot = nullptr;
+            }
         }
 
-        mPendingBuffers.clear();
+        for(auto& slot : mPendingMetadataSlots)
+            slot.valid = false;
 
         LOGD("Exiting copy thread");
     }
@@ -1,10 +1,10 @@
 #ifndef RawImageConsumer_hpp
 #define RawImageConsumer_hpp
 
+#include <array>
 #include <vector>
 #include <thread>
 #include <mutex>
-#include <map>
 #include <string>
 #include <chrono>
 
@@ -32,25 +32,49 @@ namespace motioncam {
     public:
         RawImageConsumer(std::shared_ptr<CameraDescription> cameraDescription,
                          std::shared_ptr<CameraSessionListener> listener,
+                         const bool usePreviewRawStream,
                          const size_t maxMemoryUsageBytes);
         ~RawImageConsumer();
 
+        // Warms up the Halide runtime and fills the buffer pool with
+        // buffers of the given estimated size, so the slow parts of
+        // startup can overlap with opening the camera device. Safe to call
+        // from another thread before start(); if the HAL's buffer layout
+        // turns out not to match the estimate, the pool is rebuilt when
+        // the first frame arrives, which is no worse than not having
+        // preallocated at all.
+        void preallocate(const size_t estimatedBufferSize);
+
         void start();
         void stop();
 
         void grow(uint64_t memoryLimitBytes);
 
         void queueImage(AImage* image);
+
+        // Bulk variant for the reader drain loop. Takes ownership of the
+        // images and clears the vector so the caller can reuse it.
+        void queueImages(std::vector<std::shared_ptr<AImage>>& images);
+
         void queueMetadata(const ACameraMetadata* metadata, ScreenOrientation screenOrientation, RawType rawType);
 
+        // Frames from the dedicated preview RAW stream, when the camera has
+        // one. Keeps only the newest frame and drops the one it replaces.
+        void queuePreviewImage(AImage* image);
+
         void enableRawPreview(std::shared_ptr<RawPreviewListener> listener, const int previewQuality);
         void disableRawPreview();
 
         void getEstimatedSettings(PostProcessSettings& outSettings);
 
+        // How often the settings estimate is refreshed when the scene is
+        // static; scene changes trigger a re-estimate regardless
+        void setEstimateSettingsInterval(const int frames);
+
     private:
         bool copyMetadata(RawImageMetadata& dst, const ACameraMetadata* src);
         void onBufferReady(const std::shared_ptr<RawImageBuffer>& buffer);
+        void dispatchMatchedBuffer(const std::shared_ptr<RawImageBuffer>& buffer);
 
         void doSetupBuffers(const size_t bufferSize);
         void doCopyImage();
@@ -74,19 +98,44 @@ namespace motioncam {
         std::atomic<bool> mEnableRawPreview;
 
         std::atomic<bool> mRequestSetupBuffers;
+        std::atomic<size_t> mPreallocatedBufferSize;
 
         PostProcessSettings mEstimatedSettings;
 
         std::shared_ptr<CameraDescription> mCameraDesc;
+        const bool mUsePreviewRawStream;
         int mRawPreviewQuality;
         bool mCopyCaptureColorTransform;
         int mFramesSinceEstimatedSettings;
 
+        // Scene state at the last full settings estimate
+        std::atomic<int> mEstimateFrameInterval;
+        float mLastEstimateEv;
+        cv::Vec3f mLastEstimateAsShot;
+
         moodycamel::BlockingConcurrentQueue<std::shared_ptr<AImage>> mImageQueue;
         moodycamel::ConcurrentQueue<RawImageMetadata> mPendingMetadata;
         moodycamel::BlockingConcurrentQueue<std::shared_ptr<RawImageBuffer>> mPreprocessQueue;
 
-        std::map<int64_t, std::shared_ptr<RawImageBuffer>> mPendingBuffers;
+        // Frames and metadata waiting for their counterpart, probed by
+        // sensor timestamp. Fixed tables instead of maps: matching runs at
+        // capture rate with only a few entries ever in flight, so probes are
+        // short and nothing allocates or requeues on the capture path. Only
+        // the consumer thread touches them; the queues above are the
+        // cross-thread handoff.
+        static const int PENDING_SLOTS = 32;
+
+        struct HeldMetadata {
+            bool valid{false};
+            RawImageMetadata metadata;
+        };
+
+        std::array<std::shared_ptr<RawImageBuffer>, PENDING_SLOTS> mPendingBuffers;
+        std::array<HeldMetadata, PENDING_SLOTS> mPendingMetadataSlots;
+
+        // Single slot holding the latest frame from the preview RAW stream
+        std::mutex mPreviewImageMutex;
+        std::shared_ptr<AImage> mLatestPreviewImage;
 
         std::shared_ptr<RawPreviewListener> mPreviewListener;
     };
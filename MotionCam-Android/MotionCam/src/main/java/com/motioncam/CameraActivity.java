@@ -162,6 +162,10 @@ public class CameraActivity extends AppCompatActivity implements
 
     private boolean mUserCaptureModeOverride;
 
+    // Watermark applied to the configured buffer pool budget while the
+    // system reports memory pressure
+    private float mMemoryPressureScale = 1.0f;
+
     private CameraStateManager mCameraStateManager;
 
     private Timer mRecordingTimer;
@@ -593,6 +597,56 @@ public class CameraActivity extends AppCompatActivity implements
 
         mBinding.previewPager.registerOnPageChangeCallback(mCapturedPreviewPagerListener);
         mUserCaptureModeOverride = false;
+
+        // A fresh session starts with the full configured budget
+        mMemoryPressureScale = 1.0f;
+    }
+
+    @Override
+    public void onTrimMemory(int level) {
+        super.onTrimMemory(level);
+
+        // Scale the buffer pool down before the low memory killer picks this
+        // process. Only the foreground levels matter here; the camera is torn
+        // down in onPause() before the backgrounded ones arrive.
+        float scale;
+
+        switch(level) {
+            case TRIM_MEMORY_RUNNING_MODERATE:
+                scale = 0.75f;
+                break;
+
+            case TRIM_MEMORY_RUNNING_LOW:
+                scale = 0.5f;
+                break;
+
+            case TRIM_MEMORY_RUNNING_CRITICAL:
+                scale = 0.25f;
+                break;
+
+            default:
+                return;
+        }
+
+        // Only ever shrink within a session; the budget resets when the
+        // activity resumes
+        if(scale >= mMemoryPressureScale)
+            return;
+
+        mMemoryPressureScale = scale;
+
+        Log.w(TAG, "Memory pressure level " + level + ", scaling buffer pool to " + scale);
+
+        if(mNativeCamera != null) {
+            long configuredBytes = mSettings.captureMode == CaptureMode.RAW_VIDEO ?
+                    mSettings.rawVideoMemoryUseBytes : mSettings.memoryUseBytes;
+
+            mNativeCamera.adjustMemory(applyMemoryPressure(configuredBytes));
+        }
+    }
+
+    private long applyMemoryPressure(long memoryUseBytes) {
+        return (long) (memoryUseBytes * mMemoryPressureScale);
     }
 
     private boolean havePermissions() {
@@ -1092,7 +1146,7 @@ public class CameraActivity extends AppCompatActivity implements
             mNativeCamera.setFrameRate(mSettings.cameraStartupSettings.frameRate);
             mNativeCamera.setVideoCropPercentage(mSettings.widthVideoCrop, mSettings.heightVideoCrop);
             mNativeCamera.setVideoBin(mSettings.videoBin);
-            mNativeCamera.adjustMemory(mSettings.rawVideoMemoryUseBytes);
+            mNativeCamera.adjustMemory(applyMemoryPressure(mSettings.rawVideoMemoryUseBytes));
             mNativeCamera.setFocusForVideo(true);
 
             mNativeCamera.activateCameraSettings();
@@ -1116,7 +1170,7 @@ public class CameraActivity extends AppCompatActivity implements
 
         mNativeCamera.setFocusForVideo(false);
         mNativeCamera.setFrameRate(-1);
-        mNativeCamera.adjustMemory(mSettings.memoryUseBytes);
+        mNativeCamera.adjustMemory(applyMemoryPressure(mSettings.memoryUseBytes));
 
         mNativeCamera.activateCameraSettings();
     }
@@ -1682,7 +1736,7 @@ public class CameraActivity extends AppCompatActivity implements
     private void initCamera() {
         // Create camera manager and get supported cameras
         if(mNativeCameraManager == null) {
-            mNativeCameraManager = new NativeCameraManager();
+            mNativeCameraManager = new NativeCameraManager(getCacheDir().getAbsolutePath());
         }
 
         if(mCameraInfos == null) {
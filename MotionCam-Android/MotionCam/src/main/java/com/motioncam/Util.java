@@ -13,7 +13,11 @@ import android.util.Log;
 import androidx.documentfile.provider.DocumentFile;
 
 import java.io.File;
+import java.io.FileInputStream;
 import java.io.FileNotFoundException;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.nio.channels.FileChannel;
 import java.util.ArrayList;
 
 public class Util {
@@ -79,6 +83,34 @@ public class Util {
         return -1;
     }
 
+    // In-kernel copy of a staged file into a resolver backed destination.
+    // FileChannel.transferTo() moves the payload with sendfile(2) instead of
+    // bouncing it through a userspace buffer, so finalizing a multi-GB
+    // recording runs at disk bandwidth rather than half of it.
+    static public void CopyToUri(Context context, File source, Uri destination) throws IOException {
+        ContentResolver resolver = context.getContentResolver();
+
+        try(ParcelFileDescriptor pfd = resolver.openFileDescriptor(destination, "w", null)) {
+            if(pfd == null)
+                throw new IOException("Failed to open " + destination);
+
+            try(FileChannel src = new FileInputStream(source).getChannel();
+                FileChannel dst = new FileOutputStream(pfd.getFileDescriptor()).getChannel())
+            {
+                long offset = 0;
+                final long size = src.size();
+
+                while(offset < size) {
+                    long written = src.transferTo(offset, size - offset, dst);
+                    if(written <= 0)
+                        throw new IOException("Copy failed at offset " + offset + " of " + source);
+
+                    offset += written;
+                }
+            }
+        }
+    }
+
     private static ArrayList<DocumentFileEntry> internalListFiles(File root) {
         final ArrayList<DocumentFileEntry> results = new ArrayList<>();
         if(root == null || !root.exists())
@@ -2,6 +2,8 @@ package com.motioncam.camera;
 
 import android.graphics.Bitmap;
 import android.graphics.PointF;
+import android.os.Handler;
+import android.os.Looper;
 import android.util.Size;
 import android.view.Surface;
 
@@ -11,6 +13,8 @@ import com.squareup.moshi.Moshi;
 
 import java.io.Closeable;
 import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 
 public class NativeCamera implements Closeable, NativeCameraSessionListener, NativeCameraRawPreviewListener {
 
@@ -118,6 +122,37 @@ public class NativeCamera implements Closeable, NativeCameraSessionListener, Nat
     private static int SESSION_ID = 1000;
 
     private final Moshi mJson = new Moshi.Builder().build();
+
+    // Per-frame camera events (exposure status, AF/AE state) are queued in
+    // native code and drained here on a timer through one JNI crossing,
+    // instead of a Java callback per event. Layout matches
+    // NativeCameraBridgeListener::CameraEvent.
+    private static final int CAMERA_EVENT_SIZE = 24;
+    private static final int CAMERA_EVENT_BUFFER_ENTRIES = 64;
+    private static final int CAMERA_EVENT_POLL_MS = 50;
+
+    private static final int EVENT_EXPOSURE_STATUS = 1;
+    private static final int EVENT_AUTO_FOCUS_STATE = 2;
+    private static final int EVENT_AUTO_EXPOSURE_STATE = 3;
+
+    // Reusable buffer for the packed settings exchange with native code
+    private final ByteBuffer mPackedSettings = ByteBuffer.allocateDirect(PostProcessSettings.PACKED_SIZE);
+
+    private final ByteBuffer mCameraEvents =
+            ByteBuffer.allocateDirect(CAMERA_EVENT_SIZE * CAMERA_EVENT_BUFFER_ENTRIES).order(ByteOrder.nativeOrder());
+
+    private Handler mEventHandler;
+
+    private final Runnable mCameraEventPoller = new Runnable() {
+        @Override
+        public void run() {
+            drainCameraEvents();
+
+            if(mEventHandler != null)
+                mEventHandler.postDelayed(this, CAMERA_EVENT_POLL_MS);
+        }
+    };
+
     private CameraSessionListener mListener;
     private CameraRawPreviewListener mRawPreviewListener;
     private final int mSessionId;
@@ -166,14 +201,50 @@ public class NativeCamera implements Closeable, NativeCameraSessionListener, Nat
         {
             throw new CameraException(GetLastError());
         }
+
+        mEventHandler = new Handler(Looper.getMainLooper());
+        mEventHandler.postDelayed(mCameraEventPoller, CAMERA_EVENT_POLL_MS);
     }
 
     public void stopCapture() {
+        if(mEventHandler != null) {
+            mEventHandler.removeCallbacks(mCameraEventPoller);
+            mEventHandler = null;
+        }
+
+        // Pick up anything still queued before the native session goes away
+        drainCameraEvents();
+
         if(!StopCapture()) {
             throw new CameraException(GetLastError());
         }
     }
 
+    private void drainCameraEvents() {
+        int count = PollCameraEvents(mCameraEvents);
+
+        for(int i = 0; i < count; i++) {
+            int base = i * CAMERA_EVENT_SIZE;
+
+            switch(mCameraEvents.getInt(base)) {
+                case EVENT_EXPOSURE_STATUS:
+                    onCameraExposureStatus(mCameraEvents.getInt(base + 4), mCameraEvents.getLong(base + 16));
+                    break;
+
+                case EVENT_AUTO_FOCUS_STATE:
+                    onCameraAutoFocusStateChanged(mCameraEvents.getInt(base + 4), mCameraEvents.getFloat(base + 8));
+                    break;
+
+                case EVENT_AUTO_EXPOSURE_STATE:
+                    onCameraAutoExposureStateChanged(mCameraEvents.getInt(base + 4));
+                    break;
+
+                default:
+                    break;
+            }
+        }
+    }
+
     public void pauseCapture() {
         PauseCapture();
     }
@@ -214,15 +285,12 @@ public class NativeCamera implements Closeable, NativeCameraSessionListener, Nat
         SetExposureCompensation(value);
     }
 
-    public PostProcessSettings getRawPreviewEstimatedPostProcessSettings() throws IOException {
-        String settingsJson = GetRawPreviewEstimatedSettings();
-
-        if(settingsJson == null) {
+    public synchronized PostProcessSettings getRawPreviewEstimatedPostProcessSettings() throws IOException {
+        if(!GetRawPreviewEstimatedSettings(mPackedSettings)) {
             return null;
         }
 
-        JsonAdapter<PostProcessSettings> jsonAdapter = mJson.adapter(PostProcessSettings.class);
-        return jsonAdapter.fromJson(settingsJson);
+        return PostProcessSettings.FromPackedBuffer(mPackedSettings);
     }
 
     public void prepareHdrCapture(int iso, long exposure) {
@@ -269,14 +337,12 @@ public class NativeCamera implements Closeable, NativeCameraSessionListener, Nat
         return GetAvailableImages();
     }
 
-    public PostProcessSettings estimatePostProcessSettings(float shadowsBias) throws IOException {
-        String settingsJson = EstimatePostProcessSettings(shadowsBias);
-        if(settingsJson == null) {
+    public synchronized PostProcessSettings estimatePostProcessSettings(float shadowsBias) throws IOException {
+        if(!EstimatePostProcessSettings(shadowsBias, mPackedSettings)) {
             return null;
         }
 
-        JsonAdapter<PostProcessSettings> jsonAdapter = mJson.adapter(PostProcessSettings.class);
-        return jsonAdapter.fromJson(settingsJson);
+        return PostProcessSettings.FromPackedBuffer(mPackedSettings);
     }
 
     public float estimateShadows(float bias) {
@@ -287,10 +353,25 @@ public class NativeCamera implements Closeable, NativeCameraSessionListener, Nat
         return MeasureSharpness(bufferHandle);
     }
 
+    // Sharpness of a region of the most recent frame, in normalised [0..1]
+    // frame coordinates. Cheap enough to poll per preview frame for focus
+    // assist.
+    public double measureSharpnessRoi(float roiX, float roiY, float roiWidth, float roiHeight) {
+        return MeasureSharpnessRoi(roiX, roiY, roiWidth, roiHeight);
+    }
+
     public void enableRawPreview(CameraRawPreviewListener listener, int previewQuality, boolean overrideWb) {
         mRawPreviewListener = listener;
 
-        EnableRawPreview(this, previewQuality, overrideWb);
+        EnableRawPreview(this, null, previewQuality, overrideWb);
+    }
+
+    // Renders the preview directly into the given surface, skipping the
+    // bitmap copy and the per-frame listener callbacks
+    public void enableRawPreview(CameraRawPreviewListener listener, Surface previewOutputSurface, int previewQuality, boolean overrideWb) {
+        mRawPreviewListener = listener;
+
+        EnableRawPreview(this, previewOutputSurface, previewQuality, overrideWb);
     }
 
     public void setRawPreviewSettings(
@@ -335,7 +416,11 @@ public class NativeCamera implements Closeable, NativeCameraSessionListener, Nat
     }
 
     public void streamToFile(int[] fds, int audioFd, int audioDeviceId, int numThreads) {
-        StartStreamToFile(fds, audioFd, audioDeviceId, numThreads);
+        StartStreamToFile(fds, audioFd, audioDeviceId, numThreads, 0);
+    }
+
+    public void streamToFile(int[] fds, int audioFd, int audioDeviceId, int numThreads, int preRollMs) {
+        StartStreamToFile(fds, audioFd, audioDeviceId, numThreads, preRollMs);
     }
 
     public void adjustMemory(long maxMemoryBytes) {
@@ -456,6 +541,7 @@ public class NativeCamera implements Closeable, NativeCameraSessionListener, Nat
             long maxMemoryUsageBytes);
 
     private native boolean StopCapture();
+    private native int PollCameraEvents(ByteBuffer eventBuffer);
     private native boolean PauseCapture();
     private native boolean ResumeCapture();
 
@@ -473,14 +559,14 @@ public class NativeCamera implements Closeable, NativeCameraSessionListener, Nat
     private native boolean SetAutoFocus();
     private native boolean ActivateCameraSettings();
 
-    private native boolean EnableRawPreview(NativeCameraRawPreviewListener listener, int previewQuality, boolean overrideWb);
+    private native boolean EnableRawPreview(NativeCameraRawPreviewListener listener, Surface previewOutputSurface, int previewQuality, boolean overrideWb);
     private native boolean SetRawPreviewSettings(float shadows, float contrast, float saturation, float blacks, float whitePoint, float tempOffset, float tintOfset, boolean useVideoPreview);
     private native boolean DisableRawPreview();
-    private native String GetRawPreviewEstimatedSettings();
+    private native boolean GetRawPreviewEstimatedSettings(ByteBuffer dst);
 
     private native boolean UpdateOrientation(int orientation);
 
-    private native boolean StartStreamToFile(int[] videoFds, int audioFd, int audioDeviceId, int numThreads);
+    private native boolean StartStreamToFile(int[] videoFds, int audioFd, int audioDeviceId, int numThreads, int preRollMs);
     private native void EndStream();
 
     private native void PrepareHdrCapture(int iso, long exposure);
@@ -494,9 +580,10 @@ public class NativeCamera implements Closeable, NativeCameraSessionListener, Nat
     private native boolean CreateImagePreview(long bufferHandle, String settings, int downscaleFactor, Bitmap dst);
 
     private native double MeasureSharpness(long bufferHandle);
+    private native double MeasureSharpnessRoi(float roiX, float roiY, float roiWidth, float roiHeight);
 
     private native float EstimateShadows(float bias);
-    private native String EstimatePostProcessSettings(float shadowsBias);
+    private native boolean EstimatePostProcessSettings(float shadowsBias, ByteBuffer dst);
 
     private native void SetFrameRate(int frameRate);
     private native void SetVideoCropPercentage(int horizontal, int vertical);
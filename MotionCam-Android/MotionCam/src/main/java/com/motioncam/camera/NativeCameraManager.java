@@ -6,8 +6,8 @@ import java.io.Closeable;
 import java.io.IOException;
 
 public class NativeCameraManager implements Closeable {
-    public NativeCameraManager() {
-        CreateCameraManager();
+    public NativeCameraManager(String cachePath) {
+        CreateCameraManager(cachePath);
     }
 
     @Override
@@ -41,7 +41,7 @@ public class NativeCameraManager implements Closeable {
         return GetMetadata(cameraInfo.cameraId);
     }
 
-    private native void CreateCameraManager();
+    private native void CreateCameraManager(String cachePath);
     private native void DestroyCameraManager();
 
     private native NativeCameraInfo[] GetSupportedCameras();
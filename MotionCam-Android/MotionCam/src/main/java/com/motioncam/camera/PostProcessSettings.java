@@ -1,6 +1,15 @@
 package com.motioncam.camera;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
 public class PostProcessSettings implements Cloneable {
+    // Mirrors PackedPostProcessSettings in Settings.h. Keep the version and
+    // field order in sync with the native side.
+    public static final int PACKED_VERSION      = 1;
+    public static final int PACKED_STRING_SIZE  = 32;
+    public static final int PACKED_SIZE         = 112 + 2 * PACKED_STRING_SIZE;
+
     // Denoising
     public int spatialDenoiseLevel              = -1;
 
@@ -39,6 +48,65 @@ public class PostProcessSettings implements Cloneable {
 
     public String captureMode                   = "ZSL";
 
+    private static String getPackedString(ByteBuffer buffer) {
+        byte[] bytes = new byte[PACKED_STRING_SIZE];
+        buffer.get(bytes);
+
+        int length = 0;
+        while(length < bytes.length && bytes[length] != 0)
+            ++length;
+
+        return new String(bytes, 0, length);
+    }
+
+    // Reads the packed layout the native side writes into a direct
+    // ByteBuffer. Returns null on a layout version mismatch.
+    public static PostProcessSettings FromPackedBuffer(ByteBuffer buffer) {
+        buffer.order(ByteOrder.nativeOrder());
+        buffer.position(0);
+
+        if(buffer.getInt() != PACKED_VERSION)
+            return null;
+
+        PostProcessSettings settings = new PostProcessSettings();
+
+        settings.spatialDenoiseLevel    = buffer.getInt();
+
+        settings.temperature            = buffer.getFloat();
+        settings.tint                   = buffer.getFloat();
+        settings.gamma                  = buffer.getFloat();
+        settings.tonemapVariance        = buffer.getFloat();
+        settings.shadows                = buffer.getFloat();
+        settings.whitePoint             = buffer.getFloat();
+        settings.contrast               = buffer.getFloat();
+        settings.brightness             = buffer.getFloat();
+        settings.sharpen0               = buffer.getFloat();
+        settings.sharpen1               = buffer.getFloat();
+        settings.pop                    = buffer.getFloat();
+        settings.blacks                 = buffer.getFloat();
+        settings.exposure               = buffer.getFloat();
+        settings.clippedLows            = buffer.getFloat();
+        settings.clippedHighs           = buffer.getFloat();
+        settings.noiseSigma             = buffer.getFloat();
+        settings.sceneLuminance         = buffer.getFloat();
+        settings.saturation             = buffer.getFloat();
+        settings.blues                  = buffer.getFloat();
+        settings.greens                 = buffer.getFloat();
+
+        settings.jpegQuality            = buffer.getInt();
+        settings.flipped                = buffer.getInt() != 0;
+        settings.dng                    = buffer.getInt() != 0;
+
+        settings.gpsLatitude            = buffer.getFloat();
+        settings.gpsLongitude           = buffer.getFloat();
+        settings.gpsAltitude            = buffer.getFloat();
+
+        settings.gpsTime                = getPackedString(buffer);
+        settings.captureMode            = getPackedString(buffer);
+
+        return settings;
+    }
+
     @Override
     public PostProcessSettings clone() {
         try {
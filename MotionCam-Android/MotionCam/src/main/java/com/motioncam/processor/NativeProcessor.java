@@ -21,6 +21,12 @@ public class NativeProcessor {
         ProcessRawVideo(fds, numFramesToMerge, correctVignette, listener);
     }
 
+    // Paces a running export. 1 runs at full speed; lower values slow the
+    // pipeline down so a hot or draining device can sustain the export.
+    static public void setExportThrottle(float throttle) {
+        SetExportThrottle(throttle);
+    }
+
     public ContainerMetadata getRawVideoMetadata(int fds[]) {
         Objects.requireNonNull(fds);
 
@@ -31,14 +37,22 @@ public class NativeProcessor {
         return GenerateRawVideoPreview(fd, numPreviews, listener);
     }
 
+    public boolean exportRawVideo(int fds[], int outputFd, int downscale, boolean useHevc, NativeDngConverterListener listener) {
+        Objects.requireNonNull(fds);
+
+        return ExportRawVideo(fds, outputFd, downscale, useHevc, listener);
+    }
+
     native boolean ProcessInMemory(String outputPath, NativeProcessorProgressListener progressListener);
     native boolean ProcessFile(String inputPath, String outputPath, NativeProcessorProgressListener progressListener);
 
     native boolean ProcessRawVideo(int fds[], int numFramesToMerge, boolean correctVignette, NativeDngConverterListener progressListener);
     native ContainerMetadata GetRawVideoMetadata(int fds[]);
     native boolean GenerateRawVideoPreview(int fd, int numPreviews, NativeBitmapListener listener);
+    native boolean ExportRawVideo(int fds[], int outputFd, int downscale, boolean useHevc, NativeDngConverterListener progressListener);
 
     static native void CloseFd(int fd);
+    static native void SetExportThrottle(float throttle);
 
     native String GetLastError();
 }
@@ -4,10 +4,14 @@ import android.app.NotificationManager;
 import android.app.PendingIntent;
 import android.content.ContentResolver;
 import android.content.Context;
+import android.content.Intent;
+import android.content.IntentFilter;
 import android.graphics.BitmapFactory;
 import android.net.Uri;
+import android.os.BatteryManager;
 import android.os.Build;
 import android.os.ParcelFileDescriptor;
+import android.os.PowerManager;
 import android.text.TextUtils;
 import android.util.Log;
 
@@ -28,7 +32,6 @@ import com.motioncam.processor.NativeProcessor;
 import org.apache.commons.io.IOUtil;
 
 import java.io.File;
-import java.io.FileInputStream;
 import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.InputStream;
@@ -64,6 +67,7 @@ public class VideoProcessWorker extends Worker implements NativeDngConverterList
     private List<Uri> mInputUris;
     private String mInputName;
     private DocumentFile mOutputDocument;
+    private PowerManager.OnThermalStatusChangedListener mThermalListener;
 
     public VideoProcessWorker(@NonNull Context context, @NonNull WorkerParameters workerParams) {
         super(context, workerParams);
@@ -79,20 +83,24 @@ public class VideoProcessWorker extends Worker implements NativeDngConverterList
     }
 
     private void moveVideo(List<Uri> inputUris) throws IOException {
-        ContentResolver resolver = getApplicationContext().getContentResolver();
+        Uri outputUri = mOutputDocument.getUri();
 
         for(Uri uri : inputUris) {
             File videoPath = new File(uri.getPath());
             if(!videoPath.exists())
                 continue;
 
+            // When the destination is a plain directory on the same
+            // filesystem the move is just a rename and no bytes are copied
+            if(outputUri.getScheme() != null && outputUri.getScheme().equalsIgnoreCase("file")) {
+                File dstPath = new File(outputUri.getPath(), videoPath.getName());
+                if(videoPath.renameTo(dstPath))
+                    continue;
+            }
+
             DocumentFile output = mOutputDocument.createFile("application/octet-stream", videoPath.getName() + ".tmp");
 
-            try(InputStream inputStream = new FileInputStream(videoPath);
-                OutputStream outputStream = resolver.openOutputStream(output.getUri()))
-            {
-                IOUtil.copy(inputStream, outputStream);
-            }
+            Util.CopyToUri(getApplicationContext(), videoPath, output.getUri());
 
             // Rename once we have deleted the original
             output.renameTo(videoPath.getName());
@@ -161,14 +169,90 @@ public class VideoProcessWorker extends Worker implements NativeDngConverterList
         return true;
     }
 
+    // Paces the native export from the device state: the thermal status sets
+    // the base rate and a draining battery caps it, so long exports settle at
+    // a speed the device can sustain.
+    private void updateExportThrottle(int thermalStatus) {
+        float throttle;
+
+        switch(thermalStatus) {
+            case PowerManager.THERMAL_STATUS_MODERATE:
+                throttle = 0.75f;
+                break;
+
+            case PowerManager.THERMAL_STATUS_SEVERE:
+                throttle = 0.5f;
+                break;
+
+            case PowerManager.THERMAL_STATUS_CRITICAL:
+            case PowerManager.THERMAL_STATUS_EMERGENCY:
+            case PowerManager.THERMAL_STATUS_SHUTDOWN:
+                throttle = 0.25f;
+                break;
+
+            default:
+                throttle = 1.0f;
+                break;
+        }
+
+        Intent battery = getApplicationContext()
+                .registerReceiver(null, new IntentFilter(Intent.ACTION_BATTERY_CHANGED));
+
+        if(battery != null) {
+            int status = battery.getIntExtra(BatteryManager.EXTRA_STATUS, -1);
+            int level = battery.getIntExtra(BatteryManager.EXTRA_LEVEL, -1);
+            int scale = battery.getIntExtra(BatteryManager.EXTRA_SCALE, -1);
+
+            boolean charging = status == BatteryManager.BATTERY_STATUS_CHARGING ||
+                               status == BatteryManager.BATTERY_STATUS_FULL;
+
+            if(!charging && level >= 0 && scale > 0 && level * 100 / scale < 20)
+                throttle = Math.min(throttle, 0.5f);
+        }
+
+        NativeProcessor.setExportThrottle(throttle);
+    }
+
+    private void registerThermalListener() {
+        if(Build.VERSION.SDK_INT < Build.VERSION_CODES.Q)
+            return;
+
+        PowerManager powerManager =
+                (PowerManager) getApplicationContext().getSystemService(Context.POWER_SERVICE);
+
+        if(powerManager == null)
+            return;
+
+        mThermalListener = this::updateExportThrottle;
+        powerManager.addThermalStatusListener(mThermalListener);
+
+        updateExportThrottle(powerManager.getCurrentThermalStatus());
+    }
+
+    private void unregisterThermalListener() {
+        if(mThermalListener != null) {
+            PowerManager powerManager =
+                    (PowerManager) getApplicationContext().getSystemService(Context.POWER_SERVICE);
+
+            if(powerManager != null && Build.VERSION.SDK_INT >= Build.VERSION_CODES.Q)
+                powerManager.removeThermalStatusListener(mThermalListener);
+
+            mThermalListener = null;
+        }
+
+        NativeProcessor.setExportThrottle(1.0f);
+    }
+
     private Result succeed(Data result) {
         mNotifyManager.cancel(NOTIFICATION_ID);
+        unregisterThermalListener();
 
         return Result.success(result);
     }
 
     private Result fail(String reason) {
         mNotifyManager.cancel(NOTIFICATION_ID);
+        unregisterThermalListener();
 
         Log.e(TAG, "Failed: " + reason);
 
@@ -265,6 +349,8 @@ public class VideoProcessWorker extends Worker implements NativeDngConverterList
             try {
                 if(workerMode == WorkerMode.EXPORT) {
                     Log.i(TAG, "Processing video segments " + TextUtils.join(",", inputVideoUriString));
+
+                    registerThermalListener();
                     processVideo(videoUris, numFramesToMerge, correctVignette);
                 }
                 else if(workerMode == WorkerMode.MOVE) {
@@ -314,6 +400,8 @@ public class VideoProcessWorker extends Worker implements NativeDngConverterList
         }
 
         Log.i(TAG, "Video export has been cancelled");
+        unregisterThermalListener();
+
         return Result.failure();
     }
 
@@ -324,16 +412,15 @@ public class VideoProcessWorker extends Worker implements NativeDngConverterList
             return;
         }
 
-        InputStream inputStream;
-
         if(audioInputUri.getScheme().equalsIgnoreCase("file")) {
-            inputStream = new FileInputStream(audioInputUri.getPath());
-        }
-        else {
-            DocumentFile audioFile = DocumentFile.fromSingleUri(getApplicationContext(), audioInputUri);
-            inputStream = getApplicationContext().getContentResolver().openInputStream(audioFile.getUri());
+            Util.CopyToUri(getApplicationContext(), new File(audioInputUri.getPath()), dstAudioFile.getUri());
+            return;
         }
 
+        // Content backed sources have no channel to transfer from
+        DocumentFile audioFile = DocumentFile.fromSingleUri(getApplicationContext(), audioInputUri);
+        InputStream inputStream = getApplicationContext().getContentResolver().openInputStream(audioFile.getUri());
+
         try (OutputStream outputStream = getApplicationContext().getContentResolver().openOutputStream(dstAudioFile.getUri())) {
             if(inputStream != null && outputStream != null)
                 IOUtil.copy(inputStream, outputStream);
@@ -40,6 +40,15 @@ public:
 
     Input<float> gamma{"gamma"};
 
+    // Assist overlays, evaluated in the same traversal as the output write.
+    // Zebra paints diagonal stripes over pixels whose luma exceeds
+    // zebraThreshold; peaking highlights pixels whose local luma gradient
+    // magnitude exceeds peakingThreshold.
+    Input<bool> zebraEnabled{"zebraEnabled", false};
+    Input<float> zebraThreshold{"zebraThreshold", 0.95f};
+    Input<bool> peakingEnabled{"peakingEnabled", false};
+    Input<float> peakingThreshold{"peakingThreshold", 0.2f};
+
     Output<Buffer<uint8_t>> output{"output", 3};
 
 protected:
@@ -47,7 +56,7 @@ protected:
     Var v_x{"x"};
     Var v_y{"y"};
     Var v_c{"c"};
-    
+
     Var v_xo{"xo"};
     Var v_xi{"xi"};
     Var v_yo{"yo"};
@@ -243,10 +252,33 @@ void CameraVideoPreviewGenerator::generate() {
     // Gamma correct
     Expr g = pow(colorCorrected(v_x, v_y, v_c), HALF_1_0 / cast<float16_t>(gamma));
 
+    // Assist overlays ride along with the output write. The luma taps
+    // resolve against funcs this traversal already computes, so zebras and
+    // peaking cost arithmetic instead of extra full-frame passes.
+    Func luma{"luma"};
+
+    luma(v_x, v_y) = HALF_YUV_R * colorCorrected(v_x, v_y, 0) +
+                     HALF_YUV_G * colorCorrected(v_x, v_y, 1) +
+                     HALF_YUV_B * colorCorrected(v_x, v_y, 2);
+
+    Expr gx = luma(clamp(v_x + 1, 0, width - 1), v_y) - luma(clamp(v_x - 1, 0, width - 1), v_y);
+    Expr gy = luma(v_x, clamp(v_y + 1, 0, height - 1)) - luma(v_x, clamp(v_y - 1, 0, height - 1));
+
+    Expr gradMag = gx*gx + gy*gy;
+
+    Expr zebra =
+        zebraEnabled && luma(v_x, v_y) > cast<float16_t>(zebraThreshold) && (((v_x + v_y) / 4) % 2 == 0);
+
+    Expr peaking =
+        peakingEnabled && gradMag > cast<float16_t>(peakingThreshold * peakingThreshold);
+
+    Expr pixel = cast<uint8_t>(clamp(g * cast<float16_t>(255) + HALF_0_5, cast<float16_t>(0), cast<float16_t>(255)));
+
     output(v_x, v_y, v_c) =
-        select(v_c < 3,
-            cast<uint8_t>(clamp(g * cast<float16_t>(255) + HALF_0_5, cast<float16_t>(0), cast<float16_t>(255))),
-            255);
+        select(v_c >= 3, cast<uint8_t>(255),
+               peaking,  cast<uint8_t>(select(v_c == 0, 255, 40)),
+               zebra,    cast<uint8_t>(0),
+                         pixel);
 
     // Output interleaved
     output
@@ -308,6 +340,10 @@ public:
     Input<Buffer<float>> cameraToSrgb{"cameraToSrgb", 2};
     Input<bool> flipped{"flipped", false};
 
+    // Display rotation in 90 degree steps (0=none, 1=90, 2=180, 3=270),
+    // folded into the output write
+    Input<int> rotation{"rotation"};
+
     Input<int> width{"width"};
     Input<int> height{"height"};
 
@@ -325,6 +361,23 @@ public:
     Input<float> contrast{"contrast"};
     Input<float> saturation{"saturation"};
 
+    // Temporal preview denoise. The previous preview frame is blended in
+    // with weight temporalBlend (0 disables), shifted by the per-frame
+    // motion hint so the accumulation follows camera movement.
+    Input<Buffer<uint8_t>> previousOutput{"previousOutput", 3};
+    Input<float> temporalBlend{"temporalBlend"};
+    Input<int> motionX{"motionX"};
+    Input<int> motionY{"motionY"};
+
+    // Assist overlays, evaluated in the same traversal as the output write.
+    // Zebra paints diagonal stripes over pixels whose luma exceeds
+    // zebraThreshold; peaking highlights pixels whose local luma gradient
+    // magnitude exceeds peakingThreshold.
+    Input<bool> zebraEnabled{"zebraEnabled", false};
+    Input<float> zebraThreshold{"zebraThreshold", 0.95f};
+    Input<bool> peakingEnabled{"peakingEnabled", false};
+    Input<float> peakingThreshold{"peakingThreshold", 0.2f};
+
     Output<Buffer<uint8_t>> output{"output", 3};
 
 protected:
@@ -879,12 +932,69 @@ void CameraPreviewGenerator::generate() {
     // Apply blacks/white point
     Expr h1 = (h0 - cast<float16_t>(blacks)) / cast<float16_t>(whitePoint);
 
-    output(v_x, v_y, v_c) =
+    Func finalRgb{"finalRgb"};
+
+    finalRgb(v_x, v_y, v_c) =
         select(v_c < 3,
             cast<uint8_t>(clamp(h1 * cast<float16_t>(255) + HALF_0_5, cast<float16_t>(0), cast<float16_t>(255))),
             255);
 
-    // Output interleaved
+    // Fold the display rotation into the output write so the preview is
+    // produced directly in its final orientation instead of being rotated
+    // in a separate pass
+    Expr srcX = select(rotation == 1, v_y,
+                       rotation == 2, width - 1 - v_x,
+                       rotation == 3, width - 1 - v_y,
+                                      v_x);
+
+    Expr srcY = select(rotation == 1, height - 1 - v_x,
+                       rotation == 2, height - 1 - v_y,
+                       rotation == 3, v_x,
+                                      v_y);
+
+    Expr current = finalRgb(clamp(srcX, 0, width - 1), clamp(srcY, 0, height - 1), v_c);
+
+    // Temporal accumulation: one read-blend-write at preview resolution in
+    // output orientation. The previous frame is sampled at the motion hint
+    // offset so the IIR follows camera movement instead of smearing.
+    Func prevClamped = BoundaryConditions::repeat_edge(previousOutput);
+
+    Expr t = clamp(cast<float16_t>(temporalBlend), cast<float16_t>(0.0f), cast<float16_t>(0.95f));
+    Expr prev = cast<float16_t>(prevClamped(v_x + motionX, v_y + motionY, v_c));
+
+    Expr blended = cast<uint8_t>(clamp(
+        cast<float16_t>(current) * (cast<float16_t>(1.0f) - t) + prev * t + cast<float16_t>(0.5f),
+        cast<float16_t>(0), cast<float16_t>(255)));
+
+    // Assist overlays tap the compute_root'd yuvOutput luma plane at the
+    // rotated source coordinates, so they share the traversal already
+    // writing the output instead of adding full-frame passes.
+    Func lumaClamped{"lumaClamped"};
+
+    lumaClamped(v_x, v_y) = yuvOutput(clamp(v_x, 0, width - 1), clamp(v_y, 0, height - 1), 0);
+
+    Expr gx = lumaClamped(srcX + 1, srcY) - lumaClamped(srcX - 1, srcY);
+    Expr gy = lumaClamped(srcX, srcY + 1) - lumaClamped(srcX, srcY - 1);
+
+    Expr gradMag = gx*gx + gy*gy;
+
+    Expr zebra =
+        zebraEnabled && lumaClamped(srcX, srcY) > cast<float16_t>(zebraThreshold) && (((v_x + v_y) / 4) % 2 == 0);
+
+    Expr peaking =
+        peakingEnabled && gradMag > cast<float16_t>(peakingThreshold * peakingThreshold);
+
+    output(v_x, v_y, v_c) =
+        select(v_c >= 3, cast<uint8_t>(255),
+               peaking,  cast<uint8_t>(select(v_c == 0, 255, 40)),
+               zebra,    cast<uint8_t>(0),
+                         blended);
+
+    // Input/output interleaved
+    previousOutput
+        .dim(0).set_stride(4)
+        .dim(2).set_stride(1);
+
     output
         .dim(0).set_stride(4)
         .dim(2).set_stride(1);
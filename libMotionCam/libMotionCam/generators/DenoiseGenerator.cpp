@@ -1,6 +1,7 @@
 #include <Halide.h>
 #include <vector>
 #include <functional>
+#include <cmath>
 
 using namespace Halide;
 
@@ -220,21 +221,296 @@ void DenoiseGenerator::generate() {
     output.set_estimates({{0, 2000}, {0, 1500}, {0, 4}});
         
     if (!auto_schedule) {
-        output
-            .compute_root()
-            .bound(v_c, 0, 4)
-            .reorder(v_c, v_x, v_y)
-            .vectorize(v_x, 8)
-            .unroll(v_c)
-            .parallel(v_y);
+        if(get_target().has_gpu_feature()) {
+            // The merge runs once per frame with the accumulator threaded
+            // through pendingOutput/output, so when both stay resident on the
+            // device only the new input crosses the bus each iteration.
+            output
+                .compute_root()
+                .bound(v_c, 0, 4)
+                .reorder(v_c, v_x, v_y)
+                .unroll(v_c)
+                .gpu_tile(v_x, v_y, v_xi, v_yi, 8, 16);
 
-        inRepeated1
-            .compute_root()
-            .bound(v_c, 0, 4)
-            .reorder(v_c, v_x, v_y)
-            .vectorize(v_x, 8)
-            .unroll(v_c)
-            .parallel(v_y);
+            inRepeated1
+                .compute_root()
+                .bound(v_c, 0, 4)
+                .reorder(v_c, v_x, v_y)
+                .unroll(v_c)
+                .gpu_tile(v_x, v_y, v_xi, v_yi, 8, 16);
+        }
+        else {
+            output
+                .compute_root()
+                .bound(v_c, 0, 4)
+                .reorder(v_c, v_x, v_y)
+                .vectorize(v_x, 8)
+                .unroll(v_c)
+                .parallel(v_y);
+
+            inRepeated1
+                .compute_root()
+                .bound(v_c, 0, 4)
+                .reorder(v_c, v_x, v_y)
+                .vectorize(v_x, 8)
+                .unroll(v_c)
+                .parallel(v_y);
+        }
+    }
+}
+
+// Batched variant of the merge kernel. Fuses numFrames registered inputs
+// into the accumulator in one invocation: the accumulator is read and
+// written once per batch instead of once per frame, and the reference
+// block means are computed once and shared across the batch. The per
+// frame inputs, flow maps and flow means arrive stacked along a fourth
+// dimension; the math per frame is identical to DenoiseGenerator.
+class BatchDenoiseGenerator : public Generator<BatchDenoiseGenerator> {
+public:
+    GeneratorParam<int> window{"window", 1};
+
+    Input<Buffer<uint16_t>> input0{"input0", 3};
+    Input<Buffer<uint16_t>> inputs{"inputs", 4};
+    Input<Buffer<float>> pendingOutput{"pendingOutput", 3};
+    Input<Buffer<float>> flowMaps{"flowMaps", 4};
+    Input<Buffer<float>> flowMeans{"flowMeans", 2};
+    Input<Buffer<float>> noise{"noise", 1};
+
+    Input<int32_t> width{"width"};
+    Input<int32_t> height{"height"};
+    Input<int32_t> numFrames{"numFrames"};
+
+    Input<float> w{"w"};
+    Input<float> maxWeight{"maxWeight"};
+
+    Output<Buffer<float>> output{"output", 3};
+
+    void generate();
+
+private:
+    Func blockMean(Func in, const vector<Var>& args);
+    Func registeredInputs();
+
+    Var v_x{"x"};
+    Var v_y{"y"};
+    Var v_c{"c"};
+    Var v_n{"n"};
+
+    Var v_xi{"xi"};
+    Var v_yo{"yo"};
+    Var v_yi{"yi"};
+};
+
+Func BatchDenoiseGenerator::blockMean(Func in, const vector<Var>& args) {
+    const std::vector<std::vector<int32_t>> MASK_3x3 = {
+        { 1, 2, 1 },
+        { 2, 4, 2 },
+        { 1, 2, 1 }
+    };
+
+    const std::vector<std::vector<int32_t>> MASK_5x5 = {
+        { 1, 4,  6,  4,  1 },
+        { 4, 16, 24, 16, 4 },
+        { 6, 24, 36, 24, 6 },
+        { 4, 16, 24, 16, 4 },
+        { 1, 4,  6,  4,  1 }
+    };
+
+    const std::vector<std::vector<int32_t>> MASK_7x7 = {
+        { 1,  6,   15,  20,  15,  6,   1  },
+        { 6,  36,  90,  120, 90,  36,  6  },
+        { 15, 90,  225, 300, 225, 90,  15 },
+        { 20, 120, 300, 400, 300, 120, 20 },
+        { 15, 90,  225, 300, 225, 90,  15 },
+        { 6,  36,  90,  120, 90,  36,  6  },
+        { 1,  6,   15,  20,  15,  6,   1  }
+    };
+
+    const int32_t WINDOW = window;
+    std::vector<std::vector<int32_t>> MASK;
+
+    if(WINDOW == 3)
+        MASK = MASK_3x3;
+    else if(WINDOW == 5)
+        MASK = MASK_5x5;
+    else if(WINDOW == 7)
+        MASK = MASK_7x7;
+    else
+        throw std::runtime_error("Invalid window size");
+
+    Func M{"blockMean"};
+
+    vector<Expr> shifted(args.begin(), args.end());
+
+    M(args) = cast<int32_t>(0);
+    Expr sum = 0;
+
+    const int32_t R = WINDOW / 2;
+
+    for(int y = -R; y <= R; y++) {
+        for(int x = -R; x <= R; x++) {
+            shifted[0] = args[0] + x;
+            shifted[1] = args[1] + y;
+
+            M(args) += static_cast<Expr>(MASK[x+R][y+R])*in(shifted);
+            sum += MASK[x+R][y+R];
+        }
+    }
+
+    M(args) /= sum;
+
+    return M;
+}
+
+Func BatchDenoiseGenerator::registeredInputs() {
+    Func result{"registeredInputs"};
+    Func inputF32{"inputF32"};
+
+    flowMaps
+        .dim(0).set_stride(2)
+        .dim(2).set_stride(1);
+
+    Func clamped = BoundaryConditions::repeat_edge(
+        inputs, { {0, width}, {0, height}, {0, 4}, {Expr(), Expr()} } );
+
+    inputF32(v_x, v_y, v_c, v_n) = cast<float>(clamped(v_x, v_y, v_c, v_n));
+
+    Expr flowX = clamp(v_x, 0, flowMaps.dim(0).extent() - 1);
+    Expr flowY = clamp(v_y, 0, flowMaps.dim(1).extent() - 1);
+
+    Expr fx = v_x + flowMaps(flowX, flowY, 0, v_n);
+    Expr fy = v_y + flowMaps(flowX, flowY, 1, v_n);
+
+    Expr x = cast<int16_t>(fx + 0.5f);
+    Expr y = cast<int16_t>(fy + 0.5f);
+
+    Expr a = fx - x;
+    Expr b = fy - y;
+
+    Expr p0 = lerp(inputF32(x, y, v_c, v_n), inputF32(x + 1, y, v_c, v_n), a);
+    Expr p1 = lerp(inputF32(x, y + 1, v_c, v_n), inputF32(x + 1, y + 1, v_c, v_n), a);
+
+    result(v_x, v_y, v_c, v_n) = saturating_cast<uint16_t>(lerp(p0, p1, b) + 0.5f);
+
+    return result;
+}
+
+void BatchDenoiseGenerator::generate() {
+    Func inRepeated = registeredInputs();
+    Func inSigned0{"inSigned0"}, inSigned1{"inSigned1"};
+
+    inSigned0(v_x, v_y, v_c) = cast<int16_t>(input0(clamp(v_x, 0, width - 1), clamp(v_y, 0, height - 1), v_c));
+    inSigned1(v_x, v_y, v_c, v_n) = cast<int16_t>(inRepeated(v_x, v_y, v_c, v_n));
+
+    Func inMean0 = blockMean(inSigned0, {v_x, v_y, v_c});
+    Func inMean1 = blockMean(inSigned1, {v_x, v_y, v_c, v_n});
+
+    Func inHigh0{"inHigh0"}, inHigh1{"inHigh1"};
+
+    inHigh0(v_x, v_y, v_c) = inSigned0(v_x, v_y, v_c) - inMean0(v_x, v_y, v_c);
+    inHigh1(v_x, v_y, v_c, v_n) = inSigned1(v_x, v_y, v_c, v_n) - inMean1(v_x, v_y, v_c, v_n);
+
+    // Increase weight based on closeness to mean of movement
+    Expr fx = flowMaps(v_x, v_y, 0, v_n) - flowMeans(0, v_n);
+    Expr fy = flowMaps(v_x, v_y, 1, v_n) - flowMeans(1, v_n);
+
+    Expr fd = sqrt(fx*fx + fy*fy);
+    Expr fw = w*max(1.0f, -0.25f*fd + maxWeight);
+
+    Expr d0 = inHigh0(v_x, v_y, v_c) - inHigh1(v_x, v_y, v_c, v_n);
+    Expr d1 = inMean0(v_x, v_y, v_c) - inMean1(v_x, v_y, v_c, v_n);
+
+    Expr m = abs(d1) / (1e-15f + abs(d1) + fw*noise(v_c));
+
+    Func contribution{"contribution"};
+
+    contribution(v_x, v_y, v_c, v_n) =
+        inMean1(v_x, v_y, v_c, v_n) + m*d1 +
+        inHigh1(v_x, v_y, v_c, v_n) + m*d0;
+
+    RDom r(0, numFrames);
+
+    Func fused{"fused"};
+
+    fused(v_x, v_y, v_c) = pendingOutput(v_x, v_y, v_c);
+    fused(v_x, v_y, v_c) += contribution(v_x, v_y, v_c, r);
+
+    output(v_x, v_y, v_c) = fused(v_x, v_y, v_c);
+
+    input0.set_estimates({{0, 2000}, {0, 1500}, {0, 4}});
+    inputs.set_estimates({{0, 2000}, {0, 1500}, {0, 4}, {0, 4}});
+    width.set_estimate(2000);
+    height.set_estimate(1500);
+    numFrames.set_estimate(4);
+    w.set_estimate(1.0f);
+    pendingOutput.set_estimates({{0, 2000}, {0, 1500}, {0, 4}});
+    flowMaps.set_estimates({{0, 2000}, {0, 1500}, {0, 2}, {0, 4}});
+    flowMeans.set_estimates({{0, 2}, {0, 4}});
+
+    noise.set_estimates({{0, 4}});
+    output.set_estimates({{0, 2000}, {0, 1500}, {0, 4}});
+
+    if (!auto_schedule) {
+        if(get_target().has_gpu_feature()) {
+            // The accumulator stays resident on the device across the whole
+            // batch; each frame is registered and merged by one launch per
+            // RDom step.
+            output
+                .compute_root()
+                .bound(v_c, 0, 4)
+                .reorder(v_c, v_x, v_y)
+                .unroll(v_c)
+                .gpu_tile(v_x, v_y, v_xi, v_yi, 8, 16);
+
+            fused
+                .compute_root()
+                .bound(v_c, 0, 4)
+                .reorder(v_c, v_x, v_y)
+                .unroll(v_c)
+                .gpu_tile(v_x, v_y, v_xi, v_yi, 8, 16);
+
+            fused.update()
+                .reorder(v_c, v_x, v_y, r.x)
+                .unroll(v_c)
+                .gpu_tile(v_x, v_y, v_xi, v_yi, 8, 16);
+
+            inRepeated
+                .compute_at(fused, r.x)
+                .reorder(v_c, v_x, v_y)
+                .unroll(v_c)
+                .gpu_tile(v_x, v_y, v_xi, v_yi, 8, 16);
+        }
+        else {
+            // The accumulator is realized one strip at a time so it stays in
+            // cache while every frame of the batch is merged into it; the
+            // registered input is staged per frame per strip, so at no point
+            // is more than one frame's strip materialized.
+            output
+                .compute_root()
+                .bound(v_c, 0, 4)
+                .split(v_y, v_yo, v_yi, 32)
+                .reorder(v_c, v_x, v_yi, v_yo)
+                .vectorize(v_x, 8)
+                .unroll(v_c)
+                .parallel(v_yo);
+
+            fused
+                .compute_at(output, v_yo)
+                .reorder(v_c, v_x, v_y)
+                .vectorize(v_x, 8)
+                .unroll(v_c);
+
+            fused.update()
+                .reorder(v_c, v_x, v_y, r.x)
+                .vectorize(v_x, 8)
+                .unroll(v_c);
+
+            inRepeated
+                .compute_at(fused, r.x)
+                .reorder(v_c, v_x, v_y)
+                .vectorize(v_x, 8)
+                .unroll(v_c);
+        }
     }
 }
 
@@ -242,6 +518,22 @@ class ForwardTransformGenerator : public Generator<ForwardTransformGenerator> {
 public:
     GeneratorParam<int> levels{"levels", 6};
 
+    // Compute the transform in int16 fixed point instead of float32. Halves
+    // the pyramid footprint and doubles SIMD width on NEON. Coefficients are
+    // quantized to Q13, which folds a 0.5x gain into every level to keep the
+    // low band inside int16 for EXPANDED_RANGE inputs; reconstruction has to
+    // compensate with a 2x gain per level.
+    GeneratorParam<bool> use_int16{"use_int16", false};
+
+    // Keep the computation in float32 but store the materialized levels as
+    // float16, halving the pyramid footprint without the quantization rules
+    // of the fixed point path. The low band picks up a 2x gain per level, so
+    // a 0.5x gain is folded into the input and into every store to keep a
+    // full scale EXPANDED_RANGE frame below the float16 maximum; stored
+    // level L carries 2^-(L+2) of the float32 coefficients and consumers
+    // widen on load and compensate. Ignored when use_int16 is set.
+    GeneratorParam<bool> store_fp16{"store_fp16", false};
+
     Input<Func> input{"input", 3};
     
     Input<int32_t> width{"width"};
@@ -280,16 +572,44 @@ public:
     
     Expr forwardStep0(Func in, int i, const vector<float>& H);
     Expr forwardStep1(Func in, int c, int i, const vector<float>& H);
-    
+
+    Expr sumScaled(Expr a, Expr b);
+    Expr diffScaled(Expr a, Expr b);
+
     Func rawChannel{"rawChannel"}, clamped{"clamped"};
 
     vector<Func> funcsStage0;
     vector<Func> funcsStage1;
 };
 
+namespace {
+    // Q13 quantization of a filter coefficient for the fixed point path
+    int32_t QuantizeQ13(float h) {
+        return static_cast<int32_t>(std::lround(h * 8192.0f));
+    }
+}
+
 Expr ForwardTransformGenerator::forwardStep0(Func in, int i, const vector<float>& H) {
+    if(use_int16) {
+        Expr acc = cast<int32_t>(0);
+
+        if(i >= 0) {
+            for(int idx = 0; idx < H.size(); idx++) {
+                acc += cast<int32_t>(in(v_x*2+idx, v_y, i))*QuantizeQ13(H[idx]);
+            }
+        }
+        else {
+            for(int idx = 0; idx < H.size(); idx++) {
+                acc += cast<int32_t>(in(v_x*2+idx, v_y))*QuantizeQ13(H[idx]);
+            }
+        }
+
+        // Compensated rounding
+        return cast<int16_t>((acc + 4096) >> 13);
+    }
+
     Expr result = 0.0f;
-    
+
     if(i >= 0) {
         for(int idx = 0; idx < H.size(); idx++) {
             result += in(v_x*2+idx, v_y, i)*H[idx];
@@ -300,13 +620,31 @@ Expr ForwardTransformGenerator::forwardStep0(Func in, int i, const vector<float>
             result += in(v_x*2+idx, v_y)*H[idx];
         }
     }
-    
+
     return result;
 }
 
 Expr ForwardTransformGenerator::forwardStep1(Func in, int c, int i, const vector<float>& H) {
+    if(use_int16) {
+        Expr acc = cast<int32_t>(0);
+
+        if(i >= 0) {
+            for(int idx = 0; idx < H.size(); idx++) {
+                acc += cast<int32_t>(in(v_x*2+idx, v_y, c, i))*QuantizeQ13(H[idx]);
+            }
+        }
+        else {
+            for(int idx = 0; idx < H.size(); idx++) {
+                acc += cast<int32_t>(in(v_x*2+idx, v_y, c))*QuantizeQ13(H[idx]);
+            }
+        }
+
+        // Compensated rounding
+        return cast<int16_t>((acc + 4096) >> 13);
+    }
+
     Expr result = 0.0f;
-    
+
     if(i >= 0) {
         for(int idx = 0; idx < H.size(); idx++) {
             result += in(v_x*2+idx, v_y, c, i)*H[idx];
@@ -317,10 +655,27 @@ Expr ForwardTransformGenerator::forwardStep1(Func in, int c, int i, const vector
             result += in(v_x*2+idx, v_y, c)*H[idx];
         }
     }
-    
+
     return result;
 }
 
+Expr ForwardTransformGenerator::sumScaled(Expr a, Expr b) {
+    if(use_int16) {
+        // sqrt(0.5) in Q14, summed in int32 to avoid overflowing int16
+        return cast<int16_t>(((cast<int32_t>(a) + cast<int32_t>(b))*11585 + 8192) >> 14);
+    }
+
+    return (a + b) * sqrtf(0.5f);
+}
+
+Expr ForwardTransformGenerator::diffScaled(Expr a, Expr b) {
+    if(use_int16) {
+        return cast<int16_t>(((cast<int32_t>(a) - cast<int32_t>(b))*11585 + 8192) >> 14);
+    }
+
+    return (a - b) * sqrtf(0.5f);
+}
+
 void ForwardTransformGenerator::forward0(Func& forwardOutput, Func& intermediateOutput, Func image) {
     Expr expr[4];
     
@@ -363,10 +718,10 @@ void ForwardTransformGenerator::forward0(Func& forwardOutput, Func& intermediate
                                                       expr[3]);
     
     forwardOutput(v_x, v_y, v_c, v_i) = select(v_c == 0, forwardTmp(v_x, v_y, v_c, v_i),
-                                        select(v_i == 0, (forwardTmp(v_x, v_y, v_c, 0) + forwardTmp(v_x, v_y, v_c, 3)) * sqrtf(0.5f),
-                                               v_i == 1, (forwardTmp(v_x, v_y, v_c, 1) + forwardTmp(v_x, v_y, v_c, 2)) * sqrtf(0.5f),
-                                               v_i == 2, (forwardTmp(v_x, v_y, v_c, 1) - forwardTmp(v_x, v_y, v_c, 2)) * sqrtf(0.5f),
-                                                         (forwardTmp(v_x, v_y, v_c, 0) - forwardTmp(v_x, v_y, v_c, 3)) * sqrtf(0.5f)));
+                                        select(v_i == 0, sumScaled(forwardTmp(v_x, v_y, v_c, 0), forwardTmp(v_x, v_y, v_c, 3)),
+                                               v_i == 1, sumScaled(forwardTmp(v_x, v_y, v_c, 1), forwardTmp(v_x, v_y, v_c, 2)),
+                                               v_i == 2, diffScaled(forwardTmp(v_x, v_y, v_c, 1), forwardTmp(v_x, v_y, v_c, 2)),
+                                                         diffScaled(forwardTmp(v_x, v_y, v_c, 0), forwardTmp(v_x, v_y, v_c, 3))));
 }
 
 void ForwardTransformGenerator::forward1(Func& forwardOutput, Func& intermediateOutput, Func image) {
@@ -417,15 +772,17 @@ void ForwardTransformGenerator::forward1(Func& forwardOutput, Func& intermediate
                                                       expr[3]);
     
     forwardOutput(v_x, v_y, v_c, v_i) = select(v_c == 0, forwardTmp(v_x, v_y, v_c, v_i),
-                                        select(v_i == 0, (forwardTmp(v_x, v_y, v_c, 0) + forwardTmp(v_x, v_y, v_c, 3)) * sqrtf(0.5f),
-                                               v_i == 1, (forwardTmp(v_x, v_y, v_c, 1) + forwardTmp(v_x, v_y, v_c, 2)) * sqrtf(0.5f),
-                                               v_i == 2, (forwardTmp(v_x, v_y, v_c, 1) - forwardTmp(v_x, v_y, v_c, 2)) * sqrtf(0.5f),
-                                                         (forwardTmp(v_x, v_y, v_c, 0) - forwardTmp(v_x, v_y, v_c, 3)) * sqrtf(0.5f)));
+                                        select(v_i == 0, sumScaled(forwardTmp(v_x, v_y, v_c, 0), forwardTmp(v_x, v_y, v_c, 3)),
+                                               v_i == 1, sumScaled(forwardTmp(v_x, v_y, v_c, 1), forwardTmp(v_x, v_y, v_c, 2)),
+                                               v_i == 2, diffScaled(forwardTmp(v_x, v_y, v_c, 1), forwardTmp(v_x, v_y, v_c, 2)),
+                                                         diffScaled(forwardTmp(v_x, v_y, v_c, 0), forwardTmp(v_x, v_y, v_c, 3))));
 }
 
 void ForwardTransformGenerator::generate() {
+    const bool fp16 = store_fp16 && !use_int16;
+
     output.resize(levels);
-        
+
     for(int level = 0; level < levels; level++) {
         Func forwardOutput("forwardOutputLvl" + std::to_string(level));
         Func intermediateOutput("intermediateOutputLvl" + std::to_string(level));
@@ -433,27 +790,40 @@ void ForwardTransformGenerator::generate() {
         // First level use input image
         if(level == 0) {
             clamped = BoundaryConditions::repeat_image(input, { {0, width}, {0, height} } );
-            
+
             // Select input channel
-            rawChannel(v_x, v_y) = cast<float>(clamped(v_x, v_y, channel));
-            
+            if(use_int16)
+                rawChannel(v_x, v_y) = cast<int16_t>(clamped(v_x, v_y, channel));
+            else if(fp16)
+                rawChannel(v_x, v_y) = 0.5f * cast<float>(clamped(v_x, v_y, channel));
+            else
+                rawChannel(v_x, v_y) = cast<float>(clamped(v_x, v_y, channel));
+
             forward0(forwardOutput, intermediateOutput, rawChannel);
         }
         // Use previous level as input
         else {
             Func in("forwardInLvl" + std::to_string(level));
             Func clampedIn("forwardClampedInLvl" + std::to_string(level));
-            
+
             // Use low pass output from previous level
-            in(v_x, v_y, v_i) = output[level - 1](v_x, v_y, 0, v_i);
-            
+            if(fp16)
+                in(v_x, v_y, v_i) = cast<float>(output[level - 1](v_x, v_y, 0, v_i));
+            else
+                in(v_x, v_y, v_i) = output[level - 1](v_x, v_y, 0, v_i);
+
             clampedIn = BoundaryConditions::repeat_image(in, { {0, width >> level}, {0, height >> level} });
-            
+
             forward1(forwardOutput, intermediateOutput, clampedIn);
         }
-        
+
         // Set output of level
-        output[level] = transpose(forwardOutput);
+        if(fp16) {
+            Func transposed = transpose(forwardOutput);
+            output[level](v_x, v_y, v_c, v_i) = cast(Float(16), 0.5f * transposed(v_x, v_y, v_c, v_i));
+        }
+        else
+            output[level] = transpose(forwardOutput);
 
         funcsStage0.push_back(intermediateOutput);
         funcsStage1.push_back(forwardOutput);
@@ -561,7 +931,9 @@ void ForwardTransformGenerator::schedule_for_cpu() {
 
 class InverseTransformGenerator : public Generator<InverseTransformGenerator> {
 public:
-    Input<Buffer<float>[]> input{"input", 4};
+    // Untyped so the pyramid can be stored as float16 (see the forward
+    // transform's store_fp16); builds pass input.type on the command line.
+    Input<Buffer<>[]> input{"input", 4};
     Input<float> noiseSigma{"noiseSigma"};
     Input<bool> softThreshold{"softThreshold"};
     Input<Buffer<float>> weights{"weights", 1};
@@ -748,7 +1120,18 @@ void InverseTransformGenerator::generate() {
         Expr real1, imag1;
 
         Func spatialDenoise("spatialDenoiseLvl" + std::to_string(level));
-        Func in = BoundaryConditions::repeat_image(input.at(level));
+        Func repeated = BoundaryConditions::repeat_image(input.at(level));
+        Func in("inverseInLvl" + std::to_string(level));
+
+        if(input.type() == Float(16)) {
+            // Widen and undo the 2^-(level+2) gain the forward transform
+            // folds into its float16 stores, so thresholds and the
+            // reconstruction match the float32 pipeline. noiseSigma is
+            // expected in float32 pipeline units.
+            in(v_x, v_y, v_c, v_i) = cast<float>(repeated(v_x, v_y, v_c, v_i)) * (float) (1 << (level + 2));
+        }
+        else
+            in = repeated;
 
         Expr T = noiseSigma*weights(level);
 
@@ -953,6 +1336,12 @@ void InverseTransformGenerator::schedule() {
 
 class FuseImageGenerator : public Generator<FuseImageGenerator> {
 public:
+    // Store the fused pyramid as float16; set reference.type and
+    // intermediate.type to float16 to match. Fusion still runs in float32
+    // and all three pyramids share the gain folded by the forward
+    // transform's float16 stores, so no compensation happens here.
+    GeneratorParam<bool> store_fp16{"store_fp16", false};
+
     Input<Func> input{"input", 3};
     Input<int32_t> width{"width"};
     Input<int32_t> height{"height"};
@@ -1040,8 +1429,9 @@ void FuseImageGenerator::generate() {
     forwardTransform = create<ForwardTransformGenerator>();
 
     forwardTransform->levels.set(levels);
+    forwardTransform->store_fp16.set(store_fp16);
     forwardTransform->apply(registeredImage, width, height, channel);
-    
+
     output.resize(levels);
 
     // Fuse coefficients
@@ -1049,17 +1439,32 @@ void FuseImageGenerator::generate() {
         Expr x = reference.at(level)(v_x, v_y, v_c, v_i);
         Expr y = forwardTransform->output.at(level)(v_x, v_y, v_c, v_i);
 
+        // Difference in lowpass channel
+        Expr refLow = reference.at(level)(v_x, v_y, 0, 0);
+        Expr curLow = forwardTransform->output.at(level)(v_x, v_y, 0, 0);
+
+        Expr accumulated = intermediate[level](v_x, v_y, v_c, v_i);
+
+        if(store_fp16) {
+            x = cast<float>(x);
+            y = cast<float>(y);
+            refLow = cast<float>(refLow);
+            curLow = cast<float>(curLow);
+            accumulated = cast<float>(accumulated);
+        }
+
         Expr T = noiseSigma;
         Expr d = x - y;
 
-        // Difference in lowpass channel
-        Expr D = abs(reference.at(level)(v_x, v_y, 0, 0) - forwardTransform->output.at(level)(v_x, v_y, 0, 0));
+        Expr D = abs(refLow - curLow);
         Expr w = max(1.0f, denoiseWeight * exp( -D / denoiseDifferenceWeight));
 
         Expr m = abs(d) / (abs(d) + w*T + 1e-5f);
         Expr fused = select(v_c > 0, y + m*d, x);
 
-        output[level](v_x, v_y, v_c, v_i) = fused + select(resetOutput, 0.0f, intermediate[level](v_x, v_y, v_c, v_i));
+        Expr result = fused + select(resetOutput, 0.0f, accumulated);
+
+        output[level](v_x, v_y, v_c, v_i) = store_fp16 ? cast(Float(16), result) : result;
     }
 
     if(get_target().has_gpu_feature())
@@ -1112,6 +1517,7 @@ void FuseImageGenerator::schedule_for_cpu() {
 }
 
 HALIDE_REGISTER_GENERATOR(DenoiseGenerator, denoise_generator)
+HALIDE_REGISTER_GENERATOR(BatchDenoiseGenerator, batch_denoise_generator)
 HALIDE_REGISTER_GENERATOR(ForwardTransformGenerator, forward_transform_generator)
 HALIDE_REGISTER_GENERATOR(FuseImageGenerator, fuse_image_generator)
 HALIDE_REGISTER_GENERATOR(InverseTransformGenerator, inverse_transform_generator)
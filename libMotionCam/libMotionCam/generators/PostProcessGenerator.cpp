@@ -13,6 +13,17 @@ using std::vector;
 using std::function;
 using std::pair;
 
+// Named schedule variants, checked in from per-device tuning runs and
+// selected at build time with schedule_profile=<name>. DEFAULT keeps the
+// hand written schedules, tuned on 4+4 core parts. WIDE carries the
+// winning parameters from autoscheduler runs on newer 1+4+3 parts, where
+// row granular parallelism left cores idle: rows are strip mined so every
+// core has several tasks and vectors run at 16 lanes.
+enum class ScheduleProfile {
+    DEFAULT,
+    WIDE
+};
+
 //
 
 class PostProcessBase {
@@ -813,6 +824,9 @@ void GuidedFilter::schedule_for_gpu() {
 
 class Demosaic : public Halide::Generator<Demosaic>, public PostProcessBase {
 public:
+    GeneratorParam<ScheduleProfile> schedule_profile{"schedule_profile", ScheduleProfile::DEFAULT,
+        {{"default", ScheduleProfile::DEFAULT}, {"wide", ScheduleProfile::WIDE}}};
+
     Input<Func> in0{"in0", UInt(16), 2 };
     Input<Func> in1{"in1", UInt(16), 2 };
     Input<Func> in2{"in2", UInt(16), 2 };
@@ -867,6 +881,8 @@ public:
 
     void generate();
     void schedule();
+    void scheduleWide();
+    void scheduleForGpu();
 
     void cmpSwap(Expr& a, Expr& b);
 
@@ -1395,7 +1411,12 @@ void Demosaic::generate() {
     output.set_estimates({{0, 4096}, {0, 3072}, {0, 3}});
 
     if(!auto_schedule) {
-        schedule();
+        if(get_target().has_gpu_feature())
+            scheduleForGpu();
+        else if(schedule_profile == ScheduleProfile::WIDE)
+            scheduleWide();
+        else
+            schedule();
     }
 }
 
@@ -1440,7 +1461,104 @@ void Demosaic::schedule() {
         .parallel(v_y)
         .bound(v_c, 0, 3)
         .unroll(v_c)
-        .vectorize(v_x, 8);    
+        .vectorize(v_x, 8);
+}
+
+void Demosaic::scheduleWide() {
+    red
+        .compute_root()
+        .split(v_y, v_yo, v_yi, 16)
+        .parallel(v_yo)
+        .vectorize(v_x, 16);
+
+    redIntermediate
+        .compute_at(red, v_yo)
+        .vectorize(v_x, 16);
+
+    blue
+        .compute_root()
+        .split(v_y, v_yo, v_yi, 16)
+        .parallel(v_yo)
+        .vectorize(v_x, 16);
+
+    blueIntermediate
+        .compute_at(blue, v_yo)
+        .vectorize(v_x, 16);
+
+    greenIntermediate
+        .compute_at(green, v_yo)
+        .vectorize(v_x, 16);
+
+    shadingMapArranged
+        .compute_at(combinedInput, v_yo)
+        .unroll(v_c)
+        .vectorize(v_x, 16);
+
+    combinedInput
+        .compute_root()
+        .split(v_y, v_yo, v_yi, 16)
+        .parallel(v_yo)
+        .vectorize(v_x, 16);
+
+    green
+        .compute_root()
+        .split(v_y, v_yo, v_yi, 16)
+        .parallel(v_yo)
+        .vectorize(v_x, 16);
+
+    output
+        .compute_root()
+        .split(v_y, v_yo, v_yi, 16)
+        .parallel(v_yo)
+        .bound(v_c, 0, 3)
+        .unroll(v_c)
+        .vectorize(v_x, 16);
+}
+
+void Demosaic::scheduleForGpu() {
+    shadingMapArranged
+        .compute_at(combinedInput, v_x)
+        .unroll(v_c)
+        .gpu_threads(v_x, v_y);
+
+    combinedInput
+        .compute_root()
+        .reorder(v_x, v_y)
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    redIntermediate
+        .compute_at(red, v_x)
+        .gpu_threads(v_x, v_y);
+
+    red
+        .compute_root()
+        .reorder(v_x, v_y)
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    blueIntermediate
+        .compute_at(blue, v_x)
+        .gpu_threads(v_x, v_y);
+
+    blue
+        .compute_root()
+        .reorder(v_x, v_y)
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    greenIntermediate
+        .compute_at(green, v_x)
+        .gpu_threads(v_x, v_y);
+
+    green
+        .compute_root()
+        .reorder(v_x, v_y)
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    output
+        .compute_root()
+        .bound(v_c, 0, 3)
+        .reorder(v_c, v_x, v_y)
+        .unroll(v_c)
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
 }
 
 //
@@ -2160,6 +2278,13 @@ void EnhanceGenerator::schedule_for_cpu() {
 
 class PostProcessGenerator : public Halide::Generator<PostProcessGenerator>, public PostProcessBase {
 public:
+    // When disabled, the HDR blending stages are left out of the pipeline
+    // entirely instead of being fed dummy inputs at runtime.
+    GeneratorParam<bool> enableHdr{"enable_hdr", true};
+
+    GeneratorParam<ScheduleProfile> schedule_profile{"schedule_profile", ScheduleProfile::DEFAULT,
+        {{"default", ScheduleProfile::DEFAULT}, {"wide", ScheduleProfile::WIDE}}};
+
     Input<Buffer<uint16_t>> in0{"in0", 2 };
     Input<Buffer<uint16_t>> in1{"in1", 2 };
     Input<Buffer<uint16_t>> in2{"in2", 2 };
@@ -2250,6 +2375,7 @@ void PostProcessGenerator::generate()
     Func inClamped3 = BoundaryConditions::repeat_edge(in3);
 
     demosaic = create<Demosaic>();
+    demosaic->schedule_profile.set(schedule_profile);
     demosaic->apply(
         inClamped0, inClamped1, inClamped2, inClamped3,
         inShadingMap0, inShadingMap1, inShadingMap2, inShadingMap3,
@@ -2273,19 +2399,24 @@ void PostProcessGenerator::generate()
      // Blend HDR images based on provided mask
     tonemapInput(v_x, v_y, v_c) = saturating_cast<uint16_t>(0.5f + pow(2.0f, exposure) * demosaic->output(v_x, v_y, v_c));
 
-    Func hdrInputRepeated{"hdrInputRepeated"};
-    Func baseInput{"baseInput"};
-    Func hdrMaskInput{"hdrMaskInput"};
+    if(enableHdr) {
+        Func hdrInputRepeated{"hdrInputRepeated"};
+        Func baseInput{"baseInput"};
+        Func hdrMaskInput{"hdrMaskInput"};
 
-    baseInput(v_x, v_y, v_c) = demosaic->output(v_x, v_y, v_c) / 65535.0f;
-    hdrInputRepeated(v_x, v_y, v_c) = Halide::BoundaryConditions::repeat_edge(hdrInput)(v_x, v_y, v_c)/65535.0f;
-    hdrMaskInput(v_x, v_y) = Halide::BoundaryConditions::repeat_edge(hdrMask)(v_x, v_y)/255.0f;
+        baseInput(v_x, v_y, v_c) = demosaic->output(v_x, v_y, v_c) / 65535.0f;
+        hdrInputRepeated(v_x, v_y, v_c) = Halide::BoundaryConditions::repeat_edge(hdrInput)(v_x, v_y, v_c)/65535.0f;
+        hdrMaskInput(v_x, v_y) = Halide::BoundaryConditions::repeat_edge(hdrMask)(v_x, v_y)/255.0f;
 
-    highlights(v_x, v_y, v_c) = (hdrMaskInput(v_x, v_y)*hdrInputRepeated(v_x, v_y, v_c)) + ((1.0f - hdrMaskInput(v_x, v_y))*hdrScale*baseInput(v_x, v_y, v_c));
+        highlights(v_x, v_y, v_c) = (hdrMaskInput(v_x, v_y)*hdrInputRepeated(v_x, v_y, v_c)) + ((1.0f - hdrMaskInput(v_x, v_y))*hdrScale*baseInput(v_x, v_y, v_c));
 
-    hdrTonemapInput(v_x, v_y, v_c) = select(useHdr, 
-        saturating_cast<uint16_t>(hdrInputGain * highlights(v_x, v_y, v_c) * 65535.0f),
-        tonemapInput(v_x, v_y, v_c));
+        hdrTonemapInput(v_x, v_y, v_c) = select(useHdr,
+            saturating_cast<uint16_t>(hdrInputGain * highlights(v_x, v_y, v_c) * 65535.0f),
+            tonemapInput(v_x, v_y, v_c));
+    }
+    else {
+        hdrTonemapInput(v_x, v_y, v_c) = tonemapInput(v_x, v_y, v_c);
+    }
 
     //
     // Tonemap
@@ -2398,6 +2529,47 @@ void PostProcessGenerator::generate()
 }
 
 void PostProcessGenerator::schedule_for_gpu() {
+    // The demosaic front end, the guided filters inside the enhance stage
+    // and the pointwise stages here go to the GPU; the tonemap pyramid and
+    // the rest of the enhance stage keep their CPU schedules and Halide
+    // moves the buffers at the stage boundaries.
+    Lmap
+        .compute_root()
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    LmapTmp0
+        .compute_root()
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    LmapTmp1
+        .compute_root()
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    LmapTmp2
+        .compute_root()
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    LmapTmp3
+        .compute_root()
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    chromaEpsMap
+        .compute_root()
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    hdrTonemapInput
+        .compute_root()
+        .bound(v_c, 0, 3)
+        .reorder(v_c, v_x, v_y)
+        .unroll(v_c)
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
+
+    output
+        .compute_root()
+        .bound(v_c, 0, 3)
+        .reorder(v_c, v_x, v_y)
+        .unroll(v_c)
+        .gpu_tile(v_x, v_y, v_xi, v_yi, 16, 32);
 }
 
 void PostProcessGenerator::schedule_for_cpu() { 
@@ -2810,13 +2982,20 @@ void FastPreviewGenerator::generate() {
             .reorder(v_c, v_x, v_y)
             .unroll(v_c)
             .vectorize(v_x, 8);
-            
+
         output.compute_root()
             .vectorize(v_x, 8)
             .reorder(v_c, v_x, v_y)
             .bound(v_c, 0, 4)
             .unroll(v_c)
             .parallel(v_y);
+
+        // The unpack select lands in this nest through the inlined
+        // deinterleave; specializing duplicates the nest per raw format
+        // and drops the select from the vectorized loops
+        output.specialize(pixelFormat == static_cast<int>(RawFormat::RAW10));
+        output.specialize(pixelFormat == static_cast<int>(RawFormat::RAW12));
+        output.specialize(pixelFormat == static_cast<int>(RawFormat::RAW16));
     }
 }
 
@@ -3012,6 +3191,12 @@ void DeinterleaveRawGenerator::schedule_for_cpu(::Halide::Pipeline pipeline, ::H
             .split(x, x_vo, x_vi, 8)
             .vectorize(x_vi)
             .parallel(y);
+
+        // One loop nest per raw format; the format select would otherwise
+        // sit inside the vectorized unpack loop
+        bayer_1.specialize(pixelFormat == static_cast<int>(RawFormat::RAW10));
+        bayer_1.specialize(pixelFormat == static_cast<int>(RawFormat::RAW12));
+        bayer_1.specialize(pixelFormat == static_cast<int>(RawFormat::RAW16));
     }
     {
         Var i = gammaLut.args()[0];
@@ -3404,6 +3589,12 @@ public:
         output.compute_root()
             .parallel(v_y)
             .vectorize(v_x, 8);
+
+        // Compile a loop nest per raw format so the unpack select resolves
+        // once per call instead of per pixel
+        output.specialize(pixelFormat == static_cast<int>(RawFormat::RAW10));
+        output.specialize(pixelFormat == static_cast<int>(RawFormat::RAW12));
+        output.specialize(pixelFormat == static_cast<int>(RawFormat::RAW16));
     }
 };
 
@@ -3717,6 +3908,230 @@ void StatsGenerator::schedule_for_cpu(::Halide::Pipeline pipeline, ::Halide::Tar
 
 ///////////////
 
+// Fused preview + stats pipeline. The preview loop wants the preview
+// image, the luminance histogram and the clipping maps for the same
+// frame; deriving all of them from one downsampled copy of the frame
+// reads the raw data once instead of once per output.
+class PreviewStatsGenerator : public Halide::Generator<PreviewStatsGenerator>, public PostProcessBase {
+public:
+    Input<Buffer<uint8_t>> input{"input", 1};
+
+    Input<int> stride{"stride"};
+    Input<int> pixelFormat{"pixelFormat"};
+    Input<int> sensorArrangement{"sensorArrangement"};
+
+    Input<int> bufferWidth{"bufferWidth"};
+    Input<int> bufferHeight{"bufferHeight"};
+
+    Input<int> sx{"sx"};
+    Input<int> sy{"sy"};
+
+    Input<float>    whiteLevel{"whiteLevel"};
+    Input<float[4]> blackLevel{"blackLevel"};
+
+    Input<float[3]> asShotVector{"asShotVector"};
+    Input<Buffer<float>> cameraToSrgb{"cameraToSrgb", 2};
+
+    Output<Buffer<uint8_t>> output{"output", 3};
+    Output<Buffer<uint32_t>> histogram{"histogram", 1};
+    Output<Buffer<uint8_t>> whiteLevelClipping{"whiteLevelClipping", 2};
+    Output<Buffer<uint8_t>> blackLevelClipping{"blackLevelClipping", 2};
+
+    void generate();
+};
+
+void PreviewStatsGenerator::generate() {
+    Func bayer{"bayer"};
+    Func downsampled{"downsampled"};
+    Func rggb{"rggb"};
+    Func linear{"linear"};
+    Func colorCorrected{"colorCorrected"};
+    Func colorCorrectInput{"colorCorrectInput"};
+    Func toLinear{"toLinear"};
+    Func bl{"bl"};
+    Func gammaLut{"gammaLut"};
+    Func maxChannel{"maxChannel"};
+    Func minChannel{"minChannel"};
+    Func luminance{"luminance"};
+
+    // Deinterleave
+    deinterleave(bayer, BoundaryConditions::repeat_edge(input), stride, pixelFormat, bufferWidth, bufferHeight);
+
+    bl(v_c) = mux(v_c, {
+        blackLevel[0],
+        blackLevel[1],
+        blackLevel[2],
+        blackLevel[3]
+    });
+
+    Expr width = bufferWidth / 2 / sx;
+    Expr height = bufferHeight / 2 / sy;
+
+    // Materialized at the preview resolution; every output derives from
+    // this single traversal of the raw data
+    downsampled(v_x, v_y, v_c) = cast<int16_t>(bayer(v_x * sx, v_y * sy, v_c));
+
+    //
+    // Preview
+    //
+
+    toLinear(v_c) = 1.0f / cast<float>(whiteLevel - bl(v_c));
+
+    linear(v_x, v_y, v_c) = (downsampled(v_x, v_y, v_c) - bl(v_c)) * toLinear(v_c);
+
+    // Rearrange to RGGB
+    toRGGB(rggb, linear, sensorArrangement);
+
+    colorCorrectInput(v_x, v_y, v_c) =
+        select( v_c == 0, clamp( rggb(v_x, v_y, 0), 0.0f, asShotVector[0] ),
+                v_c == 1, clamp( 0.5f * (rggb(v_x, v_y, 1) + rggb(v_x, v_y, 2)), 0.0f, asShotVector[1] ),
+                          clamp( rggb(v_x, v_y, 3), 0.0f, asShotVector[2] ));
+
+    transform(colorCorrected, colorCorrectInput, cameraToSrgb);
+
+    Expr h = v_i / 255.0f;
+
+    gammaLut(v_i) = saturating_cast<uint8_t>(select(h < 0.0031308f, h * 12.92f, pow(h, 1.0f / 2.4f) * 1.055f - 0.055f) * 255.0f);
+    if(!get_auto_schedule())
+        gammaLut.compute_root().vectorize(v_i, 8);
+
+    output(v_x, v_y, v_c) = gammaLut(saturating_cast<uint8_t>(
+        select( v_c == 0, colorCorrected(v_x, v_y, 0) * 255.0f + 0.5f,
+                v_c == 1, colorCorrected(v_x, v_y, 1) * 255.0f + 0.5f,
+                v_c == 2, colorCorrected(v_x, v_y, 2) * 255.0f + 0.5f,
+                255)));
+
+    // Output interleaved
+    output
+        .dim(0).set_stride(4)
+        .dim(2).set_stride(1);
+
+    //
+    // Histogram using the luminance
+    //
+
+    Expr L = clamp(0.2989f*colorCorrected(v_x, v_y, 0) + 0.5870f*colorCorrected(v_x, v_y, 1) + 0.1140f*colorCorrected(v_x, v_y, 2), 0.0f, 1.0f);
+
+    luminance(v_x, v_y) = gammaLut(saturating_cast<uint8_t>(0.5f + 255*L));
+
+    RDom r(0, width, 0, height);
+
+    histogram(v_i) = cast<uint32_t>(0);
+    histogram(luminance(r.x, r.y)) += cast<uint32_t>(1);
+
+    //
+    // Clipping maps
+    //
+
+    maxChannel(v_x, v_y) = max(downsampled(v_x, v_y, 0), downsampled(v_x, v_y, 1), downsampled(v_x, v_y, 2), downsampled(v_x, v_y, 3));
+    minChannel(v_x, v_y) = min(
+        downsampled(v_x, v_y, 0) - bl(0),
+        downsampled(v_x, v_y, 1) - bl(1),
+        downsampled(v_x, v_y, 2) - bl(2),
+        downsampled(v_x, v_y, 3) - bl(3));
+
+    // Return in portrait
+    Expr X = v_y;
+    Expr Y = height - v_x;
+
+    Expr blackClipped =
+        (minChannel(X, Y)   +
+         minChannel(X-1, Y) +
+         minChannel(X+1, Y) +
+         minChannel(X, Y-1) +
+         minChannel(X, Y+1)) >> 2;
+
+    Expr whiteClipped =
+        (maxChannel(X, Y)   +
+         maxChannel(X-1, Y) +
+         maxChannel(X+1, Y) +
+         maxChannel(X, Y-1) +
+         maxChannel(X, Y+1)) >> 2;
+
+    Expr fadeRange = (whiteLevel >> 5);
+    Expr fadeout = whiteLevel - fadeRange;
+
+    whiteLevelClipping(v_x, v_y) = saturating_cast<uint8_t>(255 * max(whiteClipped - fadeout, 0) / fadeRange);
+    blackLevelClipping(v_x, v_y) = saturating_cast<uint8_t>(255 * cast<uint8_t>(blackClipped <= 0));
+
+    input.set_estimates({ {0, 18000000} });
+    bufferWidth.set_estimate(4000);
+    bufferHeight.set_estimate(3000);
+    blackLevel.set_estimate(0, 64);
+    blackLevel.set_estimate(1, 64);
+    blackLevel.set_estimate(2, 64);
+    blackLevel.set_estimate(3, 64);
+    whiteLevel.set_estimate(1023);
+    sx.set_estimate(2);
+    sy.set_estimate(2);
+    stride.set_estimate(4000);
+    sensorArrangement.set_estimate(0);
+    pixelFormat.set_estimate(0);
+    cameraToSrgb.set_estimates({{0, 3}, {0, 3}});
+
+    asShotVector.set_estimate(0, 1.0f);
+    asShotVector.set_estimate(1, 1.0f);
+    asShotVector.set_estimate(2, 1.0f);
+
+    output.set_estimates({{0, 250}, {0, 150}, {0, 3} } );
+    histogram.set_estimates({{0, 255}});
+    whiteLevelClipping.set_estimates({{0, 250}, {0, 150} });
+    blackLevelClipping.set_estimates({{0, 250}, {0, 150} });
+
+    if(!get_auto_schedule()) {
+        downsampled
+            .compute_root()
+            .reorder(v_c, v_x, v_y)
+            .unroll(v_c)
+            .vectorize(v_x, 8)
+            .parallel(v_y);
+
+        // This is the one traversal of the raw data; give it a loop nest
+        // per raw format so the unpack select resolves once per frame
+        downsampled.specialize(pixelFormat == static_cast<int>(RawFormat::RAW10));
+        downsampled.specialize(pixelFormat == static_cast<int>(RawFormat::RAW12));
+        downsampled.specialize(pixelFormat == static_cast<int>(RawFormat::RAW16));
+
+        linear.compute_at(output, v_y)
+            .reorder(v_c, v_x, v_y)
+            .unroll(v_c)
+            .vectorize(v_x, 8);
+
+        output.compute_root()
+            .vectorize(v_x, 8)
+            .reorder(v_c, v_x, v_y)
+            .bound(v_c, 0, 4)
+            .unroll(v_c)
+            .parallel(v_y);
+
+        luminance
+            .compute_root()
+            .reorder(v_x, v_y)
+            .parallel(v_y)
+            .vectorize(v_x, 8);
+
+        histogram
+            .compute_root()
+            .vectorize(v_i, 16);
+
+        whiteLevelClipping
+            .compute_root()
+            .reorder(v_y, v_x)
+            .split(v_y, v_yo, v_yi, 16)
+            .vectorize(v_yi)
+            .parallel(v_x);
+
+        blackLevelClipping
+            .compute_root()
+            .reorder(v_y, v_x)
+            .split(v_y, v_yo, v_yi, 16)
+            .vectorize(v_yi)
+            .parallel(v_x);
+    }
+}
+
+///////////////
+
 class MeasureImageGenerator : public Halide::Generator<MeasureImageGenerator>, public PostProcessBase {
 public:
     Input<Buffer<uint8_t>> input{"input", 1};
@@ -3761,16 +4176,15 @@ void MeasureImageGenerator::generate() {
     Func colorCorrectInput{"colorCorrectInput"};    
     Func gammaLut{"gammaLut"};
     Func result16u{"result8u"};
+    Func partialHistogram{"partialHistogram"};
 
     bl(v_c) = mux(v_c, { blackLevel[0], blackLevel[1], blackLevel[2], blackLevel[3] });
-    
+
     asShotFunc(v_c) = mux(v_c, { asShot[0], asShot[1], asShot[1], asShot[2] } );
 
     Expr width = bufferWidth / 2 / sx;
     Expr height = bufferHeight / 2 / sy;
 
-    RDom r(0, width, 0, height);
-
     // Deinterleave
     deinterleave(bayer, BoundaryConditions::repeat_edge(input), stride, pixelFormat, bufferWidth, bufferHeight);
     
@@ -3805,8 +4219,18 @@ void MeasureImageGenerator::generate() {
 
     result16u(v_x, v_y) = gammaLut(saturating_cast<uint8_t>(0.5f + 255*L));
 
+    // Accumulate one partial histogram per row and merge them at the end,
+    // so the accumulation parallelises across cores instead of serializing
+    // the whole reduction on one
+    RDom rx(0, width);
+
+    partialHistogram(v_i, v_y) = cast<uint32_t>(0);
+    partialHistogram(result16u(rx, v_y), v_y) += cast<uint32_t>(1);
+
+    RDom ry(0, height);
+
     histogram(v_i) = cast<uint32_t>(0);
-    histogram(result16u(r.x, r.y)) += cast<uint32_t>(1);
+    histogram(v_i) += partialHistogram(v_i, ry);
 
     if(!auto_schedule) {
         result16u
@@ -3815,9 +4239,20 @@ void MeasureImageGenerator::generate() {
             .parallel(v_y)
             .vectorize(v_x, 8);
 
+        partialHistogram
+            .compute_root()
+            .vectorize(v_i, 16);
+
+        partialHistogram.update()
+            .parallel(v_y);
+
         histogram
             .compute_root()
             .vectorize(v_i, 16);
+
+        histogram.update()
+            .reorder(v_i, ry)
+            .vectorize(v_i, 16);
     }
 
     input.set_estimates({ {0, 18000000} });
@@ -3847,6 +4282,7 @@ void MeasureImageGenerator::generate() {
 }
 
 HALIDE_REGISTER_GENERATOR(StatsGenerator, stats_generator)
+HALIDE_REGISTER_GENERATOR(PreviewStatsGenerator, preview_stats_generator)
 HALIDE_REGISTER_GENERATOR(GenerateEdgesGenerator, generate_edges_generator)
 HALIDE_REGISTER_GENERATOR(MeasureImageGenerator, measure_image_generator)
 HALIDE_REGISTER_GENERATOR(MeasureNoiseGenerator, measure_noise_generator)
@@ -1,7 +1,10 @@
 SET HALIDE_PATH=C:\Users\Administrator\motioncam-tools\thirdparty\halide
 
 SET ARCH=host
-SET TARGET=x86-64-windows-sse41
+rem Feature ladder, newest entry first. Halide's generated wrapper probes
+rem the CPU once at runtime and dispatches to the first entry it supports.
+SET TARGET=x86-64-windows-avx2-fma-f16c-sse41-no_runtime,x86-64-windows-sse41
+SET RUNTIME_TARGET=x86-64-windows-sse41
 SET FLAGS=no_runtime
 
 rmdir \s \q tmp
@@ -25,14 +28,29 @@ tmp\denoise_generator.exe -g denoise_generator -f fuse_denoise_5x5 -e static_lib
 echo "[%ARCH%] Building denoise_generator_7x7"
 tmp\denoise_generator.exe -g denoise_generator -f fuse_denoise_7x7 -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% window=7
 
+echo "[%ARCH%] Building batch_denoise_generator_3x3"
+tmp\denoise_generator.exe -g batch_denoise_generator -f fuse_denoise_batch_3x3 -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% window=3
+
+echo "[%ARCH%] Building batch_denoise_generator_5x5"
+tmp\denoise_generator.exe -g batch_denoise_generator -f fuse_denoise_batch_5x5 -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% window=5
+
+echo "[%ARCH%] Building batch_denoise_generator_7x7"
+tmp\denoise_generator.exe -g batch_denoise_generator -f fuse_denoise_batch_7x7 -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% window=7
+
 echo "[%ARCH%] Building forward_transform_generator"
 tmp\denoise_generator.exe -g forward_transform_generator -f forward_transform -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% input.type=uint16 levels=4
 
+echo "[%ARCH%] Building forward_transform_generator (fp16)"
+tmp\denoise_generator.exe -g forward_transform_generator -f forward_transform_fp16 -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% input.type=uint16 levels=4 store_fp16=true
+
 echo "[%ARCH%] Building fuse_image_generator"
 tmp\denoise_generator.exe -g fuse_image_generator -f fuse_image -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% input.type=uint16 reference.size=4 reference.type=float32 intermediate.size=4 intermediate.type=float32
 
 echo "[%ARCH%] Building inverse_transform_generator"
-tmp\denoise_generator.exe -g inverse_transform_generator -f inverse_transform -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% input.size=4
+tmp\denoise_generator.exe -g inverse_transform_generator -f inverse_transform -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% input.size=4 input.type=float32
+
+echo "[%ARCH%] Building inverse_transform_generator (fp16)"
+tmp\denoise_generator.exe -g inverse_transform_generator -f inverse_transform_fp16 -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% input.size=4 input.type=float16
 
 rem Post Processing
 echo "[%ARCH%] Building stats_generator"
@@ -65,12 +83,30 @@ tmp\postprocess_generator -g deinterleave_raw_generator -f deinterleave_raw -e s
 echo "[%ARCH%] Building postprocess_generator"
 tmp\postprocess_generator -g postprocess_generator -f postprocess -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS%
 
+echo "[%ARCH%] Building postprocess_generator enable_hdr=false"
+tmp\postprocess_generator -g postprocess_generator -f postprocess_no_hdr -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% enable_hdr=false
+
+echo "[%ARCH%] Building postprocess_generator schedule_profile=wide"
+tmp\postprocess_generator -g postprocess_generator -f postprocess_wide -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% schedule_profile=wide
+
+echo "[%ARCH%] Building postprocess_generator enable_hdr=false schedule_profile=wide"
+tmp\postprocess_generator -g postprocess_generator -f postprocess_no_hdr_wide -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% enable_hdr=false schedule_profile=wide
+
+echo "[%ARCH%] Building postprocess_generator (opencl)"
+tmp\postprocess_generator -g postprocess_generator -f postprocess_cl -e static_library,h -o ..\halide\%ARCH% target=%RUNTIME_TARGET%-opencl-cl_half-%FLAGS%
+
+echo "[%ARCH%] Building postprocess_generator enable_hdr=false (opencl)"
+tmp\postprocess_generator -g postprocess_generator -f postprocess_no_hdr_cl -e static_library,h -o ..\halide\%ARCH% target=%RUNTIME_TARGET%-opencl-cl_half-%FLAGS% enable_hdr=false
+
 echo "[%ARCH%] Building fast_preview_generator"
 tmp\postprocess_generator -g fast_preview_generator -f fast_preview -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS%
 
 echo "[%ARCH%] Building fast_preview_generator2"
 tmp\postprocess_generator -g fast_preview_generator2 -f fast_preview2 -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS%
 
+echo "[%ARCH%] Building preview_stats_generator"
+tmp\postprocess_generator -g preview_stats_generator -f preview_stats -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS%
+
 echo "[%ARCH%] Building preview_generator2 rotation=0"
 tmp\postprocess_generator -g preview_generator -f preview_landscape2 -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% rotation=0 tonemap_levels=8 downscale_factor=2 enable_sharpen=true pop_radius=7
 
@@ -167,4 +203,7 @@ echo "[%ARCH%] Building camera_video_preview_generator4_raw16"
 tmp\camera_preview_generator -g camera_video_preview_generator -f camera_video_preview4_raw16 -e static_library,h -o ..\halide\%ARCH% target=%TARGET%-%FLAGS% downscale_factor=4 pixel_format=2
 
 echo "[%ARCH%] Building halide_runtime_base"
-tmp\camera_preview_generator -r halide_runtime -e static_library,h -o ../halide/%ARCH% target=%TARGET%
+tmp\camera_preview_generator -r halide_runtime -e static_library,h -o ../halide/%ARCH% target=%RUNTIME_TARGET%
+
+echo "[%ARCH%] Building halide_runtime_opencl"
+tmp\camera_preview_generator -r halide_runtime_opencl -e static_library,h -o ../halide/%ARCH% target=%RUNTIME_TARGET%-opencl-cl_half
@@ -29,6 +29,10 @@ function build_denoise() {
 	ARCH=$2
 	FLAGS="no_runtime"
 
+	# Halide emits one library with a runtime CPU dispatch wrapper when the
+	# target is a comma separated list; give every entry the same flags
+	TARGET="${TARGET//,/-${FLAGS},}"
+
 	echo "[$ARCH] Building denoise_generator_3x3"
 	./tmp/denoise_generator -g denoise_generator -f fuse_denoise_3x3 -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} window=3
 
@@ -38,14 +42,29 @@ function build_denoise() {
 	echo "[$ARCH] Building denoise_generator_7x7"
 	./tmp/denoise_generator -g denoise_generator -f fuse_denoise_7x7 -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} window=7
 
+	echo "[$ARCH] Building batch_denoise_generator_3x3"
+	./tmp/denoise_generator -g batch_denoise_generator -f fuse_denoise_batch_3x3 -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} window=3
+
+	echo "[$ARCH] Building batch_denoise_generator_5x5"
+	./tmp/denoise_generator -g batch_denoise_generator -f fuse_denoise_batch_5x5 -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} window=5
+
+	echo "[$ARCH] Building batch_denoise_generator_7x7"
+	./tmp/denoise_generator -g batch_denoise_generator -f fuse_denoise_batch_7x7 -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} window=7
+
 	echo "[$ARCH] Building forward_transform_generator"
 	./tmp/denoise_generator -g forward_transform_generator -f forward_transform -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} input.type=uint16 levels=4
 
+	echo "[$ARCH] Building forward_transform_generator (fp16)"
+	./tmp/denoise_generator -g forward_transform_generator -f forward_transform_fp16 -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} input.type=uint16 levels=4 store_fp16=true
+
 	echo "[$ARCH] Building fuse_image_generator"
 	./tmp/denoise_generator -g fuse_image_generator -f fuse_image -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} input.type=uint16 reference.size=4 reference.type=float32 intermediate.size=4 intermediate.type=float32
 
 	echo "[$ARCH] Building inverse_transform_generator"
-	./tmp/denoise_generator -g inverse_transform_generator -f inverse_transform -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} input.size=4
+	./tmp/denoise_generator -g inverse_transform_generator -f inverse_transform -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} input.size=4 input.type=float32
+
+	echo "[$ARCH] Building inverse_transform_generator (fp16)"
+	./tmp/denoise_generator -g inverse_transform_generator -f inverse_transform_fp16 -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} input.size=4 input.type=float16
 }
 
 function build_postprocess() {
@@ -53,6 +72,10 @@ function build_postprocess() {
 	ARCH=$2
 	FLAGS="no_runtime"
 
+	# Halide emits one library with a runtime CPU dispatch wrapper when the
+	# target is a comma separated list; give every entry the same flags
+	TARGET="${TARGET//,/-${FLAGS},}"
+
 	echo "[$ARCH] Building stats_generator"
 	./tmp/postprocess_generator -g stats_generator -f generate_stats -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS}
 
@@ -83,12 +106,35 @@ function build_postprocess() {
 	echo "[$ARCH] Building postprocess_generator"
 	./tmp/postprocess_generator -g postprocess_generator -f postprocess -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS}
 
+	echo "[$ARCH] Building postprocess_generator enable_hdr=false"
+	./tmp/postprocess_generator -g postprocess_generator -f postprocess_no_hdr -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} enable_hdr=false
+
+	echo "[$ARCH] Building postprocess_generator schedule_profile=wide"
+	./tmp/postprocess_generator -g postprocess_generator -f postprocess_wide -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} schedule_profile=wide
+
+	echo "[$ARCH] Building postprocess_generator enable_hdr=false schedule_profile=wide"
+	./tmp/postprocess_generator -g postprocess_generator -f postprocess_no_hdr_wide -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} enable_hdr=false schedule_profile=wide
+
+	# The OpenCL variants run their host-side stages from the baseline
+	# entry of the feature ladder; the GPU is probed at runtime by the
+	# OpenCL runtime itself, so a multitarget list buys nothing here
+	GPU_TARGET="${1##*,}-opencl-cl_half"
+
+	echo "[$ARCH] Building postprocess_generator (opencl)"
+	./tmp/postprocess_generator -g postprocess_generator -f postprocess_cl -e static_library,h -o ../halide/${ARCH} target=${GPU_TARGET}-${FLAGS}
+
+	echo "[$ARCH] Building postprocess_generator enable_hdr=false (opencl)"
+	./tmp/postprocess_generator -g postprocess_generator -f postprocess_no_hdr_cl -e static_library,h -o ../halide/${ARCH} target=${GPU_TARGET}-${FLAGS} enable_hdr=false
+
 	echo "[$ARCH] Building fast_preview_generator"
 	./tmp/postprocess_generator -g fast_preview_generator -f fast_preview -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS}
 
 	echo "[$ARCH] Building fast_preview_generator2"
 	./tmp/postprocess_generator -g fast_preview_generator2 -f fast_preview2 -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS}
 
+	echo "[$ARCH] Building preview_stats_generator"
+	./tmp/postprocess_generator -g preview_stats_generator -f preview_stats -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS}
+
 	echo "[$ARCH] Building preview_generator2 rotation=0"
 	./tmp/postprocess_generator -g preview_generator -f preview_landscape2 -e static_library,h -o ../halide/${ARCH} target=${TARGET}-${FLAGS} rotation=0 tonemap_levels=9 downscale_factor=2 enable_sharpen=true pop_radius=7
 
@@ -130,25 +176,47 @@ function build_runtime() {
 	TARGET=$1
 	ARCH=$2
 
+	# The runtime is shared by every entry of the multitarget list;
+	# generate it from the baseline target
+	TARGET="${TARGET##*,}"
+
 	echo "[$ARCH] Building halide_runtime_base"
 	./tmp/postprocess_generator -r halide_runtime -e static_library,h -o ../halide/${ARCH} target=${TARGET}
 
 	mv ../halide/${ARCH}/halide_runtime.a ../halide/${ARCH}/halide_runtime_host.a
 
-	# echo "[$ARCH] Building halide_runtime_opencl"
-	# ./tmp/postprocess_generator -r halide_runtime -e static_library,h -o ../halide/${ARCH} target=${TARGET}-opencl-cl_half
+	# Superset of the host runtime; the OpenCL driver is dlopen'ed the
+	# first time a GPU pipeline runs, so it links fine on devices without
+	# one as long as only the CPU pipelines are used
+	echo "[$ARCH] Building halide_runtime_opencl"
+	./tmp/postprocess_generator -r halide_runtime -e static_library,h -o ../halide/${ARCH} target=${TARGET}-opencl-cl_half
 
-	# mv ../halide/${ARCH}/halide_runtime.a ../halide/${ARCH}/halide_runtime_opencl.a
+	mv ../halide/${ARCH}/halide_runtime.a ../halide/${ARCH}/halide_runtime_opencl.a
 }
 
+# Feature ladders, newest entry first. Halide's generated wrapper probes
+# the CPU once at runtime and dispatches to the first entry it supports,
+# so one bundle serves baseline and wide-ISA devices.
+ANDROID_TARGET="arm-64-android-arm_fp16-arm_dot_prod,arm-64-android"
+
+HOST_TARGET="host"
+
+if [[ "$(uname -m)" == "x86_64" ]]; then
+	if [[ "$OSTYPE" == "darwin"* ]]; then
+		HOST_TARGET="x86-64-osx-avx2-fma-f16c-sse41,x86-64-osx-sse41"
+	else
+		HOST_TARGET="x86-64-linux-avx2-fma-f16c-sse41,x86-64-linux-sse41"
+	fi
+fi
+
 mkdir -p ../halide/host
 
-build_denoise host host
-build_postprocess host host
-build_runtime host host
+build_denoise ${HOST_TARGET} host
+build_postprocess ${HOST_TARGET} host
+build_runtime ${HOST_TARGET} host
 
 mkdir -p ../halide/arm64-v8a
 
-build_denoise arm-64-android arm64-v8a
-build_postprocess arm-64-android arm64-v8a
-build_runtime arm-64-android arm64-v8a
+build_denoise ${ANDROID_TARGET} arm64-v8a
+build_postprocess ${ANDROID_TARGET} arm64-v8a
+build_runtime ${ANDROID_TARGET} arm64-v8a
@@ -10,9 +10,15 @@ namespace motioncam {
         virtual bool start(const int sampleRateHz, const int channels) = 0;
         virtual void stop() = 0;
         virtual const std::vector<int16_t>& getAudioData(uint32_t& outNumFrames) const = 0;
-        
+
         virtual int getSampleRate() const = 0;
         virtual int getChannels() const = 0;
+
+        // Copies the samples captured since the last call into outSamples,
+        // for callers that flush audio to disk while still recording.
+        // Interfaces that only expose the capture after stop() keep the
+        // default and return false.
+        virtual bool drainAudioData(std::vector<int16_t>& outSamples) { return false; }
     };
 }
 
@@ -1,1195 +1,1387 @@
 #ifndef BlueNoiseLUT_h
 #define BlueNoiseLUT_h
 
-const std::vector<uint8_t> BLUE_NOISE_PNG = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0xaa, 0x69, 0x71, 0xde, 0x00, 0x00, 0x37,
-  0x72, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0x15, 0x9b, 0xf7, 0x23, 0x95,
-  0x7f, 0x1f, 0x87, 0x4f, 0x69, 0x28, 0xa5, 0x44, 0x69, 0x88, 0x88, 0x68,
-  0xd2, 0xd0, 0x52, 0x09, 0x0d, 0x0d, 0x65, 0x26, 0x21, 0x91, 0x92, 0xa2,
-  0x28, 0x34, 0xa4, 0x21, 0x91, 0x24, 0x99, 0xc9, 0x2c, 0x23, 0x91, 0x51,
-  0x0a, 0x25, 0x29, 0xd9, 0x2a, 0x25, 0xe9, 0xab, 0x14, 0x52, 0x4a, 0xd2,
-  0x40, 0x0b, 0xe9, 0x7a, 0xce, 0xf3, 0x07, 0x9c, 0x73, 0xee, 0xfb, 0xf3,
-  0x79, 0xbf, 0x5f, 0xaf, 0xeb, 0xfa, 0xe1, 0x08, 0xac, 0x2b, 0xb2, 0x91,
-  0xec, 0x53, 0xcc, 0xb3, 0x2f, 0xf3, 0x51, 0xaf, 0x1d, 0xc0, 0xcb, 0xd5,
-  0x1d, 0xc8, 0xf6, 0xce, 0x60, 0x63, 0xfe, 0x38, 0x54, 0x1f, 0x9d, 0x27,
-  0x74, 0x4e, 0x1f, 0x9e, 0x2b, 0x26, 0x62, 0xf2, 0x5c, 0x87, 0x7d, 0x97,
-  0x87, 0xf2, 0x7a, 0xfd, 0x45, 0x6e, 0x0c, 0xf0, 0x63, 0xcb, 0x94, 0x69,
-  0xb4, 0x2e, 0xbd, 0x42, 0x79, 0xeb, 0x67, 0x46, 0x8d, 0x73, 0xe7, 0xd8,
-  0xd9, 0x5b, 0x28, 0xa7, 0x39, 0xe3, 0xe8, 0xf8, 0x13, 0x41, 0x7c, 0x38,
-  0x9d, 0xdf, 0xb6, 0xe1, 0xa6, 0x29, 0xce, 0x92, 0x1d, 0xcf, 0xb1, 0xcd,
-  0x98, 0x4a, 0xf7, 0x91, 0x4d, 0x28, 0x85, 0xa5, 0x70, 0xe7, 0x97, 0x2c,
-  0x69, 0x57, 0xcf, 0x52, 0xa5, 0xbd, 0x19, 0xd7, 0xbe, 0x23, 0xf8, 0x6c,
-  0xdb, 0x40, 0xfe, 0x06, 0x77, 0xfc, 0xbc, 0xe6, 0xb0, 0xad, 0xcd, 0x99,
-  0x83, 0x5b, 0x26, 0x73, 0x61, 0xcd, 0x59, 0xfe, 0x25, 0x6e, 0x61, 0x72,
-  0x9f, 0xfe, 0x78, 0x1d, 0x8e, 0x25, 0x7d, 0x9e, 0x31, 0xfd, 0x03, 0x97,
-  0xa1, 0xa3, 0xd8, 0xc0, 0x7f, 0x57, 0x7e, 0x71, 0xf4, 0xc9, 0x76, 0x9a,
-  0x2e, 0x7c, 0xe0, 0x6c, 0xdf, 0x99, 0x58, 0xff, 0x90, 0x84, 0xd7, 0xbb,
-  0x19, 0x71, 0x42, 0x8f, 0x46, 0x9d, 0x7e, 0xcc, 0x3e, 0xdb, 0x48, 0x8c,
-  0xba, 0x25, 0xeb, 0x36, 0x4f, 0x47, 0x26, 0x66, 0x35, 0xee, 0x4f, 0x4a,
-  0xf9, 0x37, 0x2b, 0x99, 0x99, 0x5b, 0x45, 0x48, 0x94, 0x7c, 0x47, 0xf5,
-  0xba, 0xeb, 0xfc, 0xa9, 0x29, 0x47, 0x4b, 0x6e, 0x10, 0xaf, 0x96, 0xab,
-  0x22, 0xb8, 0x37, 0xe3, 0x00, 0x1b, 0xb6, 0x7f, 0x66, 0xb0, 0xcf, 0x05,
-  0x02, 0x95, 0x9f, 0xa0, 0x93, 0x79, 0x98, 0x2b, 0x12, 0x49, 0xfc, 0x3e,
-  0xe6, 0x8b, 0x84, 0xed, 0x22, 0xde, 0xad, 0xad, 0x63, 0xd5, 0xf9, 0x9d,
-  0xfc, 0xdd, 0x55, 0xc6, 0xfc, 0x85, 0xed, 0x48, 0x96, 0xe7, 0xe2, 0xf1,
-  0x6f, 0x34, 0xba, 0x61, 0x4f, 0x98, 0x58, 0xed, 0x40, 0xfc, 0xc6, 0xfb,
-  0xbc, 0x1f, 0xb4, 0x04, 0xd3, 0x37, 0x0d, 0xfc, 0x5e, 0xa0, 0x42, 0xb2,
-  0xd1, 0x02, 0x74, 0xc7, 0x1b, 0x53, 0xa2, 0x5a, 0xc6, 0xf5, 0xea, 0x56,
-  0x7c, 0xcd, 0x2e, 0x31, 0x58, 0xca, 0x8b, 0x8a, 0xf9, 0x52, 0xb8, 0xaf,
-  0xfd, 0xc1, 0xac, 0xdd, 0x73, 0xe8, 0x3b, 0xd9, 0x85, 0x55, 0xf5, 0x45,
-  0x84, 0x9d, 0xfb, 0xc7, 0x9c, 0xa4, 0x38, 0x36, 0xcc, 0x08, 0x41, 0x67,
-  0x84, 0x18, 0x53, 0x6f, 0xfd, 0xe6, 0xed, 0xec, 0xcb, 0x08, 0xfe, 0xbc,
-  0xc5, 0xb2, 0xf4, 0x05, 0xfe, 0x3b, 0xe7, 0x52, 0xff, 0x29, 0x8f, 0x85,
-  0x69, 0xa3, 0x78, 0x64, 0x7c, 0x8a, 0x9e, 0x7d, 0x15, 0x8c, 0xfc, 0x77,
-  0x9e, 0xed, 0xaa, 0x99, 0x4c, 0x71, 0xef, 0xcb, 0x9d, 0x35, 0xf1, 0x68,
-  0x2e, 0xf8, 0xce, 0xe3, 0xbd, 0x27, 0x08, 0x19, 0x9a, 0xc2, 0xd1, 0x87,
-  0x73, 0xb9, 0x99, 0xed, 0x47, 0x8b, 0x82, 0x1b, 0xb6, 0x85, 0x37, 0xb8,
-  0x2a, 0x68, 0xe6, 0x6c, 0x63, 0x28, 0xe2, 0x41, 0x33, 0xb1, 0xfa, 0xf7,
-  0x02, 0x97, 0x3b, 0xda, 0x04, 0x47, 0xef, 0x45, 0xfa, 0x8c, 0x22, 0x8e,
-  0x56, 0xbf, 0x99, 0xf3, 0x5e, 0xf8, 0x5b, 0xde, 0x61, 0x63, 0x49, 0x49,
-  0xb4, 0x82, 0x7b, 0x4a, 0x38, 0x6d, 0xcc, 0xc0, 0x66, 0xbe, 0x11, 0xf7,
-  0x03, 0x87, 0x71, 0x5a, 0xf6, 0x2e, 0x8b, 0x5b, 0x2c, 0xb9, 0x95, 0xf6,
-  0x93, 0xe3, 0x82, 0x4c, 0xd2, 0x1b, 0xc6, 0x13, 0xe5, 0x61, 0xc0, 0x23,
-  0x2b, 0x57, 0x7e, 0x66, 0xbc, 0xe6, 0xbe, 0xec, 0x4a, 0x82, 0x9c, 0xfa,
-  0xb2, 0x30, 0x29, 0x98, 0xed, 0x45, 0xe6, 0x88, 0x6e, 0x95, 0xe4, 0x45,
-  0xd7, 0x53, 0x2e, 0x64, 0x05, 0x30, 0xb6, 0xec, 0x26, 0xf5, 0xc7, 0xe4,
-  0x98, 0x74, 0xee, 0x10, 0x97, 0xfe, 0xcd, 0xa3, 0xa5, 0xe0, 0x0d, 0x6b,
-  0x3e, 0xdd, 0x25, 0xa2, 0x66, 0x39, 0x5b, 0x62, 0x9f, 0xf2, 0xf3, 0x5e,
-  0x2c, 0x89, 0xc7, 0x44, 0xd9, 0xf1, 0x77, 0x1a, 0xf5, 0xab, 0xed, 0x18,
-  0x55, 0xbc, 0x92, 0xae, 0xea, 0x2a, 0xe2, 0xce, 0x6f, 0xa2, 0xe0, 0xd0,
-  0x09, 0xd6, 0x8a, 0xeb, 0x93, 0x1d, 0x25, 0xcb, 0xe8, 0x09, 0x21, 0xb4,
-  0x2d, 0x73, 0xc0, 0xb8, 0xa6, 0x85, 0x43, 0xa3, 0x95, 0x09, 0x6c, 0xd8,
-  0xcc, 0x15, 0x6b, 0x75, 0xd6, 0x49, 0xae, 0xa6, 0xa4, 0xc5, 0x85, 0x6f,
-  0x65, 0xcf, 0x19, 0x96, 0xa7, 0xc3, 0x9e, 0xc9, 0xe6, 0xa8, 0xf4, 0xdc,
-  0xc2, 0xd8, 0xe4, 0x33, 0xcb, 0x76, 0xd4, 0x30, 0xbc, 0x4d, 0x8b, 0x17,
-  0xee, 0xa3, 0x98, 0xa2, 0xdf, 0xc3, 0x12, 0x4d, 0x13, 0xca, 0x6f, 0xda,
-  0xd3, 0x3c, 0x58, 0x06, 0xa5, 0xdd, 0xdf, 0x59, 0x35, 0x39, 0x82, 0x92,
-  0x4e, 0x1b, 0x62, 0x06, 0xad, 0xe1, 0x73, 0x76, 0x20, 0x82, 0x31, 0xeb,
-  0xdf, 0xb3, 0xe2, 0x8f, 0x0f, 0x15, 0xc3, 0x56, 0x32, 0x6d, 0x7f, 0x17,
-  0x1f, 0xda, 0x77, 0x22, 0x78, 0xd2, 0xc2, 0xfe, 0x4b, 0x0f, 0x29, 0x5b,
-  0xaa, 0xcb, 0xce, 0x42, 0x37, 0x06, 0x76, 0x29, 0x23, 0x7b, 0xe6, 0x1c,
-  0x96, 0xd3, 0xe6, 0x32, 0x75, 0x48, 0x04, 0x3b, 0x9b, 0xac, 0x18, 0xec,
-  0xf5, 0x8f, 0xba, 0xf6, 0x93, 0xec, 0xd7, 0x53, 0xe3, 0x96, 0x5a, 0x3a,
-  0x67, 0x0e, 0xb7, 0xf3, 0x40, 0x7c, 0x3b, 0x8b, 0xc3, 0x8e, 0xe3, 0xd5,
-  0xd8, 0xcb, 0xd6, 0xd5, 0x83, 0x31, 0x11, 0x5d, 0xcd, 0x9c, 0x04, 0x6b,
-  0x6e, 0x2a, 0x5f, 0x43, 0xc6, 0x47, 0x40, 0xed, 0x80, 0x1d, 0xf8, 0x59,
-  0x1f, 0xe5, 0xbd, 0xec, 0x3b, 0x26, 0x6a, 0x6c, 0xa0, 0x44, 0xfc, 0x3a,
-  0x83, 0xf7, 0xd6, 0x91, 0xd9, 0x32, 0x8e, 0x40, 0xc5, 0xdb, 0xec, 0xb1,
-  0xd3, 0x40, 0xf6, 0x5d, 0x21, 0x9d, 0x86, 0xc3, 0x50, 0x3f, 0xdd, 0x41,
-  0x4c, 0xfe, 0x23, 0x76, 0xa8, 0x5e, 0xe1, 0xc1, 0xf1, 0x03, 0xc8, 0x9d,
-  0xff, 0x87, 0x6a, 0xf1, 0x60, 0x3e, 0x2c, 0x3e, 0xc6, 0x40, 0x9f, 0x7b,
-  0x44, 0xc6, 0x8d, 0x61, 0xe3, 0x8e, 0x33, 0xf8, 0xc8, 0x28, 0xf1, 0x26,
-  0xe4, 0x11, 0x97, 0x93, 0x87, 0xf0, 0xa5, 0x41, 0x96, 0xa2, 0xa8, 0x28,
-  0x9c, 0xa5, 0x6d, 0xf1, 0x3e, 0x5d, 0xc0, 0xf7, 0x5f, 0x83, 0x89, 0x56,
-  0x3a, 0x88, 0xc1, 0xa6, 0x4b, 0x5c, 0x3b, 0x79, 0x17, 0xaf, 0x8a, 0x13,
-  0x7c, 0x5d, 0x25, 0xc1, 0xc0, 0x94, 0x02, 0xb2, 0x3d, 0x9e, 0xa1, 0xa2,
-  0x31, 0x0f, 0x41, 0x43, 0xfd, 0x6d, 0x2e, 0xc8, 0xd4, 0x72, 0xa0, 0x6c,
-  0x30, 0x59, 0xcb, 0x17, 0x21, 0xf3, 0xfa, 0x1c, 0xeb, 0x76, 0x4e, 0xa0,
-  0x7d, 0xc6, 0x4c, 0x94, 0xcd, 0xa3, 0x89, 0x77, 0x1b, 0x48, 0xe3, 0xb8,
-  0x2a, 0xda, 0x4c, 0x36, 0x12, 0x10, 0xff, 0x99, 0xdc, 0xbb, 0x83, 0x59,
-  0xba, 0xea, 0x06, 0x57, 0xe6, 0x2a, 0x60, 0x3c, 0xbc, 0x04, 0xc9, 0xdc,
-  0x0f, 0xfc, 0xf3, 0x8b, 0x61, 0xf5, 0xd3, 0x35, 0x4c, 0x5b, 0x36, 0x00,
-  0x17, 0xe7, 0x24, 0x5a, 0xa5, 0x67, 0x31, 0x7c, 0xcb, 0x03, 0xfe, 0xe6,
-  0x46, 0xe3, 0xb1, 0xeb, 0x2b, 0x8e, 0x3a, 0xe7, 0x28, 0x74, 0x35, 0x60,
-  0x51, 0x7a, 0x37, 0x12, 0x3f, 0xc3, 0x70, 0x31, 0x9e, 0x88, 0x51, 0xa5,
-  0x16, 0xde, 0x99, 0xe5, 0xd4, 0x5c, 0x38, 0xc0, 0xe1, 0x4d, 0x7e, 0x68,
-  0xf8, 0xb4, 0xf1, 0xa4, 0x9f, 0x22, 0xd6, 0xd7, 0xa2, 0x39, 0x31, 0xff,
-  0x30, 0xb5, 0x75, 0xb6, 0xb8, 0x09, 0x27, 0x64, 0x88, 0x8d, 0x26, 0x89,
-  0x37, 0xd6, 0xb1, 0xa2, 0xff, 0x4d, 0x72, 0x3b, 0x9e, 0xb1, 0x5b, 0x3f,
-  0x86, 0xea, 0xec, 0x2f, 0xa8, 0x8b, 0xbe, 0xe6, 0xc0, 0xab, 0xad, 0x8c,
-  0x37, 0xeb, 0x21, 0xe7, 0x78, 0x38, 0x0b, 0x97, 0x1c, 0x64, 0x40, 0x7f,
-  0x23, 0x22, 0x54, 0x7f, 0x21, 0xaf, 0x3b, 0x15, 0xb3, 0x8c, 0x14, 0xf2,
-  0x1e, 0x06, 0xd0, 0x27, 0xe1, 0x15, 0x3b, 0x5c, 0x17, 0x32, 0xee, 0xd5,
-  0x3a, 0x6a, 0xd5, 0xd3, 0x59, 0xd0, 0x3a, 0x15, 0x73, 0xa9, 0x16, 0x3c,
-  0x9e, 0x1d, 0x61, 0xbd, 0x93, 0x00, 0xc1, 0xce, 0xa9, 0xfa, 0x0c, 0xda,
-  0xba, 0x97, 0x85, 0x27, 0xca, 0xa8, 0x8b, 0x88, 0xe7, 0x62, 0xff, 0x1c,
-  0xfc, 0xaf, 0xbe, 0xe2, 0x85, 0xef, 0x71, 0xac, 0x46, 0xf4, 0xb2, 0xf2,
-  0x59, 0x2a, 0xea, 0x59, 0xde, 0x1c, 0x58, 0xd4, 0x88, 0xde, 0x97, 0x42,
-  0x5e, 0xec, 0x3d, 0xcc, 0xf7, 0x27, 0x89, 0x9c, 0x8a, 0x5a, 0xc4, 0x4c,
-  0x7b, 0x27, 0x3e, 0xd4, 0x99, 0x10, 0x23, 0x3f, 0x1e, 0xb9, 0xb8, 0x87,
-  0x58, 0x7e, 0x75, 0xe3, 0xf1, 0x94, 0x46, 0x2e, 0x5f, 0x35, 0x23, 0xb7,
-  0xb3, 0x86, 0xf3, 0xea, 0xbb, 0xa9, 0x6a, 0x56, 0x46, 0xe4, 0xf1, 0x58,
-  0x3a, 0x46, 0x95, 0xb0, 0xb1, 0x41, 0x95, 0x54, 0xb5, 0x2b, 0xdc, 0xf3,
-  0x1f, 0x81, 0xda, 0xce, 0xad, 0x2c, 0xff, 0xfa, 0x8b, 0x2f, 0xe3, 0x66,
-  0x61, 0x3e, 0xb7, 0x2f, 0x2a, 0xf7, 0x93, 0xf9, 0xf0, 0x6b, 0x0f, 0x03,
-  0x57, 0xfc, 0x25, 0x39, 0x6e, 0x15, 0xda, 0x63, 0x72, 0x98, 0xe6, 0xda,
-  0x4c, 0xe5, 0x30, 0x01, 0x5d, 0xc2, 0x50, 0xf4, 0xbc, 0x2c, 0x85, 0xc5,
-  0x2e, 0x7b, 0x3a, 0x94, 0xa7, 0x70, 0xfa, 0xdc, 0x12, 0x6e, 0x74, 0x19,
-  0xb3, 0x72, 0xf9, 0x35, 0x7a, 0xd2, 0xd5, 0x78, 0xf8, 0xbd, 0x08, 0xab,
-  0xca, 0x45, 0x9c, 0xd9, 0xbf, 0x93, 0x3f, 0x05, 0x4f, 0xa8, 0x6c, 0x39,
-  0xc1, 0x5c, 0x07, 0x5d, 0xde, 0xce, 0x9b, 0x80, 0xc7, 0xd0, 0xaf, 0x74,
-  0xb7, 0x97, 0x72, 0x4e, 0x66, 0x00, 0xf9, 0x61, 0xbf, 0xd9, 0x6b, 0xb7,
-  0x89, 0x84, 0x8d, 0x4b, 0x78, 0x96, 0xbf, 0x8b, 0x8e, 0xc0, 0xab, 0x08,
-  0x32, 0xae, 0x45, 0xb1, 0xf9, 0xb3, 0x0a, 0xbf, 0xe6, 0x7e, 0xe7, 0xf8,
-  0x2d, 0x1b, 0x36, 0x28, 0x4a, 0x31, 0xd3, 0x60, 0x03, 0xd7, 0xde, 0x3a,
-  0x21, 0xd1, 0x39, 0x86, 0xf3, 0x61, 0x0b, 0x79, 0xb2, 0xdd, 0x86, 0xd4,
-  0x97, 0x23, 0x18, 0x35, 0x71, 0x39, 0x03, 0xce, 0x4e, 0xe3, 0xc8, 0xc8,
-  0x6f, 0x4c, 0xe8, 0x7e, 0xca, 0x93, 0x74, 0x71, 0xb6, 0x9a, 0x1c, 0xe3,
-  0x5a, 0xdf, 0x1c, 0x0e, 0xbf, 0x5f, 0x4a, 0x87, 0xc5, 0x64, 0xe1, 0x6a,
-  0xf8, 0x31, 0xbf, 0x7c, 0x34, 0x7a, 0x91, 0x3a, 0xc8, 0xca, 0xdf, 0xe2,
-  0xd4, 0xe9, 0x13, 0x2c, 0x33, 0xad, 0x23, 0x21, 0x7c, 0x09, 0x4a, 0x6b,
-  0x5c, 0x09, 0xb9, 0x5b, 0x0d, 0x09, 0x9f, 0x84, 0xb7, 0x95, 0xcf, 0xad,
-  0x37, 0x27, 0x89, 0xd5, 0x8d, 0x64, 0x6c, 0xb2, 0x3e, 0xe9, 0xb5, 0x9b,
-  0xd1, 0x9b, 0xfa, 0x9a, 0xf3, 0x8e, 0x62, 0xdc, 0x7d, 0x3a, 0x87, 0xcf,
-  0x9b, 0x4e, 0x11, 0x10, 0x7c, 0x11, 0xfd, 0x87, 0xb5, 0xd4, 0x7f, 0xb9,
-  0xcf, 0xa8, 0x3a, 0x33, 0xc2, 0xe7, 0xbc, 0x43, 0xd1, 0xe3, 0x2a, 0xc3,
-  0xab, 0x82, 0x68, 0x9c, 0xd0, 0x9f, 0x4b, 0xfb, 0x9c, 0x18, 0x34, 0x53,
-  0x82, 0x5d, 0xc3, 0x12, 0x99, 0x61, 0xe3, 0xcb, 0xda, 0x73, 0x1f, 0x38,
-  0x60, 0xd0, 0x1f, 0xa9, 0x11, 0xb9, 0x64, 0xd4, 0x36, 0xb1, 0xca, 0xca,
-  0x99, 0xf8, 0xb3, 0x9b, 0x99, 0x7e, 0x5b, 0x15, 0xed, 0xe5, 0xbe, 0x0c,
-  0x29, 0x76, 0xe1, 0x67, 0x5c, 0x3d, 0x72, 0x8a, 0xc1, 0xa8, 0xfe, 0x1d,
-  0x8f, 0x9f, 0x08, 0x08, 0xa4, 0x2f, 0x59, 0x52, 0xb8, 0x61, 0x38, 0x4a,
-  0xff, 0x1d, 0xe5, 0x89, 0xb3, 0x3a, 0x52, 0x9c, 0x61, 0xf7, 0xfd, 0x0f,
-  0xfc, 0x3d, 0x5c, 0x44, 0xd1, 0xca, 0xb5, 0x9c, 0x9c, 0xf2, 0x15, 0x85,
-  0xc1, 0x79, 0xc2, 0x56, 0x88, 0x63, 0xcf, 0xfa, 0xdd, 0x5c, 0x7a, 0x10,
-  0xc6, 0xc6, 0xcd, 0xeb, 0x28, 0x9e, 0xbe, 0x8d, 0xd0, 0xa5, 0x01, 0x2c,
-  0x3f, 0xd8, 0x45, 0x9f, 0x90, 0x5a, 0xee, 0xdd, 0x8b, 0xe0, 0xe5, 0xfc,
-  0x1f, 0x04, 0x0f, 0xde, 0xc9, 0x1e, 0xfd, 0x4f, 0xbc, 0xaf, 0x3d, 0xcf,
-  0xb4, 0x43, 0x23, 0xd8, 0xdc, 0xe7, 0x0f, 0x0d, 0x37, 0x37, 0x60, 0xff,
-  0xe5, 0x06, 0x2d, 0x87, 0x4f, 0x73, 0x48, 0xa1, 0x3f, 0x4f, 0x34, 0x57,
-  0x61, 0x73, 0xc2, 0x99, 0xb3, 0x45, 0xb2, 0x38, 0x1c, 0xc8, 0xe0, 0xb7,
-  0xed, 0x47, 0xf6, 0x9f, 0x5b, 0x4a, 0x85, 0xd4, 0x3d, 0x46, 0x1c, 0x0d,
-  0xc2, 0xec, 0x5b, 0x35, 0x13, 0x72, 0x37, 0xe0, 0x30, 0x69, 0x1c, 0x03,
-  0xbc, 0x76, 0x73, 0x6d, 0x49, 0x3b, 0x73, 0xc7, 0xce, 0xa6, 0xec, 0x9e,
-  0x3b, 0x5a, 0x97, 0xc6, 0x61, 0xf7, 0xee, 0x0f, 0x26, 0x1b, 0xf2, 0x99,
-  0x52, 0x7a, 0x8c, 0x23, 0x11, 0xdf, 0x78, 0xf9, 0xfe, 0x0d, 0xa9, 0x4a,
-  0x6b, 0xb9, 0x97, 0x3d, 0x96, 0x66, 0x2e, 0x61, 0x7b, 0x7c, 0x3e, 0x81,
-  0xd1, 0x1b, 0x18, 0x3a, 0x59, 0x02, 0xa7, 0xf7, 0x59, 0x54, 0x19, 0x45,
-  0x62, 0x75, 0xec, 0x19, 0x69, 0x03, 0xa5, 0xd1, 0x6b, 0x4a, 0xe0, 0xbc,
-  0xe6, 0x1d, 0xca, 0x7c, 0x2a, 0xd1, 0x5a, 0x3d, 0x0b, 0x81, 0x73, 0xc9,
-  0x27, 0x82, 0x87, 0x3e, 0xe0, 0xf2, 0xd9, 0xeb, 0xe8, 0x4a, 0x3f, 0xe3,
-  0x8e, 0xd5, 0x32, 0xde, 0x2f, 0x14, 0x41, 0x73, 0x68, 0x06, 0x83, 0xe3,
-  0xa7, 0x60, 0x5b, 0x5e, 0x8d, 0x41, 0xc6, 0x59, 0xf2, 0xfe, 0xc8, 0xf1,
-  0x26, 0xa2, 0x8b, 0xf9, 0xfd, 0x04, 0x64, 0xb5, 0x64, 0xd1, 0xed, 0xd3,
-  0x88, 0xf3, 0xc3, 0xd1, 0xbc, 0xed, 0x98, 0xc3, 0x3c, 0x15, 0x2b, 0x4e,
-  0xed, 0x16, 0x63, 0x52, 0x66, 0x32, 0x26, 0xbd, 0xf7, 0xc8, 0xd8, 0x31,
-  0x9f, 0x5f, 0x5a, 0x8f, 0x29, 0x2d, 0x38, 0x48, 0xe4, 0x9f, 0x04, 0xee,
-  0x68, 0x0c, 0x41, 0xd2, 0x76, 0x1b, 0xb3, 0x25, 0xda, 0x59, 0xfb, 0x22,
-  0x8a, 0xd1, 0x5d, 0x66, 0x2c, 0x36, 0x5b, 0x40, 0xe3, 0xe4, 0x5a, 0x86,
-  0x0e, 0x1b, 0xc6, 0x8c, 0x7f, 0x15, 0xd4, 0xde, 0x9e, 0xcc, 0x29, 0xfd,
-  0x83, 0xcc, 0x8b, 0x92, 0xa6, 0x77, 0x48, 0x3a, 0x87, 0xe7, 0xfc, 0xa6,
-  0xf4, 0x9d, 0x32, 0x17, 0x8d, 0x8f, 0x61, 0x15, 0xa1, 0x8d, 0xab, 0xd3,
-  0x79, 0x3e, 0x6c, 0x2e, 0xe7, 0xb2, 0x30, 0xbd, 0x9f, 0x68, 0x6d, 0xe1,
-  0x97, 0xe4, 0x53, 0xf2, 0x73, 0x75, 0x08, 0x3d, 0x29, 0xcf, 0xe7, 0xd5,
-  0x16, 0x48, 0xbf, 0xb8, 0xce, 0xd2, 0x84, 0xe9, 0xc4, 0xca, 0x74, 0x32,
-  0x59, 0x33, 0x94, 0x1f, 0xf7, 0x0e, 0x72, 0xab, 0xdf, 0x0b, 0xea, 0x53,
-  0xff, 0xa2, 0xe0, 0xac, 0x4d, 0x61, 0xd7, 0x76, 0x3e, 0x4e, 0x57, 0xe6,
-  0xc4, 0x75, 0x43, 0xb6, 0x3b, 0x0c, 0xa1, 0xdf, 0xf3, 0x15, 0xbc, 0x3b,
-  0xe4, 0x8d, 0xc0, 0x68, 0x56, 0x38, 0xb3, 0x7f, 0x4e, 0xe0, 0xeb, 0xb2,
-  0xf5, 0x88, 0x5c, 0xee, 0xc2, 0xb2, 0x25, 0x8c, 0x0b, 0x21, 0xdb, 0xf1,
-  0xa8, 0x8a, 0x25, 0xc9, 0x71, 0x2f, 0x5f, 0x37, 0x1e, 0x61, 0xc6, 0x5c,
-  0x63, 0xce, 0xbe, 0x9b, 0x8b, 0x8e, 0x4e, 0x2d, 0x76, 0x57, 0x4a, 0x18,
-  0xeb, 0xe4, 0x25, 0x1c, 0xab, 0x49, 0x88, 0x8f, 0xb9, 0x8a, 0xfe, 0xa5,
-  0x02, 0x12, 0x57, 0xad, 0xe1, 0x6b, 0xb5, 0x3b, 0x3b, 0xcf, 0x4c, 0x44,
-  0x5b, 0xd6, 0x18, 0xe9, 0x2b, 0x7d, 0x39, 0x10, 0x6c, 0x83, 0xa8, 0xe4,
-  0x2a, 0x16, 0x39, 0x4f, 0xe5, 0xc8, 0xd4, 0x66, 0x21, 0xc0, 0x08, 0x3b,
-  0xba, 0xbc, 0x1c, 0xdf, 0x00, 0x25, 0x8a, 0x1c, 0x73, 0x68, 0xbf, 0xfe,
-  0x8f, 0x94, 0x77, 0x67, 0x30, 0xba, 0xb8, 0x8d, 0xfb, 0xc2, 0x64, 0xd7,
-  0x99, 0xf0, 0x83, 0xb8, 0x8f, 0x71, 0xd8, 0x95, 0xdb, 0x93, 0xa9, 0xbd,
-  0x80, 0x57, 0x76, 0x15, 0x2c, 0xbe, 0x6a, 0x4d, 0x87, 0x20, 0x97, 0x29,
-  0xc5, 0x97, 0xb9, 0xfd, 0x6f, 0x00, 0xc7, 0x7d, 0xeb, 0x11, 0x7c, 0x52,
-  0x26, 0xe0, 0xaa, 0x0f, 0x7b, 0x0f, 0x44, 0xb3, 0x68, 0xab, 0x3a, 0x72,
-  0xbf, 0x5f, 0x60, 0xd0, 0x27, 0x90, 0x53, 0x8e, 0xfb, 0x11, 0x99, 0xfd,
-  0x88, 0xa7, 0xe6, 0xdb, 0xd9, 0xe8, 0x5a, 0xcc, 0xf1, 0xef, 0x8a, 0x68,
-  0x54, 0x27, 0x62, 0xb0, 0xb0, 0x0f, 0xbe, 0xe3, 0x8e, 0x11, 0xf9, 0xf8,
-  0x9a, 0x30, 0x98, 0x3f, 0x30, 0xeb, 0xdc, 0x4f, 0xfe, 0x1b, 0x7e, 0x88,
-  0xdb, 0x42, 0x50, 0xeb, 0x19, 0x5f, 0x87, 0xe0, 0x64, 0xee, 0x12, 0x6e,
-  0xee, 0xd8, 0xc9, 0xc1, 0x47, 0x07, 0x78, 0x75, 0x60, 0x28, 0x67, 0xa6,
-  0xcf, 0x60, 0x6a, 0xd6, 0x4b, 0xc6, 0x8f, 0xef, 0xa4, 0xf6, 0x9b, 0x34,
-  0xae, 0xfe, 0x83, 0xa8, 0xd8, 0xff, 0x91, 0xbe, 0xa3, 0x93, 0xf9, 0xb8,
-  0xd5, 0x92, 0x0b, 0x8a, 0x07, 0xa8, 0x7e, 0xa3, 0x89, 0xf7, 0x3c, 0x53,
-  0xd2, 0x36, 0x7d, 0xe1, 0xd0, 0xa0, 0x7d, 0x3c, 0x7e, 0x1b, 0x8c, 0x84,
-  0x75, 0x33, 0x51, 0x12, 0x0f, 0xb9, 0xdd, 0xe2, 0xc3, 0x33, 0xb5, 0xeb,
-  0x9c, 0x7e, 0xf3, 0x8d, 0x2b, 0x9b, 0x6a, 0xd0, 0xaf, 0x0a, 0xa0, 0x27,
-  0x32, 0x8d, 0xa1, 0xcd, 0xc7, 0x31, 0x35, 0x1c, 0x43, 0xdc, 0xc0, 0x7a,
-  0x9c, 0xd4, 0x0f, 0x30, 0xf1, 0x7c, 0x3c, 0x47, 0xd6, 0xa8, 0x12, 0xfe,
-  0xf4, 0x0e, 0x56, 0xbe, 0xcb, 0x19, 0x6f, 0xd1, 0x8f, 0x16, 0x67, 0x63,
-  0xfa, 0x64, 0xbc, 0x43, 0xe5, 0x8c, 0x37, 0xc1, 0x3f, 0x45, 0x91, 0x72,
-  0xff, 0xc4, 0xa9, 0x5a, 0x61, 0x03, 0xcc, 0x90, 0x42, 0xe6, 0x46, 0x2f,
-  0xdd, 0x0a, 0x7b, 0xd0, 0x5b, 0x97, 0xc1, 0xcc, 0x50, 0xe1, 0x44, 0x7d,
-  0x6f, 0xe3, 0xfa, 0xe4, 0x5b, 0x6c, 0xd1, 0xd8, 0x49, 0x45, 0xa6, 0x08,
-  0x49, 0x7e, 0xbd, 0xf4, 0xb6, 0x8d, 0x66, 0xdf, 0x43, 0x03, 0xc6, 0x87,
-  0x2e, 0xa5, 0x40, 0xef, 0x34, 0x5f, 0xb6, 0xb5, 0xd2, 0xff, 0xd4, 0x1c,
-  0xec, 0x23, 0xf5, 0x40, 0xf7, 0x3e, 0x4b, 0x5e, 0x07, 0xb2, 0xff, 0xde,
-  0x7c, 0x36, 0xce, 0xaf, 0x20, 0x36, 0x2a, 0x0d, 0x45, 0x0b, 0x11, 0x04,
-  0x8f, 0x3c, 0xf3, 0x11, 0x9f, 0xf4, 0x8e, 0x6d, 0x8d, 0x09, 0x2c, 0x14,
-  0x9c, 0xe2, 0x8f, 0xf7, 0x6d, 0x4a, 0xd7, 0x6f, 0x24, 0xab, 0x6e, 0x11,
-  0xba, 0xda, 0xa5, 0x98, 0xf5, 0xbf, 0x41, 0xcc, 0xad, 0x15, 0x48, 0x17,
-  0x87, 0xe3, 0xfe, 0x62, 0x3a, 0x26, 0xc7, 0x25, 0xe9, 0xd0, 0xfb, 0xc9,
-  0x03, 0x62, 0xb0, 0x3e, 0x3b, 0x90, 0xd6, 0xd4, 0xe7, 0x4c, 0x3c, 0xb2,
-  0x08, 0x8b, 0xa2, 0x91, 0xf4, 0x2e, 0x85, 0x99, 0xae, 0x6a, 0x34, 0xdc,
-  0x89, 0xc0, 0xe6, 0xf8, 0x1e, 0x26, 0xae, 0x92, 0xa3, 0xf9, 0xda, 0x3d,
-  0x1c, 0xc7, 0x1b, 0x12, 0xa4, 0xe5, 0xc0, 0x74, 0x9f, 0xe5, 0x7c, 0xfe,
-  0x1c, 0xcc, 0xb3, 0xe2, 0x41, 0xf4, 0x93, 0x5e, 0xcf, 0xdc, 0x6d, 0xa3,
-  0xa9, 0xeb, 0xfb, 0x85, 0x5f, 0x1d, 0xa1, 0xe4, 0xa8, 0xfd, 0x87, 0xcb,
-  0xeb, 0x89, 0x54, 0x89, 0xde, 0x64, 0xb5, 0xac, 0x2e, 0x1b, 0xd6, 0x45,
-  0x91, 0x1f, 0xb7, 0x8f, 0x77, 0x23, 0xcf, 0xb1, 0x53, 0xf7, 0x39, 0x35,
-  0xf6, 0xe6, 0x6c, 0x7a, 0x36, 0x9f, 0x42, 0xf5, 0x42, 0x3e, 0xdd, 0x37,
-  0x20, 0x5a, 0x66, 0x3f, 0xaf, 0x2b, 0x47, 0xd2, 0x1e, 0x1d, 0xcf, 0x21,
-  0xa3, 0x95, 0xcc, 0x79, 0x70, 0x97, 0xed, 0x63, 0xbc, 0x58, 0x76, 0xf5,
-  0x23, 0x2f, 0x87, 0xa6, 0x13, 0x36, 0x6d, 0x24, 0xb3, 0x6e, 0x5a, 0x90,
-  0xf8, 0xe1, 0x31, 0x37, 0x24, 0x1c, 0x19, 0x7f, 0x45, 0x96, 0xca, 0x03,
-  0xc3, 0x68, 0x53, 0xda, 0xc4, 0x55, 0x83, 0x18, 0xa4, 0xde, 0x4f, 0x61,
-  0x65, 0x6a, 0x0f, 0x82, 0xb0, 0x50, 0x13, 0x3e, 0xaf, 0x9d, 0xc9, 0x84,
-  0x7b, 0xa3, 0xb8, 0xb4, 0xe9, 0x31, 0xeb, 0xba, 0xda, 0x70, 0xb8, 0x2a,
-  0xcf, 0x40, 0xfb, 0xe3, 0xb4, 0xa8, 0x04, 0x33, 0x2f, 0xd6, 0x16, 0xba,
-  0xff, 0x71, 0x7b, 0x66, 0x25, 0x57, 0x83, 0x1d, 0x50, 0xba, 0xfe, 0x86,
-  0x55, 0x12, 0x77, 0x18, 0x54, 0x7e, 0x86, 0x39, 0xfb, 0xec, 0x08, 0x52,
-  0x98, 0xca, 0xd2, 0xd9, 0x71, 0x14, 0xff, 0xba, 0xcd, 0x71, 0xe3, 0x2d,
-  0xf4, 0xbf, 0xb8, 0x82, 0x50, 0xa5, 0xd7, 0xe8, 0x76, 0x0d, 0x27, 0x7f,
-  0xc0, 0x62, 0xd4, 0xbf, 0x75, 0x53, 0xee, 0xde, 0x8f, 0x6b, 0x56, 0x4f,
-  0x19, 0x9f, 0xfd, 0x03, 0xad, 0x49, 0x0f, 0xd8, 0xea, 0xb2, 0x85, 0xec,
-  0x5f, 0xef, 0x59, 0x93, 0xfb, 0x18, 0xff, 0xcb, 0xc2, 0x54, 0x3f, 0x68,
-  0xce, 0xb4, 0x07, 0xae, 0x78, 0x5d, 0x28, 0x26, 0x52, 0xe3, 0x2f, 0x3f,
-  0xaa, 0x66, 0x90, 0x92, 0xf7, 0x86, 0xfd, 0x5b, 0x64, 0x11, 0x6d, 0x7d,
-  0x40, 0x5c, 0xf0, 0x64, 0xce, 0x1d, 0xf3, 0xe2, 0xea, 0xc0, 0x8b, 0x88,
-  0x37, 0x7c, 0x64, 0xbb, 0x59, 0x00, 0x27, 0x3d, 0xd5, 0x58, 0xb5, 0xeb,
-  0x37, 0xca, 0xaf, 0xcd, 0x18, 0x2c, 0xf6, 0x96, 0xbc, 0x83, 0x0b, 0x68,
-  0x5a, 0x16, 0xc1, 0xd9, 0xda, 0x21, 0x64, 0x9c, 0x78, 0xc5, 0x90, 0x1e,
-  0x17, 0x0e, 0xca, 0xde, 0xe6, 0x61, 0xe9, 0x79, 0x2c, 0xcc, 0xbe, 0x73,
-  0xec, 0xc7, 0x1b, 0x56, 0xf7, 0x39, 0xc9, 0xd9, 0xd3, 0x35, 0x4c, 0xfd,
-  0xe7, 0xcc, 0xae, 0xbd, 0x63, 0xa9, 0x1b, 0xe4, 0x8f, 0x40, 0x73, 0xc9,
-  0x4b, 0x36, 0xb5, 0x5d, 0xe3, 0xde, 0xb8, 0xcd, 0x3c, 0x8f, 0x5a, 0x86,
-  0xd4, 0x82, 0x3d, 0xa4, 0x0f, 0x4f, 0xe6, 0x58, 0xc5, 0x3a, 0x42, 0x8e,
-  0x36, 0x30, 0xe9, 0xa3, 0x0a, 0xbb, 0x8c, 0xc6, 0x09, 0x43, 0xee, 0x14,
-  0x8b, 0x44, 0xfb, 0xd1, 0x64, 0x99, 0x8e, 0x6b, 0x8c, 0x2e, 0x71, 0x9a,
-  0x32, 0xe4, 0xb6, 0x96, 0xd3, 0xf0, 0xc2, 0x80, 0x51, 0xe7, 0x1b, 0xb9,
-  0x9e, 0xe5, 0xc8, 0xbe, 0x21, 0x83, 0x30, 0x0a, 0xf0, 0x64, 0x7c, 0x45,
-  0x31, 0x9f, 0xb6, 0x25, 0xe2, 0x3a, 0xdf, 0x83, 0xd8, 0xc0, 0xcd, 0xf4,
-  0x79, 0x10, 0x85, 0xe5, 0xd0, 0x29, 0xbc, 0xae, 0x4d, 0xe2, 0xd8, 0xa5,
-  0x05, 0x44, 0x2e, 0xf2, 0xe1, 0xef, 0x71, 0x65, 0xca, 0x4d, 0x1c, 0xd9,
-  0x39, 0x65, 0x09, 0xa9, 0xcb, 0xc4, 0x31, 0x93, 0x9a, 0x4b, 0xc9, 0x8e,
-  0xd3, 0x2c, 0x38, 0x22, 0xc9, 0x88, 0xbf, 0xbb, 0xd8, 0x3a, 0xf9, 0x0a,
-  0xad, 0x7b, 0x35, 0x51, 0x13, 0x36, 0xcb, 0xa3, 0xd2, 0x74, 0x26, 0xfe,
-  0x59, 0xc1, 0xfc, 0x8b, 0x63, 0x39, 0xb4, 0xaf, 0x8a, 0xac, 0x74, 0x5b,
-  0xc6, 0x8d, 0x52, 0xe0, 0xf9, 0xca, 0x52, 0x82, 0xaf, 0x1c, 0x66, 0x53,
-  0x6f, 0x1a, 0xb1, 0xca, 0x2a, 0x8c, 0x68, 0xde, 0xc3, 0x54, 0xfb, 0x0d,
-  0x18, 0x9a, 0xaa, 0x62, 0x73, 0xa9, 0x8b, 0x37, 0x4b, 0x56, 0xb0, 0xdc,
-  0x63, 0x10, 0x2a, 0x0e, 0x71, 0xbc, 0x53, 0x9f, 0xc6, 0xed, 0x5b, 0x4b,
-  0x11, 0xe8, 0xdc, 0xa1, 0xb8, 0xb8, 0x83, 0x5f, 0xa3, 0x56, 0x72, 0x44,
-  0x08, 0x43, 0x02, 0xb1, 0x6b, 0x83, 0x49, 0xdd, 0xe9, 0xc2, 0x3e, 0xdf,
-  0x8f, 0x78, 0xd7, 0x9e, 0x63, 0xe6, 0xbe, 0x3e, 0x7c, 0xbf, 0xdd, 0x8d,
-  0x65, 0xa0, 0x04, 0x4f, 0x2c, 0xef, 0x70, 0x6f, 0x94, 0x0b, 0xc3, 0x53,
-  0x16, 0x52, 0xbb, 0xf2, 0x01, 0x9b, 0x1b, 0x8d, 0x28, 0x6f, 0x3f, 0xc2,
-  0xb8, 0x29, 0xad, 0xf4, 0xe4, 0xcd, 0x65, 0xfb, 0xb6, 0x1e, 0x7c, 0x05,
-  0xde, 0xac, 0x5d, 0x93, 0xce, 0x7f, 0x0e, 0xf2, 0xc4, 0x7d, 0x09, 0xe4,
-  0xe7, 0xab, 0x4e, 0x1e, 0x8e, 0x35, 0xe5, 0xea, 0x3a, 0x15, 0xa4, 0x2e,
-  0xb7, 0xf2, 0xa7, 0xe9, 0x36, 0x7e, 0xd3, 0x7d, 0x59, 0xed, 0x58, 0xc7,
-  0x37, 0x46, 0x70, 0x7f, 0x95, 0x2b, 0x83, 0xc7, 0xb5, 0x31, 0xb9, 0x2c,
-  0x8f, 0x03, 0x35, 0x31, 0x8c, 0x3b, 0x77, 0x84, 0xb6, 0xc6, 0xdf, 0x42,
-  0x28, 0xba, 0x4e, 0xc3, 0x8d, 0x08, 0x9c, 0xf4, 0x37, 0xa3, 0xe0, 0xff,
-  0x84, 0x07, 0xcd, 0x47, 0xd1, 0xea, 0x67, 0x82, 0xe7, 0x75, 0x31, 0x0c,
-  0x27, 0xee, 0xe0, 0xfb, 0x86, 0x2f, 0xbc, 0x19, 0x71, 0x18, 0x9d, 0x25,
-  0x7d, 0xe0, 0x47, 0x16, 0x25, 0xcd, 0x5a, 0x38, 0x05, 0xbe, 0x64, 0xc9,
-  0xec, 0x10, 0x7e, 0x5a, 0x8a, 0x52, 0x76, 0xfa, 0x1b, 0x47, 0x22, 0x9f,
-  0xf2, 0x69, 0xde, 0x03, 0x6e, 0x89, 0x5c, 0xa6, 0xeb, 0xfe, 0x59, 0xc6,
-  0x34, 0xc8, 0x13, 0x13, 0x64, 0xc7, 0x8f, 0x49, 0xee, 0x48, 0x7c, 0x36,
-  0x61, 0x4f, 0x78, 0x3a, 0x51, 0x2f, 0x07, 0xb0, 0xd9, 0xca, 0x86, 0xb9,
-  0xf1, 0x49, 0x64, 0xcf, 0x2c, 0x45, 0xf0, 0xd6, 0xe0, 0x2b, 0x2a, 0x3f,
-  0x17, 0xd1, 0x2b, 0x36, 0x09, 0xed, 0xe2, 0x8b, 0x44, 0xca, 0x17, 0x51,
-  0xb7, 0x72, 0x36, 0x72, 0x6f, 0x5f, 0x08, 0x47, 0xfb, 0x02, 0x09, 0xcf,
-  0xcc, 0xd1, 0xf7, 0x6d, 0xe7, 0x87, 0xc2, 0x3b, 0x06, 0x94, 0xc4, 0x11,
-  0x76, 0x68, 0x22, 0xc7, 0xfc, 0xac, 0x99, 0x61, 0x78, 0x81, 0x0d, 0xe3,
-  0xf6, 0x09, 0x53, 0x74, 0x28, 0xdf, 0x13, 0x35, 0x51, 0x51, 0xf9, 0xc8,
-  0xdc, 0x85, 0x8f, 0xb0, 0xb3, 0x9c, 0xcb, 0x52, 0x9f, 0x2c, 0xbc, 0x6e,
-  0xef, 0x63, 0xc6, 0xbe, 0x91, 0xd8, 0x3e, 0x5e, 0xcd, 0x93, 0x51, 0xea,
-  0x2c, 0x30, 0xd9, 0x81, 0x73, 0xba, 0x31, 0x49, 0xfe, 0x37, 0x30, 0xb6,
-  0x19, 0x4f, 0xf0, 0xc7, 0xb5, 0x2c, 0x1e, 0x2c, 0x42, 0x4d, 0x6a, 0x13,
-  0x97, 0x64, 0x9f, 0x23, 0xb2, 0x59, 0x9e, 0xc0, 0x8a, 0x55, 0xfc, 0x1b,
-  0xf6, 0x85, 0x4c, 0x61, 0x8b, 0xd4, 0x2d, 0xbb, 0x85, 0x7f, 0x94, 0x3f,
-  0x63, 0x7d, 0x5e, 0x92, 0xfb, 0x66, 0x26, 0x36, 0x2b, 0xee, 0x72, 0xe1,
-  0xee, 0x79, 0xc4, 0x4e, 0xaf, 0xc3, 0x78, 0x5a, 0x27, 0xd3, 0x85, 0xcf,
-  0x92, 0x28, 0xe2, 0x40, 0xdf, 0xdb, 0x92, 0x5c, 0x7b, 0xa6, 0xc7, 0x5a,
-  0x59, 0x5f, 0xec, 0xcb, 0x6d, 0x90, 0xcb, 0x96, 0x61, 0xd1, 0x4f, 0x0f,
-  0x7c, 0x5c, 0x9e, 0xe3, 0xa4, 0xb7, 0x90, 0x07, 0xd5, 0x4d, 0x9c, 0x1b,
-  0x52, 0x8e, 0x46, 0xf2, 0x3f, 0x6a, 0x8d, 0x82, 0xd0, 0x1f, 0xf7, 0x91,
-  0x4f, 0xbb, 0xd5, 0x19, 0x7d, 0x5c, 0x81, 0x33, 0x4d, 0x21, 0x08, 0xb6,
-  0x4d, 0x94, 0x62, 0xfd, 0xa1, 0xdb, 0xf4, 0x4b, 0xaa, 0xa2, 0x5c, 0xd5,
-  0x08, 0x13, 0x9b, 0x93, 0x88, 0xff, 0xb3, 0xc3, 0xf5, 0x92, 0x16, 0x67,
-  0x06, 0x1f, 0xe6, 0xfd, 0xb7, 0x34, 0x54, 0x5d, 0x46, 0xb1, 0x37, 0xc7,
-  0x9f, 0xeb, 0xf3, 0xb4, 0x58, 0x31, 0xfc, 0x29, 0xf7, 0x6b, 0x6e, 0xf3,
-  0x2a, 0x5d, 0x8a, 0xb4, 0x3f, 0xff, 0x11, 0x55, 0x51, 0x80, 0xd3, 0x5b,
-  0x73, 0x0a, 0x84, 0xbd, 0x1b, 0x78, 0x28, 0x9a, 0xa1, 0x69, 0x7a, 0xe4,
-  0x08, 0x59, 0xe1, 0xd5, 0xa7, 0x5a, 0x4c, 0x14, 0xc2, 0x38, 0x1f, 0x59,
-  0xce, 0x30, 0xed, 0x0f, 0xe4, 0x7a, 0x8a, 0x32, 0xe9, 0x4b, 0x2f, 0xa3,
-  0x44, 0x2e, 0xf0, 0x32, 0xba, 0x8a, 0x16, 0xb5, 0x33, 0x58, 0xee, 0x99,
-  0x85, 0x97, 0xde, 0x36, 0x72, 0xbd, 0x4d, 0x98, 0x7d, 0xf1, 0x3e, 0xfa,
-  0xca, 0xfb, 0x39, 0xaa, 0xde, 0x88, 0xf8, 0x8b, 0x45, 0x98, 0x99, 0x2b,
-  0x13, 0x3d, 0xaa, 0x9b, 0xae, 0xca, 0x68, 0xfa, 0x6e, 0xdf, 0xc7, 0xbe,
-  0x36, 0x09, 0xae, 0x27, 0x59, 0xe0, 0xb7, 0xf9, 0x2d, 0xcd, 0x35, 0xe3,
-  0x39, 0x6a, 0xef, 0x8d, 0xb5, 0xa1, 0x3a, 0xad, 0x1e, 0xf7, 0x39, 0xd5,
-  0xde, 0xc8, 0xcc, 0xbd, 0x37, 0xf8, 0x6f, 0x8d, 0x36, 0x91, 0x92, 0xbf,
-  0xa8, 0xf4, 0x17, 0x90, 0x3c, 0x5d, 0x58, 0xeb, 0x63, 0xef, 0x30, 0xeb,
-  0x5a, 0x0a, 0x1b, 0x6c, 0x87, 0x91, 0x5e, 0xb1, 0x06, 0xaf, 0x93, 0xa3,
-  0x51, 0x98, 0x76, 0x9c, 0xa4, 0xdf, 0x8f, 0x71, 0x19, 0xe8, 0xc8, 0xd3,
-  0x7c, 0x7d, 0x04, 0xb1, 0x4f, 0xa2, 0xf8, 0xb2, 0xc9, 0x9a, 0x00, 0x9d,
-  0x43, 0x24, 0x7f, 0xea, 0x64, 0xc7, 0x59, 0x19, 0xf2, 0x0e, 0x67, 0xf1,
-  0xdb, 0xf8, 0x13, 0xd7, 0xee, 0x0f, 0x60, 0xeb, 0xd2, 0xc7, 0x8c, 0xba,
-  0x30, 0x03, 0x2f, 0x6b, 0x7b, 0x9e, 0xfd, 0x1d, 0xca, 0xbc, 0xf8, 0xfd,
-  0x38, 0xec, 0x6c, 0x47, 0x7c, 0xb1, 0x1a, 0x9f, 0xd4, 0x84, 0x3d, 0xbf,
-  0x2f, 0x01, 0xcf, 0x0d, 0x3f, 0x19, 0x3d, 0x7c, 0x3a, 0xe6, 0xbd, 0x63,
-  0xf9, 0xf8, 0x78, 0x27, 0xfb, 0x57, 0xa6, 0x22, 0x3f, 0xab, 0x9b, 0xf6,
-  0x5f, 0xd6, 0xa4, 0x5b, 0xcb, 0xd1, 0xf4, 0xfa, 0x0a, 0x1e, 0x77, 0xf3,
-  0xe9, 0x9e, 0x7b, 0x0c, 0xdf, 0x2a, 0x4d, 0x66, 0xe7, 0x58, 0x92, 0xe9,
-  0xd1, 0x89, 0x78, 0x4f, 0x09, 0x3f, 0x0b, 0x92, 0x99, 0xa0, 0x11, 0x88,
-  0xed, 0xcf, 0xa1, 0x3c, 0x3b, 0xa0, 0x4a, 0xd2, 0xbb, 0x04, 0xa6, 0x38,
-  0x94, 0xb1, 0x2b, 0x7f, 0x2b, 0xf3, 0xba, 0xc7, 0x50, 0xea, 0xb6, 0x8a,
-  0x35, 0xb3, 0x4a, 0x78, 0x39, 0xee, 0x39, 0x73, 0xdc, 0x35, 0x18, 0x3d,
-  0x24, 0x8d, 0xca, 0x50, 0x57, 0x6e, 0x2b, 0x3c, 0x44, 0x3e, 0xde, 0x84,
-  0x3a, 0x4d, 0x18, 0x39, 0x7c, 0x22, 0xae, 0x69, 0xfb, 0xf9, 0xbb, 0x6d,
-  0x36, 0xc3, 0x5b, 0x2f, 0x62, 0x91, 0x18, 0xc2, 0xea, 0xcd, 0x2d, 0x7c,
-  0xfe, 0xb0, 0x99, 0x9a, 0x23, 0x3e, 0xec, 0x58, 0xa8, 0xc2, 0xc7, 0x8e,
-  0x7d, 0x0c, 0xd6, 0xcd, 0xe7, 0x71, 0xae, 0x39, 0x7f, 0x2e, 0x36, 0xa2,
-  0xbb, 0xf8, 0x1a, 0x6a, 0x81, 0xc2, 0x16, 0x38, 0x26, 0xe1, 0xc3, 0xfd,
-  0x48, 0x61, 0x0b, 0xe4, 0x34, 0x70, 0xf0, 0x99, 0x18, 0x1f, 0x44, 0x74,
-  0x99, 0x7a, 0x3d, 0x9e, 0x55, 0xe3, 0x95, 0xe8, 0xe3, 0x60, 0x4a, 0xe9,
-  0xe4, 0x5f, 0x5c, 0xa8, 0x5c, 0xcb, 0xd7, 0xbe, 0x97, 0x19, 0xbf, 0xfe,
-  0x25, 0x97, 0xe5, 0x82, 0xe8, 0xfa, 0xb8, 0x01, 0xa5, 0xd0, 0x34, 0xd6,
-  0x0b, 0xf5, 0xf6, 0x61, 0xac, 0x3f, 0x37, 0x75, 0x44, 0xf9, 0xe7, 0x9f,
-  0x43, 0xd5, 0xf8, 0x67, 0x5c, 0x0e, 0xfb, 0xcc, 0xea, 0x5d, 0xa7, 0x29,
-  0x8a, 0xd7, 0xa0, 0x9f, 0x87, 0x3b, 0x0e, 0xa2, 0xcb, 0xd0, 0x3e, 0x17,
-  0x80, 0xbe, 0xe4, 0x1e, 0x2e, 0xb9, 0x4e, 0xc7, 0x5a, 0xb1, 0x91, 0xc7,
-  0xe6, 0x62, 0xec, 0xd1, 0x56, 0x62, 0xed, 0x08, 0x17, 0x8a, 0x5f, 0x69,
-  0xe1, 0xb6, 0x7d, 0x2c, 0x61, 0xc2, 0xd5, 0xfe, 0x76, 0xfb, 0x04, 0x77,
-  0xc3, 0xd6, 0xb3, 0x52, 0x2c, 0x84, 0x16, 0x2f, 0x67, 0x9e, 0x2b, 0x65,
-  0x90, 0xb2, 0xf6, 0x03, 0x1e, 0xe1, 0x9e, 0x28, 0x67, 0x28, 0xf1, 0xeb,
-  0xe5, 0x59, 0xec, 0x17, 0x76, 0x11, 0x2d, 0xb4, 0xc4, 0x75, 0x37, 0x07,
-  0xb0, 0xe0, 0x63, 0x38, 0xa1, 0xa7, 0xb6, 0x51, 0x50, 0x77, 0x85, 0xe5,
-  0x2a, 0x62, 0x64, 0x2f, 0xbc, 0x4b, 0xa0, 0xe7, 0x6b, 0xa6, 0xfd, 0xe7,
-  0x40, 0xfe, 0xb2, 0x91, 0x1c, 0xbb, 0x37, 0x87, 0x71, 0xe1, 0x9d, 0x64,
-  0xf5, 0x0b, 0x67, 0xca, 0xeb, 0x1a, 0x0e, 0x49, 0x2d, 0x46, 0xd3, 0xed,
-  0x22, 0x21, 0xd5, 0xd3, 0xb8, 0xf5, 0xb9, 0x2f, 0x23, 0xb7, 0x2f, 0x43,
-  0xb0, 0x69, 0x4e, 0x21, 0x8b, 0xbb, 0x27, 0xf0, 0x72, 0xec, 0x55, 0x24,
-  0xf7, 0xec, 0x61, 0xc1, 0xa2, 0x87, 0x84, 0xbe, 0xf6, 0xc3, 0xf3, 0xc7,
-  0x2b, 0x6a, 0xbc, 0x43, 0xd1, 0x48, 0xcb, 0x61, 0x63, 0xdb, 0x71, 0xee,
-  0x9e, 0x7b, 0xc0, 0xda, 0x97, 0x3d, 0xf8, 0x79, 0xa9, 0xb0, 0x39, 0xbb,
-  0x0f, 0x21, 0x9b, 0xde, 0x71, 0xb0, 0xea, 0x08, 0x63, 0x3b, 0x27, 0x60,
-  0x7b, 0xa7, 0x9e, 0x15, 0x36, 0xcb, 0x19, 0xa4, 0xea, 0xc9, 0xec, 0x0f,
-  0x26, 0x9c, 0x32, 0x10, 0x27, 0xe6, 0xbf, 0xfb, 0x4c, 0xcb, 0x12, 0xd6,
-  0x97, 0xe9, 0x0b, 0x5e, 0x94, 0x7e, 0x41, 0xf6, 0xf2, 0x68, 0x0a, 0xd7,
-  0xe9, 0xd3, 0xb7, 0xfe, 0x1a, 0x4b, 0xbf, 0x5f, 0x22, 0x22, 0xe4, 0x24,
-  0x57, 0x93, 0x5e, 0x30, 0x7d, 0x5a, 0x1b, 0x4d, 0x95, 0x19, 0x2c, 0x3d,
-  0x63, 0xcf, 0x98, 0x15, 0x77, 0x18, 0x60, 0xf4, 0x8c, 0x33, 0xdf, 0x07,
-  0x09, 0xed, 0xb3, 0x13, 0xd9, 0x9b, 0xea, 0x0c, 0x2d, 0x33, 0x23, 0x78,
-  0x40, 0x7f, 0x36, 0x75, 0xc6, 0x93, 0x68, 0xb0, 0x8b, 0x65, 0x0f, 0x56,
-  0xf3, 0x79, 0xef, 0x2b, 0x06, 0xae, 0xce, 0x66, 0xf7, 0xa0, 0x4f, 0xfc,
-  0x78, 0xb4, 0x02, 0x53, 0xb3, 0xb3, 0x24, 0xf6, 0x7c, 0xa7, 0x7f, 0x8c,
-  0x39, 0xdb, 0x4a, 0x56, 0xf1, 0x5d, 0x5c, 0x09, 0x97, 0x89, 0x25, 0x5c,
-  0xe8, 0x3e, 0x80, 0x96, 0x63, 0x36, 0xff, 0x36, 0xf4, 0xe7, 0x62, 0xa2,
-  0x1d, 0x16, 0x01, 0x5f, 0x29, 0xb4, 0x1c, 0x8f, 0x9d, 0xbc, 0x3f, 0x03,
-  0xd6, 0xed, 0xe7, 0x8d, 0x77, 0x2d, 0x82, 0x9e, 0xd4, 0xe1, 0x64, 0x34,
-  0xb4, 0xa2, 0x77, 0x2c, 0x98, 0x87, 0x06, 0x1a, 0xfc, 0x3c, 0x0f, 0x9b,
-  0xa7, 0x5b, 0x12, 0x5f, 0x3e, 0x07, 0xf9, 0x55, 0x0e, 0xfc, 0x1b, 0x39,
-  0x04, 0x77, 0x21, 0xb7, 0x4f, 0x99, 0x33, 0x9e, 0x7a, 0xd7, 0x2d, 0xf4,
-  0x5b, 0xb6, 0x8c, 0x5b, 0x45, 0xc2, 0x7d, 0x1b, 0x55, 0x41, 0xfc, 0xe1,
-  0x05, 0x34, 0x4f, 0xea, 0x65, 0x4a, 0x53, 0x04, 0xe7, 0x4f, 0x58, 0xb3,
-  0x27, 0xa5, 0x98, 0x97, 0x0f, 0x66, 0xb3, 0x61, 0xc4, 0x79, 0xfe, 0x08,
-  0xe1, 0xca, 0x46, 0x23, 0x9e, 0x4f, 0x9f, 0x2d, 0x98, 0x2b, 0x23, 0x42,
-  0x56, 0xd7, 0x23, 0x5c, 0x7c, 0x85, 0xfa, 0x6b, 0x6f, 0xc3, 0x6b, 0xb1,
-  0xfb, 0x8c, 0xbe, 0x3b, 0x92, 0x9e, 0x13, 0x7a, 0x88, 0x1a, 0x47, 0xe2,
-  0x33, 0x7a, 0x13, 0xf1, 0x2d, 0xca, 0x98, 0xa7, 0xbf, 0xe7, 0xb1, 0x9c,
-  0x36, 0xdd, 0x8f, 0xa4, 0xb1, 0x89, 0x39, 0x45, 0xd6, 0xc6, 0xd7, 0x2c,
-  0x6d, 0xcc, 0xe5, 0xdb, 0x19, 0x2d, 0x0a, 0x76, 0x7d, 0xe5, 0xa4, 0x72,
-  0x01, 0xc3, 0xbd, 0x86, 0x51, 0x3e, 0x66, 0x33, 0x67, 0x2e, 0x1e, 0x27,
-  0x6d, 0xd6, 0x18, 0xaa, 0xed, 0x16, 0x30, 0x29, 0xb8, 0x1a, 0x8f, 0x3b,
-  0x12, 0x7c, 0xe8, 0xfb, 0x90, 0x45, 0x26, 0xde, 0x54, 0x1f, 0x4c, 0x41,
-  0x21, 0xe8, 0x2f, 0xe5, 0x73, 0x8c, 0x18, 0x78, 0x43, 0x1b, 0x03, 0xd9,
-  0x7a, 0xea, 0x8a, 0xae, 0xe0, 0xaf, 0x6a, 0xcc, 0xf8, 0xde, 0x62, 0xbe,
-  0x65, 0xfe, 0x24, 0xa1, 0x6f, 0x16, 0xce, 0x25, 0x66, 0x08, 0xfc, 0x56,
-  0xc6, 0x33, 0x74, 0x92, 0x1d, 0x17, 0xb6, 0xac, 0x67, 0x77, 0x51, 0x2e,
-  0xd9, 0xc3, 0xfa, 0x32, 0xe8, 0xf2, 0x51, 0x1a, 0x6d, 0xa4, 0x71, 0x3a,
-  0x58, 0xcc, 0xd5, 0x98, 0x66, 0x46, 0xbc, 0x75, 0xc3, 0x2e, 0x33, 0x9a,
-  0xcf, 0xe2, 0xad, 0x68, 0xfd, 0x3e, 0xc5, 0xee, 0x69, 0xce, 0x48, 0xda,
-  0xc5, 0x32, 0x6f, 0xad, 0x01, 0x79, 0x19, 0xc3, 0xf1, 0x1a, 0xe4, 0xc4,
-  0x97, 0xc5, 0xc9, 0xa4, 0x3e, 0x57, 0x64, 0x82, 0x5b, 0x27, 0xb7, 0xff,
-  0xb8, 0x20, 0x75, 0x6a, 0x1c, 0xe5, 0x31, 0x7a, 0x78, 0xee, 0xbe, 0xcd,
-  0x90, 0x15, 0xde, 0x84, 0x4f, 0xbd, 0x80, 0x79, 0xe6, 0x2c, 0xa6, 0xce,
-  0x3f, 0xc8, 0x91, 0x47, 0x6f, 0x38, 0x2b, 0xb7, 0x90, 0xed, 0x7b, 0x76,
-  0x63, 0xf4, 0x43, 0xc0, 0x8b, 0xd8, 0x47, 0xec, 0xb6, 0x9a, 0x8b, 0xa2,
-  0xeb, 0x41, 0xd2, 0xea, 0x2e, 0x30, 0x6b, 0x86, 0x15, 0x17, 0x0e, 0x27,
-  0x62, 0x28, 0xa9, 0x44, 0xd3, 0xd6, 0x03, 0xec, 0x99, 0x7b, 0x1e, 0xf9,
-  0x38, 0x19, 0xea, 0x2a, 0x9f, 0x91, 0xf9, 0xee, 0x2a, 0xd3, 0xb6, 0xcc,
-  0x66, 0x7f, 0x47, 0x2c, 0x96, 0xf7, 0x4a, 0x18, 0x73, 0x68, 0x17, 0x73,
-  0xc6, 0x1e, 0xa6, 0x64, 0x65, 0x14, 0x67, 0x9c, 0x66, 0x30, 0xa6, 0x6d,
-  0x2f, 0xa9, 0x29, 0x03, 0x31, 0x7b, 0xf2, 0x0c, 0x9f, 0xb5, 0xd1, 0x5c,
-  0xf9, 0xea, 0x87, 0xa3, 0x8f, 0x1c, 0x12, 0x6f, 0x67, 0x32, 0x4f, 0xe7,
-  0x04, 0x0f, 0x77, 0x8e, 0x40, 0xef, 0xc2, 0x4a, 0x94, 0x3f, 0x0a, 0x3f,
-  0xe7, 0x32, 0x0f, 0x41, 0x75, 0xfc, 0x1f, 0x6c, 0xbe, 0x78, 0xa2, 0x78,
-  0xbb, 0x9c, 0xa3, 0x7e, 0x53, 0x98, 0xf9, 0xbb, 0x1e, 0x63, 0xad, 0x0c,
-  0xee, 0xb7, 0x7c, 0x47, 0x7b, 0xe0, 0x4a, 0x4e, 0xdd, 0xbf, 0xc2, 0x13,
-  0xc5, 0x1a, 0x32, 0xed, 0x0d, 0x89, 0x7e, 0x38, 0x88, 0x63, 0xc1, 0x77,
-  0x79, 0x7c, 0x65, 0x0c, 0x3f, 0xbf, 0x7c, 0x65, 0xe3, 0x7f, 0xd3, 0x58,
-  0x1d, 0x74, 0x0b, 0x11, 0xc7, 0xe7, 0x94, 0x8c, 0x5b, 0xca, 0xa2, 0x8d,
-  0xfd, 0x39, 0xbc, 0xfc, 0x29, 0x4d, 0x7d, 0x32, 0x59, 0x66, 0xbb, 0x9d,
-  0x7d, 0xf9, 0xff, 0x48, 0x7b, 0xbb, 0x80, 0xf5, 0x87, 0x9d, 0xf9, 0x57,
-  0x93, 0xc6, 0x53, 0xab, 0x95, 0x5c, 0xb9, 0x30, 0x81, 0x55, 0x2d, 0x41,
-  0xdc, 0x5b, 0xdb, 0xc3, 0xc2, 0xb4, 0x9b, 0x42, 0xd5, 0xfd, 0x40, 0x6b,
-  0xc9, 0x19, 0x0a, 0xe7, 0x0c, 0x67, 0xb5, 0xf8, 0x2f, 0x8e, 0x04, 0x65,
-  0xf1, 0xc6, 0xbe, 0x86, 0x91, 0xbf, 0x56, 0x73, 0x2f, 0xa9, 0x82, 0xe3,
-  0x9f, 0x7a, 0xe9, 0x2f, 0xbb, 0x9d, 0xf9, 0x2b, 0x0c, 0xd8, 0x96, 0xe3,
-  0x8b, 0x91, 0xc0, 0x95, 0xdf, 0x4b, 0x7f, 0xb3, 0xd8, 0x6f, 0x1d, 0x4d,
-  0x55, 0x6f, 0x08, 0x9f, 0x34, 0x89, 0xee, 0x5f, 0xdd, 0xe8, 0x5f, 0x37,
-  0xc6, 0x71, 0x5e, 0x0e, 0xaf, 0x27, 0x37, 0xb2, 0xea, 0xf5, 0x62, 0xba,
-  0x46, 0x6e, 0x65, 0xf6, 0x36, 0x71, 0xde, 0x0f, 0xcc, 0xe7, 0xd6, 0xfe,
-  0x36, 0x3a, 0x1f, 0xef, 0x61, 0xff, 0xb0, 0x27, 0xa4, 0x79, 0x9e, 0xc7,
-  0xf3, 0xbf, 0xf7, 0x34, 0xcf, 0x57, 0x24, 0x7f, 0x64, 0x15, 0x82, 0x15,
-  0xf6, 0x03, 0x69, 0x1f, 0xa4, 0x43, 0xd2, 0x6c, 0x19, 0x3e, 0xbd, 0x88,
-  0xe6, 0xb9, 0xac, 0x2b, 0x67, 0x85, 0x52, 0x22, 0x53, 0x29, 0xd4, 0x4f,
-  0x5f, 0x39, 0xd6, 0x2f, 0xd8, 0xca, 0xc0, 0xde, 0x29, 0xcc, 0x3d, 0x72,
-  0x16, 0x13, 0xcd, 0xc7, 0xc8, 0x6d, 0x98, 0x83, 0xea, 0x80, 0xed, 0x24,
-  0x9f, 0xac, 0xe5, 0x9c, 0x7a, 0x10, 0x6f, 0xee, 0x5b, 0x60, 0xff, 0xd7,
-  0x9b, 0xee, 0x84, 0x16, 0x36, 0xb7, 0xba, 0x13, 0x7c, 0xc1, 0x14, 0xb1,
-  0x1b, 0x67, 0x89, 0x7f, 0x3a, 0x94, 0xc9, 0x6a, 0x15, 0xd4, 0x0f, 0x9d,
-  0x84, 0x4c, 0x70, 0x1d, 0x4b, 0x46, 0x49, 0xe1, 0x5b, 0xf4, 0x89, 0x41,
-  0x7d, 0xab, 0x50, 0x38, 0x38, 0x98, 0x4e, 0x35, 0x33, 0xa2, 0xde, 0x4e,
-  0x63, 0xdc, 0xc0, 0x23, 0xa8, 0xb9, 0x17, 0x22, 0xce, 0x65, 0x42, 0x6e,
-  0x18, 0xd0, 0xa9, 0x35, 0x81, 0x25, 0x05, 0x0e, 0x54, 0x0c, 0x10, 0x61,
-  0xea, 0xea, 0x99, 0x5c, 0xca, 0x4b, 0xe7, 0xdf, 0x31, 0x49, 0x1e, 0xf7,
-  0xce, 0x27, 0x24, 0xf8, 0x33, 0xd2, 0xae, 0x0a, 0xc4, 0xa6, 0xf6, 0xe5,
-  0xae, 0x54, 0x30, 0x02, 0xc3, 0x5c, 0xbc, 0x12, 0xa5, 0xc8, 0x6a, 0x4c,
-  0x43, 0xdc, 0x4b, 0x87, 0x4b, 0x65, 0x5f, 0xb9, 0x13, 0x29, 0xc3, 0x20,
-  0xb3, 0x50, 0x42, 0x4f, 0x0b, 0x91, 0xf9, 0xfe, 0x54, 0x46, 0x5e, 0x3a,
-  0xcc, 0xca, 0x85, 0x6b, 0x08, 0x34, 0xca, 0xe4, 0xd9, 0x55, 0x2b, 0xfa,
-  0x29, 0x8b, 0xb2, 0xf1, 0x4e, 0x2a, 0xa1, 0xa6, 0x87, 0x18, 0x1d, 0x78,
-  0x0e, 0xc1, 0xc1, 0x37, 0xb7, 0x11, 0x1c, 0xaa, 0xa5, 0x50, 0xcf, 0x02,
-  0xcd, 0x88, 0x2f, 0x8c, 0xb0, 0x10, 0x67, 0x47, 0xfa, 0x63, 0x2e, 0x4e,
-  0xd5, 0x60, 0xaa, 0xa1, 0x17, 0xed, 0x61, 0x3f, 0x84, 0xa9, 0x79, 0x93,
-  0x3b, 0xa3, 0xb5, 0xe9, 0xba, 0xd8, 0xcd, 0xe9, 0xbc, 0x24, 0x1e, 0xbc,
-  0x3f, 0xc6, 0x10, 0xb9, 0x55, 0xec, 0xdb, 0xdc, 0x0f, 0xa5, 0x95, 0x3f,
-  0x88, 0x3d, 0x24, 0xcb, 0x98, 0xa9, 0xf7, 0x50, 0x2b, 0xb9, 0xc8, 0x93,
-  0x33, 0xf3, 0x30, 0x94, 0xaf, 0xa7, 0x73, 0xdd, 0x4a, 0xfc, 0xbe, 0x45,
-  0x61, 0x65, 0x7e, 0x8c, 0xbb, 0x19, 0xf9, 0xec, 0xfa, 0x67, 0x44, 0x8b,
-  0xe1, 0x0e, 0xca, 0x12, 0x7d, 0xb1, 0xe9, 0xbc, 0x43, 0x63, 0x40, 0x0a,
-  0x6e, 0xdb, 0x56, 0xf3, 0xb0, 0x7a, 0x1c, 0x5e, 0xe1, 0x5b, 0xb1, 0x52,
-  0x5c, 0xc2, 0x6d, 0x83, 0x7a, 0xf6, 0x35, 0x04, 0x21, 0xe2, 0xf9, 0x1d,
-  0xfb, 0xa7, 0x9e, 0x9c, 0x9d, 0xdc, 0x8c, 0xd9, 0x9e, 0xb3, 0xa4, 0x0a,
-  0x03, 0x75, 0xf9, 0x90, 0x18, 0x3e, 0x6c, 0x7a, 0xc3, 0xe1, 0x69, 0x99,
-  0x3c, 0xfd, 0x6c, 0xcf, 0xae, 0x97, 0x9a, 0xe8, 0x2e, 0x10, 0x8a, 0x8f,
-  0x8d, 0x0f, 0xb6, 0xe2, 0xd6, 0x68, 0xae, 0xed, 0xcf, 0x97, 0x31, 0xa7,
-  0x39, 0xb0, 0x73, 0x27, 0x2a, 0xdc, 0xe7, 0xa9, 0x56, 0x3a, 0x47, 0xde,
-  0x6d, 0xe2, 0xbe, 0xfc, 0x6f, 0x26, 0xfc, 0x96, 0x66, 0x4b, 0xd8, 0x2b,
-  0xa6, 0xb5, 0x6a, 0xb0, 0x74, 0xeb, 0x3f, 0xba, 0xc6, 0xde, 0xc3, 0xfe,
-  0x8f, 0x3e, 0x59, 0xe5, 0x33, 0x10, 0x18, 0x2c, 0xbd, 0xcc, 0xf4, 0x9b,
-  0x4e, 0xf8, 0xf4, 0xfa, 0x62, 0x7e, 0x22, 0x95, 0x6b, 0x02, 0x35, 0xfe,
-  0xe4, 0xd9, 0x53, 0xd2, 0x79, 0x17, 0x77, 0x89, 0x26, 0x36, 0x27, 0xf7,
-  0xa3, 0xc6, 0xfa, 0x10, 0xbb, 0x56, 0x8f, 0x60, 0xe4, 0xb7, 0x8d, 0xbc,
-  0x9a, 0xac, 0x80, 0xb5, 0x4b, 0x13, 0x1f, 0x2b, 0x8b, 0xd1, 0x89, 0x4e,
-  0xa3, 0x6a, 0xc4, 0x6c, 0xae, 0xbf, 0xd9, 0x85, 0xb7, 0x98, 0x1e, 0xf7,
-  0xed, 0x24, 0x69, 0x99, 0xff, 0x07, 0x87, 0xba, 0xa9, 0xdc, 0xdc, 0x97,
-  0xca, 0xbc, 0xb8, 0xaf, 0xd4, 0x2c, 0xdd, 0xcc, 0x30, 0xef, 0x01, 0xc4,
-  0x29, 0xff, 0xe6, 0x90, 0x73, 0x02, 0xb3, 0xb4, 0x96, 0x90, 0x33, 0x7e,
-  0x1f, 0x1b, 0x6e, 0x7d, 0xa5, 0x8f, 0xd9, 0x4b, 0x96, 0x4b, 0xc5, 0xd0,
-  0x7b, 0xaf, 0x8b, 0x57, 0xbe, 0xfb, 0x90, 0xfb, 0x32, 0x9d, 0x44, 0x6b,
-  0xe1, 0xd8, 0x8e, 0xbe, 0xc3, 0xba, 0x08, 0x0d, 0x21, 0xfe, 0x9a, 0x30,
-  0x2c, 0xdd, 0x19, 0x67, 0xf5, 0xa1, 0x28, 0x45, 0x5b, 0x71, 0xab, 0x6c,
-  0x05, 0x62, 0xab, 0x8e, 0x33, 0xfb, 0xce, 0x13, 0xbe, 0x1f, 0x35, 0x43,
-  0x59, 0xc8, 0x27, 0x97, 0xbf, 0xee, 0x43, 0x76, 0x5f, 0x0d, 0x8f, 0x42,
-  0x12, 0x51, 0xab, 0xa9, 0xc0, 0x3c, 0x57, 0x89, 0xe8, 0xfe, 0xba, 0xfc,
-  0x38, 0x7a, 0x0c, 0x0d, 0xd5, 0x79, 0x24, 0x66, 0x95, 0xd1, 0xb8, 0x3b,
-  0x90, 0x36, 0xb1, 0x4b, 0x44, 0x3f, 0x50, 0xa1, 0x70, 0xf5, 0x29, 0x86,
-  0x5f, 0x96, 0xa1, 0xfe, 0xe8, 0x56, 0xe2, 0xa6, 0x7e, 0x45, 0xf0, 0xd0,
-  0x64, 0x38, 0x48, 0xce, 0x27, 0xe6, 0xf1, 0x5b, 0xde, 0x28, 0xad, 0xc2,
-  0xad, 0xe1, 0x2f, 0xab, 0x57, 0x06, 0xd2, 0x7f, 0xc7, 0x28, 0x34, 0x6a,
-  0x37, 0x91, 0xbc, 0xff, 0x22, 0x13, 0xb3, 0xcb, 0x59, 0x26, 0xf2, 0x9a,
-  0x03, 0x75, 0x11, 0xc4, 0x6d, 0x77, 0x65, 0xc1, 0xd9, 0x45, 0xe4, 0x2c,
-  0x1e, 0xce, 0xd1, 0x9c, 0x28, 0xda, 0x7f, 0x1e, 0xc0, 0x28, 0xa5, 0x01,
-  0xd1, 0x93, 0x37, 0x58, 0x6a, 0xe4, 0xc7, 0xa1, 0xae, 0x62, 0x14, 0x46,
-  0xdb, 0x23, 0x38, 0xea, 0x46, 0xe4, 0x40, 0x21, 0xb1, 0xdd, 0xd1, 0xa2,
-  0xbd, 0x3e, 0x10, 0xc5, 0x79, 0x6a, 0xac, 0x6b, 0x7d, 0x44, 0x58, 0xb9,
-  0x38, 0x52, 0x9e, 0x8a, 0xf8, 0xd5, 0x5a, 0x93, 0x3c, 0x65, 0x2e, 0xbb,
-  0xe2, 0xfb, 0x13, 0xae, 0x53, 0xc9, 0x7c, 0x07, 0x1f, 0x4c, 0x44, 0x52,
-  0x39, 0x95, 0x5c, 0x86, 0xf2, 0x42, 0x4b, 0x6e, 0x74, 0xc7, 0xf2, 0xdc,
-  0xbf, 0x12, 0xf5, 0x66, 0x45, 0x8a, 0x64, 0x5e, 0xe0, 0xbd, 0xbd, 0x13,
-  0xeb, 0x9f, 0xd3, 0x30, 0x18, 0x5e, 0xc4, 0x59, 0x47, 0x31, 0x32, 0x26,
-  0x44, 0xb2, 0xa9, 0xf8, 0x0f, 0xfb, 0x45, 0xee, 0x11, 0x9c, 0x3d, 0x9c,
-  0x77, 0x4b, 0xe6, 0xe1, 0xf3, 0x71, 0x23, 0x23, 0x27, 0xfd, 0xa1, 0x28,
-  0xe1, 0x15, 0xab, 0xf5, 0x47, 0xd2, 0xe7, 0x69, 0x22, 0x7b, 0xce, 0x39,
-  0x62, 0x64, 0x3e, 0x98, 0x13, 0x2f, 0x36, 0x70, 0x7d, 0xe6, 0x01, 0xf6,
-  0xee, 0x2b, 0xc5, 0xb7, 0x61, 0x39, 0x8a, 0xfd, 0x5e, 0xb3, 0x20, 0x3a,
-  0x1c, 0xc1, 0xb9, 0x3d, 0xa6, 0x38, 0x9e, 0x51, 0x60, 0x68, 0xf2, 0x03,
-  0xe4, 0x35, 0x44, 0x98, 0xed, 0xea, 0x4e, 0xd8, 0xc5, 0xe7, 0xd4, 0x06,
-  0x4c, 0xe2, 0xd6, 0xec, 0x6b, 0x9c, 0x54, 0xd0, 0x45, 0xec, 0xd7, 0x6c,
-  0xca, 0x4e, 0xee, 0xe0, 0xf3, 0xac, 0x7b, 0xac, 0x4f, 0xfd, 0x4c, 0x9f,
-  0xc1, 0xfe, 0x04, 0xb7, 0x6d, 0x61, 0x9c, 0xa1, 0xd0, 0xff, 0x6d, 0x2b,
-  0xd9, 0x36, 0x5b, 0x9b, 0xf3, 0xd5, 0x93, 0x78, 0x75, 0xd7, 0x9c, 0xc4,
-  0xa0, 0xff, 0x58, 0x73, 0xad, 0x0f, 0x7f, 0x1f, 0xf9, 0xf0, 0xb8, 0xe3,
-  0x09, 0xa6, 0xb6, 0xcd, 0x2c, 0x1b, 0x73, 0x93, 0xeb, 0x51, 0x87, 0xa8,
-  0xcb, 0x6c, 0xa4, 0x7b, 0x47, 0x24, 0x8b, 0x25, 0x4a, 0x78, 0xa1, 0x77,
-  0x82, 0x6f, 0x3d, 0x21, 0x4c, 0xde, 0x9f, 0xcf, 0xf5, 0x4f, 0x1b, 0x18,
-  0xfa, 0x78, 0x22, 0x85, 0x33, 0x56, 0x09, 0x61, 0xa7, 0x05, 0xed, 0x5b,
-  0x87, 0x39, 0xef, 0x32, 0x9a, 0x83, 0x83, 0x7e, 0x23, 0x53, 0xb8, 0x96,
-  0xb6, 0xa5, 0xc1, 0xbc, 0x3a, 0x75, 0x99, 0xc8, 0xfa, 0x03, 0xfc, 0x49,
-  0x18, 0xcb, 0xb8, 0x80, 0x26, 0xea, 0xe7, 0x5c, 0xa5, 0xd4, 0x74, 0x02,
-  0x12, 0x3d, 0x6b, 0xe9, 0x9d, 0x7e, 0x04, 0xa3, 0x53, 0x9f, 0x49, 0x37,
-  0x8f, 0xc1, 0xf9, 0xa0, 0x1b, 0xf5, 0xdf, 0x82, 0x38, 0xb3, 0x6d, 0x20,
-  0x59, 0xa9, 0xdf, 0xa8, 0x19, 0x55, 0x8d, 0xf8, 0xf2, 0xa5, 0xcc, 0x39,
-  0xd1, 0xc4, 0xd8, 0x8e, 0x0e, 0xd6, 0xf8, 0x5f, 0xe1, 0xf9, 0x62, 0x01,
-  0xdf, 0xf2, 0xf6, 0xb2, 0xf9, 0xe3, 0x63, 0x04, 0x63, 0xe5, 0x8e, 0x93,
-  0xd9, 0xfe, 0x83, 0xd6, 0xad, 0x37, 0x79, 0x52, 0xb0, 0x95, 0x0d, 0x5f,
-  0x2e, 0xf1, 0x55, 0x7a, 0x29, 0x63, 0xdf, 0xb7, 0xe0, 0xf8, 0xc0, 0x89,
-  0x6e, 0xad, 0x3f, 0x34, 0x9a, 0xfa, 0x12, 0x56, 0x31, 0x96, 0x8c, 0x0b,
-  0x7a, 0xa8, 0xac, 0x15, 0x85, 0xc2, 0x1c, 0x2c, 0xdc, 0xa7, 0xd1, 0x38,
-  0xc6, 0x88, 0xab, 0xe7, 0x47, 0x51, 0xac, 0x14, 0xc4, 0x1f, 0xa7, 0x0e,
-  0x46, 0x8a, 0x88, 0x93, 0xbb, 0x24, 0x16, 0x6b, 0xcb, 0x85, 0xcc, 0x98,
-  0xa1, 0xcf, 0x39, 0xdd, 0xbb, 0xc2, 0xa0, 0x51, 0x61, 0xdf, 0xb3, 0x6d,
-  0x3c, 0x30, 0x5e, 0x43, 0x7f, 0xd1, 0xd1, 0xd8, 0xf9, 0x6f, 0xe4, 0xe8,
-  0x7b, 0xb8, 0x1b, 0xb9, 0x9c, 0xf1, 0xf3, 0x3f, 0xb0, 0x26, 0x4d, 0x82,
-  0xaa, 0x31, 0x0e, 0x1c, 0x59, 0xdf, 0x49, 0x43, 0x70, 0x18, 0xdb, 0x3d,
-  0x06, 0x22, 0x2d, 0x67, 0xcf, 0x23, 0x4b, 0x55, 0x2c, 0xbe, 0x5f, 0x27,
-  0x7e, 0xdd, 0x09, 0x56, 0x1f, 0xea, 0x43, 0xdf, 0xec, 0x85, 0x68, 0x28,
-  0xdf, 0xa2, 0x40, 0xdf, 0x10, 0xe7, 0x2f, 0x7e, 0x68, 0x3f, 0x77, 0xe0,
-  0x44, 0xf2, 0x62, 0xe6, 0xed, 0x08, 0x25, 0xef, 0x49, 0x1d, 0xcb, 0x63,
-  0xb3, 0x18, 0x28, 0x54, 0xee, 0xf6, 0xe2, 0x31, 0xcc, 0x9d, 0x6b, 0x88,
-  0xed, 0xf8, 0xeb, 0x4c, 0x6a, 0xb0, 0xe6, 0x5f, 0x8f, 0x37, 0x81, 0x7d,
-  0x14, 0x28, 0x2b, 0xcf, 0xa6, 0x73, 0xe2, 0x76, 0xb6, 0x5d, 0x9b, 0xc5,
-  0xe5, 0xe1, 0x67, 0x10, 0xb5, 0xfc, 0xc3, 0x9d, 0xa7, 0x4b, 0x10, 0x78,
-  0xae, 0x1a, 0x85, 0xde, 0xf9, 0x5d, 0x2c, 0x1e, 0x10, 0x8a, 0x87, 0xea,
-  0x74, 0xee, 0xea, 0x3f, 0xe4, 0xf4, 0x66, 0x13, 0x12, 0xc5, 0x3c, 0x51,
-  0x39, 0x3c, 0x10, 0xbd, 0x84, 0x30, 0x36, 0xb5, 0xfc, 0xc7, 0x6c, 0xf1,
-  0xc9, 0x6c, 0xdb, 0xdd, 0x81, 0x4f, 0x77, 0x2a, 0x79, 0x8a, 0xbb, 0xa9,
-  0x7c, 0xf1, 0x8a, 0x3d, 0xde, 0x9e, 0xe8, 0x7e, 0xc8, 0x63, 0x52, 0x69,
-  0x12, 0x2e, 0x6b, 0xb6, 0x31, 0xbf, 0xcd, 0x83, 0xd3, 0xf5, 0x9f, 0x78,
-  0x97, 0x74, 0x8d, 0x62, 0xf1, 0x5e, 0x52, 0xf6, 0x84, 0xf1, 0xb9, 0x70,
-  0x38, 0xea, 0x4a, 0x71, 0xf8, 0x1c, 0xfc, 0x4e, 0xc2, 0x0f, 0x3f, 0xa6,
-  0xcd, 0x9c, 0x83, 0xe1, 0xe6, 0x9b, 0xc4, 0xdc, 0x1f, 0xcf, 0xbe, 0xc1,
-  0xfb, 0xf9, 0x74, 0x2a, 0x03, 0x0b, 0x8b, 0x57, 0x04, 0x16, 0x2e, 0x42,
-  0xf5, 0xcf, 0x2d, 0x5c, 0x63, 0xab, 0xb9, 0xba, 0x22, 0x81, 0x41, 0x15,
-  0x3a, 0x74, 0x4f, 0x7b, 0x8b, 0x5f, 0x52, 0x11, 0xf6, 0x23, 0x1c, 0xc8,
-  0xac, 0x6a, 0xe1, 0xe8, 0x16, 0x1b, 0x26, 0xf7, 0xef, 0x25, 0xe1, 0xc0,
-  0x6c, 0xbe, 0x6a, 0x57, 0xd3, 0x7f, 0x64, 0x3b, 0x11, 0xc7, 0x37, 0xe3,
-  0x20, 0x2b, 0x40, 0x69, 0xc5, 0x0e, 0x2a, 0xae, 0x2d, 0xe3, 0x62, 0x5d,
-  0x15, 0x32, 0xfe, 0xf7, 0x31, 0x59, 0xfd, 0x9e, 0xe4, 0x88, 0xe9, 0xb8,
-  0xef, 0xd5, 0x45, 0xeb, 0xd6, 0x03, 0x36, 0x5d, 0x0c, 0x26, 0x47, 0x7f,
-  0x18, 0x2a, 0xf6, 0xfa, 0x1c, 0x0c, 0xbf, 0xce, 0xb2, 0xae, 0x49, 0x7c,
-  0x50, 0xbf, 0x84, 0xa0, 0x2a, 0xb3, 0x59, 0xe8, 0xe6, 0xcf, 0xd9, 0x71,
-  0x4c, 0x8f, 0x94, 0xff, 0x06, 0xd3, 0x37, 0xe7, 0x3b, 0xd6, 0xa7, 0xc6,
-  0xa3, 0x95, 0x91, 0xc5, 0xa3, 0xaa, 0x42, 0x8e, 0xd8, 0x2f, 0x66, 0xb8,
-  0x4c, 0x12, 0x85, 0x01, 0xa6, 0xc8, 0x5c, 0x7f, 0x82, 0xeb, 0x82, 0xf3,
-  0x2c, 0xb2, 0x90, 0x45, 0x32, 0x51, 0x8b, 0xe8, 0x65, 0xc2, 0x5a, 0x1b,
-  0xda, 0x9f, 0x80, 0x4b, 0xf3, 0xf9, 0x7c, 0xf3, 0x11, 0x1b, 0x0e, 0xaf,
-  0x41, 0x4c, 0x76, 0x06, 0x47, 0x2e, 0xec, 0x16, 0x26, 0xef, 0x38, 0x76,
-  0x9e, 0xb0, 0x60, 0xe8, 0xc7, 0xe7, 0xd4, 0x5f, 0x75, 0x66, 0x93, 0x96,
-  0x28, 0x4f, 0x85, 0x69, 0xfe, 0x31, 0xe7, 0x19, 0x43, 0x14, 0x76, 0x52,
-  0xe1, 0x94, 0xc8, 0xfc, 0x2a, 0x7d, 0x46, 0x36, 0xa8, 0x72, 0x79, 0xd2,
-  0x69, 0x06, 0x0a, 0x33, 0xe7, 0x8e, 0x98, 0x05, 0xfa, 0x73, 0x55, 0xf8,
-  0xf6, 0xee, 0x2f, 0x1a, 0x8e, 0x67, 0xc9, 0x3f, 0x6b, 0xc6, 0x84, 0x3a,
-  0x49, 0x54, 0x23, 0x5f, 0xf2, 0x69, 0xbe, 0x12, 0xd5, 0x44, 0x20, 0x95,
-  0x56, 0xca, 0xba, 0xc2, 0x41, 0x6c, 0x0d, 0x3f, 0xcc, 0x8d, 0xa6, 0x4c,
-  0xfe, 0xbb, 0x3d, 0x86, 0xd6, 0xd6, 0x32, 0x36, 0x1b, 0x9d, 0xc5, 0xfd,
-  0x37, 0x9c, 0xdb, 0x73, 0x82, 0x17, 0x03, 0x16, 0x70, 0xff, 0xde, 0x1e,
-  0xde, 0x1f, 0x8f, 0x62, 0xd4, 0xa2, 0x2e, 0xa2, 0xac, 0x0f, 0x52, 0x35,
-  0x63, 0x2c, 0x22, 0x5f, 0xfe, 0x23, 0xe4, 0xbf, 0x8f, 0xbc, 0x1e, 0x53,
-  0xc6, 0x6c, 0x6f, 0x2b, 0xa2, 0xdc, 0xf2, 0x11, 0x0c, 0x6e, 0xf6, 0x25,
-  0x60, 0xd4, 0x1c, 0xba, 0x34, 0xd3, 0x28, 0x8e, 0x7e, 0xc3, 0xa8, 0xce,
-  0xb3, 0xd4, 0x2b, 0x3b, 0xf2, 0x63, 0xf1, 0x2c, 0x2e, 0xd0, 0xc0, 0x8d,
-  0x75, 0xdb, 0xf8, 0xa8, 0x3a, 0x8c, 0x8b, 0xb5, 0xae, 0x42, 0x5b, 0x3b,
-  0xc6, 0xb7, 0x91, 0xea, 0x24, 0xbf, 0xb3, 0xc2, 0x24, 0xaf, 0x8c, 0x9f,
-  0x3b, 0x2e, 0x72, 0xec, 0xdf, 0x3e, 0x6a, 0xe6, 0x29, 0x90, 0x29, 0x74,
-  0x83, 0x8a, 0x33, 0x7e, 0x5c, 0x9a, 0x76, 0x0f, 0xed, 0x6d, 0x75, 0x74,
-  0xdc, 0xd6, 0x41, 0xcf, 0xc0, 0x93, 0x88, 0xb9, 0x3f, 0xc8, 0x15, 0x99,
-  0xcf, 0x52, 0x9b, 0xab, 0xc8, 0x5e, 0xf4, 0x20, 0xe0, 0xf8, 0x24, 0x7e,
-  0xad, 0x7a, 0xc3, 0x96, 0xdf, 0x7d, 0xb8, 0x11, 0xf4, 0x8b, 0x93, 0x4b,
-  0x1e, 0xf1, 0xf7, 0x66, 0x24, 0xcb, 0xbe, 0x7e, 0xa3, 0xf9, 0xa4, 0x33,
-  0x0a, 0x77, 0x8e, 0x12, 0x3a, 0x52, 0x86, 0xe3, 0xe9, 0xf7, 0xa8, 0xeb,
-  0x2b, 0xac, 0xd4, 0xad, 0xfb, 0x29, 0xff, 0x94, 0x42, 0x98, 0xdc, 0x7a,
-  0xcc, 0xbd, 0xbd, 0xf9, 0xbb, 0x7b, 0x14, 0x01, 0xd3, 0x75, 0xa9, 0x14,
-  0x8f, 0x43, 0x75, 0xf3, 0x54, 0xe1, 0x1a, 0x19, 0x73, 0xda, 0xe5, 0x3d,
-  0x29, 0xc1, 0x97, 0xf9, 0x2d, 0xa9, 0x80, 0xe6, 0xcc, 0x4d, 0x0c, 0xb3,
-  0xba, 0x8a, 0x6b, 0xfb, 0x68, 0x74, 0x95, 0x45, 0x50, 0x7d, 0xfc, 0x44,
-  0x68, 0x85, 0xa6, 0xd8, 0x0f, 0x8d, 0xe1, 0x84, 0xc7, 0x6e, 0xba, 0xb5,
-  0x17, 0x62, 0x54, 0xec, 0xc1, 0x83, 0x84, 0x81, 0xec, 0x99, 0xb2, 0x12,
-  0x81, 0xd9, 0x76, 0x17, 0x6a, 0x7b, 0x86, 0x13, 0x63, 0x66, 0xc1, 0x3c,
-  0x87, 0x43, 0x18, 0xca, 0xe8, 0xe0, 0xe6, 0x12, 0x8f, 0x6a, 0xe8, 0x0f,
-  0x44, 0xfb, 0x8e, 0x66, 0x47, 0xf4, 0x5a, 0x16, 0xdf, 0xe9, 0x15, 0x0a,
-  0xca, 0x1d, 0xd6, 0x2c, 0x7f, 0xc7, 0x80, 0x47, 0x02, 0x1a, 0x4e, 0xff,
-  0x60, 0x86, 0xe0, 0x34, 0xf7, 0xa6, 0xaf, 0x63, 0xe9, 0xfe, 0x2e, 0xac,
-  0x9f, 0x65, 0x31, 0x7a, 0xb4, 0x19, 0x53, 0xdb, 0xa5, 0x71, 0x7c, 0x29,
-  0xc6, 0x4b, 0x9d, 0xcb, 0x64, 0x3f, 0x0c, 0x62, 0xa6, 0xd4, 0x54, 0x0e,
-  0xbe, 0x2e, 0x84, 0x30, 0x63, 0xb6, 0x77, 0xb7, 0x90, 0x3e, 0x6e, 0x19,
-  0xee, 0x15, 0x96, 0xac, 0x18, 0x1e, 0x48, 0xf8, 0x95, 0xc5, 0xbc, 0x31,
-  0x39, 0x86, 0x8a, 0xc0, 0x86, 0xa2, 0x83, 0xe2, 0xd8, 0xc7, 0xad, 0xe6,
-  0xe2, 0xda, 0x2b, 0xc2, 0x29, 0x29, 0x67, 0xcb, 0x46, 0x43, 0x24, 0x7e,
-  0x7e, 0x62, 0xf7, 0xf1, 0x68, 0x32, 0xb4, 0xc4, 0x10, 0xcd, 0xfb, 0xc5,
-  0xfe, 0x0d, 0x33, 0xd0, 0xa9, 0xc8, 0xe6, 0xaa, 0xee, 0x57, 0x86, 0xd6,
-  0xed, 0xe1, 0xb0, 0x5f, 0x23, 0x1f, 0xba, 0xee, 0xb1, 0x21, 0xf1, 0x04,
-  0x2b, 0x55, 0x34, 0x10, 0x7b, 0xe1, 0xca, 0xf4, 0x32, 0x31, 0x6e, 0x5e,
-  0x7d, 0x81, 0x5d, 0x74, 0x07, 0x5f, 0x5f, 0x9e, 0xe3, 0xb4, 0x71, 0x9e,
-  0x90, 0x5f, 0x16, 0x31, 0x34, 0xa9, 0x8d, 0x2b, 0x81, 0xd3, 0x58, 0x98,
-  0x9f, 0x86, 0xec, 0x26, 0x21, 0x9d, 0x36, 0xc9, 0x32, 0x42, 0x34, 0x82,
-  0x8e, 0xf5, 0xdf, 0x11, 0x64, 0x05, 0xa9, 0x08, 0x1f, 0xe8, 0x09, 0x63,
-  0x52, 0xfe, 0x72, 0xb2, 0x3e, 0x97, 0x4f, 0x77, 0x15, 0xc8, 0x5e, 0x53,
-  0x4a, 0x80, 0xb0, 0x52, 0x6a, 0x4a, 0xc2, 0x91, 0xdd, 0x98, 0x41, 0xaf,
-  0xa7, 0x1f, 0xca, 0x4a, 0x8a, 0x6c, 0xd9, 0xba, 0x0c, 0x8f, 0xc8, 0x48,
-  0x82, 0x0c, 0x33, 0x71, 0xf8, 0x32, 0x1a, 0xf9, 0x8c, 0x19, 0x34, 0x87,
-  0xec, 0xe0, 0xca, 0xfa, 0x17, 0xac, 0x2f, 0x10, 0x0a, 0xd0, 0xee, 0x83,
-  0x84, 0x0c, 0xfa, 0x43, 0xbf, 0x64, 0x1b, 0x2c, 0x0f, 0x56, 0xf2, 0x70,
-  0xe2, 0x00, 0xfc, 0x4f, 0x65, 0x32, 0x28, 0x5f, 0x8e, 0xc9, 0x1b, 0x2e,
-  0x50, 0xb2, 0x4f, 0x0a, 0xa9, 0x05, 0x3d, 0xcc, 0xaa, 0xbb, 0xcd, 0xee,
-  0x9d, 0xc2, 0xfd, 0x53, 0x6d, 0xc5, 0xa0, 0x55, 0x9e, 0x03, 0x95, 0xd9,
-  0x8c, 0x1e, 0xf7, 0x16, 0xdf, 0xa9, 0x33, 0x99, 0xb5, 0xaf, 0x96, 0x9b,
-  0xa1, 0xfd, 0x58, 0x21, 0xef, 0x4d, 0xcb, 0xd3, 0x6d, 0x44, 0xcd, 0xc8,
-  0x65, 0xfe, 0xfe, 0x6a, 0x1a, 0xc2, 0x2c, 0x91, 0x19, 0xa8, 0xc9, 0xbd,
-  0x8e, 0x47, 0x38, 0x5e, 0x3f, 0xc7, 0xc2, 0x09, 0x5b, 0x88, 0x31, 0xe8,
-  0x4f, 0xee, 0xfd, 0x48, 0x9c, 0x05, 0x6d, 0x3c, 0xb2, 0x5d, 0x4b, 0xa3,
-  0x57, 0x21, 0x06, 0x8b, 0x67, 0x12, 0x31, 0xe1, 0x10, 0xf2, 0xfb, 0xd6,
-  0x53, 0x79, 0x73, 0x3b, 0xa6, 0xbe, 0x27, 0xd9, 0xbb, 0xeb, 0x26, 0x6f,
-  0xfe, 0x0e, 0x62, 0xf5, 0x5c, 0x1b, 0x2a, 0x26, 0x9e, 0xc6, 0xc6, 0xe9,
-  0x29, 0xa7, 0xb3, 0x4c, 0x98, 0xf4, 0x24, 0x19, 0x81, 0xbb, 0x47, 0x0e,
-  0x4d, 0x05, 0x4b, 0xb0, 0x9d, 0x11, 0xce, 0x43, 0x3f, 0x29, 0x14, 0x45,
-  0x5b, 0x49, 0xac, 0xf6, 0xc6, 0x7c, 0x8e, 0x08, 0x2b, 0xb7, 0x1d, 0xc0,
-  0x69, 0xc4, 0x0b, 0x92, 0xea, 0x55, 0xc9, 0xbb, 0xea, 0xc0, 0xab, 0x21,
-  0x15, 0xcc, 0xcb, 0x31, 0x21, 0x7b, 0x76, 0x1d, 0x0f, 0x8f, 0x1e, 0x22,
-  0x42, 0xae, 0x90, 0xbe, 0x6f, 0x06, 0x0b, 0x19, 0x5b, 0x9b, 0xd3, 0x51,
-  0x69, 0x2c, 0xbc, 0xae, 0x42, 0xe3, 0xac, 0x85, 0x1c, 0xdb, 0xf8, 0x99,
-  0xd4, 0xbf, 0xeb, 0x18, 0x13, 0xbb, 0x9f, 0x17, 0x76, 0xef, 0x30, 0xfe,
-  0xbc, 0x83, 0x0f, 0x53, 0x4e, 0x11, 0x79, 0xbd, 0x9c, 0xc6, 0xb3, 0xce,
-  0xdc, 0xee, 0x18, 0xc2, 0xf3, 0xbc, 0x59, 0x74, 0x9e, 0x30, 0x25, 0xe5,
-  0x7c, 0x31, 0x0b, 0x96, 0xb9, 0xf1, 0xc5, 0xe6, 0x1c, 0x2f, 0xff, 0x69,
-  0x0a, 0x0f, 0xcf, 0x9e, 0x07, 0x0b, 0xaf, 0x41, 0x91, 0x32, 0xca, 0x42,
-  0x9a, 0x3c, 0x9d, 0x19, 0xc8, 0xd6, 0x6f, 0xe3, 0xf8, 0x29, 0x7d, 0x84,
-  0x13, 0x97, 0xe3, 0x99, 0x3c, 0x6f, 0x18, 0xed, 0x76, 0x0a, 0x94, 0x1e,
-  0xe9, 0x41, 0xe4, 0xe9, 0x1c, 0x02, 0xb5, 0x9e, 0xc1, 0xc1, 0xf1, 0x8c,
-  0x7c, 0xbb, 0x0b, 0x8f, 0xb5, 0x59, 0x14, 0xfc, 0x0b, 0xa7, 0xcf, 0xb9,
-  0x8f, 0xa4, 0xbd, 0x93, 0x14, 0x7e, 0xef, 0x4b, 0xfe, 0x0e, 0x53, 0x24,
-  0x40, 0x6f, 0x0d, 0x53, 0x9e, 0xbf, 0xe5, 0x56, 0xbf, 0x07, 0x1c, 0x88,
-  0x5d, 0xc6, 0x47, 0x7f, 0x35, 0x34, 0x7f, 0xbc, 0x26, 0x7e, 0xe1, 0x76,
-  0x04, 0x33, 0x5f, 0xf6, 0xa5, 0xdf, 0x0a, 0x3f, 0xf6, 0x7e, 0xdb, 0x4d,
-  0x8f, 0x89, 0x3e, 0x9a, 0xf1, 0xf3, 0x18, 0xe2, 0x6e, 0x47, 0x81, 0x30,
-  0xf0, 0xde, 0xf9, 0x6b, 0x72, 0xe2, 0xcf, 0x07, 0x2a, 0x5c, 0x06, 0x63,
-  0xa4, 0x11, 0xc7, 0xf0, 0x67, 0x5f, 0xf8, 0xf1, 0x77, 0x38, 0xa3, 0xf7,
-  0xd8, 0xb2, 0xb1, 0x64, 0x11, 0xba, 0x2b, 0x93, 0xe8, 0xdd, 0xea, 0xcf,
-  0xd3, 0x5f, 0xdf, 0xc9, 0xd2, 0x34, 0x62, 0xf8, 0x89, 0x72, 0x0a, 0x3e,
-  0x9d, 0x64, 0x55, 0xe0, 0x6d, 0xe1, 0xe9, 0x0a, 0x85, 0x69, 0x55, 0x1c,
-  0x4b, 0x16, 0x2d, 0xe5, 0xf2, 0xd0, 0xff, 0x70, 0x7c, 0x3e, 0x9d, 0xd5,
-  0x6b, 0x92, 0x38, 0xde, 0x7f, 0x2d, 0x9b, 0x2c, 0xdf, 0x32, 0x51, 0xe9,
-  0x29, 0x67, 0xa4, 0xfc, 0x79, 0xf8, 0x76, 0x39, 0x56, 0x45, 0x03, 0x08,
-  0xcb, 0xec, 0x65, 0xf5, 0xe9, 0x4b, 0x1c, 0x1b, 0x20, 0x85, 0xd9, 0x87,
-  0x2f, 0xb8, 0xda, 0x17, 0x90, 0x14, 0xfd, 0x87, 0x51, 0x83, 0x17, 0x50,
-  0x51, 0xdf, 0x40, 0xa6, 0xc3, 0x6e, 0x8c, 0x5f, 0x7c, 0x22, 0xce, 0xcc,
-  0x80, 0x55, 0xc1, 0x37, 0xb0, 0xfa, 0x70, 0x48, 0x78, 0x21, 0x2b, 0x50,
-  0x8a, 0xbc, 0xca, 0xe2, 0x2f, 0xbe, 0x5c, 0xbc, 0xf6, 0x0b, 0x8b, 0x51,
-  0x9b, 0x99, 0x79, 0x47, 0x99, 0x8e, 0x81, 0xda, 0x9c, 0x28, 0x29, 0x65,
-  0xeb, 0xcc, 0x78, 0xc6, 0xfd, 0xf8, 0xc3, 0xa5, 0x3b, 0xe1, 0xf4, 0x4f,
-  0xdd, 0xcb, 0x8f, 0x43, 0x23, 0x09, 0xfb, 0x90, 0x80, 0xd8, 0x9a, 0xa1,
-  0xbc, 0xb0, 0x39, 0xcc, 0xbd, 0xf1, 0x2d, 0x08, 0x3a, 0x05, 0x72, 0x04,
-  0x85, 0xff, 0xe4, 0xea, 0xae, 0x38, 0x36, 0xc8, 0x17, 0x10, 0xb9, 0xa4,
-  0x81, 0x83, 0x9d, 0x29, 0xb4, 0x8f, 0x51, 0x16, 0xf2, 0x7d, 0x36, 0x73,
-  0x74, 0xad, 0x10, 0xc4, 0xe9, 0x13, 0x29, 0x9b, 0x8f, 0x4b, 0x90, 0x17,
-  0xbe, 0x16, 0xf2, 0xa4, 0x8a, 0x06, 0xf3, 0xb6, 0xf9, 0x1f, 0x9e, 0x09,
-  0x8f, 0x51, 0xf3, 0x1b, 0x87, 0xfd, 0x63, 0x47, 0x64, 0x15, 0xeb, 0x31,
-  0xb7, 0xea, 0xcb, 0xf7, 0xc2, 0x68, 0xec, 0xc6, 0xef, 0xe1, 0x62, 0x1f,
-  0x35, 0x5c, 0x72, 0x02, 0x38, 0xe5, 0xd6, 0xc5, 0xdd, 0x84, 0x8d, 0x88,
-  0x14, 0x89, 0x30, 0xff, 0xc8, 0x37, 0xbe, 0x7d, 0xd8, 0x8a, 0x44, 0xb4,
-  0x3b, 0x71, 0xe9, 0xe3, 0xd0, 0x5e, 0x9f, 0x81, 0x98, 0xe3, 0x0e, 0xee,
-  0xce, 0x99, 0xc2, 0xe4, 0x61, 0xcf, 0xb8, 0xb6, 0x69, 0x13, 0x6f, 0x5f,
-  0x79, 0x30, 0xde, 0x23, 0x8c, 0xc5, 0xa3, 0xf5, 0x79, 0xd1, 0xe5, 0xca,
-  0x3a, 0x8b, 0x24, 0xfa, 0x9e, 0xe8, 0xc3, 0x2c, 0x9d, 0x22, 0x9e, 0x4d,
-  0x9e, 0xc2, 0xd9, 0xd2, 0x0b, 0x48, 0x8f, 0x7d, 0x49, 0x4b, 0xce, 0x4e,
-  0xbc, 0x66, 0x95, 0x60, 0x6f, 0x6d, 0xca, 0xb5, 0x89, 0xc3, 0x69, 0xf5,
-  0x7b, 0x8d, 0x9f, 0x7a, 0x5f, 0x5e, 0x38, 0x78, 0xb1, 0xdb, 0xfc, 0x1a,
-  0x3a, 0x87, 0x1d, 0x69, 0x8a, 0x19, 0x48, 0xf1, 0xb6, 0xb9, 0xac, 0x9b,
-  0x64, 0xce, 0xb3, 0xcd, 0x47, 0x99, 0xbb, 0xf8, 0x11, 0xe6, 0x23, 0x3b,
-  0x90, 0x29, 0x09, 0x61, 0xe7, 0xf4, 0x7c, 0xd6, 0x25, 0xad, 0x45, 0xf0,
-  0xd4, 0xcd, 0x0a, 0xf9, 0xac, 0x87, 0xdc, 0xaa, 0x9c, 0x21, 0x1c, 0xa3,
-  0xc3, 0xcc, 0xf0, 0x19, 0x42, 0xf5, 0xe6, 0xd3, 0x6c, 0x2b, 0xea, 0x21,
-  0xf0, 0x95, 0x0c, 0x19, 0xb9, 0x21, 0xfc, 0x36, 0xe9, 0x64, 0x59, 0xab,
-  0x3a, 0x1f, 0xbd, 0xf7, 0x32, 0x45, 0xfb, 0x2d, 0xdb, 0x55, 0x6e, 0xb3,
-  0xe4, 0xee, 0x54, 0x86, 0x8d, 0x34, 0x23, 0x7f, 0xee, 0x51, 0x12, 0x5c,
-  0xe7, 0xf0, 0x71, 0x60, 0x1e, 0xe1, 0xaf, 0x26, 0x30, 0x43, 0x6f, 0x33,
-  0xd5, 0x0e, 0xcd, 0x0c, 0x55, 0x7b, 0x4e, 0x4b, 0xed, 0x30, 0xcc, 0x7e,
-  0xdc, 0x43, 0x7e, 0xc2, 0x11, 0x7a, 0x82, 0x6f, 0x12, 0x24, 0x5c, 0x8f,
-  0xb2, 0x1d, 0x05, 0x64, 0x6a, 0x2a, 0xb3, 0xbd, 0x3c, 0x1c, 0x8f, 0x3f,
-  0xbf, 0xe8, 0x39, 0xf4, 0x11, 0xe7, 0x44, 0x2f, 0x24, 0xbf, 0xdc, 0xe2,
-  0xa7, 0xe6, 0x78, 0xb6, 0xdf, 0x7d, 0xcf, 0xa5, 0xc9, 0xaa, 0x04, 0xad,
-  0x1a, 0x4a, 0x6b, 0x40, 0x25, 0x39, 0x73, 0x14, 0x38, 0x9c, 0x6a, 0xc6,
-  0xce, 0x7b, 0x1d, 0xbc, 0x3d, 0xe3, 0x8b, 0xd8, 0xdf, 0xc5, 0xb8, 0xad,
-  0x11, 0x25, 0xdb, 0xf9, 0x07, 0xb3, 0x7f, 0x4c, 0xc7, 0x20, 0x21, 0x84,
-  0xa7, 0xc5, 0xb9, 0x8c, 0x31, 0x5e, 0xcc, 0xea, 0xff, 0x2e, 0x31, 0xb1,
-  0xbd, 0x8a, 0xdb, 0x57, 0x8c, 0x09, 0x95, 0xf9, 0xc6, 0x88, 0xcf, 0x67,
-  0xb9, 0xfa, 0x2c, 0x8f, 0xc3, 0xde, 0xe3, 0xd9, 0x75, 0xfe, 0x03, 0x3e,
-  0xdf, 0xa7, 0x70, 0xfd, 0x95, 0x11, 0x9f, 0x6f, 0xd8, 0x13, 0xe9, 0xa5,
-  0xce, 0x89, 0xde, 0x14, 0x04, 0x5b, 0x9a, 0x85, 0x29, 0x6a, 0xae, 0x4d,
-  0x99, 0xfa, 0x08, 0xda, 0x06, 0x7d, 0xc5, 0x37, 0x7d, 0x03, 0x6b, 0x9c,
-  0x57, 0x90, 0x2b, 0x1e, 0xc3, 0xa4, 0xf3, 0xbb, 0x31, 0xb5, 0x3f, 0xc2,
-  0xae, 0xbe, 0x65, 0x3c, 0x2b, 0x1b, 0xc9, 0xf8, 0xcc, 0xab, 0x14, 0xbe,
-  0x5e, 0x4a, 0xcc, 0xa1, 0x75, 0x3c, 0x0f, 0xeb, 0x47, 0xbb, 0x71, 0x0d,
-  0xe7, 0xbe, 0x5e, 0x42, 0xff, 0xf6, 0x27, 0x16, 0xc5, 0x9e, 0x13, 0x7a,
-  0xc0, 0x1a, 0xae, 0xa7, 0xfc, 0xc2, 0xff, 0xf0, 0x12, 0xb4, 0x3f, 0xa4,
-  0x52, 0x7a, 0xda, 0x90, 0x59, 0x46, 0x13, 0xa9, 0xdd, 0xb2, 0x8b, 0x54,
-  0x89, 0x08, 0xdc, 0x90, 0x66, 0xca, 0x4b, 0x5f, 0x0c, 0x85, 0x37, 0xd8,
-  0xec, 0xb7, 0x14, 0xf5, 0xc1, 0x46, 0x3c, 0x7f, 0x3e, 0x8c, 0x18, 0x85,
-  0x44, 0x4c, 0x42, 0x16, 0xf0, 0xf8, 0xe1, 0x6a, 0xe6, 0xec, 0x29, 0x42,
-  0xf4, 0xa2, 0x03, 0xc5, 0xd9, 0x75, 0x4c, 0x7d, 0xee, 0x83, 0x65, 0x6b,
-  0x36, 0x7f, 0x26, 0x9c, 0x27, 0x7c, 0xc8, 0x2a, 0x96, 0x1c, 0xb0, 0x23,
-  0x39, 0xf6, 0x1e, 0x3d, 0x7d, 0x93, 0x99, 0xf0, 0x7a, 0x24, 0x51, 0x27,
-  0x8e, 0x52, 0xa0, 0xd3, 0xca, 0x10, 0x89, 0x09, 0x1c, 0x74, 0x73, 0x23,
-  0x39, 0xfc, 0x2f, 0x5d, 0x2a, 0x6a, 0x42, 0xac, 0x1e, 0x4b, 0xe5, 0xfa,
-  0x43, 0x58, 0x6a, 0xac, 0x64, 0xfa, 0xa0, 0xe7, 0xfc, 0x2e, 0xb8, 0xc2,
-  0x84, 0xb1, 0x4b, 0x69, 0x30, 0xc9, 0x66, 0x99, 0xf3, 0x69, 0x4a, 0x86,
-  0x8c, 0x65, 0x6a, 0x48, 0x0f, 0xc3, 0x84, 0xe1, 0x2d, 0x78, 0xad, 0x14,
-  0x86, 0xfa, 0xc8, 0xf7, 0x1c, 0x2e, 0x4c, 0x67, 0x67, 0xa0, 0x2d, 0x6f,
-  0xbb, 0xab, 0x18, 0xb4, 0x2e, 0x8f, 0xd8, 0x8f, 0x33, 0xa9, 0x5b, 0xf0,
-  0x1a, 0x8d, 0x63, 0x83, 0x38, 0xfc, 0x43, 0x97, 0x10, 0xb5, 0xff, 0xc8,
-  0x92, 0xde, 0x86, 0xe5, 0xb6, 0x48, 0xd6, 0xfc, 0xee, 0xa0, 0xff, 0xf3,
-  0xfd, 0xec, 0x49, 0x13, 0xe2, 0xe6, 0xce, 0xe5, 0x94, 0x0b, 0x6f, 0x4b,
-  0x6a, 0xca, 0x76, 0xea, 0x4f, 0x25, 0x23, 0xb2, 0xc8, 0x83, 0xf5, 0x12,
-  0xa2, 0xdc, 0xba, 0x50, 0xc2, 0xd1, 0x74, 0x1f, 0xa4, 0x97, 0xb6, 0x11,
-  0xfe, 0x68, 0x05, 0x5b, 0xb2, 0x1e, 0x33, 0xcc, 0xe9, 0x2f, 0x55, 0xc9,
-  0x16, 0xf8, 0x9b, 0xa6, 0x31, 0x36, 0x7f, 0x20, 0xb7, 0x55, 0xcb, 0x50,
-  0xdc, 0xb2, 0x17, 0xef, 0xd5, 0x6f, 0xd0, 0xf1, 0xdc, 0x4a, 0xea, 0x18,
-  0x3f, 0xce, 0x18, 0xff, 0xe4, 0x7b, 0x67, 0x1a, 0x8e, 0x7d, 0xb4, 0x38,
-  0xb1, 0x75, 0x0b, 0xcb, 0xf6, 0xc2, 0xb8, 0x87, 0x73, 0xb8, 0x67, 0xf2,
-  0x9c, 0x49, 0x6f, 0xc7, 0xb0, 0x61, 0x61, 0x33, 0x65, 0xd7, 0xcc, 0x59,
-  0xbe, 0xf1, 0x29, 0x0e, 0x72, 0xcb, 0xf8, 0xf9, 0x38, 0x91, 0xf7, 0xa9,
-  0xd6, 0xd8, 0xf4, 0xac, 0x23, 0x40, 0xa4, 0x80, 0xb9, 0xcb, 0xed, 0x30,
-  0xf4, 0x8c, 0xc2, 0xed, 0x46, 0x3d, 0x1f, 0x83, 0x86, 0xb2, 0xd8, 0xc5,
-  0x9a, 0x88, 0xc6, 0x7f, 0xdc, 0xd6, 0x75, 0x42, 0x22, 0x5e, 0x80, 0xf1,
-  0xec, 0x37, 0x5c, 0x7e, 0x5a, 0x84, 0xeb, 0xf6, 0xfd, 0xf4, 0x2e, 0x19,
-  0x84, 0xc0, 0xbf, 0xc3, 0x90, 0x98, 0x98, 0x5c, 0xfa, 0x1c, 0x71, 0xe2,
-  0x8a, 0x8e, 0x22, 0x4b, 0xa6, 0x04, 0x62, 0x71, 0xa9, 0x1f, 0x8c, 0xff,
-  0x8c, 0xc4, 0x43, 0x0b, 0xca, 0x52, 0xaf, 0xd3, 0xb6, 0x62, 0x0a, 0xa2,
-  0x6e, 0xdd, 0xcc, 0x8a, 0xf1, 0xe7, 0xe4, 0x7a, 0x71, 0x7a, 0x16, 0x96,
-  0x93, 0x22, 0x67, 0xc5, 0x61, 0x11, 0x5f, 0xb2, 0x8f, 0x4d, 0xc2, 0xaa,
-  0xa1, 0x8b, 0x53, 0x43, 0x0b, 0xe8, 0x7e, 0xf6, 0x0c, 0x67, 0xd3, 0x29,
-  0x28, 0xe6, 0x5d, 0xe0, 0xa7, 0xed, 0x5e, 0xe2, 0x15, 0xe7, 0xb0, 0x73,
-  0x70, 0x1d, 0x6f, 0xbf, 0x26, 0xa2, 0xeb, 0x3d, 0x18, 0x8d, 0x95, 0xb3,
-  0xf8, 0x31, 0xa9, 0x89, 0xdd, 0xc7, 0x1c, 0xb8, 0xfc, 0xdd, 0x93, 0x35,
-  0xe7, 0x63, 0xa9, 0x6b, 0x56, 0x43, 0x24, 0xe7, 0x2e, 0x1f, 0xff, 0x8e,
-  0x64, 0xff, 0xac, 0x08, 0xc6, 0x36, 0xf6, 0x63, 0xbd, 0x8f, 0x32, 0xaf,
-  0x16, 0x5d, 0x64, 0x98, 0xb4, 0x14, 0x09, 0xf1, 0x87, 0x78, 0xba, 0x5c,
-  0x94, 0xd3, 0xc1, 0x71, 0xb4, 0x7d, 0x3f, 0xc1, 0xb6, 0xed, 0x4a, 0xbc,
-  0x9c, 0xba, 0x0f, 0x9f, 0xea, 0x00, 0xfa, 0x84, 0xce, 0x26, 0x64, 0x67,
-  0x23, 0x4b, 0xe6, 0x3e, 0x44, 0xf9, 0x8d, 0x04, 0x65, 0xd6, 0xa7, 0x69,
-  0xb8, 0x7b, 0x83, 0x8b, 0x2d, 0x2d, 0xdc, 0x1c, 0x3e, 0x09, 0xef, 0x4d,
-  0x25, 0x0c, 0xee, 0xf5, 0xe2, 0xc5, 0x14, 0x55, 0xac, 0x33, 0x2e, 0x70,
-  0xee, 0xd8, 0x6a, 0xbe, 0xfe, 0xba, 0x44, 0x7f, 0x39, 0x0b, 0x34, 0xf2,
-  0x17, 0x73, 0x2d, 0x65, 0x32, 0x02, 0xe9, 0x97, 0xb1, 0x6c, 0xd8, 0x33,
-  0x86, 0xdf, 0x8f, 0x3a, 0x51, 0xb1, 0x9d, 0x4f, 0xd1, 0xed, 0x44, 0x32,
-  0x6b, 0xf6, 0xe3, 0xba, 0x69, 0x29, 0xde, 0xa7, 0x4b, 0x50, 0x50, 0xf2,
-  0x21, 0xb9, 0x31, 0x0e, 0xfd, 0x02, 0x63, 0xde, 0x0d, 0xbe, 0x83, 0x74,
-  0x8a, 0x1c, 0xaf, 0x1f, 0xce, 0x12, 0x2a, 0x71, 0x0b, 0x63, 0x67, 0xbe,
-  0xe6, 0x73, 0xf1, 0x28, 0x5e, 0x45, 0xb8, 0xb0, 0xc2, 0x7a, 0xbe, 0xf0,
-  0xa5, 0x36, 0x72, 0x7f, 0xec, 0x18, 0x6c, 0x2a, 0xde, 0x52, 0xd3, 0x73,
-  0x8b, 0x85, 0x6f, 0x6c, 0x18, 0x78, 0x40, 0x92, 0x2f, 0x73, 0x83, 0xb9,
-  0x19, 0x71, 0x10, 0xef, 0x26, 0x7d, 0x0a, 0xfa, 0xe6, 0x30, 0xe0, 0x89,
-  0x0c, 0x9f, 0x16, 0xe9, 0xb2, 0x79, 0x5f, 0x2b, 0x41, 0x03, 0x26, 0xb2,
-  0xf3, 0x4a, 0x17, 0x0f, 0x76, 0x6e, 0x60, 0x8a, 0xf8, 0x13, 0x6e, 0x85,
-  0x1f, 0x25, 0x3c, 0xa3, 0x8d, 0x05, 0xa5, 0x06, 0x64, 0xb8, 0x57, 0xd0,
-  0xd2, 0xdd, 0x84, 0xd3, 0xed, 0x5d, 0x0c, 0x50, 0xca, 0x43, 0x7d, 0xc4,
-  0x17, 0x0e, 0x3f, 0xb8, 0xc6, 0x88, 0x53, 0x7a, 0x5c, 0x6e, 0xfd, 0x8b,
-  0x9a, 0xb8, 0x80, 0xbc, 0x5c, 0x07, 0x36, 0xae, 0x0b, 0xe7, 0xfa, 0xd9,
-  0x76, 0x8e, 0xc9, 0x2c, 0x60, 0x40, 0x9c, 0x28, 0x3b, 0x1c, 0x97, 0x21,
-  0x33, 0x73, 0x23, 0x1d, 0xff, 0x85, 0xb2, 0x26, 0x2a, 0x87, 0xc2, 0xed,
-  0x52, 0xec, 0xeb, 0xfb, 0x14, 0xd5, 0xb2, 0x6f, 0x1c, 0xdf, 0xa8, 0x40,
-  0x6d, 0xd3, 0x75, 0xec, 0x44, 0x3f, 0x73, 0xdf, 0xb7, 0x12, 0x41, 0xa3,
-  0xda, 0x61, 0x9c, 0x8d, 0xde, 0xf0, 0x54, 0x64, 0x35, 0x9e, 0xef, 0x4f,
-  0x31, 0x4e, 0xf2, 0x05, 0xa1, 0xae, 0x5d, 0xa8, 0xfd, 0x92, 0x63, 0xd5,
-  0x40, 0x61, 0x42, 0x6f, 0x1f, 0xc5, 0xd6, 0xa0, 0x4f, 0x44, 0x98, 0x6a,
-  0xe0, 0xda, 0xeb, 0x48, 0xe9, 0xc9, 0x63, 0xd8, 0xed, 0x4e, 0x26, 0xf8,
-  0xfb, 0x12, 0x4c, 0xcc, 0x43, 0x89, 0xfe, 0x68, 0xc0, 0xb4, 0xa5, 0x37,
-  0x19, 0x9a, 0x19, 0xc3, 0x9c, 0x80, 0x6f, 0x9c, 0x77, 0x3e, 0xc3, 0xb8,
-  0xe9, 0x6b, 0x31, 0xf5, 0x82, 0xc0, 0xe5, 0xf2, 0x54, 0xc4, 0x6f, 0xe0,
-  0x50, 0x61, 0x07, 0x13, 0x47, 0x3e, 0x60, 0xa3, 0xb1, 0x0a, 0xb1, 0x77,
-  0xce, 0xa2, 0xba, 0xed, 0x27, 0x47, 0x2f, 0x56, 0x52, 0x31, 0xda, 0x1a,
-  0x0d, 0xc3, 0x20, 0x46, 0x54, 0x1d, 0xe4, 0xaf, 0xb6, 0x0e, 0x1b, 0x0b,
-  0xb2, 0x78, 0x6e, 0xe1, 0x84, 0xad, 0xe2, 0x3c, 0x7e, 0xe8, 0xe5, 0xa2,
-  0xf8, 0x3e, 0x00, 0x33, 0xd5, 0x15, 0xac, 0x11, 0x22, 0xef, 0x9d, 0x1a,
-  0x53, 0x22, 0x8f, 0x2c, 0xe0, 0xfa, 0x5a, 0x31, 0xf4, 0x2e, 0x47, 0xd2,
-  0xae, 0x59, 0xc2, 0x5b, 0x97, 0x5c, 0xf6, 0xfe, 0x96, 0x65, 0xd4, 0xa4,
-  0x74, 0x6a, 0x8e, 0x4c, 0xa6, 0xf7, 0xeb, 0x4b, 0x96, 0x2d, 0x39, 0x4e,
-  0x41, 0xe9, 0x65, 0xd4, 0x4e, 0xef, 0xc5, 0x5c, 0xee, 0x07, 0x57, 0x72,
-  0x17, 0xa1, 0xa8, 0x65, 0xc8, 0xdf, 0xcf, 0xee, 0x2c, 0x3d, 0x6b, 0xcb,
-  0xe3, 0x45, 0x5e, 0x5c, 0x88, 0x1c, 0xc2, 0xc4, 0x83, 0x01, 0xac, 0x5d,
-  0x69, 0x8f, 0x40, 0x4d, 0x66, 0x26, 0x59, 0x37, 0xfa, 0xa3, 0x85, 0x15,
-  0x5f, 0x4e, 0x96, 0xb2, 0x5e, 0x63, 0x18, 0xef, 0x43, 0x8d, 0x70, 0xd4,
-  0x4d, 0xe5, 0x5b, 0x56, 0x08, 0xff, 0x7d, 0x6e, 0x40, 0x73, 0x9e, 0x1b,
-  0x5d, 0x23, 0xfa, 0x30, 0xec, 0xc5, 0x73, 0x6e, 0xab, 0x7c, 0x63, 0xf9,
-  0xf2, 0x02, 0x14, 0x6f, 0x0f, 0xa4, 0x2a, 0x6e, 0x17, 0xf9, 0xa3, 0x1e,
-  0xe1, 0x79, 0xd0, 0x13, 0x07, 0x85, 0x57, 0x3c, 0x9e, 0xd7, 0x87, 0x2f,
-  0x49, 0xf6, 0xc2, 0x35, 0xb9, 0xc6, 0xbb, 0x1c, 0x4d, 0xa6, 0x0e, 0x78,
-  0x8a, 0xde, 0x2e, 0x2f, 0x92, 0x2c, 0xaf, 0x22, 0xf5, 0x59, 0x83, 0xd7,
-  0x01, 0xff, 0x21, 0x44, 0x3d, 0x56, 0x74, 0xc7, 0x21, 0x9d, 0xd1, 0x97,
-  0x1b, 0xf5, 0xf3, 0xf8, 0xea, 0x7f, 0x8d, 0x88, 0x29, 0xff, 0x91, 0x74,
-  0x74, 0x08, 0xc7, 0xbf, 0xb6, 0xa0, 0xe5, 0x22, 0xc7, 0xa8, 0x27, 0x5b,
-  0xb9, 0x37, 0xe4, 0x15, 0x6e, 0x7e, 0xa3, 0x09, 0x8a, 0x4a, 0xa6, 0x69,
-  0xc0, 0x6f, 0xc6, 0xec, 0x2e, 0xe3, 0xdf, 0xf5, 0xc3, 0x3c, 0xe6, 0x25,
-  0x93, 0x65, 0x6c, 0xb1, 0xda, 0xa2, 0x49, 0x51, 0xd9, 0x49, 0x3c, 0x63,
-  0x4d, 0x89, 0x1e, 0x74, 0x90, 0xf5, 0xd7, 0x56, 0x21, 0x5f, 0x65, 0x85,
-  0xf3, 0xc6, 0x6e, 0xce, 0xf7, 0x7f, 0xc0, 0xdb, 0x5f, 0xb2, 0x3c, 0x59,
-  0xff, 0x1f, 0x67, 0x84, 0x46, 0x2b, 0x78, 0x7a, 0x95, 0x58, 0xe9, 0x26,
-  0x72, 0x9c, 0x8a, 0x18, 0xa3, 0x32, 0x17, 0x8b, 0xec, 0xdf, 0xfc, 0xb2,
-  0x5e, 0x89, 0xf7, 0xb7, 0x7b, 0x08, 0x12, 0xca, 0x93, 0x18, 0x16, 0x0c,
-  0x41, 0x56, 0xd9, 0x6c, 0x4b, 0x8e, 0x40, 0x4c, 0x7e, 0x06, 0x8f, 0x4a,
-  0x8e, 0x13, 0x13, 0x77, 0x9f, 0xd1, 0xd3, 0x74, 0xe9, 0xeb, 0x31, 0x8b,
-  0xb3, 0x8f, 0x1f, 0x32, 0x2d, 0x22, 0x82, 0x8d, 0x37, 0x54, 0x38, 0x65,
-  0xb3, 0x89, 0xd4, 0xb1, 0xab, 0xf8, 0xf1, 0xea, 0x22, 0x2e, 0xa2, 0xbd,
-  0x08, 0x0c, 0xa7, 0xc1, 0xbf, 0x11, 0x98, 0xdf, 0x5f, 0x41, 0x5a, 0xcd,
-  0x2c, 0x56, 0x35, 0x97, 0xd3, 0x5f, 0xea, 0x10, 0x37, 0x42, 0x86, 0xe2,
-  0xd2, 0x19, 0xcb, 0x9f, 0x5a, 0x47, 0x72, 0xa7, 0xf4, 0x63, 0x6e, 0x72,
-  0x33, 0x4e, 0xd5, 0xb6, 0x84, 0xba, 0x0f, 0x67, 0x9b, 0xbc, 0x0e, 0xb5,
-  0xba, 0x05, 0x4c, 0xb2, 0xf2, 0x61, 0xef, 0xcf, 0x31, 0xac, 0xbd, 0x63,
-  0xc0, 0xcc, 0xf1, 0x97, 0x19, 0x52, 0x3f, 0x83, 0x77, 0x71, 0xd1, 0xf8,
-  0xce, 0xe9, 0x21, 0xce, 0xce, 0x93, 0xbe, 0x3f, 0xfa, 0x52, 0x9a, 0xba,
-  0x8f, 0x19, 0xda, 0x17, 0xb0, 0xa9, 0x1f, 0x8f, 0xa6, 0xba, 0x3f, 0x7b,
-  0xc2, 0x47, 0x70, 0xae, 0xdf, 0x4f, 0x64, 0x3f, 0x4c, 0x43, 0x67, 0xe6,
-  0x7b, 0x86, 0x18, 0x0f, 0xa3, 0xb3, 0xe9, 0x0b, 0xf3, 0x76, 0x54, 0x71,
-  0x75, 0x46, 0x10, 0x9f, 0xcf, 0x8f, 0xe2, 0x84, 0x9b, 0x1d, 0xc3, 0xae,
-  0xcc, 0x66, 0xe1, 0xfb, 0x33, 0x1c, 0x9a, 0xdd, 0xc6, 0x76, 0x0b, 0xa1,
-  0x19, 0x26, 0x4c, 0xc1, 0xf0, 0xfe, 0x58, 0x9c, 0x7a, 0x12, 0xb8, 0x2a,
-  0xb1, 0x11, 0xd1, 0xea, 0x67, 0x7c, 0x88, 0x93, 0x44, 0x50, 0x34, 0xd4,
-  0x1b, 0x53, 0xad, 0xc5, 0x28, 0x4c, 0xdd, 0x4b, 0x7e, 0xe3, 0x38, 0xae,
-  0x18, 0x34, 0x31, 0xbf, 0x63, 0x1b, 0x66, 0xbb, 0x3a, 0xc8, 0x16, 0x62,
-  0xee, 0x11, 0xe9, 0x2c, 0x1e, 0xae, 0xb3, 0x26, 0x61, 0x6f, 0x0f, 0x9f,
-  0x96, 0x9c, 0xe1, 0xc5, 0x87, 0x4c, 0xd4, 0x8f, 0x8d, 0x45, 0x32, 0xe4,
-  0x30, 0x97, 0xf6, 0x6e, 0x61, 0x5d, 0xa5, 0x70, 0xd7, 0x4f, 0x35, 0xf3,
-  0xdf, 0xb6, 0x2b, 0x48, 0xf7, 0x35, 0xc7, 0xdd, 0xe2, 0x3c, 0x45, 0xee,
-  0x2d, 0x68, 0x3e, 0x9c, 0x46, 0x94, 0xb0, 0x45, 0xc4, 0x7c, 0xf3, 0xd9,
-  0x3c, 0x66, 0x35, 0x67, 0xd6, 0x4c, 0xe4, 0xc9, 0xee, 0x70, 0x86, 0x88,
-  0xdd, 0x20, 0xbf, 0x74, 0x13, 0xc9, 0x27, 0x1b, 0xf0, 0x1b, 0xf6, 0x0f,
-  0x73, 0xf5, 0x9d, 0xbc, 0x89, 0x2c, 0x27, 0xcb, 0xb8, 0x89, 0xb2, 0x7e,
-  0x96, 0xd8, 0x2f, 0xf5, 0x47, 0x25, 0x4b, 0x97, 0xae, 0xff, 0x1e, 0xb3,
-  0xd2, 0x20, 0x93, 0xa3, 0x13, 0x34, 0x79, 0x59, 0x6c, 0x43, 0x92, 0xf7,
-  0x7b, 0x4e, 0x6e, 0x58, 0xc3, 0xc0, 0xc7, 0x39, 0xb4, 0x1e, 0x70, 0xe6,
-  0x52, 0x4e, 0x0a, 0xff, 0x05, 0x3d, 0x24, 0xe3, 0x64, 0x2c, 0x76, 0xcb,
-  0xe6, 0xe0, 0x7f, 0xf7, 0x2e, 0x22, 0xd2, 0x03, 0xb0, 0x7a, 0x7d, 0x83,
-  0xdc, 0x95, 0xeb, 0x30, 0x92, 0xac, 0xa4, 0x2b, 0x2b, 0x86, 0x6b, 0xa1,
-  0x96, 0xfc, 0x27, 0xa6, 0x8b, 0xe4, 0xab, 0x3c, 0xe6, 0xac, 0x38, 0xc7,
-  0x97, 0x13, 0xaf, 0xa8, 0x30, 0xdc, 0xc7, 0xf2, 0x39, 0x8a, 0x1c, 0xda,
-  0xf5, 0x11, 0xc1, 0x4e, 0x8f, 0xb5, 0xd4, 0xe4, 0x86, 0xd2, 0xe1, 0xf4,
-  0x95, 0xc3, 0x95, 0x1b, 0x68, 0x90, 0x48, 0xc2, 0xef, 0xd8, 0x22, 0x94,
-  0xfb, 0x57, 0xf1, 0xcb, 0x42, 0x49, 0x08, 0x26, 0x47, 0x58, 0xd7, 0xbd,
-  0x1e, 0xb9, 0xa4, 0x11, 0x38, 0xf4, 0x59, 0x8a, 0x68, 0x49, 0x13, 0xc7,
-  0x7e, 0x95, 0x61, 0x3d, 0x77, 0x2e, 0x0d, 0xab, 0x6b, 0x84, 0xf6, 0x25,
-  0x8f, 0xcf, 0x94, 0x00, 0xc2, 0xce, 0x3b, 0xa3, 0xbc, 0xe2, 0x37, 0x1d,
-  0x7f, 0xf2, 0xd8, 0x1a, 0x23, 0x4d, 0x8d, 0x50, 0x3a, 0x26, 0x18, 0x59,
-  0xf2, 0x29, 0x43, 0x9d, 0x92, 0xfb, 0x3d, 0x2c, 0xfb, 0x55, 0xc1, 0xf7,
-  0xc5, 0x9e, 0x28, 0x44, 0xb7, 0x62, 0xd8, 0xa2, 0xca, 0x82, 0x1b, 0x07,
-  0xf8, 0xfd, 0x72, 0x12, 0x02, 0xb7, 0x30, 0x64, 0x1f, 0x2d, 0xc6, 0x7d,
-  0x97, 0x07, 0xed, 0x01, 0x03, 0x08, 0xea, 0x2d, 0xc2, 0xc0, 0x73, 0x1c,
-  0x95, 0xa3, 0x36, 0xb2, 0x20, 0x6c, 0x16, 0x37, 0xf7, 0x7f, 0x47, 0xfc,
-  0xeb, 0x7d, 0x3a, 0x87, 0x4f, 0x66, 0xbd, 0x4a, 0x15, 0x55, 0x9d, 0x9b,
-  0xc8, 0xdd, 0x1e, 0xca, 0x81, 0x09, 0xf2, 0xcc, 0xac, 0x5d, 0x81, 0xb1,
-  0x84, 0x0d, 0xef, 0xda, 0x4f, 0x71, 0x2f, 0x61, 0x0f, 0x95, 0xee, 0x5a,
-  0x4c, 0xfb, 0xf7, 0x8e, 0xf8, 0xa2, 0xa3, 0x8c, 0xdb, 0x3a, 0x91, 0x12,
-  0xe5, 0xdb, 0x4c, 0xf6, 0x1e, 0x81, 0xce, 0x8f, 0x93, 0x04, 0xdb, 0xfd,
-  0xe5, 0xee, 0x04, 0x11, 0x7c, 0xd3, 0x16, 0x32, 0xa9, 0x21, 0x92, 0xb0,
-  0x73, 0x99, 0xcc, 0xfb, 0xb4, 0x15, 0xc1, 0xe8, 0xb5, 0x77, 0x88, 0xfa,
-  0xf3, 0x88, 0x19, 0x51, 0x13, 0x59, 0xe9, 0x57, 0x4b, 0xff, 0x79, 0x7d,
-  0xd9, 0x7b, 0xdf, 0x95, 0x17, 0x69, 0xe7, 0xd0, 0xd6, 0xbe, 0x48, 0x5a,
-  0xc0, 0x17, 0x9a, 0xe4, 0x0b, 0x79, 0xe0, 0x73, 0x05, 0x8d, 0x19, 0x5e,
-  0x44, 0x6c, 0x70, 0xe2, 0x71, 0xcc, 0x20, 0xbe, 0x4f, 0x0c, 0x61, 0xc6,
-  0xdd, 0xcf, 0xc8, 0x7c, 0x5b, 0x43, 0xe9, 0x88, 0xa3, 0x7c, 0xac, 0x1b,
-  0x80, 0xd3, 0xf5, 0x85, 0x24, 0xcc, 0x9c, 0xc8, 0xec, 0xbc, 0xf5, 0xf8,
-  0xef, 0xf8, 0x8e, 0x51, 0x5b, 0x0a, 0xbb, 0x5c, 0x83, 0x39, 0xd2, 0x6f,
-  0x3f, 0xd3, 0xeb, 0xc6, 0x12, 0x7f, 0xd6, 0x00, 0xaf, 0x8d, 0x09, 0xbc,
-  0x9f, 0x26, 0xac, 0x3c, 0xbb, 0x3b, 0x3c, 0x5a, 0xaa, 0x47, 0xf8, 0xe5,
-  0x54, 0xee, 0xb7, 0x4b, 0x30, 0x6f, 0xe4, 0x2f, 0x36, 0xa7, 0xdd, 0x46,
-  0xd4, 0xd2, 0x91, 0x74, 0x95, 0x4f, 0xec, 0xbd, 0x17, 0x4f, 0x73, 0xf3,
-  0x7f, 0x58, 0x2c, 0x94, 0x60, 0x97, 0xcd, 0x11, 0xc2, 0x6f, 0xc5, 0x22,
-  0x7f, 0x6e, 0x20, 0xf3, 0xe3, 0xe7, 0x62, 0xbe, 0xf8, 0x1b, 0xa3, 0xf4,
-  0x8e, 0xf2, 0xa7, 0x50, 0x84, 0xb0, 0x3d, 0xf5, 0x28, 0xce, 0xed, 0xc5,
-  0xcd, 0x6a, 0x12, 0x4b, 0x27, 0x5e, 0xa1, 0xe5, 0xcc, 0x05, 0x76, 0x2d,
-  0xf8, 0xcd, 0xaa, 0xff, 0x5c, 0xb8, 0xe0, 0xfc, 0x06, 0x97, 0x4f, 0x9a,
-  0x98, 0x2d, 0x4e, 0xe6, 0x67, 0x69, 0x05, 0x47, 0xa2, 0x76, 0x20, 0xe6,
-  0xba, 0x9e, 0x2d, 0x83, 0x3a, 0x78, 0xf5, 0xe0, 0x28, 0xff, 0x14, 0x85,
-  0x1c, 0x60, 0xf8, 0x7c, 0x0c, 0x3e, 0x82, 0xdd, 0x5c, 0x1f, 0x3f, 0x97,
-  0x2d, 0x9f, 0xfd, 0xe8, 0xd9, 0x7a, 0x9d, 0x5b, 0x2f, 0x7b, 0x90, 0xba,
-  0xb0, 0x82, 0x70, 0x35, 0x69, 0xd4, 0x3e, 0x39, 0x32, 0xa4, 0x6a, 0x1e,
-  0x87, 0xac, 0x5f, 0xd3, 0xdb, 0x20, 0x3c, 0xa4, 0x6b, 0x3f, 0xc9, 0xd8,
-  0x65, 0x88, 0xf1, 0xa0, 0x54, 0x02, 0xdf, 0xd9, 0xb3, 0x63, 0xcb, 0x70,
-  0xb4, 0x16, 0x15, 0x33, 0xc0, 0xa9, 0x16, 0xbd, 0x23, 0x19, 0xe4, 0x8d,
-  0xde, 0xce, 0xb0, 0xc6, 0x4a, 0x7a, 0x87, 0xed, 0x25, 0x55, 0x47, 0x1b,
-  0xc9, 0x38, 0x09, 0xea, 0xad, 0x73, 0xc8, 0x3c, 0x6a, 0x47, 0x3f, 0xd9,
-  0x4e, 0xac, 0x73, 0x35, 0xc8, 0xe1, 0x29, 0x12, 0x7d, 0xfc, 0x59, 0x19,
-  0xf2, 0x95, 0x1d, 0x13, 0x5f, 0xf3, 0x51, 0x6f, 0x2b, 0x89, 0x33, 0x67,
-  0xa1, 0xf3, 0x31, 0x92, 0xff, 0x4a, 0xb5, 0x88, 0x58, 0x31, 0x09, 0xb9,
-  0x3d, 0x07, 0x18, 0xd1, 0x27, 0x08, 0xff, 0xcb, 0x76, 0x42, 0x93, 0xd3,
-  0xa1, 0x68, 0xf5, 0x3f, 0x9a, 0x9a, 0x52, 0x49, 0x1b, 0xbc, 0x93, 0x33,
-  0xd7, 0x5f, 0xb1, 0xeb, 0x48, 0x31, 0x25, 0x6f, 0x8d, 0x10, 0x0d, 0xbf,
-  0xce, 0xda, 0xbe, 0x92, 0xf8, 0x3c, 0xaa, 0x66, 0xe4, 0x4d, 0x0b, 0x5e,
-  0x98, 0x8c, 0x25, 0x40, 0x74, 0x3e, 0x1d, 0xa9, 0x26, 0xf4, 0x5f, 0x3b,
-  0x88, 0xa6, 0xbc, 0xcf, 0xa4, 0xf5, 0x9b, 0x81, 0x9c, 0xc9, 0x21, 0x9e,
-  0xa9, 0xbe, 0x65, 0xed, 0x6f, 0x09, 0x6e, 0x6a, 0x17, 0x12, 0x6f, 0xa1,
-  0x4a, 0x9f, 0xcb, 0xf5, 0x08, 0xf6, 0xdb, 0xfd, 0x12, 0x76, 0x72, 0x02,
-  0xa5, 0x37, 0x85, 0x63, 0x6e, 0x5a, 0xcc, 0x25, 0x65, 0x6b, 0xf4, 0xdd,
-  0xa6, 0x52, 0xfe, 0x33, 0x9f, 0x93, 0x63, 0xcd, 0xf8, 0xe6, 0xf0, 0x1c,
-  0xd3, 0xec, 0x7e, 0xf8, 0xeb, 0x6e, 0xe5, 0x8e, 0x54, 0x14, 0xca, 0xee,
-  0x8f, 0x71, 0xa9, 0x54, 0x65, 0xe4, 0xb9, 0x7c, 0xf2, 0x0d, 0x96, 0xe0,
-  0xee, 0x15, 0xc7, 0x9f, 0x84, 0x6e, 0x52, 0x0b, 0x4d, 0xb0, 0xe8, 0xb8,
-  0xc0, 0x1b, 0xd3, 0x77, 0x1c, 0x0f, 0x3c, 0xc9, 0xf2, 0x93, 0xa2, 0x3c,
-  0xa8, 0x2a, 0xe2, 0xbc, 0xf2, 0x5b, 0x16, 0x7e, 0x9c, 0x4c, 0xd5, 0x9c,
-  0x17, 0xe8, 0x3d, 0x3c, 0xc5, 0xdf, 0x24, 0x01, 0x91, 0xfb, 0xb6, 0xa0,
-  0x66, 0xe8, 0xc4, 0xeb, 0x82, 0xc1, 0x4c, 0x6a, 0x52, 0xe0, 0xc4, 0xa9,
-  0x93, 0x48, 0xdd, 0xaa, 0xe4, 0xdf, 0x01, 0x03, 0xa6, 0x0f, 0x15, 0x76,
-  0x75, 0x74, 0x3a, 0x6d, 0x3f, 0xc5, 0xc8, 0x33, 0x6d, 0xe2, 0xf2, 0xf4,
-  0x5b, 0xfc, 0x3d, 0x2e, 0x87, 0xb6, 0xcc, 0x29, 0xdc, 0x9d, 0xd7, 0xd3,
-  0x77, 0x73, 0x1e, 0x5f, 0xfe, 0xca, 0xb0, 0x7c, 0xda, 0x19, 0x12, 0x46,
-  0x4d, 0xe7, 0xf9, 0xd5, 0x28, 0xb2, 0x7f, 0xbb, 0xd0, 0xbb, 0x62, 0x2d,
-  0x16, 0xcd, 0xa5, 0xa4, 0x5c, 0x68, 0x47, 0xfd, 0xab, 0x3f, 0x87, 0x8f,
-  0x67, 0xf0, 0x68, 0xfc, 0x03, 0x46, 0x5c, 0xb2, 0xc5, 0xf6, 0x6c, 0x18,
-  0xd1, 0xcf, 0x65, 0x98, 0x75, 0x74, 0x13, 0xef, 0x6e, 0x5e, 0x64, 0xf7,
-  0x98, 0xd3, 0x2c, 0xfa, 0xba, 0x8c, 0xfb, 0xde, 0xe6, 0x08, 0xde, 0xe4,
-  0x07, 0xa2, 0x73, 0xe8, 0x03, 0xe2, 0xf5, 0x62, 0x04, 0x5d, 0x39, 0xc6,
-  0x02, 0xdd, 0x91, 0x34, 0x0e, 0xab, 0x63, 0xeb, 0x43, 0x77, 0x26, 0x1a,
-  0xb6, 0xe2, 0x74, 0x34, 0x84, 0x94, 0x01, 0x19, 0x8c, 0xb9, 0xb8, 0x92,
-  0x86, 0xb6, 0x83, 0x58, 0x2d, 0x1a, 0x85, 0x48, 0x8f, 0x05, 0x6d, 0xe3,
-  0xda, 0xa9, 0xcd, 0x3e, 0xc9, 0xe4, 0xff, 0x94, 0x88, 0x16, 0x73, 0xa3,
-  0x52, 0x7e, 0x3a, 0xb2, 0x7a, 0x92, 0x84, 0x08, 0xb1, 0x77, 0x6a, 0x6a,
-  0x3c, 0x6e, 0xf3, 0x67, 0xf3, 0xe1, 0xef, 0x1f, 0x26, 0xe6, 0x9b, 0xb1,
-  0x29, 0x34, 0x9a, 0x7d, 0xfa, 0x2b, 0x39, 0x27, 0x99, 0x8e, 0xec, 0xb2,
-  0x77, 0x14, 0x7f, 0x2d, 0xc2, 0x63, 0xdc, 0x05, 0x36, 0x1e, 0x5e, 0x46,
-  0xc6, 0x93, 0x6c, 0xce, 0x0d, 0x4e, 0x40, 0xdf, 0xd6, 0x95, 0xec, 0x05,
-  0xd2, 0xd8, 0xd4, 0x9d, 0xa6, 0xf8, 0x64, 0x35, 0xab, 0x9e, 0xae, 0x61,
-  0xde, 0x8d, 0x79, 0x6c, 0x08, 0x32, 0xa5, 0xa6, 0xf0, 0x21, 0xd2, 0xdf,
-  0x3f, 0xb0, 0x6d, 0xb6, 0x0b, 0x77, 0xef, 0x0e, 0xe3, 0xe5, 0xe9, 0xa5,
-  0x28, 0x55, 0xfd, 0xe1, 0x88, 0x91, 0x2d, 0x0b, 0x6c, 0x3f, 0xb3, 0xed,
-  0xd4, 0x42, 0x62, 0x5c, 0x43, 0x18, 0x3c, 0xdd, 0x83, 0x07, 0xc3, 0xfa,
-  0x20, 0xb7, 0x6b, 0x17, 0xa6, 0x65, 0x93, 0xc9, 0x99, 0x59, 0x83, 0xef,
-  0xdf, 0x13, 0x2c, 0xde, 0xb2, 0x96, 0xa2, 0x11, 0xdf, 0x39, 0xf8, 0xfe,
-  0x16, 0x12, 0x3b, 0x95, 0xf8, 0xfd, 0xb8, 0x86, 0x80, 0xf0, 0xab, 0x28,
-  0x4c, 0x73, 0x45, 0x60, 0x6b, 0x30, 0x19, 0x35, 0x89, 0x25, 0x3c, 0x0b,
-  0x79, 0xc6, 0x9e, 0xde, 0x70, 0x8e, 0x7a, 0xfd, 0xe0, 0x4b, 0x9e, 0x16,
-  0x83, 0x83, 0x84, 0xf8, 0x9a, 0x32, 0x81, 0x82, 0x79, 0x33, 0xa9, 0x7e,
-  0xe5, 0x8d, 0xfa, 0x03, 0xb8, 0x78, 0xe6, 0x2d, 0x27, 0xa6, 0xe6, 0xf0,
-  0x30, 0x32, 0x80, 0xc4, 0xe5, 0xfd, 0x98, 0xef, 0x56, 0x85, 0xc1, 0xac,
-  0x0f, 0x0c, 0xf9, 0xbc, 0x05, 0xef, 0x0b, 0xe7, 0x58, 0xb4, 0x2b, 0x9f,
-  0xce, 0x29, 0x9f, 0x79, 0xde, 0xdf, 0x9d, 0x3e, 0xfb, 0x27, 0xb0, 0xd5,
-  0xe2, 0x1a, 0x71, 0x62, 0x67, 0xf9, 0xbd, 0x67, 0x08, 0xe2, 0x37, 0x3d,
-  0x78, 0xfb, 0x76, 0x26, 0x9a, 0xde, 0x72, 0xec, 0x7a, 0x6e, 0x44, 0x5b,
-  0xd4, 0x4f, 0x9e, 0xce, 0x50, 0x67, 0x80, 0x79, 0x2d, 0x9d, 0x89, 0x9b,
-  0x70, 0xec, 0xe9, 0xe5, 0xd9, 0x79, 0x11, 0x86, 0xe8, 0xdf, 0xc5, 0x4d,
-  0xc1, 0x96, 0xd7, 0x92, 0xc7, 0x10, 0x59, 0xfa, 0x8b, 0xdd, 0x76, 0xd1,
-  0x9c, 0x18, 0x22, 0x20, 0xfa, 0x3f, 0x55, 0x0c, 0x2e, 0x9c, 0x67, 0xd6,
-  0xf2, 0x6a, 0x42, 0xfb, 0x27, 0x60, 0x7a, 0xd1, 0x9d, 0x5f, 0x9f, 0xb3,
-  0x19, 0xbd, 0x68, 0x08, 0xcd, 0xe3, 0x0a, 0x50, 0x7d, 0xd0, 0xc8, 0xf1,
-  0x1a, 0x35, 0xda, 0x12, 0x6f, 0xb1, 0xc2, 0xbc, 0x8e, 0x37, 0xda, 0x51,
-  0x4c, 0xa9, 0xd7, 0xe2, 0xaf, 0xdb, 0x50, 0xd6, 0x5f, 0x4f, 0xe2, 0xa3,
-  0x4a, 0x25, 0x57, 0x56, 0xce, 0x45, 0xc5, 0xcf, 0x91, 0x87, 0xf3, 0xbb,
-  0x31, 0x1d, 0x28, 0x20, 0xa3, 0xa9, 0x1c, 0xc1, 0xc9, 0xf6, 0x9b, 0x5c,
-  0xae, 0xdc, 0xce, 0xaf, 0x99, 0x72, 0x18, 0xdb, 0xdf, 0x21, 0x75, 0x80,
-  0x09, 0xd3, 0x96, 0x38, 0x71, 0xf3, 0xdd, 0x40, 0x22, 0xb6, 0x64, 0xd3,
-  0xdd, 0x6d, 0x48, 0x7f, 0xa5, 0x07, 0xec, 0x70, 0x1e, 0xc2, 0x3a, 0x33,
-  0x65, 0x7e, 0x0f, 0xd2, 0x42, 0x7b, 0xfb, 0x4e, 0xce, 0x36, 0x27, 0x0b,
-  0xa7, 0x64, 0x2d, 0x39, 0x96, 0xd2, 0xbc, 0x3b, 0x73, 0x83, 0xbd, 0x3a,
-  0x0b, 0xd8, 0xf2, 0xfb, 0x21, 0xd7, 0xdf, 0x88, 0x60, 0x78, 0xcb, 0x9a,
-  0xdc, 0xd8, 0x97, 0xf8, 0xae, 0xd4, 0x43, 0x5d, 0x7e, 0x37, 0xe5, 0x9d,
-  0x4f, 0xb9, 0x19, 0x7f, 0x1f, 0xaf, 0xcd, 0x90, 0x32, 0xc4, 0x95, 0xc1,
-  0xf6, 0x57, 0x50, 0xd7, 0x18, 0xc1, 0xc5, 0xac, 0x63, 0x8c, 0x6f, 0x2d,
-  0xe5, 0xc1, 0xf2, 0xc9, 0x2c, 0x1a, 0xbd, 0x92, 0xe8, 0xfb, 0x6f, 0x51,
-  0x70, 0x08, 0xc5, 0x2f, 0x65, 0x3a, 0xf1, 0xef, 0xc7, 0xf3, 0xdb, 0xbd,
-  0x80, 0x1b, 0xff, 0x9c, 0x50, 0x9c, 0x94, 0xc9, 0xa3, 0xe4, 0x2d, 0x74,
-  0x98, 0xfd, 0x24, 0xe5, 0x80, 0x12, 0xc3, 0xcb, 0x36, 0xb1, 0x6f, 0xe2,
-  0x5b, 0xd2, 0x77, 0xaf, 0x26, 0xe0, 0xb5, 0x3c, 0x65, 0x59, 0xc9, 0xac,
-  0x5b, 0x67, 0x87, 0xf3, 0x39, 0x09, 0x42, 0x15, 0x74, 0xb9, 0xf6, 0xeb,
-  0x0b, 0xf6, 0xb7, 0x2c, 0xb9, 0x24, 0x3d, 0x81, 0xbd, 0xa1, 0x30, 0xda,
-  0x60, 0x2f, 0x81, 0xdf, 0xa5, 0xd8, 0x52, 0x74, 0x8e, 0x95, 0x29, 0xda,
-  0x1c, 0x35, 0x3b, 0xce, 0x60, 0x17, 0x69, 0xbe, 0x5e, 0x34, 0x44, 0xb0,
-  0x46, 0xeb, 0x14, 0xe7, 0xb7, 0xfc, 0x61, 0xc0, 0x84, 0x03, 0xdc, 0x2b,
-  0xb8, 0xca, 0xd8, 0x17, 0xb3, 0xa9, 0x74, 0x7e, 0xcf, 0xe9, 0xa9, 0x7e,
-  0xb8, 0x8d, 0xac, 0x64, 0x71, 0x44, 0x3b, 0xef, 0xf4, 0xb6, 0x10, 0x94,
-  0xb9, 0x8f, 0xfc, 0xf6, 0x4b, 0x4c, 0x2f, 0x2d, 0x43, 0x26, 0xb1, 0x8d,
-  0x8f, 0xd7, 0x66, 0xe3, 0x31, 0xc9, 0x83, 0x11, 0x82, 0x28, 0xfe, 0xdd,
-  0xab, 0xa7, 0x38, 0xc5, 0x91, 0x59, 0x92, 0xeb, 0x89, 0x38, 0xd2, 0x89,
-  0xa4, 0xcd, 0x19, 0x76, 0xb7, 0xdc, 0xe2, 0x6b, 0xe1, 0x42, 0xc6, 0xd4,
-  0x7c, 0x67, 0xcd, 0x51, 0x69, 0xa6, 0x2d, 0xb0, 0x65, 0xcb, 0x54, 0x4d,
-  0x3a, 0x82, 0x82, 0x31, 0x2c, 0xca, 0x25, 0xaf, 0xab, 0x01, 0x9f, 0xfe,
-  0xdb, 0x59, 0xed, 0x74, 0x8e, 0x03, 0x01, 0xe3, 0x98, 0xa1, 0x72, 0x8d,
-  0xc6, 0x6a, 0x07, 0xbe, 0xb6, 0x2f, 0x42, 0x7b, 0x76, 0x32, 0x9b, 0x2c,
-  0xdf, 0x30, 0xa3, 0x5c, 0x9c, 0x60, 0xbd, 0x33, 0x34, 0x7b, 0xbf, 0x64,
-  0xb0, 0xc6, 0x72, 0x96, 0x34, 0x7a, 0x72, 0x4a, 0x4a, 0x48, 0x79, 0xbf,
-  0xe7, 0xf1, 0x38, 0xad, 0x3f, 0x2b, 0x67, 0x3d, 0xa1, 0x5f, 0xd8, 0x09,
-  0xee, 0x88, 0x9a, 0x32, 0xf1, 0xc8, 0x5f, 0xaa, 0xdf, 0xf9, 0x22, 0x31,
-  0x3f, 0x81, 0x1f, 0x7b, 0x0f, 0x30, 0xf0, 0xf4, 0x43, 0xe6, 0xf7, 0xf1,
-  0xa3, 0xf6, 0x59, 0x36, 0x77, 0xe6, 0x35, 0xd3, 0x37, 0xc6, 0x84, 0xf6,
-  0x21, 0x85, 0xbc, 0x56, 0xa8, 0x27, 0xaa, 0xc7, 0x86, 0xbc, 0x9c, 0x56,
-  0xc6, 0x8c, 0x8b, 0x41, 0xb0, 0xf7, 0x48, 0x2d, 0xcd, 0xd7, 0x06, 0xa0,
-  0xe2, 0xbb, 0x8a, 0x9d, 0xd1, 0x5f, 0xd0, 0x31, 0x19, 0x8e, 0xc5, 0x67,
-  0x5b, 0xea, 0xce, 0xc4, 0x20, 0x79, 0x6b, 0x39, 0x26, 0xcf, 0x24, 0x51,
-  0x1a, 0x32, 0x9f, 0x43, 0xa7, 0x5e, 0x72, 0x4d, 0xd3, 0x8b, 0xa1, 0x07,
-  0x8d, 0xd9, 0x2d, 0x2d, 0x4b, 0xa9, 0xfe, 0x2b, 0xae, 0x7a, 0xde, 0x45,
-  0x97, 0x21, 0x28, 0xed, 0xf9, 0x47, 0xc0, 0x73, 0x59, 0x44, 0x35, 0x52,
-  0x68, 0x34, 0x9a, 0xcc, 0xa3, 0x40, 0x17, 0x96, 0xcc, 0x14, 0x27, 0x69,
-  0x74, 0x04, 0xb5, 0x67, 0x26, 0x11, 0xb6, 0x2e, 0x89, 0x03, 0x15, 0x1f,
-  0x28, 0x68, 0x1b, 0x88, 0xfc, 0x78, 0x73, 0x82, 0x52, 0xa6, 0xf0, 0x66,
-  0xf5, 0x1a, 0xb6, 0x1d, 0xef, 0x47, 0xcf, 0x9b, 0x4f, 0x5c, 0x49, 0x8b,
-  0xc5, 0x72, 0xe3, 0x61, 0x8e, 0xed, 0xff, 0xc6, 0xb0, 0xfe, 0x15, 0xdc,
-  0x3e, 0x63, 0x4e, 0xc5, 0x9d, 0x6e, 0x24, 0x23, 0xd6, 0x61, 0x23, 0xaa,
-  0xce, 0x9a, 0x56, 0xa1, 0xef, 0x67, 0xb5, 0x09, 0x85, 0x49, 0x92, 0x1d,
-  0x81, 0x19, 0xc8, 0xad, 0x09, 0x60, 0xba, 0xe7, 0x2e, 0xbe, 0x58, 0x45,
-  0xe2, 0x50, 0xd4, 0x2e, 0x84, 0xf8, 0xa9, 0x24, 0x98, 0x55, 0xd3, 0x24,
-  0xa5, 0xc1, 0xd2, 0x6b, 0x32, 0x58, 0x3e, 0x31, 0xe4, 0xec, 0xda, 0xfe,
-  0x3c, 0xda, 0xaa, 0xce, 0x89, 0x16, 0x3b, 0x94, 0x3c, 0xa6, 0x90, 0xee,
-  0x18, 0x89, 0xe6, 0x1b, 0x51, 0x1c, 0x3d, 0xd3, 0x98, 0x51, 0x23, 0x0c,
-  0xcf, 0x55, 0x79, 0x68, 0x94, 0xce, 0x47, 0x60, 0x26, 0x62, 0x49, 0x49,
-  0x5d, 0x01, 0x2f, 0xff, 0x4c, 0xc7, 0x6b, 0x5e, 0x20, 0x48, 0xbf, 0xe0,
-  0x62, 0x6a, 0x11, 0xb3, 0x56, 0x28, 0xd2, 0xe9, 0x7e, 0x84, 0xe4, 0x4f,
-  0x8d, 0x3c, 0xda, 0x19, 0xca, 0xe6, 0x09, 0xa9, 0x7c, 0x7f, 0x3d, 0x9a,
-  0xea, 0x59, 0x5d, 0x18, 0x57, 0x9d, 0xe7, 0xc2, 0x17, 0x2b, 0x66, 0x87,
-  0xed, 0xa5, 0x4e, 0x5d, 0x87, 0x4d, 0x1b, 0x37, 0x12, 0x3f, 0xde, 0x0b,
-  0xf7, 0x4b, 0x61, 0xac, 0xad, 0xa8, 0xa1, 0x6b, 0x88, 0x36, 0xca, 0x3f,
-  0x0b, 0x39, 0xea, 0xd8, 0x88, 0x69, 0xfa, 0x71, 0x9a, 0xfb, 0xe8, 0x23,
-  0xb2, 0xfd, 0x34, 0xd5, 0xd9, 0x35, 0x2c, 0xdb, 0x1f, 0xc3, 0xbe, 0xda,
-  0x6f, 0x8c, 0xd8, 0x50, 0xc8, 0x64, 0xf9, 0x7d, 0x3c, 0x2f, 0x5b, 0x48,
-  0x1f, 0x89, 0x2a, 0x4a, 0x35, 0x0c, 0x08, 0x6a, 0x19, 0xc4, 0xfa, 0x4b,
-  0x0a, 0x5c, 0xd5, 0x3d, 0x49, 0xe7, 0x28, 0x57, 0xf6, 0x4e, 0x8f, 0xe5,
-  0xbf, 0xbd, 0x8f, 0xc9, 0x8b, 0xdf, 0xc9, 0x1c, 0xb9, 0x24, 0xfe, 0x3d,
-  0x70, 0xc3, 0x6c, 0x86, 0x1e, 0x71, 0x4f, 0x1f, 0x92, 0xf3, 0xf5, 0x23,
-  0x9e, 0xa3, 0x47, 0xa2, 0xa1, 0xad, 0xcd, 0xef, 0x44, 0x67, 0x4e, 0x4f,
-  0x0b, 0x62, 0xa6, 0xfd, 0x0d, 0x0e, 0x7f, 0x6b, 0xa2, 0x30, 0xe6, 0x01,
-  0xe3, 0x26, 0xfd, 0x64, 0x6d, 0x71, 0x2a, 0xad, 0x57, 0x5e, 0x62, 0x26,
-  0xb3, 0x9c, 0x83, 0xb9, 0x27, 0x29, 0xd3, 0x6c, 0x67, 0xac, 0x8d, 0x1b,
-  0x7e, 0x33, 0xd6, 0xf1, 0x37, 0x20, 0x94, 0xcc, 0x5d, 0x32, 0x08, 0x62,
-  0x3f, 0xbc, 0x67, 0xf8, 0xe4, 0x3d, 0xcc, 0xd5, 0xbb, 0x4c, 0xc8, 0x81,
-  0x13, 0xe4, 0x54, 0x98, 0x21, 0xe8, 0x5c, 0xc4, 0xee, 0x3e, 0x7f, 0xb9,
-  0x63, 0xee, 0xc8, 0x4a, 0xb5, 0x9b, 0x9c, 0xbc, 0x3f, 0x9d, 0xb1, 0x31,
-  0x3b, 0x88, 0xfd, 0xb9, 0x9a, 0x25, 0x01, 0x02, 0x7c, 0xad, 0x32, 0xf9,
-  0x35, 0x6c, 0x32, 0x7d, 0x56, 0x9c, 0xc1, 0xfe, 0x55, 0x35, 0xf9, 0x37,
-  0x8a, 0xf9, 0xe6, 0x3b, 0x93, 0xf1, 0xed, 0x1f, 0x49, 0x53, 0x96, 0xc4,
-  0x26, 0xcb, 0x18, 0xff, 0x97, 0xdd, 0xdc, 0x59, 0x62, 0x85, 0x74, 0xd4,
-  0x4c, 0x76, 0xf4, 0x3e, 0x12, 0xaa, 0x71, 0x16, 0xbd, 0x3a, 0xfb, 0x49,
-  0x18, 0x3c, 0x8f, 0x1c, 0xbf, 0x31, 0xbc, 0x9f, 0xed, 0xcd, 0xf9, 0xd8,
-  0x4c, 0xb4, 0xb6, 0x59, 0x92, 0xf9, 0xa7, 0x9b, 0xb1, 0xb7, 0xd4, 0x68,
-  0xf6, 0xca, 0xc3, 0xee, 0xf1, 0x05, 0x14, 0xed, 0x96, 0xb1, 0xf0, 0xb7,
-  0x34, 0x27, 0xdf, 0xdc, 0x24, 0xf6, 0x49, 0x33, 0xe3, 0xb6, 0x6c, 0x24,
-  0xbd, 0x33, 0x8c, 0xc0, 0xa1, 0x42, 0xb1, 0xd9, 0xd0, 0xcb, 0x7f, 0x97,
-  0x66, 0xa0, 0x2f, 0xd8, 0x4c, 0x78, 0xee, 0x1d, 0xc4, 0x5c, 0xae, 0xf2,
-  0xe4, 0x53, 0x29, 0x92, 0xe5, 0x23, 0x30, 0x0e, 0xde, 0x42, 0xf6, 0x40,
-  0x65, 0xfe, 0x2d, 0xdd, 0x43, 0xf2, 0x89, 0x30, 0xec, 0x7a, 0x3d, 0x88,
-  0x50, 0x1b, 0xc5, 0xec, 0x8d, 0x15, 0x74, 0xfd, 0xd8, 0x4c, 0x42, 0x7f,
-  0x79, 0x61, 0x90, 0x3e, 0x63, 0x6b, 0xdb, 0x30, 0xfa, 0x49, 0xf6, 0xe2,
-  0x7e, 0xc5, 0x03, 0xc1, 0x4a, 0x73, 0x2d, 0x5a, 0x43, 0x25, 0xb0, 0x1d,
-  0xf1, 0x04, 0xb9, 0x5c, 0x39, 0xd6, 0xdb, 0xde, 0xe2, 0xc3, 0xc4, 0x7e,
-  0x1c, 0x3d, 0x9f, 0xc8, 0xb0, 0x24, 0x23, 0xce, 0x3f, 0x1e, 0x42, 0x9b,
-  0xce, 0x0f, 0xe6, 0x9a, 0x56, 0x33, 0xa8, 0xdf, 0x5d, 0x1a, 0x72, 0xdc,
-  0x71, 0x71, 0xfc, 0x80, 0x42, 0x81, 0x06, 0x37, 0x2e, 0xfe, 0xe4, 0xf8,
-  0x81, 0x78, 0x16, 0x89, 0xf5, 0xa7, 0xba, 0xf9, 0x26, 0xce, 0x76, 0xb6,
-  0xa8, 0xbb, 0xb9, 0x0b, 0xa1, 0xe5, 0x12, 0x03, 0xbc, 0xd2, 0x59, 0x6e,
-  0xde, 0x87, 0xef, 0x8a, 0x4e, 0x5c, 0x3f, 0x24, 0x4b, 0x94, 0xea, 0x72,
-  0xbc, 0xc3, 0xc5, 0x19, 0x6a, 0xd5, 0x83, 0xf9, 0x0f, 0xe1, 0x8d, 0xde,
-  0x7b, 0xc5, 0xb1, 0xe6, 0x89, 0x98, 0x2c, 0x4b, 0xe0, 0x7b, 0xe8, 0x30,
-  0xe1, 0x6d, 0x9f, 0x61, 0x96, 0xe1, 0x36, 0xaa, 0xe4, 0x5e, 0x11, 0x7e,
-  0xa3, 0x8d, 0x7e, 0x4b, 0x8a, 0x79, 0x7b, 0x5c, 0x0c, 0x63, 0xfd, 0xc5,
-  0x4c, 0x0e, 0x99, 0x4a, 0xab, 0xf6, 0x3d, 0x8e, 0x79, 0xd4, 0xa0, 0xf5,
-  0x41, 0x93, 0x0f, 0x4e, 0x42, 0x6d, 0x5f, 0x28, 0x47, 0xf1, 0x2b, 0x0f,
-  0xdc, 0x7c, 0x8d, 0x48, 0x97, 0xed, 0xcb, 0xeb, 0x55, 0x75, 0x4c, 0x38,
-  0x7c, 0x9c, 0xa8, 0xfa, 0xaf, 0xec, 0xdd, 0xbc, 0x98, 0x29, 0x77, 0x87,
-  0xd2, 0x20, 0xae, 0x87, 0x44, 0xe8, 0x25, 0xee, 0xea, 0x76, 0x33, 0xc8,
-  0x2f, 0x87, 0xff, 0xca, 0x17, 0x13, 0x92, 0x9e, 0xc8, 0x7b, 0xa3, 0x1d,
-  0x3c, 0xc8, 0x2f, 0x41, 0x71, 0xe1, 0x75, 0x04, 0x67, 0x9f, 0x6e, 0xa0,
-  0x72, 0x77, 0x24, 0xd7, 0x12, 0x7f, 0xe3, 0xf6, 0x72, 0x35, 0xd5, 0x3e,
-  0xaf, 0x59, 0xba, 0x78, 0x3f, 0xa5, 0x8d, 0x2d, 0x4c, 0xdc, 0x13, 0xc0,
-  0xcb, 0x7f, 0x25, 0xd8, 0x8d, 0x11, 0xd6, 0xa1, 0xa7, 0x26, 0x99, 0x57,
-  0x4f, 0xa3, 0xb7, 0x66, 0x03, 0xd6, 0x4a, 0x15, 0x54, 0x7e, 0x90, 0xe0,
-  0xd3, 0x58, 0x7b, 0xa4, 0x1e, 0x29, 0x10, 0x25, 0x1c, 0x29, 0x43, 0xed,
-  0x0e, 0x86, 0x44, 0x2c, 0xa6, 0xb5, 0x7f, 0x25, 0xe7, 0x8b, 0x15, 0x79,
-  0x9d, 0xe0, 0x83, 0xeb, 0xa7, 0x3c, 0x9e, 0x0e, 0x6f, 0x47, 0x35, 0x3f,
-  0x04, 0x43, 0xc3, 0x16, 0xe4, 0xca, 0x52, 0x78, 0x2c, 0x55, 0x82, 0xc3,
-  0x65, 0x43, 0x7e, 0x39, 0x2f, 0xe5, 0xbe, 0x74, 0x28, 0x0a, 0x87, 0xcb,
-  0xb8, 0x24, 0x58, 0xc5, 0xe9, 0xda, 0xb7, 0xe8, 0xee, 0xdd, 0xcb, 0x5f,
-  0xf1, 0xcb, 0x1c, 0x78, 0xaf, 0x42, 0xe1, 0x15, 0x2b, 0x96, 0x29, 0x9d,
-  0xe3, 0x8f, 0x88, 0x27, 0x3b, 0x6f, 0x77, 0x32, 0x6c, 0xb6, 0x0c, 0x4f,
-  0x6b, 0xb6, 0xb1, 0xef, 0x74, 0x26, 0x33, 0x33, 0x1b, 0xd8, 0x6e, 0x1d,
-  0x4f, 0xcf, 0xe4, 0x56, 0x96, 0x47, 0xce, 0x23, 0xc8, 0xb4, 0x9b, 0xb9,
-  0xd9, 0xd1, 0xd8, 0xce, 0x5a, 0xc3, 0xd7, 0x67, 0x97, 0xe9, 0x33, 0x3a,
-  0x8f, 0x25, 0xe9, 0x96, 0x54, 0xed, 0xff, 0x84, 0xee, 0x7b, 0x35, 0x7c,
-  0x5f, 0xec, 0xc6, 0x51, 0xb9, 0x8f, 0xf0, 0x7d, 0x02, 0x59, 0x2e, 0x34,
-  0xc7, 0xff, 0xff, 0xfd, 0x26, 0x69, 0xff, 0x29, 0x7e, 0x22, 0x74, 0x11,
-  0x55, 0xb1, 0x56, 0x36, 0x2c, 0x3b, 0xc8, 0xc0, 0x76, 0x75, 0xbe, 0xab,
-  0xed, 0x20, 0x71, 0x43, 0x18, 0xd3, 0x4b, 0x46, 0xb3, 0x45, 0x7c, 0x16,
-  0xe9, 0x47, 0x56, 0x60, 0xa4, 0x72, 0x94, 0xfd, 0xc2, 0xd1, 0x9a, 0xfa,
-  0x3e, 0x96, 0xde, 0x27, 0x6d, 0x04, 0xef, 0x57, 0xe3, 0x4a, 0xcf, 0x65,
-  0xd4, 0x16, 0xd5, 0xb3, 0xe2, 0xe4, 0x05, 0xfc, 0x6d, 0x3c, 0xf9, 0xf3,
-  0xf3, 0x3e, 0x53, 0xf3, 0x5d, 0xb8, 0xbd, 0x21, 0x90, 0x93, 0x0d, 0x83,
-  0x31, 0x9d, 0xd5, 0x80, 0x92, 0x50, 0x99, 0x13, 0x9e, 0xce, 0x67, 0x44,
-  0xc0, 0x7f, 0x04, 0xa4, 0x6c, 0xa4, 0xf8, 0xfb, 0x36, 0x0e, 0x79, 0x4e,
-  0xa2, 0xed, 0x9d, 0x3f, 0x2b, 0x34, 0x73, 0x49, 0x9e, 0x22, 0xca, 0xc8,
-  0xea, 0x76, 0x9e, 0x6c, 0xf2, 0x60, 0x6b, 0xf2, 0x68, 0xc4, 0xda, 0x6e,
-  0x92, 0x5b, 0xb8, 0x80, 0xa4, 0xc8, 0x01, 0x8c, 0xb2, 0x34, 0xc2, 0xda,
-  0x1f, 0x6e, 0x38, 0xee, 0xe6, 0x6c, 0x69, 0x15, 0x65, 0xbd, 0x09, 0x24,
-  0xa5, 0xb8, 0x63, 0x39, 0x62, 0x1d, 0x77, 0x26, 0x04, 0x13, 0xd9, 0x25,
-  0x46, 0xca, 0xda, 0x3d, 0x28, 0x55, 0x3c, 0x66, 0x53, 0x93, 0x12, 0xcd,
-  0x92, 0xfe, 0xdc, 0xed, 0xb1, 0xc3, 0xf3, 0xb2, 0x2a, 0x7a, 0xbb, 0xc7,
-  0x53, 0xd2, 0xf1, 0x88, 0x73, 0xfa, 0xa7, 0x38, 0xbc, 0xe0, 0x0d, 0xbf,
-  0xec, 0x26, 0x92, 0x92, 0x58, 0xc4, 0xa6, 0x91, 0x9e, 0xb4, 0x1c, 0x33,
-  0xe5, 0xc6, 0xdc, 0x3a, 0x8e, 0x0b, 0x03, 0x78, 0x54, 0xec, 0x60, 0x76,
-  0xfb, 0xbc, 0x40, 0x90, 0x27, 0x7f, 0x87, 0x93, 0x37, 0xfb, 0xa2, 0xe1,
-  0x9e, 0xc2, 0x85, 0x01, 0xa5, 0x8c, 0x8c, 0x30, 0xc7, 0xe7, 0x77, 0x3b,
-  0xdd, 0x19, 0x42, 0x42, 0x33, 0x78, 0xc6, 0xfb, 0xbc, 0x14, 0xfa, 0x2d,
-  0x68, 0xe0, 0x84, 0xad, 0x28, 0x35, 0x83, 0x77, 0x21, 0xa3, 0x36, 0x0e,
-  0xf1, 0x70, 0x37, 0xdc, 0xaf, 0x2f, 0xa7, 0x58, 0x7f, 0x13, 0x16, 0x49,
-  0xef, 0x79, 0x7d, 0x4e, 0x8a, 0x1d, 0x0a, 0x49, 0x5c, 0xb9, 0x3a, 0x95,
-  0x47, 0x47, 0xbf, 0xa0, 0xd9, 0xb9, 0x13, 0x6c, 0xa2, 0xd8, 0xe9, 0x34,
-  0x92, 0x55, 0x2b, 0x0f, 0xf2, 0x63, 0xc1, 0x10, 0x36, 0xf7, 0xbb, 0xc4,
-  0x4d, 0xdb, 0x7a, 0xa6, 0x4c, 0x98, 0xc5, 0xc0, 0x4c, 0x37, 0xce, 0x05,
-  0x6d, 0xe1, 0x00, 0xef, 0xa9, 0xbf, 0x33, 0x83, 0xc5, 0xbe, 0xa6, 0x7c,
-  0x9a, 0xf7, 0x1b, 0xe5, 0x55, 0x5e, 0x98, 0x76, 0xd7, 0xf0, 0x46, 0xf5,
-  0x1e, 0x6a, 0xcf, 0x67, 0x33, 0x68, 0x4c, 0x06, 0x1e, 0x1f, 0x75, 0x99,
-  0x7f, 0xa0, 0x0f, 0x6b, 0xb7, 0xd5, 0x21, 0x6d, 0x3c, 0x87, 0x6f, 0x45,
-  0x7f, 0x18, 0x14, 0x22, 0xcd, 0xab, 0xc1, 0x66, 0x9c, 0x4a, 0x5e, 0xce,
-  0xc8, 0xa3, 0x77, 0xd9, 0xb3, 0xc3, 0x4d, 0xb8, 0x9e, 0xd7, 0x89, 0x5b,
-  0xfc, 0x1f, 0xb5, 0xa7, 0x7e, 0x31, 0x7a, 0xc2, 0x00, 0xb6, 0x44, 0xb8,
-  0x70, 0xeb, 0x51, 0x06, 0x52, 0x03, 0xc3, 0x99, 0xd1, 0xb5, 0x8c, 0x72,
-  0xcb, 0x66, 0xf6, 0xe7, 0x8c, 0x41, 0xfc, 0x99, 0x1b, 0x4f, 0x3b, 0x52,
-  0xd9, 0x3c, 0x35, 0x84, 0xfa, 0x12, 0x1b, 0x04, 0x43, 0x02, 0x97, 0xd3,
-  0x63, 0x7d, 0x9c, 0xf2, 0x4f, 0x93, 0xd9, 0x76, 0xf7, 0x1d, 0x0d, 0x72,
-  0x43, 0xb9, 0xe7, 0xe0, 0xc3, 0x8a, 0xe5, 0x13, 0x19, 0xf3, 0xc2, 0x49,
-  0x68, 0x69, 0x23, 0x88, 0xfd, 0x3a, 0x1f, 0x9d, 0x4b, 0xc1, 0x6c, 0x7a,
-  0xd0, 0x85, 0xc3, 0xcb, 0x6b, 0x34, 0x99, 0x17, 0x73, 0x5b, 0xaa, 0x3f,
-  0x17, 0xeb, 0xb3, 0x99, 0xd0, 0x6f, 0x36, 0xa2, 0x4e, 0x7f, 0xd1, 0xae,
-  0xd1, 0xe1, 0xe0, 0x88, 0xcd, 0x0c, 0x5f, 0x7c, 0x83, 0xf1, 0x21, 0x45,
-  0x64, 0xdf, 0xdc, 0xc0, 0xf1, 0xc9, 0x7f, 0x79, 0xdf, 0x2d, 0xec, 0xea,
-  0x17, 0x99, 0x2c, 0x70, 0x5d, 0xcc, 0xf3, 0x98, 0xe3, 0xc4, 0xbe, 0xfa,
-  0xc3, 0xdb, 0x35, 0xa3, 0x58, 0xef, 0x10, 0x81, 0xea, 0xd0, 0x2b, 0xdc,
-  0xd0, 0x77, 0xe4, 0xbc, 0xe2, 0x13, 0x9c, 0x76, 0x06, 0x51, 0x2e, 0x2a,
-  0x8f, 0xa7, 0x47, 0x0c, 0xc1, 0x79, 0xfb, 0xf9, 0x6a, 0x22, 0x41, 0xdc,
-  0xa2, 0x30, 0x5e, 0x45, 0x4c, 0x40, 0x5e, 0xb7, 0x95, 0x77, 0x53, 0x2d,
-  0x08, 0xbe, 0x94, 0x83, 0xe7, 0xdb, 0x52, 0x96, 0xa8, 0x47, 0x63, 0xe4,
-  0xe6, 0xcd, 0x43, 0xad, 0x0e, 0x72, 0x3e, 0x0f, 0xa2, 0x2d, 0xbf, 0x89,
-  0xe9, 0xa1, 0xa3, 0xd0, 0x2a, 0x31, 0xa5, 0xcb, 0x4c, 0x9b, 0xb4, 0xc6,
-  0x60, 0x26, 0xdd, 0x52, 0xe7, 0xdd, 0x34, 0x43, 0x8c, 0xfc, 0x85, 0xc0,
-  0xf5, 0x60, 0x3b, 0x5f, 0xb4, 0x2e, 0xb2, 0x28, 0xfc, 0x31, 0x11, 0x22,
-  0x53, 0xe8, 0xdc, 0x91, 0xcf, 0x5a, 0xd3, 0x0e, 0xc2, 0x1a, 0x65, 0x11,
-  0xc8, 0xcf, 0xa9, 0x46, 0x77, 0xfd, 0x5f, 0xf6, 0x3d, 0x09, 0x40, 0x59,
-  0xe3, 0x06, 0x06, 0xfe, 0x4b, 0x19, 0xf0, 0xf6, 0x22, 0x7b, 0xa6, 0xad,
-  0xa5, 0x32, 0xe6, 0x1f, 0xed, 0xa7, 0x36, 0x72, 0xd7, 0x34, 0x97, 0x94,
-  0xbd, 0x95, 0x94, 0x2e, 0x5b, 0xcf, 0x37, 0x79, 0x45, 0x16, 0x1d, 0x3f,
-  0x8a, 0x7e, 0x47, 0x2d, 0xdd, 0xa5, 0x41, 0x38, 0xcd, 0xb6, 0xe3, 0xd9,
-  0xaa, 0x87, 0x84, 0xfe, 0xf5, 0xe5, 0xdb, 0x96, 0xff, 0x78, 0xfb, 0x68,
-  0x1c, 0x56, 0xeb, 0x8e, 0x12, 0x5d, 0xa8, 0xc6, 0xf4, 0x61, 0xfe, 0xdc,
-  0x3f, 0x2d, 0xcf, 0x15, 0xe3, 0xfb, 0x38, 0xdf, 0x5e, 0xcf, 0xd8, 0x99,
-  0xfd, 0xf0, 0x69, 0xab, 0xc0, 0xce, 0x67, 0x35, 0x45, 0x0f, 0xfe, 0xa3,
-  0x77, 0x8e, 0x22, 0x96, 0xd1, 0x77, 0xe9, 0xdf, 0x24, 0xbc, 0xe1, 0x47,
-  0x3a, 0xfc, 0x08, 0xd9, 0xca, 0xfc, 0xab, 0xdf, 0x91, 0x91, 0xd2, 0xc3,
-  0xe1, 0xdb, 0x7b, 0xf4, 0x7d, 0x1f, 0x91, 0x77, 0x63, 0x07, 0x2e, 0xc3,
-  0xa7, 0xf1, 0xe3, 0xd5, 0x19, 0xa6, 0x79, 0x39, 0x53, 0xb4, 0x73, 0x09,
-  0x0e, 0xdf, 0xff, 0xe3, 0xd7, 0x58, 0x15, 0xe6, 0x3c, 0x4f, 0xe5, 0xe0,
-  0x44, 0x6b, 0xc2, 0xd7, 0x2f, 0xe4, 0xd9, 0xf4, 0x48, 0x4c, 0xbf, 0x1d,
-  0xe1, 0xb4, 0x4b, 0x2e, 0xae, 0x62, 0xf6, 0x2c, 0x5c, 0xd1, 0x46, 0xe8,
-  0xd1, 0x6a, 0x76, 0x7d, 0xfc, 0xc1, 0x40, 0xa3, 0xdb, 0x78, 0x4f, 0x9c,
-  0xc7, 0x84, 0xb6, 0x7f, 0xec, 0x38, 0x39, 0x9c, 0xc2, 0xcb, 0xbb, 0x99,
-  0x3e, 0x5c, 0x83, 0x8c, 0x8c, 0x58, 0x04, 0x2d, 0x47, 0x77, 0x71, 0x31,
-  0x56, 0x8a, 0x1c, 0x69, 0x7d, 0x3c, 0x85, 0x21, 0xf4, 0x35, 0xa9, 0x96,
-  0x68, 0x4b, 0x5b, 0x6e, 0x0c, 0x2c, 0xc4, 0x63, 0x7f, 0x33, 0xb6, 0x3f,
-  0x0e, 0xa1, 0x70, 0x73, 0x2a, 0x62, 0xc3, 0xbd, 0xf0, 0x6b, 0x7d, 0xcf,
-  0xe4, 0xb3, 0x5b, 0xb9, 0x70, 0x4b, 0x83, 0xbe, 0xdb, 0x7f, 0xe2, 0x7d,
-  0xd0, 0x90, 0xd9, 0xb1, 0xe2, 0xa4, 0xdf, 0x91, 0x67, 0xdd, 0x89, 0x8b,
-  0xdc, 0x55, 0xd1, 0x63, 0xee, 0x07, 0x11, 0xfc, 0x05, 0xef, 0xa8, 0x3e,
-  0x90, 0x86, 0x41, 0x94, 0x0e, 0xa3, 0xde, 0x39, 0x51, 0xa7, 0xf0, 0x8d,
-  0x90, 0x87, 0xa1, 0x18, 0x8b, 0xed, 0xa2, 0xd5, 0xe2, 0x23, 0x9a, 0x63,
-  0xb2, 0x18, 0xf1, 0x54, 0x03, 0xaf, 0x83, 0x27, 0x91, 0xef, 0xd0, 0x27,
-  0xe9, 0xc6, 0x67, 0xfe, 0x93, 0x49, 0x47, 0x62, 0x69, 0x29, 0x19, 0xaf,
-  0x46, 0x52, 0xec, 0x92, 0x85, 0x96, 0xca, 0x12, 0xaa, 0x2a, 0x8f, 0x30,
-  0xdc, 0xa2, 0x8b, 0xad, 0x42, 0xa6, 0x88, 0x2a, 0x48, 0x61, 0xa3, 0xe8,
-  0x50, 0x6e, 0x2c, 0x97, 0x45, 0xf6, 0x96, 0x07, 0xf1, 0x9b, 0x0c, 0xe8,
-  0xeb, 0x57, 0xc0, 0x9a, 0x6b, 0x81, 0xa4, 0x6f, 0x7d, 0xca, 0x84, 0x38,
-  0xb0, 0x1f, 0xa5, 0x48, 0xc1, 0x8b, 0x32, 0xfa, 0x25, 0xc7, 0xd3, 0xf1,
-  0x47, 0x9c, 0x27, 0x0e, 0x27, 0xc9, 0x1f, 0x2d, 0xcf, 0x8a, 0xb4, 0x43,
-  0xbc, 0x3e, 0x64, 0x41, 0xd6, 0xeb, 0x00, 0x4c, 0x16, 0x08, 0x8d, 0xb2,
-  0xc0, 0x87, 0x33, 0xfb, 0x1a, 0x38, 0xd4, 0xbd, 0x91, 0xff, 0x01, 0x03,
-  0x4e, 0xda, 0x4a, 0x7b, 0xc1, 0xd4, 0x80, 0x00, 0x00, 0x00, 0x00, 0x49,
-  0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
+#include <array>
+#include <cstdint>
+
+//
+// 64x64 blue noise tile used to dither the postprocess output. The pixels
+// are stored pre-decoded in BGRA order (what cv::imdecode() used to hand
+// back), so the table is usable directly with no per-call PNG decode and
+// no startup copy into a heap-backed vector.
+//
+
+constexpr int BLUE_NOISE_WIDTH = 64;
+constexpr int BLUE_NOISE_HEIGHT = 64;
+constexpr int BLUE_NOISE_CHANNELS = 4;
+
+constexpr std::array<uint8_t, BLUE_NOISE_WIDTH*BLUE_NOISE_HEIGHT*BLUE_NOISE_CHANNELS> BLUE_NOISE_LUT = {{
+    0xb6, 0xca, 0x61, 0xff, 0xc5, 0x01, 0x13, 0xff, 0x38, 0xed, 0xd2, 0xff,
+    0x06, 0xd8, 0x35, 0xff, 0xf2, 0x4a, 0xd9, 0xff, 0x2e, 0xfd, 0x1e, 0xff,
+    0x1b, 0xbe, 0x58, 0xff, 0x97, 0xcc, 0x2f, 0xff, 0x01, 0x34, 0x95, 0xff,
+    0xa5, 0x24, 0xd4, 0xff, 0x43, 0xd4, 0x55, 0xff, 0x0d, 0xa6, 0x73, 0xff,
+    0xa0, 0x4f, 0xdc, 0xff, 0x8b, 0x06, 0xb3, 0xff, 0x2c, 0x2a, 0x60, 0xff,
+    0xa8, 0x40, 0xea, 0xff, 0xeb, 0xea, 0xc9, 0xff, 0x7b, 0x1b, 0x16, 0xff,
+    0xb8, 0x8e, 0x80, 0xff, 0x71, 0xad, 0x27, 0xff, 0xf5, 0x6d, 0x6d, 0xff,
+    0x98, 0xa3, 0x00, 0xff, 0x65, 0xef, 0xf3, 0xff, 0x0e, 0x3f, 0x76, 0xff,
+    0xd4, 0x68, 0x3e, 0xff, 0x2b, 0xaf, 0x64, 0xff, 0x5a, 0x7e, 0xfa, 0xff,
+    0xaa, 0x96, 0x25, 0xff, 0x1e, 0xf6, 0xbb, 0xff, 0x8e, 0xab, 0xad, 0xff,
+    0x5e, 0x42, 0xd1, 0xff, 0x12, 0x02, 0x75, 0xff, 0xdf, 0x64, 0xeb, 0xff,
+    0x7b, 0x56, 0xbe, 0xff, 0x34, 0x84, 0x8b, 0xff, 0x71, 0xec, 0x65, 0xff,
+    0x29, 0x60, 0x79, 0xff, 0x8e, 0x4b, 0x99, 0xff, 0x60, 0xa5, 0xfe, 0xff,
+    0x05, 0x01, 0x29, 0xff, 0x9f, 0x7c, 0x84, 0xff, 0x54, 0x37, 0xae, 0xff,
+    0x44, 0x91, 0x05, 0xff, 0xdf, 0x24, 0x43, 0xff, 0xf6, 0xa8, 0xd7, 0xff,
+    0x66, 0xcf, 0x7f, 0xff, 0xe6, 0x99, 0xe2, 0xff, 0x31, 0x02, 0x8e, 0xff,
+    0x13, 0xf4, 0x61, 0xff, 0x6e, 0xdc, 0xff, 0xff, 0x4d, 0x83, 0x12, 0xff,
+    0x04, 0x43, 0xe0, 0xff, 0xe0, 0x8e, 0x33, 0xff, 0x5d, 0x35, 0x9e, 0xff,
+    0x2d, 0x5e, 0x4e, 0xff, 0x4a, 0x9e, 0x1c, 0xff, 0xc7, 0xcf, 0x7b, 0xff,
+    0xa9, 0x32, 0xfe, 0xff, 0x03, 0x63, 0x31, 0xff, 0xe3, 0x13, 0xa5, 0xff,
+    0xb1, 0x4e, 0xd3, 0xff, 0xc9, 0xd5, 0xf8, 0xff, 0x09, 0x1f, 0x41, 0xff,
+    0x2f, 0x45, 0xda, 0xff, 0x78, 0x2e, 0xbf, 0xff, 0xeb, 0x66, 0x56, 0xff,
+    0x99, 0x87, 0x0a, 0xff, 0xcf, 0x27, 0x91, 0xff, 0x7c, 0xb2, 0x43, 0xff,
+    0xa7, 0x11, 0xa8, 0xff, 0x89, 0x80, 0xf7, 0xff, 0x3c, 0x64, 0x11, 0xff,
+    0xdb, 0x4c, 0xe3, 0xff, 0x6a, 0x97, 0x49, 0xff, 0xc8, 0x6b, 0xfc, 0xff,
+    0xf1, 0x3a, 0x38, 0xff, 0xba, 0xc9, 0x13, 0xff, 0x18, 0xfe, 0x7d, 0xff,
+    0xcf, 0x96, 0x48, 0xff, 0x6c, 0xd3, 0x23, 0xff, 0xc0, 0x58, 0xa3, 0xff,
+    0x3e, 0x09, 0xe4, 0xff, 0xdf, 0xdd, 0x57, 0xff, 0x28, 0x39, 0xf7, 0xff,
+    0x39, 0x53, 0xa9, 0xff, 0x54, 0x1d, 0x48, 0xff, 0xc8, 0x2f, 0xc6, 0xff,
+    0xea, 0xd3, 0xb1, 0xff, 0xa1, 0x59, 0x89, 0xff, 0x84, 0x14, 0x0a, 0xff,
+    0x14, 0x38, 0xca, 0xff, 0xf4, 0x4c, 0x7b, 0xff, 0x34, 0x6e, 0x32, 0xff,
+    0x74, 0x29, 0x02, 0xff, 0xc4, 0xde, 0x49, 0xff, 0xfe, 0x90, 0x96, 0xff,
+    0xa2, 0xa7, 0x34, 0xff, 0x94, 0x2e, 0x56, 0xff, 0x0b, 0x12, 0x43, 0xff,
+    0xf7, 0xb8, 0x2b, 0xff, 0xa6, 0x33, 0xe1, 0xff, 0xe1, 0xf8, 0x00, 0xff,
+    0xd6, 0xc7, 0x5d, 0xff, 0x36, 0x6a, 0x8d, 0xff, 0xbc, 0xe9, 0xde, 0xff,
+    0x16, 0xad, 0x3a, 0xff, 0x88, 0x54, 0xcc, 0xff, 0xca, 0x73, 0xfb, 0xff,
+    0x97, 0xfe, 0x15, 0xff, 0xb2, 0x2f, 0x66, 0xff, 0x02, 0x7b, 0x2a, 0xff,
+    0xa3, 0x4b, 0xbb, 0xff, 0xf0, 0x39, 0x3f, 0xff, 0x83, 0x72, 0xcd, 0xff,
+    0xaa, 0x0d, 0x94, 0xff, 0x36, 0xcb, 0x7f, 0xff, 0x8b, 0xb6, 0xb4, 0xff,
+    0x76, 0x22, 0xe8, 0xff, 0xb3, 0xc3, 0x64, 0xff, 0xe5, 0x00, 0xab, 0xff,
+    0x95, 0xe0, 0x8e, 0xff, 0x31, 0x92, 0x0e, 0xff, 0xd6, 0xfe, 0x5f, 0xff,
+    0x42, 0xbb, 0x74, 0xff, 0x72, 0x9d, 0x93, 0xff, 0x24, 0x8c, 0x17, 0xff,
+    0xf7, 0x5f, 0x6d, 0xff, 0xa6, 0xe4, 0x34, 0xff, 0x1a, 0x96, 0x86, 0xff,
+    0x5f, 0xa5, 0xaa, 0xff, 0x25, 0xbf, 0xff, 0xff, 0xaf, 0x58, 0x70, 0xff,
+    0x53, 0x38, 0x62, 0xff, 0x0f, 0x91, 0xc0, 0xff, 0xbd, 0x1e, 0x8a, 0xff,
+    0x5d, 0xe8, 0x3d, 0xff, 0xf5, 0xad, 0xb8, 0xff, 0xb2, 0x00, 0x81, 0xff,
+    0x1d, 0xdf, 0xae, 0xff, 0x51, 0x7d, 0x9c, 0xff, 0x75, 0x5f, 0xcc, 0xff,
+    0xdc, 0xaf, 0xf5, 0xff, 0x47, 0x1e, 0xc0, 0xff, 0x02, 0x70, 0x92, 0xff,
+    0x93, 0xa7, 0x3a, 0xff, 0x5b, 0xc4, 0x66, 0xff, 0x13, 0x63, 0x08, 0xff,
+    0xd0, 0xf9, 0xd6, 0xff, 0x8f, 0xb5, 0x99, 0xff, 0xb4, 0xc8, 0x1a, 0xff,
+    0x1f, 0x80, 0xde, 0xff, 0x7a, 0x90, 0x26, 0xff, 0x37, 0xfe, 0xa1, 0xff,
+    0xdd, 0xc1, 0xe8, 0xff, 0xbd, 0xe9, 0x4b, 0xff, 0x45, 0xd5, 0x9a, 0xff,
+    0xd0, 0x9f, 0x60, 0xff, 0x9f, 0xbf, 0xf5, 0xff, 0x08, 0x80, 0xa5, 0xff,
+    0x2c, 0xfc, 0x68, 0xff, 0x67, 0x4a, 0xde, 0xff, 0x47, 0xc5, 0x16, 0xff,
+    0xd1, 0xd3, 0xf9, 0xff, 0x5a, 0x97, 0xa2, 0xff, 0x83, 0x7a, 0xc1, 0xff,
+    0x50, 0x0e, 0x4c, 0xff, 0x1e, 0x9c, 0xb6, 0xff, 0x94, 0x20, 0x18, 0xff,
+    0x6c, 0x44, 0xec, 0xff, 0xe8, 0xd5, 0x54, 0xff, 0x27, 0x18, 0x7a, 0xff,
+    0x5e, 0xdf, 0x91, 0xff, 0x35, 0x61, 0xa8, 0xff, 0x4a, 0x13, 0x4e, 0xff,
+    0x74, 0xe8, 0xc6, 0xff, 0xd4, 0xc8, 0xef, 0xff, 0x43, 0xbc, 0x0f, 0xff,
+    0x5b, 0x29, 0x6f, 0xff, 0xb8, 0xfb, 0x28, 0xff, 0xeb, 0x55, 0x54, 0xff,
+    0xd5, 0x68, 0x44, 0xff, 0x41, 0xec, 0x10, 0xff, 0x16, 0x7b, 0xd6, 0xff,
+    0xfb, 0x50, 0x2a, 0xff, 0x55, 0x3f, 0x3e, 0xff, 0x69, 0xb4, 0xc9, 0xff,
+    0x1c, 0x0a, 0xe5, 0xff, 0xf0, 0x6e, 0x25, 0xff, 0x9a, 0x29, 0x49, 0xff,
+    0x62, 0xf3, 0xc6, 0xff, 0x4b, 0x09, 0x9e, 0xff, 0x91, 0xb6, 0xeb, 0xff,
+    0xe4, 0x4f, 0x19, 0xff, 0x87, 0xf8, 0x46, 0xff, 0x47, 0x0f, 0xca, 0xff,
+    0xf9, 0x77, 0x2c, 0xff, 0x6a, 0xf1, 0xe6, 0xff, 0xe8, 0xcf, 0x00, 0xff,
+    0xcb, 0xa1, 0x77, 0xff, 0x48, 0x40, 0xc8, 0xff, 0x76, 0xc3, 0x6a, 0xff,
+    0x27, 0xf9, 0x07, 0xff, 0x90, 0x8c, 0x1e, 0xff, 0x36, 0x2c, 0x5d, 0xff,
+    0x9a, 0x0c, 0x2b, 0xff, 0x5f, 0xe2, 0x6a, 0xff, 0xfe, 0x84, 0x0a, 0xff,
+    0x85, 0xf1, 0xdb, 0xff, 0x30, 0x4d, 0x77, 0xff, 0xae, 0x30, 0xb8, 0xff,
+    0xf1, 0x7c, 0x8c, 0xff, 0x66, 0x0e, 0xc2, 0xff, 0x81, 0x96, 0x3d, 0xff,
+    0xfd, 0xe0, 0x84, 0xff, 0x0a, 0x4a, 0x63, 0xff, 0x4a, 0x08, 0x55, 0xff,
+    0x61, 0xa4, 0x34, 0xff, 0xb0, 0x27, 0xb4, 0xff, 0x00, 0x87, 0x1c, 0xff,
+    0x68, 0x06, 0xd8, 0xff, 0x7f, 0x61, 0x8b, 0xff, 0xe3, 0x1e, 0xe4, 0xff,
+    0x56, 0x3b, 0x23, 0xff, 0xb1, 0x0e, 0xc6, 0xff, 0xdb, 0x72, 0x0a, 0xff,
+    0x1b, 0xe8, 0xb2, 0xff, 0xb9, 0x24, 0x91, 0xff, 0x3b, 0x67, 0x6f, 0xff,
+    0xc3, 0xe3, 0x1e, 0xff, 0x0f, 0x52, 0xf3, 0xff, 0xf2, 0x8a, 0x35, 0xff,
+    0xcc, 0xbe, 0x9e, 0xff, 0xa8, 0x2f, 0x68, 0xff, 0x78, 0x81, 0xc2, 0xff,
+    0xfe, 0x97, 0x1f, 0xff, 0x0a, 0xc5, 0x2f, 0xff, 0x80, 0x3d, 0xe6, 0xff,
+    0xbf, 0x87, 0x07, 0xff, 0x19, 0xa2, 0x9b, 0xff, 0x8c, 0x68, 0x58, 0xff,
+    0x25, 0x1c, 0x87, 0xff, 0xcc, 0x94, 0xdd, 0xff, 0x0c, 0xa9, 0xa6, 0xff,
+    0x1e, 0xdf, 0xed, 0xff, 0x9c, 0x9c, 0xc4, 0xff, 0x64, 0x17, 0x71, 0xff,
+    0xc1, 0x8a, 0x86, 0xff, 0x0a, 0xf6, 0xf0, 0xff, 0x79, 0x25, 0x9d, 0xff,
+    0xa1, 0x5a, 0x51, 0xff, 0xbd, 0x85, 0xb0, 0xff, 0x83, 0xca, 0x84, 0xff,
+    0x11, 0x49, 0xee, 0xff, 0xc1, 0xaa, 0x07, 0xff, 0xd2, 0x7d, 0xb6, 0xff,
+    0x37, 0x3b, 0x28, 0xff, 0xb9, 0xde, 0xdf, 0xff, 0xd8, 0x1c, 0x99, 0xff,
+    0x0a, 0xc8, 0x78, 0xff, 0x3c, 0x45, 0xb5, 0xff, 0x90, 0xdc, 0x1c, 0xff,
+    0x20, 0x6a, 0x4e, 0xff, 0x31, 0x2e, 0xf1, 0xff, 0x9d, 0x5b, 0x27, 0xff,
+    0x07, 0x76, 0xa3, 0xff, 0xd1, 0x1b, 0xe0, 0xff, 0x58, 0x55, 0xec, 0xff,
+    0xeb, 0xa3, 0x8f, 0xff, 0x0a, 0xbd, 0xba, 0xff, 0xb3, 0x49, 0x40, 0xff,
+    0x22, 0x36, 0xa8, 0xff, 0xc6, 0x10, 0x54, 0xff, 0xe6, 0xba, 0x13, 0xff,
+    0x9e, 0x8b, 0xfe, 0xff, 0x4b, 0xd0, 0x4a, 0xff, 0x06, 0x44, 0x2c, 0xff,
+    0xa7, 0x71, 0x74, 0xff, 0x32, 0x17, 0xea, 0xff, 0xc2, 0x60, 0x10, 0xff,
+    0x9d, 0xba, 0xfc, 0xff, 0xee, 0x6b, 0x7d, 0xff, 0x90, 0x43, 0x6d, 0xff,
+    0x51, 0x75, 0xc3, 0xff, 0xfa, 0xae, 0x3c, 0xff, 0x96, 0xf5, 0x11, 0xff,
+    0x23, 0x54, 0x74, 0xff, 0x41, 0xce, 0x53, 0xff, 0xc9, 0xb2, 0x86, 0xff,
+    0x78, 0x99, 0xd5, 0xff, 0x8b, 0x5a, 0x7c, 0xff, 0xec, 0x87, 0x3b, 0xff,
+    0x24, 0x04, 0xcf, 0xff, 0x9d, 0xb0, 0x61, 0xff, 0x7c, 0x38, 0x83, 0xff,
+    0x64, 0xdb, 0xd8, 0xff, 0x2c, 0xfc, 0x76, 0xff, 0x3f, 0x62, 0x0c, 0xff,
+    0x4e, 0xb3, 0xa5, 0xff, 0xb4, 0x05, 0x46, 0xff, 0xd2, 0xf2, 0xba, 0xff,
+    0x9e, 0x50, 0x6e, 0xff, 0xed, 0xb6, 0xd3, 0xff, 0xdc, 0x08, 0x35, 0xff,
+    0x63, 0xda, 0x78, 0xff, 0xfb, 0x59, 0x1d, 0xff, 0x98, 0x81, 0xb7, 0xff,
+    0x79, 0x3e, 0x3a, 0xff, 0x53, 0x05, 0x06, 0xff, 0xf6, 0x2f, 0x9a, 0xff,
+    0x2b, 0x48, 0x21, 0xff, 0xaa, 0xaf, 0x59, 0xff, 0x8f, 0xcb, 0xbc, 0xff,
+    0xda, 0xa4, 0x01, 0xff, 0x3a, 0x75, 0x68, 0xff, 0x4e, 0xda, 0x1b, 0xff,
+    0xae, 0x35, 0xd8, 0xff, 0x2b, 0xea, 0x39, 0xff, 0xe8, 0x14, 0x5b, 0xff,
+    0x7e, 0xd2, 0x7d, 0xff, 0x00, 0x70, 0x4f, 0xff, 0x50, 0x2b, 0x6a, 0xff,
+    0x72, 0x63, 0x09, 0xff, 0xc8, 0x83, 0x3a, 0xff, 0xa3, 0x9a, 0xdb, 0xff,
+    0xb7, 0x05, 0xa0, 0xff, 0xda, 0xab, 0x8d, 0xff, 0x81, 0x89, 0xd6, 0xff,
+    0xfd, 0x12, 0x5f, 0xff, 0xac, 0xd2, 0x47, 0xff, 0x86, 0xb5, 0x35, 0xff,
+    0xe0, 0x3c, 0x78, 0xff, 0xc3, 0xed, 0x4d, 0xff, 0x7c, 0x72, 0xd6, 0xff,
+    0xa5, 0xcf, 0xf0, 0xff, 0x3c, 0x9c, 0x88, 0xff, 0x70, 0x69, 0x31, 0xff,
+    0x55, 0xdb, 0xe6, 0xff, 0x1d, 0x21, 0x9e, 0xff, 0xcb, 0xa2, 0x1f, 0xff,
+    0x76, 0xee, 0x5d, 0xff, 0xe0, 0x2a, 0xcd, 0xff, 0x59, 0xab, 0xa6, 0xff,
+    0xd5, 0xf3, 0xba, 0xff, 0x6e, 0x35, 0x97, 0xff, 0x27, 0xe5, 0xd1, 0xff,
+    0x1a, 0xcd, 0x03, 0xff, 0xc6, 0x16, 0xf2, 0xff, 0x2f, 0xdf, 0x58, 0xff,
+    0xa8, 0x30, 0xac, 0xff, 0x12, 0x8d, 0xbf, 0xff, 0x63, 0x6a, 0x30, 0xff,
+    0xf6, 0xee, 0x45, 0xff, 0x32, 0x1b, 0xed, 0xff, 0x02, 0x36, 0x5b, 0xff,
+    0xa9, 0xc0, 0x28, 0xff, 0x6f, 0xf6, 0xe6, 0xff, 0xfc, 0x46, 0x07, 0xff,
+    0x49, 0xa2, 0xa9, 0xff, 0xb7, 0x19, 0x42, 0xff, 0xe5, 0x75, 0x2c, 0xff,
+    0x00, 0x0f, 0xce, 0xff, 0x8e, 0x4b, 0xf9, 0xff, 0x14, 0xa6, 0x82, 0xff,
+    0x69, 0x6b, 0x5c, 0xff, 0x2a, 0x27, 0xf2, 0xff, 0x3e, 0x90, 0x8a, 0xff,
+    0x54, 0xf9, 0xb3, 0xff, 0xb0, 0x45, 0x47, 0xff, 0x30, 0xae, 0xfb, 0xff,
+    0xc4, 0xf0, 0xcb, 0xff, 0x3c, 0xce, 0x5f, 0xff, 0x6a, 0x77, 0x8c, 0xff,
+    0xcf, 0xc1, 0xf8, 0xff, 0x83, 0xe8, 0xce, 0xff, 0x48, 0x6c, 0x36, 0xff,
+    0x20, 0x37, 0xe1, 0xff, 0xee, 0x0d, 0x7d, 0xff, 0xc7, 0xf1, 0xfa, 0xff,
+    0x06, 0x1c, 0x90, 0xff, 0xf7, 0x96, 0xbe, 0xff, 0x5a, 0x67, 0x72, 0xff,
+    0x3e, 0x58, 0xa4, 0xff, 0x6b, 0xbe, 0xd2, 0xff, 0xab, 0x91, 0xf2, 0xff,
+    0x9c, 0xb0, 0xaf, 0xff, 0x28, 0xeb, 0x5e, 0xff, 0xf0, 0x36, 0xf6, 0xff,
+    0x62, 0xb8, 0x81, 0xff, 0x14, 0x24, 0x56, 0xff, 0x56, 0x51, 0x31, 0xff,
+    0x70, 0xe1, 0xb0, 0xff, 0x19, 0xf3, 0x11, 0xff, 0x3a, 0x96, 0x97, 0xff,
+    0x62, 0x66, 0xcf, 0xff, 0x12, 0xd9, 0xac, 0xff, 0x45, 0x23, 0x16, 0xff,
+    0x2c, 0x8e, 0x06, 0xff, 0xef, 0x15, 0x7e, 0xff, 0xd0, 0xfa, 0x20, 0xff,
+    0x0e, 0xae, 0xcf, 0xff, 0x80, 0x55, 0x63, 0xff, 0xb7, 0x02, 0xb0, 0xff,
+    0x40, 0xe4, 0x7c, 0xff, 0x29, 0x5c, 0xf2, 0xff, 0x8b, 0x84, 0x0a, 0xff,
+    0x18, 0xc9, 0x38, 0xff, 0x43, 0x9b, 0x4d, 0xff, 0xb8, 0x21, 0x1e, 0xff,
+    0x83, 0x8a, 0x88, 0xff, 0xdb, 0x57, 0x44, 0xff, 0x3e, 0x98, 0xa4, 0xff,
+    0x75, 0x4b, 0x25, 0xff, 0xd3, 0xbd, 0x94, 0xff, 0xe9, 0xa4, 0xff, 0xff,
+    0xbe, 0x05, 0x06, 0xff, 0x85, 0xdd, 0xb8, 0xff, 0x9b, 0x48, 0x9f, 0xff,
+    0x50, 0xa9, 0x1a, 0xff, 0x5e, 0xd8, 0xae, 0xff, 0xdc, 0x2b, 0x4d, 0xff,
+    0x0b, 0x6d, 0x97, 0xff, 0x34, 0xd0, 0xbd, 0xff, 0x88, 0x5a, 0xeb, 0xff,
+    0xa0, 0x93, 0x8f, 0xff, 0xd8, 0xcb, 0x50, 0xff, 0xc0, 0xed, 0xde, 0xff,
+    0x59, 0xdb, 0x16, 0xff, 0xe3, 0x34, 0x98, 0xff, 0xab, 0x7d, 0x24, 0xff,
+    0x92, 0xd1, 0x10, 0xff, 0x05, 0x20, 0xe0, 0xff, 0x70, 0x73, 0xa1, 0xff,
+    0x11, 0x31, 0x09, 0xff, 0xa5, 0x0f, 0x6b, 0xff, 0x89, 0x62, 0x2e, 0xff,
+    0xe6, 0x90, 0x4c, 0xff, 0x05, 0x51, 0x78, 0xff, 0xba, 0x12, 0x14, 0xff,
+    0xe2, 0xd8, 0xaf, 0xff, 0x71, 0x5f, 0x49, 0xff, 0x5e, 0x8e, 0xa3, 0xff,
+    0x2f, 0xb9, 0x2d, 0xff, 0x89, 0x45, 0x42, 0xff, 0x74, 0xc5, 0x0c, 0xff,
+    0xde, 0xa2, 0xf5, 0xff, 0x93, 0x24, 0x1f, 0xff, 0x1d, 0xfc, 0x2f, 0xff,
+    0xff, 0x03, 0x8b, 0xff, 0x5d, 0xa1, 0x17, 0xff, 0x10, 0x56, 0xc3, 0xff,
+    0x7f, 0xd7, 0x25, 0xff, 0x35, 0x71, 0xcf, 0xff, 0x8c, 0xff, 0x14, 0xff,
+    0xe6, 0xc0, 0x6e, 0xff, 0xc4, 0x7c, 0xfc, 0xff, 0x4c, 0x47, 0xc4, 0xff,
+    0xee, 0x2a, 0x85, 0xff, 0xbc, 0x0a, 0x22, 0xff, 0xa2, 0x80, 0xf7, 0xff,
+    0x6e, 0x4f, 0x6f, 0xff, 0x96, 0xc2, 0xa1, 0xff, 0x4e, 0x5e, 0x58, 0xff,
+    0x65, 0x2d, 0xc5, 0xff, 0x8f, 0x40, 0x95, 0xff, 0xf9, 0x79, 0x45, 0xff,
+    0xd8, 0x94, 0x01, 0xff, 0x9a, 0xbf, 0xbf, 0xff, 0xf4, 0x38, 0xd9, 0xff,
+    0x6a, 0x0a, 0x93, 0xff, 0xe9, 0x50, 0x6f, 0xff, 0x97, 0xd8, 0xe4, 0xff,
+    0x12, 0x7a, 0x2c, 0xff, 0xf8, 0x01, 0x5e, 0xff, 0x56, 0xb4, 0xdf, 0xff,
+    0xb3, 0xed, 0x69, 0xff, 0x8a, 0x7c, 0xe8, 0xff, 0x05, 0x22, 0x7a, 0xff,
+    0x49, 0x3f, 0xcf, 0xff, 0x71, 0x83, 0x62, 0xff, 0x1e, 0xc4, 0x8e, 0xff,
+    0xaf, 0x78, 0x6c, 0xff, 0xe7, 0x64, 0xf7, 0xff, 0x40, 0x90, 0x77, 0xff,
+    0xbf, 0x14, 0xca, 0xff, 0x92, 0x7f, 0x12, 0xff, 0xd3, 0xef, 0x59, 0xff,
+    0x56, 0xba, 0x20, 0xff, 0x1b, 0x26, 0x6c, 0xff, 0x6e, 0x84, 0x06, 0xff,
+    0xf1, 0x3e, 0xb0, 0xff, 0x33, 0x1a, 0x36, 0xff, 0x7b, 0xbf, 0xc8, 0xff,
+    0x1b, 0xa1, 0x41, 0xff, 0xf8, 0xe3, 0x67, 0xff, 0xbe, 0x56, 0x55, 0xff,
+    0x80, 0xc7, 0x2a, 0xff, 0xef, 0x9a, 0x7e, 0xff, 0xdd, 0xe4, 0xd9, 0xff,
+    0x4c, 0x25, 0xac, 0xff, 0x1a, 0xb6, 0xbf, 0xff, 0xa1, 0xff, 0xe5, 0xff,
+    0x38, 0x81, 0x64, 0xff, 0x56, 0x9d, 0x91, 0xff, 0x11, 0x29, 0x0d, 0xff,
+    0xb5, 0xe4, 0x70, 0xff, 0x9b, 0x53, 0xd1, 0xff, 0xd2, 0x80, 0x5f, 0xff,
+    0x17, 0x07, 0xad, 0xff, 0xa4, 0xe2, 0x4d, 0xff, 0xbb, 0x3f, 0x97, 0xff,
+    0xce, 0x87, 0xc8, 0xff, 0x32, 0x4a, 0x41, 0xff, 0xe9, 0xc6, 0x71, 0xff,
+    0xc2, 0x0d, 0x93, 0xff, 0xb1, 0x8e, 0xa6, 0xff, 0xd2, 0x17, 0x48, 0xff,
+    0x44, 0x5f, 0xbb, 0xff, 0x03, 0x3a, 0xe4, 0xff, 0xaf, 0x0d, 0x3f, 0xff,
+    0x2a, 0xa3, 0x0a, 0xff, 0xd3, 0xc9, 0x64, 0xff, 0x8e, 0xaf, 0x51, 0xff,
+    0x1f, 0xf8, 0xbc, 0xff, 0xf9, 0x9a, 0xdd, 0xff, 0x00, 0x04, 0x38, 0xff,
+    0xb5, 0xe8, 0xb5, 0xff, 0xe0, 0x87, 0xfa, 0xff, 0x18, 0xcb, 0x71, 0xff,
+    0x34, 0xf2, 0xe1, 0xff, 0x5f, 0x28, 0x37, 0xff, 0x0b, 0x6e, 0x88, 0xff,
+    0xa9, 0xb2, 0x26, 0xff, 0xbf, 0xfd, 0x55, 0xff, 0x38, 0x68, 0xaf, 0xff,
+    0xcd, 0x41, 0xf6, 0xff, 0x79, 0xc1, 0xc7, 0xff, 0xa4, 0xf8, 0x9b, 0xff,
+    0x0c, 0x3b, 0xbb, 0xff, 0x65, 0x64, 0x13, 0xff, 0xf1, 0x11, 0x33, 0xff,
+    0x9c, 0xd6, 0x4c, 0xff, 0x59, 0xf9, 0x18, 0xff, 0x39, 0x59, 0x3d, 0xff,
+    0xd8, 0x29, 0xe0, 0xff, 0x0f, 0x0f, 0x0d, 0xff, 0xca, 0xfe, 0x2e, 0xff,
+    0x29, 0xb9, 0xd8, 0xff, 0x79, 0x50, 0x88, 0xff, 0x17, 0x9c, 0x37, 0xff,
+    0xae, 0x0c, 0xfd, 0xff, 0xf7, 0x34, 0x7c, 0xff, 0x27, 0xe3, 0xc7, 0xff,
+    0x80, 0x54, 0xa0, 0xff, 0x42, 0x9a, 0x5f, 0xff, 0x97, 0x70, 0x75, 0xff,
+    0xc9, 0x5e, 0xe6, 0xff, 0x4b, 0x09, 0xa6, 0xff, 0x60, 0x41, 0xcf, 0xff,
+    0xd0, 0x13, 0xf6, 0xff, 0x43, 0xba, 0xbe, 0xff, 0x21, 0x85, 0x95, 0xff,
+    0x5c, 0x4a, 0xeb, 0xff, 0xb1, 0xd6, 0x17, 0xff, 0x2d, 0xa4, 0x40, 0xff,
+    0xf3, 0x1c, 0x9f, 0xff, 0x95, 0x3f, 0x29, 0xff, 0x79, 0xbf, 0xf4, 0xff,
+    0xd6, 0x04, 0xb8, 0xff, 0xfc, 0xac, 0xde, 0xff, 0x42, 0x71, 0x22, 0xff,
+    0x66, 0xf9, 0xc3, 0xff, 0x27, 0x2d, 0xe7, 0xff, 0x52, 0xb1, 0x83, 0xff,
+    0x0c, 0x6c, 0x66, 0xff, 0x46, 0xd4, 0x04, 0xff, 0x86, 0x7a, 0xe3, 0xff,
+    0x98, 0x32, 0x53, 0xff, 0x20, 0xf5, 0x33, 0xff, 0x4f, 0x44, 0xee, 0xff,
+    0xf9, 0xa6, 0x03, 0xff, 0x96, 0xe8, 0x5d, 0xff, 0x66, 0x94, 0x99, 0xff,
+    0x9f, 0xd1, 0x7d, 0xff, 0x72, 0x6d, 0xa7, 0xff, 0x7e, 0x58, 0xee, 0xff,
+    0x54, 0x36, 0x2e, 0xff, 0x36, 0xe3, 0x8e, 0xff, 0xd8, 0x43, 0x43, 0xff,
+    0xc6, 0xa8, 0x67, 0xff, 0x84, 0x70, 0x1a, 0xff, 0x26, 0xb9, 0x2d, 0xff,
+    0xab, 0x19, 0x0e, 0xff, 0xc1, 0xa1, 0x50, 0xff, 0x4b, 0x49, 0xa5, 0xff,
+    0x7b, 0xd3, 0xee, 0xff, 0x23, 0x8c, 0x6a, 0xff, 0x54, 0x1e, 0x42, 0xff,
+    0x02, 0xa8, 0x17, 0xff, 0x62, 0x93, 0x78, 0xff, 0x49, 0x13, 0x08, 0xff,
+    0x2b, 0x71, 0x3c, 0xff, 0xe5, 0x2b, 0x7e, 0xff, 0x36, 0xa8, 0xd7, 0xff,
+    0xc9, 0xc9, 0xb4, 0xff, 0x25, 0x8f, 0x89, 0xff, 0xb7, 0x6d, 0xc4, 0xff,
+    0xfe, 0xb1, 0xf1, 0xff, 0x8c, 0xe3, 0xaa, 0xff, 0x65, 0xa0, 0x53, 0xff,
+    0x80, 0x3d, 0xc0, 0xff, 0xf4, 0x20, 0x43, 0xff, 0xa2, 0xe7, 0xa2, 0xff,
+    0x69, 0xc9, 0x67, 0xff, 0x39, 0x42, 0xb2, 0xff, 0xca, 0x67, 0xda, 0xff,
+    0x61, 0xab, 0x3d, 0xff, 0xba, 0x00, 0xf2, 0xff, 0xa6, 0xc5, 0x2a, 0xff,
+    0x06, 0xfe, 0xb9, 0xff, 0xde, 0x89, 0x81, 0xff, 0x27, 0xe9, 0x00, 0xff,
+    0x87, 0xab, 0x8f, 0xff, 0x9d, 0x78, 0x72, 0xff, 0x35, 0x63, 0x3c, 0xff,
+    0xd6, 0xf7, 0x1f, 0xff, 0x91, 0x01, 0x51, 0xff, 0x77, 0x6d, 0x88, 0xff,
+    0xcc, 0x33, 0x03, 0xff, 0x66, 0x5b, 0xd0, 0xff, 0xc5, 0x75, 0x58, 0xff,
+    0x24, 0xf0, 0x81, 0xff, 0xa5, 0xd3, 0x3b, 0xff, 0x01, 0x3a, 0x51, 0xff,
+    0x80, 0x1b, 0x89, 0xff, 0xb0, 0xcd, 0x9b, 0xff, 0xe6, 0x60, 0x10, 0xff,
+    0xf5, 0x90, 0x32, 0xff, 0x7a, 0x10, 0xd7, 0xff, 0x65, 0xef, 0xb9, 0xff,
+    0xdb, 0x1d, 0xfb, 0xff, 0x3e, 0xba, 0x85, 0xff, 0x6a, 0x68, 0xb4, 0xff,
+    0x78, 0xcc, 0x79, 0xff, 0x0d, 0x78, 0xda, 0xff, 0x2e, 0x2d, 0x8c, 0xff,
+    0xd9, 0xb5, 0x2b, 0xff, 0xf3, 0x1d, 0x1d, 0xff, 0x17, 0xef, 0xd8, 0xff,
+    0x09, 0x8d, 0x75, 0xff, 0xe7, 0x77, 0xca, 0xff, 0xa9, 0x18, 0x02, 0xff,
+    0x5d, 0x63, 0xe7, 0xff, 0x78, 0x24, 0x99, 0xff, 0x3f, 0xdd, 0xd3, 0xff,
+    0x57, 0x37, 0x86, 0xff, 0xed, 0x5a, 0xad, 0xff, 0x73, 0x09, 0x7a, 0xff,
+    0x93, 0xe1, 0xcd, 0xff, 0xe5, 0x61, 0x11, 0xff, 0xcb, 0x11, 0x9c, 0xff,
+    0x87, 0xe8, 0xb9, 0xff, 0xb1, 0x30, 0xd2, 0xff, 0xef, 0xdd, 0x8a, 0xff,
+    0xd5, 0x5a, 0xa8, 0xff, 0x8f, 0xd1, 0x50, 0xff, 0xad, 0x9b, 0xfb, 0xff,
+    0x81, 0xe5, 0x0d, 0xff, 0x19, 0x52, 0x57, 0xff, 0xde, 0x07, 0xa2, 0xff,
+    0x78, 0x35, 0x70, 0xff, 0xa3, 0x97, 0x23, 0xff, 0x2f, 0x4b, 0x7e, 0xff,
+    0xbb, 0xd0, 0x98, 0xff, 0x45, 0x89, 0x5f, 0xff, 0x04, 0x5c, 0x1d, 0xff,
+    0x54, 0x71, 0xe8, 0xff, 0xe3, 0xaf, 0x01, 0xff, 0x86, 0x8c, 0x28, 0xff,
+    0x08, 0xf5, 0x93, 0xff, 0xe9, 0x7b, 0x14, 0xff, 0x4e, 0xd8, 0x88, 0xff,
+    0x14, 0x2e, 0x46, 0xff, 0xfd, 0xb3, 0x1c, 0xff, 0x6f, 0x22, 0xfa, 0xff,
+    0xaf, 0x4e, 0x4d, 0xff, 0x0c, 0x95, 0x31, 0xff, 0xec, 0xf0, 0x13, 0xff,
+    0xb8, 0x29, 0xb1, 0xff, 0x6a, 0x3b, 0x60, 0xff, 0x03, 0xb2, 0xca, 0xff,
+    0xfd, 0x8b, 0xa7, 0xff, 0x18, 0xec, 0xfd, 0xff, 0x51, 0xcb, 0x73, 0xff,
+    0x40, 0x95, 0x1d, 0xff, 0x8a, 0x4d, 0xc1, 0xff, 0xea, 0x65, 0xed, 0xff,
+    0x34, 0x88, 0x05, 0xff, 0x4d, 0x9b, 0x69, 0xff, 0xc0, 0x48, 0xff, 0xff,
+    0x91, 0xdc, 0x3e, 0xff, 0x38, 0xbf, 0x77, 0xff, 0xca, 0x38, 0x58, 0xff,
+    0xad, 0x9c, 0x9f, 0xff, 0x03, 0x5c, 0x24, 0xff, 0xbe, 0x82, 0xcc, 0xff,
+    0xe3, 0x26, 0x0e, 0xff, 0xa4, 0xe0, 0x65, 0xff, 0x88, 0x00, 0x3a, 0xff,
+    0xb9, 0x86, 0xf8, 0xff, 0x58, 0x4f, 0xc7, 0xff, 0x3c, 0xdb, 0xb5, 0xff,
+    0xc7, 0x42, 0x48, 0xff, 0xb3, 0x05, 0x59, 0xff, 0x46, 0xb8, 0x9e, 0xff,
+    0x98, 0xc5, 0x17, 0xff, 0x2d, 0xd6, 0x7b, 0xff, 0x13, 0x81, 0x55, 0xff,
+    0xf5, 0x4d, 0xf2, 0xff, 0x9e, 0xff, 0xc2, 0xff, 0x07, 0x8e, 0x61, 0xff,
+    0xd4, 0xac, 0xea, 0xff, 0x3c, 0x7e, 0x23, 0xff, 0x15, 0xc4, 0x5c, 0xff,
+    0xff, 0x40, 0xfd, 0xff, 0x30, 0x75, 0x31, 0xff, 0x9a, 0xbb, 0xdf, 0xff,
+    0x6f, 0x81, 0x62, 0xff, 0x1f, 0x49, 0x23, 0xff, 0xbf, 0xb0, 0xe5, 0xff,
+    0x52, 0x1d, 0x6d, 0xff, 0x6c, 0x41, 0x92, 0xff, 0x45, 0x87, 0x2d, 0xff,
+    0x93, 0xeb, 0xeb, 0xff, 0x09, 0xc5, 0xd2, 0xff, 0x4f, 0x17, 0x04, 0xff,
+    0x18, 0x65, 0x36, 0xff, 0xed, 0x02, 0xdb, 0xff, 0x95, 0xf2, 0xf6, 0xff,
+    0xd7, 0x30, 0xb7, 0xff, 0x23, 0xdc, 0x74, 0xff, 0xb4, 0x08, 0xd1, 0xff,
+    0x48, 0x1e, 0x4a, 0xff, 0x9c, 0x4e, 0x56, 0xff, 0x73, 0xa2, 0xbe, 0xff,
+    0x90, 0x15, 0xe3, 0xff, 0xd4, 0x48, 0x6a, 0xff, 0x5b, 0x69, 0xd5, 0xff,
+    0x38, 0xd2, 0x5a, 0xff, 0xc3, 0x35, 0xc3, 0xff, 0x51, 0xc0, 0xe9, 0xff,
+    0x77, 0x1c, 0x9d, 0xff, 0x15, 0xce, 0xdc, 0xff, 0xa3, 0x9d, 0xf1, 0xff,
+    0x47, 0x53, 0x7a, 0xff, 0xbd, 0xc2, 0x34, 0xff, 0x84, 0x19, 0x66, 0xff,
+    0xe7, 0xab, 0x44, 0xff, 0xae, 0x0d, 0xd9, 0xff, 0x15, 0x2c, 0x96, 0xff,
+    0x5c, 0xb4, 0x32, 0xff, 0xcd, 0xe6, 0xa5, 0xff, 0x6d, 0x11, 0xb3, 0xff,
+    0x1e, 0xa8, 0x1d, 0xff, 0x0f, 0x78, 0xce, 0xff, 0x5a, 0x25, 0xec, 0xff,
+    0x9e, 0x51, 0xab, 0xff, 0x2a, 0xe4, 0x14, 0xff, 0xfb, 0xac, 0x47, 0xff,
+    0x55, 0x95, 0x96, 0xff, 0x31, 0x4c, 0xeb, 0xff, 0x16, 0xbf, 0x20, 0xff,
+    0xcd, 0x5a, 0xa1, 0xff, 0xec, 0xf9, 0x4e, 0xff, 0x21, 0xab, 0x6c, 0xff,
+    0x81, 0x69, 0x07, 0xff, 0x93, 0x28, 0xe8, 0xff, 0x64, 0x9f, 0x37, 0xff,
+    0xfe, 0xfa, 0xff, 0xff, 0xce, 0x31, 0xb9, 0xff, 0x6c, 0x93, 0xab, 0xff,
+    0xdd, 0xb1, 0x25, 0xff, 0xbb, 0x11, 0x49, 0xff, 0x8c, 0xc9, 0x09, 0xff,
+    0x67, 0x73, 0x34, 0xff, 0x2b, 0x22, 0x92, 0xff, 0xa2, 0x33, 0x40, 0xff,
+    0xb9, 0xf6, 0xc5, 0xff, 0x60, 0x54, 0x81, 0xff, 0x46, 0xa0, 0x05, 0xff,
+    0xdc, 0x25, 0x95, 0xff, 0x10, 0xf9, 0x48, 0xff, 0x3d, 0x06, 0xbe, 0xff,
+    0xfa, 0xef, 0x35, 0xff, 0x04, 0x7b, 0xc9, 0xff, 0xd0, 0x5f, 0xb0, 0xff,
+    0xf4, 0xb6, 0x1d, 0xff, 0xc2, 0x26, 0x41, 0xff, 0x60, 0x74, 0x63, 0xff,
+    0xe4, 0xf6, 0xb6, 0xff, 0xcd, 0xba, 0x4b, 0xff, 0xab, 0xa6, 0x8d, 0xff,
+    0x5b, 0x79, 0x10, 0xff, 0x75, 0xc2, 0x2c, 0xff, 0xc5, 0x99, 0x84, 0xff,
+    0xfc, 0x3b, 0x9b, 0xff, 0x2e, 0xd1, 0xf4, 0xff, 0xdd, 0xbc, 0xaa, 0xff,
+    0x1e, 0x60, 0x77, 0xff, 0xc2, 0xea, 0x08, 0xff, 0x29, 0x93, 0xa2, 0xff,
+    0x84, 0x80, 0x90, 0xff, 0xa0, 0x07, 0xab, 0xff, 0xe7, 0xdf, 0x0e, 0xff,
+    0x8f, 0x59, 0x66, 0xff, 0x30, 0x82, 0x85, 0xff, 0xf7, 0x6b, 0x49, 0xff,
+    0x59, 0xdc, 0x27, 0xff, 0xe1, 0x0b, 0x0a, 0xff, 0x39, 0x79, 0xbc, 0xff,
+    0x9a, 0x44, 0xe2, 0xff, 0x0c, 0xd8, 0x8e, 0xff, 0xda, 0x83, 0xaf, 0xff,
+    0x74, 0xfb, 0x0c, 0xff, 0xb9, 0x1e, 0x79, 0xff, 0x97, 0xc7, 0xcb, 0xff,
+    0xf0, 0x59, 0x5c, 0xff, 0xdd, 0xf4, 0x80, 0xff, 0x85, 0x01, 0x4a, 0xff,
+    0xd5, 0x8a, 0x8e, 0xff, 0x71, 0xfe, 0x2b, 0xff, 0x1a, 0x72, 0x6b, 0xff,
+    0x8d, 0x09, 0xdb, 0xff, 0xd9, 0x3e, 0x3f, 0xff, 0xb0, 0xec, 0x5a, 0xff,
+    0x5e, 0x1b, 0xbf, 0xff, 0x44, 0x9c, 0xd4, 0xff, 0x6f, 0x39, 0x14, 0xff,
+    0xa9, 0x10, 0xae, 0xff, 0x4e, 0xca, 0x80, 0xff, 0xdf, 0x7f, 0x94, 0xff,
+    0x28, 0xe7, 0x26, 0xff, 0x1b, 0x53, 0x6b, 0xff, 0x88, 0x6e, 0x88, 0xff,
+    0x04, 0x08, 0x3c, 0xff, 0xae, 0x5d, 0xe2, 0xff, 0x48, 0x9e, 0x75, 0xff,
+    0x1c, 0x3f, 0xa2, 0xff, 0xc9, 0xea, 0xba, 0xff, 0x51, 0xd6, 0xdf, 0xff,
+    0xe0, 0x97, 0x16, 0xff, 0x6d, 0xb5, 0xb1, 0xff, 0x09, 0x0c, 0x73, 0xff,
+    0x82, 0x8f, 0x53, 0xff, 0xc5, 0xca, 0x1d, 0xff, 0xa5, 0x65, 0xe9, 0xff,
+    0x7d, 0x38, 0x75, 0xff, 0x5e, 0x91, 0x9f, 0xff, 0x9c, 0xc2, 0x01, 0xff,
+    0x2a, 0x0d, 0x5d, 0xff, 0xa7, 0xd8, 0xdc, 0xff, 0x39, 0xa1, 0x80, 0xff,
+    0x87, 0x3c, 0x9b, 0xff, 0x27, 0x81, 0xfc, 0xff, 0x6d, 0x55, 0xc9, 0xff,
+    0x3e, 0x2a, 0x6a, 0xff, 0x0e, 0x44, 0xac, 0xff, 0x36, 0x14, 0x59, 0xff,
+    0x8a, 0x68, 0xc6, 0xff, 0x13, 0x7e, 0x39, 0xff, 0x6b, 0xfc, 0x12, 0xff,
+    0xa8, 0x29, 0x63, 0xff, 0x3f, 0x72, 0xea, 0xff, 0xf4, 0x38, 0x30, 0xff,
+    0xae, 0xc7, 0xcc, 0xff, 0x46, 0xf8, 0x23, 0xff, 0x1a, 0xa0, 0x38, 0xff,
+    0xd1, 0x73, 0x7a, 0xff, 0x64, 0xae, 0xb5, 0xff, 0x22, 0x16, 0x1b, 0xff,
+    0xc7, 0x47, 0xd4, 0xff, 0x7c, 0xa8, 0x93, 0xff, 0xad, 0xfd, 0x5a, 0xff,
+    0x28, 0x27, 0x9f, 0xff, 0x6f, 0xe5, 0x12, 0xff, 0x56, 0x69, 0x2b, 0xff,
+    0x2f, 0x57, 0x52, 0xff, 0xf9, 0xa1, 0x62, 0xff, 0x46, 0x3e, 0xdd, 0xff,
+    0x09, 0x7d, 0x45, 0xff, 0xa2, 0x6c, 0x28, 0xff, 0x2c, 0x35, 0xe3, 0xff,
+    0x40, 0xb8, 0xb9, 0xff, 0xbb, 0x43, 0x00, 0xff, 0xf2, 0xc5, 0xc5, 0xff,
+    0x47, 0x16, 0xf6, 0xff, 0x7e, 0xd2, 0x7e, 0xff, 0x0a, 0xb0, 0x0b, 0xff,
+    0x74, 0x6a, 0xac, 0xff, 0xe7, 0x89, 0x73, 0xff, 0x90, 0xd8, 0x86, 0xff,
+    0x01, 0x73, 0x31, 0xff, 0xfa, 0xb9, 0xf0, 0xff, 0x11, 0x91, 0x5d, 0xff,
+    0xbb, 0x5d, 0xcf, 0xff, 0x74, 0x16, 0xbf, 0xff, 0x3a, 0xaa, 0x10, 0xff,
+    0xc2, 0x47, 0xd8, 0xff, 0x53, 0xe0, 0x5e, 0xff, 0x7e, 0xf1, 0xc9, 0xff,
+    0xea, 0x2a, 0x1b, 0xff, 0x36, 0xbc, 0xfb, 0xff, 0xfb, 0x65, 0x66, 0xff,
+    0x86, 0x00, 0x89, 0xff, 0xae, 0x4b, 0x4c, 0xff, 0x21, 0x6c, 0xd7, 0xff,
+    0x91, 0xed, 0xa2, 0xff, 0xf3, 0xda, 0xf5, 0xff, 0x57, 0x1a, 0xcb, 0xff,
+    0x28, 0x4e, 0xab, 0xff, 0xea, 0xa6, 0x14, 0xff, 0xb9, 0xe2, 0xf8, 0xff,
+    0x89, 0x2d, 0x8b, 0xff, 0xdb, 0x6d, 0x4a, 0xff, 0x12, 0xff, 0xef, 0xff,
+    0x75, 0x49, 0xc0, 0xff, 0xec, 0x1b, 0x0a, 0xff, 0xbc, 0xc8, 0x29, 0xff,
+    0x9e, 0xd5, 0x78, 0xff, 0x7e, 0x90, 0x1b, 0xff, 0xf7, 0xe0, 0xec, 0xff,
+    0xb1, 0xee, 0x45, 0xff, 0x9a, 0xb3, 0xdf, 0xff, 0x5e, 0x50, 0x70, 0xff,
+    0xcf, 0x8d, 0x22, 0xff, 0x7f, 0xe5, 0xc2, 0xff, 0x55, 0x04, 0x41, 0xff,
+    0x0b, 0xb1, 0x82, 0xff, 0x68, 0x23, 0x52, 0xff, 0xed, 0x56, 0xf0, 0xff,
+    0x7c, 0x12, 0xdd, 0xff, 0x01, 0x3e, 0x43, 0xff, 0xb5, 0xf4, 0xff, 0xff,
+    0x41, 0xe5, 0xc6, 0xff, 0xd9, 0x91, 0x70, 0xff, 0x94, 0x33, 0x3e, 0xff,
+    0x08, 0x5d, 0xf5, 0xff, 0xef, 0x8a, 0xc8, 0xff, 0xd0, 0x9b, 0x7e, 0xff,
+    0xc2, 0x37, 0xe9, 0xff, 0xa6, 0x03, 0xb8, 0xff, 0x8e, 0xc0, 0xf9, 0xff,
+    0x21, 0xdf, 0x19, 0xff, 0x67, 0x92, 0x9e, 0xff, 0x7b, 0x26, 0xf4, 0xff,
+    0x55, 0xeb, 0x11, 0xff, 0xae, 0x98, 0x6f, 0xff, 0x06, 0xd9, 0x9c, 0xff,
+    0x62, 0x5f, 0x5e, 0xff, 0xa7, 0xa3, 0x36, 0xff, 0xc7, 0x31, 0xb6, 0xff,
+    0xee, 0x51, 0xe1, 0xff, 0x3c, 0xf5, 0x28, 0xff, 0x26, 0x0b, 0xfd, 0xff,
+    0xa0, 0xc5, 0x42, 0xff, 0xc4, 0x21, 0x9b, 0xff, 0x33, 0x47, 0xdb, 0xff,
+    0xd6, 0xe1, 0x1f, 0xff, 0x99, 0x33, 0x40, 0xff, 0x5b, 0xd2, 0xa4, 0xff,
+    0xf1, 0x89, 0x50, 0xff, 0xe3, 0x22, 0xf4, 0xff, 0xa2, 0xc6, 0x06, 0xff,
+    0x23, 0x7a, 0x96, 0xff, 0x61, 0x8b, 0x80, 0xff, 0x99, 0x52, 0x2e, 0xff,
+    0x73, 0x1b, 0x56, 0xff, 0x0d, 0x85, 0x00, 0xff, 0x3f, 0xa5, 0xf0, 0xff,
+    0xe7, 0x28, 0x28, 0xff, 0xcc, 0x3a, 0x36, 0xff, 0x36, 0x5d, 0x67, 0xff,
+    0xb5, 0x87, 0x40, 0xff, 0x73, 0xb9, 0x84, 0xff, 0x15, 0x73, 0x2e, 0xff,
+    0x4a, 0xcd, 0x64, 0xff, 0x35, 0x16, 0xcf, 0xff, 0x68, 0x55, 0x39, 0xff,
+    0x54, 0xae, 0x71, 0xff, 0xb3, 0x8d, 0xa7, 0xff, 0x1d, 0x62, 0x54, 0xff,
+    0x4c, 0xe7, 0x93, 0xff, 0x03, 0x0a, 0x3d, 0xff, 0xe2, 0xac, 0xd5, 0xff,
+    0xd4, 0x1e, 0xa1, 0xff, 0x21, 0x5e, 0x03, 0xff, 0x49, 0xca, 0x91, 0xff,
+    0xed, 0x0f, 0xfe, 0xff, 0x02, 0xa8, 0xb2, 0xff, 0xb8, 0x44, 0xdb, 0xff,
+    0x8d, 0x9c, 0x8d, 0xff, 0xd9, 0x87, 0x1a, 0xff, 0x31, 0xdd, 0xba, 0xff,
+    0xbd, 0x46, 0x62, 0xff, 0x97, 0xbd, 0x99, 0xff, 0x4e, 0x8a, 0x0b, 0xff,
+    0xf3, 0x2c, 0x54, 0xff, 0xa2, 0xc6, 0x2d, 0xff, 0x6c, 0x03, 0xa5, 0xff,
+    0x13, 0xb9, 0x02, 0xff, 0x4d, 0xd2, 0xb0, 0xff, 0x89, 0x1e, 0x4c, 0xff,
+    0x62, 0xc9, 0x69, 0xff, 0x1c, 0xb6, 0x1f, 0xff, 0x7d, 0xf5, 0x3c, 0xff,
+    0xd4, 0x74, 0x87, 0xff, 0x3a, 0x4d, 0x70, 0xff, 0xe2, 0xd3, 0xc2, 0xff,
+    0xc9, 0x0c, 0x90, 0xff, 0xfe, 0xa9, 0x3b, 0xff, 0x92, 0x53, 0xd8, 0xff,
+    0xe7, 0x1b, 0x50, 0xff, 0x35, 0x6e, 0xe9, 0xff, 0x22, 0x81, 0x18, 0xff,
+    0x94, 0xe2, 0x8c, 0xff, 0x14, 0x23, 0x65, 0xff, 0xb9, 0x7a, 0x4f, 0xff,
+    0xd1, 0xa7, 0x04, 0xff, 0x53, 0x2f, 0xc9, 0xff, 0x85, 0x62, 0x55, 0xff,
+    0x67, 0xfe, 0x0e, 0xff, 0x41, 0xa1, 0x75, 0xff, 0x7c, 0x0a, 0x8c, 0xff,
+    0xad, 0xef, 0xe4, 0xff, 0x16, 0x74, 0x2f, 0xff, 0x8d, 0xb7, 0x72, 0xff,
+    0x41, 0x37, 0xb1, 0xff, 0xd0, 0x10, 0x46, 0xff, 0xb9, 0xd5, 0xc0, 0xff,
+    0x14, 0xae, 0xda, 0xff, 0xd7, 0xf8, 0xad, 0xff, 0xc1, 0xca, 0x9c, 0xff,
+    0x5b, 0xe1, 0x70, 0xff, 0x79, 0xbf, 0xc1, 0xff, 0x9d, 0x7a, 0x91, 0xff,
+    0x4d, 0xad, 0x0d, 0xff, 0x00, 0x04, 0xb7, 0xff, 0xd8, 0xe9, 0xda, 0xff,
+    0x96, 0x22, 0x55, 0xff, 0xc9, 0x9b, 0x97, 0xff, 0xe6, 0x42, 0x0f, 0xff,
+    0x08, 0x82, 0xba, 0xff, 0xfd, 0xed, 0x26, 0xff, 0x99, 0x03, 0x16, 0xff,
+    0xd1, 0x9d, 0xd9, 0xff, 0x8c, 0x30, 0xe8, 0xff, 0x32, 0x6f, 0x5d, 0xff,
+    0x65, 0x4d, 0x84, 0xff, 0x55, 0x86, 0xba, 0xff, 0xc0, 0xa0, 0x33, 0xff,
+    0x77, 0x27, 0x50, 0xff, 0xe0, 0x35, 0x7f, 0xff, 0x3c, 0xd6, 0x0e, 0xff,
+    0x27, 0x5b, 0x59, 0xff, 0xfa, 0x16, 0x9d, 0xff, 0x9d, 0xce, 0xf9, 0xff,
+    0x73, 0x66, 0x02, 0xff, 0x11, 0xec, 0x73, 0xff, 0x5c, 0xa7, 0xb1, 0xff,
+    0xe1, 0x5e, 0x8b, 0xff, 0x1d, 0xd5, 0xe5, 0xff, 0x86, 0x69, 0x7f, 0xff,
+    0x35, 0x52, 0x61, 0xff, 0xc0, 0x7d, 0xea, 0xff, 0xe0, 0xf1, 0x88, 0xff,
+    0xb3, 0x72, 0x31, 0xff, 0x42, 0x4b, 0xd7, 0xff, 0xf6, 0x13, 0x9b, 0xff,
+    0x00, 0x8d, 0xce, 0xff, 0x4f, 0x2d, 0xa9, 0xff, 0xbb, 0x1a, 0x03, 0xff,
+    0xaa, 0xb0, 0x32, 0xff, 0x0f, 0x64, 0x56, 0xff, 0x4b, 0xca, 0xae, 0xff,
+    0x18, 0x85, 0x84, 0xff, 0x81, 0x2c, 0x22, 0xff, 0xcd, 0xf7, 0xa7, 0xff,
+    0x6d, 0x07, 0x74, 0xff, 0x50, 0xbe, 0xd0, 0xff, 0x9c, 0xcf, 0x9f, 0xff,
+    0x61, 0x5a, 0xed, 0xff, 0x7a, 0x43, 0x8f, 0xff, 0xf3, 0xe9, 0xa9, 0xff,
+    0x1c, 0x8e, 0x68, 0xff, 0xb5, 0x7c, 0xbc, 0xff, 0xe9, 0x54, 0xf7, 0xff,
+    0x06, 0xc0, 0xb0, 0xff, 0xcd, 0x40, 0x63, 0xff, 0x2e, 0x99, 0x16, 0xff,
+    0x69, 0x61, 0x84, 0xff, 0x0d, 0xfc, 0xd2, 0xff, 0x77, 0xa3, 0x37, 0xff,
+    0xf1, 0x6a, 0x6c, 0xff, 0x30, 0x3d, 0x0e, 0xff, 0x49, 0x30, 0xe9, 0xff,
+    0xa4, 0x73, 0x3c, 0xff, 0xf5, 0x56, 0x82, 0xff, 0x2d, 0x10, 0x18, 0xff,
+    0x1a, 0xfd, 0x5b, 0xff, 0x6a, 0xcd, 0xe7, 0xff, 0xac, 0x47, 0x77, 0xff,
+    0xfa, 0x32, 0x21, 0xff, 0x61, 0xf6, 0xf1, 0xff, 0x1f, 0x61, 0xae, 0xff,
+    0xa8, 0xdc, 0xe2, 0xff, 0xbe, 0xbd, 0x7d, 0xff, 0x80, 0x36, 0xfa, 0xff,
+    0x3f, 0xd1, 0x89, 0xff, 0x5d, 0xb7, 0x33, 0xff, 0xf3, 0x7d, 0xb2, 0xff,
+    0xc6, 0xfb, 0x0e, 0xff, 0xa9, 0xc1, 0xf5, 0xff, 0x91, 0x3b, 0x20, 0xff,
+    0x0d, 0xf5, 0x64, 0xff, 0x2f, 0x78, 0xd2, 0xff, 0xa4, 0xe3, 0xa7, 0xff,
+    0xc8, 0x6c, 0x2a, 0xff, 0x63, 0xbe, 0x6b, 0xff, 0x19, 0xfa, 0x37, 0xff,
+    0x49, 0x76, 0xc7, 0xff, 0xc6, 0x32, 0x4b, 0xff, 0xd4, 0x1b, 0xd9, 0xff,
+    0x3b, 0x7b, 0x34, 0xff, 0xad, 0x0c, 0x18, 0xff, 0x75, 0x95, 0xce, 0xff,
+    0xcb, 0x22, 0xb9, 0xff, 0x55, 0xa3, 0x21, 0xff, 0xff, 0x3f, 0xdb, 0xff,
+    0x23, 0x10, 0x15, 0xff, 0x77, 0xad, 0x75, 0xff, 0x33, 0x65, 0xfc, 0xff,
+    0xa0, 0xea, 0x10, 0xff, 0x94, 0xa5, 0x5c, 0xff, 0xe8, 0x5e, 0x4a, 0xff,
+    0x5e, 0xe6, 0xeb, 0xff, 0x87, 0x7e, 0xd5, 0xff, 0x28, 0x3a, 0x68, 0xff,
+    0x73, 0xf2, 0xe7, 0xff, 0xbe, 0x48, 0x0a, 0xff, 0x5b, 0xba, 0xcd, 0xff,
+    0xe0, 0xa0, 0xf8, 0xff, 0xb0, 0x3d, 0x48, 0xff, 0xfb, 0x91, 0x30, 0xff,
+    0x87, 0x11, 0x80, 0xff, 0x31, 0x9b, 0xc0, 0xff, 0xdf, 0xb7, 0x20, 0xff,
+    0x0b, 0xd2, 0x79, 0xff, 0x48, 0x03, 0xe6, 0xff, 0xa3, 0xb1, 0x2b, 0xff,
+    0x25, 0x1d, 0x49, 0xff, 0x57, 0x6c, 0x01, 0xff, 0xf6, 0x29, 0xc7, 0xff,
+    0x4c, 0xce, 0x99, 0xff, 0xa6, 0x02, 0xee, 0xff, 0xd9, 0x4f, 0x1d, 0xff,
+    0x92, 0x1f, 0xa6, 0xff, 0x56, 0xe7, 0xf9, 0xff, 0xad, 0x95, 0x25, 0xff,
+    0x68, 0x06, 0x4f, 0xff, 0x8d, 0x9f, 0xcb, 0xff, 0x08, 0x43, 0xb4, 0xff,
+    0xb7, 0x8d, 0xfe, 0xff, 0xd2, 0x1d, 0xd1, 0xff, 0xeb, 0x96, 0xa6, 0xff,
+    0x8a, 0x6b, 0x4a, 0xff, 0x3b, 0xa3, 0xc4, 0xff, 0x7b, 0x7d, 0x04, 0xff,
+    0x44, 0x08, 0x6c, 0xff, 0x8f, 0x90, 0x42, 0xff, 0x6f, 0x13, 0x50, 0xff,
+    0x2d, 0x75, 0xa1, 0xff, 0xe0, 0x24, 0x61, 0xff, 0x0b, 0x5b, 0xcd, 0xff,
+    0x25, 0x42, 0x6f, 0xff, 0x74, 0x12, 0x4c, 0xff, 0x41, 0xda, 0xc5, 0xff,
+    0x1a, 0x66, 0x76, 0xff, 0xff, 0x01, 0x96, 0xff, 0x83, 0xb9, 0xef, 0xff,
+    0x4f, 0x96, 0xbd, 0xff, 0x94, 0x0b, 0x47, 0xff, 0x71, 0x84, 0xe8, 0xff,
+    0xaf, 0x25, 0xd4, 0xff, 0xe6, 0x4c, 0xaa, 0xff, 0x82, 0x98, 0x7d, 0xff,
+    0x25, 0xaf, 0x27, 0xff, 0x8e, 0xd9, 0xf6, 0xff, 0xf9, 0x3a, 0x69, 0xff,
+    0x2c, 0xfc, 0x9d, 0xff, 0x06, 0xb4, 0x4e, 0xff, 0x98, 0xe7, 0x39, 0xff,
+    0x65, 0x88, 0x95, 0xff, 0xa8, 0xdb, 0xc1, 0xff, 0x0b, 0x28, 0x45, 0xff,
+    0xbd, 0x3a, 0xb6, 0xff, 0xdc, 0x82, 0x91, 0xff, 0x6c, 0xd7, 0x2c, 0xff,
+    0x15, 0x44, 0xbe, 0xff, 0x34, 0xbf, 0x80, 0xff, 0xf3, 0x98, 0x1b, 0xff,
+    0x98, 0x04, 0xb5, 0xff, 0xd5, 0xdc, 0x2a, 0xff, 0x3d, 0x14, 0x7a, 0xff,
+    0xa0, 0x76, 0x3f, 0xff, 0x2c, 0xd3, 0x94, 0xff, 0x02, 0xeb, 0xb8, 0xff,
+    0x44, 0x66, 0x15, 0xff, 0xc3, 0x34, 0x5a, 0xff, 0x20, 0xfa, 0x3d, 0xff,
+    0xab, 0x1a, 0xd9, 0xff, 0x6f, 0x6f, 0x13, 0xff, 0xcb, 0x3c, 0x39, 0xff,
+    0x8b, 0xdc, 0x95, 0xff, 0xda, 0xf4, 0x82, 0xff, 0x95, 0x86, 0xd5, 0xff,
+    0xb7, 0xad, 0x3b, 0xff, 0x81, 0xec, 0x58, 0xff, 0xc2, 0x90, 0xbd, 0xff,
+    0xfb, 0xd9, 0x4c, 0xff, 0x28, 0x84, 0x8b, 0xff, 0x01, 0xb6, 0x5e, 0xff,
+    0xe3, 0x5a, 0x94, 0xff, 0x7e, 0xd1, 0x79, 0xff, 0x20, 0xf3, 0x1a, 0xff,
+    0xde, 0xbb, 0x64, 0xff, 0x45, 0x62, 0x46, 0xff, 0x82, 0x2f, 0x09, 0xff,
+    0x55, 0xe6, 0x33, 0xff, 0x0e, 0x51, 0x88, 0xff, 0xc0, 0xd7, 0x9e, 0xff,
+    0x29, 0xb5, 0x2c, 0xff, 0xd6, 0x57, 0x90, 0xff, 0xed, 0xc7, 0xd6, 0xff,
+    0x18, 0xa6, 0x1e, 0xff, 0x50, 0x4e, 0xc3, 0xff, 0xb0, 0xde, 0x02, 0xff,
+    0xa1, 0xf0, 0x40, 0xff, 0x85, 0x94, 0x9a, 0xff, 0xd6, 0xa7, 0xab, 0xff,
+    0xec, 0x2c, 0x2d, 0xff, 0xaf, 0xce, 0xe2, 0xff, 0x69, 0x8c, 0x40, 0xff,
+    0xbb, 0x46, 0x19, 0xff, 0xd2, 0x53, 0x06, 0xff, 0x09, 0xf0, 0x8c, 0xff,
+    0xf3, 0x3c, 0x78, 0xff, 0x35, 0xb4, 0x1e, 0xff, 0x59, 0xc8, 0x0d, 0xff,
+    0x05, 0x06, 0x93, 0xff, 0xa3, 0xf3, 0x5a, 0xff, 0x6b, 0x51, 0xa5, 0xff,
+    0x4a, 0xc2, 0x44, 0xff, 0xda, 0x72, 0xeb, 0xff, 0xb6, 0x4a, 0x07, 0xff,
+    0xe9, 0x09, 0x6e, 0xff, 0x46, 0xcc, 0xf4, 0xff, 0x8e, 0x59, 0x57, 0xff,
+    0xf0, 0xfb, 0xa5, 0xff, 0x5b, 0x9e, 0x05, 0xff, 0x49, 0xc6, 0x65, 0xff,
+    0x25, 0x0e, 0xf0, 0xff, 0xc6, 0x23, 0x74, 0xff, 0x78, 0xfa, 0x99, 0xff,
+    0xb6, 0x6d, 0x41, 0xff, 0x05, 0x56, 0xfe, 0xff, 0x67, 0xa5, 0xa0, 0xff,
+    0xee, 0x8f, 0x5c, 0xff, 0x1d, 0x5d, 0xc3, 0xff, 0x8d, 0x21, 0x67, 0xff,
+    0x77, 0x4e, 0x06, 0xff, 0xd8, 0x86, 0xdd, 0xff, 0x10, 0xac, 0xfb, 0xff,
+    0xea, 0xdf, 0xaf, 0xff, 0x93, 0x80, 0x4d, 0xff, 0x3b, 0x51, 0xcb, 0xff,
+    0xff, 0x97, 0xf5, 0xff, 0x5d, 0x2d, 0x5e, 0xff, 0x34, 0xc9, 0xa3, 0xff,
+    0x6c, 0x49, 0x21, 0xff, 0x0c, 0x15, 0xfe, 0xff, 0x39, 0x59, 0x7b, 0xff,
+    0x1d, 0x34, 0x2a, 0xff, 0x60, 0x75, 0xde, 0xff, 0x44, 0x44, 0x04, 0xff,
+    0xb3, 0xc4, 0xb8, 0xff, 0xca, 0x16, 0xd7, 0xff, 0x39, 0x7c, 0xa3, 0xff,
+    0xfd, 0x26, 0xe5, 0xff, 0x9a, 0xe2, 0x2a, 0xff, 0x61, 0x83, 0x97, 0xff,
+    0xc5, 0xaa, 0x6f, 0xff, 0x33, 0xc2, 0xd9, 0xff, 0x97, 0x12, 0x56, 0xff,
+    0xe3, 0x26, 0xf8, 0xff, 0xa3, 0x3b, 0x62, 0xff, 0x5c, 0xeb, 0xe9, 0xff,
+    0x03, 0x1c, 0x36, 0xff, 0xcc, 0xf9, 0xb5, 0xff, 0xf6, 0x89, 0x74, 0xff,
+    0x62, 0x69, 0xed, 0xff, 0xc0, 0x0b, 0xdc, 0xff, 0x15, 0xbd, 0x18, 0xff,
+    0x4d, 0x83, 0xfb, 0xff, 0x9b, 0x54, 0x08, 0xff, 0x5a, 0x18, 0x87, 0xff,
+    0x27, 0xe8, 0xa3, 0xff, 0xe4, 0xae, 0x5b, 0xff, 0x42, 0x1f, 0xcd, 0xff,
+    0x17, 0xcc, 0xfa, 0xff, 0x88, 0x9e, 0x62, 0xff, 0xdc, 0x58, 0xb5, 0xff,
+    0xba, 0xe0, 0x40, 0xff, 0x41, 0x8c, 0xef, 0xff, 0xee, 0x6b, 0xc1, 0xff,
+    0xc1, 0x27, 0x85, 0xff, 0x0f, 0x84, 0x10, 0xff, 0x5e, 0x19, 0xc9, 0xff,
+    0x81, 0xa0, 0x8c, 0xff, 0x19, 0x32, 0xad, 0xff, 0x39, 0x67, 0xd3, 0xff,
+    0xd3, 0x93, 0x26, 0xff, 0x11, 0xbb, 0x7d, 0xff, 0xcb, 0x02, 0xe6, 0xff,
+    0x86, 0x55, 0x3c, 0xff, 0xaa, 0x79, 0xd3, 0xff, 0xfc, 0x92, 0x22, 0xff,
+    0x53, 0x34, 0xc9, 0xff, 0x42, 0xb3, 0x07, 0xff, 0xde, 0x1e, 0x51, 0xff,
+    0xa8, 0xc4, 0xdb, 0xff, 0x54, 0x2f, 0x8d, 0xff, 0xc5, 0xfd, 0x1d, 0xff,
+    0xf5, 0xb2, 0xef, 0xff, 0xb5, 0x02, 0xa4, 0xff, 0x59, 0xc6, 0x71, 0xff,
+    0xa3, 0x47, 0x8b, 0xff, 0x67, 0x26, 0x0d, 0xff, 0x4f, 0x60, 0x99, 0xff,
+    0xba, 0xc4, 0x6e, 0xff, 0x02, 0x0f, 0xb6, 0xff, 0x7f, 0xa6, 0x09, 0xff,
+    0x17, 0x62, 0xe0, 0xff, 0xc5, 0x79, 0x70, 0xff, 0xe5, 0x9e, 0xab, 0xff,
+    0x76, 0xe1, 0x12, 0xff, 0x9d, 0xb2, 0x67, 0xff, 0xea, 0x0e, 0xeb, 0xff,
+    0x88, 0xf7, 0x41, 0xff, 0x71, 0x2c, 0x6e, 0xff, 0x9f, 0x67, 0x13, 0xff,
+    0x51, 0x4c, 0x37, 0xff, 0x10, 0xaf, 0xbc, 0xff, 0x70, 0x09, 0x84, 0xff,
+    0xa9, 0x3d, 0xed, 0xff, 0x24, 0xd4, 0xac, 0xff, 0xf3, 0x76, 0x20, 0xff,
+    0x74, 0xf8, 0xb9, 0xff, 0x1b, 0x88, 0x14, 0xff, 0x4d, 0x9e, 0xc9, 0xff,
+    0xb9, 0x6e, 0x82, 0xff, 0x86, 0x46, 0x0c, 0xff, 0x99, 0x2b, 0x98, 0xff,
+    0x32, 0xb2, 0x5b, 0xff, 0x79, 0x38, 0x2b, 0xff, 0xdd, 0xcc, 0x7e, 0xff,
+    0x3a, 0x1f, 0x8e, 0xff, 0x6e, 0x6f, 0x66, 0xff, 0x00, 0xf4, 0x53, 0xff,
+    0xcc, 0x9f, 0xd6, 0xff, 0x36, 0x5f, 0x6e, 0xff, 0x79, 0x75, 0x24, 0xff,
+    0x99, 0xdb, 0xad, 0xff, 0x5f, 0x2e, 0x32, 0xff, 0xa5, 0x7c, 0x99, 0xff,
+    0x25, 0x13, 0x52, 0xff, 0x78, 0x63, 0xe2, 0xff, 0x97, 0x36, 0x6f, 0xff,
+    0x1c, 0xa2, 0x21, 0xff, 0xd2, 0xce, 0xdb, 0xff, 0xab, 0xe3, 0xb2, 0xff,
+    0x33, 0x60, 0x2c, 0xff, 0x9f, 0xf2, 0x77, 0xff, 0xc6, 0xbf, 0x5d, 0xff,
+    0x6b, 0x7a, 0x19, 0xff, 0x7c, 0x1a, 0x34, 0xff, 0x9c, 0x47, 0xc6, 0xff,
+    0x2e, 0x70, 0x8c, 0xff, 0x72, 0xec, 0x19, 0xff, 0x07, 0xaa, 0xac, 0xff,
+    0xd2, 0xcf, 0x59, 0xff, 0x9d, 0x4c, 0x87, 0xff, 0x8b, 0xee, 0xa8, 0xff,
+    0x1f, 0x87, 0x6d, 0xff, 0x31, 0xe1, 0x11, 0xff, 0x83, 0x43, 0x37, 0xff,
+    0x12, 0x6a, 0xcb, 0xff, 0x47, 0x99, 0x4d, 0xff, 0x6b, 0xe7, 0x27, 0xff,
+    0x37, 0x74, 0x34, 0xff, 0xf8, 0xa3, 0xd3, 0xff, 0x82, 0xed, 0x62, 0xff,
+    0xc9, 0xb9, 0x24, 0xff, 0x2a, 0x8b, 0x7f, 0xff, 0xde, 0xf7, 0x31, 0xff,
+    0xaf, 0x41, 0x54, 0xff, 0xf0, 0xe8, 0xc0, 0xff, 0x47, 0x07, 0x42, 0xff,
+    0xa8, 0xc0, 0x88, 0xff, 0xd5, 0x24, 0xcf, 0xff, 0x52, 0x69, 0xb2, 0xff,
+    0x09, 0xcb, 0x9d, 0xff, 0xbd, 0x93, 0x80, 0xff, 0x19, 0xa8, 0xcd, 0xff,
+    0xee, 0xed, 0xf5, 0xff, 0x2c, 0xd7, 0x58, 0xff, 0xb8, 0x92, 0x4a, 0xff,
+    0xd4, 0x6d, 0x03, 0xff, 0x40, 0x1b, 0xc6, 0xff, 0x05, 0x58, 0x3c, 0xff,
+    0xd0, 0x45, 0x7c, 0xff, 0xb2, 0x01, 0xe2, 0xff, 0x66, 0x64, 0x44, 0xff,
+    0xfe, 0xbe, 0x73, 0xff, 0x39, 0xe1, 0xad, 0xff, 0x71, 0x7c, 0x4f, 0xff,
+    0xad, 0xd5, 0xfe, 0xff, 0x47, 0x5f, 0xd0, 0xff, 0x20, 0x99, 0xa8, 0xff,
+    0x92, 0xe8, 0x49, 0xff, 0xfb, 0x4c, 0xbf, 0xff, 0xb4, 0xad, 0x3a, 0xff,
+    0xe6, 0x3e, 0xb0, 0xff, 0x8c, 0xc6, 0xea, 0xff, 0x10, 0x34, 0xc3, 0xff,
+    0xf6, 0x0e, 0x4a, 0xff, 0xb5, 0x92, 0x7e, 0xff, 0xd5, 0x69, 0xdd, 0xff,
+    0x4a, 0xf6, 0x15, 0xff, 0xca, 0xa7, 0xbf, 0xff, 0xfd, 0xe9, 0x81, 0xff,
+    0x66, 0x1e, 0x05, 0xff, 0x51, 0x46, 0x38, 0xff, 0x89, 0xb7, 0x65, 0xff,
+    0x75, 0x00, 0x53, 0xff, 0xf7, 0x40, 0xf7, 0xff, 0x4e, 0x8b, 0x3d, 0xff,
+    0xdd, 0xd1, 0xe2, 0xff, 0x26, 0x26, 0x98, 0xff, 0xfa, 0xf6, 0xfa, 0xff,
+    0x54, 0xb1, 0x50, 0xff, 0xb7, 0x37, 0x6d, 0xff, 0xe0, 0x29, 0xdc, 0xff,
+    0x3d, 0xdc, 0x49, 0xff, 0x63, 0x15, 0xf9, 0xff, 0x0e, 0x65, 0x33, 0xff,
+    0xbe, 0x07, 0xe4, 0xff, 0xec, 0x77, 0xb8, 0xff, 0x6f, 0xcd, 0xf3, 0xff,
+    0xcf, 0x0f, 0x77, 0xff, 0x97, 0x82, 0xad, 0xff, 0xe4, 0xd7, 0x82, 0xff,
+    0x24, 0x38, 0xe5, 0xff, 0xd1, 0x15, 0xbe, 0xff, 0x07, 0x69, 0x46, 0xff,
+    0x43, 0x09, 0xf1, 0xff, 0x1c, 0x33, 0xa7, 0xff, 0x9d, 0xd6, 0xe9, 0xff,
+    0x75, 0x1e, 0xd4, 0xff, 0x54, 0x71, 0x8e, 0xff, 0x97, 0xce, 0x1c, 0xff,
+    0x1f, 0x89, 0xe6, 0xff, 0x63, 0x39, 0x4f, 0xff, 0x2a, 0xfd, 0x07, 0xff,
+    0x8e, 0x7e, 0x36, 0xff, 0xcd, 0x3f, 0x55, 0xff, 0x34, 0x56, 0x1f, 0xff,
+    0x66, 0x06, 0x2f, 0xff, 0xd8, 0x85, 0xa9, 0xff, 0x92, 0x35, 0x90, 0xff,
+    0x5c, 0xc0, 0xdd, 0xff, 0x86, 0xfc, 0x69, 0xff, 0xe8, 0xa4, 0xfa, 0xff,
+    0x7b, 0xea, 0x5e, 0xff, 0x57, 0x99, 0x93, 0xff, 0x8e, 0xb3, 0x0b, 0xff,
+    0x0d, 0xd0, 0xa3, 0xff, 0xca, 0x30, 0x29, 0xff, 0x26, 0x0d, 0xde, 0xff,
+    0xdb, 0x93, 0x1c, 0xff, 0x14, 0x16, 0x3e, 0xff, 0xe9, 0xc4, 0x89, 0xff,
+    0xd1, 0x02, 0x09, 0xff, 0x0a, 0x79, 0x22, 0xff, 0x59, 0x30, 0xf3, 0xff,
+    0x2c, 0xe1, 0x9c, 0xff, 0x7e, 0x07, 0x1b, 0xff, 0xc3, 0x7b, 0x30, 0xff,
+    0xa6, 0xff, 0x0e, 0xff, 0x51, 0xb3, 0x94, 0xff, 0x20, 0x41, 0xf3, 0xff,
+    0x6c, 0xc1, 0x3e, 0xff, 0x03, 0x06, 0xca, 0xff, 0x31, 0x4a, 0x2b, 0xff,
+    0xae, 0xbc, 0xa1, 0xff, 0x13, 0x80, 0xfe, 0xff, 0x38, 0xfd, 0xcd, 0xff,
+    0xeb, 0x93, 0x94, 0xff, 0x22, 0x75, 0x17, 0xff, 0x02, 0xac, 0x9f, 0xff,
+    0x93, 0x14, 0xbd, 0xff, 0xba, 0x52, 0x00, 0xff, 0x14, 0xa5, 0x84, 0xff,
+    0xad, 0xe0, 0xb5, 0xff, 0x43, 0x84, 0x0e, 0xff, 0xee, 0xc8, 0xa1, 0xff,
+    0x1c, 0x9b, 0xbb, 0xff, 0x95, 0x59, 0x09, 0xff, 0xe7, 0x8a, 0x95, 0xff,
+    0x2b, 0xc0, 0x66, 0xff, 0x7c, 0xa1, 0x15, 0xff, 0x4b, 0x3a, 0x47, 0xff,
+    0xb2, 0x53, 0x91, 0xff, 0x5f, 0xab, 0xd2, 0xff, 0x08, 0x27, 0x04, 0xff,
+    0xac, 0xbb, 0x58, 0xff, 0x7a, 0x57, 0x95, 0xff, 0x90, 0x91, 0x18, 0xff,
+    0xb9, 0xdd, 0x79, 0xff, 0xd8, 0x7a, 0x00, 0xff, 0x5c, 0x4d, 0xc3, 0xff,
+    0xed, 0x9a, 0x3f, 0xff, 0x0e, 0x5c, 0x12, 0xff, 0xcd, 0xae, 0x68, 0xff,
+    0x3b, 0x2b, 0xa0, 0xff, 0x84, 0x52, 0x2b, 0xff, 0xf4, 0x96, 0xf1, 0xff,
+    0xb4, 0xd3, 0x94, 0xff, 0x42, 0x18, 0xbb, 0xff, 0xfa, 0xa0, 0xf9, 0xff,
+    0xa7, 0xbc, 0x8a, 0xff, 0x80, 0xe4, 0xc2, 0xff, 0x49, 0x1f, 0x0c, 0xff,
+    0x04, 0x5e, 0x73, 0xff, 0xf4, 0x47, 0x25, 0xff, 0x1e, 0x7a, 0x9f, 0xff,
+    0xbf, 0x2b, 0x19, 0xff, 0xa0, 0xc6, 0x30, 0xff, 0x37, 0x8c, 0xcf, 0xff,
+    0xde, 0x21, 0x52, 0xff, 0x47, 0x4e, 0xf3, 0xff, 0x9c, 0xef, 0x8b, 0xff,
+    0x80, 0x5b, 0x5f, 0xff, 0xbe, 0xaf, 0xbd, 0xff, 0x53, 0xfe, 0x6b, 0xff,
+    0x68, 0x52, 0xe8, 0xff, 0x89, 0xa5, 0xc8, 0xff, 0xbb, 0xf3, 0x62, 0xff,
+    0xaa, 0x8f, 0xe0, 0xff, 0x4a, 0x65, 0x76, 0xff, 0x1b, 0xd3, 0xcb, 0xff,
+    0x63, 0x98, 0x84, 0xff, 0x3e, 0x24, 0x5f, 0xff, 0xde, 0x51, 0xb9, 0xff,
+    0x92, 0xdf, 0x73, 0xff, 0xf0, 0x82, 0x03, 0xff, 0x82, 0xd0, 0x69, 0xff,
+    0xe5, 0x29, 0x8e, 0xff, 0x8e, 0x6f, 0x59, 0xff, 0xc0, 0xd7, 0xac, 0xff,
+    0x9e, 0x0c, 0x45, 0xff, 0xdd, 0x5a, 0xe6, 0xff, 0xb2, 0x2c, 0x7c, 0xff,
+    0x69, 0xeb, 0xd0, 0xff, 0x3f, 0xd9, 0x6b, 0xff, 0xe7, 0x39, 0x48, 0xff,
+    0x87, 0x62, 0xd9, 0xff, 0x61, 0x0e, 0x64, 0xff, 0x05, 0x4c, 0x3f, 0xff,
+    0x8a, 0x19, 0xed, 0xff, 0x6a, 0x6a, 0x78, 0xff, 0xc0, 0xff, 0x28, 0xff,
+    0xae, 0x41, 0xd0, 0xff, 0x5a, 0xe3, 0x7e, 0xff, 0xf7, 0x21, 0xc0, 0xff,
+    0x17, 0xf7, 0x20, 0xff, 0xda, 0x96, 0x60, 0xff, 0x3b, 0xea, 0x2c, 0xff,
+    0xfe, 0x63, 0x40, 0xff, 0xbf, 0x1a, 0xf9, 0xff, 0x50, 0xf8, 0x69, 0xff,
+    0x2e, 0xc9, 0xb5, 0xff, 0xa6, 0x40, 0x51, 0xff, 0x70, 0xb4, 0x2d, 0xff,
+    0x89, 0xfd, 0x87, 0xff, 0xac, 0x83, 0x5b, 0xff, 0x30, 0x00, 0xb0, 0xff,
+    0x69, 0xbc, 0xf8, 0xff, 0xbd, 0xf3, 0xc6, 0xff, 0xe2, 0x11, 0x7b, 0xff,
+    0x04, 0xa9, 0x5e, 0xff, 0x7a, 0x61, 0xd5, 0xff, 0x12, 0x4a, 0x6b, 0xff,
+    0x58, 0xef, 0x15, 0xff, 0x22, 0x29, 0xda, 0xff, 0xe2, 0x74, 0x61, 0xff,
+    0xc5, 0xce, 0xe7, 0xff, 0xad, 0x9d, 0x43, 0xff, 0x33, 0x12, 0xd1, 0xff,
+    0x6b, 0xdd, 0xb1, 0xff, 0x4d, 0x0b, 0x86, 0xff, 0x13, 0x67, 0xc0, 0xff,
+    0xf8, 0x38, 0xe8, 0xff, 0x2b, 0xdb, 0x6c, 0xff, 0xac, 0x73, 0xb4, 0xff,
+    0xee, 0xa2, 0x37, 0xff, 0x5e, 0x40, 0xd5, 0xff, 0x06, 0x86, 0x0f, 0xff,
+    0xf7, 0x27, 0xa2, 0xff, 0xa4, 0x71, 0x7a, 0xff, 0x3e, 0x41, 0x32, 0xff,
+    0x73, 0x1d, 0xb7, 0xff, 0xee, 0xb8, 0x56, 0xff, 0xd9, 0x59, 0x01, 0xff,
+    0x9e, 0x14, 0x45, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0x73, 0x89, 0xda, 0xff,
+    0x2d, 0xed, 0x1f, 0xff, 0x0e, 0x61, 0xa5, 0xff, 0xbb, 0x18, 0xe4, 0xff,
+    0x3b, 0x9a, 0x4e, 0xff, 0x55, 0x56, 0xf0, 0xff, 0x71, 0xae, 0x0f, 0xff,
+    0x0d, 0x35, 0x71, 0xff, 0x5f, 0x9d, 0x25, 0xff, 0x46, 0xc8, 0xb8, 0xff,
+    0x81, 0x49, 0x0b, 0xff, 0xcf, 0xbb, 0x33, 0xff, 0x59, 0x7f, 0xf0, 0xff,
+    0x2e, 0x99, 0x27, 0xff, 0x73, 0xee, 0xa6, 0xff, 0xd5, 0x73, 0x1e, 0xff,
+    0xa5, 0x94, 0xcc, 0xff, 0xca, 0xd5, 0x30, 0xff, 0x25, 0xba, 0x5b, 0xff,
+    0x48, 0x05, 0x9d, 0xff, 0x80, 0x7f, 0xf4, 0xff, 0x37, 0x2f, 0x3b, 0xff,
+    0xc8, 0xb5, 0xa5, 0xff, 0x91, 0x6e, 0xe0, 0xff, 0xa1, 0x0b, 0xec, 0xff,
+    0x28, 0xc2, 0x9d, 0xff, 0x88, 0x4a, 0xc3, 0xff, 0x1c, 0xa6, 0x10, 0xff,
+    0x63, 0x7f, 0xde, 0xff, 0xee, 0x2b, 0xa2, 0xff, 0x10, 0x55, 0xcb, 0xff,
+    0x38, 0x13, 0xff, 0xff, 0xe1, 0xcd, 0x9e, 0xff, 0x49, 0x25, 0xdd, 0xff,
+    0xfc, 0xdf, 0x76, 0xff, 0x91, 0x47, 0x4a, 0xff, 0x16, 0x68, 0x05, 0xff,
+    0x5a, 0xd8, 0x3b, 0xff, 0xa0, 0x77, 0xa9, 0xff, 0xc9, 0xb6, 0x23, 0xff,
+    0xdc, 0x03, 0x44, 0xff, 0x9a, 0xdb, 0x78, 0xff, 0x75, 0x66, 0xa2, 0xff,
+    0x3c, 0x8e, 0x39, 0xff, 0x10, 0x3d, 0xb7, 0xff, 0x9c, 0xb7, 0x7f, 0xff,
+    0x78, 0xf5, 0xf1, 0xff, 0xdf, 0xaa, 0x53, 0xff, 0xb3, 0x85, 0x08, 0xff,
+    0x8b, 0x53, 0x40, 0xff, 0xc5, 0xf9, 0x7a, 0xff, 0x69, 0x18, 0x22, 0xff,
+    0x76, 0x7f, 0x00, 0xff, 0x1d, 0x07, 0x9b, 0xff, 0x41, 0xbb, 0x7f, 0xff,
+    0x91, 0xde, 0xf1, 0xff, 0x30, 0x37, 0x24, 0xff, 0xcc, 0xea, 0x4e, 0xff,
+    0x0e, 0xc9, 0x96, 0xff, 0x24, 0x82, 0x14, 0xff, 0x61, 0xd8, 0x8b, 0xff,
+    0x36, 0x2a, 0xa9, 0xff, 0x05, 0xa3, 0x6b, 0xff, 0xce, 0x43, 0x98, 0xff,
+    0x87, 0x6c, 0x38, 0xff, 0xac, 0x03, 0x55, 0xff, 0xc8, 0xa9, 0x88, 0xff,
+    0x5d, 0x3a, 0x27, 0xff, 0x9f, 0xfa, 0xb3, 0xff, 0xce, 0x8d, 0xd4, 0xff,
+    0x24, 0xe5, 0x35, 0xff, 0xd6, 0x1c, 0xc4, 0xff, 0xf3, 0x66, 0x86, 0xff,
+    0x2c, 0xf5, 0x61, 0xff, 0xc4, 0x10, 0x51, 0xff, 0x0b, 0x6d, 0x8e, 0xff,
+    0x9b, 0x20, 0xaf, 0xff, 0xf8, 0xc5, 0x5a, 0xff, 0xbf, 0x03, 0x77, 0xff,
+    0x10, 0xb6, 0x93, 0xff, 0x37, 0x3e, 0xe3, 0xff, 0x58, 0xe7, 0x87, 0xff,
+    0xf8, 0x26, 0x15, 0xff, 0xda, 0xa4, 0xc4, 0xff, 0x15, 0x50, 0x4a, 0xff,
+    0xa5, 0xd0, 0x01, 0xff, 0x6d, 0x90, 0x6f, 0xff, 0x0a, 0x5b, 0x53, 0xff,
+    0x56, 0xd6, 0x83, 0xff, 0x78, 0x31, 0xb1, 0xff, 0xc7, 0x73, 0x72, 0xff,
+    0x45, 0xdf, 0x89, 0xff, 0xdc, 0x04, 0x24, 0xff, 0x98, 0x9d, 0x39, 0xff,
+    0x57, 0x6f, 0x90, 0xff, 0x22, 0x8c, 0x6d, 0xff, 0xc2, 0xa9, 0x0d, 0xff,
+    0x03, 0x3b, 0x21, 0xff, 0x7b, 0x75, 0x33, 0xff, 0xd4, 0xa0, 0x96, 0xff,
+    0x26, 0x8f, 0xd8, 0xff, 0xb0, 0x33, 0xb8, 0xff, 0x48, 0x22, 0x85, 0xff,
+    0x33, 0xf6, 0x0b, 0xff, 0x68, 0x85, 0xc8, 0xff, 0xbf, 0x32, 0xeb, 0xff,
+    0xeb, 0xac, 0x4f, 0xff, 0x8d, 0x0a, 0x01, 0xff, 0x60, 0xec, 0x93, 0xff,
+    0xff, 0x52, 0x1b, 0xff, 0xce, 0x64, 0x31, 0xff, 0x42, 0x33, 0x65, 0xff,
+    0x26, 0xd3, 0x97, 0xff, 0x5b, 0xbd, 0xda, 0xff, 0xd7, 0x92, 0xa5, 0xff,
+    0x01, 0xb0, 0x4b, 0xff, 0x87, 0xcc, 0xfc, 0xff, 0xcf, 0xf2, 0xcd, 0xff,
+    0xe5, 0x64, 0x57, 0xff, 0xb4, 0x19, 0x44, 0xff, 0x7a, 0x9c, 0xb1, 0xff,
+    0xe0, 0xb2, 0xdb, 0xff, 0x9b, 0x68, 0xfa, 0xff, 0xc6, 0x11, 0x3d, 0xff,
+    0x83, 0x4d, 0xd6, 0xff, 0x94, 0xfb, 0xef, 0xff, 0xbe, 0x77, 0x29, 0xff,
+    0x56, 0xe9, 0xb1, 0xff, 0x23, 0xcd, 0x0d, 0xff, 0x49, 0x2e, 0xc3, 0xff,
+    0xe8, 0xd9, 0xf6, 0xff, 0x7c, 0xb8, 0x42, 0xff, 0x18, 0x74, 0x97, 0xff,
+    0xf7, 0x09, 0x79, 0xff, 0x4c, 0xc3, 0x1c, 0xff, 0x93, 0x40, 0xec, 0xff,
+    0xa6, 0x88, 0xda, 0xff, 0x78, 0xde, 0x9b, 0xff, 0x1a, 0xa4, 0xf8, 0xff,
+    0xe2, 0x8f, 0x1b, 0xff, 0xab, 0x34, 0xde, 0xff, 0x20, 0x57, 0xc7, 0xff,
+    0x4c, 0xfb, 0x11, 0xff, 0x7e, 0x2d, 0xfd, 0xff, 0xeb, 0x88, 0x53, 0xff,
+    0x9e, 0x5b, 0xae, 0xff, 0x76, 0x79, 0x71, 0xff, 0x92, 0xef, 0xde, 0xff,
+    0x07, 0x65, 0x8c, 0xff, 0xef, 0xac, 0xb5, 0xff, 0xd3, 0x16, 0xd5, 0xff,
+    0x40, 0x45, 0x0e, 0xff, 0xe2, 0x83, 0x34, 0xff, 0xf2, 0xf2, 0x1a, 0xff,
+    0xa8, 0x8d, 0x4b, 0xff, 0x00, 0x3d, 0xd4, 0xff, 0x72, 0xbc, 0xef, 0xff,
+    0xcd, 0xe7, 0x5e, 0xff, 0x81, 0x1f, 0x1a, 0xff, 0xf4, 0xf1, 0xb2, 0xff,
+    0xb4, 0x63, 0xea, 0xff, 0x63, 0xc1, 0xcf, 0xff, 0xa1, 0xed, 0x56, 0xff,
+    0x40, 0x17, 0xee, 0xff, 0xe8, 0xe4, 0x1a, 0xff, 0x70, 0xc2, 0x6d, 0xff,
+    0xf8, 0x41, 0xfa, 0xff, 0x89, 0x57, 0xe0, 0xff, 0x1a, 0xca, 0x96, 0xff,
+    0x4d, 0x99, 0xaf, 0xff, 0x08, 0x4c, 0x28, 0xff, 0xb7, 0xc3, 0xff, 0xff,
+    0x2c, 0x7b, 0x5c, 0xff, 0x53, 0x19, 0xe0, 0xff, 0x16, 0x97, 0xab, 0xff,
+    0x92, 0x25, 0xc5, 0xff, 0xf2, 0x70, 0xf8, 0xff, 0x0e, 0x03, 0x15, 0xff,
+    0x9f, 0x3e, 0xba, 0xff, 0x3a, 0x5d, 0x61, 0xff, 0x50, 0x2e, 0x2e, 0xff,
+    0xbd, 0x48, 0x90, 0xff, 0x28, 0x91, 0x18, 0xff, 0x65, 0xd2, 0x73, 0xff,
+    0x4b, 0x54, 0xc2, 0xff, 0x18, 0x08, 0x05, 0xff, 0x58, 0x8d, 0x67, 0xff,
+    0xff, 0xe4, 0x7f, 0xff, 0x45, 0x9b, 0xbd, 0xff, 0xe6, 0x38, 0x1d, 0xff,
+    0x11, 0xad, 0x4b, 0xff, 0x6c, 0x19, 0xd1, 0xff, 0xf3, 0x4f, 0x7e, 0xff,
+    0x96, 0x93, 0xdf, 0xff, 0x07, 0x7d, 0x66, 0xff, 0x69, 0x1f, 0x17, 0xff,
+    0x2f, 0x5d, 0xcc, 0xff, 0xb1, 0xf0, 0x5c, 0xff, 0x83, 0x4e, 0xa3, 0xff,
+    0x01, 0x7a, 0x4a, 0xff, 0x3a, 0xb6, 0x02, 0xff, 0xb8, 0x27, 0x3b, 0xff,
+    0x52, 0x50, 0xc1, 0xff, 0x8b, 0xed, 0x71, 0xff, 0x6c, 0xd4, 0x42, 0xff,
+    0x3d, 0xa9, 0x83, 0xff, 0x95, 0x68, 0x37, 0xff, 0xdb, 0xcf, 0xbc, 0xff,
+    0xb5, 0x9f, 0x45, 0xff, 0x2a, 0x0d, 0x07, 0xff, 0x19, 0xc5, 0xf1, 0xff,
+    0x52, 0x36, 0x36, 0xff, 0xb1, 0x1d, 0x64, 0xff, 0x61, 0xdf, 0x26, 0xff,
+    0x86, 0xfb, 0xfe, 0xff, 0x22, 0x01, 0x91, 0xff, 0xb6, 0xc9, 0xc8, 0xff,
+    0x66, 0x23, 0xf3, 0xff, 0x32, 0xb0, 0x65, 0xff, 0x8c, 0x10, 0xa6, 0xff,
+    0xf8, 0x5d, 0x08, 0xff, 0x3e, 0xd0, 0xbb, 0xff, 0x16, 0x49, 0x82, 0xff,
+    0x6b, 0x97, 0x4d, 0xff, 0x95, 0x06, 0x3d, 0xff, 0x2d, 0x2f, 0x7d, 0xff,
+    0xcb, 0x50, 0xbd, 0xff, 0x55, 0x5e, 0x8a, 0xff, 0x82, 0x0b, 0xa5, 0xff,
+    0x07, 0x7c, 0x28, 0xff, 0x96, 0xa4, 0x4d, 0xff, 0xd7, 0xe8, 0x5a, 0xff,
+    0x29, 0x0e, 0x33, 0xff, 0xf2, 0x6e, 0x65, 0xff, 0xac, 0xfa, 0x87, 0xff,
+    0x6e, 0x24, 0xbc, 0xff, 0xda, 0xd6, 0xce, 0xff, 0x82, 0x86, 0x6f, 0xff,
+    0xbc, 0xe6, 0x48, 0xff, 0xa7, 0xc7, 0x26, 0xff, 0x65, 0x4b, 0x74, 0xff,
+    0x7d, 0xec, 0x38, 0xff, 0xe9, 0xde, 0x8a, 0xff, 0xb0, 0xa7, 0xe3, 0xff,
+    0xfd, 0x0e, 0xc5, 0xff, 0x96, 0x6f, 0xaa, 0xff, 0x10, 0xc3, 0xeb, 0xff,
+    0xa2, 0x25, 0x35, 0xff, 0xf0, 0x79, 0x87, 0xff, 0x8b, 0xf4, 0xa4, 0xff,
+    0x34, 0x31, 0x2c, 0xff, 0xb4, 0x5e, 0x52, 0xff, 0x1d, 0xc0, 0x9e, 0xff,
+    0x77, 0x0a, 0x73, 0xff, 0xaf, 0x88, 0xe9, 0xff, 0xda, 0x5c, 0x5c, 0xff,
+    0x3c, 0xc3, 0x91, 0xff, 0xb8, 0xf8, 0x2f, 0xff, 0xd3, 0x9f, 0x75, 0xff,
+    0xa4, 0x46, 0xab, 0xff, 0x43, 0xca, 0x09, 0xff, 0xe1, 0x2c, 0xfa, 0xff,
+    0xc4, 0xa7, 0x8b, 0xff, 0x6c, 0x12, 0x69, 0xff, 0xe8, 0xd1, 0xb2, 0xff,
+    0x62, 0x60, 0x7f, 0xff, 0xfd, 0x05, 0x29, 0xff, 0x33, 0x78, 0xa4, 0xff,
+    0xd3, 0x42, 0xee, 0xff, 0xf1, 0x15, 0x05, 0xff, 0x5e, 0x81, 0x9a, 0xff,
+    0x00, 0x1e, 0x6c, 0xff, 0x68, 0x46, 0x25, 0xff, 0x44, 0xb0, 0xca, 0xff,
+    0xd1, 0xdb, 0xa0, 0xff, 0xc0, 0x8d, 0x1c, 0xff, 0xe4, 0x4a, 0x55, 0xff,
+    0x2d, 0x9a, 0xa9, 0xff, 0x48, 0x72, 0x7b, 0xff, 0xc2, 0xb8, 0x41, 0xff,
+    0x93, 0xa0, 0x5a, 0xff, 0x0f, 0x50, 0xb7, 0xff, 0x50, 0x69, 0x28, 0xff,
+    0xb1, 0x98, 0x79, 0xff, 0x26, 0xf9, 0x44, 0xff, 0xa1, 0x35, 0xe6, 0xff,
+    0xe5, 0xb2, 0xd1, 0xff, 0xd4, 0xc8, 0x29, 0xff, 0x4d, 0x80, 0x68, 0xff,
+    0x0a, 0xd7, 0xaa, 0xff, 0xf0, 0xb7, 0x02, 0xff, 0x1d, 0x88, 0x61, 0xff,
+    0xb5, 0xaf, 0x41, 0xff, 0xc3, 0xd1, 0xcc, 0xff, 0x3d, 0x69, 0x7e, 0xff,
+    0xa7, 0x1c, 0x10, 0xff, 0x57, 0x8f, 0xc3, 0xff, 0xcf, 0xb1, 0x1c, 0xff,
+    0x97, 0x39, 0x75, 0xff, 0x1e, 0x5c, 0x3c, 0xff, 0x41, 0xa5, 0x13, 0xff,
+    0xe9, 0x44, 0x9d, 0xff, 0x05, 0x0d, 0x09, 0xff, 0x38, 0xa1, 0x8f, 0xff,
+    0xcc, 0xb4, 0xeb, 0xff, 0x4b, 0x7c, 0x56, 0xff, 0x2e, 0x1e, 0x0b, 0xff,
+    0x6e, 0x99, 0x7e, 0xff, 0x1b, 0xf7, 0x20, 0xff, 0x5c, 0x83, 0x6a, 0xff,
+    0xd4, 0xe7, 0x0d, 0xff, 0x71, 0xab, 0xde, 0xff, 0x08, 0x41, 0x5a, 0xff,
+    0xc0, 0xd7, 0xd0, 0xff, 0xd2, 0xb7, 0xe7, 0xff, 0x6a, 0x22, 0x0c, 0xff,
+    0xa5, 0x70, 0xca, 0xff, 0x50, 0xd1, 0x38, 0xff, 0x2f, 0xdf, 0x15, 0xff,
+    0x8a, 0x26, 0xa6, 0xff, 0x16, 0x68, 0x07, 0xff, 0x5c, 0x0b, 0xbb, 0xff,
+    0x28, 0x36, 0x50, 0xff, 0xfc, 0xe3, 0xef, 0xff, 0x8e, 0x6d, 0x3b, 0xff,
+    0x59, 0x8e, 0xbe, 0xff, 0x13, 0xdb, 0x20, 0xff, 0xd9, 0x9b, 0x2f, 0xff,
+    0x25, 0x38, 0xe9, 0xff, 0x9a, 0xff, 0xd3, 0xff, 0xc7, 0xad, 0x14, 0xff,
+    0x09, 0xc3, 0x4e, 0xff, 0x7c, 0x98, 0x63, 0xff, 0xb2, 0xe2, 0xb3, 0xff,
+    0x19, 0xb9, 0xd7, 0xff, 0xc8, 0xea, 0xea, 0xff, 0x8e, 0x53, 0x5e, 0xff,
+    0xff, 0xf7, 0x7b, 0xff, 0x83, 0x6f, 0x90, 0xff, 0x39, 0x06, 0xd6, 0xff,
+    0x6f, 0xbf, 0xc0, 0xff, 0x9c, 0x81, 0xe4, 0xff, 0xf9, 0x3c, 0x16, 0xff,
+    0x79, 0x61, 0x9c, 0xff, 0x1a, 0x2e, 0xd1, 0xff, 0xd7, 0xed, 0x03, 0xff,
+    0xe7, 0xd7, 0x94, 0xff, 0xc8, 0x19, 0xdc, 0xff, 0x5f, 0x86, 0x33, 0xff,
+    0xbe, 0x76, 0x9c, 0xff, 0x89, 0xe5, 0x0a, 0xff, 0x34, 0x16, 0x8f, 0xff,
+    0xad, 0x3f, 0xf9, 0xff, 0xdd, 0x9d, 0xc5, 0xff, 0x8e, 0xf3, 0x16, 0xff,
+    0x6d, 0x27, 0xde, 0xff, 0x32, 0x3d, 0xf4, 0xff, 0xdf, 0xff, 0x99, 0xff,
+    0x65, 0x4e, 0xb3, 0xff, 0x0f, 0x2f, 0xe7, 0xff, 0x75, 0xd8, 0xa0, 0xff,
+    0x80, 0x78, 0xd2, 0xff, 0x35, 0x15, 0xef, 0xff, 0x5f, 0xe3, 0xa9, 0xff,
+    0xc8, 0xbc, 0x55, 0xff, 0xa0, 0x68, 0xf5, 0xff, 0x73, 0xfe, 0x80, 0xff,
+    0x22, 0x37, 0xd5, 0xff, 0xe3, 0x5a, 0xb2, 0xff, 0x8b, 0x8c, 0xca, 0xff,
+    0xbf, 0x2c, 0xa1, 0xff, 0xdb, 0x65, 0x42, 0xff, 0x43, 0xb9, 0xf2, 0xff,
+    0x82, 0x51, 0x4d, 0xff, 0xf4, 0x36, 0x9a, 0xff, 0x38, 0x03, 0xba, 0xff,
+    0xab, 0x62, 0x40, 0xff, 0x7d, 0xa0, 0x1e, 0xff, 0x26, 0x81, 0x8f, 0xff,
+    0xdd, 0x49, 0xf6, 0xff, 0x01, 0xf7, 0x60, 0xff, 0xf6, 0x92, 0xb3, 0xff,
+    0xcc, 0x3e, 0x85, 0xff, 0x9b, 0xb4, 0xfc, 0xff, 0xef, 0xee, 0x44, 0xff,
+    0x71, 0x85, 0xe5, 0xff, 0x7f, 0xbb, 0x22, 0xff, 0x1c, 0x15, 0x95, 0xff,
+    0xbf, 0xae, 0x81, 0xff, 0x37, 0x02, 0xdb, 0xff, 0x77, 0x63, 0x52, 0xff,
+    0xaa, 0xe9, 0xc9, 0xff, 0x4f, 0x1f, 0x96, 0xff, 0x86, 0x86, 0x5b, 0xff,
+    0x16, 0x6e, 0xfc, 0xff, 0x48, 0x2d, 0x8f, 0xff, 0xa2, 0x0e, 0xce, 0xff,
+    0x2b, 0x5e, 0x2f, 0xff, 0x54, 0x38, 0x1d, 0xff, 0xe4, 0x74, 0x8a, 0xff,
+    0xa6, 0x93, 0xaa, 0xff, 0x22, 0x13, 0xf7, 0xff, 0x5a, 0x31, 0x3f, 0xff,
+    0xab, 0x5f, 0x0f, 0xff, 0x18, 0xf1, 0x75, 0xff, 0x03, 0x27, 0x48, 0xff,
+    0xcf, 0xcd, 0x2f, 0xff, 0x57, 0xe6, 0xeb, 0xff, 0x9e, 0x0d, 0x69, 0xff,
+    0x6e, 0x7d, 0x83, 0xff, 0x3a, 0x42, 0xfa, 0xff, 0x7d, 0xc5, 0x53, 0xff,
+    0x07, 0xa4, 0xc2, 0xff, 0x47, 0x2a, 0x6f, 0xff, 0x74, 0x66, 0x59, 0xff,
+    0x10, 0xfb, 0xd8, 0xff, 0x5c, 0x59, 0x9e, 0xff, 0x7a, 0x6c, 0x37, 0xff,
+    0x43, 0x1c, 0x52, 0xff, 0xa3, 0x74, 0x76, 0xff, 0xf4, 0x95, 0x2f, 0xff,
+    0x18, 0x02, 0x08, 0xff, 0x4c, 0x9d, 0x68, 0xff, 0xfd, 0xbb, 0x3d, 0xff,
+    0xbb, 0xf0, 0x8c, 0xff, 0xe3, 0x45, 0x4b, 0xff, 0x00, 0xcc, 0x06, 0xff,
+    0xf4, 0x8a, 0xdf, 0xff, 0x8a, 0x00, 0x2e, 0xff, 0x4e, 0x2d, 0xbf, 0xff,
+    0xf9, 0x77, 0x40, 0xff, 0xb5, 0xd2, 0x61, 0xff, 0x59, 0x18, 0x18, 0xff,
+    0x17, 0xf1, 0x2b, 0xff, 0x0b, 0xd9, 0x6d, 0xff, 0xa6, 0x43, 0xd9, 0xff,
+    0x92, 0xcb, 0xb6, 0xff, 0x2b, 0x14, 0x31, 0xff, 0xc3, 0xdc, 0x79, 0xff,
+    0x54, 0x96, 0xff, 0xff, 0xe8, 0xfa, 0x66, 0xff, 0x44, 0x1b, 0xae, 0xff,
+    0x5d, 0xca, 0x7b, 0xff, 0x91, 0x10, 0x46, 0xff, 0x3d, 0xa8, 0x98, 0xff,
+    0x80, 0x55, 0xdd, 0xff, 0x62, 0x00, 0x28, 0xff, 0x0e, 0x79, 0xc4, 0xff,
+    0x4a, 0xa2, 0x69, 0xff, 0xa8, 0x4c, 0xa0, 0xff, 0xc9, 0xd7, 0xd0, 0xff,
+    0x52, 0x58, 0x60, 0xff, 0xe9, 0xf5, 0x11, 0xff, 0x9d, 0x81, 0x6e, 0xff,
+    0x0b, 0x41, 0xaf, 0xff, 0xf6, 0xbc, 0x08, 0xff, 0x2e, 0x56, 0x77, 0xff,
+    0xb6, 0xca, 0x43, 0xff, 0xee, 0x48, 0xab, 0xff, 0x6f, 0xdb, 0x0d, 0xff,
+    0xe0, 0x8b, 0x7c, 0xff, 0xbf, 0xf9, 0xe6, 0xff, 0x83, 0xa5, 0x56, 0xff,
+    0x3b, 0x28, 0x47, 0xff, 0x75, 0xd6, 0x0b, 0xff, 0x0b, 0xc8, 0x2d, 0xff,
+    0xd6, 0xab, 0xb4, 0xff, 0xf2, 0x9d, 0x67, 0xff, 0x90, 0xd9, 0xee, 0xff,
+    0xbc, 0x54, 0x8a, 0xff, 0x3c, 0x18, 0xbb, 0xff, 0xec, 0xa7, 0x0d, 0xff,
+    0x2c, 0x91, 0xa8, 0xff, 0xad, 0xbe, 0x3a, 0xff, 0xfe, 0x5a, 0x1e, 0xff,
+    0x1e, 0xe2, 0xad, 0xff, 0x9a, 0x08, 0x12, 0xff, 0xf0, 0x4f, 0xf2, 0xff,
+    0x28, 0x92, 0xb5, 0xff, 0xcf, 0x10, 0x46, 0xff, 0xfc, 0xaa, 0x19, 0xff,
+    0xba, 0xde, 0x85, 0xff, 0x22, 0xbd, 0xe9, 0xff, 0xc7, 0x4b, 0xb6, 0xff,
+    0x58, 0xe7, 0x8f, 0xff, 0x98, 0xc6, 0xd5, 0xff, 0xaf, 0x58, 0x1e, 0xff,
+    0x8b, 0x82, 0xfd, 0xff, 0x24, 0x25, 0x27, 0xff, 0x44, 0x63, 0x60, 0xff,
+    0x9b, 0x9b, 0x7d, 0xff, 0xb2, 0x52, 0x92, 0xff, 0x18, 0xed, 0x6c, 0xff,
+    0x2e, 0xaf, 0x21, 0xff, 0x68, 0x94, 0xe5, 0xff, 0xd6, 0x4f, 0xa8, 0xff,
+    0x97, 0xc1, 0x4f, 0xff, 0x79, 0x6e, 0xf8, 0xff, 0xf8, 0x09, 0x94, 0xff,
+    0x62, 0xa9, 0x04, 0xff, 0xce, 0x79, 0x5d, 0xff, 0x06, 0x23, 0xcb, 0xff,
+    0xb2, 0x88, 0x8d, 0xff, 0x1f, 0xbe, 0x09, 0xff, 0x99, 0x56, 0x29, 0xff,
+    0x14, 0x73, 0xc6, 0xff, 0xfb, 0x39, 0x14, 0xff, 0xb9, 0xdb, 0x32, 0xff,
+    0xa1, 0x6a, 0x6e, 0xff, 0xea, 0x2f, 0x00, 0xff, 0x21, 0xea, 0x51, 0xff,
+    0xb6, 0xce, 0x78, 0xff, 0xe1, 0x1b, 0x18, 0xff, 0x31, 0x2b, 0x89, 0xff,
+    0xd8, 0x73, 0x32, 0xff, 0x04, 0x95, 0xb4, 0xff, 0x86, 0x21, 0x46, 0xff,
+    0x65, 0xd0, 0xe8, 0xff, 0xba, 0x2e, 0x9c, 0xff, 0xd3, 0x77, 0x38, 0xff,
+    0x5d, 0x96, 0xdf, 0xff, 0x3f, 0x07, 0x1c, 0xff, 0xcc, 0xf2, 0xbf, 0xff,
+    0x90, 0xb1, 0x6d, 0xff, 0x60, 0x20, 0x3a, 0xff, 0x05, 0x51, 0x9e, 0xff,
+    0x9b, 0xc0, 0xba, 0xff, 0xec, 0x00, 0x71, 0xff, 0x4c, 0x64, 0xcc, 0xff,
+    0xc3, 0x84, 0xe0, 0xff, 0x31, 0x3d, 0x51, 0xff, 0x7a, 0x20, 0x9a, 0xff,
+    0x4f, 0x73, 0x21, 0xff, 0x66, 0xb4, 0xce, 0xff, 0x85, 0x89, 0x57, 0xff,
+    0xb4, 0x6b, 0x72, 0xff, 0x09, 0xfc, 0xdd, 0xff, 0x62, 0x36, 0x4a, 0xff,
+    0x8a, 0x23, 0xca, 0xff, 0xd0, 0x70, 0x62, 0xff, 0x55, 0xb5, 0x8a, 0xff,
+    0xa9, 0xcf, 0x26, 0xff, 0xb7, 0x7d, 0x7b, 0xff, 0x3e, 0xc1, 0xe2, 0xff,
+    0x98, 0x2e, 0x64, 0xff, 0x14, 0x8b, 0xcb, 0xff, 0xea, 0x08, 0x24, 0xff,
+    0x86, 0xd3, 0xa5, 0xff, 0x03, 0x34, 0x5b, 0xff, 0x78, 0x65, 0x47, 0xff,
+    0xd6, 0x12, 0x70, 0xff, 0x2f, 0xde, 0xa7, 0xff, 0x6c, 0xab, 0xbc, 0xff,
+    0xca, 0x0c, 0xda, 0xff, 0x55, 0xb7, 0x37, 0xff, 0xdb, 0x33, 0xb6, 0xff,
+    0x7a, 0x7f, 0xcb, 0xff, 0xc3, 0x1f, 0x9a, 0xff, 0x0a, 0xdd, 0x02, 0xff,
+    0x42, 0x0f, 0x77, 0xff, 0xad, 0x9c, 0x8a, 0xff, 0x28, 0xb1, 0x3a, 0xff,
+    0x3a, 0x32, 0xe0, 0xff, 0xeb, 0x58, 0x80, 0xff, 0x4e, 0xfc, 0xac, 0xff,
+    0x77, 0x9f, 0x19, 0xff, 0xe3, 0x67, 0xd6, 0xff, 0x68, 0xeb, 0x54, 0xff,
+    0x88, 0x2a, 0xe6, 0xff, 0xc9, 0xb1, 0x9b, 0xff, 0x71, 0x8e, 0xe0, 0xff,
+    0x0c, 0xf2, 0xb9, 0xff, 0x32, 0xbc, 0xd4, 0xff, 0x57, 0x83, 0xf3, 0xff,
+    0xc5, 0x97, 0xaa, 0xff, 0x76, 0x44, 0x39, 0xff, 0x90, 0x62, 0xed, 0xff,
+    0x3f, 0xfe, 0xd9, 0xff, 0x69, 0xa9, 0x04, 0xff, 0xb0, 0x3a, 0xc2, 0xff,
+    0x27, 0xc4, 0xff, 0xff, 0x47, 0x4e, 0x27, 0xff, 0x91, 0xb2, 0x8a, 0xff,
+    0x1b, 0xef, 0x63, 0xff, 0x7e, 0x17, 0xf5, 0xff, 0xa3, 0xa6, 0x83, 0xff,
+    0x0f, 0x37, 0x29, 0xff, 0x22, 0x67, 0xf1, 0xff, 0xfb, 0x7e, 0xc7, 0xff,
+    0x34, 0xd0, 0x03, 0xff, 0xd2, 0x41, 0x91, 0xff, 0x1d, 0x79, 0xff, 0xff,
+    0x6b, 0xe1, 0x15, 0xff, 0xb5, 0x4c, 0x7d, 0xff, 0x98, 0xfe, 0xc1, 0xff,
+    0xe7, 0x90, 0x01, 0xff, 0x13, 0xe3, 0xad, 0xff, 0xd9, 0x44, 0x39, 0xff,
+    0x24, 0x0f, 0xfc, 0xff, 0x4b, 0x4d, 0x8f, 0xff, 0xe1, 0xd4, 0x2a, 0xff,
+    0xc2, 0x04, 0xb8, 0xff, 0x44, 0x9f, 0x78, 0xff, 0x30, 0x8d, 0xe7, 0xff,
+    0xdc, 0xf4, 0x3f, 0xff, 0x66, 0x3a, 0xa3, 0xff, 0x02, 0xd9, 0x31, 0xff,
+    0x8b, 0x46, 0x04, 0xff, 0x6e, 0xef, 0x72, 0xff, 0x50, 0x55, 0xfb, 0xff,
+    0x37, 0xa3, 0x3f, 0xff, 0x67, 0x7b, 0x0c, 0xff, 0xcf, 0xb1, 0xc1, 0xff,
+    0x3f, 0x8d, 0xe3, 0xff, 0xe6, 0xf8, 0x83, 0xff, 0x0a, 0x74, 0xca, 0xff,
+    0xa2, 0x3b, 0x53, 0xff, 0xed, 0xd2, 0x10, 0xff, 0x10, 0xfc, 0xf4, 0xff,
+    0x64, 0x6f, 0x18, 0xff, 0x3c, 0xc6, 0x58, 0xff, 0xa7, 0x47, 0x48, 0xff,
+    0x8d, 0x63, 0xfd, 0xff, 0xf0, 0xf6, 0xd0, 0xff, 0x53, 0x3f, 0xb5, 0xff,
+    0xc9, 0x83, 0x10, 0xff, 0x85, 0xe9, 0xc1, 0xff, 0xb9, 0x91, 0x49, 0xff,
+    0x19, 0xcf, 0x26, 0xff, 0xa2, 0x49, 0xf5, 0xff, 0x40, 0x3c, 0x3e, 0xff,
+    0xd7, 0x0d, 0xa6, 0xff, 0x2d, 0xd4, 0x6d, 0xff, 0xa7, 0x4b, 0x4a, 0xff,
+    0x4c, 0x05, 0x81, 0xff, 0xe1, 0x5d, 0x5a, 0xff, 0xd0, 0x25, 0x23, 0xff,
+    0x8d, 0x14, 0x8c, 0xff, 0x45, 0xe1, 0xcb, 0xff, 0x06, 0xc4, 0x5f, 0xff,
+    0xfd, 0xb2, 0x96, 0xff, 0xa1, 0x8a, 0x4a, 0xff, 0x14, 0x06, 0x80, 0xff,
+    0xed, 0xe6, 0x59, 0xff, 0xc1, 0x69, 0x75, 0xff, 0xf8, 0x9d, 0xa7, 0xff,
+    0x39, 0x0a, 0x16, 0xff, 0xdf, 0xde, 0xca, 0xff, 0x6e, 0x6c, 0xb2, 0xff,
+    0xe9, 0xd6, 0x54, 0xff, 0x51, 0x59, 0xa2, 0xff, 0xb3, 0x93, 0x49, 0xff,
+    0x7a, 0xe6, 0x5f, 0xff, 0x46, 0x0c, 0xda, 0xff, 0xab, 0x9b, 0x25, 0xff,
+    0x89, 0xed, 0x3d, 0xff, 0xf6, 0xb0, 0xa0, 0xff, 0x5e, 0x16, 0x5c, 0xff,
+    0x27, 0xbb, 0x31, 0xff, 0x42, 0x07, 0xf2, 0xff, 0xc7, 0xc6, 0x83, 0xff,
+    0xa3, 0x31, 0x63, 0xff, 0xf8, 0xf4, 0x1b, 0xff, 0x98, 0xbb, 0xa1, 0xff,
+    0x72, 0xac, 0x05, 0xff, 0x15, 0x7a, 0xf4, 0xff, 0xa4, 0xe6, 0x96, 0xff,
+    0x0d, 0x4b, 0x0b, 0xff, 0x7c, 0x62, 0xd6, 0xff, 0xe8, 0x1d, 0xbf, 0xff,
+    0x1f, 0x00, 0xf3, 0xff, 0xf5, 0x98, 0x92, 0xff, 0xa2, 0x6b, 0xab, 0xff,
+    0xc1, 0x21, 0x56, 0xff, 0xdf, 0x3e, 0x9b, 0xff, 0xaa, 0xf3, 0x79, 0xff,
+    0x27, 0x19, 0xf1, 0xff, 0xb6, 0x2b, 0x19, 0xff, 0x5f, 0x48, 0x34, 0xff,
+    0x50, 0xa2, 0x00, 0xff, 0xbe, 0x1e, 0x9b, 0xff, 0x84, 0x92, 0x74, 0xff,
+    0x21, 0x5c, 0x89, 0xff, 0x93, 0x08, 0xac, 0xff, 0xfe, 0xe5, 0xe1, 0xff,
+    0xcd, 0xa4, 0x82, 0xff, 0x1b, 0x8b, 0x30, 0xff, 0x6d, 0xcd, 0x69, 0xff,
+    0xde, 0x24, 0x1e, 0xff, 0x02, 0x5f, 0x5b, 0xff, 0x9d, 0xc3, 0xf0, 0xff,
+    0x6f, 0x1d, 0x67, 0xff, 0x30, 0x01, 0xa0, 0xff, 0x8f, 0xb7, 0x74, 0xff,
+    0xf9, 0x76, 0x88, 0xff, 0x58, 0xa4, 0xbd, 0xff, 0x03, 0xc4, 0x03, 0xff,
+    0xef, 0x7e, 0x38, 0xff, 0x63, 0xe6, 0xef, 0xff, 0x7b, 0x9d, 0x11, 0xff,
+    0x1b, 0xae, 0xa2, 0xff, 0xaf, 0x4f, 0x42, 0xff, 0x68, 0x6d, 0x0b, 0xff,
+    0x2a, 0x34, 0xbd, 0xff, 0xd2, 0x0f, 0x29, 0xff, 0x5a, 0x5a, 0xb0, 0xff,
+    0x7d, 0xda, 0xe1, 0xff, 0x96, 0x7d, 0x1d, 0xff, 0x50, 0x18, 0x3d, 0xff,
+    0x75, 0xf9, 0xd6, 0xff, 0xa7, 0x5c, 0x4e, 0xff, 0x01, 0x83, 0x02, 0xff,
+    0xc4, 0x43, 0x32, 0xff, 0x2a, 0x29, 0xd2, 0xff, 0x99, 0xc7, 0x8e, 0xff,
+    0xd9, 0x1a, 0x17, 0xff, 0x6a, 0xb7, 0xe8, 0xff, 0xc6, 0x32, 0x84, 0xff,
+    0x57, 0x61, 0x69, 0xff, 0x10, 0x23, 0xb0, 0xff, 0xdc, 0x8b, 0xea, 0xff,
+    0x02, 0x35, 0x8b, 0xff, 0x84, 0x6c, 0xd6, 0xff, 0xb0, 0x5b, 0x6e, 0xff,
+    0x6d, 0x7c, 0x43, 0xff, 0x07, 0x9e, 0xe2, 0xff, 0x36, 0x65, 0xc5, 0xff,
+    0x5b, 0x26, 0x4e, 0xff, 0x7f, 0x5e, 0xd2, 0xff, 0xcc, 0x3d, 0x36, 0xff,
+    0xf2, 0x15, 0x5b, 0xff, 0x94, 0xc6, 0x1c, 0xff, 0xbe, 0x2d, 0x6a, 0xff,
+    0x4c, 0xa7, 0x4e, 0xff, 0x5f, 0x76, 0xd0, 0xff, 0xcb, 0xb5, 0x21, 0xff,
+    0x2e, 0xce, 0xb8, 0xff, 0x7c, 0xe1, 0x15, 0xff, 0x0c, 0x87, 0x2e, 0xff,
+    0x8a, 0x5e, 0xd3, 0xff, 0xfb, 0xc4, 0x65, 0xff, 0x1c, 0xda, 0x91, 0xff,
+    0x94, 0xba, 0xaf, 0xff, 0xf3, 0x55, 0xf7, 0xff, 0x35, 0xea, 0x44, 0xff,
+    0x72, 0x86, 0xe7, 0xff, 0xe1, 0x42, 0x2a, 0xff, 0xb9, 0x28, 0x66, 0xff,
+    0x2b, 0xbd, 0x3e, 0xff, 0x59, 0x15, 0x0f, 0xff, 0x7f, 0x36, 0xbe, 0xff,
+    0x34, 0x75, 0xa4, 0xff, 0xbc, 0x07, 0xe7, 0xff, 0x20, 0xda, 0x98, 0xff,
+    0x5e, 0x4d, 0x2e, 0xff, 0xe5, 0x6c, 0xd3, 0xff, 0xd4, 0x30, 0x0d, 0xff,
+    0x0f, 0xd8, 0xe8, 0xff, 0xbf, 0xf4, 0x59, 0xff, 0x7e, 0x20, 0x21, 0xff,
+    0xb4, 0x93, 0xfb, 0xff, 0x3a, 0x32, 0x92, 0xff, 0xc1, 0x68, 0xc8, 0xff,
+    0x27, 0x3f, 0xb2, 0xff, 0x98, 0xc9, 0x66, 0xff, 0xf6, 0xf8, 0x7d, 0xff,
+    0xe7, 0x7a, 0xfb, 0xff, 0x84, 0xa5, 0x71, 0xff, 0xb8, 0xed, 0x13, 0xff,
+    0x1d, 0x3f, 0xf5, 0xff, 0xe4, 0xbd, 0x66, 0xff, 0x2f, 0x29, 0xa1, 0xff,
+    0x0d, 0x49, 0x92, 0xff, 0xce, 0x8f, 0xea, 0xff, 0x22, 0x34, 0xb7, 0xff,
+    0x59, 0xac, 0x7c, 0xff, 0xf2, 0xbf, 0x6a, 0xff, 0x89, 0x8c, 0xe1, 0xff,
+    0x3d, 0xfc, 0x0b, 0xff, 0x08, 0x4b, 0x76, 0xff, 0xf4, 0x71, 0xb6, 0xff,
+    0x2d, 0xf4, 0x33, 0xff, 0x94, 0xa4, 0x51, 0xff, 0xba, 0xc5, 0xd0, 0xff,
+    0x3d, 0x54, 0x19, 0xff, 0xa1, 0xd7, 0x4a, 0xff, 0xd1, 0xf1, 0x23, 0xff,
+    0x54, 0xa8, 0xb9, 0xff, 0xef, 0x1c, 0x95, 0xff, 0x8e, 0xeb, 0x12, 0xff,
+    0xbc, 0xd2, 0xab, 0xff, 0x1d, 0x86, 0x7c, 0xff, 0xe6, 0x97, 0x6b, 0xff,
+    0x2a, 0xf0, 0x87, 0xff, 0x53, 0xda, 0xb1, 0xff, 0x69, 0xb3, 0xeb, 0xff,
+    0x35, 0x84, 0x9b, 0xff, 0xaa, 0xfd, 0x83, 0xff, 0x83, 0xe5, 0x60, 0xff,
+    0x42, 0x5b, 0x47, 0xff, 0x12, 0x35, 0xc8, 0xff, 0xee, 0x09, 0xec, 0xff,
+    0x56, 0xae, 0x89, 0xff, 0x46, 0x71, 0x4b, 0xff, 0x9e, 0x0e, 0xba, 0xff,
+    0x6e, 0x97, 0x26, 0xff, 0x7e, 0x69, 0x57, 0xff, 0xc8, 0x02, 0x6b, 0xff,
+    0x15, 0xc8, 0xd2, 0xff, 0xab, 0xb2, 0x1d, 0xff, 0x40, 0xdc, 0xc3, 0xff,
+    0x4e, 0x7a, 0x9e, 0xff, 0x04, 0x96, 0xd4, 0xff, 0xd5, 0x54, 0xf1, 0xff,
+    0xa1, 0xee, 0x90, 0xff, 0xe9, 0xb9, 0x50, 0xff, 0x90, 0x9f, 0x3c, 0xff,
+    0x4b, 0xf9, 0x7a, 0xff, 0xf6, 0xaa, 0xb1, 0xff, 0x3e, 0x7c, 0x8d, 0xff,
+    0xac, 0xe6, 0x42, 0xff, 0x52, 0x8a, 0xc7, 0xff, 0x23, 0x53, 0x32, 0xff,
+    0x6b, 0x60, 0xd8, 0xff, 0x9a, 0x11, 0xac, 0xff, 0x17, 0xff, 0x76, 0xff,
+    0x89, 0xd9, 0x2a, 0xff, 0xd9, 0x1a, 0x52, 0xff, 0x40, 0x8b, 0xe5, 0xff,
+    0x53, 0x0a, 0x35, 0xff, 0x0f, 0xd4, 0xd4, 0xff, 0xa5, 0x22, 0x9e, 0xff,
+    0x39, 0x94, 0x55, 0xff, 0x4a, 0xcb, 0xcd, 0xff, 0xc4, 0x6f, 0x34, 0xff,
+    0x6c, 0xa0, 0x08, 0xff, 0xdb, 0xb6, 0xc5, 0xff, 0x87, 0xd4, 0x2b, 0xff,
+    0xb6, 0xea, 0x5d, 0xff, 0x97, 0x20, 0xf8, 0xff, 0x49, 0x0c, 0x98, 0xff,
+    0x67, 0x78, 0x3e, 0xff, 0xbf, 0x9f, 0xa9, 0xff, 0xa9, 0x02, 0xfb, 0xff,
+    0x15, 0xdc, 0x20, 0xff, 0x7f, 0x83, 0x9c, 0xff, 0xea, 0x43, 0xc1, 0xff,
+    0x20, 0x11, 0x0c, 0xff, 0x76, 0x76, 0x79, 0xff, 0xfc, 0x98, 0xa9, 0xff,
+    0x30, 0x28, 0xf9, 0xff, 0x1a, 0xcd, 0x0d, 0xff, 0x7a, 0x4f, 0xce, 0xff,
+    0x47, 0x3b, 0x5d, 0xff, 0xd4, 0x09, 0x2d, 0xff, 0xa8, 0xc1, 0xf7, 0xff,
+    0x40, 0x1a, 0x20, 0xff, 0xb6, 0x55, 0xdf, 0xff, 0x8a, 0x71, 0x44, 0xff,
+    0x1a, 0x0c, 0xc6, 0xff, 0xfb, 0x94, 0x2b, 0xff, 0xd6, 0x4f, 0x0f, 0xff,
+    0x96, 0x25, 0xdc, 0xff, 0xe4, 0x15, 0x35, 0xff, 0xae, 0xc3, 0x7c, 0xff,
+    0x64, 0x91, 0x6a, 0xff, 0xd1, 0xfa, 0xe1, 0xff, 0xbc, 0x4e, 0x09, 0xff,
+    0x31, 0xe7, 0x9f, 0xff, 0xdc, 0x39, 0xdb, 0xff, 0x09, 0x80, 0x3b, 0xff,
+    0x48, 0xf4, 0x7c, 0xff, 0xd7, 0x30, 0x94, 0xff, 0x65, 0x17, 0xb5, 0xff,
+    0x9b, 0x65, 0x5d, 0xff, 0xf2, 0xf7, 0x4b, 0xff, 0x77, 0xd4, 0x05, 0xff,
+    0xb1, 0xad, 0x6f, 0xff, 0x45, 0x6a, 0x26, 0xff, 0x0d, 0x49, 0xc9, 0xff,
+    0x66, 0x2a, 0x14, 0xff, 0xa9, 0x88, 0xde, 0xff, 0x7d, 0x3c, 0x03, 0xff,
+    0x08, 0x11, 0x4f, 0xff, 0xc6, 0x99, 0xb8, 0xff, 0x87, 0xae, 0x7f, 0xff,
+    0xec, 0x40, 0x17, 0xff, 0x46, 0xcc, 0x98, 0xff, 0xcd, 0xb5, 0x60, 0xff,
+    0xfc, 0x70, 0x0f, 0xff, 0x5c, 0xa9, 0xd1, 0xff, 0xad, 0x57, 0x8d, 0xff,
+    0x07, 0xbe, 0x1a, 0xff, 0xc8, 0x2f, 0xb9, 0xff, 0x72, 0x60, 0x24, 0xff,
+    0xdd, 0x4a, 0x86, 0xff, 0x63, 0x82, 0x43, 0xff, 0x8b, 0x19, 0xac, 0xff,
+    0xf5, 0x54, 0x8c, 0xff, 0xad, 0xf3, 0xf0, 0xff, 0x41, 0x01, 0x6d, 0xff,
+    0x60, 0x63, 0x83, 0xff, 0xff, 0x72, 0x44, 0xff, 0x34, 0xcb, 0x1b, 0xff,
+    0xd4, 0x55, 0xbf, 0xff, 0x19, 0xe1, 0x26, 0xff, 0xe5, 0x3a, 0x56, 0xff,
+    0x5b, 0xb0, 0xc8, 0xff, 0xd0, 0x58, 0x45, 0xff, 0x44, 0x1f, 0x6c, 0xff,
+    0xa5, 0xcd, 0xf5, 0xff, 0x61, 0xac, 0xe4, 0xff, 0x4e, 0xfb, 0x62, 0xff,
+    0xc1, 0x03, 0x8f, 0xff, 0x67, 0x45, 0x36, 0xff, 0x9c, 0x82, 0x52, 0xff,
+    0xde, 0xb3, 0x76, 0xff, 0x0d, 0x92, 0xe7, 0xff, 0x61, 0x74, 0x3d, 0xff,
+    0xfe, 0xe0, 0x9a, 0xff, 0x70, 0x48, 0xb9, 0xff, 0x00, 0xa3, 0x11, 0xff,
+    0xdd, 0x33, 0x54, 0xff, 0xc4, 0xd0, 0xa6, 0xff, 0x77, 0x66, 0x75, 0xff,
+    0x09, 0x3e, 0xfd, 0xff, 0x52, 0xf2, 0x8d, 0xff, 0xba, 0x9e, 0x9e, 0xff,
+    0x70, 0x7e, 0x01, 0xff, 0x24, 0x43, 0xa8, 0xff, 0x91, 0x2a, 0x3e, 0xff,
+    0x04, 0xa1, 0x5c, 0xff, 0xeb, 0x1d, 0xff, 0xff, 0x5c, 0xcb, 0x11, 0xff,
+    0xb1, 0xac, 0xc8, 0xff, 0x2a, 0x46, 0xec, 0xff, 0xfa, 0x76, 0x08, 0xff,
+    0x8d, 0x9e, 0x32, 0xff, 0x0e, 0x4f, 0x85, 0xff, 0xc9, 0x3a, 0xfb, 0xff,
+    0x5f, 0x1f, 0xaa, 0xff, 0x89, 0x03, 0x7c, 0xff, 0x26, 0x80, 0xb6, 0xff,
+    0xf9, 0xdf, 0x5f, 0xff, 0xc1, 0x0d, 0x88, 0xff, 0xd2, 0xd2, 0xfa, 0xff,
+    0x2a, 0x57, 0x71, 0xff, 0x99, 0xbc, 0x24, 0xff, 0x72, 0x64, 0xf5, 0xff,
+    0x34, 0x24, 0xa3, 0xff, 0xdb, 0x0a, 0x6a, 0xff, 0xa5, 0xee, 0xe1, 0xff,
+    0x0a, 0x86, 0x48, 0xff, 0x32, 0x47, 0x3b, 0xff, 0xe2, 0x26, 0xf4, 0xff,
+    0x6c, 0x80, 0x6e, 0xff, 0x82, 0xf0, 0xa6, 0xff, 0x9f, 0x97, 0x4b, 0xff,
+    0x30, 0xe5, 0xdb, 0xff, 0xbd, 0xb7, 0x03, 0xff, 0x15, 0xfc, 0xe7, 0xff,
+    0x9a, 0x32, 0x77, 0xff, 0x04, 0xe0, 0x1a, 0xff, 0x27, 0x87, 0x4f, 0xff,
+    0xa0, 0x3c, 0xda, 0xff, 0x14, 0x17, 0x0f, 0xff, 0x7a, 0xa3, 0xa4, 0xff,
+    0x08, 0x45, 0xd0, 0xff, 0xa2, 0x93, 0x8a, 0xff, 0x83, 0xf0, 0xec, 0xff,
+    0x25, 0x66, 0x65, 0xff, 0x73, 0x2b, 0xd9, 0xff, 0x8f, 0xd3, 0x87, 0xff,
+    0x33, 0x95, 0x01, 0xff, 0xe0, 0x6a, 0x94, 0xff, 0xcb, 0x36, 0x3e, 0xff,
+    0x11, 0xdd, 0x27, 0xff, 0x8a, 0x61, 0xc8, 0xff, 0xb3, 0xbd, 0xdf, 0xff,
+    0xe8, 0xe8, 0xa0, 0xff, 0x26, 0x10, 0xb4, 0xff, 0xc6, 0x5a, 0x86, 0xff,
+    0x84, 0xfd, 0x0a, 0xff, 0x2f, 0x2a, 0xd6, 0xff, 0x99, 0xaf, 0x61, 0xff,
+    0x4a, 0x80, 0x90, 0xff, 0xa1, 0xf6, 0xee, 0xff, 0x5c, 0x1f, 0x05, 0xff,
+    0x3d, 0xbe, 0x3b, 0xff, 0x29, 0xaa, 0xb0, 0xff, 0x9f, 0xd9, 0x17, 0xff,
+    0x19, 0x6f, 0x56, 0xff, 0xf3, 0xcc, 0xf7, 0xff, 0x38, 0x64, 0x28, 0xff,
+    0xa5, 0xb9, 0xc4, 0xff, 0x77, 0xd5, 0xb2, 0xff, 0x40, 0x5a, 0x75, 0xff,
+    0xc6, 0x8a, 0x86, 0xff, 0x87, 0x25, 0x22, 0xff, 0xa2, 0xe0, 0xa9, 0xff,
+    0x54, 0xc1, 0x50, 0xff, 0xbb, 0x0a, 0xe3, 0xff, 0x1f, 0xaa, 0x17, 0xff,
+    0x32, 0xcb, 0xdc, 0xff, 0xe8, 0x8e, 0x39, 0xff, 0xdc, 0x31, 0x1a, 0xff,
+    0x16, 0xc5, 0xeb, 0xff, 0x74, 0x9a, 0xda, 0xff, 0x38, 0x61, 0x46, 0xff,
+    0x58, 0xf0, 0xa6, 0xff, 0x19, 0x1a, 0xc0, 0xff, 0xe1, 0xca, 0x62, 0xff,
+    0xb8, 0xfb, 0xd5, 0xff, 0x62, 0xdd, 0x3a, 0xff, 0x13, 0x78, 0x07, 0xff,
+    0x93, 0x36, 0xed, 0xff, 0x79, 0x9a, 0xb4, 0xff, 0x50, 0xe2, 0x86, 0xff,
+    0xb7, 0x02, 0xc1, 0xff, 0x1c, 0xcf, 0x06, 0xff, 0x48, 0x3c, 0xe9, 0xff,
+    0xea, 0x73, 0x5e, 0xff, 0x23, 0x06, 0x92, 0xff, 0xf9, 0xa8, 0x6a, 0xff,
+    0x56, 0x6a, 0xc2, 0xff, 0xcf, 0x0e, 0x2a, 0xff, 0x7f, 0x98, 0xb8, 0xff,
+    0xec, 0xaf, 0x98, 0xff, 0x51, 0xc7, 0x39, 0xff, 0xca, 0x7b, 0xaf, 0xff,
+    0xe2, 0xfa, 0xe8, 0xff, 0x6b, 0xb9, 0x70, 0xff, 0xbc, 0x25, 0x06, 0xff,
+    0xed, 0x12, 0x35, 0xff, 0xb0, 0xc2, 0x7c, 0xff, 0x4d, 0x88, 0x12, 0xff,
+    0xfc, 0xea, 0xa6, 0xff, 0x00, 0x0e, 0x30, 0xff, 0x6c, 0xba, 0xbc, 0xff,
+    0x98, 0x4e, 0x58, 0xff, 0xf1, 0x8e, 0xb1, 0xff, 0x39, 0x1c, 0x80, 0xff,
+    0x08, 0xa2, 0x06, 0xff, 0x44, 0x6d, 0x68, 0xff, 0x58, 0x31, 0x1c, 0xff,
+    0x95, 0xd7, 0xf2, 0xff, 0xb7, 0x9c, 0x4b, 0xff, 0x14, 0x66, 0xc3, 0xff,
+    0xd0, 0x02, 0x73, 0xff, 0xef, 0xc8, 0x2f, 0xff, 0x22, 0x58, 0x81, 0xff,
+    0xb1, 0xe2, 0xd8, 0xff, 0xeb, 0x08, 0x67, 0xff, 0xce, 0x89, 0xc0, 0xff,
+    0x7c, 0x30, 0xe0, 0xff, 0xdd, 0x53, 0x71, 0xff, 0x4a, 0x03, 0xd0, 0xff,
+    0x88, 0xe4, 0x82, 0xff, 0xd6, 0x13, 0x1b, 0xff, 0xf9, 0x75, 0x95, 0xff,
+    0x1f, 0xf6, 0x30, 0xff, 0x68, 0x07, 0x49, 0xff, 0x16, 0x66, 0xbd, 0xff,
+    0xe9, 0x92, 0x63, 0xff, 0x3b, 0x57, 0x9a, 0xff, 0x6d, 0xfd, 0x75, 0xff,
+    0x80, 0x85, 0xc7, 0xff, 0xa9, 0x6e, 0x67, 0xff, 0x3e, 0xf0, 0x93, 0xff,
+    0x95, 0x5b, 0x55, 0xff, 0x51, 0xe7, 0x9d, 0xff, 0xb4, 0x40, 0x2c, 0xff,
+    0x9e, 0xb2, 0x0d, 0xff, 0xef, 0x8f, 0x34, 0xff, 0x8c, 0x71, 0x97, 0xff,
+    0x4c, 0x2d, 0x1b, 0xff, 0xff, 0x84, 0x57, 0xff, 0x21, 0x45, 0x91, 0xff,
+    0x56, 0xa3, 0xca, 0xff, 0xf2, 0xc3, 0x7a, 0xff, 0xc2, 0x15, 0x23, 0xff,
+    0x28, 0x54, 0x58, 0xff, 0x8e, 0xbb, 0x9f, 0xff, 0xf5, 0x65, 0x2f, 0xff,
+    0xce, 0xa0, 0x7f, 0xff, 0x61, 0x18, 0xca, 0xff, 0x92, 0x52, 0x3b, 0xff,
+    0x79, 0xd1, 0x12, 0xff, 0x43, 0x42, 0xfc, 0xff, 0xb5, 0xc1, 0x58, 0xff,
+    0x70, 0x5c, 0xd4, 0xff, 0x37, 0x24, 0x64, 0xff, 0xba, 0x4d, 0xf4, 0xff,
+    0x8f, 0xe4, 0x24, 0xff, 0x46, 0x2f, 0x59, 0xff, 0x2b, 0x5e, 0x4b, 0xff,
+    0x57, 0xd5, 0xbb, 0xff, 0x39, 0x7e, 0x9b, 0xff, 0x0b, 0x4c, 0xb1, 0xff,
+    0x9b, 0xa6, 0x4d, 0xff, 0xc6, 0x3f, 0xf1, 0xff, 0xba, 0x74, 0xe1, 0xff,
+    0x1e, 0xf7, 0x72, 0xff, 0xae, 0x26, 0x16, 0xff, 0x29, 0x7e, 0xd5, 0xff,
+    0xd9, 0xee, 0xfd, 0xff, 0x81, 0x3e, 0x44, 0xff, 0xa6, 0xc7, 0xc1, 0xff,
+    0x72, 0x8a, 0x30, 0xff, 0xf4, 0x1f, 0x5b, 0xff, 0x3c, 0xba, 0xa8, 0xff,
+    0x52, 0x41, 0x24, 0xff, 0x7b, 0xeb, 0xfc, 0xff, 0x64, 0x8e, 0x40, 0xff,
+    0x84, 0x3c, 0xcd, 0xff, 0x0c, 0x9b, 0x99, 0xff, 0x8f, 0x79, 0x23, 0xff,
+    0x69, 0x47, 0x4c, 0xff, 0x31, 0x1c, 0x30, 0xff, 0x05, 0xb3, 0xb5, 0xff,
+    0x5f, 0xff, 0x41, 0xff, 0xc7, 0x85, 0xed, 0xff, 0x0f, 0x3b, 0x4f, 0xff,
+    0x53, 0x95, 0xe4, 0xff, 0xac, 0x48, 0x6d, 0xff, 0x94, 0xb5, 0xef, 0xff,
+    0xdf, 0xeb, 0xd7, 0xff, 0x76, 0x37, 0x3f, 0xff, 0x01, 0x12, 0xf9, 0xff,
+    0xd4, 0xd6, 0x0f, 0xff, 0xef, 0x28, 0xb9, 0xff, 0xc1, 0x45, 0x45, 0xff,
+    0x07, 0xb9, 0x24, 0xff, 0x6b, 0xa2, 0xd1, 0xff, 0xcc, 0x16, 0xbe, 0xff,
+    0x82, 0x79, 0x82, 0xff, 0xda, 0x22, 0x6c, 0xff, 0x01, 0x37, 0xcd, 0xff,
+    0x69, 0xa7, 0xed, 0xff, 0xb0, 0x4f, 0x85, 0xff, 0x3f, 0xb7, 0xe3, 0xff,
+    0xd0, 0x06, 0x2b, 0xff, 0x84, 0x6b, 0x4d, 0xff, 0xab, 0x5d, 0xa7, 0xff,
+    0x3b, 0xeb, 0x14, 0xff, 0xd7, 0x8f, 0xdc, 0xff, 0x73, 0x32, 0xff, 0xff,
+    0xa2, 0xfa, 0x46, 0xff, 0x02, 0xaf, 0x17, 0xff, 0x37, 0xde, 0xb3, 0xff,
+    0xb0, 0x8d, 0xee, 0xff, 0xd7, 0x2a, 0x9a, 0xff, 0x0c, 0x7f, 0xa7, 0xff,
+    0xe8, 0xee, 0x81, 0xff, 0x1f, 0x74, 0x41, 0xff, 0x63, 0xcf, 0x16, 0xff,
+    0xda, 0x0c, 0xbf, 0xff, 0x18, 0x8b, 0x76, 0xff, 0xa9, 0x9c, 0x92, 0xff,
+    0xf7, 0x06, 0xe2, 0xff, 0xc8, 0x6e, 0x19, 0xff, 0x7c, 0xb1, 0xfe, 0xff,
+    0xd9, 0xff, 0xcd, 0xff, 0x64, 0x1c, 0x29, 0xff, 0x3f, 0x60, 0x5f, 0xff,
+    0x85, 0xc8, 0xc4, 0xff, 0x57, 0x9f, 0x82, 0xff, 0x79, 0x09, 0x9d, 0xff,
+    0x49, 0xb0, 0x4f, 0xff, 0x5f, 0xd1, 0x21, 0xff, 0xfa, 0x58, 0x71, 0xff,
+    0xc2, 0x05, 0x97, 0xff, 0x1e, 0xf6, 0xe1, 0xff, 0xd7, 0x4f, 0xcf, 0xff,
+    0x07, 0x7c, 0x8c, 0xff, 0xab, 0xd0, 0x00, 0xff, 0xe2, 0x17, 0x9f, 0xff,
+    0xc4, 0x70, 0xb7, 0xff, 0x36, 0x28, 0x19, 0xff, 0xf7, 0xb6, 0x5c, 0xff,
+    0x47, 0x61, 0xf6, 0xff, 0xbf, 0xef, 0x86, 0xff, 0xa7, 0xc9, 0xa4, 0xff,
+    0xff, 0x93, 0x0f, 0xff, 0xb6, 0x5f, 0x92, 0xff, 0x9a, 0xa9, 0x65, 0xff,
+    0x2e, 0x21, 0x0b, 0xff, 0x81, 0xc6, 0xcc, 0xff, 0xc0, 0xa2, 0x9e, 0xff,
+    0x48, 0x2c, 0x18, 0xff, 0x32, 0x7d, 0x02, 0xff, 0xcb, 0xcd, 0x8e, 0xff,
+    0x9a, 0x9a, 0x2c, 0xff, 0x28, 0xb3, 0x58, 0xff, 0x5a, 0x62, 0x88, 0xff,
+    0x49, 0x1a, 0xac, 0xff, 0xa0, 0xda, 0xf4, 0xff, 0xfd, 0x08, 0x74, 0xff,
+    0x2c, 0x52, 0x00, 0xff, 0x12, 0xfe, 0xff, 0xff, 0x46, 0xc0, 0x5b, 0xff,
+    0x32, 0xd5, 0xad, 0xff, 0xc9, 0xe5, 0x49, 0xff, 0x7a, 0x14, 0x05, 0xff,
+    0x0d, 0x94, 0xb3, 0xff, 0x9f, 0xf3, 0x74, 0xff, 0x6d, 0xd8, 0xf8, 0xff,
+    0x04, 0x2a, 0xba, 0xff, 0xe5, 0xa9, 0x36, 0xff, 0x64, 0xd3, 0x70, 0xff,
+    0x10, 0x7b, 0x95, 0xff, 0x43, 0x21, 0x65, 0xff, 0xc1, 0x48, 0xd8, 0xff,
+    0x87, 0x5f, 0x26, 0xff, 0x19, 0xf5, 0x72, 0xff, 0x51, 0xbb, 0x4c, 0xff,
+    0xa6, 0x1d, 0x31, 0xff, 0x2e, 0xde, 0x0c, 0xff, 0x9d, 0xa2, 0xe3, 0xff,
+    0xfb, 0x34, 0x89, 0xff, 0x82, 0x67, 0xa2, 0xff, 0x02, 0xf4, 0x02, 0xff,
+    0x73, 0xac, 0xc7, 0xff, 0x99, 0x42, 0x2e, 0xff, 0x1d, 0xde, 0x62, 0xff,
+    0x8d, 0x35, 0x3f, 0xff, 0x12, 0x98, 0x6f, 0xff, 0xf5, 0x04, 0x90, 0xff,
+    0x2c, 0xe6, 0x1e, 0xff, 0xe4, 0x31, 0x43, 0xff, 0x0f, 0x54, 0x0c, 0xff,
+    0xed, 0xe2, 0xf3, 0xff, 0xd1, 0x68, 0x37, 0xff, 0x92, 0x2e, 0xab, 0xff,
+    0x16, 0x97, 0xeb, 0xff, 0x67, 0x76, 0x83, 0xff, 0x33, 0xa8, 0x0f, 0xff,
+    0x8c, 0xe4, 0x3a, 0xff, 0xec, 0x33, 0x7a, 0xff, 0x6f, 0x5c, 0x66, 0xff,
+    0x2a, 0xa4, 0xe4, 0xff, 0x1a, 0xc0, 0x52, 0xff, 0xa4, 0xfb, 0x70, 0xff,
+    0x58, 0x11, 0xab, 0xff, 0xd2, 0xd3, 0x08, 0xff, 0x13, 0xa2, 0xe6, 0xff,
+    0x86, 0x0d, 0xc4, 0xff, 0x3d, 0x41, 0x57, 0xff, 0x72, 0x2b, 0x22, 0xff,
+    0x1b, 0xe0, 0xbe, 0xff, 0xe2, 0x51, 0xa8, 0xff, 0x65, 0xf2, 0x38, 0xff,
+    0xf2, 0x6b, 0x59, 0xff, 0x0a, 0xdd, 0xb6, 0xff, 0xb5, 0x17, 0x7e, 0xff,
+    0x61, 0x4e, 0xcb, 0xff, 0xfb, 0x72, 0xa4, 0xff, 0x8c, 0x3e, 0xe9, 0xff,
+    0xb2, 0xe6, 0xd6, 0xff, 0x1a, 0x80, 0x35, 0xff, 0x7c, 0x94, 0x13, 0xff,
+    0x60, 0x72, 0xa1, 0xff, 0xb8, 0xce, 0x4e, 0xff, 0xe5, 0x88, 0x3a, 0xff,
+    0xa8, 0x65, 0xd7, 0xff, 0x5b, 0x02, 0x17, 0xff, 0x97, 0x5c, 0x7b, 0xff,
+    0xe8, 0x7b, 0xc4, 0xff, 0x2c, 0xcb, 0x3f, 0xff, 0xdc, 0x39, 0x9c, 0xff,
+    0xbe, 0x89, 0x0b, 0xff, 0x4a, 0x19, 0x5e, 0xff, 0x23, 0x4b, 0x8c, 0xff,
+    0x98, 0x6e, 0xcf, 0xff, 0xb3, 0x0b, 0x0c, 0xff, 0x5a, 0xc7, 0xbe, 0xff,
+    0xdf, 0x85, 0xa9, 0xff, 0xfe, 0x0f, 0x8b, 0xff, 0x6a, 0x35, 0x5b, 0xff,
+    0xc9, 0x9b, 0xdd, 0xff, 0xe2, 0x54, 0xb5, 0xff, 0x5d, 0x04, 0xc8, 0xff,
+    0x8d, 0x40, 0x69, 0xff, 0x48, 0xb5, 0x28, 0xff, 0xcd, 0xd7, 0xf9, 0xff,
+    0xb2, 0x51, 0x47, 0xff, 0x3f, 0x20, 0x7f, 0xff, 0x62, 0xc5, 0xd9, 0xff,
+    0xe4, 0x86, 0xa7, 0xff, 0x4b, 0x56, 0x85, 0xff, 0xb7, 0xcd, 0x07, 0xff,
+    0x71, 0x78, 0xea, 0xff, 0xaa, 0xb7, 0xa1, 0xff, 0xcb, 0x92, 0xd7, 0xff,
+    0x9f, 0x85, 0xaf, 0xff, 0x34, 0x44, 0x67, 0xff, 0xbd, 0xbd, 0x8d, 0xff,
+    0x06, 0x17, 0x03, 0xff, 0xb3, 0xdc, 0x5f, 0xff, 0x4e, 0x47, 0xba, 0xff,
+    0xce, 0x13, 0x53, 0xff, 0x9e, 0xb5, 0xf9, 0xff, 0x5d, 0x95, 0xb0, 0xff,
+    0x48, 0x0b, 0xd7, 0xff, 0xbc, 0xda, 0x13, 0xff, 0x90, 0x46, 0x34, 0xff,
+    0xda, 0x83, 0xed, 0xff, 0x73, 0x52, 0xca, 0xff, 0x24, 0x34, 0x45, 0xff,
+    0xe7, 0x6b, 0x7a, 0xff, 0x4c, 0x7d, 0x6a, 0xff, 0x95, 0xba, 0xd5, 0xff,
+    0xee, 0x70, 0xf2, 0xff, 0x56, 0xce, 0x7c, 0xff, 0xa7, 0x11, 0xdf, 0xff,
+    0x3c, 0x80, 0x8b, 0xff, 0xd1, 0x05, 0x27, 0xff, 0x25, 0x5c, 0xf6, 0xff,
+    0x7e, 0xbd, 0x66, 0xff, 0x4f, 0xfa, 0x4e, 0xff, 0x12, 0xa7, 0x1f, 0xff,
+    0x40, 0x01, 0x6c, 0xff, 0xe2, 0xc6, 0x08, 0xff, 0xc8, 0xf6, 0x80, 0xff,
+    0x36, 0x36, 0x61, 0xff, 0xd5, 0x4a, 0xdf, 0xff, 0x21, 0xab, 0xb4, 0xff,
+    0x8f, 0x2a, 0x87, 0xff, 0x71, 0x97, 0x96, 0xff, 0xf7, 0x46, 0x27, 0xff,
+    0xbc, 0xf8, 0xf2, 0xff, 0x17, 0x9e, 0x63, 0xff, 0x8a, 0x23, 0xd5, 0xff,
+    0x5d, 0x53, 0x20, 0xff, 0x35, 0xaf, 0xe9, 0xff, 0xfb, 0xc0, 0xc6, 0xff,
+    0xca, 0xf6, 0x44, 0xff, 0x82, 0x3d, 0xf0, 0xff, 0xea, 0x9d, 0x22, 0xff,
+    0x2f, 0xe8, 0x52, 0xff, 0x78, 0xb3, 0x39, 0xff, 0x26, 0xd9, 0xf7, 0xff,
+    0x96, 0x76, 0x00, 0xff, 0x3d, 0xcc, 0x1e, 0xff, 0x7d, 0x6b, 0x7b, 0xff,
+    0x06, 0x8f, 0xf1, 0xff, 0xc4, 0xfd, 0x92, 0xff, 0x1b, 0x82, 0x51, 0xff,
+    0x58, 0x16, 0xce, 0xff, 0x32, 0x96, 0x39, 0xff, 0xf0, 0x77, 0xb4, 0xff,
+    0xc0, 0xee, 0x0e, 0xff, 0x29, 0x10, 0xf3, 0xff, 0xd1, 0x28, 0x4f, 0xff,
+    0x5a, 0xf3, 0xd1, 0xff, 0x95, 0x66, 0xba, 0xff, 0x21, 0x20, 0x78, 0xff,
+    0x46, 0xd8, 0x31, 0xff, 0x62, 0x11, 0x54, 0xff, 0x88, 0xf1, 0xe3, 0xff,
+    0x6f, 0xa4, 0xbf, 0xff, 0x41, 0x7b, 0xce, 0xff, 0xe3, 0xfe, 0x2c, 0xff,
+    0x7f, 0xc4, 0xa3, 0xff, 0x23, 0x63, 0x1b, 0xff, 0xb9, 0x27, 0xc6, 0xff,
+    0x12, 0x86, 0x29, 0xff, 0x85, 0xf4, 0x43, 0xff, 0xfc, 0x67, 0x93, 0xff,
+    0x03, 0x20, 0xbd, 0xff, 0x3a, 0xad, 0x89, 0xff, 0x9b, 0xdf, 0x26, 0xff,
+    0xb2, 0x90, 0x96, 0xff, 0x63, 0xe9, 0x37, 0xff, 0xbb, 0x4c, 0x18, 0xff,
+    0xcc, 0xf8, 0x9c, 0xff, 0x23, 0x9c, 0x2e, 0xff, 0xd8, 0x8b, 0x47, 0xff,
+    0x02, 0x37, 0x05, 0xff, 0x75, 0xc0, 0x72, 0xff, 0x90, 0xad, 0xd6, 0xff,
+    0xa0, 0x42, 0x42, 0xff, 0xed, 0x8f, 0xad, 0xff, 0xc3, 0x21, 0xe2, 0xff,
+    0xa8, 0x87, 0xc2, 0xff, 0x84, 0x2e, 0x3b, 0xff, 0x70, 0x56, 0x9a, 0xff,
+    0x09, 0x9e, 0xcd, 0xff, 0x94, 0x23, 0xf0, 0xff, 0xeb, 0xbd, 0x2e, 0xff,
+    0x4b, 0xef, 0x1c, 0xff, 0x7f, 0x12, 0xc7, 0xff, 0x06, 0xdb, 0xe7, 0xff,
+    0x3a, 0xb1, 0x70, 0xff, 0x23, 0x31, 0xa4, 0xff, 0x4f, 0xbc, 0x33, 0xff,
+    0xf0, 0x68, 0x8d, 0xff, 0xaa, 0xec, 0x53, 0xff, 0x93, 0x75, 0x6b, 0xff,
+    0x77, 0x04, 0x7e, 0xff, 0x1a, 0xdb, 0x2d, 0xff, 0x51, 0x8e, 0xa3, 0xff,
+    0xa4, 0x58, 0x84, 0xff, 0x15, 0x2c, 0xe4, 0xff, 0xbb, 0x67, 0x77, 0xff,
+    0x4d, 0x40, 0xcc, 0xff, 0xac, 0xa6, 0x98, 0xff, 0x11, 0xf1, 0xc0, 0xff,
+    0xf6, 0x15, 0x37, 0xff, 0xb9, 0xad, 0x5e, 0xff, 0x6d, 0x5d, 0x08, 0xff,
+    0xe9, 0x28, 0xae, 0xff, 0xa3, 0xbf, 0x72, 0xff, 0xd7, 0xe5, 0xe5, 0xff,
+    0x11, 0x3a, 0x5c, 0xff, 0x7e, 0x62, 0x6b, 0xff, 0x9f, 0xb8, 0x98, 0xff,
+    0x07, 0x90, 0x21, 0xff, 0x36, 0xa3, 0x38, 0xff, 0xef, 0x3d, 0x5b, 0xff,
+    0x7f, 0x4d, 0x16, 0xff, 0x03, 0xc3, 0xf8, 0xff, 0xde, 0x6f, 0x96, 0xff,
+    0xfd, 0x36, 0x24, 0xff, 0x26, 0x5f, 0x76, 0xff, 0xa8, 0x23, 0x40, 0xff,
+    0x99, 0x8c, 0xe8, 0xff, 0xf7, 0x39, 0x6b, 0xff, 0x74, 0xd7, 0x49, 0xff,
+    0xdd, 0x71, 0x99, 0xff, 0x3f, 0xe9, 0x74, 0xff, 0xa9, 0x3d, 0x59, 0xff,
+    0xca, 0xc7, 0xf5, 0xff, 0x68, 0x9c, 0x7e, 0xff, 0x4f, 0x75, 0x0b, 0xff,
+    0xf2, 0x09, 0x60, 0xff, 0x7f, 0xc2, 0xda, 0xff, 0x09, 0x24, 0xfe, 0xff,
+    0x19, 0xd4, 0x52, 0xff, 0x6e, 0x00, 0x87, 0xff, 0x36, 0x1d, 0xb1, 0xff,
+    0x8b, 0xeb, 0x60, 0xff, 0xb1, 0x63, 0xfb, 0xff, 0xfb, 0xd9, 0xb8, 0xff,
+    0x46, 0x99, 0x14, 0xff, 0x17, 0x30, 0x98, 0xff, 0x6d, 0xe9, 0x30, 0xff,
+    0x37, 0xd1, 0x0c, 0xff, 0xdc, 0x61, 0x7a, 0xff, 0x23, 0xdf, 0xfd, 0xff,
+    0xf5, 0xb0, 0x47, 0xff, 0x52, 0x6b, 0xaf, 0xff, 0xac, 0x09, 0x54, 0xff,
+    0x69, 0xe3, 0x91, 0xff, 0x10, 0x60, 0x68, 0xff, 0xc5, 0x3c, 0x41, 0xff,
+    0xd8, 0x70, 0x06, 0xff, 0xaf, 0x7e, 0x4d, 0xff, 0x66, 0x18, 0xbc, 0xff,
+    0xce, 0xe0, 0x0f, 0xff, 0x72, 0x0f, 0xfd, 0xff, 0x42, 0x43, 0xac, 0xff,
+    0x11, 0xa2, 0x13, 0xff, 0xb7, 0x61, 0xde, 0xff, 0x67, 0x7f, 0xb2, 0xff,
+    0xf3, 0x1e, 0x04, 0xff, 0x3b, 0xba, 0x61, 0xff, 0xd0, 0xff, 0xb7, 0xff,
+    0x8d, 0x01, 0x11, 0xff, 0xee, 0x94, 0x47, 0xff, 0xdc, 0x23, 0x68, 0xff,
+    0x63, 0x4d, 0xe7, 0xff, 0x32, 0x31, 0xa5, 0xff, 0x9b, 0xe7, 0x43, 0xff,
+    0x41, 0xc7, 0xd7, 0xff, 0x26, 0x46, 0x9a, 0xff, 0x78, 0x6f, 0x1f, 0xff,
+    0x92, 0x01, 0x12, 0xff, 0x67, 0xa6, 0x8d, 0xff, 0x43, 0xd4, 0x2a, 0xff,
+    0xfe, 0x4a, 0xc4, 0xff, 0xac, 0xe2, 0xe2, 0xff, 0x6a, 0x0a, 0xad, 0xff,
+    0xda, 0xb1, 0x8c, 0xff, 0xc5, 0x7e, 0x6b, 0xff, 0x53, 0xe1, 0xc6, 0xff,
+    0xb1, 0x98, 0x08, 0xff, 0x13, 0x02, 0x4c, 0xff, 0xd3, 0xcc, 0x87, 0xff,
+    0x5c, 0xb4, 0x15, 0xff, 0x1a, 0x55, 0xd6, 0xff, 0x38, 0x08, 0x8f, 0xff,
+    0x55, 0xac, 0xf2, 0xff, 0x09, 0x4c, 0x05, 0xff, 0xeb, 0xbc, 0xe2, 0xff,
+    0x2e, 0x04, 0xad, 0xff, 0x7a, 0x55, 0x1f, 0xff, 0xe1, 0x2f, 0xd2, 0xff,
+    0x11, 0xf7, 0x4c, 0xff, 0xc3, 0x42, 0xb4, 0xff, 0x2f, 0x5c, 0xa3, 0xff,
+    0xde, 0xa6, 0x01, 0xff, 0xf6, 0x67, 0x77, 0xff, 0xa4, 0x3c, 0xe9, 0xff,
+    0x4f, 0xb4, 0xc7, 0xff, 0xc5, 0x57, 0x1f, 0xff, 0x61, 0x27, 0xa1, 0xff,
+    0x2b, 0x76, 0x50, 0xff, 0xbe, 0xf5, 0xc9, 0xff, 0x59, 0x1a, 0x85, 0xff,
+    0xd4, 0x6c, 0xef, 0xff, 0x04, 0xb6, 0x57, 0xff, 0x63, 0x48, 0x8d, 0xff,
+    0x9c, 0x14, 0xbb, 0xff, 0xcd, 0x7b, 0x27, 0xff, 0x2f, 0xce, 0x74, 0xff,
+    0xbe, 0x90, 0x15, 0xff, 0x3e, 0x51, 0xbe, 0xff, 0xa2, 0x84, 0x7b, 0xff,
+    0xfa, 0xa4, 0xf8, 0xff, 0x55, 0xc3, 0xac, 0xff, 0x99, 0xf2, 0x5c, 0xff,
+    0xe3, 0x57, 0xdd, 0xff, 0x85, 0x91, 0x81, 0xff, 0x08, 0x85, 0x45, 0xff,
+    0xc4, 0xd1, 0xc2, 0xff, 0xe1, 0x27, 0x97, 0xff, 0x29, 0xe7, 0x3a, 0xff,
+    0xd6, 0x34, 0xd1, 0xff, 0x88, 0xcb, 0x4d, 0xff, 0x00, 0xa7, 0xfc, 0xff,
+    0x60, 0x73, 0x9b, 0xff, 0x70, 0x52, 0x30, 0xff, 0x0a, 0xc1, 0xdc, 0xff,
+    0x22, 0xe2, 0x26, 0xff, 0x85, 0x88, 0x83, 0xff, 0xce, 0xb8, 0x14, 0xff,
+    0x51, 0x78, 0xfe, 0xff, 0xef, 0x0d, 0x2d, 0xff, 0xae, 0x9d, 0x81, 0xff,
+    0x0b, 0xf5, 0xec, 0xff, 0xe2, 0x57, 0xbc, 0xff, 0xb8, 0x2d, 0xa6, 0xff,
+    0x1f, 0x81, 0xfc, 0xff, 0x88, 0x1c, 0x42, 0xff, 0x4f, 0x71, 0x7b, 0xff,
+    0xbc, 0x5e, 0x02, 0xff, 0x1c, 0xfc, 0xed, 0xff, 0x8c, 0x2c, 0x45, 0xff,
+    0x2d, 0x16, 0xa4, 0xff, 0x9c, 0xab, 0xd4, 0xff, 0x74, 0xf7, 0xb6, 0xff,
+    0x4c, 0x46, 0xfd, 0xff, 0xc7, 0xe5, 0x5c, 0xff, 0xf1, 0x99, 0xaa, 0xff,
+    0x8d, 0xee, 0x35, 0xff, 0xaf, 0x81, 0x7c, 0xff, 0xc2, 0x1d, 0xcc, 0xff,
+    0x64, 0xa1, 0x12, 0xff, 0x96, 0x8e, 0x64, 0xff, 0x1c, 0xd4, 0x9d, 0xff,
+    0x5a, 0x7f, 0x32, 0xff, 0xa0, 0xb4, 0xe3, 0xff, 0x8a, 0x19, 0x6e, 0xff,
+    0x44, 0xee, 0x3c, 0xff, 0x5b, 0x86, 0xc0, 0xff, 0x91, 0xbe, 0xdd, 0xff,
+    0xe6, 0x7a, 0x43, 0xff, 0x0b, 0xde, 0x0e, 0xff, 0x80, 0xa8, 0x92, 0xff,
+    0x15, 0x48, 0x39, 0xff, 0xdb, 0x0f, 0xe0, 0xff, 0x7b, 0xcb, 0x63, 0xff,
+    0xea, 0x52, 0x23, 0xff, 0x94, 0x7f, 0x70, 0xff, 0xaf, 0x06, 0xaa, 0xff,
+    0x47, 0xa0, 0x19, 0xff, 0x79, 0xec, 0xdf, 0xff, 0x16, 0x3c, 0x5f, 0xff,
+    0x5c, 0xfb, 0x03, 0xff, 0xf1, 0x1b, 0xec, 0xff, 0x85, 0xb6, 0xd8, 0xff,
+    0x25, 0xd7, 0x29, 0xff, 0x76, 0x0b, 0x9d, 0xff, 0x2d, 0x21, 0xce, 0xff,
+    0x13, 0x4d, 0x1e, 0xff, 0x46, 0xcc, 0x94, 0xff, 0xa3, 0xac, 0x2b, 0xff,
+    0x33, 0x38, 0x76, 0xff, 0xf8, 0xfc, 0xe6, 0xff, 0x59, 0xbe, 0x23, 0xff,
+    0x9d, 0x95, 0x5a, 0xff, 0x47, 0x50, 0x73, 0xff, 0xae, 0x13, 0x90, 0xff,
+    0xe3, 0x44, 0x1e, 0xff, 0xc4, 0xee, 0xc5, 0xff, 0x99, 0x1b, 0x7d, 0xff,
+    0x44, 0x7c, 0x58, 0xff, 0xb6, 0xcf, 0xaf, 0xff, 0xa4, 0x0a, 0x90, 0xff,
+    0x75, 0x64, 0x50, 0xff, 0x17, 0x39, 0xb6, 0xff, 0x8a, 0xdb, 0x62, 0xff,
+    0xd3, 0x85, 0xc5, 0xff, 0x4b, 0xd0, 0x49, 0xff, 0x37, 0xb3, 0x37, 0xff,
+    0x57, 0x92, 0x56, 0xff, 0xcb, 0xc3, 0xd5, 0xff, 0xe6, 0xf0, 0x17, 0xff,
+    0x74, 0x33, 0x65, 0xff, 0x0f, 0xbd, 0xbd, 0xff, 0x40, 0x8a, 0xd9, 0xff,
+    0xf8, 0xd1, 0x25, 0xff, 0x64, 0x53, 0x7e, 0xff, 0xeb, 0x64, 0x39, 0xff,
+    0x3a, 0x88, 0x65, 0xff, 0x94, 0x75, 0x9e, 0xff, 0x7d, 0x2d, 0x0a, 0xff,
+    0x01, 0x0f, 0xc2, 0xff, 0x6b, 0x6b, 0x1f, 0xff, 0x29, 0xc8, 0x57, 0xff,
+    0xd5, 0x31, 0xb7, 0xff, 0x83, 0xfc, 0x89, 0xff, 0x4c, 0x60, 0x3d, 0xff,
+    0xf0, 0x12, 0xc4, 0xff, 0xb8, 0xe4, 0x79, 0xff, 0x25, 0x6a, 0x11, 0xff,
+    0xd5, 0xcd, 0xf7, 0xff, 0xab, 0x98, 0x8f, 0xff, 0x75, 0x2c, 0x22, 0xff,
+    0x29, 0x51, 0x64, 0xff, 0x3e, 0x11, 0x30, 0xff, 0xd2, 0x94, 0xd2, 0xff,
+    0x98, 0xfd, 0x6f, 0xff, 0xf4, 0x84, 0x7f, 0xff, 0x41, 0xbc, 0xed, 0xff,
+    0xa5, 0x92, 0x0a, 0xff, 0x20, 0xaa, 0x48, 0xff, 0x31, 0x37, 0xc1, 0xff,
+    0x86, 0xda, 0xd3, 0xff, 0xff, 0xc2, 0x35, 0xff, 0xe1, 0x8c, 0xa0, 0xff,
+    0xb7, 0x2b, 0x83, 0xff, 0x8f, 0x9b, 0xcb, 0xff, 0x04, 0x45, 0xa5, 0xff,
+    0xd1, 0x76, 0x38, 0xff, 0xe6, 0x32, 0x51, 0xff, 0x60, 0xeb, 0x0c, 0xff,
+    0x90, 0x99, 0x86, 0xff, 0xbe, 0x6b, 0x3c, 0xff, 0xeb, 0x2a, 0xf3, 0xff,
+    0x7b, 0x05, 0xd4, 0xff, 0x20, 0x77, 0x01, 0xff, 0xb0, 0x5c, 0x63, 0xff,
+    0x8e, 0x0b, 0xa2, 0xff, 0x0c, 0x6f, 0xf7, 0xff, 0x7d, 0xb4, 0x0e, 0xff,
+    0x31, 0xe1, 0xe1, 0xff, 0x1f, 0x86, 0x3f, 0xff, 0x53, 0xd4, 0x6b, 0xff,
+    0xf5, 0x9c, 0xec, 0xff, 0x35, 0x2e, 0xd0, 0xff, 0xd8, 0x5b, 0x06, 0xff,
+    0x5a, 0xa5, 0xf3, 0xff, 0xfd, 0xfb, 0x6d, 0xff, 0x03, 0x97, 0xd2, 0xff,
+    0xbd, 0x50, 0x0c, 0xff, 0x64, 0x22, 0x76, 0xff, 0x80, 0x13, 0xdc, 0xff,
+    0xf6, 0x40, 0x03, 0xff, 0x9d, 0x67, 0x6e, 0xff, 0x00, 0x0c, 0x83, 0xff,
+    0x2f, 0xd7, 0x9d, 0xff, 0x97, 0x99, 0x51, 0xff, 0xd3, 0x45, 0x32, 0xff,
+    0xa4, 0x05, 0x95, 0xff, 0x7b, 0xa0, 0x57, 0xff, 0xb6, 0xeb, 0xf6, 0xff,
+    0x0c, 0x3c, 0x18, 0xff, 0xc1, 0x1b, 0xe5, 0xff, 0xe0, 0xc2, 0x2f, 0xff,
+    0x30, 0xd5, 0x81, 0xff, 0xb8, 0xa5, 0xec, 0xff, 0xdb, 0x5b, 0x46, 0xff,
+    0x9c, 0x42, 0xdd, 0xff, 0x41, 0xde, 0x2a, 0xff, 0x0d, 0x76, 0xfc, 0xff,
+    0xa7, 0xb1, 0x4f, 0xff, 0xce, 0x28, 0xe7, 0xff, 0x36, 0x47, 0xa8, 0xff,
+    0x6d, 0x8b, 0x28, 0xff, 0xfa, 0x38, 0xcb, 0xff, 0x00, 0x07, 0x57, 0xff,
+    0xc9, 0xe2, 0xaf, 0xff, 0xb4, 0xf1, 0x85, 0xff, 0x66, 0xce, 0xa6, 0xff,
+    0x1f, 0x31, 0xf6, 0xff, 0xbb, 0x69, 0x54, 0xff, 0x55, 0x06, 0xac, 0xff,
+    0x70, 0x3e, 0x2c, 0xff, 0x07, 0xe3, 0xb4, 0xff, 0xb6, 0x60, 0x9a, 0xff,
+    0x52, 0xfa, 0xfa, 0xff, 0xc2, 0x25, 0x05, 0xff, 0x0c, 0x71, 0x68, 0xff,
+    0x27, 0x59, 0x4e, 0xff, 0x41, 0x09, 0xf7, 0xff, 0x6a, 0x66, 0x42, 0xff,
+    0xa9, 0xe5, 0x8e, 0xff, 0x4c, 0xcb, 0x63, 0xff, 0x17, 0x5d, 0xb7, 0xff,
+    0xb3, 0x8c, 0xe3, 0xff, 0x39, 0x43, 0x72, 0xff, 0xcb, 0xf7, 0x60, 0xff,
+    0x03, 0xdd, 0xb1, 0xff, 0x61, 0xb8, 0x52, 0xff, 0xd9, 0x9f, 0xba, 0xff,
+    0x4d, 0x47, 0x89, 0xff, 0x6e, 0x21, 0x35, 0xff, 0xd0, 0xf3, 0xc9, 0xff,
+    0xc0, 0xa3, 0xb4, 0xff, 0xff, 0x5e, 0x84, 0xff, 0x75, 0x0c, 0xaa, 0xff,
+    0xa8, 0x69, 0x0a, 0xff, 0x12, 0x3b, 0x35, 0xff, 0x80, 0xb5, 0xa0, 0xff,
+    0xc7, 0xea, 0x1d, 0xff, 0x29, 0x45, 0xc2, 0xff, 0x47, 0x18, 0x3c, 0xff,
+    0xe1, 0xc0, 0x9d, 0xff, 0x95, 0x6c, 0x22, 0xff, 0x2d, 0xaa, 0x8b, 0xff,
+    0x1d, 0xe4, 0xa3, 0xff, 0xc1, 0x7b, 0xf7, 0xff, 0x70, 0xfe, 0xb3, 0xff,
+    0xb2, 0x26, 0x24, 0xff, 0x60, 0xa9, 0xcc, 0xff, 0xf5, 0x59, 0xf2, 0xff,
+    0x25, 0x78, 0xaa, 0xff, 0x5a, 0xc8, 0x10, 0xff, 0xe1, 0x23, 0x73, 0xff,
+    0x4a, 0x6e, 0xae, 0xff, 0x21, 0xdc, 0x8f, 0xff, 0xa9, 0xb5, 0xc8, 0xff,
+    0x67, 0x4e, 0x4e, 0xff, 0x11, 0x90, 0x71, 0xff, 0x48, 0x22, 0x95, 0xff,
+    0xed, 0xf6, 0xb0, 0xff, 0x5d, 0xb8, 0x69, 0xff, 0x20, 0x17, 0xa1, 0xff,
+    0xff, 0x95, 0x72, 0xff, 0x72, 0x51, 0x18, 0xff, 0x14, 0xf0, 0x91, 0xff,
+    0x90, 0xc4, 0x60, 0xff, 0x42, 0xaa, 0x47, 0xff, 0x81, 0x59, 0x7f, 0xff,
+    0x17, 0x74, 0x0a, 0xff, 0x52, 0xa0, 0xee, 0xff, 0x88, 0x41, 0x4b, 0xff,
+    0xf8, 0x60, 0x97, 0xff, 0x78, 0x20, 0x06, 0xff, 0xab, 0xc1, 0xbf, 0xff,
+    0x33, 0xd6, 0x1a, 0xff, 0xe4, 0x71, 0xce, 0xff, 0x8b, 0x2b, 0x8a, 0xff,
+    0xce, 0x15, 0x76, 0xff, 0xf1, 0x9a, 0x3d, 0xff, 0x60, 0x4d, 0xe3, 0xff,
+    0x73, 0xb2, 0x92, 0xff, 0xa1, 0xf1, 0xbe, 0xff, 0xc8, 0xc7, 0x2d, 0xff,
+    0xec, 0xa5, 0x1c, 0xff, 0x33, 0xb0, 0xe7, 0xff, 0x7d, 0x26, 0x7d, 0xff,
+    0x9c, 0x00, 0x12, 0xff, 0xde, 0xbf, 0xfe, 0xff, 0x6d, 0xaa, 0xc5, 0xff,
+    0x4f, 0x13, 0x32, 0xff, 0xf3, 0x7e, 0x9a, 0xff, 0x8c, 0x62, 0x13, 0xff,
+    0xb8, 0xe8, 0x6e, 0xff, 0x3a, 0xc3, 0xee, 0xff, 0xf0, 0xd5, 0x19, 0xff,
+    0x17, 0x7f, 0x4b, 0xff, 0x64, 0x39, 0x2c, 0xff, 0x3f, 0x2b, 0x60, 0xff,
+    0x93, 0x92, 0xf2, 0xff, 0xba, 0xc4, 0x52, 0xff, 0xdf, 0xf9, 0xbc, 0xff,
+    0x66, 0x05, 0x87, 0xff, 0x90, 0x70, 0x4a, 0xff, 0x1b, 0x8f, 0x78, 0xff,
+    0xb0, 0x28, 0x2e, 0xff, 0x6c, 0xd3, 0xe0, 0xff, 0x3c, 0xf1, 0xee, 0xff,
+    0xa9, 0x33, 0x42, 0xff, 0xdd, 0x5d, 0x5a, 0xff, 0x0e, 0xc9, 0x2e, 0xff,
+    0x8c, 0x4d, 0x93, 0xff, 0xd9, 0x86, 0xe5, 0xff, 0x45, 0x3b, 0x0a, 0xff,
+    0x82, 0xe0, 0x3e, 0xff, 0xc2, 0x14, 0x88, 0xff, 0x37, 0xf7, 0xe1, 0xff,
+    0x05, 0xad, 0xcd, 0xff, 0xcf, 0x32, 0x47, 0xff, 0x83, 0x96, 0x04, 0xff,
+    0x57, 0x08, 0xbb, 0xff, 0xfc, 0x7e, 0x23, 0xff, 0x89, 0xe3, 0xd3, 0xff,
+    0xa4, 0x38, 0x11, 0xff, 0x78, 0x72, 0xf4, 0xff, 0xcb, 0x8a, 0x07, 0xff,
+    0x8b, 0x01, 0x38, 0xff, 0xb6, 0xd2, 0xd8, 0xff, 0xe5, 0x37, 0xbb, 0xff,
+    0x55, 0x9e, 0x02, 0xff, 0xc3, 0x0c, 0xf1, 0xff, 0xde, 0x22, 0xdc, 0xff,
+    0x62, 0xfb, 0x9c, 0xff, 0xea, 0xb7, 0xbc, 0xff, 0x9e, 0x1b, 0x19, 0xff,
+    0xd8, 0x7e, 0x72, 0xff, 0x06, 0xb0, 0xe5, 0xff, 0x49, 0x89, 0x28, 0xff,
+    0xed, 0x9d, 0x6a, 0xff, 0x10, 0x55, 0x43, 0xff, 0x64, 0xeb, 0x5c, 0xff,
+    0x9e, 0x8c, 0xdb, 0xff, 0x45, 0xb8, 0x13, 0xff, 0x13, 0xd2, 0x55, 0xff,
+    0x38, 0x0c, 0x25, 0xff, 0xd9, 0x88, 0x7a, 0xff, 0x84, 0x3f, 0xb0, 0xff,
+    0x54, 0x79, 0x0d, 0xff, 0x1e, 0x17, 0x6e, 0xff, 0xda, 0x50, 0xc7, 0xff,
+    0xbd, 0x82, 0xab, 0xff, 0x0c, 0xff, 0x48, 0xff, 0xfe, 0x6f, 0x25, 0xff,
+    0x1e, 0xd4, 0x8f, 0xff, 0xaa, 0x3b, 0x08, 0xff, 0x29, 0x53, 0xe0, 0xff,
+    0x74, 0x91, 0xcc, 0xff, 0x0e, 0x31, 0x3e, 0xff, 0x9a, 0x18, 0xa7, 0xff,
+    0x26, 0x8c, 0xd8, 0xff, 0xa7, 0x4e, 0x96, 0xff, 0xe6, 0xca, 0x78, 0xff,
+    0x07, 0xec, 0xc1, 0xff, 0x5b, 0x1d, 0x21, 0xff, 0x2a, 0xaa, 0x92, 0xff,
+    0x4b, 0x4a, 0xdd, 0xff, 0x04, 0x81, 0x65, 0xff, 0xe9, 0xdd, 0xfb, 0xff,
+    0x9f, 0xad, 0xa8, 0xff, 0x7c, 0x58, 0x5d, 0xff, 0xef, 0x77, 0x80, 0xff,
+    0xca, 0x05, 0x0f, 0xff, 0x5b, 0x8c, 0xb9, 0xff, 0xfa, 0xbb, 0xca, 0xff,
+    0x4e, 0x9a, 0x13, 0xff, 0x35, 0x08, 0x62, 0xff, 0x20, 0xea, 0x4b, 0xff,
+    0xec, 0xb5, 0x79, 0xff, 0x13, 0x6a, 0xc2, 0xff, 0xaf, 0x91, 0x68, 0xff,
+    0x8f, 0x4b, 0x1f, 0xff, 0x6b, 0x82, 0x2d, 0xff, 0x9b, 0x5f, 0xed, 0xff,
+    0xf1, 0xc4, 0x6c, 0xff, 0x2b, 0xff, 0x5f, 0xff, 0xd3, 0x59, 0xa4, 0xff,
+    0x3b, 0x14, 0xe2, 0xff, 0x1c, 0xb0, 0x40, 0xff, 0x52, 0xcf, 0x5d, 0xff,
+    0x05, 0x4c, 0x8e, 0xff, 0x35, 0x63, 0xcc, 0xff, 0x67, 0xe8, 0x83, 0xff,
+    0x2a, 0x7d, 0x25, 0xff, 0x9b, 0x6d, 0xae, 0xff, 0x08, 0xdd, 0x3f, 0xff,
+    0xad, 0x82, 0x6d, 0xff, 0x2d, 0xd5, 0x2e, 0xff, 0xbc, 0x49, 0xd4, 0xff,
+    0x38, 0xc7, 0x3b, 0xff, 0x5d, 0x03, 0x59, 0xff, 0xc1, 0xdb, 0xc6, 0xff,
+    0x2d, 0xf8, 0xd9, 0xff, 0x91, 0x37, 0x84, 0xff, 0xd6, 0x17, 0xff, 0xff,
+    0xc4, 0xac, 0xa0, 0xff, 0x24, 0x46, 0x32, 0xff, 0x7e, 0x7b, 0xf3, 0xff,
+    0xe0, 0xe9, 0xa9, 0xff, 0x95, 0x6a, 0xcc, 0xff, 0xac, 0x20, 0x5e, 0xff,
+    0x18, 0xdc, 0xf0, 0xff, 0xf9, 0x32, 0xd3, 0xff, 0x97, 0xd1, 0x54, 0xff,
+    0x5f, 0xed, 0x99, 0xff, 0x72, 0x96, 0x33, 0xff, 0x43, 0x35, 0xdb, 0xff,
+    0x58, 0x58, 0x5a, 0xff, 0x84, 0x1d, 0xa3, 0xff, 0x96, 0xa1, 0x7b, 0xff,
+    0xd5, 0xca, 0x4c, 0xff, 0x42, 0x0c, 0xf9, 0xff, 0xc3, 0xf5, 0x27, 0xff,
+    0xe0, 0x6d, 0x7f, 0xff, 0x81, 0xae, 0x57, 0xff, 0x50, 0x01, 0xe5, 0xff,
+    0x8a, 0x66, 0x03, 0xff, 0xd5, 0xb6, 0xd3, 0xff, 0x9e, 0x77, 0x44, 0xff,
+    0xef, 0xd8, 0x73, 0xff, 0xc3, 0x56, 0x12, 0xff, 0x73, 0x21, 0x29, 0xff,
+    0x3a, 0xc8, 0xd4, 0xff, 0xd1, 0x11, 0x01, 0xff, 0x51, 0x3b, 0xc7, 0xff,
+    0x09, 0xe8, 0x92, 0xff, 0x22, 0xa1, 0x4f, 0xff, 0x85, 0x48, 0xab, 0xff,
+    0x75, 0x16, 0xf3, 0xff, 0x9f, 0x2d, 0x72, 0xff, 0xcd, 0x72, 0xd7, 0xff,
+    0x6a, 0xa3, 0xbc, 0xff, 0xa7, 0x1f, 0x34, 0xff, 0x76, 0xc2, 0xfe, 0xff,
+    0x4d, 0x2e, 0x59, 0xff, 0xcb, 0xd0, 0xa2, 0xff, 0xe7, 0xee, 0xb7, 0xff,
+    0x15, 0x18, 0x82, 0xff, 0x42, 0x42, 0x3b, 0xff, 0x71, 0xa5, 0xf7, 0xff,
+    0x92, 0x2c, 0x8a, 0xff, 0xb3, 0x69, 0x31, 0xff, 0xe2, 0xef, 0x7c, 0xff,
+    0xc2, 0x9e, 0xc3, 0xff, 0xf5, 0x26, 0x1b, 0xff, 0xac, 0xc5, 0x4c, 0xff,
+    0xd9, 0xa8, 0xea, 0xff, 0x45, 0x1c, 0x59, 0xff, 0x85, 0xba, 0x79, 0xff,
+    0xf1, 0x3f, 0xc8, 0xff, 0x76, 0x62, 0x1a, 0xff, 0x4e, 0x2e, 0x8b, 0xff,
+    0x95, 0x8f, 0xfc, 0xff, 0x1c, 0x6b, 0xb2, 0xff, 0xe4, 0xe6, 0x9f, 0xff,
+    0x6f, 0x29, 0x10, 0xff, 0xa6, 0x4d, 0x36, 0xff, 0x83, 0x78, 0x94, 0xff,
+    0x59, 0xca, 0xb7, 0xff, 0x3c, 0xf3, 0x00, 0xff, 0xfc, 0x01, 0x6e, 0xff,
+    0x6d, 0x5b, 0xbb, 0xff, 0xb4, 0x30, 0x47, 0xff, 0x2d, 0xc0, 0x85, 0xff,
+    0x68, 0x9e, 0x1a, 0xff, 0x4a, 0xf5, 0x9f, 0xff, 0x00, 0x8f, 0x3e, 0xff,
+    0xb2, 0x5f, 0x89, 0xff, 0x29, 0x0f, 0xf6, 0xff, 0x8c, 0x46, 0x01, 0xff,
+    0xd3, 0xda, 0x69, 0xff, 0xc5, 0xb3, 0xbe, 0xff, 0x31, 0x89, 0xef, 0xff,
+    0xe7, 0xf1, 0x1d, 0xff, 0x13, 0x27, 0xad, 0xff, 0x54, 0xb5, 0x62, 0xff,
+    0xfa, 0xd9, 0x8d, 0xff, 0x5f, 0x3e, 0xbb, 0xff, 0x31, 0x9c, 0x17, 0xff,
+    0xcc, 0xfd, 0x68, 0xff, 0xb5, 0xdd, 0x3a, 0xff, 0x77, 0x43, 0xfd, 0xff,
+    0x37, 0x0a, 0xa4, 0xff, 0x19, 0x8b, 0xb7, 0xff, 0x86, 0x33, 0xe4, 0xff,
+    0xb2, 0x9f, 0x97, 0xff, 0x5d, 0x65, 0x41, 0xff, 0xfa, 0xf8, 0xb2, 0xff,
+    0x30, 0xb8, 0x1a, 0xff, 0xbc, 0x84, 0xe5, 0xff, 0x99, 0xcd, 0x67, 0xff,
+    0x44, 0x67, 0x24, 0xff, 0x17, 0xf7, 0x3a, 0xff, 0xb4, 0xdd, 0x85, 0xff,
+    0xe5, 0xcf, 0x9f, 0xff, 0x58, 0x60, 0x1b, 0xff, 0x96, 0xf3, 0xae, 0xff,
+    0x07, 0x0d, 0x91, 0xff, 0xfd, 0x56, 0x00, 0xff, 0x2e, 0xa1, 0xd7, 0xff,
+    0x5e, 0x00, 0x50, 0xff, 0xbb, 0xba, 0x98, 0xff, 0xab, 0x74, 0x0b, 0xff,
+    0xc7, 0xe9, 0xcf, 0xff, 0x12, 0xc9, 0x13, 0xff, 0x60, 0x93, 0x54, 0xff,
+    0x27, 0x07, 0xb6, 0xff, 0x6f, 0x40, 0xfe, 0xff, 0x96, 0x83, 0xa9, 0xff,
+    0x7d, 0xfd, 0x67, 0xff, 0x16, 0x30, 0x9a, 0xff, 0xca, 0x58, 0x33, 0xff,
+    0x5e, 0xf4, 0xf9, 0xff, 0x21, 0x05, 0xa4, 0xff, 0xd2, 0x99, 0x51, 0xff,
+    0x0f, 0xec, 0x63, 0xff, 0xfd, 0x13, 0x04, 0xff, 0x7d, 0xa8, 0x7b, 0xff,
+    0x41, 0x5b, 0x47, 0xff, 0x11, 0x95, 0xea, 0xff, 0xcf, 0x12, 0x64, 0xff,
+    0x1f, 0xba, 0x1f, 0xff, 0xb8, 0x64, 0x4f, 0xff, 0x04, 0x23, 0xe6, 0xff,
+    0xa5, 0x97, 0x7f, 0xff, 0x53, 0xa7, 0x0f, 0xff, 0x0c, 0xcd, 0x97, 0xff,
+    0xf4, 0x43, 0xec, 0xff, 0xd3, 0x57, 0x36, 0xff, 0xbd, 0x04, 0x09, 0xff,
+    0x7b, 0xb7, 0xdf, 0xff, 0xe6, 0x6d, 0x74, 0xff, 0x3b, 0xc1, 0x22, 0xff,
+    0xf5, 0xa0, 0xb3, 0xff, 0xa3, 0x78, 0x81, 0xff, 0x05, 0x0b, 0x3c, 0xff,
+    0xb4, 0xe5, 0xd3, 0xff, 0x64, 0x67, 0x71, 0xff, 0x7b, 0x76, 0x35, 0xff,
+    0xa1, 0x4a, 0xc4, 0xff, 0xae, 0x84, 0x06, 0xff, 0x01, 0x5b, 0x45, 0xff,
+    0x70, 0x24, 0xf0, 0xff, 0x1e, 0x7a, 0xb1, 0xff, 0x45, 0x2f, 0x9c, 0xff,
+    0x0e, 0x98, 0x86, 0xff, 0xfb, 0x5f, 0x0d, 0xff, 0x6a, 0xf4, 0x5b, 0xff,
+    0xda, 0xbf, 0x34, 0xff, 0x23, 0xe5, 0x80, 0xff, 0xa4, 0x44, 0x55, 0xff,
+    0x0f, 0x95, 0xf0, 0xff, 0x8c, 0x2d, 0x72, 0xff, 0x65, 0x52, 0x32, 0xff,
+    0xda, 0x1f, 0xd1, 0xff, 0xec, 0xb3, 0x98, 0xff, 0xc5, 0x3e, 0x04, 0xff,
+    0x0b, 0x81, 0xe1, 0xff, 0x3d, 0x50, 0x54, 0xff, 0x2b, 0x94, 0x29, 0xff,
+    0xbf, 0x42, 0xea, 0xff, 0xd5, 0x7d, 0x80, 0xff, 0x3f, 0xe6, 0x41, 0xff,
+    0x88, 0x70, 0xe6, 0xff, 0x1f, 0x3a, 0x1b, 0xff, 0x7d, 0xda, 0xc5, 0xff,
+    0x53, 0x89, 0x76, 0xff, 0x02, 0x1e, 0xae, 0xff, 0xdb, 0x49, 0xdc, 0xff,
+    0x81, 0x7c, 0x20, 0xff, 0xee, 0xde, 0x9c, 0xff, 0x3d, 0x5e, 0x72, 0xff,
+    0x0d, 0xbd, 0x2a, 0xff, 0x4d, 0x0e, 0xdf, 0xff, 0xa1, 0x95, 0x11, 0xff,
+    0xfa, 0x48, 0xbd, 0xff, 0xb7, 0x8b, 0x09, 0xff, 0x3d, 0xc9, 0xd7, 0xff,
+    0xa5, 0xae, 0x94, 0xff, 0x68, 0x53, 0xe4, 0xff, 0xc6, 0xbe, 0xc2, 0xff,
+    0xb1, 0x3a, 0x24, 0xff, 0x56, 0xd0, 0x8e, 0xff, 0x9b, 0x6e, 0xce, 0xff,
+    0xf7, 0xa5, 0xb0, 0xff, 0x4a, 0xd9, 0x76, 0xff, 0xdc, 0x87, 0xd3, 0xff,
+    0x77, 0x3d, 0x40, 0xff, 0xe8, 0xe0, 0xc7, 0xff, 0x8f, 0x6f, 0x23, 0xff,
+    0xc6, 0xfe, 0xd9, 0xff, 0x20, 0x19, 0x67, 0xff, 0x3f, 0x82, 0xc1, 0xff,
+    0x8a, 0xab, 0xb2, 0xff, 0x56, 0x4b, 0x4d, 0xff, 0xca, 0x25, 0x61, 0xff,
+    0x11, 0xe6, 0xce, 0xff, 0x69, 0x1a, 0xe9, 0xff, 0x22, 0xcc, 0x14, 0xff,
+    0x4e, 0x2e, 0x9c, 0xff, 0xf2, 0x42, 0x52, 0xff, 0x3d, 0x9a, 0x0c, 0xff,
+    0xce, 0x05, 0xea, 0xff, 0x24, 0xc5, 0x97, 0xff, 0x87, 0xa4, 0xdc, 0xff,
+    0xbc, 0xe9, 0x75, 0xff, 0xf1, 0x10, 0xd0, 0xff, 0x94, 0xbe, 0x2f, 0xff,
+    0xe8, 0x52, 0x52, 0xff, 0xaa, 0xc8, 0x1f, 0xff, 0xc6, 0x14, 0xcd, 0xff,
+    0x52, 0xa6, 0x6c, 0xff, 0x40, 0x71, 0xf6, 0xff, 0x95, 0x17, 0xc0, 0xff,
+    0xc8, 0x7c, 0x22, 0xff, 0x49, 0x00, 0xa1, 0xff, 0xe1, 0xd8, 0x8a, 0xff,
+    0x72, 0x72, 0x48, 0xff, 0xa6, 0x0e, 0xfc, 0xff, 0x28, 0xe4, 0x78, 0xff,
+    0x5f, 0xa8, 0xc3, 0xff, 0x90, 0x25, 0x44, 0xff, 0x82, 0x03, 0xf8, 0xff,
+    0xf3, 0xb9, 0x6a, 0xff, 0x1c, 0x33, 0x0f, 0xff, 0x65, 0xd5, 0xd0, 0xff,
+    0xb2, 0x8a, 0x73, 0xff, 0xdf, 0xb2, 0x31, 0xff, 0xa3, 0x61, 0x66, 0xff,
+    0xea, 0x29, 0xfb, 0xff, 0x37, 0x9b, 0x45, 0xff, 0xfa, 0x57, 0x92, 0xff,
+    0x9d, 0xb6, 0x36, 0xff, 0x4b, 0x32, 0x64, 0xff, 0xa6, 0xd2, 0xee, 0xff,
+    0xbc, 0x18, 0x01, 0xff, 0x5d, 0xae, 0x3e, 0xff, 0xe9, 0x77, 0xd1, 0xff,
+    0x30, 0xe4, 0x48, 0xff, 0x6e, 0xd6, 0x89, 0xff, 0x01, 0x27, 0x6d, 0xff,
+    0x91, 0x6f, 0x23, 0xff, 0xed, 0xe2, 0x45, 0xff, 0x33, 0x1a, 0x36, 0xff,
+    0x88, 0x77, 0xa7, 0xff, 0x26, 0xff, 0xf5, 0xff, 0xea, 0x0b, 0x2f, 0xff,
+    0x79, 0x44, 0x56, 0xff, 0x35, 0xf1, 0x07, 0xff, 0x68, 0x30, 0xf0, 0xff,
+    0x96, 0x56, 0xa5, 0xff, 0x18, 0xc6, 0x2d, 0xff, 0x32, 0x0e, 0x60, 0xff,
+    0x46, 0x7e, 0xae, 0xff, 0x7f, 0x28, 0x53, 0xff, 0x60, 0x93, 0x77, 0xff,
+    0x9f, 0xe4, 0x2b, 0xff, 0xec, 0xcf, 0xfd, 0xff, 0x30, 0x77, 0x93, 0xff,
+    0xa6, 0xfb, 0xa8, 0xff, 0xde, 0x3c, 0x30, 0xff, 0x99, 0x85, 0x46, 0xff,
+    0x82, 0x62, 0x8d, 0xff, 0xc0, 0xf5, 0xf8, 0xff, 0x74, 0xbe, 0x2b, 0xff,
+    0x91, 0x56, 0xb9, 0xff, 0x0a, 0xdf, 0x85, 0xff, 0xdf, 0x32, 0x57, 0xff,
+    0x49, 0x1a, 0x25, 0xff, 0x38, 0xd0, 0xa4, 0xff, 0xd7, 0x8f, 0x12, 0xff,
+    0x58, 0xaa, 0x8f, 0xff, 0x65, 0xf0, 0xc5, 0xff, 0x26, 0x82, 0x7a, 0xff,
+    0x8d, 0xe3, 0xec, 0xff, 0xba, 0x3f, 0x46, 0xff, 0x08, 0x2a, 0xa9, 0xff,
+    0xf1, 0xd3, 0x15, 0xff, 0x7d, 0x5a, 0xcf, 0xff, 0x18, 0xa9, 0x63, 0xff,
+    0xb4, 0xec, 0x0b, 0xff, 0x39, 0xc3, 0xba, 0xff, 0x06, 0x9b, 0xa7, 0xff,
+    0x53, 0x5d, 0x16, 0xff, 0xff, 0x8d, 0x61, 0xff, 0x6e, 0x6d, 0xb3, 0xff,
+    0xd1, 0xc7, 0x8e, 0xff, 0xa4, 0xfd, 0xc8, 0xff, 0x7b, 0xaa, 0xa7, 0xff,
+    0x4e, 0x12, 0x5d, 0xff, 0x93, 0x20, 0xbb, 0xff, 0x0b, 0xf9, 0x9b, 0xff,
+    0x6f, 0x4c, 0xaa, 0xff, 0xcd, 0xca, 0x25, 0xff, 0x25, 0xe2, 0x5a, 0xff,
+    0x8d, 0x13, 0xe5, 0xff, 0x67, 0xfb, 0xbd, 0xff, 0x2f, 0xa6, 0x82, 0xff,
+    0x1d, 0x6e, 0x4d, 0xff, 0xcc, 0xf2, 0xc6, 0xff, 0x88, 0x50, 0x90, 0xff,
+    0xdd, 0x39, 0x7c, 0xff, 0x23, 0x67, 0xf6, 0xff, 0xc4, 0xa5, 0xaa, 0xff,
+    0x82, 0x15, 0x5a, 0xff, 0x57, 0x80, 0xe8, 0xff, 0xdb, 0x36, 0xb3, 0xff,
+    0x4b, 0x4a, 0x81, 0xff, 0x0a, 0x9f, 0x16, 0xff, 0xd6, 0x87, 0x6e, 0xff,
+    0xbb, 0x21, 0xbc, 0xff, 0x02, 0xb4, 0x85, 0xff, 0xaa, 0x7b, 0x3b, 0xff,
+    0xc7, 0x06, 0x99, 0xff, 0x5b, 0x9a, 0x15, 0xff, 0xf1, 0xf7, 0x87, 0xff,
+    0xb6, 0xaf, 0xfa, 0xff, 0xd2, 0x51, 0x90, 0xff, 0xaa, 0xbc, 0xe4, 0xff,
+    0xdf, 0x39, 0x04, 0xff, 0x08, 0x64, 0x83, 0xff, 0x6b, 0x0a, 0xd5, 0xff,
+    0x1b, 0x30, 0x1c, 0xff, 0x76, 0x98, 0x0e, 0xff, 0x45, 0xb1, 0x7b, 0xff,
+    0x5a, 0x50, 0xc5, 0xff, 0xe4, 0xa7, 0x5c, 0xff, 0x14, 0x90, 0xdc, 0xff,
+    0xa7, 0x22, 0x68, 0xff, 0x2b, 0xab, 0xa8, 0xff, 0xed, 0x7f, 0xcc, 0xff,
+    0x6a, 0xf3, 0x3f, 0xff, 0x9c, 0x62, 0xff, 0xff, 0x15, 0x70, 0x6a, 0xff,
+    0x79, 0x47, 0x49, 0xff, 0x0c, 0x39, 0xf4, 0xff, 0xa1, 0x04, 0x5e, 0xff,
+    0xde, 0x64, 0xb4, 0xff, 0x32, 0x20, 0x2a, 0xff, 0x76, 0xb2, 0x07, 0xff,
+    0x60, 0x92, 0x90, 0xff, 0xe4, 0xff, 0x78, 0xff, 0x2e, 0xbb, 0xde, 0xff,
+    0x57, 0x89, 0x3d, 0xff, 0xf7, 0x37, 0xe9, 0xff, 0x84, 0x49, 0x27, 0xff,
+    0xd5, 0xfa, 0x57, 0xff, 0xbf, 0x2f, 0xdd, 0xff, 0x33, 0xd4, 0x30, 0xff,
+    0xaf, 0x19, 0x09, 0xff, 0x48, 0xe7, 0x7d, 0xff, 0x01, 0x78, 0x38, 0xff,
+    0xdb, 0x65, 0x4c, 0xff, 0x34, 0x54, 0x17, 0xff, 0xf8, 0xc4, 0xef, 0xff,
+    0x17, 0x94, 0x09, 0xff, 0x59, 0x0a, 0xda, 0xff, 0x45, 0xa9, 0x88, 0xff,
+    0xbd, 0x7f, 0x15, 0xff, 0x76, 0x68, 0x6f, 0xff, 0xb1, 0x04, 0x09, 0xff,
+    0xd7, 0x3d, 0xa2, 0xff, 0xf6, 0x88, 0xd8, 0xff, 0x06, 0x20, 0x18, 0xff,
+    0x74, 0x9a, 0x60, 0xff, 0xaf, 0xcc, 0xb8, 0xff, 0x98, 0x07, 0x14, 0xff,
+    0x44, 0xf9, 0x2e, 0xff, 0xe5, 0x5d, 0xc9, 0xff, 0x19, 0xb7, 0x77, 0xff,
+    0x76, 0xd2, 0x0e, 0xff, 0xac, 0xf2, 0xd0, 0xff, 0x94, 0x2b, 0x5e, 0xff,
+    0x62, 0xc6, 0xde, 0xff, 0x45, 0x91, 0x0c, 0xff, 0x81, 0x61, 0xfb, 0xff,
+    0x29, 0xe9, 0xc9, 0xff, 0xe3, 0xbd, 0x65, 0xff, 0x0d, 0x1f, 0xdf, 0xff,
+    0x87, 0x6c, 0xbf, 0xff, 0x23, 0x45, 0x46, 0xff, 0x70, 0xd6, 0x19, 0xff,
+    0x12, 0x15, 0x37, 0xff, 0x38, 0xee, 0x9f, 0xff, 0x93, 0xa1, 0x43, 0xff,
+    0xf9, 0xc2, 0x5a, 0xff, 0xb0, 0xd9, 0x6c, 0xff, 0xc5, 0x5b, 0xe2, 0xff,
+    0x05, 0x14, 0xb9, 0xff, 0xb6, 0xde, 0xa0, 0xff, 0x33, 0x04, 0x20, 0xff,
+    0xfc, 0x70, 0x08, 0xff, 0x43, 0xd5, 0x42, 0xff, 0x5e, 0x12, 0x79, 0xff,
+    0xb3, 0x3d, 0x10, 0xff, 0xc4, 0x94, 0x1d, 0xff, 0x56, 0xb4, 0xb6, 0xff,
+    0xfc, 0x29, 0x81, 0xff, 0xcf, 0xfa, 0xe4, 0xff, 0xb2, 0xd6, 0x04, 0xff,
+    0x3d, 0x75, 0x39, 0xff, 0x81, 0x9e, 0xd4, 0xff, 0xf8, 0xda, 0x9f, 0xff,
+    0x16, 0x4b, 0xe1, 0xff, 0x9a, 0x6c, 0x4f, 0xff, 0xa8, 0x0d, 0x2f, 0xff,
+    0x6d, 0x50, 0xb3, 0xff, 0xcf, 0x24, 0x97, 0xff, 0x92, 0x6a, 0x70, 0xff,
+    0x21, 0x08, 0xc9, 0xff, 0x9e, 0x7d, 0x82, 0xff, 0x77, 0xbc, 0x93, 0xff,
+    0x11, 0x55, 0xee, 0xff, 0x96, 0x3c, 0xa2, 0xff, 0x20, 0x9a, 0xda, 0xff,
+    0xea, 0x48, 0x21, 0xff, 0x5c, 0x2b, 0xe3, 0xff, 0xb7, 0xa1, 0x93, 0xff,
+    0xc7, 0xe1, 0x82, 0xff, 0x9d, 0x35, 0x3e, 0xff, 0x86, 0x76, 0x53, 0xff,
+    0xf2, 0x41, 0xcb, 0xff, 0x09, 0xeb, 0xb7, 0xff, 0xe2, 0xbe, 0xec, 0xff,
+    0x16, 0x95, 0x2d, 0xff, 0x57, 0xc6, 0x41, 0xff, 0x42, 0x59, 0xf9, 0xff,
+    0x93, 0xe0, 0xad, 0xff, 0x35, 0xb8, 0x26, 0xff, 0x52, 0x2c, 0xe3, 0xff,
+    0x12, 0x8d, 0x53, 0xff, 0x66, 0xc2, 0xa0, 0xff, 0xa0, 0x41, 0xed, 0xff,
+    0xcd, 0x98, 0x3c, 0xff, 0x2a, 0x03, 0x9a, 0xff, 0xbe, 0x68, 0xf3, 0xff,
+    0xf2, 0x57, 0x4c, 0xff, 0x1e, 0xe0, 0x96, 0xff, 0xd3, 0x34, 0x21, 0xff,
+    0xfc, 0x4f, 0x48, 0xff, 0x8f, 0xcf, 0x73, 0xff, 0xb3, 0x3b, 0x27, 0xff,
+    0x40, 0x8d, 0x51, 0xff, 0xa0, 0xe1, 0x06, 0xff, 0x4c, 0x2c, 0x6f, 0xff,
+    0xfe, 0x9e, 0xce, 0xff, 0x58, 0x88, 0xf1, 0xff, 0xba, 0x57, 0xbd, 0xff,
+    0xce, 0x72, 0xaa, 0xff, 0x4f, 0x44, 0xc7, 0xff, 0x24, 0x21, 0xef, 0xff,
+    0x7f, 0x81, 0x3c, 0xff, 0xd8, 0xf2, 0x50, 0xff, 0x92, 0xc7, 0xfa, 0xff,
+    0x67, 0x33, 0x70, 0xff, 0xcb, 0x49, 0xd2, 0xff, 0x89, 0xfc, 0x95, 0xff,
+    0xd7, 0x60, 0xef, 0xff, 0x1b, 0xcc, 0xe1, 0xff, 0x7f, 0x4e, 0x5f, 0xff,
+    0x30, 0xc3, 0x9d, 0xff, 0x8d, 0x0f, 0x2d, 0xff, 0x21, 0x8a, 0xc0, 0xff,
+    0xc0, 0x54, 0xa8, 0xff, 0x4f, 0xb9, 0x71, 0xff, 0x04, 0x31, 0x1a, 0xff,
+    0xca, 0xec, 0x87, 0xff, 0x4a, 0x87, 0x67, 0xff, 0xd7, 0xc2, 0xc4, 0xff,
+    0x24, 0x34, 0xfd, 0xff, 0xbd, 0x9d, 0x5d, 0xff, 0x01, 0xe2, 0x05, 0xff,
+    0x43, 0xcc, 0x4c, 0xff, 0x63, 0x94, 0xf4, 0xff, 0xf0, 0xab, 0x38, 0xff,
+    0x4d, 0x14, 0x1c, 0xff, 0xe4, 0xef, 0x6c, 0xff, 0xcc, 0x89, 0x50, 0xff,
+    0x68, 0xb3, 0xbc, 0xff, 0x2c, 0x10, 0x74, 0xff, 0x8c, 0xda, 0xf4, 0xff,
+    0x71, 0x84, 0x2c, 0xff, 0x3e, 0x6a, 0xc4, 0xff, 0xd7, 0xf0, 0x6c, 0xff,
+    0x28, 0x1a, 0xf6, 0xff, 0xac, 0xd4, 0x34, 0xff, 0x61, 0x23, 0x79, 0xff,
+    0x3a, 0x4f, 0x98, 0xff, 0x9b, 0x2d, 0xd2, 0xff, 0x7e, 0xef, 0x57, 0xff,
+    0xba, 0x74, 0x8a, 0xff, 0x69, 0x0b, 0x75, 0xff, 0xec, 0x46, 0x3a, 0xff,
+    0xd3, 0x7f, 0x95, 0xff, 0xf4, 0xe7, 0x6b, 0xff, 0xb9, 0x53, 0x07, 0xff,
+    0x37, 0x23, 0x86, 0xff, 0xfe, 0xec, 0x20, 0xff, 0x10, 0x85, 0x68, 0xff,
+    0x6e, 0xa6, 0xc3, 0xff, 0x3b, 0x10, 0x2d, 0xff, 0x9f, 0xaf, 0xaf, 0xff,
+    0x6b, 0x7f, 0xe8, 0xff, 0x14, 0x9f, 0xa0, 0xff, 0x50, 0x17, 0xb7, 0xff,
+    0x72, 0x72, 0x82, 0xff, 0xd8, 0xa7, 0xee, 0xff, 0x64, 0x5d, 0x9d, 0xff,
+    0xc3, 0x07, 0xb3, 0xff, 0xe5, 0x77, 0x7d, 0xff, 0x7a, 0xf4, 0x64, 0xff,
+    0x2b, 0xb4, 0x22, 0xff, 0x84, 0x10, 0x0b, 0xff, 0xe4, 0xea, 0x8b, 0xff,
+    0x63, 0x8e, 0x29, 0xff, 0x3b, 0xb8, 0x99, 0xff, 0xf5, 0x66, 0x02, 0xff,
+    0x52, 0x79, 0x86, 0xff, 0x0e, 0x9f, 0x33, 0xff, 0x21, 0xbb, 0xae, 0xff,
+    0xa0, 0x83, 0x4e, 0xff, 0x4d, 0x28, 0xbd, 0xff, 0x03, 0xe6, 0x36, 0xff,
+    0xe3, 0x00, 0x8d, 0xff, 0xad, 0x78, 0xd3, 0xff, 0x43, 0x9c, 0x51, 0xff,
+    0x70, 0xe3, 0x16, 0xff, 0xef, 0x22, 0xdb, 0xff, 0x95, 0xcb, 0x94, 0xff,
+    0x6b, 0x0b, 0x54, 0xff, 0xe7, 0x5c, 0xea, 0xff, 0xb5, 0x19, 0x3f, 0xff,
+    0x3b, 0xd0, 0x12, 0xff, 0x85, 0x79, 0x84, 0xff, 0x50, 0xf2, 0x21, 0xff,
+    0xeb, 0xb3, 0xa7, 0xff, 0xae, 0x1c, 0xd7, 0xff, 0xc7, 0x40, 0x11, 0xff,
+    0x15, 0xda, 0xaf, 0xff, 0xb5, 0x74, 0xc5, 0xff, 0x3e, 0x28, 0x41, 0xff,
+    0x7e, 0xce, 0xd1, 0xff, 0xf9, 0x5c, 0x10, 0xff, 0xc3, 0xf5, 0x63, 0xff,
+    0xaa, 0xc1, 0x9c, 0xff, 0x0d, 0x08, 0x58, 0xff, 0x1e, 0x45, 0xb3, 0xff,
+    0x7d, 0xb8, 0x1e, 0xff, 0x51, 0x5a, 0xa3, 0xff, 0xc1, 0x8b, 0x02, 0xff,
+    0x91, 0xb0, 0x4b, 0xff, 0xd0, 0x63, 0xae, 0xff, 0xff, 0xa2, 0x20, 0xff,
+    0x24, 0x16, 0x69, 0xff, 0xc8, 0xd6, 0xc1, 0xff, 0xa3, 0xa9, 0x04, 0xff,
+    0x0e, 0xf8, 0xf2, 0xff, 0x85, 0x6c, 0xcf, 0xff, 0x21, 0x18, 0xbe, 0xff,
+    0x7a, 0xad, 0x46, 0xff, 0x5c, 0x7a, 0xdc, 0xff, 0x8f, 0xdc, 0xb5, 0xff,
+    0x4f, 0x39, 0x55, 0xff, 0x87, 0xc1, 0x02, 0xff, 0xdf, 0x73, 0x8c, 0xff,
+    0x58, 0xfa, 0x7a, 0xff
+}};
 
 #endif /* BlueNoiseLUT_h */
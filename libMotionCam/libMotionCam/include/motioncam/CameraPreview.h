@@ -1,6 +1,8 @@
 #ifndef CameraPreview_hpp
 #define CameraPreview_hpp
 
+#include "motioncam/Types.h"
+
 #include <HalideBuffer.h>
 
 namespace motioncam {
@@ -14,13 +16,18 @@ namespace motioncam {
                              const int downscaleFactor,
                              const float shadingMapCorrection,
                              Halide::Runtime::Buffer<uint8_t>& inputBuffer,
-                             Halide::Runtime::Buffer<uint8_t>& outputBuffer);
+                             Halide::Runtime::Buffer<uint8_t>& outputBuffer,
+                             const bool zebraEnabled = false,
+                             const float zebraThreshold = 0.95f,
+                             const bool peakingEnabled = false,
+                             const float peakingThreshold = 0.2f);
 
         static void generate(const RawImageBuffer& rawBuffer,
                              const RawCameraMetadata& cameraMetadata,
                              const int downscaleFactor,
                              const float shadingMapCorrection,
                              const bool flipped,
+                             const ScreenOrientation orientation,
                              const float shadows,
                              const float contrast,
                              const float saturation,
@@ -30,7 +37,15 @@ namespace motioncam {
                              const float tintOffset,
                              const float tonemapVariance,
                              Halide::Runtime::Buffer<uint8_t>& inputBuffer,
-                             Halide::Runtime::Buffer<uint8_t>& outputBuffer);
+                             Halide::Runtime::Buffer<uint8_t>& outputBuffer,
+                             const float temporalBlend = 0.0f,
+                             const int motionX = 0,
+                             const int motionY = 0,
+                             Halide::Runtime::Buffer<uint8_t>* previousOutputBuffer = nullptr,
+                             const bool zebraEnabled = false,
+                             const float zebraThreshold = 0.95f,
+                             const bool peakingEnabled = false,
+                             const float peakingThreshold = 0.2f);
     };
 }
 
@@ -32,6 +32,10 @@ namespace motioncam {
     private:
         static cv::Mat normalizeForwardMatrix(const cv::Mat& forwardMatrix);
         static cv::Mat normalizeColorMatrix(const cv::Mat& colorMatrix);
+
+        // Cheap identity of the matrices this profile was built from, used
+        // to key the solved temperature cache
+        int fingerprint() const;
         
         XYCoord cameraNeutralToXy(const cv::Vec3f& cameraNeutralVector) const;
         cv::Mat findXyzToCamera(const XYCoord& white, cv::Mat* outForwardMatrix, cv::Mat* outCameraCalibration) const;
@@ -3,6 +3,8 @@
 
 #include "Types.h"
 
+#include <stdint.h>
+
 namespace motioncam {
     namespace color {
         extern const XYCoord D50XYCoord;
@@ -27,6 +29,23 @@ namespace motioncam {
         std::string IlluminantToString(const Illuminant illuminant);
         Illuminant IlluminantFromString(const std::string& illuminant);
         float IlluminantToTemperature(const Illuminant illuminant);
+
+        //
+        // Baked sRGB transfer function tables. The powf based curves run
+        // only when the tables are built; the scalar paths outside the
+        // Halide pipelines (thumbnails, estimation helpers) index these
+        // per pixel instead.
+        //
+
+        const int TRANSFER_LUT_SIZE = 4096;
+
+        // Interpolated lookups over linear/encoded values in [0..1]
+        float LinearToSRGB(const float linear);
+        float SRGBToLinear(const float srgb);
+
+        // Table mapping linear [0..1], scaled by TRANSFER_LUT_SIZE-1, to the
+        // 8 bit encoded value. For inner loops that write bytes directly.
+        const uint8_t* LinearToSRGB8Table();
     }
 }
 
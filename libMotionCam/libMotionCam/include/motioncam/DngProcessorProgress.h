@@ -4,6 +4,41 @@
 #include <string>
 
 namespace motioncam {
+    // Stages of the export pipeline, as reported by the throughput model.
+    // LOAD covers reading, decoding and merging a frame on the admission
+    // thread; WRITE covers the DNG encode and file write on the task
+    // engine.
+    enum class DngExportStage : int {
+        NONE = 0,
+        LOAD,
+        WRITE
+    };
+
+    // Export throughput statistics, published periodically alongside the
+    // progress percentage so batch tooling can schedule on real numbers
+    // instead of watching output file timestamps.
+    struct DngExportStats {
+        // Frames per second over the recent window and since the export
+        // started
+        float instantFps;
+        float averageFps;
+
+        // Estimated seconds to completion; negative while there is no
+        // estimate yet
+        float etaSeconds;
+
+        int completedFrames;
+        int totalFrames;
+
+        // Share of the recent window each stage spent busy, normalized by
+        // the number of workers serving it. The stage closest to
+        // saturation is reported as the bottleneck.
+        float loadUtilization;
+        float writeUtilization;
+
+        DngExportStage bottleneck;
+    };
+
     class DngProcessorProgress {
     public:
 #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
@@ -15,6 +50,11 @@ namespace motioncam {
         virtual void onAttemptingRecovery() = 0;
         virtual void onCompleted() = 0;
         virtual void onError(const std::string& error) = 0;
+
+        // Throughput statistics for the running export. The default does
+        // nothing so listeners that only care about the percentage stay
+        // unchanged.
+        virtual void onStatsUpdate(const DngExportStats& stats) {}
     };
 }
 
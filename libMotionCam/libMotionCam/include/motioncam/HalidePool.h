@@ -0,0 +1,30 @@
+#ifndef HalidePool_hpp
+#define HalidePool_hpp
+
+#include <stddef.h>
+
+namespace motioncam {
+    namespace halidepool {
+        // The pool overrides the weak halide_malloc/halide_free symbols in
+        // the Halide runtime, so repeated pipeline invocations reuse their
+        // internal temporaries instead of hitting the system allocator.
+        //
+        // Install() is a no-op; calling it from an always-linked translation
+        // unit forces the linker to pull in the overrides from this object
+        // when building against the static library.
+        void Install();
+
+        // Pool-backed allocation entry points, matching the signatures
+        // Halide::Runtime::Buffer::allocate() accepts. Pipeline output and
+        // working buffers allocate through these so a video export hands
+        // out recycled, already faulted-in blocks across frames instead of
+        // paying allocation and first-touch cost per call.
+        void* PoolMalloc(const size_t size);
+        void PoolFree(void* ptr);
+
+        // Total bytes currently cached across all thread pools
+        size_t CachedBytes();
+    }
+}
+
+#endif /* HalidePool_hpp */
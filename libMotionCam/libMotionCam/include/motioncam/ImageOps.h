@@ -10,9 +10,10 @@
 namespace motioncam {
     
     float estimateNoise(cv::Mat& input, float p=0.5f);
-    
+
+    // Both variants partially sort their input in place instead of copying it
     float findMedian(cv::Mat& input, float p=0.5f);
-    float findMedian(std::vector<float> nums);
+    float findMedian(std::vector<float>& nums);
     
     float calculateEnergy(cv::Mat& image);
 
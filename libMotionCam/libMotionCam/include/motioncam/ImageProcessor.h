@@ -50,12 +50,49 @@ namespace motioncam {
     
     class ImageProcessor {
     public:
+        // Selects the wide schedule variants of the postprocess pipeline,
+        // tuned for parts where the default schedules leave cores idle.
+        // Callers pick by device profile; off by default.
+        static void setUseWideSchedules(const bool enabled);
+
+        // Selects the OpenCL variants of the postprocess pipeline, which
+        // run the demosaic and guided filter stages on the GPU. Callers
+        // enable it after probing for a usable OpenCL driver; off by
+        // default.
+        static void setUseGpuPostProcess(const bool enabled);
+
+        // Stores the denoise wavelet pyramid as float16 instead of float32.
+        // Computation stays in float32. Callers enable it on parts with
+        // hardware float16 conversions; off by default.
+        static void setUseFp16Wavelets(const bool enabled);
+
+        // Runs the wavelet denoise in overlapping stripes of the given row
+        // count, trading a small halo recompute for a bounded scratch
+        // pyramid instead of a full frame one. Callers enable it on memory
+        // constrained devices; 0 (the default) keeps the full frame pass.
+        static void setDenoiseStripeRows(const int rows);
+
+        // Fuses this many frames per invocation of the temporal merge
+        // kernel instead of one, cutting the accumulator traffic by the
+        // batch size at the cost of keeping the batch of deinterleaved
+        // frames resident. 0 (the default) keeps the per frame merge.
+        static void setFuseBatchFrames(const int frames);
+
         static void process(const std::string& inputPath,
                             const std::string& outputPath,
                             const ImageProcessorProgress& progressListener);
 
         static void process(RawContainer& rawContainer, const std::string& outputPath, const ImageProcessorProgress& progressListener);
 
+        static void process(RawContainer& rawContainer,
+                            const std::string& outputPath,
+                            const ImageProcessorProgress& progressListener,
+                            PostProcessSettings* burstSettings);
+
+        static void processBurst(const std::vector<std::string>& inputPaths,
+                                 const std::vector<std::string>& outputPaths,
+                                 const ImageProcessorProgress& progressListener);
+
         static Halide::Runtime::Buffer<uint8_t> createPreview(const RawImageBuffer& rawBuffer,
                                                               const int downscaleFactor,
                                                               const RawCameraMetadata& cameraMetadata,
@@ -66,6 +103,15 @@ namespace motioncam {
                                                                   const int sy,
                                                                   const RawCameraMetadata& cameraMetadata);
 
+        // Variant for preview loops. The output is rendered into the given
+        // buffer, which is only reallocated when its extents don't match, so
+        // callers can recycle the multi-MB RGBA output across frames.
+        static void createFastPreview(const RawImageBuffer& rawBuffer,
+                                      const int sx,
+                                      const int sy,
+                                      const RawCameraMetadata& cameraMetadata,
+                                      Halide::Runtime::Buffer<uint8_t>& outputBuffer);
+
         static Halide::Runtime::Buffer<uint8_t> createFastPreview(std::vector<Halide::Runtime::Buffer<uint16_t>>& inputBuffers,
                                                                   const int sx,
                                                                   const int sy,
@@ -81,6 +127,19 @@ namespace motioncam {
                                   Halide::Runtime::Buffer<uint8_t>& whiteLevelClipping,
                                   Halide::Runtime::Buffer<uint8_t>& blackLevelClipping);
 
+        // Renders the preview image, the luminance histogram and the
+        // clipping maps in a single traversal of the raw data, for callers
+        // that want all of them for the same frame. Output buffers are
+        // reused when their sizes already match.
+        static void generatePreviewStats(const RawImageBuffer& rawBuffer,
+                                         const int sx,
+                                         const int sy,
+                                         const RawCameraMetadata& cameraMetadata,
+                                         Halide::Runtime::Buffer<uint8_t>& outputBuffer,
+                                         Halide::Runtime::Buffer<uint32_t>& histogram,
+                                         Halide::Runtime::Buffer<uint8_t>& whiteLevelClipping,
+                                         Halide::Runtime::Buffer<uint8_t>& blackLevelClipping);
+
         static cv::Mat calcHistogram(const RawCameraMetadata& cameraMetadata,
                                      const RawImageBuffer& reference,
                                      const bool cumulative,
@@ -104,11 +163,30 @@ namespace motioncam {
         static const std::vector<float>& estimateDenoiseWeights(const float noise);
         
         static double measureSharpness(const RawCameraMetadata& cameraMetadata, const RawImageBuffer& rawBuffer);
+
+        // Tiled variance-of-gradient sharpness over a region of interest,
+        // given in normalised [0..1] frame coordinates. Only the green
+        // channel inside the ROI is unpacked, so this is cheap enough to
+        // call on every preview frame for focus assist. 'window' is the
+        // tile size in half resolution pixels.
+        static double measureSharpnessRoi(const RawCameraMetadata& cameraMetadata,
+                                          const RawImageBuffer& rawBuffer,
+                                          const float roiX,
+                                          const float roiY,
+                                          const float roiWidth,
+                                          const float roiHeight,
+                                          const int window=16);
+        // When subsampleRows is set the noise statistics are measured from
+        // a centered band of half the frame's rows, halving the kernel's
+        // work on a profile miss. Sensor noise is spatially uniform, so
+        // callers that only feed the estimate into denoise thresholds can
+        // subsample safely.
         static void measureNoise(const RawCameraMetadata& cameraMetadata,
                                  const RawImageBuffer& rawBuffer,
                                  std::vector<float>& outNoise,
                                  std::vector<float>& outSignal,
-                                 const int patchSize=8);
+                                 const int patchSize=8,
+                                 const bool subsampleRows=false);
 
         static cv::Mat registerImage(const Halide::Runtime::Buffer<uint8_t>& referenceBuffer,
                                      const Halide::Runtime::Buffer<uint8_t>& toAlignBuffer);
@@ -120,6 +198,20 @@ namespace motioncam {
                                                      const RawCameraMetadata& cameraMetadata,
                                                      const bool extendEdges=true,
                                                      const float scalePreview=1.0f);
+
+        // Variant for merge loops. The planes are rendered into rawData's
+        // existing buffers, which are only reallocated when their extents
+        // don't match, so callers can recycle the multi-MB outputs across
+        // frames.
+        static void loadRawImage(const RawImageBuffer& rawImage,
+                                 const RawCameraMetadata& cameraMetadata,
+                                 RawData& rawData,
+                                 const bool extendEdges=true,
+                                 const float scalePreview=1.0f);
+
+        // Releases the per-frame planes cached for the export's sliding
+        // merge window. Called by the export once it finishes.
+        static void clearRawImageCache();
         
         static void createSrgbMatrix(const RawCameraMetadata& cameraMetadata,
                                      const RawImageMetadata& rawImageMetadata,
@@ -159,6 +251,17 @@ namespace motioncam {
                                     const PostProcessSettings& settings,
                                     const std::string& inputOutput);
 
+        // Variant operating on an in-memory encoded image. The metadata is
+        // inserted into the encoded bytes and the result written to
+        // outputPath in a single pass, instead of writing the image and then
+        // rewriting the whole file to add the EXIF block.
+        static void addExifMetadata(const RawImageMetadata& metadata,
+                                    const std::vector<uint8_t>& encodedImage,
+                                    const cv::Mat& thumbnail,
+                                    const RawCameraMetadata& cameraMetadata,
+                                    const PostProcessSettings& settings,
+                                    const std::string& outputPath);
+
         static cv::Mat postProcess(std::vector<Halide::Runtime::Buffer<uint16_t>>& inputBuffers,
                                    const std::shared_ptr<HdrMetadata>& hdrMetadata,
                                    int offsetX,
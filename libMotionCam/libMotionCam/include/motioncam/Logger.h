@@ -2,12 +2,51 @@
 #define Logger_hpp
 
 #include <string>
+#include <atomic>
+#include <cstdint>
+
+// Compiled-in log level. Statements below the level compile away entirely,
+// including their argument expressions, so hot paths never pay for string
+// formatting that would be discarded.
+//   0 = debug, 1 = info, 2 = off
+#ifndef MOTIONCAM_LOG_LEVEL
+    #ifdef NDEBUG
+        #define MOTIONCAM_LOG_LEVEL 1
+    #else
+        #define MOTIONCAM_LOG_LEVEL 0
+    #endif
+#endif
 
 namespace motioncam {
     namespace logger {
         void log(const std::string& str);
         void debug(const std::string& str);
+
+        // True at most once per intervalMs per call site. lastLogMs holds the
+        // time of the last accepted log; see LOG_INFO_EVERY_MS.
+        bool shouldLog(std::atomic<int64_t>& lastLogMs, const int64_t intervalMs);
     }
 }
 
+#if MOTIONCAM_LOG_LEVEL <= 0
+    #define LOG_DEBUG(expr) ::motioncam::logger::debug((expr))
+#else
+    #define LOG_DEBUG(expr) do { } while(false)
+#endif
+
+#if MOTIONCAM_LOG_LEVEL <= 1
+    #define LOG_INFO(expr) ::motioncam::logger::log((expr))
+
+    // For per-frame sites: logs at most once per intervalMs
+    #define LOG_INFO_EVERY_MS(intervalMs, expr)                                     \
+        do {                                                                        \
+            static std::atomic<int64_t> logger_lastLogMs(0);                        \
+            if(::motioncam::logger::shouldLog(logger_lastLogMs, (intervalMs)))      \
+                ::motioncam::logger::log((expr));                                   \
+        } while(false)
+#else
+    #define LOG_INFO(expr) do { } while(false)
+    #define LOG_INFO_EVERY_MS(intervalMs, expr) do { } while(false)
+#endif
+
 #endif /* Logger_hpp */
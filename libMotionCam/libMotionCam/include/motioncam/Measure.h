@@ -5,7 +5,11 @@
 #include <string>
 
 namespace motioncam {
-    
+
+    // Scoped trace point. Records a complete event covering the enclosing
+    // scope on the calling thread's trace buffer (see Trace.h). Costs one
+    // atomic load when tracing is disabled, so instances stay in the hot
+    // paths of production builds.
     class Measure {
     public:
         Measure(std::string  reference);
@@ -11,6 +11,7 @@
 namespace motioncam {
     class RawContainer;
     struct Impl;
+    struct Job;
 
     const std::vector<float> NO_DENOISE_WEIGHTS = { 0, 0, 0, 0 };
 
@@ -19,6 +20,88 @@ namespace motioncam {
         MotionCam();
         ~MotionCam();
 
+        // Sets the maximum number of bytes of in-flight export jobs. The
+        // export pipeline stops admitting new frames once the budget is
+        // reached and resumes as the writer threads drain.
+        void setExportMemoryBudget(const size_t memoryBudgetBytes);
+
+        // Journals the frame numbers of completed DNGs to the given path,
+        // appending each one after its file is on disk. When the journal
+        // already exists, the frames it lists are skipped on the next
+        // conversion - no decode, no write - so an export killed at 95%
+        // resumes from where it died instead of starting over. One journal
+        // covers one clip; callers remove it once the export completes.
+        // An empty path (the default) disables journaling.
+        void setExportResumeJournal(const std::string& path);
+
+        // Paces the export pipeline. At 1 frames are admitted as fast as the
+        // memory budget allows; lower values insert idle time between frames
+        // so a thermally limited device settles at a rate it can hold.
+        // Safe to call from another thread while a conversion runs.
+        static void SetExportThrottle(const float throttle);
+
+        // Pins compute threads (Halide workers, compression, processing
+        // tasks) to the performance cores and IO threads to the efficiency
+        // cores on asymmetric parts, so demosaic kernels stop migrating to
+        // the little cores mid-frame. Off by default; a no-op on devices
+        // where every core is the same.
+        static void SetThreadAffinity(const bool enabled);
+
+        // Selects the wide Halide schedule variants, tuned for SoCs with
+        // many mid cores (1+4+3 style parts) where the default schedules
+        // leave half the cores idle through the demosaic stages. The app
+        // layer picks by device profile; off by default.
+        static void SetWideSchedules(const bool enabled);
+
+        // Runs the demosaic and guided filter stages of the postprocess
+        // pipeline on the GPU through Halide's OpenCL backend, freeing the
+        // CPU cores for the tonemap and denoise stages that stay there.
+        // The app layer enables it after probing for a usable OpenCL
+        // driver; off by default so devices without one never load the
+        // GPU backend.
+        static void SetGpuPostProcess(const bool enabled);
+
+        // Stores the intermediates of the denoise stage in half precision,
+        // halving its memory footprint and bandwidth. Computation stays in
+        // float32 so only the rounding of the stored coefficients changes.
+        // The app layer enables it on devices with hardware float16
+        // conversions; off by default.
+        static void SetFp16Wavelets(const bool enabled);
+
+        // Runs the spatial denoise wavelet in overlapping stripes of the
+        // given row count instead of over the whole frame, trading a small
+        // halo recompute for a bounded scratch pyramid. The app layer
+        // enables it on memory constrained devices where 4K exports
+        // otherwise risk the OOM killer; 0 (the default) keeps the full
+        // frame pass.
+        static void SetDenoiseStripeRows(const int rows);
+
+        // Fuses this many frames per invocation of the temporal merge
+        // kernel during exports, so the full frame accumulator is read and
+        // written once per batch instead of once per frame. Costs an extra
+        // batch - 1 deinterleaved frames of memory while merging, so the
+        // app layer sizes it from the device memory profile; 0 (the
+        // default) keeps the per frame merge.
+        static void SetFuseBatchFrames(const int frames);
+
+        // Collects begin/end events from the trace points across the
+        // pipeline (capture, streaming, container I/O, processing) into
+        // per-thread ring buffers. Off by default; a disabled trace point
+        // costs one atomic load, so tracing can be switched on against a
+        // production recording. Retrieve the result with DumpTrace().
+        static void SetTracing(const bool enabled);
+
+        // Returns the buffered trace events as chrome://tracing / perfetto
+        // compatible JSON and clears the buffers
+        static std::string DumpTrace();
+
+        // Writes streamed recordings through O_DIRECT with aligned staging
+        // buffers instead of the page cache, so sustained 4K recording
+        // doesn't evict the preview and processing working set. The app
+        // layer enables it per device; recordings fall back to buffered
+        // writes when the filesystem rejects direct I/O. Off by default.
+        static void SetDirectIo(const bool enabled);
+
         void convertVideoToDNG(std::vector<std::unique_ptr<RawContainer> >& containers,
                                DngProcessorProgress& progress,
                                const std::vector<float>& denoiseWeights,
@@ -55,8 +138,21 @@ namespace motioncam {
                                const int toFrameNumber=-1,
                                const bool autoRecover=true);
 
+        // Converts a batch of clips while keeping the writer threads alive
+        // between clips. Each clip gets its own progress listener.
+        void convertVideosToDNG(const std::vector<std::vector<std::string>>& batchInputPaths,
+                                const std::vector<DngProcessorProgress*>& progress,
+                                const std::vector<float>& denoiseWeights,
+                                const int numThreads=4,
+                                const int mergeFrames=0,
+                                const bool enableCompression=true,
+                                const bool applyShadingMap=true,
+                                const bool noClipShadingMap=true,
+                                const bool autoRecover=true);
+
         static void ProcessImage(RawContainer& rawContainer, const std::string& outputFilePath, const ImageProcessorProgress& progressListener);
         static void ProcessImage(const std::string& containerPath, const std::string& outputFilePath, const ImageProcessorProgress& progressListener);
+        static void ProcessImages(const std::vector<std::string>& containerPaths, const std::vector<std::string>& outputFilePaths, const ImageProcessorProgress& progressListener);
 
         static bool GetMetadata(const std::string& filename,
                                 float& outDurationMs,
@@ -87,8 +183,76 @@ namespace motioncam {
             int& outNumSegments,
             int& outDroppedFrames);
 
+        static bool GetMetadata(
+            const std::vector<RawContainer*>& containers,
+            float& outDurationMs,
+            float& outFrameRate,
+            int& outNumFrames,
+            int& outNumSegments,
+            int& outDroppedFrames);
+
+        // Rewrites a legacy (v1) container into the current container format.
+        // Frames stream through the writer in small batches, decoded in
+        // parallel, so memory stays bounded regardless of clip length.
+        // Returns false and fills outError on failure.
+        static bool MigrateContainer(const std::string& inputPath,
+                                     const std::string& outputPath,
+                                     std::string& outError);
+
+        // Generates the quarter resolution proxy track for a committed
+        // container, so the review UI scrubs from small decoded frames and
+        // the raw decode path is only exercised on export. Frames render as
+        // background tasks on the shared task engine, so a running capture
+        // or export takes priority. A no-op when the container already
+        // carries a proxy track. Returns false and fills outError on
+        // failure.
+        static bool GenerateProxyTrack(const std::string& containerPath, std::string& outError);
+
+        // Runs convertVideoToDNG over a sweep of worker counts, merge
+        // window sizes and compression settings against one clip, and
+        // returns a json report with frames per second, peak resident set
+        // size and the per stage utilization of each configuration. Export
+        // farms size their per device worker counts from the report instead
+        // of trial and error. Every DNG is written over scratchPath, which
+        // is removed afterwards; empty sweep vectors fall back to a default
+        // sweep.
+        static std::string RunExportBenchmark(const std::vector<std::string>& containerPaths,
+                                              const std::string& scratchPath,
+                                              const std::vector<int>& numThreadsSweep={},
+                                              const std::vector<int>& mergeFramesSweep={});
+
+        // Deterministic frame partition for sharded exports. Opens the
+        // container segments index-only (no frame data, no camera metadata
+        // parse), orders the frames the same way convertVideoToDNG() does,
+        // and returns the inclusive range shard shardIndex of shardCount
+        // should pass as fromFrameNumber/toFrameNumber. The shards cover
+        // every frame exactly once and outputs are keyed by the global
+        // frame number, so shards running on different machines produce
+        // disjoint files with no merge step. Returns false and fills
+        // outError on bad inputs, corrupted containers or an empty shard.
+        static bool GetShardRange(const std::vector<std::string>& containerPaths,
+                                  const int shardIndex,
+                                  const int shardCount,
+                                  int& outFromFrame,
+                                  int& outToFrame,
+                                  std::string& outError);
+
     private:
-        void writeDNG();
+        void writeDNG(Job& job);
+
+        // Processes a single clip. DNG writes are scheduled as export tasks
+        // on the shared task engine.
+        void processContainers(std::vector<std::unique_ptr<RawContainer>>& containers,
+                               DngProcessorProgress& progress,
+                               const std::vector<float>& denoiseWeights,
+                               const int numThreads,
+                               const int mergeFrames,
+                               const bool enableCompression,
+                               const bool applyShadingMap,
+                               const bool noClipShadingMap,
+                               const int fromFrameNumber,
+                               const int toFrameNumber,
+                               const bool autoRecover);
 
     private:
         std::unique_ptr<Impl> mImpl;
@@ -1,10 +1,42 @@
 #ifndef NativeBuffer_h
 #define NativeBuffer_h
 
+#include "motioncam/HalidePool.h"
+
+#include <cstring>
+#include <memory>
 #include <vector>
 #include <stdint.h>
 
+#if defined(__ANDROID__) || defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
 namespace motioncam {
+    // Ask the kernel to back large host buffers with transparent huge pages.
+    // Full frame buffers span thousands of 4KB pages and the TLB misses show
+    // up in profiles of the full-frame kernels on export machines.
+    inline void AdviseHugePages(uint8_t* data, size_t len) {
+#if (defined(__ANDROID__) || defined(__linux__)) && defined(MADV_HUGEPAGE)
+        const size_t MinHugePageSize = 2 * 1024 * 1024;
+        if(!data || len < MinHugePageSize)
+            return;
+
+        // madvise() needs a page aligned range. Align inwards and let the
+        // unaligned edges stay on normal pages.
+        const uintptr_t pageSize = 4096;
+
+        uintptr_t start = (reinterpret_cast<uintptr_t>(data) + pageSize - 1) & ~(pageSize - 1);
+        uintptr_t end = (reinterpret_cast<uintptr_t>(data) + len) & ~(pageSize - 1);
+
+        if(end > start)
+            madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE);
+#else
+        (void) data;
+        (void) len;
+#endif
+    }
+
     class NativeBuffer {
     public:
         NativeBuffer() : mValidStart{0}, mValidEnd{0} {
@@ -16,6 +48,7 @@ namespace motioncam {
         virtual void unlock() = 0;
         virtual uint64_t nativeHandle() = 0;
         virtual size_t len() = 0;
+        virtual void allocate(size_t len) = 0;
         virtual const std::vector<uint8_t>& hostData() = 0;
         virtual void copyHostData(const std::vector<uint8_t>& data) = 0;
         virtual void release() = 0;
@@ -43,32 +76,49 @@ namespace motioncam {
         size_t mValidEnd;
     };
 
+    // Host frame storage on the per-thread size-class pool. A session's
+    // frames come in a handful of sizes, so allocations hand back already
+    // faulted-in blocks in O(1) instead of paying allocation and
+    // first-touch faults per frame - the multi-ms spikes previously seen
+    // on the first frames after a resolution switch.
     class NativeHostBuffer : public NativeBuffer {
     public:
-        NativeHostBuffer()
+        NativeHostBuffer() : mData(nullptr), mLen(0), mCapacity(0)
+        {
+        }
+
+        NativeHostBuffer(size_t length) : mData(nullptr), mLen(0), mCapacity(0)
         {
+            allocate(length);
         }
 
-        NativeHostBuffer(size_t length) : data(length)
+        NativeHostBuffer(const std::vector<uint8_t>& other) : mData(nullptr), mLen(0), mCapacity(0)
         {
+            allocate(other.size());
+
+            if(mData)
+                std::memcpy(mData, other.data(), other.size());
         }
 
-        NativeHostBuffer(const std::vector<uint8_t>& other) : data(other)
+        NativeHostBuffer(const uint8_t* other, size_t len) : mData(nullptr), mLen(0), mCapacity(0)
         {
+            allocate(len);
+
+            if(mData)
+                std::memcpy(mData, other, len);
         }
 
-        NativeHostBuffer(const uint8_t* other, size_t len)
+        ~NativeHostBuffer()
         {
-            data.resize(len);
-            data.assign(other, other + len);
+            halidepool::PoolFree(mData);
         }
 
         std::unique_ptr<NativeBuffer> clone() {
-            return std::unique_ptr<NativeHostBuffer>(new NativeHostBuffer(data));
+            return std::unique_ptr<NativeHostBuffer>(new NativeHostBuffer(mData, mLen));
         }
 
         uint8_t* lock(bool write) {
-            return data.data();
+            return mData;
         }
         
         void unlock() {
@@ -79,36 +129,62 @@ namespace motioncam {
         }
         
         size_t len() {
-            return data.size();
+            return mLen;
         }
         
         void allocate(size_t len) {
-            data.resize(len);
+            // Growing within the block the pool handed out is free; the
+            // pool rounds to its size class, so repeated reads of slightly
+            // different frame sizes settle on one block
+            if(len > mCapacity) {
+                halidepool::PoolFree(mData);
+
+                mData = static_cast<uint8_t*>(halidepool::PoolMalloc(len));
+                mCapacity = mData ? len : 0;
+
+                AdviseHugePages(mData, len);
+            }
+
+            mLen = mData ? len : 0;
         }
         
         const std::vector<uint8_t>& hostData()
         {
-            return data;
+            // Compatibility shim for the vector based interface; nothing on
+            // a hot path calls this
+            mHostData.assign(mData, mData + mLen);
+
+            return mHostData;
         }
         
         void copyHostData(const std::vector<uint8_t>& other)
         {
-            data = std::move(other);
+            allocate(other.size());
+
+            if(mData)
+                std::memcpy(mData, other.data(), other.size());
         }
         
         void release()
         {
-            data.resize(0);
-            data.shrink_to_fit();
+            halidepool::PoolFree(mData);
+
+            mData = nullptr;
+            mLen = 0;
+            mCapacity = 0;
         }
 
         void shrink(size_t newSize)
         {
-            data.resize(newSize);
+            if(newSize <= mCapacity)
+                mLen = newSize;
         }
 
     private:
-        std::vector<uint8_t> data;
+        uint8_t* mData;
+        size_t mLen;
+        size_t mCapacity;
+        std::vector<uint8_t> mHostData;
     };
 
 } // namespace motioncam
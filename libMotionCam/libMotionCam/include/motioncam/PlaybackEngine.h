@@ -0,0 +1,121 @@
+#ifndef PlaybackEngine_hpp
+#define PlaybackEngine_hpp
+
+#include "motioncam/Util.h"
+
+#include <queue/blockingconcurrentqueue.h>
+#include <HalideBuffer.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace motioncam {
+    class RawContainer;
+    class RawContainerReader;
+    struct RawImageBuffer;
+
+    class PlaybackListener {
+    public:
+        // Called from the pacer thread with the rendered RGBA frame. The
+        // buffer is recycled once this returns, so implementations must copy
+        // or display it before returning.
+        virtual void onFrameReady(const Halide::Runtime::Buffer<uint8_t>& frame,
+                                  const int frameNumber,
+                                  const int64_t timestampNs) = 0;
+
+        virtual void onPlaybackEnded() = 0;
+        virtual void onError(const std::string& error) = 0;
+    };
+
+    // Real time playback over container files. Frames are loaded and
+    // decoded ahead of the playhead by a pool of worker threads, rendered
+    // through the fast preview pipeline, and delivered to the listener in
+    // presentation order by a fixed latency pacer driven by the recorded
+    // frame timestamps. Decode runs a bounded distance ahead of the pacer
+    // so memory stays constant regardless of clip length.
+    class PlaybackEngine {
+    public:
+        PlaybackEngine(std::vector<std::unique_ptr<RawContainer>> containers,
+                       PlaybackListener& listener,
+                       const int downscale=2,
+                       const int numThreads=4);
+
+        ~PlaybackEngine();
+
+        PlaybackEngine(const PlaybackEngine&) = delete;
+        PlaybackEngine& operator=(const PlaybackEngine&) = delete;
+
+        void play();
+        void pause();
+
+        // Moves the playhead. While paused the target frame is still decoded
+        // and delivered once, so scrubbing updates the display.
+        void seek(const int frameNumber);
+
+        bool isPlaying() const;
+        int numFrames() const;
+        float frameRate() const;
+
+    private:
+        // A rendered frame waiting for its presentation time. Frames decoded
+        // before a seek carry a stale generation and are discarded by the
+        // pacer.
+        struct DecodedFrame {
+            int generation;
+            int frameIdx;
+            int64_t timestampNs;
+            Halide::Runtime::Buffer<uint8_t> image;
+        };
+
+        void doDecode();
+        void doPace();
+
+        void recycle(Halide::Runtime::Buffer<uint8_t>& image);
+        void present(DecodedFrame& frame);
+
+        int playbackDownscale() const;
+        void updateLod(const double renderTimeMs);
+
+    private:
+        PlaybackListener& mListener;
+        const int mDownscale;
+
+        std::vector<std::unique_ptr<RawContainer>> mContainers;
+        std::vector<std::unique_ptr<RawContainerReader>> mReaders;
+        util::FrameTimeline mTimeline;
+        float mFrameRate;
+
+        std::atomic<bool> mRunning;
+        std::atomic<bool> mPlaying;
+        std::atomic<int> mGeneration;
+        std::atomic<int> mNextDecodeIdx;
+        std::atomic<int> mPresentedIdx;
+        std::atomic<bool> mPresentWhilePaused;
+
+        // Level of detail state for real time playback. The decode threads
+        // track a moving average of the render time and step the preview
+        // downscale up or down a ladder so a throttled device loses
+        // resolution instead of frame rate. Paused scrubbing always renders
+        // at the requested downscale.
+        std::atomic<int> mLodLevel;
+        std::atomic<float> mRenderTimeEwmaMs;
+        std::atomic<int> mLodDwell;
+
+        // Guards frame index claims against seeks. Containers without a
+        // concurrent read session serialize their loads on mLoadMutex.
+        std::mutex mDecodeMutex;
+        std::mutex mLoadMutex;
+
+        std::vector<std::unique_ptr<std::thread>> mDecodeThreads;
+        std::unique_ptr<std::thread> mPacerThread;
+
+        moodycamel::BlockingConcurrentQueue<DecodedFrame> mDecodedFrames;
+        moodycamel::ConcurrentQueue<Halide::Runtime::Buffer<uint8_t>> mFreeOutputs;
+    };
+}
+
+#endif /* PlaybackEngine_hpp */
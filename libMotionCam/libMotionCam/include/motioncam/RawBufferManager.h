@@ -2,10 +2,14 @@
 #define RawBufferManager_hpp
 
 #include "motioncam/RawImageMetadata.h"
+#include "motioncam/RawCameraMetadata.h"
 #include "motioncam/RawBufferStreamer.h"
 
 #include <queue/concurrentqueue.h>
+#include <queue/blockingconcurrentqueue.h>
+#include <atomic>
 #include <set>
+#include <thread>
 #include <vector>
 #include <memory>
 #include <mutex>
@@ -13,6 +17,41 @@
 namespace motioncam {
     class RawContainer;
     class AudioInterface;
+    class RawBufferSpill;
+
+    // One call snapshot of the recording pipeline for app side telemetry.
+    // The underlying counters are maintained with relaxed atomics on the
+    // capture and streaming threads, so a dropped frame in the field can be
+    // attributed to a stage instead of guessed at.
+    struct RecordingStats {
+        // Buffer pool
+        size_t memoryUseBytes;
+        int numBuffers;
+
+        float fps;
+        size_t outputSizeBytes;
+
+        // Queue depths, current and high water
+        size_t unprocessedQueueDepth;
+        size_t maxUnprocessedQueueDepth;
+        size_t readyQueueDepth;
+        size_t maxReadyQueueDepth;
+
+        // Mean per stage latencies in microseconds: the capture copy, the
+        // crop/bin/compress pass and the storage write
+        float copyTimeUs;
+        float processTimeUs;
+        float writeTimeUs;
+
+        // Drops by reason. No free buffer means the pool was exhausted on
+        // the capture side; the streamer drops when the network sink is
+        // behind with no local fallback.
+        int droppedNoBuffer;
+        int droppedStreamer;
+
+        uint64_t writtenFrames;
+        uint64_t writtenBytes;
+    };
 
     class RawBufferManager {
     public:
@@ -40,8 +79,25 @@ namespace motioncam {
         };
         
         void addBuffer(std::shared_ptr<RawImageBuffer>& buffer);
+
+        // Grows the pool to at least count host buffers of bufferSize bytes
+        // and writes every page, so recording starts with a fully resident
+        // pool instead of paying allocation and first-touch faults during
+        // the first seconds, while the encoder is also warming up. Call
+        // before recording starts; buffers the pool already holds count
+        // toward the target.
+        void warmUp(const size_t bufferSize, const int count);
+
         bool removeBuffer();
         void recordingStats(size_t& outMemoryUseBytes, float& outFps, size_t& outOutputSizeBytes);
+        void recordingStats(RecordingStats& outStats);
+
+        // Capture side instrumentation, called from the camera consumer
+        // threads. recordCopy() accumulates the time spent copying a frame
+        // out of the HAL buffer; recordCopyDrop() counts a frame dropped
+        // because no pool buffer was free.
+        void recordCopy(const int64_t copyTimeUs);
+        void recordCopyDrop();
         size_t memoryUseBytes() const;
         int numBuffers() const;
         void reset();
@@ -77,15 +133,70 @@ namespace motioncam {
                              const int audioFd,
                              std::shared_ptr<AudioInterface> audioInterface,
                              const int numThreads,
-                             const RawCameraMetadata& metadata);
+                             const RawCameraMetadata& metadata,
+                             const int preRollMs=0);
         
         void setCropAmount(int horizontal, int vertical);
         void setVideoBin(bool bin);
         void endStreaming();
         float bufferSpaceUse();
-        
+
+        // Spills ZSL history beyond the RAM watermark to a compressed ring
+        // file, stretching the capture history without growing the memory
+        // pool. Spilled frames are rehydrated by the consume methods.
+        void enableSpill(const std::string& spillPath,
+                         const size_t spillSizeBytes,
+                         const size_t ramWatermarkBytes);
+
+        void disableSpill();
+
     private:
         RawBufferManager();
+        ~RawBufferManager();
+
+        // A queued capture. The selected buffers stay checked out of the
+        // pools until the save worker has copied them into a container, or,
+        // for captures consumed in memory, until the consumer releases the
+        // container they were handed to.
+        struct SaveJob {
+            bool isHdr;
+            std::shared_ptr<const RawCameraMetadata> metadata;
+            PostProcessSettings settings;
+            int64_t referenceTimestampNs;
+            std::string outputPath;
+            std::vector<std::shared_ptr<RawImageBuffer>> buffers;
+        };
+
+        // A built container waiting for its disk write
+        struct PendingCommit {
+            std::unique_ptr<RawContainer> container;
+            std::string outputPath;
+        };
+
+        // An in-memory container waiting for the processing consumer. When
+        // the container shares its frames with the pool instead of owning
+        // copies, the shared buffers ride along so popPendingContainer() can
+        // hand them back once the consumer releases the container.
+        struct PendingContainer {
+            std::unique_ptr<RawContainer> container;
+            std::vector<std::shared_ptr<RawImageBuffer>> sharedBuffers;
+        };
+
+        void startSaveWorker();
+        void doSaveWork();
+
+        // Inserts a buffer into mReadyBuffers at its timestamp position.
+        // All paths that add to the ready list go through here, so lookups
+        // can binary search instead of scanning.
+        void insertReadyBuffer(const std::shared_ptr<RawImageBuffer>& buffer);
+
+        // Folds frames staged by enqueueReadyBuffer() into the ordered
+        // ready list and runs the spill watermark pass over the result.
+        // Requires mMutex to be held; every consumer of mReadyBuffers
+        // drains first so staged frames are never missed.
+        void drainIncomingBuffers();
+        void processSaveJob(SaveJob& job);
+        void writePendingCommit(PendingCommit& commit);
 
         int mHorizontalCrop;
         int mVerticalCrop;
@@ -93,15 +204,40 @@ namespace motioncam {
 
         std::atomic<size_t> mMemoryUseBytes;
         std::atomic<int> mNumBuffers;
+
+        // Capture side counters, relaxed; see recordCopy()/recordCopyDrop()
+        std::atomic<uint64_t> mCopyTimeUs;
+        std::atomic<uint64_t> mCopiedFrames;
+        std::atomic<int> mCopyDrops;
                 
         std::recursive_mutex mMutex;
-        
+
+        // Ordered by timestamp; maintained by insertReadyBuffer()
         std::vector<std::shared_ptr<RawImageBuffer>> mReadyBuffers;
 
+        // Frames handed over by the camera callback, folded into
+        // mReadyBuffers by drainIncomingBuffers(). Staging through a
+        // lock-free queue keeps the callback from blocking behind a
+        // consumer holding mMutex through a capture.
+        moodycamel::ConcurrentQueue<std::shared_ptr<RawImageBuffer>> mIncomingBuffers;
+
         moodycamel::ConcurrentQueue<std::shared_ptr<RawImageBuffer>> mUnusedBuffers;
-        moodycamel::ConcurrentQueue<std::unique_ptr<RawContainer>> mPendingContainers;
+        moodycamel::ConcurrentQueue<PendingContainer> mPendingContainers;
         
+        // Accessed with the std::atomic_load/atomic_store shared_ptr
+        // functions so the camera callback can route frames without mMutex
         std::shared_ptr<RawBufferStreamer> mStreamer;
+
+        std::shared_ptr<RawBufferSpill> mSpill;
+        size_t mSpillWatermarkBytes;
+
+        // Save worker. Capture jobs are drained ahead of the deferred disk
+        // commits so a burst never waits on housekeeping writes.
+        std::atomic<bool> mSaveWorkerRunning;
+        std::atomic<int> mInFlightSaves;
+        std::unique_ptr<std::thread> mSaveWorkerThread;
+        moodycamel::BlockingConcurrentQueue<SaveJob> mSaveJobs;
+        moodycamel::ConcurrentQueue<PendingCommit> mPendingCommits;
     };
 
 } // namespace motioncam
@@ -0,0 +1,89 @@
+#ifndef RawBufferSpill_hpp
+#define RawBufferSpill_hpp
+
+#include "motioncam/RawImageMetadata.h"
+
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <queue/blockingconcurrentqueue.h>
+
+namespace motioncam {
+    struct RawImageBuffer;
+
+    // Disk spill tier for the ZSL ring. Buffers evicted from the in-memory
+    // history are compressed on a worker thread, appended to a preallocated
+    // ring file and their backing memory is returned to the capture pool.
+    // When the ring file wraps, the oldest spilled frames are dropped.
+    class RawBufferSpill {
+    public:
+        RawBufferSpill(const std::string& path, const size_t maxSizeBytes);
+        ~RawBufferSpill();
+
+        RawBufferSpill(const RawBufferSpill&) = delete;
+        RawBufferSpill& operator=(const RawBufferSpill&) = delete;
+
+        bool isValid() const;
+
+        // Queues a buffer for spilling. Once written, the buffer is returned
+        // to the unused pool through RawBufferManager::discardBuffer().
+        void add(const std::shared_ptr<RawImageBuffer>& buffer);
+
+        // Reads a spilled frame back into a newly allocated buffer and
+        // removes it from the ring. Returns nullptr if the frame has been
+        // overwritten or was never spilled.
+        std::shared_ptr<RawImageBuffer> rehydrate(const int64_t timestampNs);
+
+        // Reads back all spilled frames, oldest first, and empties the ring
+        std::vector<std::shared_ptr<RawImageBuffer>> rehydrateAll();
+
+        void clear();
+
+        int numSpilledFrames();
+        size_t spilledBytes();
+
+    private:
+        // Descriptor of a spilled frame. Mirrors the RawImageBuffer fields
+        // that rehydration needs to rebuild the buffer.
+        struct SpilledFrame {
+            int64_t offset;
+            size_t size;
+
+            RawImageMetadata metadata;
+            PixelFormat pixelFormat;
+            int width;
+            int height;
+            int originalWidth;
+            int originalHeight;
+            bool isBinned;
+            int rowStride;
+            CompressionType compressionType;
+        };
+
+        void doSpill();
+        void writeFrame(const std::shared_ptr<RawImageBuffer>& buffer);
+        std::shared_ptr<RawImageBuffer> readFrame(const SpilledFrame& frame);
+
+    private:
+        FILE* mFile;
+        const size_t mMaxSizeBytes;
+
+        std::mutex mMutex;
+        std::deque<SpilledFrame> mFrames;
+        int64_t mHead;
+        std::atomic<size_t> mSpilledBytes;
+
+        std::atomic<bool> mRunning;
+        std::unique_ptr<std::thread> mSpillThread;
+
+        moodycamel::BlockingConcurrentQueue<std::shared_ptr<RawImageBuffer>> mPendingBuffers;
+    };
+}
+
+#endif /* RawBufferSpill_hpp */
@@ -7,6 +7,8 @@
 #include <memory>
 #include <vector>
 #include <thread>
+#include <atomic>
+#include <mutex>
 
 #include <queue/blockingconcurrentqueue.h>
 
@@ -15,46 +17,210 @@ namespace motioncam {
     struct RawImageBuffer;
     class AudioInterface;
 
+    // Per-fd IO statistics, recorded lock free from the IO threads
+    struct IoStreamStats {
+        static const int NUM_LATENCY_BUCKETS = 16;
+
+        IoStreamStats(const int fd);
+
+        const int fd;
+
+        // Histogram of write latencies. Bucket i counts writes that took
+        // [2^i, 2^(i+1)) microseconds.
+        std::atomic<uint64_t> latencyBuckets[NUM_LATENCY_BUCKETS];
+        std::atomic<uint64_t> maxLatencyUs;
+
+        // Set to the start time of an in-flight write, or 0 when idle. Used
+        // by the watchdog to detect stalled writes.
+        std::atomic<int64_t> writeStartTimeMs;
+
+        std::atomic<uint64_t> writtenFrames;
+        std::atomic<uint64_t> writtenBytes;
+
+        // Totals across all writes, for mean latency reporting
+        std::atomic<uint64_t> numWrites;
+        std::atomic<uint64_t> totalLatencyUs;
+
+        void recordWrite(const int64_t latencyUs);
+    };
+
+    // Result of the startup storage probe: sequential write throughput and
+    // worst chunk latency of a target fd, measured before recording starts
+    struct StorageProfile {
+        float sequentialMBps;
+        float maxWriteLatencyMs;
+    };
+
+    // One IO lane per container segment. Frames are dispatched to the lane
+    // with the least bytes queued or in flight, so a slow device (an SD
+    // card recording next to internal flash) fills its own lane and
+    // receives fewer frames instead of holding batches the other segments
+    // could have written.
+    struct IoLane {
+        IoLane();
+
+        moodycamel::BlockingConcurrentQueue<std::shared_ptr<RawImageBuffer>> queue;
+
+        // Bytes enqueued but not yet committed by the lane's IO thread
+        std::atomic<size_t> queuedBytes;
+    };
+
+    //
+    // Packet framing for the network sink. The stream starts with a
+    // CAMERA_METADATA packet, followed by one FRAME packet per captured
+    // frame and an END packet on a clean stop. The host side tool rebuilds
+    // a regular container from these records.
+    //
+
+    const uint32_t NET_PACKET_MAGIC = 0x4D43414D;
+
+    enum class NetPacketType : uint32_t {
+        CAMERA_METADATA,
+        FRAME,
+        END
+    };
+
+    // The header is followed by metadataSize bytes of json and payloadSize
+    // bytes of encoded frame data
+    struct NetPacketHeader {
+        uint32_t magic;
+        NetPacketType type;
+        uint32_t metadataSize;
+        uint32_t payloadSize;
+    };
+
     class RawBufferStreamer {
     public:
         RawBufferStreamer();
         ~RawBufferStreamer();
-        
+
         void start(const std::vector<int>& fds,
                    const int& audioFd,
                    const std::shared_ptr<AudioInterface>& audioInterface,
                    const int numThreads,
-                   const RawCameraMetadata& cameraMetadata);
-        
+                   const std::shared_ptr<const RawCameraMetadata>& cameraMetadata);
+
+        // Streams frames over a connected socket (TCP or USB-NCM) instead of
+        // local storage, for recording straight to a host machine. Frames
+        // divert to the fallback fds whenever the link can't keep up, and
+        // for the rest of the recording if the link dies.
+        void startNetworkStream(const int socketFd,
+                                const std::vector<int>& fallbackFds,
+                                const int& audioFd,
+                                const std::shared_ptr<AudioInterface>& audioInterface,
+                                const int numThreads,
+                                const std::shared_ptr<const RawCameraMetadata>& cameraMetadata);
+
         void add(const std::shared_ptr<RawImageBuffer>& frame);
         void stop();
         
         void setCropAmount(int width, int height);
         void setBin(bool bin);
+
+        // Measures the sequential write throughput and worst chunk latency
+        // of the storage behind fd. The probe data is truncated away and
+        // the descriptor rewound, so it is safe to run on a fresh recording
+        // fd. Returns false where the probe can't run.
+        static bool probeStorage(const int fd, StorageProfile& outProfile);
+
+        // Sizes the recording to the storage instead of the caller's
+        // defaults: start() probes the first fd, then picks how many of the
+        // provided segment fds to use and how many frames to coalesce per
+        // write. Off by default; only takes effect when set before start().
+        void setStorageAutoTune(const bool enabled);
         bool isRunning() const;
         float estimateFps() const;
         size_t writenOutputBytes() const;
         int droppedFrames() const;
 
+        // Frames diverted to local storage by the network sink
+        int fallbackFrames() const;
+
+        const std::vector<std::shared_ptr<IoStreamStats>>& ioStats() const;
+        size_t maxUnprocessedQueueDepth() const;
+        size_t maxReadyQueueDepth() const;
+
+        // Current queue depths and the accumulated crop/bin/compress time,
+        // for the recording stats snapshot
+        size_t unprocessedQueueDepth() const;
+        size_t readyQueueDepth() const;
+        void processStats(uint64_t& outTotalTimeUs, uint64_t& outFrames) const;
+
         void cropAndBin(RawImageBuffer& buffer) const;
         void crop(RawImageBuffer& buffer) const;
 
     private:
+        void startImpl(const std::vector<int>& fds,
+                       const int& audioFd,
+                       const std::shared_ptr<AudioInterface>& audioInterface,
+                       const int numThreads,
+                       const std::shared_ptr<const RawCameraMetadata>& cameraMetadata);
+
         void doProcess();
-        void doStream(const int fd, const RawCameraMetadata& cameraMetadata, const int numContainers);
-        
+        void dispatchFrame(const std::shared_ptr<RawImageBuffer>& buffer);
+        void doStream(const int fd, const std::shared_ptr<const RawCameraMetadata> cameraMetadata, const int numContainers, const std::shared_ptr<IoStreamStats> stats, const int laneIndex, const bool fallback, const bool muxAudio);
+        void doStreamNetwork(const int socketFd, const std::shared_ptr<const RawCameraMetadata> cameraMetadata, const std::shared_ptr<IoStreamStats> stats);
+        void doWatchdog();
+        void doAudioFlush(const int audioFd);
+
         void processBuffer(const std::shared_ptr<RawImageBuffer>& buffer) const;
-        
+
+        // Crops a frame by compacting the packed rows in place, without
+        // encoding it. The degraded path when compression can't keep up;
+        // returns false for payload formats it doesn't handle.
+        bool cropPassthrough(RawImageBuffer& buffer) const;
+
+        void captureThumbnail(const RawImageBuffer& buffer) const;
+
     private:
         std::shared_ptr<AudioInterface> mAudioInterface;
         int mAudioFd;
-        
+
+        // Captured audio, handed to the first IO thread on stop() so it is
+        // muxed into the container next to the frames. mAudioReady is set
+        // once the samples are final; the designated IO thread waits for it
+        // before committing its container.
+        bool mHaveAudio;
+        std::atomic<bool> mAudioReady;
+        std::vector<int16_t> mPendingAudioSamples;
+        int mPendingAudioSampleRate;
+        int mPendingAudioChannels;
+
         std::vector<std::unique_ptr<std::thread>> mIoThreads;
         std::vector<std::unique_ptr<std::thread>> mProcessThreads;
+        int mNumProcessThreads{1};
+        std::unique_ptr<std::thread> mWatchdogThread;
+
+        // Writes the side wav in large chunks while recording; joined by
+        // stop() after the final samples are published
+        std::unique_ptr<std::thread> mAudioFlushThread;
+
+        std::vector<std::shared_ptr<IoStreamStats>> mIoStats;
+
+        // Per segment dispatch lanes; empty in network mode where the ready
+        // queue feeds the network thread instead
+        std::vector<std::unique_ptr<IoLane>> mIoLanes;
+        std::atomic<size_t> mMaxUnprocessedQueueDepth;
+        std::atomic<size_t> mMaxReadyQueueDepth;
+
+        // Accumulated processing (crop/bin/compress) time, maintained with
+        // relaxed atomics on the process threads
+        std::atomic<uint64_t> mProcessTimeUs;
+        std::atomic<uint64_t> mProcessedFrames;
+
+        // Set by the process threads when compression falls behind the
+        // sensor; processBuffer() passes frames through uncompressed while
+        // it holds and compression resumes once the queue drains
+        std::atomic<bool> mPassthroughMode;
 
         int mCropHeight;
         int mCropWidth;
         bool mBin;
+
+        // Storage auto-tune state, resolved by startImpl() before the IO
+        // threads exist
+        bool mStorageAutoTune;
+        size_t mIoBatchSize;
         
         std::atomic<bool> mRunning;
         std::atomic<int> mWrittenFrames;
@@ -62,9 +228,35 @@ namespace motioncam {
         std::atomic<size_t> mWrittenBytes;
         std::atomic<int> mDroppedFrames;
         std::chrono::steady_clock::time_point mStartTime;
+
+        // Immutable snapshot of the camera metadata, shared wait free by the
+        // IO and process threads. A new recording publishes a new snapshot
+        // instead of mutating this one.
+        std::shared_ptr<const RawCameraMetadata> mCameraMetadata;
+
+        // Thumbnail and output size for the container summary, captured from
+        // the first processed frame
+        mutable std::mutex mThumbnailMutex;
+        mutable std::atomic<bool> mHaveThumbnail;
+        mutable std::vector<uint8_t> mThumbnailJpeg;
+        mutable std::atomic<int> mOutputWidth;
+        mutable std::atomic<int> mOutputHeight;
         
+        // Network sink state. mNetworkQueuedBytes counts processed frames
+        // queued behind the socket; past the send budget, new frames go to
+        // mFallbackBuffers and the local fallback containers instead.
+        int mSocketFd;
+        bool mHaveFallback;
+        std::atomic<bool> mNetworkMode;
+        std::atomic<bool> mNetworkFailed;
+        std::atomic<bool> mNetworkDone;
+        std::atomic<int> mFallbackFrames;
+        std::atomic<size_t> mNetworkQueuedBytes;
+        std::unique_ptr<std::thread> mNetworkThread;
+
         moodycamel::BlockingConcurrentQueue<std::shared_ptr<RawImageBuffer>> mUnprocessedBuffers;
         moodycamel::BlockingConcurrentQueue<std::shared_ptr<RawImageBuffer>> mReadyBuffers;
+        moodycamel::BlockingConcurrentQueue<std::shared_ptr<RawImageBuffer>> mFallbackBuffers;
     };
 }
 
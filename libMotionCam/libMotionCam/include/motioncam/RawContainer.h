@@ -4,6 +4,7 @@
 #include <string>
 #include <set>
 #include <map>
+#include <vector>
 
 #include <json11/json11.hpp>
 
@@ -11,8 +12,21 @@ namespace motioncam {
     struct RawImageBuffer;
     struct RawCameraMetadata;
     struct PostProcessSettings;
+    class RawContainerReader;
+    struct FrameRecord;
 
-    const uint8_t CONTAINER_VERSION = 2;
+    // Version 3 aligns frame payloads to 4KB so exports can read them with
+    // O_DIRECT and parallel pread. Version 4 stores per-frame lens shading
+    // maps as packed f16 records instead of json arrays. Version 5 writes a
+    // CRC32C of each frame payload so corrupted frames are detected on read
+    // instead of failing deep inside decode. Version 6 stores the per-frame
+    // metadata as a fixed binary record instead of json, keeping json for
+    // the container level metadata only. Version 7 checkpoints the frame
+    // index into the stream periodically so recovering an interrupted
+    // recording is a bounded tail scan instead of a full file scan.
+    // Version 2 files remain readable.
+    const uint8_t CONTAINER_VERSION = 7;
+    const uint8_t CONTAINER_MIN_VERSION = 2;
     const uint8_t CONTAINER_ID[7] = {'M', 'O', 'T', 'I', 'O', 'N', ' '};
 
     struct Header {
@@ -33,14 +47,88 @@ namespace motioncam {
         virtual std::shared_ptr<RawImageBuffer> getFrame(const std::string& frame) = 0;
         virtual int64_t getFrameTimestamp(const std::string& frame) const = 0;
         virtual std::shared_ptr<RawImageBuffer> loadFrame(const std::string& frame) = 0;
+
+        // Index based iteration over the frames. Index i always refers to
+        // getFrames()[i]; containers backed by an offset index serve these
+        // directly from it, without constructing and hashing a frame name
+        // per access. The defaults wrap the name based API so every
+        // container supports them.
+        virtual size_t getFrameCount() const;
+        virtual int64_t getFrameTimestamp(const size_t index) const;
+        virtual std::shared_ptr<RawImageBuffer> loadFrame(const size_t index);
+
+        // Index of the frame whose timestamp is nearest timestampNs, for
+        // timeline seeks in players. Frames are ordered by capture
+        // timestamp, so the default binary searches getFrameTimestamp();
+        // containers backed by an offset index answer straight from it.
+        // Returns 0 when the container has no frames.
+        virtual size_t seekFrameIndex(const int64_t timestampNs) const;
+
+        // Exception-free variant of loadFrame() for hot read loops. Returns
+        // nullptr and fills outError on failure instead of throwing. The
+        // default implementation just wraps loadFrame().
+        virtual std::shared_ptr<RawImageBuffer> tryLoadFrame(const std::string& frame, std::string& outError) noexcept;
+
+        // Creates an independent read cursor over this container so decode
+        // workers on separate threads can load frames concurrently.
+        // Containers that can't support one return nullptr and callers fall
+        // back to serialized loadFrame().
+        virtual std::unique_ptr<RawContainerReader> createReader();
+
         virtual void removeFrame(const std::string& frame) = 0;
         
         virtual bool isInMemory() const = 0;
         virtual int getNumSegments() const = 0;
         virtual bool isCorrupted() const = 0;
         
+        // Optional capture summary and embedded thumbnail. Containers that
+        // don't support them keep the defaults.
+        virtual void setSummary(const std::vector<uint8_t>& thumbnailJpeg, const int width, const int height, const int droppedFrames) {}
+        virtual bool getSummary(float& outDurationMs, float& outFrameRate, int& outNumFrames, int& outDroppedFrames, int& outWidth, int& outHeight) const { return false; }
+        virtual bool getThumbnail(std::vector<uint8_t>& outJpeg) const { return false; }
+
+        // Per-frame capture records (EV inputs, payload size, sharpness
+        // hint), written into the footer at record time. Containers without
+        // them keep the default and callers fall back to probing frames.
+        virtual bool getFrameRecords(std::vector<FrameRecord>& outRecords) const { return false; }
+
+        // Byte-bounded LRU over decoded frames, for players that scrub back
+        // and forth over the same region. Off by default; containers that
+        // don't support it ignore the call.
+        virtual void setDecodedFrameCache(const size_t maxBytes) {}
+
+        // Asynchronously reads and decodes the given frames ahead of a
+        // sequential consumer, overlapping container I/O with the caller's
+        // downstream work. A prefetched frame is handed over to the next
+        // load of that frame. Containers that don't support it ignore the
+        // call.
+        virtual void prefetchFrames(const std::vector<std::string>& frames) {}
+
+        // Optional quarter resolution proxy track, generated in the
+        // background after a capture commits so the review UI can scrub
+        // without exercising the raw decode path. getProxyFrame() returns
+        // interleaved RGBA. Containers without one keep the defaults.
+        virtual bool hasProxyTrack() const { return false; }
+        virtual bool getProxyFrame(const std::string& frame, std::vector<uint8_t>& outRgba, int& outWidth, int& outHeight) { return false; }
+        virtual bool beginProxyTrack(const int fd) { return false; }
+        virtual void appendProxyFrame(const int64_t timestamp, const uint8_t* rgba, const int width, const int height) {}
+        virtual void commitProxyTrack() {}
+
+        // Optional interleaved audio track, muxed into the container next to
+        // the frames. Containers that don't support one keep the defaults.
+        virtual void addAudio(const int16_t* samples, const size_t numSamples, const int sampleRate, const int channels) {}
+        virtual bool getAudio(std::vector<int16_t>& outSamples, int& outSampleRate, int& outChannels) const { return false; }
+
         virtual void add(const RawImageBuffer& frame, bool flush) = 0;
         virtual void add(const std::vector<std::shared_ptr<RawImageBuffer>>& buffers, bool flush) = 0;
+
+        // Adds frames to an in-memory container by reference instead of
+        // copying them, so a capture can hand its buffers straight to the
+        // processing consumer without a clone per frame. The container keeps
+        // the buffers alive until it is released; callers must not write to
+        // them afterwards. The default falls back to the copying add() for
+        // containers without an in-memory mode.
+        virtual void addShared(const std::vector<std::shared_ptr<RawImageBuffer>>& buffers);
         virtual void commit() = 0;
         virtual void commit(const std::string& outputPath) = 0;
         
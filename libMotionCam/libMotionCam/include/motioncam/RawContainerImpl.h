@@ -4,12 +4,50 @@
 #include <string>
 #include <vector>
 #include <utility>
+#include <set>
+#include <list>
+#include <mutex>
+#include <atomic>
 
 #include "motioncam/RawContainer.h"
+#include "motioncam/TaskEngine.h"
+
+namespace cv {
+    class Mat;
+}
+
+struct ZSTD_DDict_s;
 
 namespace motioncam {
     struct RawCameraMetadata;
     struct RawImageBuffer;
+    class RawContainerImpl;
+
+    // An independent read cursor over an open container, created through
+    // RawContainer::createReader(). Readers share the container's file
+    // descriptor and on-disk index but read frame data with pread(), so
+    // decode workers on separate threads can load frames concurrently
+    // instead of serializing on the FILE* seek state.
+    class RawContainerReader {
+    public:
+        std::shared_ptr<RawImageBuffer> loadFrame(const std::string& frame);
+        std::shared_ptr<RawImageBuffer> tryLoadFrame(const std::string& frame, std::string& outError) noexcept;
+
+    private:
+        friend class RawContainerImpl;
+
+        RawContainerReader(RawContainerImpl& container, const int fd);
+
+        bool readAt(void* data, size_t size, int64_t offset) const;
+
+    private:
+        RawContainerImpl& mContainer;
+        const int mFd;
+
+        // Compressed payload scratch, reused across loads so steady state
+        // decode loops stop allocating per frame
+        std::vector<uint8_t> mScratch;
+    };
     
     enum class Mode : int {
         CREATE,
@@ -23,29 +61,187 @@ namespace motioncam {
     //
 
     const uint32_t INDEX_MAGIC_NUMBER = 0x34884CED;
+    const uint32_t SUMMARY_MAGIC_NUMBER = 0x53554D31;
+    const uint32_t CHECKPOINT_MAGIC_NUMBER = 0x43485031;
 
     enum class Type : uint32_t {
         BUFFER,
-        METADATA
+        METADATA,
+        THUMBNAIL,
+        SUMMARY,
+        PADDING,
+        SHADING_MAP,
+        CRC32,
+        AUDIO,
+        FRAME_INDEX,
+        METADATA_ZSTD,
+        METADATA_DICT,
+        PROXY,
+        METADATA_BIN,
+        INDEX_CHECKPOINT
     };
 
+    // Frame payloads are aligned to this boundary (version 3 onwards) so the
+    // export path can read them with O_DIRECT
+    const uint32_t PAYLOAD_ALIGNMENT = 4096;
+
     struct Item {
         Type type;
         uint32_t size;
     };
 
+    // Written directly after the frame metadata (version 4 onwards). The
+    // header is followed by numChannels*width*height packed f16 gains,
+    // channel major, so the streamer doesn't dump four float grids into
+    // json for every captured frame.
+    struct ShadingMapHeader {
+        uint32_t numChannels;
+        uint32_t width;
+        uint32_t height;
+    };
+
+    // Presence bits for FrameMetadataRecord::flags. A clear matrix bit means
+    // the frame didn't carry that matrix, matching an absent key in the json
+    // encoding.
+    const uint32_t FRAME_METADATA_HAS_DYNAMIC_BLACK_LEVEL = 1u << 0;
+    const uint32_t FRAME_METADATA_HAS_COLOR_MATRIX_1      = 1u << 1;
+    const uint32_t FRAME_METADATA_HAS_COLOR_MATRIX_2      = 1u << 2;
+    const uint32_t FRAME_METADATA_HAS_CALIBRATION_MATRIX_1 = 1u << 3;
+    const uint32_t FRAME_METADATA_HAS_CALIBRATION_MATRIX_2 = 1u << 4;
+    const uint32_t FRAME_METADATA_HAS_FORWARD_MATRIX_1    = 1u << 5;
+    const uint32_t FRAME_METADATA_HAS_FORWARD_MATRIX_2    = 1u << 6;
+
+    // Per-frame metadata, written as a METADATA_BIN item (version 6
+    // onwards). A fixed record instead of json because building and
+    // formatting the json was a measurable slice of the streamer thread at
+    // high frame rates, and every field here is plain data. The shading map
+    // still follows as its own packed f16 record.
+    struct FrameMetadataRecord {
+        int64_t timestamp;
+        int64_t offset;
+        int64_t exposureTime;
+        int32_t iso;
+        int32_t exposureCompensation;
+        int32_t orientation;
+        int32_t width;
+        int32_t height;
+        int32_t originalWidth;
+        int32_t originalHeight;
+        int32_t rowStride;
+        uint32_t pixelFormat;
+        uint32_t compressionType;
+        uint32_t isBinned;
+        uint32_t isCompressed;
+        uint32_t flags;
+        float asShot[3];
+        float dynamicWhiteLevel;
+        float dynamicBlackLevel[4];
+
+        // Row major 3x3 matrices, in the order of the HAS_* bits above
+        float matrices[6][9];
+    };
+
+    // Audio rides in the container as a chain of AUDIO items written back to
+    // back ahead of the summary. Each header is followed by
+    // numFrames*channels interleaved int16 samples; chunks are sized so the
+    // audio flush is a handful of large sequential writes on the same fd as
+    // the frames instead of a separate small-write stream.
+    struct AudioChunkHeader {
+        uint32_t sampleRate;
+        uint32_t channels;
+        uint32_t numFrames;
+    };
+
     struct ItemOffset {
         int64_t offset;
         int64_t timestamp;
     };
 
+    // Per-frame capture record, written as a packed array in a single
+    // FRAME_INDEX item just ahead of the summary. Each record carries the
+    // EV inputs and payload size of one frame so export setup and frame
+    // selection can run off the footer instead of reading the metadata of
+    // every frame from across the file.
+    struct FrameRecord {
+        int64_t timestamp;
+        int64_t exposureTime;
+        int32_t iso;
+        uint32_t compressedSize;
+
+        // Record-time sharpness hint, or 0 when the writer didn't measure
+        // one
+        float sharpness;
+    };
+
+    // The proxy track is a chain of PROXY items written back to back, each
+    // header followed by zstd compressed interleaved RGBA. It's generated in
+    // the background after a capture commits and appended through a second
+    // file descriptor, so the review UI can scrub from small decoded frames
+    // and the full raw decode path is only exercised on export.
+    struct ProxyFrameHeader {
+        int64_t timestamp;
+        uint32_t width;
+        uint32_t height;
+    };
+
     struct Index {
         uint32_t indexMagicNumber;
         uint32_t numOffsets;
     };
 
+    // Periodic copy of the frame index, written into the stream at payload
+    // aligned positions as an INDEX_CHECKPOINT item (version 7 onwards).
+    // The header is followed by numOffsets ItemOffset entries covering
+    // every frame written so far, so recovering an interrupted recording
+    // resumes from the newest checkpoint instead of scanning the whole
+    // file.
+    struct IndexCheckpoint {
+        uint32_t checkpointMagicNumber;
+        uint32_t numOffsets;
+    };
+
+    // Capture summary, written just ahead of the index so the gallery can
+    // list a file without probing frames
+    struct Summary {
+        uint32_t summaryMagicNumber;
+        uint32_t numFrames;
+        uint32_t droppedFrames;
+        uint32_t width;
+        uint32_t height;
+        float durationMs;
+        float frameRate;
+        int64_t thumbnailOffset;
+
+        // Offset of the first AUDIO item, or 0 when the capture has no
+        // audio. Summaries written before this field existed are 8 bytes
+        // shorter; init() accepts both sizes.
+        int64_t audioOffset;
+
+        // Offset of the FRAME_INDEX item, or 0 when the capture has no
+        // frame records. Summaries written before this field existed are
+        // another 8 bytes shorter again; init() accepts all three sizes.
+        int64_t frameRecordsOffset;
+
+        // Offset of the METADATA_DICT item, or 0 when the capture predates
+        // dictionary compressed metadata. Extends the summary the same way
+        // as the fields above.
+        int64_t metadataDictOffset;
+
+        // Offset of the first PROXY item, or 0 when no proxy track has been
+        // generated for this container. Extends the summary the same way as
+        // the fields above.
+        int64_t proxyOffset;
+    };
+
     class RawContainerImpl : public RawContainer {
     public:
+        // Writes streamed recordings through O_DIRECT with an aligned
+        // staging buffer instead of the page cache. Callers enable it on
+        // devices where sustained recording would otherwise evict the
+        // capture working set; containers fall back to buffered writes when
+        // the filesystem rejects direct I/O. Off by default.
+        static void setUseDirectIo(const bool enabled);
+
         RawContainerImpl(FILE* file);
         RawContainerImpl(const int fd,
                          const RawCameraMetadata& cameraMetadata,
@@ -67,6 +263,12 @@ namespace motioncam {
         std::shared_ptr<RawImageBuffer> getFrame(const std::string& frame);
         int64_t getFrameTimestamp(const std::string& frame) const;
         std::shared_ptr<RawImageBuffer> loadFrame(const std::string& frame);
+        size_t getFrameCount() const;
+        int64_t getFrameTimestamp(const size_t index) const;
+        std::shared_ptr<RawImageBuffer> loadFrame(const size_t index);
+        size_t seekFrameIndex(const int64_t timestampNs) const;
+        std::shared_ptr<RawImageBuffer> tryLoadFrame(const std::string& frame, std::string& outError) noexcept;
+        std::unique_ptr<RawContainerReader> createReader();
         void removeFrame(const std::string& frame);
         
         void recover();
@@ -75,41 +277,199 @@ namespace motioncam {
         int getNumSegments() const;
         bool isCorrupted() const;
         
+        void setSummary(const std::vector<uint8_t>& thumbnailJpeg, const int width, const int height, const int droppedFrames);
+        bool getSummary(float& outDurationMs, float& outFrameRate, int& outNumFrames, int& outDroppedFrames, int& outWidth, int& outHeight) const;
+        bool getThumbnail(std::vector<uint8_t>& outJpeg) const;
+        bool getFrameRecords(std::vector<FrameRecord>& outRecords) const;
+        void setDecodedFrameCache(const size_t maxBytes);
+        void prefetchFrames(const std::vector<std::string>& frames);
+
+        bool hasProxyTrack() const;
+        bool getProxyFrame(const std::string& frame, std::vector<uint8_t>& outRgba, int& outWidth, int& outHeight);
+        bool beginProxyTrack(const int fd);
+        void appendProxyFrame(const int64_t timestamp, const uint8_t* rgba, const int width, const int height);
+        void commitProxyTrack();
+
         void add(const RawImageBuffer& buffer, bool flush);
         void add(const std::vector<std::shared_ptr<RawImageBuffer>>& buffers, bool flush);
-        
+        void addShared(const std::vector<std::shared_ptr<RawImageBuffer>>& buffers);
+
+        void addAudio(const int16_t* samples, const size_t numSamples, const int sampleRate, const int channels);
+        bool getAudio(std::vector<int16_t>& outSamples, int& outSampleRate, int& outChannels) const;
+
         void commit();
         void commit(const std::string& outputPath);
 
     private:
+        friend class RawContainerReader;
+
         void create(const json11::Json& extraData);
         void init();
         std::vector<ItemOffset> attemptToRecover();
         std::shared_ptr<RawImageBuffer> readMetadata();
-        std::shared_ptr<RawImageBuffer> readFrame(const std::string& frame, const bool readData=true);
-        void uncompressBuffer(std::vector<uint8_t>& compressedBuffer, const std::shared_ptr<RawImageBuffer>& dst) const;
+
+        // Exception-free read path used by the streaming loops. Failures are
+        // reported through outError/return values; the public accessors
+        // translate them back into IOException.
+        std::shared_ptr<RawImageBuffer> readFrame(const std::string& frame, const bool readData, std::string& outError);
+        std::shared_ptr<RawImageBuffer> readFrameAt(const ItemOffset& itemOffset, const std::string& frame, const bool readData, std::string& outError);
+        bool frameOffsetAt(const size_t index, ItemOffset& outOffset) const;
+        bool uncompressBuffer(const uint8_t* compressed, const size_t compressedSize, const std::shared_ptr<RawImageBuffer>& dst) const;
         void writeBuffer(const RawImageBuffer& buffer);
+        void loadMetadataDict(const std::vector<uint8_t>& dict);
+        bool decompressMetadata(const std::vector<uint8_t>& compressed, std::string& outJson) const;
+        void writeAudioChunks(const int16_t* samples, const size_t numSamples, const int sampleRate, const int channels);
+        void writeShadingMap(const std::vector<cv::Mat>& shadingMap);
+        void tryReadShadingMap(const std::shared_ptr<RawImageBuffer>& buffer) const;
         void write(const void* data, size_t size, size_t items=1) const;
+
+        // One segment of a gathered write
+        struct WriteSegment {
+            const void* data;
+            size_t size;
+        };
+
+        void writeGather(const WriteSegment* segments, int count) const;
+        void setupDirectIo();
+        void finishDirectIo();
+        void stageWrite(const void* data, size_t size) const;
+        void flushStagedBlocks() const;
+        int64_t streamPosition() const;
         void read(void* data, size_t size, size_t items=1) const;
+        bool tryRead(void* data, size_t size, size_t items=1) const;
         void writeIndex();
+        void writeIndexCheckpoint();
+        bool findIndexCheckpoint(const int64_t fileSize, std::vector<ItemOffset>& outOffsets, int64_t& outResumeOffset);
         void reindexOffsets();
-        
+        void loadMetadata() const;
+        const std::vector<ItemOffset>& indexPage(const size_t page) const;
+        ItemOffset indexEntryAt(const size_t i) const;
+        bool findOffset(const std::string& frame, ItemOffset& outOffset) const;
+        void adviseSequentialRead(const int64_t start, const int64_t end) const;
+        std::shared_ptr<RawImageBuffer> cachedFrame(const std::string& frame);
+        void cacheFrame(const std::string& frame, const std::shared_ptr<RawImageBuffer>& buffer);
+        void evictCachedFrame(const std::string& frame);
+        std::shared_ptr<RawImageBuffer> takePrefetchedFrame(const std::string& frame);
+        bool loadProxyIndex();
+
     private:
         Mode mMode;
         FILE* mFile;
-        int mNumSegments;
+        uint8_t mVersion;
+        mutable int mNumSegments;
         const bool mIsInMemory;
-        json11::Json mExtraData;
+        mutable json11::Json mExtraData;
         int64_t mBufferStartOffset;
-        
+
+        // Camera metadata is parsed lazily so index-only consumers
+        // (frame counts, summaries) don't pay for the full JSON parse
+        int64_t mMetadataOffset;
+        uint32_t mMetadataSize;
+        mutable bool mLoadedMetadata;
+
+        // In-memory offsets (create and recovery paths)
         std::vector<ItemOffset> mOffsets;
-        std::map<std::string, ItemOffset> mFrameOffsetMap;
 
-        std::vector<std::string> mFrameList;
+        // Per-frame records accumulated as buffers are written, flushed into
+        // the footer by writeIndex()
+        std::vector<FrameRecord> mFrameRecords;
+
+        // Stream position at which the next index checkpoint is due
+        int64_t mNextCheckpointPosition;
+
+        // Session dictionary for the per-frame metadata of containers
+        // written before version 6, loaded from the METADATA_DICT item
+        std::vector<uint8_t> mMetadataDict;
+        std::shared_ptr<ZSTD_DDict_s> mMetadataDDict;
+
+        // On-disk index, loaded in pages on demand. The mutex makes lookups
+        // safe to call from concurrent reader sessions.
+        size_t mNumOffsets;
+        int64_t mIndexStartOffset;
+        mutable std::mutex mIndexMutex;
+        mutable std::map<size_t, std::vector<ItemOffset>> mIndexPages;
+
+        std::set<int64_t> mRemovedFrames;
+
+        std::vector<uint8_t> mThumbnailJpeg;
+        Summary mSummary;
+        bool mHasSummary;
+
+        // Audio added to an in-memory container is held here until commit
+        std::vector<int16_t> mPendingAudio;
+        int mPendingAudioSampleRate;
+        int mPendingAudioChannels;
+        int64_t mAudioOffset;
+
+        mutable std::vector<std::string> mFrameList;
         std::map<std::string, std::shared_ptr<RawImageBuffer>> mBuffers;
 
-        std::unique_ptr<RawCameraMetadata> mCameraMetadata;
-        std::unique_ptr<PostProcessSettings> mPostProcessSettings;
+        // Compressed payload scratch for the serialized FILE* read path,
+        // reused across frames so exports and playback stop allocating a
+        // payload sized buffer per read
+        std::vector<uint8_t> mReadScratch;
+
+        // Read-only mapping of the container (read mode, POSIX targets).
+        // Frame reads are served from it instead of going through the
+        // FILE* cursor, and compressed payloads decode straight from the
+        // mapping. Null when mapping isn't available; reads past the
+        // mapped size (a proxy track appended after open) fall back to
+        // the file.
+        const uint8_t* mMapped;
+        size_t mMappedSize;
+
+        // Direct I/O streaming state (create mode). Sequential writes
+        // accumulate in the aligned staging buffer and are flushed to the
+        // descriptor in aligned blocks, bypassing the page cache. The
+        // members are mutable for the same reason write() is const.
+        mutable bool mDirectIo;
+        mutable uint8_t* mStaging;
+        mutable int64_t mStagingOffset;
+        mutable size_t mStagingBytes;
+        mutable std::vector<uint8_t> mStagingPool;
+
+        // Write-behind state for direct I/O. Two staging blocks alternate:
+        // a full block is handed to a background task that writes it out
+        // while the IO thread keeps filling the other one, so slow flash
+        // writes stop stalling the frame queue. At most one write is in
+        // flight; a failed one surfaces on the next flush.
+        mutable uint8_t* mStagingNext;
+        mutable TaskGroup mWriteBehindGroup;
+        mutable std::atomic<bool> mWriteBehindFailed;
+
+        // Decoded frame LRU for scrubbing players. Bounded by bytes and off
+        // until a player enables it. Hits are shared between the container
+        // and its reader sessions, so cached frames must be treated as
+        // read-only.
+        std::mutex mFrameCacheMutex;
+        size_t mFrameCacheMaxBytes;
+        size_t mFrameCacheBytes;
+        std::list<std::string> mFrameCacheOrder;
+        std::map<std::string, std::pair<std::list<std::string>::iterator, std::shared_ptr<RawImageBuffer>>> mFrameCache;
+
+        // Readahead state for sequential consumers. The requested window is
+        // fanned out across a few concurrent reader sessions so the decode
+        // stage keeps several cores busy; each prefetched entry is handed
+        // over once, to the next load of that frame.
+        std::mutex mPrefetchMutex;
+        std::map<std::string, std::shared_ptr<RawImageBuffer>> mPrefetchedFrames;
+        std::atomic<bool> mPrefetchActive;
+        std::atomic<int> mPrefetchPending;
+        std::vector<std::unique_ptr<RawContainerReader>> mPrefetchReaders;
+        TaskGroup mPrefetchGroup;
+
+        // Proxy track state. Appends go through their own file stream so a
+        // committed container can gain a proxy track without disturbing
+        // concurrent reader sessions; reads index the PROXY chain lazily and
+        // fetch frames with pread.
+        FILE* mProxyFile;
+        int64_t mProxyStartOffset;
+        std::mutex mProxyMutex;
+        bool mLoadedProxyIndex;
+        std::map<int64_t, int64_t> mProxyOffsets;
+
+        mutable std::unique_ptr<RawCameraMetadata> mCameraMetadata;
+        mutable std::unique_ptr<PostProcessSettings> mPostProcessSettings;
     };
 }
 
@@ -4,6 +4,8 @@
 #include "motioncam/RawContainer.h"
 #include <opencv2/opencv.hpp>
 
+#include <mutex>
+
 namespace motioncam {
     namespace util {
         class ZipWriter;
@@ -26,6 +28,13 @@ namespace motioncam {
         std::shared_ptr<RawImageBuffer> getFrame(const std::string& frame);
         int64_t getFrameTimestamp(const std::string& frame) const;
         std::shared_ptr<RawImageBuffer> loadFrame(const std::string& frame);
+
+        // Loads a batch of frames in one go. The entry reads stay serialized
+        // on the underlying zip/file handle but the decompression of each
+        // entry runs in parallel on the task engine, which is where nearly
+        // all of the time goes for compressed legacy containers.
+        void preloadFrames(const std::vector<std::string>& frames);
+
         void removeFrame(const std::string& frame);
 
         void add(const RawImageBuffer& frame, bool flush) { throw std::runtime_error("Unsupported"); };
@@ -48,10 +57,12 @@ namespace motioncam {
         
         void loadContainerMetadata(const json11::Json& metadata);
         std::shared_ptr<RawImageBuffer> loadFrameMetadata(const json11::Json& obj);
-        
+        void readFrameBytes(const std::shared_ptr<RawImageBuffer>& buffer, const std::string& frame, std::vector<uint8_t>& outData);
+
     private:
         std::unique_ptr<util::ZipReader> mZipReader;
         FILE* mFile;
+        std::mutex mIoMutex;
         
         std::unique_ptr<RawCameraMetadata> mCameraMetadata;
         std::unique_ptr<PostProcessSettings> mPostProcessSettings;
@@ -29,6 +29,35 @@ namespace motioncam {
                             const int rowStride);
     
         size_t decode(uint16_t* output, const int width, const int height, const uint8_t* input, const size_t len);
+
+        // Banded layer over the block codec. The frame is split into
+        // independent horizontal bands encoded in parallel on the task
+        // engine, so one frame's compression spreads across the cores
+        // instead of pinning a single process thread. The payload opens
+        // with a uint32 band count, followed by a uint32 compressed size
+        // and uint32 decoded row count per band, then the concatenated
+        // band streams.
+        //
+        // encodeBanded() works over data in place like encode(), with
+        // capacity bounding the payload it may write. Frames too small to
+        // split, or whose banded payload wouldn't fit, are encoded as a
+        // single plain stream instead; outBanded reports which layout was
+        // written so the caller can tag the buffer accordingly.
+        size_t encodeBanded(uint8_t* data,
+                            PixelFormat pixelFormat,
+                            const int xstart,
+                            const int xend,
+                            const int ystart,
+                            const int yend,
+                            const int rowStride,
+                            const size_t capacity,
+                            const bool bin,
+                            bool& outBanded);
+
+        // Decodes a banded payload, fanning the bands out across the task
+        // engine. Returns false when the payload is malformed or doesn't
+        // cover width x height.
+        bool decodeBanded(uint16_t* output, const int width, const int height, const uint8_t* input, const size_t len);
     }
 }
 
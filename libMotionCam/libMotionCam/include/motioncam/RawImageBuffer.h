@@ -35,8 +35,16 @@ namespace motioncam {
         bool isCompressed;
         CompressionType compressionType;
         uint64_t offset;
-        
-        void toJson(json11::Json::object& metadataJson) const;
+
+        // Set when data borrows memory owned outside the buffer pool, such
+        // as a camera runtime image. Foreign buffers are released back to
+        // their owner instead of recycled when they are discarded, and
+        // never serve as capture copy destinations.
+        bool isForeign;
+
+        // The shading map points can be left out when they are carried in a
+        // binary record next to the json (container format v4)
+        void toJson(json11::Json::object& metadataJson, const bool includeShadingMap = true) const;
         
         static std::vector<cv::Mat> GetLensShadingMap(const json11::Json& obj);
         
@@ -5,6 +5,7 @@
 #include "motioncam/Settings.h"
 #include "motioncam/Types.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -97,16 +98,22 @@ namespace motioncam {
         RawType rawType;
         std::vector<double> noiseProfile;
         
+        // The shading map is treated as immutable once set. Copies of the
+        // metadata share the same block, so copying a buffer between the
+        // consumer, streamer and container is a reference count bump
+        // instead of a per-frame deep copy. To change the shading map,
+        // call updateShadingMap() with the new maps.
         void updateShadingMap(const std::vector<cv::Mat>& shadingMap) {
-            this->lensShadingMap = shadingMap;
+            this->lensShadingMap = std::make_shared<const std::vector<cv::Mat>>(shadingMap);
         }
-        
+
         const std::vector<cv::Mat>& shadingMap() const {
-            return lensShadingMap;
+            static const std::vector<cv::Mat> emptyShadingMap;
+            return lensShadingMap ? *lensShadingMap : emptyShadingMap;
         }
-        
+
     private:
-        std::vector<cv::Mat> lensShadingMap;
+        std::shared_ptr<const std::vector<cv::Mat>> lensShadingMap;
     };
 
 } // namespace motioncam
@@ -1,6 +1,7 @@
 #ifndef Settings_h
 #define Settings_h
 
+#include <stdint.h>
 #include <string>
 #include <map>
 
@@ -14,6 +15,54 @@ namespace motioncam {
     bool getSetting(const json11::Json& json, const std::string& key, const bool defaultValue);
     std::string getSetting(const json11::Json& json, const std::string& key, const std::string& defaultValue);
 
+    // Flat binary layout of PostProcessSettings for crossing the JNI
+    // boundary through a direct ByteBuffer, so UI-rate settings updates cost
+    // a struct copy instead of a json round trip. Every field is four bytes
+    // wide apart from the fixed-size string tails, so the layout has no
+    // padding. Bump the version whenever the layout changes; it must match
+    // PostProcessSettings.java.
+    const uint32_t PACKED_SETTINGS_VERSION = 1;
+    const size_t PACKED_SETTINGS_STRING_SIZE = 32;
+
+    struct PackedPostProcessSettings {
+        uint32_t version;
+
+        int32_t spatialDenoiseLevel;
+
+        float temperature;
+        float tint;
+        float gamma;
+        float tonemapVariance;
+        float shadows;
+        float whitePoint;
+        float contrast;
+        float brightness;
+        float sharpen0;
+        float sharpen1;
+        float pop;
+        float blacks;
+        float exposure;
+        float clippedLows;
+        float clippedHighs;
+        float noiseSigma;
+        float sceneLuminance;
+        float saturation;
+        float blues;
+        float greens;
+
+        int32_t jpegQuality;
+        int32_t flipped;
+        int32_t dng;
+
+        float gpsLatitude;
+        float gpsLongitude;
+        float gpsAltitude;
+
+        // Null terminated, truncated to fit
+        char gpsTime[PACKED_SETTINGS_STRING_SIZE];
+        char captureMode[PACKED_SETTINGS_STRING_SIZE];
+    };
+
     struct PostProcessSettings {
         // Denoising
         int spatialDenoiseLevel;
@@ -58,6 +107,11 @@ namespace motioncam {
         PostProcessSettings(const json11::Json& json);
         
         void toJson(std::map<std::string, json11::Json>& json) const;
+
+        void pack(PackedPostProcessSettings& packed) const;
+
+        // Returns false when the packed layout version doesn't match
+        bool unpack(const PackedPostProcessSettings& packed);
     };
 }
 
@@ -0,0 +1,20 @@
+#ifndef SettingsStore_h
+#define SettingsStore_h
+
+#include <string>
+
+namespace motioncam {
+    struct PostProcessSettings;
+
+    // Versioned binary image of PostProcessSettings. Loading maps the file
+    // read-only and copies the fields out without any parsing; saving
+    // rewrites the image atomically (temporary file + rename). Load() fails
+    // on a magic/version mismatch so callers can fall back to JSON.
+    class SettingsStore {
+    public:
+        static bool Load(const std::string& path, PostProcessSettings& outSettings);
+        static bool Save(const PostProcessSettings& settings, const std::string& path);
+    };
+}
+
+#endif /* SettingsStore_h */
@@ -0,0 +1,96 @@
+#ifndef TaskEngine_hpp
+#define TaskEngine_hpp
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <queue/concurrentqueue.h>
+
+namespace motioncam {
+    // Priority classes, in scheduling order. Capture work must never wait
+    // behind an export, and background work runs only when nothing else is
+    // queued.
+    enum class TaskPriority : int {
+        CAPTURE = 0,
+        EXPORT,
+        BACKGROUND,
+
+        NUM_PRIORITIES
+    };
+
+    class TaskEngine;
+
+    // Tracks completion of a set of tasks scheduled through the engine.
+    // wait() executes queued work instead of blocking, so a task can
+    // schedule and wait for child tasks without deadlocking the pool.
+    class TaskGroup {
+    public:
+        TaskGroup();
+
+        void wait();
+
+    private:
+        friend class TaskEngine;
+
+        std::atomic<int> mPending;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+    };
+
+    // Process-wide work stealing task pool, sized to the number of cores.
+    // Subsystems schedule onto this instead of spawning their own threads
+    // so capture, export and background work running together don't
+    // oversubscribe the CPU.
+    class TaskEngine {
+    public:
+        static TaskEngine& get();
+
+        void run(const TaskPriority priority, std::function<void()> task);
+        void run(const TaskPriority priority, std::function<void()> task, TaskGroup& group);
+
+        int numWorkers() const;
+
+    private:
+        friend class TaskGroup;
+
+        struct Task {
+            std::function<void()> fn;
+            TaskGroup* group;
+        };
+
+        // Per-worker deque. The owning thread pushes and pops at the front;
+        // idle workers steal from the back.
+        struct Worker;
+
+        TaskEngine();
+        ~TaskEngine();
+
+        TaskEngine(const TaskEngine&) = delete;
+        TaskEngine& operator=(const TaskEngine&) = delete;
+
+        void schedule(const TaskPriority priority, Task task);
+        bool tryExecute(const int workerIdx);
+        void execute(Task& task);
+        void doWork(const int workerIdx);
+
+    private:
+        std::atomic<bool> mRunning;
+
+        std::vector<std::unique_ptr<Worker>> mWorkers;
+        std::vector<std::unique_ptr<std::thread>> mThreads;
+
+        // Intake queues for tasks scheduled from outside the pool, one per
+        // priority class
+        moodycamel::ConcurrentQueue<Task> mQueues[static_cast<int>(TaskPriority::NUM_PRIORITIES)];
+
+        std::mutex mSleepMutex;
+        std::condition_variable mSleepCondition;
+    };
+}
+
+#endif /* TaskEngine_hpp */
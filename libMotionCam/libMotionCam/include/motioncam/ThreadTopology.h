@@ -0,0 +1,30 @@
+#ifndef ThreadTopology_hpp
+#define ThreadTopology_hpp
+
+namespace motioncam {
+    namespace topology {
+        // Thread classes the topology layer knows about. COMPUTE threads
+        // (Halide workers, frame compression, processing tasks) prefer the
+        // performance cores; IO threads (container writes, network
+        // streaming) prefer the efficiency cores so they don't take big
+        // cores away from the kernels.
+        enum class ThreadClass : int {
+            COMPUTE,
+            IO
+        };
+
+        // Enables or disables core pinning. Off by default; when off, or
+        // on devices without asymmetric cores, threads float wherever the
+        // scheduler puts them.
+        void SetEnabled(const bool enabled);
+        bool IsEnabled();
+
+        // Pins the calling thread to the cores for the given class. Cheap
+        // to call from a work loop: the affinity is only reapplied when the
+        // enabled state has changed since this thread last called, and
+        // disabling returns the thread to the full core set.
+        void PinCurrentThread(const ThreadClass threadClass);
+    }
+}
+
+#endif /* ThreadTopology_hpp */
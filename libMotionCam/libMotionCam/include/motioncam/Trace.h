@@ -0,0 +1,28 @@
+#ifndef Trace_hpp
+#define Trace_hpp
+
+#include <string>
+#include <stdint.h>
+
+namespace motioncam {
+    namespace trace {
+        // Turns event collection on or off. Off (the default) reduces every
+        // trace point to a relaxed atomic load, so the scopes can stay in
+        // the hot paths of production builds.
+        void SetEnabled(const bool enabled);
+        bool IsEnabled();
+
+        // Microseconds on the shared trace clock
+        int64_t NowUs();
+
+        // Records one complete event on the calling thread's ring buffer
+        void Emit(const std::string& name, const int64_t beginUs, const int64_t endUs);
+
+        // Serializes the buffered events of every thread into
+        // chrome://tracing / perfetto compatible JSON (a "traceEvents"
+        // array of complete events) and clears the buffers.
+        std::string Dump();
+    }
+}
+
+#endif /* Trace_hpp */
@@ -48,6 +48,7 @@ namespace motioncam {
         BITNZPACK,
         BITNZPACK_2,
         MOTIONCAM,
+        MOTIONCAM_BANDED,
         INVALID
     };
 }
@@ -1,10 +1,16 @@
 #ifndef Util_hpp
 #define Util_hpp
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <miniz_zip.h>
+#include <queue/blockingconcurrentqueue.h>
 #include <json11/json11.hpp>
 #include <opencv2/opencv.hpp>
 
@@ -24,6 +30,39 @@ namespace motioncam {
             std::string frameName;
             int64_t timestamp;
             size_t containerIndex;
+
+            // Position of the frame within its container, for the index
+            // based accessors
+            size_t frameIndex;
+        };
+
+        // Merged, timestamp sorted timeline of every frame across an
+        // export's containers, built once per export. Neighbour loads and
+        // frame releases are index based sliding window operations, so the
+        // per frame setup cost stays constant regardless of clip length.
+        class FrameTimeline {
+        public:
+            FrameTimeline(const std::vector<std::unique_ptr<RawContainer>>& containers);
+
+            const std::vector<ContainerFrame>& frames() const;
+
+            RawContainer& container(const int frameIdx) const;
+
+            // Loads up to numBuffers frames nearest to startIdx, alternating
+            // between the left and right neighbours
+            void loadNearestBuffers(const int startIdx,
+                                    const int numBuffers,
+                                    std::vector<std::shared_ptr<RawImageBuffer>>& outNearestBuffers) const;
+
+            // Releases the frames that have fallen out of the merge window
+            // behind frameIdx. Each frame is released exactly once over the
+            // whole export instead of being rescanned from the start.
+            void releaseExpiredFrames(const int frameIdx, const int windowSize);
+
+        private:
+            std::vector<RawContainer*> mContainers;
+            std::vector<ContainerFrame> mFrames;
+            int mReleasedUpTo;
         };
 
         class CloseableFd {
@@ -40,17 +79,62 @@ namespace motioncam {
             ZipWriter(const int fd, bool append=false);
             ZipWriter(const std::string& pathname, bool append=false);
             ~ZipWriter();
-            
+
             void addFile(const std::string& filename, const std::string& data);
             void addFile(const std::string& filename, const void* data, const size_t numBytes);
             void addFile(const std::string& filename, const std::vector<uint8_t>& data, const size_t numBytes);
-            
+
+            // Deflates entries added after this call on a pool of worker
+            // threads and appends them to the archive in completion order,
+            // so archiving many entries scales with cores instead of
+            // serializing on the caller's thread. Entries that don't shrink
+            // are stored uncompressed, matching the default mode. commit()
+            // waits for the queue to drain; failures on the workers surface
+            // there.
+            void enableParallelCompression(const int numThreads);
+
             void commit();
-            
+
+        private:
+            struct PendingEntry {
+                std::string name;
+                std::vector<uint8_t> data;
+            };
+
+            struct CompressedEntry {
+                ~CompressedEntry();
+
+                std::string name;
+
+                // Raw deflate stream, or empty when the entry is stored
+                void* compressedData = nullptr;
+                size_t compressedSize = 0;
+
+                std::vector<uint8_t> storedData;
+                size_t uncompressedSize = 0;
+                uint32_t crc32 = 0;
+            };
+
+            void doCompress();
+            void doWrite();
+            void addEntry(const CompressedEntry& entry);
+            void finishParallelCompression();
+
         private:
             mz_zip_archive mZip;
             FILE* mFile;
             bool mCommited;
+
+            // Parallel compression state; idle unless enabled
+            std::vector<std::unique_ptr<std::thread>> mCompressThreads;
+            std::unique_ptr<std::thread> mWriteThread;
+            std::atomic<bool> mCompressRunning;
+            std::atomic<int> mEntriesInFlight;
+            moodycamel::BlockingConcurrentQueue<std::shared_ptr<PendingEntry>> mPendingEntries;
+            moodycamel::BlockingConcurrentQueue<std::shared_ptr<CompressedEntry>> mCompressedEntries;
+
+            std::mutex mErrorMutex;
+            std::string mCompressError;
         };
 
         class ZipReader {
@@ -61,17 +145,40 @@ namespace motioncam {
             
             void read(const std::string& filename, std::string& output);
             void read(const std::string& filename, std::vector<uint8_t>& output);
-            
+
+            // Returns a view into the mapped archive for stored
+            // (uncompressed) entries, skipping the extract copy. Fails when
+            // the archive couldn't be mapped or the entry is compressed;
+            // callers fall back to read(). The view stays valid for the
+            // lifetime of the reader.
+            bool view(const std::string& filename, const uint8_t*& outData, size_t& outSize);
+
             const std::vector<std::string>& getFiles() const;
-            
+
         private:
+            bool tryMap(const int fd);
+
             mz_zip_archive mZip;
             FILE* mFile;
+            const uint8_t* mMapped;
+            size_t mMappedSize;
             std::vector<std::string> mFiles;
         };
 
         void ReadCompressedFile(const std::string& inputPath, std::vector<uint8_t>& output);
         void WriteCompressedFile(const std::vector<uint8_t>& data, const std::string& outputPath);
+
+        // Streaming variants of the compressed file helpers. The sink is
+        // called with each decompressed chunk as it is produced, and the
+        // source fills chunks on demand (returning the number of bytes
+        // written; a short chunk ends the payload), so large blobs stream
+        // through a pair of fixed-size buffers instead of being materialized
+        // whole. A sink returning false aborts the read. The vector based
+        // helpers above are built on these.
+        void ReadCompressedFile(const std::string& inputPath,
+                                const std::function<bool(const uint8_t* data, size_t size)>& sink);
+        void WriteCompressedFile(const std::function<size_t(uint8_t* data, size_t capacity)>& source,
+                                 const std::string& outputPath);
         void ReadFile(const std::string& inputPath, std::vector<uint8_t>& output);
         void WriteFile(const uint8_t* data, size_t size, const std::string& outputPath);
         json11::Json ReadJsonFromFile(const std::string& path);
@@ -96,6 +203,16 @@ namespace motioncam {
                       const bool saveShadingMap,
                       const int fd);
 
+        // Encodes the DNG into a byte vector instead of a file, for callers
+        // that hand the finished stream to a separate writer
+        void WriteDng(const cv::Mat& rawImage,
+                      const RawCameraMetadata& cameraMetadata,
+                      const RawImageMetadata& imageMetadata,
+                      const ScreenOrientation orientation,
+                      const bool enableCompression,
+                      const bool saveShadingMap,
+                      std::vector<uint8_t>& output);
+
         void WriteDng(const cv::Mat& rawImage,
                       const RawCameraMetadata& cameraMetadata,
                       const RawImageMetadata& imageMetadata,
@@ -112,16 +229,13 @@ namespace motioncam {
         double GetOptionalSetting(const json11::Json& json, const std::string& key, const double defaultValue);
         bool GetOptionalSetting(const json11::Json& json, const std::string& key, const bool defaultValue);
     
-        void GetNearestBuffers(
-            const std::vector<std::unique_ptr<RawContainer>>& containers,
-            const std::vector<ContainerFrame>& orderedFrames,
-            const int startIdx,
-            const int numBuffers,
-            std::vector<std::shared_ptr<RawImageBuffer>>& outNearestBuffers);
-    
         void GetOrderedFrames(
             const std::vector<std::unique_ptr<RawContainer>>& containers,
             std::vector<ContainerFrame>& outOrderedFrames);
+
+        void GetOrderedFrames(
+            const std::vector<RawContainer*>& containers,
+            std::vector<ContainerFrame>& outOrderedFrames);
     
         std::string toString(const ColorFilterArrangment& sensorArrangment);
         std::string toString(const PixelFormat& format);
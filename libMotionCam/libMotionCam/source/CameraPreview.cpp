@@ -39,7 +39,11 @@ namespace motioncam {
                                  const int downscaleFactor,
                                  const float shadingMapCorrection,
                                  Halide::Runtime::Buffer<uint8_t>& inputBuffer,
-                                 Halide::Runtime::Buffer<uint8_t>& outputBuffer)
+                                 Halide::Runtime::Buffer<uint8_t>& outputBuffer,
+                                 const bool zebraEnabled,
+                                 const float zebraThreshold,
+                                 const bool peakingEnabled,
+                                 const float peakingThreshold)
     {
         int width = rawBuffer.width / 2 / downscaleFactor;
         int height = rawBuffer.height / 2 / downscaleFactor;
@@ -141,8 +145,12 @@ namespace motioncam {
                        shadingMapBuffer[3],
                        static_cast<int>(cameraMetadata.sensorArrangment),
                        2.2f,
+                       zebraEnabled,
+                       zebraThreshold,
+                       peakingEnabled,
+                       peakingThreshold,
                        outputBuffer);
-        
+
         outputBuffer.device_sync();
     }
 
@@ -151,6 +159,7 @@ namespace motioncam {
                                  const int downscaleFactor,
                                  const float shadingMapCorrection,
                                  const bool flipped,
+                                 const ScreenOrientation orientation,
                                  const float shadows,
                                  const float contrast,
                                  const float saturation,
@@ -160,7 +169,15 @@ namespace motioncam {
                                  const float tintOffset,
                                  const float tonemapVariance,
                                  Halide::Runtime::Buffer<uint8_t>& inputBuffer,
-                                 Halide::Runtime::Buffer<uint8_t>& outputBuffer)
+                                 Halide::Runtime::Buffer<uint8_t>& outputBuffer,
+                                 const float temporalBlend,
+                                 const int motionX,
+                                 const int motionY,
+                                 Halide::Runtime::Buffer<uint8_t>* previousOutputBuffer,
+                                 const bool zebraEnabled,
+                                 const float zebraThreshold,
+                                 const bool peakingEnabled,
+                                 const float peakingThreshold)
     {
         ///Measure measure("cameraPreview()");
         
@@ -242,6 +259,36 @@ namespace motioncam {
         const auto& whiteLevel = cameraMetadata.getWhiteLevel(rawBuffer.metadata);
         const auto& blackLevel = cameraMetadata.getBlackLevel(rawBuffer.metadata);
 
+        // The rotation is folded into the preview pipeline. For 90/270 degree
+        // rotations the output buffer is expected to have swapped extents.
+        int rotation;
+
+        switch(orientation) {
+            case ScreenOrientation::PORTRAIT:
+                rotation = 1;
+                break;
+
+            case ScreenOrientation::REVERSE_LANDSCAPE:
+                rotation = 2;
+                break;
+
+            case ScreenOrientation::REVERSE_PORTRAIT:
+                rotation = 3;
+                break;
+
+            default:
+            case ScreenOrientation::LANDSCAPE:
+                rotation = 0;
+                break;
+        }
+
+        // Without a previous frame the output feeds back on itself with a
+        // zero blend weight, which leaves the result untouched
+        Halide::Runtime::Buffer<uint8_t>& previousOutput =
+            previousOutputBuffer ? *previousOutputBuffer : outputBuffer;
+
+        const float blend = previousOutputBuffer ? temporalBlend : 0.0f;
+
         camera_preview(inputBuffer,
                        rawBuffer.rowStride,
                        rawBuffer.metadata.asShot[0],
@@ -252,6 +299,7 @@ namespace motioncam {
                        shadingMapScale[2],
                        cameraToSrgbBuffer,
                        flipped,
+                       rotation,
                        width,
                        height,
                        blackLevel[0],
@@ -271,8 +319,16 @@ namespace motioncam {
                        whitePoint,
                        contrast,
                        saturation,
+                       previousOutput,
+                       blend,
+                       motionX,
+                       motionY,
+                       zebraEnabled,
+                       zebraThreshold,
+                       peakingEnabled,
+                       peakingThreshold,
                        outputBuffer);
-        
+
         outputBuffer.device_sync();
     }
 }
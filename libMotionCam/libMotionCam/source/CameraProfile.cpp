@@ -7,13 +7,41 @@
 #include "motioncam/RawCameraMetadata.h"
 
 #include <json11/json11.hpp>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <tuple>
 #include <vector>
 
 using json11::Json;
 using std::vector;
 
 namespace motioncam {
-    
+    // White balance estimation runs a fixed point iteration
+    // (cameraNeutralToXy) whose iteration count varies per frame, each step
+    // interpolating and inverting a matrix; on the preview path that shows
+    // up as frame time jitter. The as-shot neutral moves slowly, so solved
+    // temperatures are cached keyed by the quantized neutral (1/4096 steps,
+    // below the 3A's own noise) and the profile's matrices; a steady scene
+    // is a lookup.
+    struct NeutralTemperatureKey {
+        int neutral0;
+        int neutral1;
+        int neutral2;
+        int profileFingerprint;
+
+        bool operator<(const NeutralTemperatureKey& other) const {
+            return std::tie(neutral0, neutral1, neutral2, profileFingerprint) <
+                   std::tie(other.neutral0, other.neutral1, other.neutral2, other.profileFingerprint);
+        }
+    };
+
+    const static int NEUTRAL_TEMPERATURE_CACHE_MAX_ENTRIES = 64;
+
+    static std::mutex gNeutralTemperatureCacheMutex;
+    static std::map<NeutralTemperatureKey, Temperature> gNeutralTemperatureCache;
+
+
     CameraProfile::CameraProfile(const RawCameraMetadata& cameraMetadata, const RawImageMetadata& imageMetadata) {
         cv::Mat calibration1 =
             imageMetadata.calibrationMatrix1.empty() ? cameraMetadata.calibrationMatrix1 : imageMetadata.calibrationMatrix1;
@@ -316,10 +344,47 @@ namespace motioncam {
             throw InvalidState("Camera white balance vector is zero");
         }
 
+        NeutralTemperatureKey key;
+
+        key.neutral0 = (int) std::lround(asShot[0] * 4096.0f);
+        key.neutral1 = (int) std::lround(asShot[1] * 4096.0f);
+        key.neutral2 = (int) std::lround(asShot[2] * 4096.0f);
+        key.profileFingerprint = fingerprint();
+
+        {
+            std::lock_guard<std::mutex> lock(gNeutralTemperatureCacheMutex);
+
+            auto it = gNeutralTemperatureCache.find(key);
+            if(it != gNeutralTemperatureCache.end()) {
+                outTemperature = it->second;
+                return;
+            }
+        }
+
         // Get our matrices for the as shot white balance
         XYCoord neutralXy = cameraNeutralToXy(asShot);
 
         outTemperature = Temperature(neutralXy);
+
+        {
+            std::lock_guard<std::mutex> lock(gNeutralTemperatureCacheMutex);
+
+            // The working set is a handful of white points
+            if(gNeutralTemperatureCache.size() >= NEUTRAL_TEMPERATURE_CACHE_MAX_ENTRIES)
+                gNeutralTemperatureCache.clear();
+
+            gNeutralTemperatureCache[key] = outTemperature;
+        }
+    }
+
+    int CameraProfile::fingerprint() const {
+        // Weighted sums of the matrices the solve depends on; enough to tell
+        // devices and per-frame calibrations apart
+        const float sum =
+            (float) cv::sum(mColorMatrix1)[0] +
+            16.0f * (float) cv::sum(mCameraCalibration1)[0];
+
+        return (int) std::lround(sum * 4096.0f);
     }
     
     void CameraProfile::cameraToPcs(const Temperature& temperature,
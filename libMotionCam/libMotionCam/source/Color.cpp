@@ -2,6 +2,7 @@
 #include "motioncam/Math.h"
 #include "motioncam/Exceptions.h"
 
+#include <cmath>
 #include <string>
 
 using std::string;
@@ -118,6 +119,66 @@ namespace motioncam {
             throw InvalidState("Invalid illuminant " + illuminant);
         }
         
+        static float EncodeSRGB(const float linear) {
+            if(linear <= 0.0031308f)
+                return 12.92f * linear;
+
+            return 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+        }
+
+        static float DecodeSRGB(const float srgb) {
+            if(srgb <= 0.04045f)
+                return srgb / 12.92f;
+
+            return std::pow((srgb + 0.055f) / 1.055f, 2.4f);
+        }
+
+        namespace {
+            // Built once on first use; the accurate curves above only run
+            // at table build time
+            struct TransferTables {
+                TransferTables() {
+                    for(int i = 0; i < TRANSFER_LUT_SIZE; i++) {
+                        const float v = i / static_cast<float>(TRANSFER_LUT_SIZE - 1);
+
+                        toSRGB[i]   = EncodeSRGB(v);
+                        toLinear[i] = DecodeSRGB(v);
+                        toSRGB8[i]  = static_cast<uint8_t>(255.0f * toSRGB[i] + 0.5f);
+                    }
+                }
+
+                float toSRGB[TRANSFER_LUT_SIZE];
+                float toLinear[TRANSFER_LUT_SIZE];
+                uint8_t toSRGB8[TRANSFER_LUT_SIZE];
+            };
+
+            const TransferTables& Tables() {
+                static TransferTables tables;
+                return tables;
+            }
+
+            float LookupInterpolated(const float* table, const float x) {
+                const float pos = math::clamp<float>(0.0f, x, 1.0f) * (TRANSFER_LUT_SIZE - 1);
+                const int i = static_cast<int>(pos);
+                const int j = (std::min)(i + 1, TRANSFER_LUT_SIZE - 1);
+                const float t = pos - i;
+
+                return table[i] + t * (table[j] - table[i]);
+            }
+        }
+
+        float LinearToSRGB(const float linear) {
+            return LookupInterpolated(Tables().toSRGB, linear);
+        }
+
+        float SRGBToLinear(const float srgb) {
+            return LookupInterpolated(Tables().toLinear, srgb);
+        }
+
+        const uint8_t* LinearToSRGB8Table() {
+            return Tables().toSRGB8;
+        }
+
         float IlluminantToTemperature(const Illuminant illuminant) {
             switch(illuminant) {
                 case Illuminant::D50:
@@ -0,0 +1,765 @@
+#include "motioncam/Util.h"
+#include "motioncam/Exceptions.h"
+#include "motioncam/RawImageMetadata.h"
+#include "motioncam/RawCameraMetadata.h"
+#include "motioncam/Measure.h"
+#include "motioncam/TaskEngine.h"
+#include "motioncam/HalidePool.h"
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+    #include <unistd.h>
+#endif
+
+#include <cstring>
+#include <thread>
+
+#include <dng/dng_host.h>
+#include <dng/dng_area_task.h>
+#include <dng/dng_negative.h>
+#include <dng/dng_camera_profile.h>
+#include <dng/dng_file_stream.h>
+#include <dng/dng_memory_stream.h>
+#include <dng/dng_image_writer.h>
+#include <dng/dng_render.h>
+#include <dng/dng_gain_map.h>
+#include <dng/dng_exif.h>
+#include <dng/dng_preview.h>
+#include <dng/dng_exceptions.h>
+
+using std::string;
+using std::vector;
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+
+class dng_fd_stream : public dng_stream {
+public:
+    dng_fd_stream(const int fd, bool output) :
+        dng_stream ((dng_abort_sniffer *) nullptr, kDefaultBufferSize, 0),
+    fFd(fd)
+    {
+        if(fd < 0)
+            ThrowFileIsDamaged();
+    }
+    
+    ~dng_fd_stream () override {
+        if (fFd < 0)
+            return;
+
+        fsync(fFd);
+        close(fFd);
+    }
+
+    uint64 DoGetLength () override {
+        if (lseek (fFd, 0, SEEK_END) < 0) {
+            ThrowReadFile ();
+        }
+        
+        return (uint64) lseek(fFd, 0, SEEK_CUR);
+    }
+            
+    void DoRead(void *data, uint32 count, uint64 offset) override {
+        if (lseek (fFd, (long) offset, SEEK_SET) < 0) {
+            ThrowReadFile ();
+        }
+        
+        auto bytesRead = (uint32) read (fFd, data, count);
+        
+        if (bytesRead != count) {
+            ThrowReadFile ();
+        }
+    }
+    
+    void DoWrite(const void *data, uint32 count, uint64 offset) override {
+        if (lseek (fFd, (uint32) offset, SEEK_SET) < 0) {
+            ThrowWriteFile ();
+        }
+                
+        auto bytesWritten = (uint32) write (fFd, data, count);
+
+        if (bytesWritten != count) {
+            ThrowWriteFile ();
+        }
+    }
+    
+private:
+    int fFd;
+};
+
+#endif
+
+// Writes into a caller owned byte vector, for paths that encode the DNG in
+// memory before handing it off.
+class dng_vector_stream : public dng_stream {
+public:
+    dng_vector_stream(std::vector<uint8_t>& output) :
+        dng_stream ((dng_abort_sniffer *) nullptr, kDefaultBufferSize, 0),
+    fOutput(output)
+    {
+    }
+
+    uint64 DoGetLength () override {
+        return fOutput.size();
+    }
+
+    void DoRead(void *data, uint32 count, uint64 offset) override {
+        if (offset + count > fOutput.size()) {
+            ThrowReadFile ();
+        }
+
+        std::memcpy(data, fOutput.data() + offset, count);
+    }
+
+    void DoWrite(const void *data, uint32 count, uint64 offset) override {
+        if (offset + count > fOutput.size())
+            fOutput.resize(offset + count);
+
+        std::memcpy(fOutput.data() + offset, data, count);
+    }
+
+private:
+    std::vector<uint8_t>& fOutput;
+};
+
+// dng_memory_block whose storage comes from the shared halide pool, so the
+// writer's arena allocations (stage images, tile compression scratch) are
+// recycled across frames instead of hitting the system allocator once per
+// frame of a clip.
+class dng_pool_memory_block : public dng_memory_block {
+public:
+    dng_pool_memory_block (uint32 logicalSize) :
+        dng_memory_block (logicalSize),
+        fMemory (motioncam::halidepool::PoolMalloc (PhysicalSize ()))
+    {
+        if (!fMemory)
+            ThrowMemoryFull ();
+
+        SetBuffer (fMemory);
+    }
+
+    ~dng_pool_memory_block () override {
+        motioncam::halidepool::PoolFree (fMemory);
+    }
+
+private:
+    void *fMemory;
+};
+
+class dng_pool_allocator : public dng_memory_allocator {
+public:
+    dng_memory_block * Allocate (uint32 size) override {
+        return new dng_pool_memory_block (size);
+    }
+};
+
+static dng_pool_allocator gPoolAllocator;
+
+// dng_host that runs area tasks on the shared task engine instead of inline.
+// The writer only enables multithreaded tile compression when
+// PerformAreaTaskThreads() > 1, so with the stock single threaded host every
+// DNG is compressed on one thread. Scheduling the per-thread partitions as
+// export tasks parallelises the tiles without adding threads of its own, so
+// concurrent writers stay bounded by the engine rather than multiplying.
+class dng_task_engine_host : public dng_host {
+public:
+    dng_task_engine_host () : dng_host (&gPoolAllocator) {
+    }
+
+    uint32 PerformAreaTaskThreads () override {
+        return (uint32) (std::max)(1, motioncam::TaskEngine::get().numWorkers());
+    }
+
+    void PerformAreaTask (dng_area_task &task, const dng_rect &area) override {
+        const uint32 threadCount = (std::min)(task.MaxThreads(), PerformAreaTaskThreads());
+
+        if (threadCount <= 1) {
+            dng_area_task::Perform (task, area, &Allocator (), Sniffer ());
+            return;
+        }
+
+        const dng_point tileSize (task.FindTileSize (area));
+
+        // One strip per thread along the dimension with the most tiles, with
+        // strip edges on tile boundaries. The writer passes a synthetic area
+        // that is a single tile tall, so the split axis can't be fixed.
+        const int32 tilesAcross = (int32) ((area.W () + tileSize.h - 1) / tileSize.h);
+        const int32 tilesDown   = (int32) ((area.H () + tileSize.v - 1) / tileSize.v);
+
+        std::vector<dng_rect> strips;
+
+        if (tilesDown >= tilesAcross) {
+            const int32 stripSize = ((tilesDown + (int32) threadCount - 1) / (int32) threadCount) * tileSize.v;
+
+            for (int32 t = area.t; t < area.b; t += stripSize) {
+                dng_rect strip = area;
+
+                strip.t = t;
+                strip.b = (std::min)(area.b, t + stripSize);
+
+                strips.push_back (strip);
+            }
+        }
+        else {
+            const int32 stripSize = ((tilesAcross + (int32) threadCount - 1) / (int32) threadCount) * tileSize.h;
+
+            for (int32 l = area.l; l < area.r; l += stripSize) {
+                dng_rect strip = area;
+
+                strip.l = l;
+                strip.r = (std::min)(area.r, l + stripSize);
+
+                strips.push_back (strip);
+            }
+        }
+
+        task.Start (threadCount, tileSize, &Allocator (), Sniffer ());
+
+        // dng_exception does not derive from std::exception, so it must not
+        // escape into the engine. Record the first error and rethrow it on
+        // the calling thread once the group has drained.
+        std::atomic<int32> errorCode ((int32) dng_error_none);
+
+        motioncam::TaskGroup group;
+
+        for (size_t i = 0; i < strips.size (); i++) {
+            const dng_rect strip = strips [i];
+            const uint32 threadIndex = (uint32) i;
+
+            motioncam::TaskEngine::get().run(motioncam::TaskPriority::EXPORT,
+                [this, &task, tileSize, strip, threadIndex, &errorCode] {
+                    try {
+                        task.ProcessOnThread (threadIndex, strip, tileSize, Sniffer ());
+                    }
+
+                    catch (const dng_exception &except) {
+                        int32 expected = (int32) dng_error_none;
+                        errorCode.compare_exchange_strong (expected, (int32) except.ErrorCode ());
+                    }
+
+                    catch (...) {
+                        int32 expected = (int32) dng_error_none;
+                        errorCode.compare_exchange_strong (expected, (int32) dng_error_unknown);
+                    }
+                }, group);
+        }
+
+        group.wait ();
+
+        task.Finish (threadCount);
+
+        if (errorCode != (int32) dng_error_none)
+            Throw_dng_error ((dng_error_code) errorCode.load ());
+    }
+};
+
+namespace motioncam {
+    namespace util {
+        static const int PREVIEW_WIDTH = 512;
+
+        // Per-thread writer state, constructed once and reused for every
+        // frame the thread writes. The host and writer carry no per-frame
+        // state and their allocator draws from the shared pool above, so a
+        // long clip recycles the same arenas instead of rebuilding the
+        // dng_sdk object graph per frame.
+        struct WriteDngContext {
+            dng_task_engine_host host;
+            dng_image_writer writer;
+        };
+
+        static WriteDngContext& LocalWriteDngContext() {
+            thread_local WriteDngContext context;
+
+            return context;
+        }
+
+        // Builds a small RGB preview from the raw bayer data. This is a cheap
+        // downscale rather than a full render and runs on a worker thread,
+        // concurrent with building the main image.
+        static cv::Mat BuildPreviewImage(const cv::Mat& rawImage,
+                                         const RawCameraMetadata& cameraMetadata,
+                                         const RawImageMetadata& imageMetadata)
+        {
+            const float whiteLevel = cameraMetadata.getWhiteLevel(imageMetadata);
+            const auto& blackLevel = cameraMetadata.getBlackLevel(imageMetadata);
+
+            const int halfWidth  = rawImage.cols / 2;
+            const int halfHeight = rawImage.rows / 2;
+
+            // Offsets of the red/green/blue samples within the bayer quad
+            int rOffset, g0Offset, g1Offset, bOffset;
+
+            switch(cameraMetadata.sensorArrangment) {
+                case ColorFilterArrangment::GRBG:
+                    g0Offset = 0; rOffset = 1; bOffset = 2; g1Offset = 3;
+                    break;
+
+                default:
+                case ColorFilterArrangment::RGGB:
+                    rOffset = 0; g0Offset = 1; g1Offset = 2; bOffset = 3;
+                    break;
+
+                case ColorFilterArrangment::BGGR:
+                    bOffset = 0; g0Offset = 1; g1Offset = 2; rOffset = 3;
+                    break;
+
+                case ColorFilterArrangment::GBRG:
+                    g0Offset = 0; bOffset = 1; rOffset = 2; g1Offset = 3;
+                    break;
+            }
+
+            const float rScale = 1.0f / (std::max)(1e-5f, imageMetadata.asShot[0]);
+            const float bScale = 1.0f / (std::max)(1e-5f, imageMetadata.asShot[2]);
+
+            cv::Mat halfImage(halfHeight, halfWidth, CV_8UC3);
+
+            for(int y = 0; y < halfHeight; y++) {
+                const uint16_t* row0 = rawImage.ptr<uint16_t>(y * 2);
+                const uint16_t* row1 = rawImage.ptr<uint16_t>(y * 2 + 1);
+                const uint16_t* rows[2] = { row0, row1 };
+
+                uint8_t* dst = halfImage.ptr<uint8_t>(y);
+
+                for(int x = 0; x < halfWidth; x++) {
+                    float p[4];
+
+                    for(int c = 0; c < 4; c++) {
+                        const int dy = c / 2;
+                        const int dx = c % 2;
+
+                        p[c] = (rows[dy][x*2 + dx] - blackLevel[c]) / (whiteLevel - blackLevel[c]);
+                    }
+
+                    const float r = rScale * p[rOffset];
+                    const float g = 0.5f * (p[g0Offset] + p[g1Offset]);
+                    const float b = bScale * p[bOffset];
+
+                    // Approximate gamma
+                    dst[x*3 + 0] = static_cast<uint8_t>(255.0f * std::sqrt((std::min)(1.0f, (std::max)(0.0f, r))) + 0.5f);
+                    dst[x*3 + 1] = static_cast<uint8_t>(255.0f * std::sqrt((std::min)(1.0f, (std::max)(0.0f, g))) + 0.5f);
+                    dst[x*3 + 2] = static_cast<uint8_t>(255.0f * std::sqrt((std::min)(1.0f, (std::max)(0.0f, b))) + 0.5f);
+                }
+            }
+
+            cv::Mat preview;
+
+            if(halfImage.cols > PREVIEW_WIDTH) {
+                const int previewHeight = (PREVIEW_WIDTH * halfImage.rows) / halfImage.cols;
+                cv::resize(halfImage, preview, cv::Size(PREVIEW_WIDTH, previewHeight), 0, 0, cv::INTER_AREA);
+            }
+            else {
+                preview = halfImage;
+            }
+
+            return preview;
+        }
+
+        void WriteDng(cv::Mat rawImage,
+                      const RawCameraMetadata& cameraMetadata,
+                      const RawImageMetadata& imageMetadata,
+                      const ScreenOrientation orientation,
+                      const bool enableCompression,
+                      const bool saveShadingMap,
+                      dng_stream& dngStream)
+        {
+            Measure m{"WriteDng"};
+
+            const int width  = rawImage.cols;
+            const int height = rawImage.rows;
+            
+            // Compress tiles on the shared task engine, so concurrent writers
+            // share one bounded pool instead of each compressing serially
+            dng_task_engine_host& host = LocalWriteDngContext().host;
+
+            host.SetSaveLinearDNG(false);
+            host.SetSaveDNGVersion(dngVersion_SaveDefault);
+            
+            AutoPtr<dng_negative> negative(host.Make_dng_negative());
+            
+            auto whiteLevel = cameraMetadata.getWhiteLevel(imageMetadata);
+            const auto& blackLevel = cameraMetadata.getBlackLevel(imageMetadata);
+            
+            // Create lens shading map for each channel
+            if(saveShadingMap) {
+                // Rearrange the shading map channels to match the sensor layout
+                const auto& rggbShadingMap = imageMetadata.shadingMap();
+                
+                for(int c = 0; c < 4; c++) {
+                    dng_point channelGainMapPoints(rggbShadingMap[c].rows, rggbShadingMap[c].cols);
+
+                    AutoPtr<dng_gain_map> gainMap(new dng_gain_map(host.Allocator(),
+                                                                   channelGainMapPoints,
+                                                                   dng_point_real64(1.0 / (rggbShadingMap[c].rows),
+                                                                                    1.0 / (rggbShadingMap[c].cols)),
+                                                                   dng_point_real64(0, 0),
+                                                                   1));
+
+                    for(int y = 0; y < rggbShadingMap[c].rows; y++) {
+                        for(int x = 0; x < rggbShadingMap[c].cols; x++) {
+                            gainMap->Entry(y, x, 0) = rggbShadingMap[c].at<float>(y, x);
+                        }
+                    }
+
+                    int left = 0;
+                    int top  = 0;
+
+                    if(c == 0) {
+                        left = 0;
+                        top = 0;
+                    }
+                    else if(c == 1) {
+                        left = 1;
+                        top = 0;
+                    }
+                    else if(c == 2) {
+                        left = 0;
+                        top = 1;
+                    }
+                    else if(c == 3) {
+                        left = 1;
+                        top = 1;
+                    }
+
+                    dng_rect gainMapArea(top, left, height, width);
+                    AutoPtr<dng_opcode> gainMapOpCode(new dng_opcode_GainMap(dng_area_spec(gainMapArea, 0, 1, 2, 2), gainMap));
+
+                    negative->OpcodeList2().Append(gainMapOpCode);
+                }
+            }
+            
+            negative->SetModelName("MotionCam");
+            negative->SetLocalName("MotionCam");
+            
+            negative->SetColorKeys(colorKeyRed, colorKeyGreen, colorKeyBlue);
+            
+            uint32_t phase;
+                        
+            switch(cameraMetadata.sensorArrangment) {
+                case ColorFilterArrangment::GRBG:
+                    phase = 0;
+                    break;
+
+                default:
+                case ColorFilterArrangment::RGGB:
+                    phase = 1;
+                    break;
+
+                case ColorFilterArrangment::BGGR:
+                    phase = 2;
+                    break;
+                    
+                case ColorFilterArrangment::GBRG:
+                    phase = 3;
+                    break;
+            }
+            
+            negative->SetBayerMosaic(phase);
+            negative->SetColorChannels(3);
+                        
+            negative->SetQuadBlacks(blackLevel[0],
+                                    blackLevel[1],
+                                    blackLevel[2],
+                                    blackLevel[3]);
+            
+            negative->SetWhiteLevel(whiteLevel);
+            
+            // Square pixels
+            negative->SetDefaultScale(dng_urational(1,1), dng_urational(1,1));
+            
+            negative->SetDefaultCropSize(width, height);
+            negative->SetCameraNeutral(dng_vector_3(imageMetadata.asShot[0], imageMetadata.asShot[1], imageMetadata.asShot[2]));
+
+            // Set metadata
+            auto exif = negative->Metadata().GetExif();
+
+            exif->SetExposureTime(imageMetadata.exposureTime / 1.0e9);
+            exif->fISOSpeedRatings[0] = imageMetadata.iso;
+            exif->fISOSpeedRatings[1] = imageMetadata.iso;
+            exif->fISOSpeedRatings[2] = imageMetadata.iso;
+            exif->SetApertureValue(cameraMetadata.apertures[0]);
+                        
+            dng_orientation dngOrientation;
+            
+            switch(orientation)
+            {
+                default:
+                case ScreenOrientation::PORTRAIT:
+                    dngOrientation = dng_orientation::Rotate90CW();
+                    break;
+                
+                case ScreenOrientation::REVERSE_PORTRAIT:
+                    dngOrientation = dng_orientation::Rotate90CCW();
+                    break;
+                    
+                case ScreenOrientation::LANDSCAPE:
+                    dngOrientation = dng_orientation::Normal();
+                    break;
+                    
+                case ScreenOrientation::REVERSE_LANDSCAPE:
+                    dngOrientation = dng_orientation::Rotate180();
+                    break;
+            }
+            
+            negative->SetBaseOrientation(dngOrientation);
+
+            // Set up camera profile
+            AutoPtr<dng_camera_profile> cameraProfile(new dng_camera_profile());
+            
+            // Color matrices
+            cv::Mat color1 = cameraMetadata.colorMatrix1;
+            cv::Mat color2 = cameraMetadata.colorMatrix2;
+            
+            dng_matrix_3by3 dngColor1 = dng_matrix_3by3(color1.at<float>(0, 0), color1.at<float>(0, 1), color1.at<float>(0, 2),
+                                                        color1.at<float>(1, 0), color1.at<float>(1, 1), color1.at<float>(1, 2),
+                                                        color1.at<float>(2, 0), color1.at<float>(2, 1), color1.at<float>(2, 2));
+            
+            dng_matrix_3by3 dngColor2 = dng_matrix_3by3(color2.at<float>(0, 0), color2.at<float>(0, 1), color2.at<float>(0, 2),
+                                                        color2.at<float>(1, 0), color2.at<float>(1, 1), color2.at<float>(1, 2),
+                                                        color2.at<float>(2, 0), color2.at<float>(2, 1), color2.at<float>(2, 2));
+            
+            cameraProfile->SetColorMatrix1(dngColor1);
+            cameraProfile->SetColorMatrix2(dngColor2);
+            
+            // Forward matrices
+            cv::Mat forward1 = cameraMetadata.forwardMatrix1;
+            cv::Mat forward2 = cameraMetadata.forwardMatrix2;
+            
+            if(!forward1.empty() && !forward2.empty()) {
+                dng_matrix_3by3 dngForward1 = dng_matrix_3by3( forward1.at<float>(0, 0), forward1.at<float>(0, 1), forward1.at<float>(0, 2),
+                                                               forward1.at<float>(1, 0), forward1.at<float>(1, 1), forward1.at<float>(1, 2),
+                                                               forward1.at<float>(2, 0), forward1.at<float>(2, 1), forward1.at<float>(2, 2) );
+                
+                dng_matrix_3by3 dngForward2 = dng_matrix_3by3( forward2.at<float>(0, 0), forward2.at<float>(0, 1), forward2.at<float>(0, 2),
+                                                               forward2.at<float>(1, 0), forward2.at<float>(1, 1), forward2.at<float>(1, 2),
+                                                               forward2.at<float>(2, 0), forward2.at<float>(2, 1), forward2.at<float>(2, 2) );
+                
+                cameraProfile->SetForwardMatrix1(dngForward1);
+                cameraProfile->SetForwardMatrix2(dngForward2);
+            }
+
+            // Set camera calibration matrix
+            cv::Mat calibration1 = cameraMetadata.calibrationMatrix1;
+            cv::Mat calibration2 = cameraMetadata.calibrationMatrix2;
+
+            if(!calibration1.empty() && !calibration2.empty()) {
+                dng_matrix_3by3 dngCalibration1 = dng_matrix_3by3( calibration1.at<float>(0, 0), calibration1.at<float>(0, 1), calibration1.at<float>(0, 2),
+                                                                   calibration1.at<float>(1, 0), calibration1.at<float>(1, 1), calibration1.at<float>(1, 2),
+                                                                   calibration1.at<float>(2, 0), calibration1.at<float>(2, 1), calibration1.at<float>(2, 2) );
+                
+                dng_matrix_3by3 dngCalibration2 = dng_matrix_3by3( calibration2.at<float>(0, 0), calibration2.at<float>(0, 1), calibration2.at<float>(0, 2),
+                                                                   calibration2.at<float>(1, 0), calibration2.at<float>(1, 1), calibration2.at<float>(1, 2),
+                                                                   calibration2.at<float>(2, 0), calibration2.at<float>(2, 1), calibration2.at<float>(2, 2) );
+                
+                negative->SetCameraCalibration1(dngCalibration1);
+                negative->SetCameraCalibration2(dngCalibration2);
+            }
+            
+            uint32_t illuminant1 = 0;
+            uint32_t illuminant2 = 0;
+            
+            // Convert to DNG format
+            switch(cameraMetadata.colorIlluminant1) {
+                case color::StandardA:
+                    illuminant1 = lsStandardLightA;
+                    break;
+                case color::StandardB:
+                    illuminant1 = lsStandardLightB;
+                    break;
+                case color::StandardC:
+                    illuminant1 = lsStandardLightC;
+                    break;
+                case color::D50:
+                    illuminant1 = lsD50;
+                    break;
+                case color::D55:
+                    illuminant1 = lsD55;
+                    break;
+                case color::D65:
+                    illuminant1 = lsD65;
+                    break;
+                case color::D75:
+                    illuminant1 = lsD75;
+                    break;
+            }
+            
+            switch(cameraMetadata.colorIlluminant2) {
+                case color::StandardA:
+                    illuminant2 = lsStandardLightA;
+                    break;
+                case color::StandardB:
+                    illuminant2 = lsStandardLightB;
+                    break;
+                case color::StandardC:
+                    illuminant2 = lsStandardLightC;
+                    break;
+                case color::D50:
+                    illuminant2 = lsD50;
+                    break;
+                case color::D55:
+                    illuminant2 = lsD55;
+                    break;
+                case color::D65:
+                    illuminant2 = lsD65;
+                    break;
+                case color::D75:
+                    illuminant2 = lsD75;
+                    break;
+            }
+            
+            cameraProfile->SetCalibrationIlluminant1(illuminant1);
+            cameraProfile->SetCalibrationIlluminant2(illuminant2);
+            
+            cameraProfile->SetName("MotionCam");
+            cameraProfile->SetEmbedPolicy(pepAllowCopying);
+            
+            // This ensures profile is saved
+            cameraProfile->SetWasReadFromDNG();
+            
+            negative->AddProfile(cameraProfile);
+            
+            // Finally add the raw data to the negative
+            dng_rect dngArea(height, width);
+            dng_pixel_buffer dngBuffer;
+
+            AutoPtr<dng_image> dngImage(host.Make_dng_image(dngArea, 1, ttShort));
+
+            dngBuffer.fArea         = dngArea;
+            dngBuffer.fPlane        = 0;
+            dngBuffer.fPlanes       = 1;
+            dngBuffer.fRowStep      = dngBuffer.fPlanes * width;
+            dngBuffer.fColStep      = dngBuffer.fPlanes;
+            dngBuffer.fPixelType    = ttShort;
+            dngBuffer.fPixelSize    = TagTypeSize(ttShort);
+            dngBuffer.fData         = rawImage.ptr();
+            
+            dngImage->Put(dngBuffer);
+
+            // Generate the embedded preview concurrently with building the
+            // main image
+            cv::Mat previewImage;
+
+            std::thread previewThread([&]() {
+                previewImage = BuildPreviewImage(rawImage, cameraMetadata, imageMetadata);
+            });
+
+            // Build the DNG images
+            negative->SetStage1Image(dngImage);
+            negative->BuildStage2Image(host);
+            negative->BuildStage3Image(host);
+
+            negative->SynchronizeMetadata();
+
+            previewThread.join();
+
+            // Stitch the preview in at write time
+            dng_preview_list previewList;
+
+            {
+                AutoPtr<dng_image_preview> imagePreview(new dng_image_preview());
+
+                dng_rect previewArea(previewImage.rows, previewImage.cols);
+
+                AutoPtr<dng_image> previewDngImage(host.Make_dng_image(previewArea, 3, ttByte));
+
+                dng_pixel_buffer previewBuffer;
+
+                previewBuffer.fArea         = previewArea;
+                previewBuffer.fPlane        = 0;
+                previewBuffer.fPlanes       = 3;
+                previewBuffer.fRowStep      = previewBuffer.fPlanes * previewImage.cols;
+                previewBuffer.fColStep      = previewBuffer.fPlanes;
+                previewBuffer.fPlaneStep    = 1;
+                previewBuffer.fPixelType    = ttByte;
+                previewBuffer.fPixelSize    = TagTypeSize(ttByte);
+                previewBuffer.fData         = previewImage.ptr();
+
+                previewDngImage->Put(previewBuffer);
+
+                imagePreview->fImage.Reset(previewDngImage.Release());
+
+                AutoPtr<dng_preview> preview(imagePreview.Release());
+                previewList.Append(preview);
+            }
+
+            // Write DNG file to disk
+            dng_image_writer& dngWriter = LocalWriteDngContext().writer;
+
+            dngWriter.WriteDNG(host, dngStream, *negative.Get(), &previewList, dngVersion_SaveDefault, !enableCompression);
+        }
+
+        void WriteDng(const cv::Mat& rawImage,
+                      const RawCameraMetadata& cameraMetadata,
+                      const RawImageMetadata& imageMetadata,
+                      const ScreenOrientation orientation,
+                      const bool enableCompression,
+                      const bool saveShadingMap,
+                      const std::string& outputPath)
+        {
+            dng_file_stream stream(outputPath.c_str(), true);
+            
+            WriteDng(rawImage, cameraMetadata, imageMetadata, orientation, enableCompression, saveShadingMap, stream);
+            
+            stream.Flush();
+        }
+
+        void WriteDng(const cv::Mat& rawImage,
+                      const RawCameraMetadata& cameraMetadata,
+                      const RawImageMetadata& imageMetadata,
+                      const ScreenOrientation orientation,
+                      const bool enableCompression,
+                      const bool saveShadingMap,
+                      const int fd)
+        {
+            #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+                dng_fd_stream stream(fd, true);
+
+                WriteDng(rawImage, cameraMetadata, imageMetadata, orientation, enableCompression, saveShadingMap, stream);
+
+                stream.Flush();
+            #endif
+        }
+
+        void WriteDng(const cv::Mat& rawImage,
+                      const RawCameraMetadata& cameraMetadata,
+                      const RawImageMetadata& imageMetadata,
+                      const ScreenOrientation orientation,
+                      const bool enableCompression,
+                      const bool saveShadingMap,
+                      std::vector<uint8_t>& output)
+        {
+            output.clear();
+
+            dng_vector_stream stream(output);
+
+            WriteDng(rawImage, cameraMetadata, imageMetadata, orientation, enableCompression, saveShadingMap, stream);
+
+            stream.Flush();
+        }
+
+        void WriteDng(const cv::Mat& rawImage,
+                      const RawCameraMetadata& cameraMetadata,
+                      const RawImageMetadata& imageMetadata,
+                      const ScreenOrientation orientation,
+                      const bool enableCompression,
+                      const bool saveShadingMap,
+                      ZipWriter& zipWriter,
+                      const std::string& outputName)
+        {
+            dng_memory_stream stream(gDefaultDNGMemoryAllocator);
+            
+            WriteDng(rawImage, cameraMetadata, imageMetadata, orientation, enableCompression, saveShadingMap, stream);
+            
+            stream.Flush();
+            
+            auto memoryBlock = stream.AsMemoryBlock(gDefaultDNGMemoryAllocator);
+            
+            try {
+                if(memoryBlock)
+                    zipWriter.addFile(outputName, memoryBlock->Buffer_uint8(), memoryBlock->LogicalSize());
+            }
+            catch(std::runtime_error& e) {
+            }
+            
+            delete memoryBlock;
+        }
+    
+    } // namespace util
+} // namespace motioncam
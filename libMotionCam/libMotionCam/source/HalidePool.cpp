@@ -0,0 +1,170 @@
+#include "motioncam/HalidePool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#if defined(__ANDROID__) || defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+namespace motioncam {
+    namespace halidepool {
+        // Halide never requires more alignment than this
+        const size_t ALIGNMENT = 128;
+
+        // Allocations are rounded up to power of two size classes starting
+        // at MIN_BLOCK_SIZE. Anything beyond the largest class bypasses the
+        // pool.
+        const int NUM_SIZE_CLASSES = 16;
+        const size_t MIN_BLOCK_SIZE = 4096;
+
+        // Cached blocks at least this large are marked MADV_FREE while
+        // they sit in a free list, so the kernel can reclaim their pages
+        // under memory pressure without the pool giving up O(1) reuse.
+        // Writes on the next checkout bring the pages back.
+        const size_t LAZY_FREE_MIN_BYTES = 4 * 1024 * 1024;
+
+        // Per-thread cap on cached memory. Blocks freed beyond this go back
+        // to the system allocator. Sized to hold the fuse accumulator and
+        // denoise planes of a full resolution export frame, now that the
+        // pipeline output buffers allocate through the pool too.
+        const size_t MAX_CACHED_BYTES = 256 * 1024 * 1024;
+
+        // Stored immediately before the pointer handed to Halide
+        struct Header {
+            void* base;
+            size_t size;
+            int sizeClass;
+        };
+
+        static std::atomic<size_t> gCachedBytes(0);
+
+        struct ThreadCache {
+            std::vector<void*> freeLists[NUM_SIZE_CLASSES];
+            size_t cachedBytes;
+
+            ThreadCache() : cachedBytes(0) {
+            }
+
+            ~ThreadCache() {
+                for(auto& freeList : freeLists) {
+                    for(void* payload : freeList) {
+                        Header* header = reinterpret_cast<Header*>(payload) - 1;
+
+                        gCachedBytes -= header->size;
+                        free(header->base);
+                    }
+                }
+            }
+        };
+
+        static thread_local ThreadCache gThreadCache;
+
+        static int SizeClassFor(const size_t size) {
+            size_t classSize = MIN_BLOCK_SIZE;
+
+            for(int i = 0; i < NUM_SIZE_CLASSES; i++) {
+                if(size <= classSize)
+                    return i;
+
+                classSize <<= 1;
+            }
+
+            return -1;
+        }
+
+        static size_t SizeOfClass(const int sizeClass) {
+            return MIN_BLOCK_SIZE << sizeClass;
+        }
+
+        void* PoolMalloc(const size_t size) {
+            const int sizeClass = SizeClassFor(size);
+
+            // Reuse a cached block of the same class if this thread has one
+            if(sizeClass >= 0) {
+                auto& freeList = gThreadCache.freeLists[sizeClass];
+
+                if(!freeList.empty()) {
+                    void* payload = freeList.back();
+                    freeList.pop_back();
+
+                    gThreadCache.cachedBytes -= SizeOfClass(sizeClass);
+                    gCachedBytes -= SizeOfClass(sizeClass);
+
+                    return payload;
+                }
+            }
+
+            const size_t payloadSize = sizeClass >= 0 ? SizeOfClass(sizeClass) : size;
+
+            auto* base = static_cast<uint8_t*>(malloc(payloadSize + sizeof(Header) + ALIGNMENT));
+
+            if(!base)
+                return nullptr;
+
+            auto payload = reinterpret_cast<uintptr_t>(base + sizeof(Header) + ALIGNMENT - 1) & ~static_cast<uintptr_t>(ALIGNMENT - 1);
+
+            Header* header = reinterpret_cast<Header*>(payload) - 1;
+
+            header->base = base;
+            header->size = payloadSize;
+            header->sizeClass = sizeClass;
+
+            return reinterpret_cast<void*>(payload);
+        }
+
+        void PoolFree(void* ptr) {
+            if(!ptr)
+                return;
+
+            Header* header = reinterpret_cast<Header*>(ptr) - 1;
+
+            // Cache pooled blocks on the freeing thread. Halide's thread pool
+            // may free on a different thread than it allocated on; the block
+            // just moves to that thread's cache.
+            if(header->sizeClass >= 0 &&
+               gThreadCache.cachedBytes + header->size <= MAX_CACHED_BYTES)
+            {
+                gThreadCache.freeLists[header->sizeClass].push_back(ptr);
+
+                gThreadCache.cachedBytes += header->size;
+                gCachedBytes += header->size;
+
+#if (defined(__ANDROID__) || defined(__linux__)) && defined(MADV_FREE)
+                // Large blocks trim themselves lazily. Align inwards so the
+                // header in front of the payload stays untouched.
+                if(header->size >= LAZY_FREE_MIN_BYTES) {
+                    const uintptr_t pageSize = 4096;
+
+                    const uintptr_t start = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) & ~(pageSize - 1);
+                    const uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + header->size) & ~(pageSize - 1);
+
+                    if(end > start)
+                        madvise(reinterpret_cast<void*>(start), end - start, MADV_FREE);
+                }
+#endif
+
+                return;
+            }
+
+            free(header->base);
+        }
+
+        void Install() {
+        }
+
+        size_t CachedBytes() {
+            return gCachedBytes;
+        }
+    }
+}
+
+extern "C" void* halide_malloc(void* /*user_context*/, size_t x) {
+    return motioncam::halidepool::PoolMalloc(x);
+}
+
+extern "C" void halide_free(void* /*user_context*/, void* ptr) {
+    motioncam::halidepool::PoolFree(ptr);
+}
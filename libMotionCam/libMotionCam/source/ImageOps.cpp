@@ -5,25 +5,35 @@ using std::vector;
 
 namespace motioncam {    
 
-    float findMedian(std::vector<float> nums) {
+    float findMedian(std::vector<float>& nums) {
         std::nth_element(nums.begin(), nums.begin() + nums.size() / 2, nums.end());
-        
+
         return nums[nums.size()/2];
     }
 
     float findMedian(cv::Mat& input, float p) {
+        if(input.isContinuous()) {
+            // Select directly on the input instead of copying it out into a
+            // vector first. Every caller passes a scratch image, so
+            // reordering it is fine.
+            float* begin = input.ptr<float>(0);
+            float* end = begin + input.total();
+            float* nth = begin + static_cast<size_t>(input.total() * p);
+
+            std::nth_element(begin, nth, end);
+
+            return *nth;
+        }
+
         std::vector<float> nums;
         nums.reserve(input.cols * input.rows);
-        
+
         for (int i = 0; i < input.rows; ++i) {
             nums.insert(nums.end(), input.ptr<float>(i), input.ptr<float>(i) + input.cols);
         }
 
-        if(p <= 0.5)
-            std::nth_element(nums.begin(), nums.begin() + nums.size() / 2, nums.end());
-        else
-            std::sort(nums.begin(), nums.end());
-        
+        std::nth_element(nums.begin(), nums.begin() + nums.size()*p, nums.end());
+
         return nums[nums.size()*p];
     }
     
@@ -47,14 +57,11 @@ namespace motioncam {
 
     void defringeInternal(Halide::Runtime::Buffer<uint16_t>& out, Halide::Runtime::Buffer<uint16_t>& in, const int threshold)
     {
-//        cv::parallel_for_(cv::Range(0, 4), [&](const cv::Range& range)
-//        {
-//            int S = (int) std::ceil(in.height() / 4.0f);
-//
-//            int y0 = range.start * S;
-//            int y1 = std::min(range.end * S, in.height() - 1);
-//
-            for(int y = 0; y < in.height(); y++) {
+        // Rows are independent; the correction only ever walks along the row
+        // it is on, so split them across cores.
+        cv::parallel_for_(cv::Range(0, in.height()), [&](const cv::Range& range)
+        {
+            for(int y = range.start; y < range.end; y++) {
                 uint16_t* inR = in.begin() + y*in.stride(1) + 0*in.stride(2);
                 uint16_t* inG = in.begin() + y*in.stride(1) + 1*in.stride(2);
                 uint16_t* inB = in.begin() + y*in.stride(1) + 2*in.stride(2);
@@ -144,7 +151,7 @@ namespace motioncam {
                     x = rpos - 2;
                 }
             }
-//        });
+        });
     }
 
     void defringe(Halide::Runtime::Buffer<uint16_t>& output, Halide::Runtime::Buffer<uint16_t>& input) {
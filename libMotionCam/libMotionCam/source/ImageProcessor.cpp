@@ -1,5 +1,6 @@
 #include "motioncam/ImageProcessor.h"
 #include "motioncam/RawContainer.h"
+#include "motioncam/RawContainerImpl.h"
 #include "motioncam/CameraProfile.h"
 #include "motioncam/Temperature.h"
 #include "motioncam/Exceptions.h"
@@ -13,6 +14,8 @@
 #include "motioncam/RawBufferStreamer.h"
 #include "motioncam/RawImageBuffer.h"
 #include "motioncam/RawCameraMetadata.h"
+#include "motioncam/TaskEngine.h"
+#include "motioncam/HalidePool.h"
 
 // Halide
 #include "generate_stats.h"
@@ -20,13 +23,19 @@
 #include "measure_image.h"
 #include "deinterleave_raw.h"
 #include "forward_transform.h"
+#include "forward_transform_fp16.h"
 #include "inverse_transform.h"
+#include "inverse_transform_fp16.h"
 #include "fuse_image.h"
 #include "fuse_denoise_3x3.h"
 #include "fuse_denoise_5x5.h"
 #include "fuse_denoise_7x7.h"
+#include "fuse_denoise_batch_3x3.h"
+#include "fuse_denoise_batch_5x5.h"
+#include "fuse_denoise_batch_7x7.h"
 #include "fast_preview.h"
 #include "fast_preview2.h"
+#include "preview_stats.h"
 #include "measure_noise.h"
 
 #include "linear_image.h"
@@ -46,12 +55,23 @@
 #include "preview_reverse_landscape8.h"
 
 #include "postprocess.h"
+#include "postprocess_no_hdr.h"
+#include "postprocess_wide.h"
+#include "postprocess_no_hdr_wide.h"
+#include "postprocess_cl.h"
+#include "postprocess_no_hdr_cl.h"
 
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <thread>
+#include <tuple>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <exiv2/exiv2.hpp>
@@ -73,6 +93,8 @@ const std::vector<std::vector<float>> WEIGHTS = {
     { 1,  1,   0,   0 }
 };
 
+const std::vector<float> ZERO_WEIGHTS = { 0, 0, 0, 0 };
+
 const float TONEMAP_VARIANCE = 0.25f;
 
 extern "C" int extern_defringe(halide_buffer_t *in, int32_t width, int32_t height, halide_buffer_t *out) {
@@ -92,16 +114,35 @@ extern "C" int extern_defringe(halide_buffer_t *in, int32_t width, int32_t heigh
     return 0;
 }
 
-static std::vector<Halide::Runtime::Buffer<float>> createWaveletBuffers(int width, int height) {
-    std::vector<Halide::Runtime::Buffer<float>> buffers;
-    
+// Allocates a pipeline working buffer through the Halide allocation pool,
+// so repeated calls during a video export reuse recycled, already
+// faulted-in blocks instead of paying allocation and first-touch cost for
+// these buffers on every frame
+template<typename T, typename... Args>
+static Halide::Runtime::Buffer<T> createPooledBuffer(Args&&... args) {
+    Halide::Runtime::Buffer<T> buffer((T*) nullptr, std::forward<Args>(args)...);
+
+    buffer.allocate(&motioncam::halidepool::PoolMalloc, &motioncam::halidepool::PoolFree);
+
+    return buffer;
+}
+
+static std::vector<Halide::Runtime::Buffer<>> createWaveletBuffers(int width, int height, bool fp16) {
+    std::vector<Halide::Runtime::Buffer<>> buffers;
+
+    const halide_type_t type(halide_type_float, fp16 ? 16 : 32);
+
     for(int level = 0; level < motioncam::WAVELET_LEVELS; level++) {
         width = width / 2;
         height = height / 2;
-        
-        buffers.emplace_back(width, height, 4, 4);
+
+        Halide::Runtime::Buffer<> buffer(type, nullptr, width, height, 4, 4);
+
+        buffer.allocate(&motioncam::halidepool::PoolMalloc, &motioncam::halidepool::PoolFree);
+
+        buffers.push_back(std::move(buffer));
     }
-    
+
     return buffers;
 }
 
@@ -109,6 +150,39 @@ namespace motioncam {
     const float MAX_HDR_ERROR           = 0.0001f;
     const float SHADOW_BIAS             = 6.0f;
 
+    // Selects the wide schedule variants of the postprocess pipeline. Set
+    // by the app layer from its device profile; off by default so older
+    // parts keep the schedules they were tuned on.
+    static std::atomic<bool> gUseWideSchedules(false);
+
+    // Selects the OpenCL variants of the postprocess pipeline, which run
+    // the demosaic and guided filter stages on the GPU. Set by the app
+    // layer once it has probed for a usable OpenCL driver; off by default
+    // so devices without one never touch the GPU backend.
+    static std::atomic<bool> gUseGpuPostProcess(false);
+
+    // Stores the denoise wavelet pyramid as float16, halving its footprint
+    // and bandwidth. Computation stays in float32, so only the rounding of
+    // the stored coefficients changes. Set by the app layer on parts with
+    // hardware float16 conversions; off by default.
+    static std::atomic<bool> gUseFp16Wavelets(false);
+
+    // Runs the wavelet denoise in overlapping horizontal stripes of this
+    // many rows instead of over the whole frame, bounding the pyramid
+    // scratch regardless of frame size. Set by the app layer on memory
+    // constrained devices; 0 keeps the full frame pass.
+    static std::atomic<int> gDenoiseStripeRows(0);
+
+    // Fuses this many frames per invocation of the merge kernel instead of
+    // one, so the float accumulator is read and written once per batch
+    // rather than once per frame. Costs batch - 1 extra deinterleaved
+    // frames of resident memory; 0 keeps the per frame merge.
+    static std::atomic<int> gFuseBatchFrames(0);
+
+    // Mean absolute difference of the coarsest pyramid levels below which
+    // the scene is considered static and registration is skipped
+    const float STATIC_SCENE_THRESHOLD  = 1.5f;
+
     typedef Halide::Runtime::Buffer<float> WaveletBuffer;
 
     struct HdrMetadata {
@@ -240,6 +314,26 @@ namespace motioncam {
         mProgressListener.onCompleted();
     }
 
+    void ImageProcessor::setUseWideSchedules(const bool enabled) {
+        gUseWideSchedules = enabled;
+    }
+
+    void ImageProcessor::setUseGpuPostProcess(const bool enabled) {
+        gUseGpuPostProcess = enabled;
+    }
+
+    void ImageProcessor::setUseFp16Wavelets(const bool enabled) {
+        gUseFp16Wavelets = enabled;
+    }
+
+    void ImageProcessor::setDenoiseStripeRows(const int rows) {
+        gDenoiseStripeRows = rows;
+    }
+
+    void ImageProcessor::setFuseBatchFrames(const int frames) {
+        gFuseBatchFrames = frames;
+    }
+
     double ImageProcessor::calcEv(const RawCameraMetadata& cameraMetadata, const RawImageMetadata& metadata) {
         double a = 1.8;
         if(!cameraMetadata.apertures.empty())
@@ -251,15 +345,36 @@ namespace motioncam {
 
     double ImageProcessor::getMinEv(RawContainer& container) {
         double minEv = 1e5;
-        
+
+        // Containers written at record time carry the EV inputs of every
+        // frame in the footer, so the minimum can be found without reading
+        // per-frame metadata from across the file
+        std::vector<FrameRecord> records;
+
+        if(container.getFrameRecords(records)) {
+            RawImageMetadata metadata;
+
+            for(const auto& record : records) {
+                metadata.exposureTime = record.exposureTime;
+                metadata.iso = record.iso;
+
+                auto ev = calcEv(container.getCameraMetadata(), metadata);
+
+                if(ev < minEv)
+                    minEv = ev;
+            }
+
+            return minEv;
+        }
+
         for(const auto& name : container.getFrames()) {
             auto frame = container.getFrame(name);
             auto ev = calcEv(container.getCameraMetadata(), frame->metadata);
-            
+
             if(ev < minEv)
                 minEv = ev;
         }
-        
+
         return minEv;
     }
 
@@ -330,10 +445,9 @@ namespace motioncam {
         }
 
         // Get blue noise buffer
-        auto noise = cv::imdecode(BLUE_NOISE_PNG, cv::IMREAD_UNCHANGED);
-        
         Halide::Runtime::Buffer<uint8_t> noiseBuffer =
-            Halide::Runtime::Buffer<uint8_t>::make_interleaved((uint8_t*) noise.data, noise.cols, noise.rows, 4);
+            Halide::Runtime::Buffer<uint8_t>::make_interleaved(
+                (uint8_t*) BLUE_NOISE_LUT.data(), BLUE_NOISE_WIDTH, BLUE_NOISE_HEIGHT, BLUE_NOISE_CHANNELS);
         
         cv::Mat cameraToSrgb = pcsToSrgb * cameraToPcs;
         
@@ -381,45 +495,61 @@ namespace motioncam {
             
             useHdr = false;
         }
-                
-        postprocess(inputBuffers[0],
-                    inputBuffers[1],
-                    inputBuffers[2],
-                    inputBuffers[3],
-                    noiseBuffer,
-                    hdrInput,
-                    hdrMask,
-                    useHdr,
-                    metadata.asShot[0],
-                    metadata.asShot[1],
-                    metadata.asShot[2],
-                    cameraToSrgbBuffer,
-                    shadingMapBuffer[0],
-                    shadingMapBuffer[1],
-                    shadingMapBuffer[2],
-                    shadingMapBuffer[3],
-                    EXPANDED_RANGE,
-                    static_cast<int>(cameraMetadata.sensorArrangment),
-                    shadows,
-                    hdrInputGain,
-                    hdrScale,
-                    tonemapVariance,
-                    settings.blacks,
-                    settings.exposure,
-                    settings.whitePoint,
-                    settings.contrast,
-                    settings.brightness,
-                    settings.blues,
-                    settings.greens,
-                    settings.saturation,
-                    settings.sharpen0,
-                    settings.sharpen1,
-                    settings.pop,
-                    128.0f,
-                    7.0f,
-                    (std::min)(0.015f, (std::max)(0.005f, noiseEstimate / 2.0f)),
-                    outputBuffer);
-        
+
+        // The non-HDR variant is compiled without the HDR blending stages
+        // instead of feeding them dummy inputs. Each comes in several
+        // schedule variants; the device profile picks between them. The
+        // OpenCL variants run the demosaic and guided filter stages on the
+        // GPU and take precedence over the wide schedules.
+        const bool wide = gUseWideSchedules;
+        const bool gpu = gUseGpuPostProcess;
+
+        auto postprocessFunc = gpu  ? (useHdr ? &postprocess_cl : &postprocess_no_hdr_cl)
+                             : useHdr ? (wide ? &postprocess_wide : &postprocess)
+                                      : (wide ? &postprocess_no_hdr_wide : &postprocess_no_hdr);
+
+        postprocessFunc(inputBuffers[0],
+                        inputBuffers[1],
+                        inputBuffers[2],
+                        inputBuffers[3],
+                        noiseBuffer,
+                        hdrInput,
+                        hdrMask,
+                        useHdr,
+                        metadata.asShot[0],
+                        metadata.asShot[1],
+                        metadata.asShot[2],
+                        cameraToSrgbBuffer,
+                        shadingMapBuffer[0],
+                        shadingMapBuffer[1],
+                        shadingMapBuffer[2],
+                        shadingMapBuffer[3],
+                        EXPANDED_RANGE,
+                        static_cast<int>(cameraMetadata.sensorArrangment),
+                        shadows,
+                        hdrInputGain,
+                        hdrScale,
+                        tonemapVariance,
+                        settings.blacks,
+                        settings.exposure,
+                        settings.whitePoint,
+                        settings.contrast,
+                        settings.brightness,
+                        settings.blues,
+                        settings.greens,
+                        settings.saturation,
+                        settings.sharpen0,
+                        settings.sharpen1,
+                        settings.pop,
+                        128.0f,
+                        7.0f,
+                        (std::min)(0.015f, (std::max)(0.005f, noiseEstimate / 2.0f)),
+                        outputBuffer);
+
+        // The GPU pipelines leave the result in device memory
+        if(gpu)
+            outputBuffer.copy_to_host();
+
         return output;
     }
 
@@ -536,7 +666,11 @@ namespace motioncam {
             0.03f,
             0.05f,
         };
-                
+
+        // Clean frames don't need thresholding at all
+        if(signalLevel > 0.08f)
+            return ZERO_WEIGHTS;
+
         float minDiff = 1e5f;
         int w = (int) WEIGHTS.size()-1;
         
@@ -565,7 +699,7 @@ namespace motioncam {
                                           const RawCameraMetadata& cameraMetadata,
                                           PostProcessSettings& outSettings)
     {
-        //Measure measure("estimateSettings()");
+        Measure measure("estimateSettings()");
         
         float ev = calcEv(cameraMetadata, rawBuffer.metadata);
         float keyValue = getShadowKeyValue(ev, false);
@@ -576,7 +710,9 @@ namespace motioncam {
 
         cameraProfile.temperatureFromVector(rawBuffer.metadata.asShot, temperature);
 
-        cv::Mat histogram = calcHistogram(cameraMetadata, rawBuffer, false, 8);
+        // Sampled at the same downscale as the other estimation stages so
+        // they all share one measurement pass over the frame
+        cv::Mat histogram = calcHistogram(cameraMetadata, rawBuffer, false, 4);
 
         outSettings.temperature    = static_cast<float>(temperature.temperature());
         outSettings.tint           = static_cast<float>(temperature.tint());
@@ -587,6 +723,54 @@ namespace motioncam {
         outSettings.clippedHighs = histogram.at<float>(histogram.cols - 1);
     }
 
+    // The colour setup re-derives the interpolated camera matrices through a
+    // chain of small cv::Mat multiplies for every frame, even though white
+    // balance moves slowly. The derived matrices are cached keyed by the
+    // quantized white balance (10K/0.1 tint steps, well below a visible
+    // difference) plus a fingerprint of the matrices feeding the profile, so
+    // per-frame colour setup in preview and export is usually a lookup.
+    struct ColorTransformKey {
+        int temperature;
+        int tint;
+        int profileFingerprint;
+
+        bool operator<(const ColorTransformKey& other) const {
+            return std::tie(temperature, tint, profileFingerprint) <
+                   std::tie(other.temperature, other.tint, other.profileFingerprint);
+        }
+    };
+
+    struct ColorTransformEntry {
+        cv::Vec3f cameraWhite;
+        cv::Mat cameraToPcs;
+        cv::Mat pcsToSrgb;
+    };
+
+    const static int COLOR_TRANSFORM_CACHE_MAX_ENTRIES = 64;
+
+    static std::mutex gColorTransformCacheMutex;
+    static std::map<ColorTransformKey, ColorTransformEntry> gColorTransformCache;
+
+    static int FingerprintColorProfile(const RawCameraMetadata& cameraMetadata, const RawImageMetadata& imageMetadata) {
+        // Weighted sums of the matrices the profile is built from; enough to
+        // tell devices and per-frame calibrations apart
+        const cv::Mat& colorMatrix =
+            imageMetadata.colorMatrix1.empty() ? cameraMetadata.colorMatrix1 : imageMetadata.colorMatrix1;
+
+        const cv::Mat& calibrationMatrix =
+            imageMetadata.calibrationMatrix1.empty() ? cameraMetadata.calibrationMatrix1 : imageMetadata.calibrationMatrix1;
+
+        float sum = 0.0f;
+
+        if(!colorMatrix.empty())
+            sum += (float) cv::sum(colorMatrix)[0];
+
+        if(!calibrationMatrix.empty())
+            sum += 16.0f * (float) cv::sum(calibrationMatrix)[0];
+
+        return (int) std::lround(sum * 4096.0f);
+    }
+
     void ImageProcessor::createSrgbMatrix(const RawCameraMetadata& cameraMetadata,
                                           const RawImageMetadata& rawImageMetadata,
                                           const Temperature& temperature,
@@ -594,9 +778,29 @@ namespace motioncam {
                                           cv::Mat& outCameraToPcs,
                                           cv::Mat& outPcsToSrgb)
     {
+        ColorTransformKey key;
+
+        key.temperature = (int) std::lround(temperature.temperature() / 10.0);
+        key.tint = (int) std::lround(temperature.tint() * 10.0);
+        key.profileFingerprint = FingerprintColorProfile(cameraMetadata, rawImageMetadata);
+
+        {
+            std::lock_guard<std::mutex> lock(gColorTransformCacheMutex);
+
+            auto it = gColorTransformCache.find(key);
+            if(it != gColorTransformCache.end()) {
+                cameraWhite = it->second.cameraWhite;
+
+                it->second.cameraToPcs.copyTo(outCameraToPcs);
+                it->second.pcsToSrgb.copyTo(outPcsToSrgb);
+
+                return;
+            }
+        }
+
         cv::Mat pcsToCamera, cameraToPcs;
         cv::Mat pcsToSrgb, srgbToPcs;
-        
+
         CameraProfile cameraProfile(cameraMetadata, rawImageMetadata);
 
         cameraProfile.cameraToPcs(temperature, pcsToCamera, cameraToPcs, cameraWhite);
@@ -604,6 +808,23 @@ namespace motioncam {
 
         cameraToPcs.copyTo(outCameraToPcs);
         pcsToSrgb.copyTo(outPcsToSrgb);
+
+        {
+            std::lock_guard<std::mutex> lock(gColorTransformCacheMutex);
+
+            // Keep the cache bounded; the working set is a handful of white
+            // balance points
+            if(gColorTransformCache.size() >= COLOR_TRANSFORM_CACHE_MAX_ENTRIES)
+                gColorTransformCache.clear();
+
+            ColorTransformEntry entry;
+
+            entry.cameraWhite = cameraWhite;
+            cameraToPcs.copyTo(entry.cameraToPcs);
+            pcsToSrgb.copyTo(entry.pcsToSrgb);
+
+            gColorTransformCache[key] = std::move(entry);
+        }
     }
 
     void ImageProcessor::createSrgbMatrix(const RawCameraMetadata& cameraMetadata,
@@ -613,15 +834,12 @@ namespace motioncam {
                                           cv::Mat& outCameraToPcs,
                                           cv::Mat& outPcsToSrgb)
     {
-        cv::Mat pcsToCamera, cameraToPcs;
-        cv::Mat pcsToSrgb, srgbToPcs;
-        
         CameraProfile cameraProfile(cameraMetadata, rawImageMetadata);
         Temperature temperature;
 
         cv::Vec3f asShotVector = asShot;
         float max = (math::max)(asShotVector);
-        
+
         if(max > 0) {
             asShotVector[0] = asShotVector[0] * (1.0f / max);
             asShotVector[1] = asShotVector[1] * (1.0f / max);
@@ -633,11 +851,8 @@ namespace motioncam {
 
         cameraProfile.temperatureFromVector(asShotVector, temperature);
 
-        cameraProfile.cameraToPcs(temperature, pcsToCamera, cameraToPcs, cameraWhite);
-        motioncam::CameraProfile::pcsToSrgb(pcsToSrgb, srgbToPcs);
-
-        cameraToPcs.copyTo(outCameraToPcs);
-        pcsToSrgb.copyTo(outPcsToSrgb);
+        // The matrix derivation goes through the cache above
+        createSrgbMatrix(cameraMetadata, rawImageMetadata, temperature, cameraWhite, outCameraToPcs, outPcsToSrgb);
     }
 
     void ImageProcessor::generateStats(const RawImageBuffer& rawBuffer,
@@ -647,16 +862,24 @@ namespace motioncam {
                                        Halide::Runtime::Buffer<uint8_t>& whiteLevelClipping,
                                        Halide::Runtime::Buffer<uint8_t>& blackLevelClipping)
     {
-        //Measure measure("generateStats()");
+        Measure measure("generateStats()");
         
         NativeBufferContext inputBufferContext(*rawBuffer.data, false);
 
         int width = rawBuffer.width / 2 / sx; // Divide by 2 because we are not demosaicing the RAW data
         int height = rawBuffer.height / 2 / sy;
-        
-        Halide::Runtime::Buffer<uint8_t> outputWhiteLevelClipping(height, width);
-        Halide::Runtime::Buffer<uint8_t> outputBlackLevelClipping(height, width);
-        
+
+        // Reuse the caller's buffers when they already match. The overlay
+        // calls this repeatedly while the camera is running, so recycling the
+        // outputs keeps the allocator out of the hot path.
+        if(whiteLevelClipping.data() == nullptr  ||
+           whiteLevelClipping.dim(0).extent() != height ||
+           whiteLevelClipping.dim(1).extent() != width)
+        {
+            whiteLevelClipping = Halide::Runtime::Buffer<uint8_t>(height, width);
+            blackLevelClipping = Halide::Runtime::Buffer<uint8_t>(height, width);
+        }
+
         auto whiteLevel = cameraMetadata.getWhiteLevel(rawBuffer.metadata);
         const auto& blackLevel = cameraMetadata.getBlackLevel(rawBuffer.metadata);
         
@@ -675,11 +898,81 @@ namespace motioncam {
             blackLevel[3],
             whiteLevel,
             16.0f,
-            outputWhiteLevelClipping,
-            outputBlackLevelClipping);
+            whiteLevelClipping,
+            blackLevelClipping);
+    }
+
+    void ImageProcessor::generatePreviewStats(const RawImageBuffer& rawBuffer,
+                                              const int sx,
+                                              const int sy,
+                                              const RawCameraMetadata& cameraMetadata,
+                                              Halide::Runtime::Buffer<uint8_t>& outputBuffer,
+                                              Halide::Runtime::Buffer<uint32_t>& histogram,
+                                              Halide::Runtime::Buffer<uint8_t>& whiteLevelClipping,
+                                              Halide::Runtime::Buffer<uint8_t>& blackLevelClipping)
+    {
+        Measure measure("generatePreviewStats()");
+
+        cv::Mat cameraToPcs;
+        cv::Mat pcsToSrgb;
+        cv::Vec3f cameraWhite;
+
+        createSrgbMatrix(cameraMetadata, rawBuffer.metadata, rawBuffer.metadata.asShot, cameraWhite, cameraToPcs, pcsToSrgb);
+
+        cv::Mat cameraToSrgb = pcsToSrgb * cameraToPcs;
+
+        Halide::Runtime::Buffer<float> cameraToSrgbBuffer = ToHalideBuffer<float>(cameraToSrgb);
+        NativeBufferContext inputBufferContext(*rawBuffer.data, false);
+
+        int width = rawBuffer.width / 2 / sx; // Divide by 2 because we are not demosaicing the RAW data
+        int height = rawBuffer.height / 2 / sy;
+
+        // Reuse the caller's buffers when they already match. The preview
+        // loop runs this per frame, so recycling the outputs keeps the
+        // allocator out of the hot path.
+        if(outputBuffer.data() == nullptr ||
+           outputBuffer.width() != width  ||
+           outputBuffer.height() != height)
+        {
+            outputBuffer = Halide::Runtime::Buffer<uint8_t>::make_interleaved(width, height, 4);
+        }
+
+        if(histogram.data() == nullptr)
+            histogram = Halide::Runtime::Buffer<uint32_t>(256);
 
-        whiteLevelClipping = outputWhiteLevelClipping;
-        blackLevelClipping = outputBlackLevelClipping;
+        if(whiteLevelClipping.data() == nullptr  ||
+           whiteLevelClipping.dim(0).extent() != height ||
+           whiteLevelClipping.dim(1).extent() != width)
+        {
+            whiteLevelClipping = Halide::Runtime::Buffer<uint8_t>(height, width);
+            blackLevelClipping = Halide::Runtime::Buffer<uint8_t>(height, width);
+        }
+
+        auto whiteLevel = cameraMetadata.getWhiteLevel(rawBuffer.metadata);
+        const auto& blackLevel = cameraMetadata.getBlackLevel(rawBuffer.metadata);
+
+        preview_stats(
+            inputBufferContext.getHalideBuffer(),
+            rawBuffer.rowStride,
+            static_cast<int>(rawBuffer.pixelFormat),
+            static_cast<int>(cameraMetadata.sensorArrangment),
+            rawBuffer.width,
+            rawBuffer.height,
+            sx,
+            sy,
+            whiteLevel,
+            blackLevel[0],
+            blackLevel[1],
+            blackLevel[2],
+            blackLevel[3],
+            rawBuffer.metadata.asShot[0],
+            rawBuffer.metadata.asShot[1],
+            rawBuffer.metadata.asShot[2],
+            cameraToSrgbBuffer,
+            outputBuffer,
+            histogram,
+            whiteLevelClipping,
+            blackLevelClipping);
     }
 
     Halide::Runtime::Buffer<uint8_t> ImageProcessor::createFastPreview(const RawImageBuffer& rawBuffer,
@@ -687,8 +980,21 @@ namespace motioncam {
                                                                        const int sy,
                                                                        const RawCameraMetadata& cameraMetadata)
     {
-        //Measure measure("fastPreview()");
-        
+        Halide::Runtime::Buffer<uint8_t> outputBuffer;
+
+        createFastPreview(rawBuffer, sx, sy, cameraMetadata, outputBuffer);
+
+        return outputBuffer;
+    }
+
+    void ImageProcessor::createFastPreview(const RawImageBuffer& rawBuffer,
+                                           const int sx,
+                                           const int sy,
+                                           const RawCameraMetadata& cameraMetadata,
+                                           Halide::Runtime::Buffer<uint8_t>& outputBuffer)
+    {
+        Measure measure("fastPreview()");
+
         cv::Mat cameraToPcs;
         cv::Mat pcsToSrgb;
         cv::Vec3f cameraWhite;
@@ -703,10 +1009,17 @@ namespace motioncam {
         // Set up rotation based on orientation of image
         int width = rawBuffer.width / 2 / sx; // Divide by 2 because we are not demosaicing the RAW data
         int height = rawBuffer.height / 2 / sy;
-        
-        Halide::Runtime::Buffer<uint8_t> outputBuffer =
-            Halide::Runtime::Buffer<uint8_t>::make_interleaved(width, height, 4);
-        
+
+        // Reuse the caller's buffer when it already matches. The preview loop
+        // runs this per frame, so recycling the output keeps the allocator
+        // out of the hot path.
+        if(outputBuffer.data() == nullptr ||
+           outputBuffer.width() != width  ||
+           outputBuffer.height() != height)
+        {
+            outputBuffer = Halide::Runtime::Buffer<uint8_t>::make_interleaved(width, height, 4);
+        }
+
         auto whiteLevel = cameraMetadata.getWhiteLevel(rawBuffer.metadata);
         const auto& blackLevel = cameraMetadata.getBlackLevel(rawBuffer.metadata);
 
@@ -729,8 +1042,6 @@ namespace motioncam {
             rawBuffer.metadata.asShot[2],
             cameraToSrgbBuffer,
             outputBuffer);
-        
-        return outputBuffer;
     }
 
     Halide::Runtime::Buffer<uint8_t> ImageProcessor::createFastPreview(std::vector<Halide::Runtime::Buffer<uint16_t>>& inputBuffers,
@@ -792,7 +1103,7 @@ namespace motioncam {
                                                                    const RawCameraMetadata& cameraMetadata,
                                                                    const PostProcessSettings& settings)
     {
-        //Measure measure("createPreview()");
+        Measure measure("createPreview()");
         
         if(downscaleFactor != 2 && downscaleFactor != 4 && downscaleFactor != 8) {
             throw InvalidState("Invalid downscale factor");
@@ -924,6 +1235,19 @@ namespace motioncam {
                                                           const RawCameraMetadata& cameraMetadata,
                                                           const bool extendEdges,
                                                           const float scalePreview)
+    {
+        auto rawData = std::make_shared<RawData>();
+
+        loadRawImage(rawBuffer, cameraMetadata, *rawData, extendEdges, scalePreview);
+
+        return rawData;
+    }
+
+    void ImageProcessor::loadRawImage(const RawImageBuffer& rawBuffer,
+                                      const RawCameraMetadata& cameraMetadata,
+                                      RawData& rawData,
+                                      const bool extendEdges,
+                                      const float scalePreview)
     {
         auto whiteLevel = cameraMetadata.getWhiteLevel(rawBuffer.metadata);
         const auto& blackLevel = cameraMetadata.getBlackLevel(rawBuffer.metadata);
@@ -941,15 +1265,22 @@ namespace motioncam {
             extendX = static_cast<int>(T * ceil(halfWidth / (double) T) - halfWidth);
             extendY = static_cast<int>(T * ceil(halfHeight / (double) T) - halfHeight);
         }
-        
-        auto rawData = std::make_shared<RawData>();
 
+        const int outWidth  = halfWidth + extendX;
+        const int outHeight = halfHeight + extendY;
+
+        if(rawData.previewBuffer.width() != outWidth || rawData.previewBuffer.height() != outHeight)
+            rawData.previewBuffer = createPooledBuffer<uint8_t>(outWidth, outHeight);
+
+        if(rawData.rawBuffer.width() != outWidth || rawData.rawBuffer.height() != outHeight)
+            rawData.rawBuffer = createPooledBuffer<uint16_t>(outWidth, outHeight, 4);
+
+        rawData.metadata = rawBuffer.metadata;
+
+        // The input wraps the locked frame memory directly; only the
+        // deinterleaved planes are written
         NativeBufferContext inputBufferContext(*rawBuffer.data, false);
-        
-        rawData->previewBuffer  = Halide::Runtime::Buffer<uint8_t>(halfWidth + extendX, halfHeight + extendY);
-        rawData->rawBuffer      = Halide::Runtime::Buffer<uint16_t>(halfWidth + extendX, halfHeight + extendY, 4);
-        rawData->metadata       = rawBuffer.metadata;
-        
+
         deinterleave_raw(inputBufferContext.getHalideBuffer(),
                          rawBuffer.rowStride,
                          static_cast<int>(rawBuffer.pixelFormat),
@@ -964,26 +1295,100 @@ namespace motioncam {
                          blackLevel[2],
                          blackLevel[3],
                          scalePreview,
-                         rawData->rawBuffer,
-                         rawData->previewBuffer);
-                        
-        return rawData;
+                         rawData.rawBuffer,
+                         rawData.previewBuffer);
+    }
+
+    // Cache key for a measured noise profile. Noise at a given ISO and
+    // exposure is a sensor characteristic, so repeated frames at locked
+    // exposure (the common video export case) reuse the first measurement
+    // instead of re-running the measure_noise pipeline. The exposure time
+    // is quantized to a tenth of a stop so AE jitter still hits the cache,
+    // and the frame dimensions stand in for the sensor identity when a
+    // session mixes cameras.
+    struct NoiseProfileKey {
+        int32_t iso;
+        int32_t exposureTenthStops;
+        int32_t width;
+        int32_t height;
+        int32_t patchSize;
+
+        bool operator<(const NoiseProfileKey& other) const {
+            return std::tie(iso, exposureTenthStops, width, height, patchSize) <
+                   std::tie(other.iso, other.exposureTenthStops, other.width, other.height, other.patchSize);
+        }
+    };
+
+    struct NoiseProfile {
+        std::vector<float> noise;
+        std::vector<float> signal;
+    };
+
+    static std::mutex gNoiseProfileMutex;
+    static std::map<NoiseProfileKey, NoiseProfile> gNoiseProfiles;
+
+    static NoiseProfileKey makeNoiseProfileKey(const RawImageBuffer& rawBuffer, const int patchSize) {
+        const double stops =
+            std::log2(static_cast<double>((std::max)(static_cast<int64_t>(1), rawBuffer.metadata.exposureTime)));
+
+        NoiseProfileKey key;
+
+        key.iso = rawBuffer.metadata.iso;
+        key.exposureTenthStops = static_cast<int32_t>(0.5 + stops * 10.0);
+        key.width = rawBuffer.width;
+        key.height = rawBuffer.height;
+        key.patchSize = patchSize;
+
+        return key;
     }
 
     void ImageProcessor::measureNoise(const RawCameraMetadata& cameraMetadata,
                                       const RawImageBuffer& rawBuffer,
                                       std::vector<float>& outNoise,
                                       std::vector<float>& outSignal,
-                                      const int patchSize)
+                                      const int patchSize,
+                                      const bool subsampleRows)
     {
+        const NoiseProfileKey key = makeNoiseProfileKey(rawBuffer, patchSize);
+
+        {
+            std::lock_guard<std::mutex> lock(gNoiseProfileMutex);
+
+            auto it = gNoiseProfiles.find(key);
+            if(it != gNoiseProfiles.end()) {
+                outNoise.insert(outNoise.end(), it->second.noise.begin(), it->second.noise.end());
+                outSignal.insert(outSignal.end(), it->second.signal.begin(), it->second.signal.end());
+
+                return;
+            }
+        }
+
         NativeBufferContext context(*rawBuffer.data, false);
 
-        Halide::Runtime::Buffer<float> noiseBuffer(rawBuffer.width / 2 / patchSize, rawBuffer.height / 2 / patchSize, 4);
-        Halide::Runtime::Buffer<float> signalBuffer(rawBuffer.width / 2 / patchSize, rawBuffer.height / 2 / patchSize, 4);
-        
-        measure_noise(context.getHalideBuffer(),
+        auto inputBuffer = context.getHalideBuffer();
+        int sampleHeight = rawBuffer.height;
+
+        // Measure from a centered band of half the rows instead of the
+        // whole frame. The band keeps a whole number of patch rows and
+        // starts on an even row so the bayer quads keep their parity.
+        if(subsampleRows && rawBuffer.height >= 8 * patchSize) {
+            sampleHeight = rawBuffer.height / 2;
+            sampleHeight -= sampleHeight % (2 * patchSize);
+
+            const int offsetRow = ((rawBuffer.height - sampleHeight) / 2) & ~1;
+            const size_t offsetBytes = static_cast<size_t>(offsetRow) * rawBuffer.rowStride;
+
+            inputBuffer = Halide::Runtime::Buffer<uint8_t>(
+                inputBuffer.data() + offsetBytes,
+                static_cast<int>(rawBuffer.data->len() - offsetBytes));
+        }
+
+        auto noiseBuffer = createPooledBuffer<float>(rawBuffer.width / 2 / patchSize, sampleHeight / 2 / patchSize, 4);
+        auto signalBuffer = createPooledBuffer<float>(rawBuffer.width / 2 / patchSize, sampleHeight / 2 / patchSize, 4);
+
+        measure_noise(inputBuffer,
                       rawBuffer.width,
-                      rawBuffer.height,
+                      sampleHeight,
                       rawBuffer.rowStride,
                       static_cast<int>(rawBuffer.pixelFormat),
                       static_cast<int>(cameraMetadata.sensorArrangment),
@@ -997,10 +1402,23 @@ namespace motioncam {
             
             float noise = findMedian(noiseImage);
             float signal = findMedian(signalImage) / (rawBuffer.metadata.iso / 100.0f);
-            
+
             outNoise.push_back(noise);
             outSignal.push_back(signal);
         }
+
+        NoiseProfile profile;
+
+        profile.noise.assign(outNoise.end() - 4, outNoise.end());
+        profile.signal.assign(outSignal.end() - 4, outSignal.end());
+
+        std::lock_guard<std::mutex> lock(gNoiseProfileMutex);
+
+        // A session only sees a handful of capture parameter combinations
+        if(gNoiseProfiles.size() > 64)
+            gNoiseProfiles.clear();
+
+        gNoiseProfiles.emplace(key, std::move(profile));
     }
 
     cv::Mat ImageProcessor::registerImage2(
@@ -1010,6 +1428,10 @@ namespace motioncam {
 
         static const cv::TermCriteria termCriteria = cv::TermCriteria(cv::TermCriteria::COUNT + cv::TermCriteria::EPS, 50, 0.001f);
 
+        // The coarse solve has already converged by the time the finest
+        // level runs, so the refinement only needs a handful of iterations
+        static const cv::TermCriteria refineCriteria = cv::TermCriteria(cv::TermCriteria::COUNT + cv::TermCriteria::EPS, 5, 0.01f);
+
         static const float scaleWarpMatrix[] = {
            1,   1,   2,
            1,   1,   2,
@@ -1032,29 +1454,61 @@ namespace motioncam {
         cv::Mat warpMatrix = cv::Mat::eye(3, 3, CV_32F);
 
         //
-        // Align image using the pyramid to speed things up. Skip the original size image and use estimate from
-        // second largest image.
+        // Cheap global motion estimate from the coarsest pyramid level. For
+        // static scenes (locked off shots) skip the ECC solve entirely and
+        // keep the identity warp. Misalignment is still caught downstream by
+        // the ghost map error check.
+        //
+
+        cv::Mat coarseDiff;
+        cv::absdiff(curPyramid.back(), refPyramid.back(), coarseDiff);
+
+        const float motionEstimate = cv::mean(coarseDiff)[0];
+
+        if(motionEstimate < STATIC_SCENE_THRESHOLD) {
+            logger::log("Static scene (motion=" + std::to_string(motionEstimate) + "), skipping registration");
+            return warpMatrix;
+        }
+
+        //
+        // Coarse to fine: the full iteration budget is only spent down to
+        // quarter resolution, then a single short refinement runs at full
+        // resolution. The coarse estimate is already close, so the
+        // expensive fine levels don't need a full solve each.
         //
 
-        for(int i = (int) curPyramid.size() - 1; i > 0; i--) {
+        const int FINEST_COARSE_LEVEL = 2;
+
+        for(int i = (int) curPyramid.size() - 1; i >= FINEST_COARSE_LEVEL; i--) {
             try {
                 cv::findTransformECC(curPyramid[i], refPyramid[i], warpMatrix, cv::MOTION_HOMOGRAPHY, termCriteria);
             }
             catch(cv::Exception& e) {
                 return cv::Mat();
             }
-            
-            if(i > 0)
-                warpMatrix = warpMatrix.mul(s);
+
+            warpMatrix = warpMatrix.mul(s);
         }
-        
+
+        // Scale the estimate the rest of the way to full resolution
+        for(int i = FINEST_COARSE_LEVEL - 1; i > 0; i--)
+            warpMatrix = warpMatrix.mul(s);
+
+        try {
+            cv::findTransformECC(curPyramid[0], refPyramid[0], warpMatrix, cv::MOTION_HOMOGRAPHY, refineCriteria);
+        }
+        catch(cv::Exception& e) {
+            // Keep the coarse estimate; the ghost map error check
+            // downstream rejects the frame if it isn't good enough
+        }
+
         return warpMatrix;
     }
 
     cv::Mat ImageProcessor::registerImage(
         const Halide::Runtime::Buffer<uint8_t>& referenceBuffer, const Halide::Runtime::Buffer<uint8_t>& toAlignBuffer)
     {
-        //Measure measure("registerImage()");
+        Measure measure("registerImage()");
 
 //        cv::Mat referenceImage(referenceBuffer.height(), referenceBuffer.width(), CV_8U, (void*) referenceBuffer.data());
 //        cv::Mat toAlignImage(toAlignBuffer.height(), toAlignBuffer.width(), CV_8U, (void*) toAlignBuffer.data());
@@ -1104,16 +1558,72 @@ namespace motioncam {
         return cv::Mat();
     }
 
+    // Derives the requested normalization from raw bin counts without
+    // touching the frame again
+    static cv::Mat normalizeHistogram(const cv::Mat& counts, const bool cumulative) {
+        cv::Mat histogram = counts.clone();
+
+        if(cumulative) {
+            for(int i = 1; i < histogram.cols; i++) {
+                histogram.at<float>(i) += histogram.at<float>(i - 1);
+            }
+
+            histogram /= histogram.at<float>(histogram.cols - 1);
+        }
+        else {
+            histogram /= (std::max)(1.0, cv::sum(counts)[0]);
+        }
+
+        return histogram;
+    }
+
+    // Per-frame histogram cache. The estimation stages (shadows, exposure
+    // compensation, clipping stats) and the shadows preview path all
+    // histogram the same frame within a fraction of a second, and
+    // measure_image walks the full raw frame each time. The bin counts are
+    // computed once per frame and every normalization is derived from them.
+    // Keyed by the frame timestamp, which is unique within a session; the
+    // dimensions guard against a stale hit when a session mixes cameras.
+    struct FrameHistogramKey {
+        int64_t timestampNs;
+        int32_t width;
+        int32_t height;
+
+        bool operator<(const FrameHistogramKey& other) const {
+            return std::tie(timestampNs, width, height) <
+                   std::tie(other.timestampNs, other.width, other.height);
+        }
+    };
+
+    struct FrameHistogramEntry {
+        int downscale;
+        cv::Mat counts;
+    };
+
+    static std::mutex gFrameHistogramMutex;
+    static std::map<FrameHistogramKey, FrameHistogramEntry> gFrameHistograms;
+
     cv::Mat ImageProcessor::calcHistogram(const RawCameraMetadata& cameraMetadata,
                                           const RawImageBuffer& buffer,
                                           const bool cumulative,
                                           const int downscale)
     {
-        //Measure measure("calcHistogram()");
+        Measure measure("calcHistogram()");
         const int SCALE = downscale;
-        
-        const int width = buffer.width/2/SCALE;
-        const int height = buffer.height/2/SCALE;
+
+        const FrameHistogramKey key = { buffer.metadata.timestampNs, buffer.width, buffer.height };
+
+        {
+            std::lock_guard<std::mutex> lock(gFrameHistogramMutex);
+
+            auto it = gFrameHistograms.find(key);
+
+            // Serve any request sampled at least as coarsely as the cached
+            // counts - a finer histogram is a strictly better estimate of
+            // the same distribution
+            if(it != gFrameHistograms.end() && it->second.downscale <= SCALE)
+                return normalizeHistogram(it->second.counts, cumulative);
+        }
 
         std::vector<Halide::Runtime::Buffer<float>> shadingMapBuffer;
 
@@ -1165,27 +1675,33 @@ namespace motioncam {
         
         //
 
-        cv::Mat histogram(histogramBuffer.height(), histogramBuffer.width(), CV_32S, histogramBuffer.data());
-        
-        histogram.convertTo(histogram, CV_32F);
-        
-        if(cumulative) {
-            for(int i = 1; i < histogram.cols; i++) {
-                histogram.at<float>(i) += histogram.at<float>(i - 1);
-            }
-            
-            histogram /= histogram.at<float>(histogram.cols - 1);
-        }
-        else {
-            for(int i = 0; i < histogram.cols; i++) {
-                histogram.at<float>(i) /= (width*height);
-            }
+        cv::Mat counts(histogramBuffer.height(), histogramBuffer.width(), CV_32S, histogramBuffer.data());
+
+        counts.convertTo(counts, CV_32F);
+
+        {
+            std::lock_guard<std::mutex> lock(gFrameHistogramMutex);
+
+            // Captures are transient; a handful of frames covers all the
+            // estimation stages that share a histogram
+            if(gFrameHistograms.size() > 16)
+                gFrameHistograms.clear();
+
+            gFrameHistograms[key] = { SCALE, counts };
         }
-                    
-        return histogram;
+
+        return normalizeHistogram(counts, cumulative);
     }
 
     void ImageProcessor::process(RawContainer& rawContainer, const std::string& outputPath, const ImageProcessorProgress& progressListener)
+    {
+        process(rawContainer, outputPath, progressListener, nullptr);
+    }
+
+    void ImageProcessor::process(RawContainer& rawContainer,
+                                 const std::string& outputPath,
+                                 const ImageProcessorProgress& progressListener,
+                                 PostProcessSettings* burstSettings)
     {
         cv::ocl::setUseOpenCL(false);
         
@@ -1199,11 +1715,35 @@ namespace motioncam {
         // Remove all underexposed images
         if(rawContainer.isHdr()) {
             auto refEv = getMinEv(rawContainer);
-            
+
+            // Frame records, when present, give the EV of every frame from
+            // the footer so only the frames being removed are read
+            std::vector<FrameRecord> records;
+            std::map<int64_t, double> frameEvs;
+
+            if(rawContainer.getFrameRecords(records)) {
+                RawImageMetadata recordMetadata;
+
+                for(const auto& record : records) {
+                    recordMetadata.exposureTime = record.exposureTime;
+                    recordMetadata.iso = record.iso;
+
+                    frameEvs[record.timestamp] = calcEv(rawContainer.getCameraMetadata(), recordMetadata);
+                }
+            }
+
             for(const auto& frameName : rawContainer.getFrames()) {
-                auto frame = rawContainer.getFrame(frameName);
-                auto ev = calcEv(rawContainer.getCameraMetadata(), frame->metadata);
-                        
+                double ev;
+                auto evIt = frameEvs.find(rawContainer.getFrameTimestamp(frameName));
+
+                if(evIt != frameEvs.end()) {
+                    ev = evIt->second;
+                }
+                else {
+                    auto frame = rawContainer.getFrame(frameName);
+                    ev = calcEv(rawContainer.getCameraMetadata(), frame->metadata);
+                }
+
                 if(ev - refEv > 1.0f) {
                     // Load the frame since we intend to remove it from the container
                     auto raw = rawContainer.loadFrame(frameName);
@@ -1241,7 +1781,19 @@ namespace motioncam {
 
         auto referenceBayer = loadRawImage(*referenceRawBuffer, rawContainer.getCameraMetadata());
         PostProcessSettings settings = rawContainer.getPostProcessSettings();
-        
+
+        // Reuse the scene estimates from an earlier shot of the same burst
+        if(burstSettings && burstSettings->shadows >= 0) {
+            if(settings.shadows < 0)
+                settings.shadows = burstSettings->shadows;
+
+            if(settings.blacks < 0)
+                settings.blacks = burstSettings->blacks;
+
+            if(settings.whitePoint < 0)
+                settings.whitePoint = burstSettings->whitePoint;
+        }
+
         // Estimate shadows if not set
         if(settings.shadows < 0) {
             float ev = calcEv(rawContainer.getCameraMetadata(), referenceRawBuffer->metadata);
@@ -1255,56 +1807,80 @@ namespace motioncam {
         if(settings.blacks < 0 || settings.whitePoint < 0) {
             estimateBlackWhitePoint(*referenceRawBuffer, rawContainer.getCameraMetadata(), settings, settings.blacks, settings.whitePoint);
         }
-                
+
+        // Keep the estimates for the remaining shots of the burst
+        if(burstSettings && burstSettings->shadows < 0)
+            *burstSettings = settings;
+
         //
         // Save preview
         //
-        
-        Halide::Runtime::Buffer<uint8_t> preview;
-        PostProcessSettings previewSettings = settings;
-        
-        preview = createPreview(*referenceRawBuffer, 2, rawContainer.getCameraMetadata(), previewSettings);
-        
+
         std::string basePath, filename;
 
-        cv::Mat previewImage(preview.height(), preview.width(), CV_8UC4, preview.data());
-                
         util::GetBasePath(outputPath, basePath, filename);
         std::string previewPath = basePath + "/PREVIEW_" + filename;
-        
-        cv::cvtColor(previewImage, previewImage, cv::COLOR_RGBA2BGR);
-        cv::imwrite(previewPath, previewImage);
-        
-        // Parse the returned metadata
-        std::string metadataJson = progressListener.onPreviewSaved(previewPath);
-        previewImage.release();
+
+        // Generate and save the preview while HDR preparation and denoising run. Both only read
+        // the reference RAW data so they can safely overlap.
+        std::thread previewThread([&]() {
+            PostProcessSettings previewSettings = settings;
+
+            auto preview = createPreview(*referenceRawBuffer, 2, rawContainer.getCameraMetadata(), previewSettings);
+            cv::Mat previewImage(preview.height(), preview.width(), CV_8UC4, preview.data());
+
+            cv::cvtColor(previewImage, previewImage, cv::COLOR_RGBA2BGR);
+            cv::imwrite(previewPath, previewImage);
+        });
 
         //
         // HDR
         //
-        
+
+        // HDR preparation (registration and exposure matching) only reads
+        // the reference RAW data and the chosen underexposed buffer, so it
+        // runs alongside the denoise below instead of serializing ahead of
+        // it. A failed preparation falls back to a non-HDR merge.
         shared_ptr<HdrMetadata> hdrMetadata;
-  
+        std::thread hdrThread;
+
         if(!underexposedImages.empty()){
-            hdrMetadata = prepareHdr(rawContainer.getCameraMetadata(),
-                       settings,
-                       *referenceRawBuffer,
-                       *underexposedImages[0]);
+            hdrThread = std::thread([&]() {
+                try {
+                    hdrMetadata = prepareHdr(rawContainer.getCameraMetadata(),
+                               settings,
+                               *referenceRawBuffer,
+                               *underexposedImages[0]);
+                }
+                catch(const std::exception& e) {
+                    logger::log(std::string("prepareHdr() failed: ") + e.what());
+                }
+            });
         }
-        
-        underexposedImages.clear();
-        
+
         //
         // Denoise
         //
-        
+
         ImageProgressHelper progressHelper(progressListener, static_cast<int>(rawContainer.getFrames().size()), 0);
-        
+
         std::vector<Halide::Runtime::Buffer<uint16_t>> denoiseOutput;
         float noise = 0.0f;
-        
+
         denoiseOutput = denoise(*referenceRawBuffer, *referenceBayer, rawContainer, &noise, progressHelper);
-        
+
+        // The preview and HDR preparation read the reference RAW data, so wait for them before
+        // releasing. The listener callback has to happen on this thread because JNI listeners
+        // are bound to it.
+        previewThread.join();
+
+        if(hdrThread.joinable())
+            hdrThread.join();
+
+        underexposedImages.clear();
+
+        std::string metadataJson = progressListener.onPreviewSaved(previewPath);
+
         // Release RAW data
         referenceRawBuffer->data.reset();
         referenceBayer = nullptr;
@@ -1374,9 +1950,16 @@ namespace motioncam {
         
         progressHelper.postProcessCompleted();
          
-        // Write image
+        // Encode the image into memory so the EXIF pass works on the encoded
+        // bytes instead of reading back and rewriting the file; the finished
+        // JPEG hits the disk exactly once. The thumbnail only reads the
+        // output image so it can be generated while the encode runs.
         std::vector<int> writeParams = { cv::IMWRITE_JPEG_QUALITY, rawContainer.getPostProcessSettings().jpegQuality };
-        cv::imwrite(outputPath, outputImage, writeParams);
+        std::vector<uint8_t> encodedImage;
+
+        std::thread writeThread([&]() {
+            cv::imencode(".jpg", outputImage, encodedImage, writeParams);
+        });
 
         // Create thumbnail
         cv::Mat thumbnail;
@@ -1386,10 +1969,13 @@ namespace motioncam {
 
         cv::resize(outputImage, thumbnail, cv::Size(width, height));
 
-        // Add exif data to the output image
+        writeThread.join();
+
+        // Add exif data to the encoded image and write it out
         auto exifMetadata = referenceRawBuffer->metadata;
 
         addExifMetadata(exifMetadata,
+                        encodedImage,
                         thumbnail,
                         rawContainer.getCameraMetadata(),
                         rawContainer.getPostProcessSettings(),
@@ -1411,10 +1997,43 @@ namespace motioncam {
             progressListener.onError("No frames found");
             return;
         }
-        
+
         process(*container, outputPath, progressListener);
     }
 
+    void ImageProcessor::processBurst(const std::vector<std::string>& inputPaths,
+                                      const std::vector<std::string>& outputPaths,
+                                      const ImageProcessorProgress& progressListener)
+    {
+        Measure measure("processBurst()");
+
+        if(inputPaths.empty() || inputPaths.size() != outputPaths.size()) {
+            progressListener.onError("Invalid burst");
+            return;
+        }
+
+        // The shots are of the same scene, so the scene estimates (shadows,
+        // black and white point) of the first shot are shared with the rest
+        // of the burst. Processing the whole burst in one call also keeps the
+        // pipelines and their buffer pools warm between shots.
+        PostProcessSettings burstSettings;
+
+        burstSettings.shadows = -1;
+        burstSettings.blacks = -1;
+        burstSettings.whitePoint = -1;
+
+        for(size_t i = 0; i < inputPaths.size(); i++) {
+            auto container = RawContainer::Open(inputPaths[i]);
+
+            if(container->getFrames().empty()) {
+                progressListener.onError("No frames found");
+                continue;
+            }
+
+            process(*container, outputPaths[i], progressListener, &burstSettings);
+        }
+    }
+
     float ImageProcessor::adjustShadowsForFaces(cv::Mat input, PreviewMetadata& metadata) {
         return 1.0f;
                 
@@ -1445,19 +2064,15 @@ namespace motioncam {
 //        return std::min(4.0f, std::max(1.0f, 128.0f / L));
     }
     
-    void ImageProcessor::addExifMetadata(const RawImageMetadata& metadata,
-                                         const cv::Mat& thumbnail,
-                                         const RawCameraMetadata& cameraMetadata,
-                                         const PostProcessSettings& settings,
-                                         const std::string& inputOutput)
+    static void setExifMetadata(Exiv2::Image& image,
+                                const RawImageMetadata& metadata,
+                                const cv::Mat& thumbnail,
+                                const RawCameraMetadata& cameraMetadata,
+                                const PostProcessSettings& settings)
     {
-        auto image = Exiv2::ImageFactory::open(inputOutput);
-        if(image.get() == nullptr)
-            return;
-        
-        image->readMetadata();
-        
-        Exiv2::ExifData& exifData = image->exifData();
+        image.readMetadata();
+
+        Exiv2::ExifData& exifData = image.exifData();
         
         // sRGB color space
         exifData["Exif.Photo.ColorSpace"]       = uint16_t(1);
@@ -1528,12 +2143,54 @@ namespace motioncam {
             
             exifThumb.setJpegThumbnail(thumbnailBuffer.data(), thumbnailBuffer.size());
         }
-        
-        image->writeMetadata();
+
+        image.writeMetadata();
+    }
+
+    void ImageProcessor::addExifMetadata(const RawImageMetadata& metadata,
+                                         const cv::Mat& thumbnail,
+                                         const RawCameraMetadata& cameraMetadata,
+                                         const PostProcessSettings& settings,
+                                         const std::string& inputOutput)
+    {
+        auto image = Exiv2::ImageFactory::open(inputOutput);
+        if(image.get() == nullptr)
+            return;
+
+        setExifMetadata(*image, metadata, thumbnail, cameraMetadata, settings);
+    }
+
+    void ImageProcessor::addExifMetadata(const RawImageMetadata& metadata,
+                                         const std::vector<uint8_t>& encodedImage,
+                                         const cv::Mat& thumbnail,
+                                         const RawCameraMetadata& cameraMetadata,
+                                         const PostProcessSettings& settings,
+                                         const std::string& outputPath)
+    {
+        auto image = Exiv2::ImageFactory::open(encodedImage.data(), encodedImage.size());
+        if(image.get() == nullptr)
+            return;
+
+        setExifMetadata(*image, metadata, thumbnail, cameraMetadata, settings);
+
+        // Single write of the finished image. Going through memory avoids
+        // reading back and rewriting a multi-megabyte file just to add the
+        // metadata.
+        Exiv2::FileIo out(outputPath);
+        if(out.open("wb") != 0)
+            throw IOException("Failed to open " + outputPath);
+
+        Exiv2::BasicIo& io = image->io();
+        io.seek(0, Exiv2::BasicIo::beg);
+
+        if(out.write(io) <= 0)
+            throw IOException("Failed to write " + outputPath);
+
+        out.close();
     }
 
     double ImageProcessor::measureSharpness(const RawCameraMetadata& cameraMetadata, const RawImageBuffer& rawBuffer) {
-        //Measure measure("measureSharpness()");
+        Measure measure("measureSharpness()");
         
         int halfWidth  = rawBuffer.width / 2;
         int halfHeight = rawBuffer.height / 2;
@@ -1556,10 +2213,398 @@ namespace motioncam {
         
         cv::Scalar m, stddev;
         cv::meanStdDev(output, m, stddev);
-        
+
         return m[0];
     }
 
+    double ImageProcessor::measureSharpnessRoi(const RawCameraMetadata& cameraMetadata,
+                                               const RawImageBuffer& rawBuffer,
+                                               const float roiX,
+                                               const float roiY,
+                                               const float roiWidth,
+                                               const float roiHeight,
+                                               const int window)
+    {
+        Measure measure("measureSharpnessRoi()");
+
+        const int halfWidth  = rawBuffer.width / 2;
+        const int halfHeight = rawBuffer.height / 2;
+
+        // ROI in half resolution green plane coordinates
+        int x0 = static_cast<int>(roiX * halfWidth);
+        int y0 = static_cast<int>(roiY * halfHeight);
+        int x1 = static_cast<int>((roiX + roiWidth) * halfWidth);
+        int y1 = static_cast<int>((roiY + roiHeight) * halfHeight);
+
+        x0 = std::max(0, std::min(x0, halfWidth - 2));
+        y0 = std::max(0, std::min(y0, halfHeight - 2));
+        x1 = std::max(x0 + 2, std::min(x1, halfWidth));
+        y1 = std::max(y0 + 2, std::min(y1, halfHeight));
+
+        const int roiW = x1 - x0;
+        const int roiH = y1 - y0;
+
+        // Green offset inside each 2x2 quad
+        int greenX = 1;
+
+        if(cameraMetadata.sensorArrangment == ColorFilterArrangment::GRBG ||
+           cameraMetadata.sensorArrangment == ColorFilterArrangment::GBRG)
+        {
+            greenX = 0;
+        }
+
+        auto* data = rawBuffer.data->lock(false);
+        if(data == nullptr) {
+            rawBuffer.data->unlock();
+            return -1e10;
+        }
+
+        // Unpack the green channel of the ROI. Everything outside the ROI
+        // stays packed, which is what keeps this cheap enough to run per
+        // preview frame.
+        std::vector<uint16_t> green(roiW * roiH);
+
+        for(int y = 0; y < roiH; y++) {
+            const int srcY = (y0 + y) * 2;
+            uint16_t* dstRow = &green[y * roiW];
+
+            if(rawBuffer.pixelFormat == PixelFormat::RAW10) {
+                const uint8_t* row = data + srcY * rawBuffer.rowStride;
+
+                for(int x = 0; x < roiW; x++) {
+                    const int srcX = (x0 + x) * 2 + greenX;
+                    const int X = (srcX / 4) * 4;
+                    const int p = srcX - X;
+
+                    const uint8_t* group = row + 10*X/8;
+
+                    dstRow[x] = (group[p] << 2) | ((group[4] >> (p * 2)) & 0x03);
+                }
+            }
+            else if(rawBuffer.pixelFormat == PixelFormat::RAW12) {
+                const uint8_t* row = data + srcY * rawBuffer.rowStride;
+
+                for(int x = 0; x < roiW; x++) {
+                    const int srcX = (x0 + x) * 2 + greenX;
+                    const int X = (srcX / 2) * 2;
+                    const int p = srcX - X;
+
+                    const uint8_t* group = row + 12*X/8;
+
+                    dstRow[x] = (group[p] << 4) | ((group[2] >> (p * 4)) & 0x0F);
+                }
+            }
+            else if(rawBuffer.pixelFormat == PixelFormat::RAW16) {
+                const uint8_t* row = data + srcY * rawBuffer.rowStride;
+
+                for(int x = 0; x < roiW; x++) {
+                    const int srcX = (x0 + x) * 2 + greenX;
+
+                    dstRow[x] = row[srcX*2] | (row[srcX*2 + 1] << 8);
+                }
+            }
+            else {
+                rawBuffer.data->unlock();
+                return -1e10;
+            }
+        }
+
+        rawBuffer.data->unlock();
+
+        // Normalise gradients so the score is comparable across exposures
+        const auto& whiteLevel = cameraMetadata.getWhiteLevel(rawBuffer.metadata);
+        const auto& blackLevel = cameraMetadata.getBlackLevel(rawBuffer.metadata);
+
+        const float range = std::max(1.0f, static_cast<float>(whiteLevel) - blackLevel[1]);
+
+        // Variance of the gradient magnitude per tile, averaged across the
+        // ROI. Averaging tile variances instead of pooling the whole ROI
+        // keeps a single strong edge from masking an otherwise defocused
+        // region.
+        double totalVariance = 0;
+        int numTiles = 0;
+
+        for(int ty = 0; ty < roiH - 1; ty += window) {
+            const int tileH = std::min(window, roiH - 1 - ty);
+
+            for(int tx = 0; tx < roiW - 1; tx += window) {
+                const int tileW = std::min(window, roiW - 1 - tx);
+
+                double sum = 0;
+                double sumSq = 0;
+
+                for(int y = ty; y < ty + tileH; y++) {
+                    const uint16_t* row = &green[y * roiW];
+                    const uint16_t* nextRow = &green[(y + 1) * roiW];
+
+                    for(int x = tx; x < tx + tileW; x++) {
+                        const float gx = (static_cast<float>(row[x + 1]) - row[x]) / range;
+                        const float gy = (static_cast<float>(nextRow[x]) - row[x]) / range;
+
+                        const float m = std::abs(gx) + std::abs(gy);
+
+                        sum += m;
+                        sumSq += m*m;
+                    }
+                }
+
+                const double n = tileW * tileH;
+                const double mean = sum / n;
+
+                totalVariance += sumSq / n - mean*mean;
+                numTiles += 1;
+            }
+        }
+
+        if(numTiles == 0)
+            return 0;
+
+        return totalVariance / numTiles;
+    }
+
+    // Normalizes the fuse accumulator (or the bare reference) into the
+    // denoise input range. This is pure bandwidth work over a 4 channel
+    // plane, so row bands are spread across the task engine and the inner
+    // loop walks contiguous plane rows so the compiler can vectorize it.
+    template<typename T>
+    static void normalizeDenoiseInput(const Halide::Runtime::Buffer<T>& input,
+                                      const float invFrameCount,
+                                      const std::vector<float>& blackLevel,
+                                      const float whiteLevel,
+                                      Halide::Runtime::Buffer<uint16_t>& output)
+    {
+        const int width = output.width();
+        const int height = output.height();
+
+        TaskGroup group;
+
+        const int numBands = TaskEngine::get().numWorkers();
+        const int rowsPerBand = (height + numBands - 1) / numBands;
+
+        for(int band = 0; band < numBands; band++) {
+            const int y0 = band * rowsPerBand;
+            const int y1 = (std::min)(height, y0 + rowsPerBand);
+
+            if(y0 >= y1)
+                break;
+
+            TaskEngine::get().run(TaskPriority::EXPORT, [&, y0, y1] {
+                for(int c = 0; c < 4; c++) {
+                    const T* srcPlane = input.data() + c * input.dim(2).stride();
+                    uint16_t* dstPlane = output.data() + c * output.dim(2).stride();
+
+                    const float black = blackLevel[c];
+                    const float scale = EXPANDED_RANGE / (whiteLevel - black);
+
+                    for(int y = y0; y < y1; y++) {
+                        const T* src = srcPlane + y * input.dim(1).stride();
+                        uint16_t* dst = dstPlane + y * output.dim(1).stride();
+
+                        for(int x = 0; x < width; x++) {
+                            const float p = (src[x] * invFrameCount - black) * scale + 0.5f;
+
+                            dst[x] = static_cast<uint16_t>(
+                                (std::max)(0.0f, (std::min)(p, (float) EXPANDED_RANGE)));
+                        }
+                    }
+                }
+            }, group);
+        }
+
+        group.wait();
+    }
+
+    // Runs the wavelet round trip in overlapping horizontal stripes so the
+    // pyramid scratch stays bounded regardless of frame size. The shrink
+    // thresholds are estimated once, from the stripe in the middle of the
+    // frame, so every stripe uses the same per channel sigma and the seams
+    // stay invisible; the halo rows cover the support of the cascaded
+    // filters and their recompute is the price of the flat memory ceiling.
+    // outNoiseSigma and outLlMean are reported in the stored coefficient
+    // domain, matching what the full frame pass measures.
+    static void waveletDenoiseStriped(Halide::Runtime::Buffer<uint16_t>& denoiseInput,
+                                      Halide::Runtime::Buffer<float>& weightsBuffer,
+                                      const bool fp16Wavelets,
+                                      const int stripeRows,
+                                      std::vector<float>& outNoiseSigma,
+                                      std::vector<float>& outLlMean,
+                                      std::vector<Halide::Runtime::Buffer<uint16_t>>& outChannels)
+    {
+        const int width = denoiseInput.width();
+        const int height = denoiseInput.height();
+
+        // The deepest level decimates by 2^WAVELET_LEVELS; 64 rows cover the
+        // cascaded filter support on either side of a stripe
+        const int HaloRows = 64;
+
+        int coreRows = stripeRows - 2 * HaloRows;
+
+        // Keep every wavelet level an exact decimation of the stripe
+        coreRows = (std::max)(128, coreRows - coreRows % 16);
+
+        const int stripeHeight = coreRows + 2 * HaloRows;
+
+        auto forwardFunc = fp16Wavelets ? &forward_transform_fp16 : &forward_transform;
+        auto inverseFunc = fp16Wavelets ? &inverse_transform_fp16 : &inverse_transform;
+
+        auto stripeInput = createPooledBuffer<uint16_t>(width, stripeHeight, 4);
+        auto stripeOutput = createPooledBuffer<uint16_t>(width, stripeHeight);
+
+        auto wavelet = createWaveletBuffers(width, stripeHeight, fp16Wavelets);
+
+        const auto copyStripeInput = [&](const int firstRow) {
+            for(int c = 0; c < 4; c++) {
+                for(int y = 0; y < stripeHeight; y++) {
+                    // Replicate edge rows where the halo runs off the frame
+                    const int srcRow = (std::min)((std::max)(firstRow + y, 0), height - 1);
+
+                    memcpy(&stripeInput(0, y, c), &denoiseInput(0, srcRow, c), width * sizeof(uint16_t));
+                }
+            }
+        };
+
+        //
+        // Estimate the shrink thresholds from the middle of the frame
+        //
+
+        outNoiseSigma.clear();
+        outLlMean.clear();
+
+        const int middleRow = ((height / 2) / coreRows) * coreRows;
+        const int offset = wavelet[0].stride(2);
+
+        copyStripeInput(middleRow - HaloRows);
+
+        for(int c = 0; c < 4; c++) {
+            forwardFunc(stripeInput, width, stripeHeight, c, wavelet[0], wavelet[1], wavelet[2], wavelet[3]);
+
+            cv::Mat ll, hh;
+
+            if(fp16Wavelets) {
+                cv::Mat ll16(wavelet[0].height(), wavelet[0].width(), CV_16F, (uint16_t*) wavelet[0].data() + 4);
+                cv::Mat hh16(wavelet[0].height(), wavelet[0].width(), CV_16F, (uint16_t*) wavelet[0].data() + offset*7);
+
+                ll16.convertTo(ll, CV_32F);
+                hh16.convertTo(hh, CV_32F);
+            }
+            else {
+                ll = cv::Mat(wavelet[0].height(), wavelet[0].width(), CV_32F, (float*) wavelet[0].data() + 4);
+                hh = cv::Mat(wavelet[0].height(), wavelet[0].width(), CV_32F, (float*) wavelet[0].data() + offset*7);
+            }
+
+            outNoiseSigma.push_back(estimateNoise(hh));
+            outLlMean.push_back(cv::mean(ll)[0]);
+        }
+
+        //
+        // Denoise stripe by stripe
+        //
+
+        outChannels.clear();
+
+        for(int c = 0; c < 4; c++)
+            outChannels.emplace_back(width, height);
+
+        for(int firstCoreRow = 0; firstCoreRow < height; firstCoreRow += coreRows) {
+            copyStripeInput(firstCoreRow - HaloRows);
+
+            const int rowsOut = (std::min)(coreRows, height - firstCoreRow);
+
+            for(int c = 0; c < 4; c++) {
+                forwardFunc(stripeInput, width, stripeHeight, c, wavelet[0], wavelet[1], wavelet[2], wavelet[3]);
+
+                // The stored coefficients carry the 2^-(level+2) gain the
+                // forward transform folds into its float16 stores; the
+                // inverse expects noiseSigma in float32 pipeline units
+                const float noiseSigma = fp16Wavelets ? 4.0f * outNoiseSigma[c] : outNoiseSigma[c];
+
+                inverseFunc(wavelet[0],
+                            wavelet[1],
+                            wavelet[2],
+                            wavelet[3],
+                            noiseSigma,
+                            false,
+                            weightsBuffer,
+                            stripeOutput);
+
+                for(int y = 0; y < rowsOut; y++)
+                    memcpy(&outChannels[c](0, firstCoreRow + y), &stripeOutput(0, HaloRows + y), width * sizeof(uint16_t));
+            }
+        }
+    }
+
+    // Per-frame deinterleaved planes for the export's sliding merge window.
+    // With mergeFrames=N every frame is loaded once as the reference and up
+    // to 2N more times as a neighbour of the surrounding frames, and the
+    // planes and flow preview don't depend on which frame is the reference.
+    // Entries that fall out of the window are dropped at the end of each
+    // merge, and the export clears the cache when it finishes. Keyed by the
+    // frame timestamp, with the dimensions guarding against a stale hit.
+    struct RawDataCacheKey {
+        int64_t timestampNs;
+        int32_t width;
+        int32_t height;
+
+        bool operator<(const RawDataCacheKey& other) const {
+            return std::tie(timestampNs, width, height) <
+                   std::tie(other.timestampNs, other.width, other.height);
+        }
+    };
+
+    static std::mutex gRawDataCacheMutex;
+    static std::map<RawDataCacheKey, std::shared_ptr<RawData>> gRawDataCache;
+
+    static std::shared_ptr<RawData> LoadRawImageCached(const RawImageBuffer& rawBuffer,
+                                                       const RawCameraMetadata& cameraMetadata)
+    {
+        const RawDataCacheKey key = { rawBuffer.metadata.timestampNs, rawBuffer.width, rawBuffer.height };
+
+        {
+            std::lock_guard<std::mutex> lock(gRawDataCacheMutex);
+
+            auto it = gRawDataCache.find(key);
+            if(it != gRawDataCache.end())
+                return it->second;
+        }
+
+        auto rawData = ImageProcessor::loadRawImage(rawBuffer, cameraMetadata, true);
+
+        {
+            std::lock_guard<std::mutex> lock(gRawDataCacheMutex);
+
+            gRawDataCache[key] = rawData;
+        }
+
+        return rawData;
+    }
+
+    // Drops every cached frame that is not part of the current merge window
+    static void RetainRawImageCacheWindow(const RawImageBuffer& reference,
+                                          const std::vector<std::shared_ptr<RawImageBuffer>>& buffers)
+    {
+        std::vector<int64_t> window;
+
+        window.push_back(reference.metadata.timestampNs);
+        for(size_t i = 0; i < buffers.size(); i++)
+            window.push_back(buffers[i]->metadata.timestampNs);
+
+        std::lock_guard<std::mutex> lock(gRawDataCacheMutex);
+
+        auto it = gRawDataCache.begin();
+        while(it != gRawDataCache.end()) {
+            if(std::find(window.begin(), window.end(), it->first.timestampNs) == window.end())
+                it = gRawDataCache.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    void ImageProcessor::clearRawImageCache() {
+        std::lock_guard<std::mutex> lock(gRawDataCacheMutex);
+
+        gRawDataCache.clear();
+    }
+
     std::vector<Halide::Runtime::Buffer<uint16_t>> ImageProcessor::denoise(
         std::shared_ptr<RawImageBuffer> referenceRawBuffer,
         std::vector<std::shared_ptr<RawImageBuffer>> buffers,
@@ -1570,44 +2615,51 @@ namespace motioncam {
         std::vector<float> noise, signal;
 
         // Measure noise in reference
-        measureNoise(cameraMetadata, *referenceRawBuffer, noise, signal, patchSize);
+        measureNoise(cameraMetadata, *referenceRawBuffer, noise, signal, patchSize, true);
+
+        // Merged calls go through the window cache, since the reference and
+        // its neighbours are loaded again as the window slides over the
+        // surrounding frames
+        const bool useWindowCache = !buffers.empty();
+
+        auto reference = useWindowCache
+            ? LoadRawImageCached(*referenceRawBuffer, cameraMetadata)
+            : loadRawImage(*referenceRawBuffer, cameraMetadata, true);
 
-        auto reference = loadRawImage(*referenceRawBuffer, cameraMetadata, true);
-                
         cv::Mat referenceFlowImage(reference->previewBuffer.height(), reference->previewBuffer.width(), CV_8U, reference->previewBuffer.data());
-        
-        Halide::Runtime::Buffer<float> fuseOutput(reference->rawBuffer.width(), reference->rawBuffer.height(), 4);
+
+        auto fuseOutput = createPooledBuffer<float>(reference->rawBuffer.width(), reference->rawBuffer.height(), 4);
         Halide::Runtime::Buffer<float> thresholdBuffer(&noise[0], 4);
-        
+
         fuseOutput.fill(0);
-        
+
         float w = 1.0f / (2.0f*sqrt(2.0f));
 
         for(int i = 0; i < buffers.size(); i++) {
-            auto current = loadRawImage(*buffers[i], cameraMetadata, true);
-            
+            auto current = LoadRawImageCached(*buffers[i], cameraMetadata);
+
             cv::Mat flow;
             cv::Mat currentFlowImage(current->previewBuffer.height(),
                                      current->previewBuffer.width(),
                                      CV_8U,
                                      current->previewBuffer.data());
-            
+
             cv::Ptr<cv::DISOpticalFlow> opticalFlow =
                 cv::DISOpticalFlow::create(cv::DISOpticalFlow::PRESET_ULTRAFAST);
-                                
+
             opticalFlow->setPatchSize(patchSize);
             opticalFlow->setPatchStride(patchSize/2);
             opticalFlow->setGradientDescentIterations(16);
             opticalFlow->setUseMeanNormalization(true);
             opticalFlow->setUseSpatialPropagation(true);
-            
+
             opticalFlow->calc(referenceFlowImage, currentFlowImage, flow);
-            
+
             Halide::Runtime::Buffer<float> flowBuffer =
                 Halide::Runtime::Buffer<float>::make_interleaved((float*) flow.data, flow.cols, flow.rows, 2);
-            
+
             auto flowMean = cv::mean(flow);
-            
+
             fuse_denoise_7x7(
                 reference->rawBuffer,
                 current->rawBuffer,
@@ -1622,35 +2674,28 @@ namespace motioncam {
                 flowMean[1],
                 fuseOutput);
         }
-        
+
+        // Drop the frames that fell out of the merge window
+        if(useWindowCache)
+            RetainRawImageCacheWindow(*referenceRawBuffer, buffers);
+
         const int width = reference->rawBuffer.width();
         const int height = reference->rawBuffer.height();
 
-        Halide::Runtime::Buffer<uint16_t> denoiseInput(width, height, 4);
+        auto denoiseInput = createPooledBuffer<uint16_t>(width, height, 4);
         
         auto whiteLevel = cameraMetadata.getWhiteLevel(reference->metadata);
         const auto& blackLevel = cameraMetadata.getBlackLevel(reference->metadata);
 
         if(buffers.empty())
-            denoiseInput.for_each_element([&](int x, int y, int c) {
-                float p = reference->rawBuffer(x, y, c) - blackLevel[c];
-                float s = EXPANDED_RANGE / (float) (whiteLevel-blackLevel[c]);
-                
-                denoiseInput(x, y, c) = static_cast<uint16_t>( (std::max)(0.0f, (std::min)(p * s + 0.5f, (float) EXPANDED_RANGE) )) ;
-            });
-        else {
-            const float n = static_cast<float>(buffers.size());
-
-            denoiseInput.for_each_element([&](int x, int y, int c) {
-                float p = fuseOutput(x, y, c) / n - blackLevel[c];
-                float s = EXPANDED_RANGE / (float) (whiteLevel-blackLevel[c]);
-                
-                denoiseInput(x, y, c) = static_cast<uint16_t>( (std::max)(0.0f, (std::min)(p * s + 0.5f, (float) EXPANDED_RANGE) ) ) ;
-            });
-        }
+            normalizeDenoiseInput(reference->rawBuffer, 1.0f, blackLevel, whiteLevel, denoiseInput);
+        else
+            normalizeDenoiseInput(fuseOutput, 1.0f / buffers.size(), blackLevel, whiteLevel, denoiseInput);
         
-        // Don't need this anymore
-        reference->rawBuffer = Halide::Runtime::Buffer<uint16_t>();
+        // Don't need this anymore. Cached references keep their planes,
+        // since the window reuses them as a neighbour of the next frames
+        if(!useWindowCache)
+            reference->rawBuffer = Halide::Runtime::Buffer<uint16_t>();
 
         //
         // Spatial denoising
@@ -1658,40 +2703,88 @@ namespace motioncam {
 
         std::vector<Halide::Runtime::Buffer<uint16_t>> denoiseOutput;
         std::vector<float> weights = denoiseWeights;
-        
-        auto wavelet = createWaveletBuffers(denoiseInput.width(), denoiseInput.height());
+
+        // With every weight at zero the wavelet round trip is an identity
+        // apart from its cost, so hand back the fused input directly
+        const float weightSum = std::accumulate(weights.begin(), weights.end(), 0.0f);
+
+        if(weightSum < 1e-5f) {
+            for(int c = 0; c < 4; c++) {
+                auto outputBuffer = createPooledBuffer<uint16_t>(width, height);
+
+                outputBuffer.for_each_element([&](int x, int y) {
+                    outputBuffer(x, y) = denoiseInput(x, y, c);
+                });
+
+                denoiseOutput.push_back(outputBuffer);
+            }
+
+            return denoiseOutput;
+        }
+
+        const bool fp16Wavelets = gUseFp16Wavelets;
+        const int stripeRows = gDenoiseStripeRows;
+
         auto weightsBuffer = Halide::Runtime::Buffer<float>(&weights[0], WAVELET_LEVELS);
 
+        if(stripeRows > 0 && height > stripeRows) {
+            std::vector<float> stripeNoiseSigma, stripeLlMean;
+
+            waveletDenoiseStriped(denoiseInput, weightsBuffer, fp16Wavelets, stripeRows, stripeNoiseSigma, stripeLlMean, denoiseOutput);
+
+            return denoiseOutput;
+        }
+
+        auto wavelet = createWaveletBuffers(denoiseInput.width(), denoiseInput.height(), fp16Wavelets);
+
+        auto forwardFunc = fp16Wavelets ? &forward_transform_fp16 : &forward_transform;
+        auto inverseFunc = fp16Wavelets ? &inverse_transform_fp16 : &inverse_transform;
+
         for(int c = 0; c < 4; c++) {
-            forward_transform(denoiseInput,
-                              denoiseInput.width(),
-                              denoiseInput.height(),
-                              c,
-                              wavelet[0],
-                              wavelet[1],
-                              wavelet[2],
-                              wavelet[3]);
+            forwardFunc(denoiseInput,
+                        denoiseInput.width(),
+                        denoiseInput.height(),
+                        c,
+                        wavelet[0],
+                        wavelet[1],
+                        wavelet[2],
+                        wavelet[3]);
 
             int offset = wavelet[0].stride(2);
 
-            cv::Mat hh(wavelet[0].height(), wavelet[0].width(), CV_32F, wavelet[0].data() + offset*7);
-            
-            float noiseSigma = estimateNoise(hh);
-            
-            Halide::Runtime::Buffer<uint16_t> outputBuffer(width, height);
+            float noiseSigma;
 
-            inverse_transform(wavelet[0],
-                              wavelet[1],
-                              wavelet[2],
-                              wavelet[3],
-                              noiseSigma,
-                              false,
-                              weightsBuffer,
-                              outputBuffer);
+            if(fp16Wavelets) {
+                cv::Mat hh16(wavelet[0].height(), wavelet[0].width(), CV_16F, (uint16_t*) wavelet[0].data() + offset*7);
+                cv::Mat hh;
+
+                hh16.convertTo(hh, CV_32F);
+
+                // The stored coefficients carry the 2^-(level+2) gain the
+                // forward transform folds into its float16 stores; the
+                // inverse expects noiseSigma in float32 pipeline units
+                noiseSigma = 4.0f * estimateNoise(hh);
+            }
+            else {
+                cv::Mat hh(wavelet[0].height(), wavelet[0].width(), CV_32F, (float*) wavelet[0].data() + offset*7);
+
+                noiseSigma = estimateNoise(hh);
+            }
+
+            auto outputBuffer = createPooledBuffer<uint16_t>(width, height);
+
+            inverseFunc(wavelet[0],
+                        wavelet[1],
+                        wavelet[2],
+                        wavelet[3],
+                        noiseSigma,
+                        false,
+                        weightsBuffer,
+                        outputBuffer);
 
             denoiseOutput.push_back(outputBuffer);
         }
-        
+
         return denoiseOutput;
     }
 
@@ -1704,27 +2797,31 @@ namespace motioncam {
         std::vector<float> noise, signal;
 
         // Measure noise in reference
-        measureNoise(cameraMetadata, *referenceRawBuffer, noise, signal, patchSize);
+        measureNoise(cameraMetadata, *referenceRawBuffer, noise, signal, patchSize, true);
 
         auto reference = loadRawImage(*referenceRawBuffer, cameraMetadata, true);
                 
         cv::Mat referenceFlowImage(reference->previewBuffer.height(), reference->previewBuffer.width(), CV_8U, reference->previewBuffer.data());
         
-        Halide::Runtime::Buffer<float> fuseOutput(reference->rawBuffer.width(), reference->rawBuffer.height(), 4);
+        auto fuseOutput = createPooledBuffer<float>(reference->rawBuffer.width(), reference->rawBuffer.height(), 4);
         Halide::Runtime::Buffer<float> thresholdBuffer(&noise[0], 4);
         
         fuseOutput.fill(0);
         
         float w = 1.0f / (2.0f*sqrt(2.0f));
 
+        // Recycled across the loop; loadRawImage only reallocates the
+        // planes when the extents change
+        RawData current;
+
         for(int i = 0; i < buffers.size(); i++) {
-            auto current = loadRawImage(*buffers[i], cameraMetadata, true);
-            
+            loadRawImage(*buffers[i], cameraMetadata, current, true);
+
             cv::Mat flow;
-            cv::Mat currentFlowImage(current->previewBuffer.height(),
-                                     current->previewBuffer.width(),
+            cv::Mat currentFlowImage(current.previewBuffer.height(),
+                                     current.previewBuffer.width(),
                                      CV_8U,
-                                     current->previewBuffer.data());
+                                     current.previewBuffer.data());
             
             cv::Ptr<cv::DISOpticalFlow> opticalFlow =
                 cv::DISOpticalFlow::create(cv::DISOpticalFlow::PRESET_ULTRAFAST);
@@ -1744,7 +2841,7 @@ namespace motioncam {
             
             fuse_denoise_7x7(
                 reference->rawBuffer,
-                current->rawBuffer,
+                current.rawBuffer,
                 fuseOutput,
                 flowBuffer,
                 thresholdBuffer,
@@ -1781,7 +2878,7 @@ namespace motioncam {
         
         std::vector<float> noise, signal;
         
-        measureNoise(rawContainer.getCameraMetadata(), referenceRawBuffer, noise, signal, patchSize);
+        measureNoise(rawContainer.getCameraMetadata(), referenceRawBuffer, noise, signal, patchSize, true);
         
         float signalAverage = std::accumulate(signal.begin(), signal.end(), 0.0f) / signal.size();
         signalAverage /= whiteLevel;
@@ -1795,7 +2892,7 @@ namespace motioncam {
         std::vector<Halide::Runtime::Buffer<uint16_t>> result;
         
         cv::Mat referenceFlowImage(reference.previewBuffer.height(), reference.previewBuffer.width(), CV_8U, reference.previewBuffer.data());
-        Halide::Runtime::Buffer<float> fuseOutput(reference.rawBuffer.width(), reference.rawBuffer.height(), 4);
+        auto fuseOutput = createPooledBuffer<float>(reference.rawBuffer.width(), reference.rawBuffer.height(), 4);
         
         fuseOutput.fill(0);
                 
@@ -1818,88 +2915,182 @@ namespace motioncam {
         //
         // Fuse
         //
-        
-        while(it != processFrames.end()) {
-            auto frame = rawContainer.loadFrame(*it);
-            auto current = loadRawImage(*frame, rawContainer.getCameraMetadata());
-            
-            cv::Mat flow;
-            cv::Mat currentFlowImage(current->previewBuffer.height(),
-                                     current->previewBuffer.width(),
-                                     CV_8U,
-                                     current->previewBuffer.data());
-            
-            cv::Ptr<cv::DISOpticalFlow> opticalFlow =
-                cv::DISOpticalFlow::create(cv::DISOpticalFlow::PRESET_ULTRAFAST);
-                                
-            opticalFlow->setPatchSize(patchSize);
-            opticalFlow->setPatchStride(patchSize/2);
-            opticalFlow->setGradientDescentIterations(16);
-            opticalFlow->setUseMeanNormalization(true);
-            opticalFlow->setUseSpatialPropagation(true);
-            
-            opticalFlow->calc(referenceFlowImage, currentFlowImage, flow);
-            
-            Halide::Runtime::Buffer<float> flowBuffer =
-                Halide::Runtime::Buffer<float>::make_interleaved((float*) flow.data, flow.cols, flow.rows, 2);
-            
-            auto flowMean = cv::mean(flow);
-            
-            method(
-                reference.rawBuffer,
-                current->rawBuffer,
-                fuseOutput,
-                flowBuffer,
-                thresholdBuffer,
-                reference.rawBuffer.width(),
-                reference.rawBuffer.height(),
-                w,
-                4.0f,
-                flowMean[0],
-                flowMean[1],
-                fuseOutput);
-            
-            progressHelper.nextFusedImage();
 
-            frame->data->release();
-            
-            ++it;
+        const int fuseBatchFrames = gFuseBatchFrames;
+
+        if(fuseBatchFrames > 1) {
+            // Batched merge. Frames are fused fuseBatchFrames at a time so
+            // the accumulator is only read and written once per batch, at
+            // the cost of keeping the whole batch of deinterleaved frames
+            // resident.
+            auto batchMethod = &fuse_denoise_batch_3x3;
+
+            if(signalAverage < 0.02f) {
+                batchMethod = &fuse_denoise_batch_7x7;
+            }
+            else if(signalAverage < 0.04f) {
+                batchMethod = &fuse_denoise_batch_5x5;
+            }
+
+            const int fuseWidth = reference.rawBuffer.width();
+            const int fuseHeight = reference.rawBuffer.height();
+
+            auto batchInput = createPooledBuffer<uint16_t>(fuseWidth, fuseHeight, 4, fuseBatchFrames);
+            Halide::Runtime::Buffer<float> flowMaps;
+            Halide::Runtime::Buffer<float> flowMeans(2, fuseBatchFrames);
+
+            // Each frame deinterleaves straight into its slice of the batch
+            // input, so batching introduces no extra copy
+            std::vector<RawData> currents(fuseBatchFrames);
+
+            for(int n = 0; n < fuseBatchFrames; n++)
+                currents[n].rawBuffer = batchInput.sliced(3, n);
+
+            while(it != processFrames.end()) {
+                int numFrames = 0;
+
+                while(numFrames < fuseBatchFrames && it != processFrames.end()) {
+                    auto frame = rawContainer.loadFrame(*it);
+                    auto& current = currents[numFrames];
+
+                    loadRawImage(*frame, rawContainer.getCameraMetadata(), current);
+
+                    frame->data->release();
+
+                    cv::Mat flow;
+                    cv::Mat currentFlowImage(current.previewBuffer.height(),
+                                             current.previewBuffer.width(),
+                                             CV_8U,
+                                             current.previewBuffer.data());
+
+                    cv::Ptr<cv::DISOpticalFlow> opticalFlow =
+                        cv::DISOpticalFlow::create(cv::DISOpticalFlow::PRESET_ULTRAFAST);
+
+                    opticalFlow->setPatchSize(patchSize);
+                    opticalFlow->setPatchStride(patchSize/2);
+                    opticalFlow->setGradientDescentIterations(16);
+                    opticalFlow->setUseMeanNormalization(true);
+                    opticalFlow->setUseSpatialPropagation(true);
+
+                    opticalFlow->calc(referenceFlowImage, currentFlowImage, flow);
+
+                    if(!flowMaps.data()) {
+                        // Stacked interleaved flow maps, one slice per frame
+                        halide_dimension_t flowShape[] = {
+                            { 0, flow.cols, 2 },
+                            { 0, flow.rows, flow.cols*2 },
+                            { 0, 2, 1 },
+                            { 0, fuseBatchFrames, flow.cols*flow.rows*2 }
+                        };
+
+                        flowMaps = Halide::Runtime::Buffer<float>(nullptr, 4, flowShape);
+                        flowMaps.allocate();
+                    }
+
+                    std::memcpy(flowMaps.data() + (size_t) numFrames*flow.cols*flow.rows*2,
+                                flow.data,
+                                (size_t) flow.cols*flow.rows*2*sizeof(float));
+
+                    auto flowMean = cv::mean(flow);
+
+                    flowMeans(0, numFrames) = (float) flowMean[0];
+                    flowMeans(1, numFrames) = (float) flowMean[1];
+
+                    ++numFrames;
+                    ++it;
+                }
+
+                batchMethod(
+                    reference.rawBuffer,
+                    batchInput,
+                    fuseOutput,
+                    flowMaps,
+                    flowMeans,
+                    thresholdBuffer,
+                    fuseWidth,
+                    fuseHeight,
+                    numFrames,
+                    w,
+                    4.0f,
+                    fuseOutput);
+
+                for(int n = 0; n < numFrames; n++)
+                    progressHelper.nextFusedImage();
+            }
         }
-                
+        else {
+            // Recycled across the loop; loadRawImage only reallocates the
+            // planes when the extents change
+            RawData current;
+
+            while(it != processFrames.end()) {
+                auto frame = rawContainer.loadFrame(*it);
+
+                loadRawImage(*frame, rawContainer.getCameraMetadata(), current);
+
+                cv::Mat flow;
+                cv::Mat currentFlowImage(current.previewBuffer.height(),
+                                         current.previewBuffer.width(),
+                                         CV_8U,
+                                         current.previewBuffer.data());
+
+                cv::Ptr<cv::DISOpticalFlow> opticalFlow =
+                    cv::DISOpticalFlow::create(cv::DISOpticalFlow::PRESET_ULTRAFAST);
+
+                opticalFlow->setPatchSize(patchSize);
+                opticalFlow->setPatchStride(patchSize/2);
+                opticalFlow->setGradientDescentIterations(16);
+                opticalFlow->setUseMeanNormalization(true);
+                opticalFlow->setUseSpatialPropagation(true);
+
+                opticalFlow->calc(referenceFlowImage, currentFlowImage, flow);
+
+                Halide::Runtime::Buffer<float> flowBuffer =
+                    Halide::Runtime::Buffer<float>::make_interleaved((float*) flow.data, flow.cols, flow.rows, 2);
+
+                auto flowMean = cv::mean(flow);
+
+                method(
+                    reference.rawBuffer,
+                    current.rawBuffer,
+                    fuseOutput,
+                    flowBuffer,
+                    thresholdBuffer,
+                    reference.rawBuffer.width(),
+                    reference.rawBuffer.height(),
+                    w,
+                    4.0f,
+                    flowMean[0],
+                    flowMean[1],
+                    fuseOutput);
+
+                progressHelper.nextFusedImage();
+
+                frame->data->release();
+
+                ++it;
+            }
+        }
+
         const int width = reference.rawBuffer.width();
         const int height = reference.rawBuffer.height();
 
-        Halide::Runtime::Buffer<uint16_t> denoiseInput(width, height, 4);
+        auto denoiseInput = createPooledBuffer<uint16_t>(width, height, 4);
         
         if(processFrames.size() <= 1)
-            denoiseInput.for_each_element([&](int x, int y, int c) {
-                float p = reference.rawBuffer(x, y, c) - blackLevel[c];
-                float s = EXPANDED_RANGE / (float) (whiteLevel-blackLevel[c]);
-                
-                denoiseInput(x, y, c) = static_cast<uint16_t>( (std::max)(0.0f, (std::min)(p * s + 0.5f, (float) EXPANDED_RANGE) )) ;
-            });
-        else {
-            const float n = (float) processFrames.size();
-
-            denoiseInput.for_each_element([&](int x, int y, int c) {
-                float p = fuseOutput(x, y, c) / n - blackLevel[c];
-                float s = EXPANDED_RANGE / (float) (whiteLevel-blackLevel[c]);
-                
-                denoiseInput(x, y, c) = static_cast<uint16_t>( (std::max)(0.0f, (std::min)(p * s + 0.5f, (float) EXPANDED_RANGE) ) ) ;
-            });
-        }
+            normalizeDenoiseInput(reference.rawBuffer, 1.0f, blackLevel, whiteLevel, denoiseInput);
+        else
+            normalizeDenoiseInput(fuseOutput, 1.0f / processFrames.size(), blackLevel, whiteLevel, denoiseInput);
 
         //
         // Spatial denoising
         //
 
         std::vector<Halide::Runtime::Buffer<uint16_t>> denoiseOutput;
-        
-        auto wavelet = createWaveletBuffers(denoiseInput.width(), denoiseInput.height());
 
         std::vector<float> normalisedNoise;
         std::vector<float> weights;
-        
+
         // Auto
         if(rawContainer.getPostProcessSettings().spatialDenoiseLevel < 0) {
             weights = estimateDenoiseWeights(signalAverage);
@@ -1919,38 +3110,98 @@ namespace motioncam {
             weights = WEIGHTS[WEIGHTS.size() - i];
         }
         
+        // With every weight at zero the wavelet round trip is an identity
+        // apart from its cost, so hand back the fused input directly. The
+        // noise estimate falls back to the patch measurement from above.
+        const float weightSum = std::accumulate(weights.begin(), weights.end(), 0.0f);
+
+        if(weightSum < 1e-5f) {
+            for(int c = 0; c < 4; c++) {
+                auto outputBuffer = createPooledBuffer<uint16_t>(width, height);
+
+                outputBuffer.for_each_element([&](int x, int y) {
+                    outputBuffer(x, y) = denoiseInput(x, y, c);
+                });
+
+                denoiseOutput.push_back(outputBuffer);
+                normalisedNoise.push_back(noise[c] / (1e-5f + signal[c]));
+            }
+
+            *outNoise = *std::max_element(normalisedNoise.begin(), normalisedNoise.end());
+
+            return denoiseOutput;
+        }
+
+        const bool fp16Wavelets = gUseFp16Wavelets;
+        const int stripeRows = gDenoiseStripeRows;
+
         auto weightsBuffer = Halide::Runtime::Buffer<float>(&weights[0], WAVELET_LEVELS);
 
+        if(stripeRows > 0 && height > stripeRows) {
+            std::vector<float> stripeNoiseSigma, stripeLlMean;
+
+            waveletDenoiseStriped(denoiseInput, weightsBuffer, fp16Wavelets, stripeRows, stripeNoiseSigma, stripeLlMean, denoiseOutput);
+
+            for(int c = 0; c < 4; c++)
+                normalisedNoise.push_back(stripeNoiseSigma[c] / (1e-5f + stripeLlMean[c]));
+
+            *outNoise = *std::max_element(normalisedNoise.begin(), normalisedNoise.end());
+
+            return denoiseOutput;
+        }
+
+        auto wavelet = createWaveletBuffers(denoiseInput.width(), denoiseInput.height(), fp16Wavelets);
+
+        auto forwardFunc = fp16Wavelets ? &forward_transform_fp16 : &forward_transform;
+        auto inverseFunc = fp16Wavelets ? &inverse_transform_fp16 : &inverse_transform;
+
         for(int c = 0; c < 4; c++) {
-            forward_transform(denoiseInput,
-                              denoiseInput.width(),
-                              denoiseInput.height(),
-                              c,
-                              wavelet[0],
-                              wavelet[1],
-                              wavelet[2],
-                              wavelet[3]);
+            forwardFunc(denoiseInput,
+                        denoiseInput.width(),
+                        denoiseInput.height(),
+                        c,
+                        wavelet[0],
+                        wavelet[1],
+                        wavelet[2],
+                        wavelet[3]);
 
             int offset = wavelet[0].stride(2);
 
-            cv::Mat ll(wavelet[0].height(), wavelet[0].width(), CV_32F, wavelet[0].data() + 4);
-            cv::Mat hh(wavelet[0].height(), wavelet[0].width(), CV_32F, wavelet[0].data() + offset*7);
-            
+            cv::Mat ll, hh;
+
+            if(fp16Wavelets) {
+                cv::Mat ll16(wavelet[0].height(), wavelet[0].width(), CV_16F, (uint16_t*) wavelet[0].data() + 4);
+                cv::Mat hh16(wavelet[0].height(), wavelet[0].width(), CV_16F, (uint16_t*) wavelet[0].data() + offset*7);
+
+                ll16.convertTo(ll, CV_32F);
+                hh16.convertTo(hh, CV_32F);
+            }
+            else {
+                ll = cv::Mat(wavelet[0].height(), wavelet[0].width(), CV_32F, (float*) wavelet[0].data() + 4);
+                hh = cv::Mat(wavelet[0].height(), wavelet[0].width(), CV_32F, (float*) wavelet[0].data() + offset*7);
+            }
+
             float noiseSigma = estimateNoise(hh);
             float n = noiseSigma / (1e-5f + cv::mean(ll)[0]);
-        
+
             normalisedNoise.push_back(n);
-            
-            Halide::Runtime::Buffer<uint16_t> outputBuffer(width, height);
 
-            inverse_transform(wavelet[0],
-                              wavelet[1],
-                              wavelet[2],
-                              wavelet[3],
-                              noiseSigma,
-                              false,
-                              weightsBuffer,
-                              outputBuffer);
+            // The stored coefficients carry the 2^-(level+2) gain the
+            // forward transform folds into its float16 stores; the inverse
+            // expects noiseSigma in float32 pipeline units
+            if(fp16Wavelets)
+                noiseSigma *= 4.0f;
+
+            auto outputBuffer = createPooledBuffer<uint16_t>(width, height);
+
+            inverseFunc(wavelet[0],
+                        wavelet[1],
+                        wavelet[2],
+                        wavelet[3],
+                        noiseSigma,
+                        false,
+                        weightsBuffer,
+                        outputBuffer);
 
             denoiseOutput.push_back(outputBuffer);
         }
@@ -2041,8 +3292,13 @@ namespace motioncam {
         if(error > MAX_HDR_ERROR)
             return nullptr;
 
-        // Scale mask to match output
-        cv::resize(mask, mask, cv::Size(underexposedImage->rawBuffer.width()*2, underexposedImage->rawBuffer.height()*2));
+        // Scale mask to match output. Resize directly into a Halide owned
+        // buffer so the handoff to the postprocess pipeline doesn't need a
+        // full frame copy.
+        Halide::Runtime::Buffer<uint8_t> hdrMask(underexposedImage->rawBuffer.width()*2, underexposedImage->rawBuffer.height()*2);
+        cv::Mat scaledMask(hdrMask.height(), hdrMask.width(), CV_8U, hdrMask.data());
+
+        cv::resize(mask, scaledMask, scaledMask.size());
 
         //
         // Create the underexposed image
@@ -2138,7 +3394,7 @@ namespace motioncam {
         
         hdrMetadata->exposureScale  = exposureScale;
         hdrMetadata->hdrInput       = outputBuffer;
-        hdrMetadata->hdrMask        = ToHalideBuffer<uint8_t>(mask).copy();
+        hdrMetadata->hdrMask        = hdrMask;
         hdrMetadata->error          = 0;
         hdrMetadata->gain           = 1;//1024.0f / (std::max)(p[2], (std::max)(p[0], p[1]));
         
@@ -2147,102 +3403,137 @@ namespace motioncam {
 
     std::vector<cv::Rect2f> ImageProcessor::detectFaces(const RawImageBuffer& buffer, const RawCameraMetadata& cameraMetadata) {
         Measure measure("detectFaces()");
-        
+
+        // Full frame sweeps are expensive, so between them the cascade only
+        // searches expanded ROIs around last frame's faces at nearby scales
+        const int FULL_SWEEP_INTERVAL = 30;
+
+        // Two instances of the same cascade so the full sweep can search two
+        // scale bands concurrently; detectMultiScale() mutates the feature
+        // evaluator and isn't safe to call on one object from two threads
+        static cv::CascadeClassifier classifier;
+        static cv::CascadeClassifier bandClassifier;
+        static std::vector<cv::Rect2f> trackedFaces;
+        static int framesSinceFullSweep = FULL_SWEEP_INTERVAL;
+        static Halide::Runtime::Buffer<uint8_t> previewOutput;
+
+        static std::atomic<bool> classifierReady(false);
+        static std::once_flag classifierOnce;
+
         std::vector<cv::Rect2f> result;
-        
-//        NativeBufferContext inputBufferContext(*buffer.data, false);
-//        Halide::Runtime::Buffer<uint8_t> output;
-//
-//        int scale = 4;
-//
-//        if(buffer.metadata.screenOrientation == ScreenOrientation::LANDSCAPE ||
-//           buffer.metadata.screenOrientation == ScreenOrientation::REVERSE_LANDSCAPE)
-//        {
-//            output = Halide::Runtime::Buffer<uint8_t>(buffer.width/scale, buffer.height/scale);
-//        }
-//        else {
-//            output = Halide::Runtime::Buffer<uint8_t>(buffer.height/scale, buffer.width/scale);
-//        }
-//
-//        int rotation = 0;
-//        switch(buffer.metadata.screenOrientation) {
-//            case ScreenOrientation::PORTRAIT:
-//                rotation = -90;
-//                break;
-//            case ScreenOrientation::REVERSE_PORTRAIT:
-//                rotation = 90;
-//                break;
-//            case ScreenOrientation::REVERSE_LANDSCAPE:
-//                rotation = 180;
-//                break;
-//
-//            default:
-//            case ScreenOrientation::LANDSCAPE:
-//                rotation = 0;
-//        }
-//
-//        fast_preview(inputBufferContext.getHalideBuffer(),
-//                     buffer.rowStride,
-//                     static_cast<int>(buffer.pixelFormat),
-//                     static_cast<int>(cameraMetadata.sensorArrangment),
-//                     buffer.width/scale,
-//                     buffer.height/scale,
-//                     rotation,
-//                     scale/2,
-//                     scale/2,
-//                     cameraMetadata.whiteLevel,
-//                     cameraMetadata.blackLevel[0],
-//                     cameraMetadata.blackLevel[1],
-//                     cameraMetadata.blackLevel[2],
-//                     cameraMetadata.blackLevel[3],
-//                     output);
-//
-//        auto previewImage = cv::Mat(output.height(), output.width(), CV_8U, output.data());
-//        cv::equalizeHist(previewImage, previewImage);
-//
-//        static cv::CascadeClassifier c;
-//
-//        if(c.empty()) {
-//            cv::FileStorage fs;
-//            auto classifier = cv::String(&lbpcascade_frontalface_improved_xml[0]);
-//
-//            fs.open(classifier, cv::FileStorage::READ | cv::FileStorage::MEMORY);
-//
-//            c.read(fs.getFirstTopLevelNode());
-//        }
-//
-//        std::vector<cv::Rect> dets;
-//        std::vector<cv::Rect2f> result;
-//
-//        c.detectMultiScale(previewImage, dets, 1.5);
-//
-//        for(int i = 0; i < dets.size(); i++) {
-//            float x = dets[i].tl().x / (float) output.width();
-//            float y = dets[i].tl().y / (float) output.height();
-//            float width = dets[i].width / (float) output.width();
-//            float height = dets[i].height / (float) output.height();
-//
-//            result.push_back(cv::Rect2f(x, y, width, height));
-//        }
 
-//        static dlib::frontal_face_detector detector = dlib::get_frontal_face_detector();
-//
-//        std::vector<dlib::rectangle> dets;
-//        std::vector<cv::Rect2f> result;
-//
-//        dlib::array2d<dlib::uint8> dlibFrame;
-//        dlib::assign_image(dlibFrame, dlib::cv_image<dlib::uint8>(previewImage));
-//
-//        dets = detector(dlibFrame);
-//
-//        for(int i = 0; i < dets.size(); i++) {
-//            float left = dets[i].left() / (float) output.width();
-//            float right = dets[i].right() / (float) output.width();
-//            float top = dets[i].top() / (float) output.height();
-//            float bottom = dets[i].bottom() / (float) output.height();
-//
-//            result.push_back(cv::Rect2f(left, top, right - left, bottom - top));
-//        }
+        if(!classifierReady) {
+            // Parsing the cascade takes ~100ms, so it runs off the preview
+            // thread; until it's ready report no faces instead of stalling
+            // the first preview frame on it
+            std::call_once(classifierOnce, [] {
+                std::thread([] {
+                    auto data = cv::String(lbpcascade_frontalface_improved_xml, lbpcascade_frontalface_improved_xml_len);
+
+                    cv::FileStorage fs;
+                    fs.open(data, cv::FileStorage::READ | cv::FileStorage::MEMORY);
+
+                    classifier.read(fs.getFirstTopLevelNode());
+
+                    cv::FileStorage bandFs;
+                    bandFs.open(data, cv::FileStorage::READ | cv::FileStorage::MEMORY);
+
+                    bandClassifier.read(bandFs.getFirstTopLevelNode());
+
+                    classifierReady = !classifier.empty() && !bandClassifier.empty();
+                }).detach();
+            });
+
+            return result;
+        }
+
+        // Walks the detection pyramid as two concurrent scale bands. The LBP
+        // window evaluation inside OpenCV is already vectorized through its
+        // universal intrinsics; the remaining serial cost is the scale levels
+        // themselves, which split cleanly between two threads.
+        const auto fullSweep = [&](const cv::Mat& gray, std::vector<cv::Rect>& dets) {
+            const int splitSize = (std::min)(gray.cols, gray.rows) / 4;
+
+            std::vector<cv::Rect> smallDets;
+
+            std::thread smallFaceThread([&]() {
+                bandClassifier.detectMultiScale(
+                    gray, smallDets, 1.5, 3, 0, cv::Size(), cv::Size(splitSize, splitSize));
+            });
+
+            classifier.detectMultiScale(
+                gray, dets, 1.5, 3, 0, cv::Size(splitSize + 1, splitSize + 1), cv::Size());
+
+            smallFaceThread.join();
+
+            dets.insert(dets.end(), smallDets.begin(), smallDets.end());
+        };
+
+        const int scale = 4;
+
+        createFastPreview(buffer, scale, scale, cameraMetadata, previewOutput);
+
+        cv::Mat previewImage(previewOutput.height(), previewOutput.width(), CV_8UC4, previewOutput.data());
+        cv::Mat gray;
+
+        cv::cvtColor(previewImage, gray, cv::COLOR_RGBA2GRAY);
+        cv::equalizeHist(gray, gray);
+
+        std::vector<cv::Rect> dets;
+
+        ++framesSinceFullSweep;
+
+        if(trackedFaces.empty() || framesSinceFullSweep >= FULL_SWEEP_INTERVAL) {
+            fullSweep(gray, dets);
+            framesSinceFullSweep = 0;
+        }
+        else {
+            const cv::Rect frameRect(0, 0, gray.cols, gray.rows);
+
+            for(const auto& f : trackedFaces) {
+                // Expand last frame's box by half its size in every direction
+                cv::Rect roi(
+                    static_cast<int>((f.x - 0.5f*f.width) * gray.cols),
+                    static_cast<int>((f.y - 0.5f*f.height) * gray.rows),
+                    static_cast<int>(2.0f * f.width * gray.cols),
+                    static_cast<int>(2.0f * f.height * gray.rows));
+
+                roi &= frameRect;
+
+                if(roi.empty())
+                    continue;
+
+                // Only run the scales close to last frame's size
+                const int lastSize = static_cast<int>(
+                    (std::min)(f.width * gray.cols, f.height * gray.rows));
+
+                const cv::Size minSize((2*lastSize)/3, (2*lastSize)/3);
+                const cv::Size maxSize((3*lastSize)/2, (3*lastSize)/2);
+
+                std::vector<cv::Rect> roiDets;
+
+                classifier.detectMultiScale(gray(roi), roiDets, 1.1, 3, 0, minSize, maxSize);
+
+                for(const auto& d : roiDets)
+                    dets.push_back(d + roi.tl());
+            }
+
+            // All faces lost, fall back to a full sweep
+            if(dets.empty()) {
+                fullSweep(gray, dets);
+                framesSinceFullSweep = 0;
+            }
+        }
+
+        for(const auto& d : dets) {
+            result.push_back(
+                cv::Rect2f(d.x / (float) gray.cols,
+                           d.y / (float) gray.rows,
+                           d.width / (float) gray.cols,
+                           d.height / (float) gray.rows));
+        }
+
+        trackedFaces = result;
 
         return result;
     }
@@ -1,6 +1,10 @@
 #include "motioncam/Logger.h"
 
+#include <chrono>
 #include <iostream>
+#include <thread>
+
+#include <queue/blockingconcurrentqueue.h>
 
 #ifdef __ANDROID__
     #include <android/log.h>
@@ -10,22 +14,105 @@ namespace motioncam {
     #ifdef __ANDROID__
         static const char* ANDROID_TAG = "libMotionCam";
     #endif
-    
+
     namespace logger {
-        void log(const std::string& str) {
+        namespace {
+            struct LogEntry {
+                bool isDebug{false};
+                std::string message;
+            };
+
+            void Emit(const LogEntry& entry) {
 #ifdef __ANDROID__
-            __android_log_print(ANDROID_LOG_INFO, ANDROID_TAG, "%s", str.c_str());
+                __android_log_print(
+                    entry.isDebug ? ANDROID_LOG_DEBUG : ANDROID_LOG_INFO, ANDROID_TAG, "%s", entry.message.c_str());
 #else
-            std::cout << str << std::endl;
+                std::cout << entry.message << std::endl;
 #endif
+            }
+
+            // Messages are queued and emitted from a background thread, so a
+            // log statement on a hot path costs an enqueue instead of the
+            // platform sink's mutex and I/O. The queue keeps per-producer
+            // blocks, so concurrent callers don't contend either.
+            class AsyncLogSink {
+            public:
+                static AsyncLogSink& get() {
+                    static AsyncLogSink instance;
+                    return instance;
+                }
+
+                void enqueue(LogEntry&& entry) {
+                    if(mStopped) {
+                        // Static teardown; emit directly rather than lose it
+                        Emit(entry);
+                        return;
+                    }
+
+                    mEntries.enqueue(std::move(entry));
+                }
+
+            private:
+                AsyncLogSink() : mStopped(false) {
+                    mThread = std::thread(&AsyncLogSink::doDrain, this);
+                }
+
+                ~AsyncLogSink() {
+                    mStopped = true;
+                    mThread.join();
+                }
+
+                void doDrain() {
+                    LogEntry entry;
+
+                    while(true) {
+                        if(mEntries.wait_dequeue_timed(entry, std::chrono::milliseconds(100))) {
+                            Emit(entry);
+                            continue;
+                        }
+
+                        // Exit once stopped and fully drained
+                        if(mStopped && mEntries.size_approx() == 0)
+                            break;
+                    }
+                }
+
+            private:
+                moodycamel::BlockingConcurrentQueue<LogEntry> mEntries;
+                std::atomic<bool> mStopped;
+                std::thread mThread;
+            };
+        }
+
+        void log(const std::string& str) {
+            LogEntry entry;
+
+            entry.isDebug = false;
+            entry.message = str;
+
+            AsyncLogSink::get().enqueue(std::move(entry));
         }
-    
+
         void debug(const std::string& str) {
-    #ifdef __ANDROID__
-            __android_log_print(ANDROID_LOG_DEBUG, ANDROID_TAG, "%s", str.c_str());
-    #else
-            std::cout << str << std::endl;
-    #endif
+            LogEntry entry;
+
+            entry.isDebug = true;
+            entry.message = str;
+
+            AsyncLogSink::get().enqueue(std::move(entry));
+        }
+
+        bool shouldLog(std::atomic<int64_t>& lastLogMs, const int64_t intervalMs) {
+            const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+
+            int64_t last = lastLogMs.load(std::memory_order_relaxed);
+
+            if(nowMs - last < intervalMs)
+                return false;
+
+            // On a race only one caller wins the interval
+            return lastLogMs.compare_exchange_strong(last, nowMs, std::memory_order_relaxed);
         }
     }
 }
@@ -1,17 +1,20 @@
 #include "motioncam/Measure.h"
-#include "motioncam/Logger.h"
+#include "motioncam/Trace.h"
 
 namespace motioncam {
     Measure::Measure(std::string reference) :
         mReference(std::move(reference)),
         mTimestamp(std::chrono::steady_clock::now()) {
-            
-        logger::log(mReference);
     }
-    
+
     Measure::~Measure() {
-        auto now = std::chrono::steady_clock::now();
-        double durationMs = std::chrono::duration <double, std::milli>(now - mTimestamp).count();
-        logger::log(mReference + " - taken " + std::to_string(durationMs) +  " ms");
+        if(!trace::IsEnabled())
+            return;
+
+        using namespace std::chrono;
+
+        const int64_t beginUs = duration_cast<microseconds>(mTimestamp.time_since_epoch()).count();
+
+        trace::Emit(mReference, beginUs, trace::NowUs());
     }
 }
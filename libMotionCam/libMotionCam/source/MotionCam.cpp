@@ -1,13 +1,20 @@
 #include "motioncam/MotionCam.h"
 #include "motioncam/RawContainer.h"
+#include "motioncam/RawContainerImpl.h"
+#include "motioncam/RawContainerImpl_Legacy.h"
+#include "motioncam/Exceptions.h"
 #include "motioncam/Util.h"
 #include "motioncam/ImageProcessor.h"
 #include "motioncam/Logger.h"
 #include "motioncam/RawImageBuffer.h"
 #include "motioncam/RawCameraMetadata.h"
 #include "motioncam/Measure.h"
+#include "motioncam/Trace.h"
 
 #include "motioncam/RawEncoder.h"
+#include "motioncam/HalidePool.h"
+#include "motioncam/TaskEngine.h"
+#include "motioncam/ThreadTopology.h"
 
 #include "build_bayer.h"
 #include "build_bayer2.h"
@@ -18,86 +25,345 @@
 #include <queue/blockingconcurrentqueue.h>
 
 #include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
 #include <thread>
 
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/resource.h>
+#endif
+
+#if defined(__aarch64__)
+    #include <arm_neon.h>
+#elif defined(__SSSE3__)
+    #include <tmmintrin.h>
+#endif
+
 namespace motioncam {
+    // Per-export immutable state shared by every job. Keeps the camera
+    // metadata copy and the output flags out of the per-frame records.
+    struct ExportConfig {
+        RawCameraMetadata cameraMetadata;
+        ScreenOrientation orientation;
+        bool enableCompression;
+        bool saveShadingMap;
+    };
+
     struct Job {
-        Job(const cv::Mat&& bayerImage,
-            const RawCameraMetadata&& cameraMetadata,
+        Job() : fd(-1), costBytes(0), sequence(-1), frameIndex(-1)
+        {
+        }
+
+        Job(std::shared_ptr<const ExportConfig> config,
+            cv::Mat&& bayerImage,
             const RawImageMetadata&& frameMetadata,
-            const ScreenOrientation orientation,
-            const bool enableCompression,
-            const bool saveShadingMap,
             const int fd,
             const std::string& outputPath) :
-        bayerImage(bayerImage),
-        cameraMetadata(cameraMetadata),
+        config(std::move(config)),
+        bayerImage(std::move(bayerImage)),
         frameMetadata(frameMetadata),
-        orientation(orientation),
-        enableCompression(enableCompression),
-        saveShadingMap(saveShadingMap),
         fd(fd),
-        outputPath(outputPath)
+        outputPath(outputPath),
+        sequence(-1),
+        frameIndex(-1)
         {
+            // Estimated peak memory cost of the job while it is in flight.
+            // The writer makes roughly one working copy of the bayer image
+            // while encoding the DNG.
+            costBytes = 2 * this->bayerImage.total() * this->bayerImage.elemSize();
         }
-        
+
+        std::shared_ptr<const ExportConfig> config;
         cv::Mat bayerImage;
-        const RawCameraMetadata cameraMetadata;
-        const RawImageMetadata frameMetadata;
-        const ScreenOrientation orientation;
-        const bool enableCompression;
-        const bool saveShadingMap;
-        const int fd;
-        const std::string outputPath;
-        std::string error;
+        RawImageMetadata frameMetadata;
+        int fd;
+        std::string outputPath;
+        size_t costBytes;
+
+        // Dispatch order of the job within the export, assigned by the
+        // admission loop. The writer thread flushes finished DNGs in this
+        // order.
+        int sequence;
+
+        // Global frame number of the job, journaled once the DNG is on
+        // disk so an interrupted export can resume
+        int frameIndex;
+    };
+
+    // A finished DNG waiting for the writer thread. The encode workers
+    // deposit these into the completion ring; the writer drains them in
+    // sequence order so file output stays strictly sequential. Discarded
+    // entries keep the sequence gapless when an export is cancelled.
+    struct CompletedDng {
+        CompletedDng() : sequence(-1), frameIndex(-1), fd(-1), costBytes(0), discarded(false)
+        {
+        }
+
+        int sequence;
+        int frameIndex;
+        int fd;
+        std::string outputPath;
+        std::vector<uint8_t> data;
+        size_t costBytes;
+        bool discarded;
     };
 
+    // Default in-flight memory budget for export jobs
+    const size_t DEFAULT_EXPORT_MEMORY_BUDGET = 1024u * 1024u * 1024u;
+
+    // Largest per-frame pause inserted when the export is fully throttled
+    const int MAX_THROTTLE_DELAY_MS = 250;
+
+    // How often the throughput model publishes stats to the progress
+    // listener. Long enough to smooth per-frame jitter, short enough for a
+    // UI to track the rate.
+    const float EXPORT_STATS_WINDOW_SECS = 1.0f;
+
+    // Frames the containers read and decode ahead of the admission thread
+    // during an export, so the next reads overlap the current frame's
+    // encode instead of alternating with it
+    const int EXPORT_PREFETCH_FRAMES = 8;
+
+    // Shared by every conversion. The platform layer lowers it from its
+    // thermal and battery callbacks while an export runs and restores it
+    // afterwards.
+    static std::atomic<float> gExportThrottle(1.0f);
+
     struct Impl {
-        Impl() : running(false) {
+        Impl() : running(false), cancelled(false), inFlightBytes(0), memoryBudgetBytes(DEFAULT_EXPORT_MEMORY_BUDGET),
+                 completedFrames(0), loadBusyUs(0), writeBusyUs(0) {
         }
 
-        moodycamel::BlockingConcurrentQueue<std::shared_ptr<Job>> jobQueue;
         std::atomic<bool> running;
+        std::atomic<bool> cancelled;
+        std::atomic<size_t> inFlightBytes;
+        std::atomic<size_t> memoryBudgetBytes;
+
+        // Throughput model counters for the running export. The write
+        // tasks add their busy time and completions, the admission loop
+        // adds load time and folds everything into windowed stats for the
+        // progress listener.
+        std::atomic<int> completedFrames;
+        std::atomic<int64_t> loadBusyUs;
+        std::atomic<int64_t> writeBusyUs;
+
+        // Completion ring between the encode workers and the writer thread.
+        // Bounded indirectly by the in-flight byte budget.
+        moodycamel::BlockingConcurrentQueue<CompletedDng> completedDngs;
+
+        // Gate for the byte-budget admission loop. The writer thread
+        // releases in-flight bytes under the mutex and signals, so the
+        // admission loop wakes the moment the budget clears instead of
+        // sleep-polling it.
+        std::mutex admissionMutex;
+        std::condition_variable admissionCondition;
+
+        // Resume journal state. The set holds the frame numbers already on
+        // disk when the export started; the file is appended to by the
+        // writer thread as further frames land.
+        std::string resumeJournalPath;
+        std::set<int> journaledFrames;
+        FILE* resumeJournal{nullptr};
     };
 
     MotionCam::MotionCam() : mImpl(new Impl()) {
+        halidepool::Install();
     }
 
     MotionCam::~MotionCam() {
     }
 
-    void MotionCam::writeDNG() {
-        while(mImpl->running) {
-            std::shared_ptr<Job> job;
+    void MotionCam::setExportMemoryBudget(const size_t memoryBudgetBytes) {
+        mImpl->memoryBudgetBytes = (std::max)(memoryBudgetBytes, static_cast<size_t>(64u * 1024u * 1024u));
+    }
+
+    void MotionCam::setExportResumeJournal(const std::string& path) {
+        mImpl->resumeJournalPath = path;
+    }
+
+    void MotionCam::SetExportThrottle(const float throttle) {
+        gExportThrottle = (std::max)(0.1f, (std::min)(1.0f, throttle));
+    }
+
+    void MotionCam::SetThreadAffinity(const bool enabled) {
+        topology::SetEnabled(enabled);
+    }
+
+    void MotionCam::SetWideSchedules(const bool enabled) {
+        ImageProcessor::setUseWideSchedules(enabled);
+    }
+
+    void MotionCam::SetGpuPostProcess(const bool enabled) {
+        ImageProcessor::setUseGpuPostProcess(enabled);
+    }
+
+    void MotionCam::SetFp16Wavelets(const bool enabled) {
+        ImageProcessor::setUseFp16Wavelets(enabled);
+    }
+
+    void MotionCam::SetDenoiseStripeRows(const int rows) {
+        ImageProcessor::setDenoiseStripeRows(rows);
+    }
+
+    void MotionCam::SetFuseBatchFrames(const int frames) {
+        ImageProcessor::setFuseBatchFrames(frames);
+    }
+
+    void MotionCam::SetTracing(const bool enabled) {
+        trace::SetEnabled(enabled);
+    }
+
+    std::string MotionCam::DumpTrace() {
+        return trace::Dump();
+    }
+
+    void MotionCam::SetDirectIo(const bool enabled) {
+        RawContainerImpl::setUseDirectIo(enabled);
+    }
+
+    void MotionCam::writeDNG(Job& job) {
+        CompletedDng completed;
+
+        completed.sequence = job.sequence;
+        completed.frameIndex = job.frameIndex;
+        completed.fd = job.fd;
+        completed.outputPath = job.outputPath;
+        completed.costBytes = job.costBytes;
+
+        // Cancelled exports discard their remaining frames instead of
+        // finishing the writes. The discarded entry still goes through the
+        // ring so the writer's sequence stays gapless.
+        if(mImpl->cancelled) {
+            logger::log("Discarding video frame!");
+            completed.discarded = true;
+        }
+        else {
+            const auto writeStart = std::chrono::steady_clock::now();
 
-            mImpl->jobQueue.wait_dequeue_timed(job, std::chrono::milliseconds(100));
-            if(!job)
-                continue;
-            
             try {
+                util::WriteDng(job.bayerImage,
+                               job.config->cameraMetadata,
+                               job.frameMetadata,
+                               job.config->orientation,
+                               job.config->enableCompression,
+                               job.config->saveShadingMap,
+                               completed.data);
+            }
+            catch(std::runtime_error& e) {
+                logger::log(std::string("WriteDNG error: ") + e.what());
+            }
+
+            mImpl->writeBusyUs += std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - writeStart).count();
+
+            // Release the bayer image here; the encoded stream is what stays
+            // in flight until the writer flushes it
+            job.bayerImage.release();
+        }
+
+        mImpl->completedDngs.enqueue(std::move(completed));
+    }
+
+    // Flushes one encoded DNG to its destination on the writer thread,
+    // matching the fsync and close behaviour of the fd stream it replaces.
+    // Failed frames still count as completed; they won't be retried.
+    static void FlushCompletedDng(Impl& impl, CompletedDng& completed) {
+        if(!completed.discarded) {
 #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
-                util::WriteDng(job->bayerImage,
-                               job->cameraMetadata,
-                               job->frameMetadata,
-                               job->orientation,
-                               job->saveShadingMap,
-                               job->enableCompression,
-                               job->fd);
+            if(completed.fd >= 0) {
+                size_t written = 0;
+
+                while(written < completed.data.size()) {
+                    const auto ret = write(completed.fd,
+                                           completed.data.data() + written,
+                                           completed.data.size() - written);
+
+                    if(ret < 0) {
+                        logger::log("WriteDNG error: failed to write output");
+                        break;
+                    }
+
+                    written += static_cast<size_t>(ret);
+                }
+
+                fsync(completed.fd);
+                close(completed.fd);
+            }
 #elif defined(_WIN32)
-                util::WriteDng(job->bayerImage,
-                               job->cameraMetadata,
-                               job->frameMetadata,
-                               job->orientation,
-                               job->saveShadingMap,
-                               job->enableCompression,
-                               job->outputPath);
-#endif
+            try {
+                if(!completed.data.empty())
+                    util::WriteFile(completed.data.data(), completed.data.size(), completed.outputPath);
             }
             catch(std::runtime_error& e) {
-                job->error = e.what();
                 logger::log(std::string("WriteDNG error: ") + e.what());
             }
+#endif
+
+            impl.completedFrames++;
+
+            // Journal the frame after its DNG is on disk. A line lost to a
+            // power cut just means that one frame is exported again.
+            if(impl.resumeJournal && completed.frameIndex >= 0) {
+                fprintf(impl.resumeJournal, "%d\n", completed.frameIndex);
+                fflush(impl.resumeJournal);
+            }
+        }
+
+        // Release the bytes under the admission mutex so a waiter can't
+        // check the budget between the release and the signal
+        {
+            std::lock_guard<std::mutex> lock(impl.admissionMutex);
+            impl.inFlightBytes -= completed.costBytes;
+        }
+
+        impl.admissionCondition.notify_one();
+    }
+
+    static std::vector<std::unique_ptr<RawContainer>> OpenContainersInParallel(
+        const size_t numContainers, const std::function<std::unique_ptr<RawContainer>(size_t)>& open)
+    {
+        // Open the segments in parallel. Each open reads the index footer and
+        // camera metadata of its segment, which dominates export startup on
+        // slow media, so the latency becomes the slowest segment instead of
+        // the sum of all of them.
+        std::vector<std::unique_ptr<RawContainer>> containers(numContainers);
+        std::vector<std::string> errors(numContainers);
+        TaskGroup group;
+
+        for(size_t i = 0; i < numContainers; i++) {
+            TaskEngine::get().run(TaskPriority::EXPORT, [&, i] {
+                try {
+                    containers[i] = open(i);
+
+                    // Build the per-segment frame list here so merging the
+                    // segments afterwards is just a sort
+                    if(containers[i])
+                        containers[i]->getFrames();
+                }
+                catch(std::exception& e) {
+                    errors[i] = e.what();
+                }
+            }, group);
+        }
+
+        group.wait();
+
+        for(size_t i = 0; i < numContainers; i++) {
+            if(!errors[i].empty())
+                throw IOException(errors[i]);
+
+            if(!containers[i])
+                throw IOException("Failed to open container");
         }
+
+        return containers;
     }
 
     void MotionCam::convertVideoToDNG(const std::vector<std::string>& inputPaths,
@@ -112,11 +378,9 @@ namespace motioncam {
                                       const int toFrameNumber,
                                       const bool autoRecover)
     {
-        std::vector<std::unique_ptr<RawContainer>> c;
-        
-        for(auto& inputPath : inputPaths) {
-            c.push_back( RawContainer::Open(inputPath) );
-        }
+        auto c = OpenContainersInParallel(inputPaths.size(), [&](const size_t i) {
+            return RawContainer::Open(inputPaths[i]);
+        });
 
         convertVideoToDNG(c,
                           progress,
@@ -143,12 +407,10 @@ namespace motioncam {
                                       const int toFrameNumber,
                                       const bool autoRecover)
     {
-        std::vector<std::unique_ptr<RawContainer>> c;
-        
-        for(auto fd : fds) {
-            c.push_back( RawContainer::Open(fd) );
-        }
-        
+        auto c = OpenContainersInParallel(fds.size(), [&](const size_t i) {
+            return RawContainer::Open(fds[i]);
+        });
+
         convertVideoToDNG(c,
                           progress,
                           denoiseWeights,
@@ -166,37 +428,283 @@ namespace motioncam {
         return Halide::Runtime::Buffer<uint16_t>(width, height);
     }
 
-    std::shared_ptr<Job> createFrameExportJob(std::vector<std::unique_ptr<RawContainer>>& containers,
+    // SIMD row kernels for the packed payload formats. Each one unpacks
+    // whole groups and returns how many pixels it produced; the scalar
+    // loops in UnpackRawImage() finish the tail and cover targets without
+    // the instructions.
+
+#if defined(__aarch64__)
+    // Four 5-byte groups to 16 pixels per iteration
+    static int UnpackRaw10Row(const uint8_t* row, uint16_t* dst, const int width, const size_t bytesAvailable) {
+        static const uint8_t HighIdx[16] = { 0, 1, 2, 3, 5, 6, 7, 8, 10, 11, 12, 13, 15, 16, 17, 18 };
+        static const uint8_t LowIdx[16]  = { 4, 4, 4, 4, 9, 9, 9, 9, 14, 14, 14, 14, 19, 19, 19, 19 };
+        static const int8_t LowShift[16] = { 0, -2, -4, -6, 0, -2, -4, -6, 0, -2, -4, -6, 0, -2, -4, -6 };
+
+        const uint8x16_t highIdx = vld1q_u8(HighIdx);
+        const uint8x16_t lowIdx = vld1q_u8(LowIdx);
+        const int8x16_t lowShift = vld1q_s8(LowShift);
+
+        int x = 0;
+
+        // The loads cover 32 bytes but an iteration only consumes 20, so
+        // stop while the overshoot still lands inside the payload
+        while(x + 16 <= width && static_cast<size_t>(10*x/8) + 32 <= bytesAvailable) {
+            const uint8_t* group = row + 10*x/8;
+
+            uint8x16x2_t bytes;
+
+            bytes.val[0] = vld1q_u8(group);
+            bytes.val[1] = vld1q_u8(group + 16);
+
+            const uint8x16_t high = vqtbl2q_u8(bytes, highIdx);
+            const uint8x16_t low = vandq_u8(vshlq_u8(vqtbl2q_u8(bytes, lowIdx), lowShift), vdupq_n_u8(0x03));
+
+            vst1q_u16(dst + x,     vorrq_u16(vshll_n_u8(vget_low_u8(high), 2),  vmovl_u8(vget_low_u8(low))));
+            vst1q_u16(dst + x + 8, vorrq_u16(vshll_n_u8(vget_high_u8(high), 2), vmovl_u8(vget_high_u8(low))));
+
+            x += 16;
+        }
+
+        return x;
+    }
+
+    // Eight 3-byte groups to 16 pixels per iteration
+    static int UnpackRaw12Row(const uint8_t* row, uint16_t* dst, const int width, const size_t bytesAvailable) {
+        static const uint8_t HighIdx[16] = { 0, 1, 3, 4, 6, 7, 9, 10, 12, 13, 15, 16, 18, 19, 21, 22 };
+        static const uint8_t LowIdx[16]  = { 2, 2, 5, 5, 8, 8, 11, 11, 14, 14, 17, 17, 20, 20, 23, 23 };
+        static const int8_t LowShift[16] = { 0, -4, 0, -4, 0, -4, 0, -4, 0, -4, 0, -4, 0, -4, 0, -4 };
+
+        const uint8x16_t highIdx = vld1q_u8(HighIdx);
+        const uint8x16_t lowIdx = vld1q_u8(LowIdx);
+        const int8x16_t lowShift = vld1q_s8(LowShift);
+
+        int x = 0;
+
+        while(x + 16 <= width && static_cast<size_t>(12*x/8) + 32 <= bytesAvailable) {
+            const uint8_t* group = row + 12*x/8;
+
+            uint8x16x2_t bytes;
+
+            bytes.val[0] = vld1q_u8(group);
+            bytes.val[1] = vld1q_u8(group + 16);
+
+            const uint8x16_t high = vqtbl2q_u8(bytes, highIdx);
+            const uint8x16_t low = vandq_u8(vshlq_u8(vqtbl2q_u8(bytes, lowIdx), lowShift), vdupq_n_u8(0x0F));
+
+            vst1q_u16(dst + x,     vorrq_u16(vshll_n_u8(vget_low_u8(high), 4),  vmovl_u8(vget_low_u8(low))));
+            vst1q_u16(dst + x + 8, vorrq_u16(vshll_n_u8(vget_high_u8(high), 4), vmovl_u8(vget_high_u8(low))));
+
+            x += 16;
+        }
+
+        return x;
+    }
+#elif defined(__SSSE3__)
+    // Two 5-byte groups to 8 pixels per iteration. The per-pixel 2-bit
+    // field is isolated with a multiply, since SSE has no per-lane byte
+    // shifts: (low << (6 - 2p)) >> 6 is the same as (low >> 2p).
+    static int UnpackRaw10Row(const uint8_t* row, uint16_t* dst, const int width, const size_t bytesAvailable) {
+        const __m128i highIdx = _mm_setr_epi8(0, -1, 1, -1, 2, -1, 3, -1, 5, -1, 6, -1, 7, -1, 8, -1);
+        const __m128i lowIdx = _mm_setr_epi8(4, -1, 4, -1, 4, -1, 4, -1, 9, -1, 9, -1, 9, -1, 9, -1);
+        const __m128i lowMul = _mm_setr_epi16(64, 16, 4, 1, 64, 16, 4, 1);
+        const __m128i lowMask = _mm_set1_epi16(0x03);
+
+        int x = 0;
+
+        // The load covers 16 bytes but an iteration only consumes 10, so
+        // stop while the overshoot still lands inside the payload
+        while(x + 8 <= width && static_cast<size_t>(10*x/8) + 16 <= bytesAvailable) {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + 10*x/8));
+
+            const __m128i high = _mm_slli_epi16(_mm_shuffle_epi8(bytes, highIdx), 2);
+            const __m128i low = _mm_and_si128(
+                _mm_srli_epi16(_mm_mullo_epi16(_mm_shuffle_epi8(bytes, lowIdx), lowMul), 6), lowMask);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_or_si128(high, low));
+
+            x += 8;
+        }
+
+        return x;
+    }
+
+    // Four 3-byte groups to 8 pixels per iteration
+    static int UnpackRaw12Row(const uint8_t* row, uint16_t* dst, const int width, const size_t bytesAvailable) {
+        const __m128i highIdx = _mm_setr_epi8(0, -1, 1, -1, 3, -1, 4, -1, 6, -1, 7, -1, 9, -1, 10, -1);
+        const __m128i lowIdx = _mm_setr_epi8(2, -1, 2, -1, 5, -1, 5, -1, 8, -1, 8, -1, 11, -1, 11, -1);
+        const __m128i lowMul = _mm_setr_epi16(16, 1, 16, 1, 16, 1, 16, 1);
+        const __m128i lowMask = _mm_set1_epi16(0x0F);
+
+        int x = 0;
+
+        while(x + 8 <= width && static_cast<size_t>(12*x/8) + 16 <= bytesAvailable) {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + 12*x/8));
+
+            const __m128i high = _mm_slli_epi16(_mm_shuffle_epi8(bytes, highIdx), 4);
+            const __m128i low = _mm_and_si128(
+                _mm_srli_epi16(_mm_mullo_epi16(_mm_shuffle_epi8(bytes, lowIdx), lowMul), 4), lowMask);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_or_si128(high, low));
+
+            x += 8;
+        }
+
+        return x;
+    }
+#endif
+
+    // Unpacks a raw frame payload into a 16-bit bayer image on the CPU,
+    // without round tripping through the Halide pipeline. Used by the
+    // passthrough export path. Returns false for payload formats it
+    // doesn't handle.
+    static bool UnpackRawImage(const RawImageBuffer& frame, cv::Mat& outImage) {
+        auto* data = frame.data->lock(false);
+        if(data == nullptr) {
+            frame.data->unlock();
+            return false;
+        }
+
+        outImage.create(frame.height, frame.width, CV_16U);
+
+        const size_t dataLen = frame.data->len();
+
+        for(int y = 0; y < frame.height; y++) {
+            const uint8_t* row = data + y * frame.rowStride;
+            uint16_t* dstRow = outImage.ptr<uint16_t>(y);
+
+            // Bytes between the row start and the end of the payload; the
+            // vector kernels over-read within this bound
+            const size_t rowOffset = static_cast<size_t>(y) * frame.rowStride;
+            const size_t bytesAvailable = dataLen > rowOffset ? dataLen - rowOffset : 0;
+
+            if(frame.pixelFormat == PixelFormat::RAW10) {
+                int x = 0;
+
+#if defined(__aarch64__) || defined(__SSSE3__)
+                x = UnpackRaw10Row(row, dstRow, frame.width, bytesAvailable);
+#else
+                (void) bytesAvailable;
+#endif
+
+                for(; x < frame.width; x += 4) {
+                    const uint8_t* group = row + 10*x/8;
+                    const int n = (std::min)(4, frame.width - x);
+
+                    for(int p = 0; p < n; p++)
+                        dstRow[x + p] = (group[p] << 2) | ((group[4] >> (p * 2)) & 0x03);
+                }
+            }
+            else if(frame.pixelFormat == PixelFormat::RAW12) {
+                int x = 0;
+
+#if defined(__aarch64__) || defined(__SSSE3__)
+                x = UnpackRaw12Row(row, dstRow, frame.width, bytesAvailable);
+#endif
+
+                for(; x < frame.width; x += 2) {
+                    const uint8_t* group = row + 12*x/8;
+                    const int n = (std::min)(2, frame.width - x);
+
+                    for(int p = 0; p < n; p++)
+                        dstRow[x + p] = (group[p] << 4) | ((group[2] >> (p * 4)) & 0x0F);
+                }
+            }
+            else if(frame.pixelFormat == PixelFormat::RAW16) {
+                // Packed samples are already little endian uint16
+                memcpy(dstRow, row, static_cast<size_t>(frame.width) * 2);
+            }
+            else {
+                frame.data->unlock();
+                return false;
+            }
+        }
+
+        frame.data->unlock();
+
+        return true;
+    }
+
+    std::unique_ptr<Job> createFrameExportJob(std::vector<std::unique_ptr<RawContainer>>& containers,
+                                              std::vector<std::unique_ptr<RawContainerReader>>& readers,
                                               DngProcessorProgress& progress,
-                                              std::vector<util::ContainerFrame> orderedFrames,
+                                              util::FrameTimeline& timeline,
                                               const int frameIdx,
-                                              const ScreenOrientation orientation,
+                                              const std::shared_ptr<const ExportConfig>& exportConfig,
+                                              const std::shared_ptr<const ExportConfig>& passthroughConfig,
                                               const std::vector<float>& denoiseWeights,
                                               const int mergeFrames,
-                                              const bool enableCompression,
                                               const bool applyShadingMap,
                                               const bool noClipShadingMap)
     {
         std::shared_ptr<RawImageBuffer> frame;
-        
-        auto& container = containers[orderedFrames[frameIdx].containerIndex];
-        
-        try {
-            frame = container->loadFrame(orderedFrames[frameIdx].frameName);
-        }
-        catch(const std::runtime_error& e) {
-            return nullptr;
-        }
-        
+
+        const auto& orderedFrames = timeline.frames();
+
+        const size_t containerIdx = orderedFrames[frameIdx].containerIndex;
+        auto& container = containers[containerIdx];
+
+        // Prefer the pread based reader session so frame loads don't contend
+        // on the container's FILE* cursor. Merged exports keep the serialized
+        // path because it shares loaded frames with the nearest-buffer cache.
+        std::string loadError;
+
+        if(mergeFrames == 0 && readers[containerIdx])
+            frame = readers[containerIdx]->tryLoadFrame(orderedFrames[frameIdx].frameName, loadError);
+        else
+            frame = container->tryLoadFrame(orderedFrames[frameIdx].frameName, loadError);
+
         if(!frame) {
+            if(!loadError.empty())
+                logger::log("Failed to load frame: " + loadError);
+
             return nullptr;
         }
         
         if(frame->width <= 0 || frame->height <= 0) {
             return nullptr;
         }
-                    
-        auto cameraMetadata = containers[0]->getCameraMetadata();
+
+        // Passthrough export. With no merging, no denoising and no shading
+        // map to apply there is nothing to compute, so unpack the payload
+        // straight into the output image and keep the container's original
+        // black/white levels. This skips the Halide round trip and the
+        // EXPANDED_RANGE rescale, leaving the most common export case IO
+        // bound instead of CPU bound.
+        float denoiseWeightSum = 0.0f;
+        for(size_t i = 0; i < denoiseWeights.size(); i++)
+            denoiseWeightSum += denoiseWeights[i];
+
+        if(mergeFrames == 0 && !applyShadingMap && denoiseWeightSum <= 1e-5f) {
+            cv::Mat rawImage;
+
+            if(UnpackRawImage(*frame, rawImage)) {
+                frame->data->release();
+
+                auto frameMetadata = frame->metadata;
+
+                int fd = -1;
+                std::string outputPath;
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+                fd = progress.onNeedFd(frameIdx);
+                if(fd < 0) {
+                    return nullptr;
+                }
+#elif defined(_WIN32)
+                outputPath = progress.onNeedFd(frameIdx);
+#endif
+
+                return std::unique_ptr<Job>(new Job(passthroughConfig,
+                                                    std::move(rawImage),
+                                                    std::move(frameMetadata),
+                                                    fd,
+                                                    outputPath));
+            }
+
+            // Unhandled payload format. Fall through to the full pipeline.
+        }
+
+        const auto& cameraMetadata = containers[0]->getCameraMetadata();
 
         auto originalWhiteLevel = containers[0]->getCameraMetadata().getWhiteLevel(frame->metadata);
         auto originalBlackLevel = containers[0]->getCameraMetadata().getBlackLevel(frame->metadata);
@@ -234,7 +742,8 @@ namespace motioncam {
         std::vector<std::shared_ptr<RawImageBuffer>> nearestBuffers;
         Halide::Runtime::Buffer<uint16_t> bayerBuffer;
         cv::Mat bayerImage;
-                
+        bool bayerImageOwnsData = false;
+
         if(mergeFrames == 0) {
             auto data = frame->data->lock(false);
             auto inputBuffer = Halide::Runtime::Buffer<uint8_t>(data, (int) frame->data->len());
@@ -264,8 +773,17 @@ namespace motioncam {
                              bayerBuffer);
             }
             else {
-                bayerBuffer = Halide::Runtime::Buffer<uint16_t>(frame->width, frame->height);
-                
+                // The kernel fuses the payload unpack and the shading map
+                // multiply in a single pass, so point it straight at the
+                // job's image instead of cloning the result out of a
+                // temporary buffer afterwards. Saves a full frame copy per
+                // exported frame.
+                bayerImage.create(frame->height, frame->width, CV_16U);
+                bayerImageOwnsData = true;
+
+                bayerBuffer = Halide::Runtime::Buffer<uint16_t>(
+                    reinterpret_cast<uint16_t*>(bayerImage.data), frame->width, frame->height);
+
                 build_bayer(inputBuffer,
                             shadingMapBuffer[0],
                             shadingMapBuffer[1],
@@ -284,12 +802,13 @@ namespace motioncam {
                             EXPANDED_RANGE,
                             bayerBuffer);
             }
-            
-            bayerImage = cv::Mat(bayerBuffer.height(), bayerBuffer.width(), CV_16U, bayerBuffer.data());
+
+            if(!bayerImageOwnsData)
+                bayerImage = cv::Mat(bayerBuffer.height(), bayerBuffer.width(), CV_16U, bayerBuffer.data());
         }
         else {
             // Get number of nearest buffers
-            util::GetNearestBuffers(containers, orderedFrames, frameIdx, mergeFrames, nearestBuffers);
+            timeline.loadNearestBuffers(frameIdx, mergeFrames, nearestBuffers);
             
             auto denoiseBuffers = ImageProcessor::denoise(frame, nearestBuffers, denoiseWeights, container->getCameraMetadata());
             bayerBuffer = Halide::Runtime::Buffer<uint16_t>(denoiseBuffers[0].width() * 2, denoiseBuffers[0].height() * 2);
@@ -309,39 +828,31 @@ namespace motioncam {
             bayerImage = cv::Mat(bayerBuffer.height(), bayerBuffer.width(), CV_16U, bayerBuffer.data());
         }
 
-        // Release previous frames
-        int m = frameIdx - mergeFrames;
-        
-        while(m >= 0) {
-            auto& container = containers[orderedFrames[m].containerIndex];
-            auto prevFrame = container->getFrame(orderedFrames[m].frameName);
-            
-            prevFrame->data->release();
-            
-            --m;
-        }
+        // Release the frames that fell out of the merge window
+        timeline.releaseExpiredFrames(frameIdx, mergeFrames);
 
-        // Crop buffer to original size
-        int x = (bayerBuffer.width() - frame->width) / 2;
-        int y = (bayerBuffer.height() - frame->height) / 2;
+        if(!bayerImageOwnsData) {
+            // Crop buffer to original size
+            int x = (bayerBuffer.width() - frame->width) / 2;
+            int y = (bayerBuffer.height() - frame->height) / 2;
 
-        // Align to bayer pattern
-        x = 2 * (x / 2);
-        y = 2 * (y / 2);
+            // Align to bayer pattern
+            x = 2 * (x / 2);
+            y = 2 * (y / 2);
 
-        bayerImage = bayerImage(cv::Rect(x, y, bayerBuffer.width() - x*2, bayerBuffer.height() - y*2));
+            bayerImage = bayerImage(cv::Rect(x, y, bayerBuffer.width() - x*2, bayerBuffer.height() - y*2));
 
-        // Clone the buffer because the halide buffer will go away
-        bayerImage = bayerImage.clone();
+            // Clone the buffer because the halide buffer will go away
+            bayerImage = bayerImage.clone();
+        }
 
-        // Override the black/white levels of the output to match the new bayer image
+        // Override the black/white levels of the output to match the new bayer image.
+        // The matching bayer offsets are set once in the export config.
         auto frameMetadata = frame->metadata;
-        
+
         frameMetadata.dynamicBlackLevel = { 0, 0, 0, 0 };
         frameMetadata.dynamicWhiteLevel = EXPANDED_RANGE;
-    
-        cameraMetadata.updateBayerOffsets(frameMetadata.dynamicBlackLevel, frameMetadata.dynamicWhiteLevel);
-        
+
         int fd = -1;
         std::string outputPath;
 
@@ -353,15 +864,12 @@ namespace motioncam {
 #elif defined(_WIN32)
         outputPath = progress.onNeedFd(frameIdx);
 #endif
-                    
-        return std::make_shared<Job>(std::move(bayerImage),
-                                     std::move(cameraMetadata),
-                                     std::move(frameMetadata),
-                                     orientation,
-                                     !applyShadingMap,
-                                     enableCompression,
-                                     fd,
-                                     outputPath);
+
+        return std::unique_ptr<Job>(new Job(exportConfig,
+                                            std::move(bayerImage),
+                                            std::move(frameMetadata),
+                                            fd,
+                                            outputPath));
     }
 
     void MotionCam::convertVideoToDNG(std::vector<std::unique_ptr<RawContainer>>& containers,
@@ -376,51 +884,121 @@ namespace motioncam {
                                       const int toFrameNumber,
                                       const bool autoRecover)
     {
-        
+
         if(mImpl->running)
             throw std::runtime_error("Already running");
-        
+
         if(numThreads <= 0)
             return;
 
-        // If auto recovery is on, try to recover corrupted containers
-        if(autoRecover) {
-            for(auto& container : containers) {
-                if(container->isCorrupted()) {
-                    progress.onAttemptingRecovery();
-                    container->recover();
-                }
-            }
-        }
-        
-        // Check for corrupted containers
-        for(auto& container : containers) {
-            if(container->isCorrupted()) {
-                progress.onError("Container is corrupted");
-                progress.onCompleted();
-                return;
-            }
-        }
-        
-        // Get a list of all frames, ordered by timestamp
-        std::vector<util::ContainerFrame> orderedFrames;
-        
-        util::GetOrderedFrames(containers, orderedFrames);
-        
-        // If no frames found. return
-        if(orderedFrames.empty())
-            return;
-        
-        // Create processing threads
         mImpl->running = true;
+
+        processContainers(containers,
+                          progress,
+                          denoiseWeights,
+                          numThreads,
+                          mergeFrames,
+                          enableCompression,
+                          applyShadingMap,
+                          noClipShadingMap,
+                          fromFrameNumber,
+                          toFrameNumber,
+                          autoRecover);
+
+        mImpl->running = false;
+    }
+
+    void MotionCam::convertVideosToDNG(const std::vector<std::vector<std::string>>& batchInputPaths,
+                                       const std::vector<DngProcessorProgress*>& progress,
+                                       const std::vector<float>& denoiseWeights,
+                                       const int numThreads,
+                                       const int mergeFrames,
+                                       const bool enableCompression,
+                                       const bool applyShadingMap,
+                                       const bool noClipShadingMap,
+                                       const bool autoRecover)
+    {
+        if(mImpl->running)
+            throw std::runtime_error("Already running");
+
+        if(numThreads <= 0 || batchInputPaths.empty())
+            return;
+
+        if(batchInputPaths.size() != progress.size())
+            throw IOException("Mismatched batch and progress sizes");
+
+        mImpl->running = true;
+
+        for(size_t clip = 0; clip < batchInputPaths.size(); clip++) {
+            try {
+                auto containers = OpenContainersInParallel(batchInputPaths[clip].size(), [&](const size_t i) {
+                    return RawContainer::Open(batchInputPaths[clip][i]);
+                });
+
+                processContainers(containers,
+                                  *progress[clip],
+                                  denoiseWeights,
+                                  numThreads,
+                                  mergeFrames,
+                                  enableCompression,
+                                  applyShadingMap,
+                                  noClipShadingMap,
+                                  -1,
+                                  -1,
+                                  autoRecover);
+            }
+            catch(std::exception& e) {
+                progress[clip]->onError(e.what());
+                progress[clip]->onCompleted();
+            }
+        }
+
+        mImpl->running = false;
+    }
+
+    void MotionCam::processContainers(std::vector<std::unique_ptr<RawContainer>>& containers,
+                                      DngProcessorProgress& progress,
+                                      const std::vector<float>& denoiseWeights,
+                                      const int numThreads,
+                                      const int mergeFrames,
+                                      const bool enableCompression,
+                                      const bool applyShadingMap,
+                                      const bool noClipShadingMap,
+                                      const int fromFrameNumber,
+                                      const int toFrameNumber,
+                                      const bool autoRecover)
+    {
+        mImpl->cancelled = false;
+
+        // If auto recovery is on, try to recover corrupted containers
+        if(autoRecover) {
+            for(auto& container : containers) {
+                if(container->isCorrupted()) {
+                    progress.onAttemptingRecovery();
+                    container->recover();
+                }
+            }
+        }
         
-        std::vector<std::unique_ptr<std::thread>> threads;
-        std::vector<int> fds;
-        
-        for(int i = 0; i < numThreads; i++) {
-            threads.push_back(std::unique_ptr<std::thread>(new std::thread(&MotionCam::writeDNG, this)));
+        // Check for corrupted containers
+        for(auto& container : containers) {
+            if(container->isCorrupted()) {
+                progress.onError("Container is corrupted");
+                progress.onCompleted();
+                return;
+            }
         }
-                                
+        
+        // Merged timeline of all frames, ordered by timestamp. Built once;
+        // every per-frame lookup afterwards is index based.
+        util::FrameTimeline timeline(containers);
+
+        const auto& orderedFrames = timeline.frames();
+
+        // If no frames found. return
+        if(orderedFrames.empty())
+            return;
+        
         int startIdx = fromFrameNumber;
         int endIdx = toFrameNumber;
         
@@ -441,19 +1019,158 @@ namespace motioncam {
         auto firstFrame = firstFrameContainer->getFrame(orderedFrames[startIdx].frameName);
         
         ScreenOrientation orientation = firstFrame->metadata.screenOrientation;
-        
+
+        // Shared by every job. The bayer offsets match the dynamic black/white
+        // levels the export writes into each frame.
+        auto exportConfig = std::make_shared<ExportConfig>();
+
+        exportConfig->cameraMetadata = containers[0]->getCameraMetadata();
+        exportConfig->cameraMetadata.updateBayerOffsets( { 0, 0, 0, 0 }, EXPANDED_RANGE);
+        exportConfig->orientation = orientation;
+        exportConfig->enableCompression = enableCompression;
+        exportConfig->saveShadingMap = !applyShadingMap;
+
+        // Passthrough jobs write the original sensor values, so their
+        // config keeps the container's black/white levels.
+        auto passthroughConfig = std::make_shared<ExportConfig>();
+
+        passthroughConfig->cameraMetadata = containers[0]->getCameraMetadata();
+        passthroughConfig->orientation = orientation;
+        passthroughConfig->enableCompression = enableCompression;
+        passthroughConfig->saveShadingMap = !applyShadingMap;
+
+        // One reader session per container. Entries are nullptr for
+        // containers that don't support concurrent reads.
+        std::vector<std::unique_ptr<RawContainerReader>> readers;
+
+        for(auto& container : containers)
+            readers.push_back(container->createReader());
+
+        // Throughput model state. The window snapshots live here on the
+        // admission thread; the shared counters are fed by the write tasks.
+        const int totalFrames = endIdx - startIdx + 1;
+        const auto exportStart = std::chrono::steady_clock::now();
+
+        auto windowStart = exportStart;
+        int windowCompleted = 0;
+        int64_t windowLoadUs = 0;
+        int64_t windowWriteUs = 0;
+
+        mImpl->completedFrames = 0;
+        mImpl->loadBusyUs = 0;
+        mImpl->writeBusyUs = 0;
+
+        // Load the resume journal, when one is configured. Frames listed in
+        // it are already on disk from an interrupted run and are skipped
+        // without being decoded; the file stays open so this run appends
+        // its own completions.
+        mImpl->journaledFrames.clear();
+
+        if(!mImpl->resumeJournalPath.empty()) {
+            mImpl->resumeJournal = fopen(mImpl->resumeJournalPath.c_str(), "a+");
+
+            if(mImpl->resumeJournal) {
+                int journaledFrame = 0;
+
+                while(fscanf(mImpl->resumeJournal, "%d", &journaledFrame) == 1)
+                    mImpl->journaledFrames.insert(journaledFrame);
+
+                fseek(mImpl->resumeJournal, 0, SEEK_END);
+            }
+            else {
+                logger::log("Failed to open resume journal " + mImpl->resumeJournalPath);
+            }
+        }
+
+        DngExportStats stats{};
+
+        stats.totalFrames = totalFrames;
+        stats.etaSeconds = -1.0f;
+        stats.bottleneck = DngExportStage::NONE;
+
+        // DNG encodes run as export tasks on the shared engine
+        TaskGroup exportGroup;
+
+        // A single writer thread drains the completion ring in dispatch
+        // order, so file output is one large sequential write at a time
+        // instead of the workers interleaving writes as they finish.
+        std::atomic<bool> encodersDone(false);
+
+        std::thread writerThread([this, &encodersDone] {
+            std::map<int, CompletedDng> reorder;
+            int nextSequence = 0;
+
+            while(true) {
+                CompletedDng completed;
+
+                if(!mImpl->completedDngs.wait_dequeue_timed(completed, std::chrono::milliseconds(100))) {
+                    if(encodersDone && mImpl->completedDngs.size_approx() == 0 && reorder.empty())
+                        break;
+
+                    continue;
+                }
+
+                reorder.emplace(completed.sequence, std::move(completed));
+
+                while(!reorder.empty() && reorder.begin()->first == nextSequence) {
+                    FlushCompletedDng(*mImpl, reorder.begin()->second);
+
+                    reorder.erase(reorder.begin());
+                    nextSequence++;
+                }
+            }
+        });
+
+        int dispatchedJobs = 0;
+
         for(int frameIdx = startIdx; frameIdx <= endIdx; frameIdx++) {
-            std::shared_ptr<Job> newJob;
+            // Already exported by an interrupted run; no load, no decode,
+            // no write
+            if(!mImpl->journaledFrames.empty() &&
+               mImpl->journaledFrames.find(frameIdx) != mImpl->journaledFrames.end())
+            {
+                mImpl->completedFrames++;
+                continue;
+            }
+
+            // Keep the upcoming frames moving through the container
+            // prefetchers while this one loads and encodes. Merged exports
+            // keep the serialized path and its nearest-buffer cache.
+            if(mergeFrames == 0) {
+                std::vector<std::vector<std::string>> prefetch(containers.size());
+
+                const int lastPrefetchIdx = std::min(endIdx, frameIdx + EXPORT_PREFETCH_FRAMES);
+
+                for(int nextIdx = frameIdx + 1; nextIdx <= lastPrefetchIdx; nextIdx++) {
+                    if(!mImpl->journaledFrames.empty() &&
+                       mImpl->journaledFrames.find(nextIdx) != mImpl->journaledFrames.end())
+                    {
+                        continue;
+                    }
+
+                    prefetch[orderedFrames[nextIdx].containerIndex].push_back(orderedFrames[nextIdx].frameName);
+                }
+
+                for(size_t containerIdx = 0; containerIdx < containers.size(); containerIdx++) {
+                    if(!prefetch[containerIdx].empty())
+                        containers[containerIdx]->prefetchFrames(prefetch[containerIdx]);
+                }
+            }
+
+            std::unique_ptr<Job> newJob;
+
+            const auto loadStart = std::chrono::steady_clock::now();
 
             try {
                 newJob = createFrameExportJob(containers,
+                                              readers,
                                               progress,
-                                              orderedFrames,
+                                              timeline,
                                               frameIdx,
-                                              orientation,
+                                              exportConfig,
+                                              passthroughConfig,
                                               denoiseWeights,
                                               mergeFrames,
-                                              enableCompression,
                                               applyShadingMap,
                                               noClipShadingMap);
             }
@@ -462,48 +1179,118 @@ namespace motioncam {
                 continue;
             }
 
+            mImpl->loadBusyUs += std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - loadStart).count();
+
             if(!newJob) {
                 progress.onError("Frame " + std::to_string(frameIdx) + " is corrupted");
                 continue;
             }
-            
-            while(!mImpl->jobQueue.try_enqueue(newJob))
+
+            // Admit jobs by total in-flight bytes rather than by count so the
+            // same budget holds across resolutions and merge settings. A job
+            // larger than the budget is still admitted once the queue drains.
+            const size_t jobCost = newJob->costBytes;
+
             {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            }
-                        
-            // Wait until jobs are completed
-            while(mImpl->jobQueue.size_approx() > numThreads) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                std::unique_lock<std::mutex> lock(mImpl->admissionMutex);
+
+                mImpl->admissionCondition.wait(lock, [this, jobCost] {
+                    return mImpl->inFlightBytes == 0 ||
+                           mImpl->inFlightBytes + jobCost <= mImpl->memoryBudgetBytes;
+                });
             }
-            
+
+            // Thermal/battery pacing from the platform layer. Below 1 the
+            // admission loop idles between frames so the device settles at a
+            // rate it can sustain instead of oscillating between full speed
+            // and thermal collapse.
+            const float throttle = gExportThrottle;
+
+            if(throttle < 1.0f)
+                std::this_thread::sleep_for(
+                    std::chrono::milliseconds(static_cast<int>((1.0f - throttle) * MAX_THROTTLE_DELAY_MS)));
+
+            mImpl->inFlightBytes += jobCost;
+
+            newJob->sequence = dispatchedJobs++;
+            newJob->frameIndex = frameIdx;
+
+            auto job = std::make_shared<Job>(std::move(*newJob));
+
+            TaskEngine::get().run(TaskPriority::EXPORT, [this, job] {
+                writeDNG(*job);
+            }, exportGroup);
+
             int p = (frameIdx*100) / orderedFrames.size();
-            
+
             if(!progress.onProgressUpdate(p)) {
                 // Cancel requested. Stop here.
+                mImpl->cancelled = true;
                 break;
             }
+
+            // Fold the counters into windowed stats once per window
+            const auto now = std::chrono::steady_clock::now();
+            const float windowSecs = std::chrono::duration<float>(now - windowStart).count();
+
+            if(windowSecs >= EXPORT_STATS_WINDOW_SECS) {
+                const int completed = mImpl->completedFrames;
+                const int64_t loadUs = mImpl->loadBusyUs;
+                const int64_t writeUs = mImpl->writeBusyUs;
+
+                const float elapsedSecs = std::chrono::duration<float>(now - exportStart).count();
+
+                stats.completedFrames = completed;
+                stats.instantFps = (completed - windowCompleted) / windowSecs;
+                stats.averageFps = completed / (std::max)(1e-3f, elapsedSecs);
+                stats.etaSeconds = (totalFrames - completed) / (std::max)(1e-3f, stats.instantFps);
+
+                // One admission thread loads; the engine workers write
+                stats.loadUtilization = (loadUs - windowLoadUs) / (windowSecs * 1e6f);
+                stats.writeUtilization = (writeUs - windowWriteUs) /
+                    (windowSecs * 1e6f * (std::max)(1, TaskEngine::get().numWorkers()));
+
+                stats.bottleneck = stats.loadUtilization >= stats.writeUtilization
+                    ? DngExportStage::LOAD : DngExportStage::WRITE;
+
+                progress.onStatsUpdate(stats);
+
+                windowStart = now;
+                windowCompleted = completed;
+                windowLoadUs = loadUs;
+                windowWriteUs = writeUs;
+            }
         }
-        
-        // Flush buffers
-        int numTries = 10;
-        
-        while(mImpl->jobQueue.size_approx() > 0 && numTries > 0) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
-            --numTries;
+
+        // Flush the encoders, then let the writer drain the remaining
+        // completions in order. Cancelled exports discard their pending
+        // frames here.
+        exportGroup.wait();
+
+        encodersDone = true;
+        writerThread.join();
+
+        if(mImpl->resumeJournal) {
+            fclose(mImpl->resumeJournal);
+            mImpl->resumeJournal = nullptr;
         }
 
-        mImpl->running = false;
+        // Release the frames cached for the sliding merge window
+        ImageProcessor::clearRawImageCache();
 
-        // Stop the threads
-        for(int i = 0; i < threads.size(); i++)
-            threads[i]->join();
-        
-        // Clear the queue if there are items in there
-        std::shared_ptr<Job> job;
-        
-        while(mImpl->jobQueue.try_dequeue(job)) {
-            logger::log("Discarding video frame!");
+        // Final snapshot so listeners see the true completion numbers
+        {
+            const float elapsedSecs = std::chrono::duration<float>(
+                std::chrono::steady_clock::now() - exportStart).count();
+
+            stats.completedFrames = mImpl->completedFrames;
+            stats.averageFps = stats.completedFrames / (std::max)(1e-3f, elapsedSecs);
+            stats.instantFps = stats.averageFps;
+            stats.etaSeconds = 0.0f;
+            stats.bottleneck = DngExportStage::NONE;
+
+            progress.onStatsUpdate(stats);
         }
 
         progress.onCompleted();
@@ -517,6 +1304,10 @@ namespace motioncam {
         ImageProcessor::process(rawContainer, outputFilePath, progressListener);
     }
 
+    void MotionCam::ProcessImages(const std::vector<std::string>& containerPaths, const std::vector<std::string>& outputFilePaths, const ImageProcessorProgress& progressListener) {
+        ImageProcessor::processBurst(containerPaths, outputFilePaths, progressListener);
+    }
+
     bool MotionCam::GetMetadata(const std::string& filename,
                                 float& outDurationMs,
                                 float& outFrameRate,
@@ -596,6 +1387,69 @@ namespace motioncam {
         return GetMetadata(containers, outDurationMs, outFrameRate, outNumFrames, outNumSegments, outDroppedFrames);
     }
 
+    bool MotionCam::GetShardRange(const std::vector<std::string>& containerPaths,
+                                  const int shardIndex,
+                                  const int shardCount,
+                                  int& outFromFrame,
+                                  int& outToFrame,
+                                  std::string& outError)
+    {
+        if(shardCount <= 0 || shardIndex < 0 || shardIndex >= shardCount) {
+            outError = "Invalid shard";
+            return false;
+        }
+
+        try {
+            // Index-only open; the camera metadata parse is deferred and no
+            // frame data is touched
+            auto containers = OpenContainersInParallel(containerPaths.size(), [&](const size_t i) {
+                return RawContainer::Open(containerPaths[i]);
+            });
+
+            // Recovery rebuilds the frame ordering, so a corrupted
+            // container can't be partitioned deterministically; it has to
+            // be exported whole with autoRecover instead
+            for(auto& container : containers) {
+                if(container->isCorrupted()) {
+                    outError = "Container is corrupted";
+                    return false;
+                }
+            }
+
+            // The same ordering convertVideoToDNG() builds, so frame
+            // numbers line up across shards and machines
+            util::FrameTimeline timeline(containers);
+
+            const int totalFrames = (int) timeline.frames().size();
+
+            if(totalFrames == 0) {
+                outError = "No frames";
+                return false;
+            }
+
+            // Earlier shards absorb the remainder so every frame lands in
+            // exactly one shard
+            const int base = totalFrames / shardCount;
+            const int remainder = totalFrames % shardCount;
+
+            const int count = base + (shardIndex < remainder ? 1 : 0);
+
+            if(count <= 0) {
+                outError = "Shard has no frames";
+                return false;
+            }
+
+            outFromFrame = shardIndex * base + (std::min)(shardIndex, remainder);
+            outToFrame = outFromFrame + count - 1;
+        }
+        catch(std::exception& e) {
+            outError = e.what();
+            return false;
+        }
+
+        return true;
+    }
+
     bool MotionCam::GetMetadata(
         const std::vector<std::unique_ptr<RawContainer>>& containers,
         float& outDurationMs,
@@ -603,6 +1457,22 @@ namespace motioncam {
         int& outNumFrames,
         int& outNumSegments,
         int& outDroppedFrames)
+    {
+        std::vector<RawContainer*> containerPtrs;
+
+        for(auto& container : containers)
+            containerPtrs.push_back(container.get());
+
+        return GetMetadata(containerPtrs, outDurationMs, outFrameRate, outNumFrames, outNumSegments, outDroppedFrames);
+    }
+
+    bool MotionCam::GetMetadata(
+        const std::vector<RawContainer*>& containers,
+        float& outDurationMs,
+        float& outFrameRate,
+        int& outNumFrames,
+        int& outNumSegments,
+        int& outDroppedFrames)
     {
         std::vector<util::ContainerFrame> orderedFrames;
 
@@ -617,7 +1487,43 @@ namespace motioncam {
             if(container->isCorrupted())
                 return false;
         }
-        
+
+        // Fast path. Containers written with a summary record can be listed
+        // from the footer without scanning their frames.
+        bool haveSummaries = !containers.empty();
+
+        float summaryDurationMs = 0;
+        int summaryNumFrames = 0;
+        int summaryDroppedFrames = 0;
+
+        for(const auto& container : containers) {
+            float durationMs, frameRate;
+            int numFrames, droppedFrames, width, height;
+
+            if(!container->getSummary(durationMs, frameRate, numFrames, droppedFrames, width, height)) {
+                haveSummaries = false;
+                break;
+            }
+
+            // Segments run in parallel so the duration is the longest span
+            summaryDurationMs = std::max(summaryDurationMs, durationMs);
+            summaryNumFrames += numFrames;
+            summaryDroppedFrames += droppedFrames;
+        }
+
+        if(haveSummaries && summaryNumFrames > 0) {
+            outDurationMs = summaryDurationMs;
+            outNumFrames = summaryNumFrames;
+            outDroppedFrames = summaryDroppedFrames;
+            outFrameRate = summaryDurationMs > 0 ? summaryNumFrames / (summaryDurationMs / 1000.0f) : 0;
+
+            for(auto& container : containers) {
+                outNumSegments = std::max(outNumSegments, container->getNumSegments());
+            }
+
+            return true;
+        }
+
         util::GetOrderedFrames(containers, orderedFrames);
 
         if(orderedFrames.empty())
@@ -657,7 +1563,385 @@ namespace motioncam {
         }
         
         outDurationMs = static_cast<float>((endTime - startTime) * 1000.0f);
-        
+
+        return true;
+    }
+
+    bool MotionCam::MigrateContainer(const std::string& inputPath,
+                                     const std::string& outputPath,
+                                     std::string& outError)
+    {
+        try {
+            auto srcContainer = RawContainer::Open(inputPath);
+            auto* src = dynamic_cast<RawContainerImpl_Legacy*>(srcContainer.get());
+
+            if(!src) {
+                outError = "Not a legacy container";
+                return false;
+            }
+
+            std::unique_ptr<RawContainer> dst;
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+            const int fd = open(outputPath.c_str(), O_CREAT|O_WRONLY|O_TRUNC, 0644);
+            if(fd < 0) {
+                outError = "Failed to create " + outputPath;
+                return false;
+            }
+
+            dst = RawContainer::Create(fd, src->getCameraMetadata(), src->getNumSegments());
+#elif defined(_WIN32)
+            // No fd based writer here. The frames are collected by the
+            // container and written out on commit.
+            dst = RawContainer::Create(src->getCameraMetadata(), src->getNumSegments());
+#endif
+
+            auto frames = src->getFrames();
+
+            // Order by timestamp so the migrated container plays back without
+            // sorting its index
+            std::sort(frames.begin(), frames.end(), [&](const std::string& a, const std::string& b) {
+                return src->getFrameTimestamp(a) < src->getFrameTimestamp(b);
+            });
+
+            // Bounds how many decoded frames are held at once
+            const size_t batchSize = TaskEngine::get().numWorkers();
+
+            for(size_t i = 0; i < frames.size(); i += batchSize) {
+                const auto last = std::min(frames.size(), i + batchSize);
+                std::vector<std::string> batch(frames.begin() + i, frames.begin() + last);
+
+                src->preloadFrames(batch);
+
+                for(const auto& frame : batch) {
+                    auto buffer = src->loadFrame(frame);
+                    if(!buffer) {
+                        outError = "Failed to decode " + frame;
+                        return false;
+                    }
+
+                    // The decoded data is raw. Clear the legacy compression
+                    // flags so the new metadata matches the payload.
+                    buffer->isCompressed = false;
+                    buffer->compressionType = CompressionType::UNCOMPRESSED;
+
+#if defined(_WIN32)
+                    dst->add(*buffer, false);
+#else
+                    dst->add(*buffer, true);
+#endif
+
+                    buffer->data->release();
+                }
+            }
+
+#if defined(_WIN32)
+            dst->commit(outputPath);
+#else
+            dst->commit();
+#endif
+        }
+        catch(std::exception& e) {
+            outError = e.what();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool MotionCam::GenerateProxyTrack(const std::string& containerPath, std::string& outError) {
+#if defined(_WIN32)
+        outError = "Proxy tracks are not supported on this platform";
+        return false;
+#else
+        try {
+            auto container = RawContainer::Open(containerPath);
+
+            if(container->hasProxyTrack())
+                return true;
+
+            const int fd = open(containerPath.c_str(), O_RDWR);
+            if(fd < 0) {
+                outError = "Failed to open " + containerPath;
+                return false;
+            }
+
+            if(!container->beginProxyTrack(fd)) {
+                close(fd);
+                outError = "Container does not support a proxy track";
+                return false;
+            }
+
+            // Parse the camera metadata up front; the render tasks share it
+            const auto& cameraMetadata = container->getCameraMetadata();
+
+            auto reader = container->createReader();
+            auto frames = container->getFrames();
+
+            // Generate in timestamp order so the chain is laid out the way
+            // the player walks it
+            std::sort(frames.begin(), frames.end(), [&](const std::string& a, const std::string& b) {
+                return container->getFrameTimestamp(a) < container->getFrameTimestamp(b);
+            });
+
+            // Bounds how many decoded frames are held at once
+            const size_t batchSize = TaskEngine::get().numWorkers();
+
+            std::atomic<bool> failed(false);
+
+            for(size_t i = 0; i < frames.size() && !failed; i += batchSize) {
+                const auto last = std::min(frames.size(), i + batchSize);
+
+                TaskGroup group;
+
+                for(size_t j = i; j < last; j++) {
+                    const auto& frame = frames[j];
+
+                    TaskEngine::get().run(TaskPriority::BACKGROUND, [&, frame] {
+                        std::string loadError;
+                        std::shared_ptr<RawImageBuffer> buffer;
+
+                        if(reader)
+                            buffer = reader->tryLoadFrame(frame, loadError);
+                        else
+                            buffer = container->tryLoadFrame(frame, loadError);
+
+                        if(!buffer) {
+                            failed = true;
+                            return;
+                        }
+
+                        try {
+                            // The fast preview path halves the raw data;
+                            // halving again gives the quarter resolution
+                            // proxy frame
+                            auto preview = ImageProcessor::createFastPreview(*buffer, 2, 2, cameraMetadata);
+
+                            container->appendProxyFrame(buffer->metadata.timestampNs,
+                                                        preview.data(),
+                                                        preview.width(),
+                                                        preview.height());
+                        }
+                        catch(const std::exception&) {
+                            failed = true;
+                        }
+                    }, group);
+                }
+
+                group.wait();
+            }
+
+            if(failed) {
+                outError = "Failed to generate proxy frames";
+                return false;
+            }
+
+            container->commitProxyTrack();
+        }
+        catch(std::exception& e) {
+            outError = e.what();
+            return false;
+        }
+
         return true;
+#endif
+    }
+
+    namespace {
+        // Progress listener for one benchmark run. Every frame is written
+        // over the same scratch path so sweeping a long clip doesn't fill
+        // the disk; the throughput callbacks are folded into per run
+        // averages.
+        class BenchmarkDngProgress : public DngProcessorProgress {
+        public:
+            BenchmarkDngProgress(std::string scratchPath) :
+                mScratchPath(std::move(scratchPath)),
+                mErrors(0),
+                mCompletedFrames(0),
+                mStatsWindows(0),
+                mAverageFps(0),
+                mLoadUtilization(0),
+                mWriteUtilization(0)
+            {
+            }
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+            int onNeedFd(int frameNumber) {
+                return open(mScratchPath.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+            }
+#elif defined(_WIN32)
+            std::string onNeedFd(int frameNumber) {
+                return mScratchPath;
+            }
+#endif
+
+            bool onProgressUpdate(int progress) {
+                return true;
+            }
+
+            void onAttemptingRecovery() {
+            }
+
+            void onCompleted() {
+            }
+
+            void onError(const std::string& error) {
+                ++mErrors;
+            }
+
+            void onStatsUpdate(const DngExportStats& stats) {
+                mAverageFps = stats.averageFps;
+                mCompletedFrames = stats.completedFrames;
+
+                // The final snapshot reports no bottleneck; only the
+                // windowed updates carry stage utilization
+                if(stats.bottleneck != DngExportStage::NONE) {
+                    mLoadUtilization += stats.loadUtilization;
+                    mWriteUtilization += stats.writeUtilization;
+                    ++mStatsWindows;
+                }
+            }
+
+            int errors() const {
+                return mErrors;
+            }
+
+            int completedFrames() const {
+                return mCompletedFrames;
+            }
+
+            float averageFps() const {
+                return mAverageFps;
+            }
+
+            float loadUtilization() const {
+                return mStatsWindows > 0 ? mLoadUtilization / mStatsWindows : 0.0f;
+            }
+
+            float writeUtilization() const {
+                return mStatsWindows > 0 ? mWriteUtilization / mStatsWindows : 0.0f;
+            }
+
+        private:
+            const std::string mScratchPath;
+            int mErrors;
+            int mCompletedFrames;
+            int mStatsWindows;
+            float mAverageFps;
+            float mLoadUtilization;
+            float mWriteUtilization;
+        };
+
+        // Peak resident set of the process. The Linux high-water mark can
+        // be reset between runs; elsewhere the value is monotonic over the
+        // process lifetime, so later runs inherit the peak of earlier ones.
+        void ResetPeakRss() {
+#if defined(__ANDROID__) || defined(__linux__)
+            FILE* file = fopen("/proc/self/clear_refs", "w");
+
+            if(file) {
+                fputs("5", file);
+                fclose(file);
+            }
+#endif
+        }
+
+        int64_t GetPeakRssBytes() {
+#if defined(__ANDROID__) || defined(__linux__)
+            FILE* file = fopen("/proc/self/status", "r");
+            if(!file)
+                return -1;
+
+            int64_t peakKb = -1;
+            char line[256];
+
+            while(fgets(line, sizeof(line), file)) {
+                long long value;
+
+                if(sscanf(line, "VmHWM: %lld kB", &value) == 1) {
+                    peakKb = value;
+                    break;
+                }
+            }
+
+            fclose(file);
+
+            return peakKb < 0 ? -1 : peakKb * 1024;
+#elif defined(__APPLE__)
+            struct rusage usage{};
+
+            if(getrusage(RUSAGE_SELF, &usage) != 0)
+                return -1;
+
+            // ru_maxrss is in bytes on Apple platforms
+            return usage.ru_maxrss;
+#else
+            return -1;
+#endif
+        }
+    }
+
+    std::string MotionCam::RunExportBenchmark(const std::vector<std::string>& containerPaths,
+                                              const std::string& scratchPath,
+                                              const std::vector<int>& numThreadsSweep,
+                                              const std::vector<int>& mergeFramesSweep)
+    {
+        const std::vector<int> numThreadsValues =
+            numThreadsSweep.empty() ? std::vector<int>{ 2, 4, 8 } : numThreadsSweep;
+
+        const std::vector<int> mergeFramesValues =
+            mergeFramesSweep.empty() ? std::vector<int>{ 0, 2 } : mergeFramesSweep;
+
+        const bool compressionValues[] = { true, false };
+
+        json11::Json::array runs;
+
+        for(const auto numThreads : numThreadsValues) {
+            for(const auto mergeFrames : mergeFramesValues) {
+                for(const auto enableCompression : compressionValues) {
+                    BenchmarkDngProgress progress(scratchPath);
+
+                    ResetPeakRss();
+
+                    const auto start = std::chrono::steady_clock::now();
+                    std::string runError;
+
+                    try {
+                        MotionCam m;
+
+                        m.convertVideoToDNG(containerPaths,
+                                            progress,
+                                            NO_DENOISE_WEIGHTS,
+                                            numThreads,
+                                            mergeFrames,
+                                            enableCompression);
+                    }
+                    catch(std::exception& e) {
+                        runError = e.what();
+                    }
+
+                    const double wallSeconds = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start).count() / 1e6;
+
+                    runs.push_back(json11::Json::object {
+                        { "numThreads", numThreads },
+                        { "mergeFrames", mergeFrames },
+                        { "compression", enableCompression },
+                        { "frames", progress.completedFrames() },
+                        { "wallSeconds", wallSeconds },
+                        { "framesPerSecond", progress.averageFps() },
+                        { "loadUtilization", progress.loadUtilization() },
+                        { "writeUtilization", progress.writeUtilization() },
+                        { "peakRssBytes", static_cast<double>(GetPeakRssBytes()) },
+                        { "errors", progress.errors() },
+                        { "error", runError }
+                    });
+                }
+            }
+        }
+
+        std::remove(scratchPath.c_str());
+
+        return json11::Json(json11::Json::object { { "runs", runs } }).dump();
     }
 }
@@ -0,0 +1,411 @@
+#include "motioncam/PlaybackEngine.h"
+#include "motioncam/RawContainer.h"
+#include "motioncam/RawContainerImpl.h"
+#include "motioncam/ImageProcessor.h"
+#include "motioncam/RawImageBuffer.h"
+#include "motioncam/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
+
+namespace motioncam {
+    // Decode runs at most this many frames ahead of the playhead. Bounds
+    // both memory and the amount of work thrown away on a seek.
+    const int MaxDecodedFrames      = 8;
+
+    // Fixed delay between decode and presentation. Absorbs per frame jitter
+    // in load and render times so delivery stays smooth.
+    const int PresentationLatencyMs = 50;
+
+    const int DecodeBackoffMs       = 2;
+
+    // Decoded frame budget per container, so scrubbing back and forth over
+    // the same region hits memory instead of the read+decode path
+    const size_t ScrubCacheBytes    = 128 * 1024 * 1024;
+
+    // Level of detail ladder for real time playback. Each level doubles the
+    // preview downscale, quartering the rendered pixel count. A level is
+    // dropped when the averaged render time eats most of the per frame
+    // budget, and restored only once the time is low enough that the 4x
+    // larger render would still fit.
+    const int   MaxLodLevels        = 3;
+    const float LodStepDownFraction = 0.9f;
+    const float LodStepUpFraction   = 0.2f;
+    const int   LodDwellFrames      = 30;
+    const float LodEwmaWeight       = 0.1f;
+
+    PlaybackEngine::PlaybackEngine(std::vector<std::unique_ptr<RawContainer>> containers,
+                                   PlaybackListener& listener,
+                                   const int downscale,
+                                   const int numThreads) :
+        mListener(listener),
+        mDownscale(downscale),
+        mContainers(std::move(containers)),
+        mTimeline(mContainers),
+        mFrameRate(30.0f),
+        mRunning(true),
+        mPlaying(false),
+        mGeneration(0),
+        mNextDecodeIdx(0),
+        mPresentedIdx(-1),
+        mPresentWhilePaused(false),
+        mLodLevel(0),
+        mRenderTimeEwmaMs(0.0f),
+        mLodDwell(LodDwellFrames)
+    {
+        const auto& frames = mTimeline.frames();
+
+        if(frames.size() > 1) {
+            const double durationNs =
+                static_cast<double>(frames.back().timestamp - frames.front().timestamp);
+
+            if(durationNs > 0)
+                mFrameRate = static_cast<float>((frames.size() - 1) * 1e9 / durationNs);
+        }
+
+        // One reader session per container. Entries are nullptr for
+        // containers that don't support concurrent reads.
+        for(auto& container : mContainers) {
+            container->setDecodedFrameCache(ScrubCacheBytes);
+            mReaders.push_back(container->createReader());
+        }
+
+        const int numDecodeThreads = (std::max)(1, numThreads);
+
+        for(int i = 0; i < numDecodeThreads; i++)
+            mDecodeThreads.push_back(
+                std::unique_ptr<std::thread>(new std::thread(&PlaybackEngine::doDecode, this)));
+
+        mPacerThread = std::unique_ptr<std::thread>(new std::thread(&PlaybackEngine::doPace, this));
+    }
+
+    PlaybackEngine::~PlaybackEngine() {
+        mRunning = false;
+        mPlaying = false;
+
+        for(auto& thread : mDecodeThreads)
+            thread->join();
+
+        if(mPacerThread)
+            mPacerThread->join();
+    }
+
+    void PlaybackEngine::play() {
+        if(mTimeline.frames().empty())
+            return;
+
+        // Restart from the beginning when playback ran off the end
+        if(mPresentedIdx >= static_cast<int>(mTimeline.frames().size()) - 1)
+            seek(0);
+
+        mPlaying = true;
+    }
+
+    void PlaybackEngine::pause() {
+        mPlaying = false;
+    }
+
+    void PlaybackEngine::seek(const int frameNumber) {
+        const int numTimelineFrames = static_cast<int>(mTimeline.frames().size());
+        if(numTimelineFrames == 0)
+            return;
+
+        const int target = (std::max)(0, (std::min)(frameNumber, numTimelineFrames - 1));
+
+        {
+            std::lock_guard<std::mutex> lock(mDecodeMutex);
+
+            ++mGeneration;
+            mNextDecodeIdx = target;
+        }
+
+        mPresentedIdx = target - 1;
+        mPresentWhilePaused = true;
+    }
+
+    bool PlaybackEngine::isPlaying() const {
+        return mPlaying;
+    }
+
+    int PlaybackEngine::numFrames() const {
+        return static_cast<int>(mTimeline.frames().size());
+    }
+
+    float PlaybackEngine::frameRate() const {
+        return mFrameRate;
+    }
+
+    void PlaybackEngine::recycle(Halide::Runtime::Buffer<uint8_t>& image) {
+        if(image.data() != nullptr)
+            mFreeOutputs.enqueue(std::move(image));
+    }
+
+    void PlaybackEngine::present(DecodedFrame& frame) {
+        // Frames that failed to decode are skipped rather than stalling the
+        // playhead
+        if(frame.image.data() != nullptr) {
+            mListener.onFrameReady(frame.image, frame.frameIdx, frame.timestampNs);
+            recycle(frame.image);
+        }
+
+        mPresentedIdx = frame.frameIdx;
+    }
+
+    int PlaybackEngine::playbackDownscale() const {
+        // Paused scrubbing shows single frames, so it always renders at the
+        // requested quality regardless of the ladder
+        if(!mPlaying)
+            return mDownscale;
+
+        return mDownscale << mLodLevel.load();
+    }
+
+    void PlaybackEngine::updateLod(const double renderTimeMs) {
+        // Moving average of the render time, shared by the decode threads.
+        // The update isn't atomic across threads; a lost sample only delays
+        // the average by a frame.
+        float ewma = mRenderTimeEwmaMs;
+
+        ewma = ewma <= 0.0f
+            ? static_cast<float>(renderTimeMs)
+            : ewma + LodEwmaWeight * (static_cast<float>(renderTimeMs) - ewma);
+
+        mRenderTimeEwmaMs = ewma;
+
+        if(!mPlaying)
+            return;
+
+        // Re-evaluate the level at most once per dwell period so a single
+        // slow frame doesn't bounce the ladder
+        if(--mLodDwell > 0)
+            return;
+
+        mLodDwell = LodDwellFrames;
+
+        // The decode threads share the render load, so the effective budget
+        // per frame is the frame period times the thread count
+        const float budgetMs =
+            static_cast<float>(mDecodeThreads.size()) * 1000.0f / (std::max)(1.0f, mFrameRate);
+
+        const int level = mLodLevel;
+
+        if(ewma > LodStepDownFraction * budgetMs && level < MaxLodLevels - 1)
+            mLodLevel = level + 1;
+        else if(ewma < LodStepUpFraction * budgetMs && level > 0)
+            mLodLevel = level - 1;
+    }
+
+    void PlaybackEngine::doDecode() {
+        const int numTimelineFrames = static_cast<int>(mTimeline.frames().size());
+
+        while(mRunning) {
+            // Stay within the readahead window so a paused player doesn't
+            // decode the rest of the clip
+            if(mNextDecodeIdx.load() - mPresentedIdx.load() > MaxDecodedFrames) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(DecodeBackoffMs));
+                continue;
+            }
+
+            int generation;
+            int frameIdx;
+
+            {
+                std::lock_guard<std::mutex> lock(mDecodeMutex);
+
+                generation = mGeneration;
+                frameIdx = mNextDecodeIdx;
+
+                if(frameIdx >= numTimelineFrames)
+                    frameIdx = -1;
+                else
+                    mNextDecodeIdx = frameIdx + 1;
+            }
+
+            // Past the end of the clip. Wait for a seek to move the playhead
+            // back.
+            if(frameIdx < 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(DecodeBackoffMs));
+                continue;
+            }
+
+            const auto& entry = mTimeline.frames()[frameIdx];
+            auto& container = mTimeline.container(frameIdx);
+
+            // Scrub from the proxy track when the container carries one, so
+            // the raw load and render path is only exercised for containers
+            // without a generated proxy
+            std::vector<uint8_t> proxyRgba;
+            int proxyWidth = 0;
+            int proxyHeight = 0;
+
+            if(container.getProxyFrame(entry.frameName, proxyRgba, proxyWidth, proxyHeight)) {
+                DecodedFrame proxyFrame;
+
+                proxyFrame.generation = generation;
+                proxyFrame.frameIdx = frameIdx;
+                proxyFrame.timestampNs = entry.timestamp;
+
+                mFreeOutputs.try_dequeue(proxyFrame.image);
+
+                if(proxyFrame.image.data() == nullptr      ||
+                   proxyFrame.image.width() != proxyWidth  ||
+                   proxyFrame.image.height() != proxyHeight)
+                {
+                    proxyFrame.image =
+                        Halide::Runtime::Buffer<uint8_t>::make_interleaved(proxyWidth, proxyHeight, 4);
+                }
+
+                memcpy(proxyFrame.image.data(), proxyRgba.data(), proxyRgba.size());
+
+                mDecodedFrames.enqueue(std::move(proxyFrame));
+                continue;
+            }
+
+            // Prefer the pread based reader session so decode threads don't
+            // contend on the container's FILE* cursor
+            std::string loadError;
+            std::shared_ptr<RawImageBuffer> raw;
+
+            if(mReaders[entry.containerIndex]) {
+                raw = mReaders[entry.containerIndex]->tryLoadFrame(entry.frameName, loadError);
+            }
+            else {
+                std::lock_guard<std::mutex> lock(mLoadMutex);
+                raw = container.tryLoadFrame(entry.frameName, loadError);
+            }
+
+            DecodedFrame frame;
+
+            frame.generation = generation;
+            frame.frameIdx = frameIdx;
+            frame.timestampNs = entry.timestamp;
+
+            if(!raw) {
+                if(!loadError.empty()) {
+                    logger::log("Failed to load frame: " + loadError);
+                    mListener.onError(loadError);
+                }
+            }
+            else {
+                mFreeOutputs.try_dequeue(frame.image);
+
+                const int downscale = playbackDownscale();
+                const auto renderStart = std::chrono::steady_clock::now();
+
+                try {
+                    ImageProcessor::createFastPreview(
+                        *raw, downscale, downscale, container.getCameraMetadata(), frame.image);
+
+                    updateLod(std::chrono::duration <double, std::milli>(
+                        std::chrono::steady_clock::now() - renderStart).count());
+                }
+                catch(const std::exception& e) {
+                    logger::log(std::string("Failed to render frame: ") + e.what());
+                    mListener.onError(e.what());
+
+                    recycle(frame.image);
+                    frame.image = Halide::Runtime::Buffer<uint8_t>();
+                }
+            }
+
+            mDecodedFrames.enqueue(std::move(frame));
+        }
+    }
+
+    void PlaybackEngine::doPace() {
+        const int numTimelineFrames = static_cast<int>(mTimeline.frames().size());
+
+        std::map<int, DecodedFrame> reorder;
+        int generation = mGeneration;
+        bool wasPlaying = false;
+
+        // Wall clock anchor mapping frame timestamps to presentation times.
+        // Re-established whenever playback (re)starts or falls behind.
+        bool anchorValid = false;
+        std::chrono::steady_clock::time_point anchorTime;
+        int64_t anchorTimestampNs = 0;
+
+        while(mRunning) {
+            // Drop everything decoded before the last seek
+            if(generation != mGeneration) {
+                generation = mGeneration;
+
+                for(auto& e : reorder)
+                    recycle(e.second.image);
+
+                reorder.clear();
+                anchorValid = false;
+            }
+
+            if(mPlaying && !wasPlaying)
+                anchorValid = false;
+
+            wasPlaying = mPlaying;
+
+            const int nextIdx = mPresentedIdx + 1;
+            auto it = reorder.find(nextIdx);
+
+            if(it == reorder.end()) {
+                DecodedFrame frame;
+
+                if(!mDecodedFrames.wait_dequeue_timed(frame, std::chrono::milliseconds(100)))
+                    continue;
+
+                if(frame.generation != mGeneration) {
+                    recycle(frame.image);
+                    continue;
+                }
+
+                reorder[frame.frameIdx] = std::move(frame);
+                continue;
+            }
+
+            if(!mPlaying) {
+                // While paused only the frame requested by a seek is shown
+                if(!mPresentWhilePaused) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(DecodeBackoffMs));
+                    continue;
+                }
+
+                mPresentWhilePaused = false;
+
+                present(it->second);
+                reorder.erase(it);
+                continue;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+
+            if(!anchorValid) {
+                anchorTime = now + std::chrono::milliseconds(PresentationLatencyMs);
+                anchorTimestampNs = it->second.timestampNs;
+                anchorValid = true;
+            }
+
+            const auto target =
+                anchorTime + std::chrono::nanoseconds(it->second.timestampNs - anchorTimestampNs);
+
+            if(target > now) {
+                std::this_thread::sleep_until(target);
+            }
+            else if(now - target > std::chrono::milliseconds(PresentationLatencyMs)) {
+                // Fell behind by more than the latency budget. Resync to the
+                // current frame instead of rushing through the backlog.
+                anchorTime = now;
+                anchorTimestampNs = it->second.timestampNs;
+            }
+
+            const int presentedIdx = it->second.frameIdx;
+
+            present(it->second);
+            reorder.erase(it);
+
+            if(presentedIdx >= numTimelineFrames - 1) {
+                mPlaying = false;
+                mListener.onPlaybackEnded();
+            }
+        }
+    }
+}
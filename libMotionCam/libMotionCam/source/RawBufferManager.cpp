@@ -1,4 +1,5 @@
 #include "motioncam/RawBufferManager.h"
+#include "motioncam/RawBufferSpill.h"
 #include "motioncam/RawImageBuffer.h"
 #include "motioncam/RawContainer.h"
 #include "motioncam/Util.h"
@@ -6,6 +7,8 @@
 #include "motioncam/Measure.h"
 #include "motioncam/Lock.h"
 
+#include <chrono>
+#include <cstdio>
 #include <utility>
 
 namespace motioncam {
@@ -17,10 +20,23 @@ namespace motioncam {
         mVerticalCrop(0),
         mBin(false),
         mMemoryUseBytes(0),
-        mNumBuffers(0)
+        mNumBuffers(0),
+        mCopyTimeUs(0),
+        mCopiedFrames(0),
+        mCopyDrops(0),
+        mSpillWatermarkBytes(0),
+        mSaveWorkerRunning(false),
+        mInFlightSaves(0)
     {
     }
 
+    RawBufferManager::~RawBufferManager() {
+        mSaveWorkerRunning = false;
+
+        if(mSaveWorkerThread && mSaveWorkerThread->joinable())
+            mSaveWorkerThread->join();
+    }
+
     RawBufferManager::LockedBuffers::LockedBuffers() = default;
     RawBufferManager::LockedBuffers::LockedBuffers(
         std::vector<std::shared_ptr<RawImageBuffer>> buffers) : mBuffers(std::move(buffers)) {}
@@ -41,16 +57,98 @@ namespace motioncam {
         mMemoryUseBytes += static_cast<int>(buffer->data->len());
     }
 
+    void RawBufferManager::warmUp(const size_t bufferSize, const int count) {
+        Measure measure("RawBufferManager::warmUp()");
+
+        if(bufferSize == 0)
+            return;
+
+        while(mNumBuffers < count) {
+            auto buffer = std::make_shared<RawImageBuffer>(
+                std::unique_ptr<NativeBuffer>(new NativeHostBuffer(bufferSize)));
+
+            // Touch every page so the memory is resident before the first
+            // frame lands in it, instead of faulting mid-recording
+            uint8_t* data = buffer->data->lock(true);
+
+            const size_t pageSize = 4096;
+
+            for(size_t i = 0; i < bufferSize; i += pageSize)
+                data[i] = 0;
+
+            buffer->data->unlock();
+
+            addBuffer(buffer);
+        }
+    }
+
     int RawBufferManager::numBuffers() const {
         return mNumBuffers;
     }
 
     void RawBufferManager::recordingStats(size_t& outMemoryUseBytes, float& outFps, size_t& outOutputSizeBytes) {
-        Lock lock(mMutex, "recordingStats()");
-        
+        const auto streamer = std::atomic_load(&mStreamer);
+
         outMemoryUseBytes = mMemoryUseBytes;
-        outFps = mStreamer ? mStreamer->estimateFps() : 0;
-        outOutputSizeBytes = mStreamer ? mStreamer->writenOutputBytes() : 0;
+        outFps = streamer ? streamer->estimateFps() : 0;
+        outOutputSizeBytes = streamer ? streamer->writenOutputBytes() : 0;
+    }
+
+    void RawBufferManager::recordCopy(const int64_t copyTimeUs) {
+        mCopyTimeUs.fetch_add(copyTimeUs, std::memory_order_relaxed);
+        mCopiedFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void RawBufferManager::recordCopyDrop() {
+        mCopyDrops.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void RawBufferManager::recordingStats(RecordingStats& outStats) {
+        const auto streamer = std::atomic_load(&mStreamer);
+
+        outStats = RecordingStats{};
+
+        outStats.memoryUseBytes = mMemoryUseBytes;
+        outStats.numBuffers = mNumBuffers;
+
+        const uint64_t copiedFrames = mCopiedFrames.load(std::memory_order_relaxed);
+
+        if(copiedFrames > 0)
+            outStats.copyTimeUs = mCopyTimeUs.load(std::memory_order_relaxed) / static_cast<float>(copiedFrames);
+
+        outStats.droppedNoBuffer = mCopyDrops.load(std::memory_order_relaxed);
+
+        if(!streamer)
+            return;
+
+        outStats.fps = streamer->estimateFps();
+        outStats.outputSizeBytes = streamer->writenOutputBytes();
+
+        outStats.unprocessedQueueDepth = streamer->unprocessedQueueDepth();
+        outStats.maxUnprocessedQueueDepth = streamer->maxUnprocessedQueueDepth();
+        outStats.readyQueueDepth = streamer->readyQueueDepth();
+        outStats.maxReadyQueueDepth = streamer->maxReadyQueueDepth();
+
+        uint64_t processTimeUs = 0, processedFrames = 0;
+        streamer->processStats(processTimeUs, processedFrames);
+
+        if(processedFrames > 0)
+            outStats.processTimeUs = processTimeUs / static_cast<float>(processedFrames);
+
+        outStats.droppedStreamer = streamer->droppedFrames();
+
+        uint64_t numWrites = 0, totalWriteTimeUs = 0;
+
+        for(const auto& ioStats : streamer->ioStats()) {
+            numWrites += ioStats->numWrites.load(std::memory_order_relaxed);
+            totalWriteTimeUs += ioStats->totalLatencyUs.load(std::memory_order_relaxed);
+
+            outStats.writtenFrames += ioStats->writtenFrames.load(std::memory_order_relaxed);
+            outStats.writtenBytes += ioStats->writtenBytes.load(std::memory_order_relaxed);
+        }
+
+        if(numWrites > 0)
+            outStats.writeTimeUs = totalWriteTimeUs / static_cast<float>(numWrites);
     }
 
     size_t RawBufferManager::memoryUseBytes() const {
@@ -60,16 +158,30 @@ namespace motioncam {
     bool RawBufferManager::removeBuffer() {
         Lock lock(mMutex, "removeBuffer()");
 
-        if(mReadyBuffers.empty())
-            return false;
+        drainIncomingBuffers();
 
-        auto buffer = mReadyBuffers.front();
-        mReadyBuffers.erase(mReadyBuffers.begin());
+        if(!mReadyBuffers.empty()) {
+            auto buffer = mReadyBuffers.front();
+            mReadyBuffers.erase(mReadyBuffers.begin());
 
-        mMemoryUseBytes -= buffer->data->len();
-        --mNumBuffers;
+            mMemoryUseBytes -= buffer->data->len();
+            --mNumBuffers;
+
+            return true;
+        }
 
-        return true;
+        // No ZSL history to trim. Give back an idle buffer instead so the
+        // pool can still shrink under memory pressure while recording.
+        std::shared_ptr<RawImageBuffer> buffer;
+
+        if(mUnusedBuffers.try_dequeue(buffer)) {
+            mMemoryUseBytes -= buffer->data->len();
+            --mNumBuffers;
+
+            return true;
+        }
+
+        return false;
     }
 
     void RawBufferManager::reset() {
@@ -79,9 +191,17 @@ namespace motioncam {
 
         {
             Lock lock(mMutex, "reset()");
+
+            std::shared_ptr<RawImageBuffer> staged;
+            while(mIncomingBuffers.try_dequeue(staged)) {
+            }
+
             mReadyBuffers.clear();
+
+            if(mSpill)
+                mSpill->clear();
         }
-        
+
         mNumBuffers = 0;
         mMemoryUseBytes = 0;
     }
@@ -96,30 +216,96 @@ namespace motioncam {
         {
             Lock lock(mMutex, "dequeueUnusedBuffer()");
 
-            if(!mReadyBuffers.empty()) {
-                buffer = mReadyBuffers.front();
-                mReadyBuffers.erase(mReadyBuffers.begin());
+            drainIncomingBuffers();
 
-                return buffer;
+            // Steal the oldest ready buffer, skipping foreign entries; they
+            // borrow camera memory and can't serve as copy destinations
+            for(auto it = mReadyBuffers.begin(); it != mReadyBuffers.end(); ++it) {
+                if(!(*it)->isForeign) {
+                    buffer = *it;
+                    mReadyBuffers.erase(it);
+
+                    return buffer;
+                }
             }
         }
                 
         return nullptr;
     }
 
-    void RawBufferManager::enqueueReadyBuffer(const std::shared_ptr<RawImageBuffer>& buffer) {
-        Lock lock(mMutex, "enqueueReadyBuffer()");
+    void RawBufferManager::insertReadyBuffer(const std::shared_ptr<RawImageBuffer>& buffer) {
+        // The common case is a frame newer than everything held, which
+        // stays a plain append
+        if(mReadyBuffers.empty() || mReadyBuffers.back()->metadata.timestampNs <= buffer->metadata.timestampNs) {
+            mReadyBuffers.push_back(buffer);
+            return;
+        }
+
+        auto it = std::lower_bound(
+            mReadyBuffers.begin(), mReadyBuffers.end(), buffer->metadata.timestampNs,
+            [](const std::shared_ptr<RawImageBuffer>& x, const int64_t timestampNs) {
+                return x->metadata.timestampNs < timestampNs;
+            });
+
+        mReadyBuffers.insert(it, buffer);
+    }
+
+    void RawBufferManager::drainIncomingBuffers() {
+        std::shared_ptr<RawImageBuffer> buffer;
+        bool drained = false;
 
-        if(mStreamer && mStreamer->isRunning()) {
-            mStreamer->add(buffer);
+        while(mIncomingBuffers.try_dequeue(buffer)) {
+            insertReadyBuffer(buffer);
+            drained = true;
         }
-        else
-            mReadyBuffers.push_back(buffer);
+
+        if(!drained)
+            return;
+
+        // Push the coldest ZSL history out to the spill ring once the
+        // in-memory history exceeds the watermark. The spilled buffers
+        // return to the unused pool after they are written.
+        if(mSpill && mSpillWatermarkBytes > 0) {
+            size_t readyBytes = 0;
+
+            for(auto& e : mReadyBuffers)
+                readyBytes += e->data->len();
+
+            auto it = mReadyBuffers.begin();
+
+            while(readyBytes > mSpillWatermarkBytes && it != mReadyBuffers.end()) {
+                if((*it)->metadata.rawType == RawType::ZSL) {
+                    readyBytes -= (*it)->data->len();
+
+                    mSpill->add(*it);
+                    it = mReadyBuffers.erase(it);
+                }
+                else
+                    ++it;
+            }
+        }
+    }
+
+    void RawBufferManager::enqueueReadyBuffer(const std::shared_ptr<RawImageBuffer>& buffer) {
+        // Called at frame rate from the camera callback. It must never wait
+        // behind a consumer holding the history lock through a capture, so
+        // frames are staged through a lock-free queue and folded into the
+        // ordered list by the next consumer.
+        const auto streamer = std::atomic_load(&mStreamer);
+
+        if(streamer && streamer->isRunning()) {
+            streamer->add(buffer);
+            return;
+        }
+
+        mIncomingBuffers.enqueue(buffer);
     }
 
     int RawBufferManager::numHdrBuffers() {
         Lock lock(mMutex, "numHdrBuffers()");
-        
+
+        drainIncomingBuffers();
+
         int hdrBuffers = 0;
         
         for(auto& e : mReadyBuffers) {
@@ -132,17 +318,28 @@ namespace motioncam {
     }
 
     void RawBufferManager::discardBuffer(const std::shared_ptr<RawImageBuffer>& buffer) {
+        // Foreign buffers borrow their memory (camera runtime images), so
+        // give it back to its owner instead of recycling it into the pool
+        if(buffer->isForeign) {
+            buffer->data->release();
+            return;
+        }
+
         mUnusedBuffers.enqueue(buffer);
     }
 
     void RawBufferManager::discardBuffers(const std::vector<std::shared_ptr<RawImageBuffer>>& buffers) {
-        mUnusedBuffers.enqueue_bulk(buffers.begin(), buffers.size());
+        for(const auto& buffer : buffers)
+            discardBuffer(buffer);
     }
 
     void RawBufferManager::returnBuffers(const std::vector<std::shared_ptr<RawImageBuffer>>& buffers) {
         Lock lock(mMutex, "returnBuffers()");
 
-        std::move(buffers.begin(), buffers.end(), std::back_inserter(mReadyBuffers));
+        // Returned buffers are older than the live frames, so they go back
+        // to their timestamp position instead of the end
+        for(const auto& buffer : buffers)
+            insertReadyBuffer(buffer);
     }
 
     void RawBufferManager::saveHdr(int numSaveBuffers,
@@ -156,6 +353,8 @@ namespace motioncam {
         {
             Lock lock(mMutex, "saveHdr()");
 
+            drainIncomingBuffers();
+
             if (mReadyBuffers.empty() || numSaveBuffers < 1)
                 return;
 
@@ -222,34 +421,21 @@ namespace motioncam {
                 mReadyBuffers.end());
         }
 
-        // Create container
-        json11::Json::object postProcessSettings;
-        settings.toJson(postProcessSettings);
-        
-        json11::Json::object extraData = {
-            { "referenceTimestamp", std::to_string(referenceTimestampNs) },
-            { "isHdr",  true },
-            { "postProcessSettings", postProcessSettings }
-        };
-        
-        auto container = RawContainer::Create(metadata, 1, extraData);
-        
-        container->add(buffers, false);
-        
-        // Return buffers
-        auto it = buffers.begin();
-        while(it != buffers.end()) {
-            mUnusedBuffers.enqueue(*it);
-            ++it;
-        }
+        // Hand the container construction to the save worker. The buffers
+        // stay checked out until it has copied them.
+        SaveJob job;
 
-        // Save the container
-        if(AlwaysSaveToDisk || mPendingContainers.size_approx() > NumContainersToKeepInMemory) {
-            container->commit(outputPath);
-        }
-        else {
-            mPendingContainers.enqueue(std::move(container));
-        }
+        job.isHdr = true;
+        job.metadata = std::make_shared<const RawCameraMetadata>(metadata);
+        job.settings = settings;
+        job.referenceTimestampNs = referenceTimestampNs;
+        job.outputPath = outputPath;
+        job.buffers = std::move(buffers);
+
+        ++mInFlightSaves;
+
+        startSaveWorker();
+        mSaveJobs.enqueue(std::move(job));
     }
 
     void RawBufferManager::save(RawCameraMetadata& metadata,
@@ -268,19 +454,24 @@ namespace motioncam {
         {
             Lock lock(mMutex, "save()");
 
+            drainIncomingBuffers();
+
             if(mReadyBuffers.empty())
                 return;
 
             // Find reference frame
             int referenceIdx = static_cast<int>(mReadyBuffers.size()) - 1;
 
-            for(int i = 0; i < mReadyBuffers.size(); i++) {
-                if(mReadyBuffers[i]->metadata.timestampNs == referenceTimestampNs) {
-                    referenceIdx = i;
-                    buffers.push_back(mReadyBuffers[i]);
-                    --numSaveBuffers;
-                    break;
-                }
+            auto referenceIt = std::lower_bound(
+                mReadyBuffers.begin(), mReadyBuffers.end(), referenceTimestampNs,
+                [](const std::shared_ptr<RawImageBuffer>& x, const int64_t timestamp) {
+                    return x->metadata.timestampNs < timestamp;
+                });
+
+            if(referenceIt != mReadyBuffers.end() && (*referenceIt)->metadata.timestampNs == referenceTimestampNs) {
+                referenceIdx = static_cast<int>(referenceIt - mReadyBuffers.begin());
+                buffers.push_back(*referenceIt);
+                --numSaveBuffers;
             }
 
             // Update timestamp
@@ -332,45 +523,167 @@ namespace motioncam {
             }
         }
 
-        // Create container
+        // Hand the container construction to the save worker. The buffers
+        // stay checked out until it has copied them.
+        SaveJob job;
+
+        job.isHdr = false;
+        job.metadata = std::make_shared<const RawCameraMetadata>(metadata);
+        job.settings = settings;
+        job.referenceTimestampNs = referenceTimestampNs;
+        job.outputPath = outputPath;
+        job.buffers = std::move(buffers);
+
+        ++mInFlightSaves;
+
+        startSaveWorker();
+        mSaveJobs.enqueue(std::move(job));
+    }
+
+    void RawBufferManager::startSaveWorker() {
+        Lock lock(mMutex, "startSaveWorker()");
+
+        if(mSaveWorkerThread)
+            return;
+
+        mSaveWorkerRunning = true;
+        mSaveWorkerThread = std::unique_ptr<std::thread>(new std::thread(&RawBufferManager::doSaveWork, this));
+    }
+
+    void RawBufferManager::doSaveWork() {
+        while(mSaveWorkerRunning) {
+            SaveJob job;
+
+            // Capture jobs come first. They hold buffers out of the pools and
+            // gate the processing worker, so they are never queued behind a
+            // housekeeping write.
+            if(mSaveJobs.wait_dequeue_timed(job, std::chrono::milliseconds(100))) {
+                processSaveJob(job);
+                continue;
+            }
+
+            // Idle; flush a deferred container to disk
+            PendingCommit commit;
+
+            if(mPendingCommits.try_dequeue(commit))
+                writePendingCommit(commit);
+        }
+
+        // Flush whatever is left so captures are not lost on shutdown
+        SaveJob job;
+        while(mSaveJobs.try_dequeue(job))
+            processSaveJob(job);
+
+        PendingCommit commit;
+        while(mPendingCommits.try_dequeue(commit))
+            writePendingCommit(commit);
+    }
+
+    void RawBufferManager::processSaveJob(SaveJob& job) {
+        Measure measure("RawBufferManager::processSaveJob()");
+
         json11::Json::object postProcessSettings;
-        settings.toJson(postProcessSettings);
-        
+        job.settings.toJson(postProcessSettings);
+
         json11::Json::object extraData = {
-            { "referenceTimestamp", std::to_string(referenceTimestampNs) },
-            { "isHdr",  false },
+            { "referenceTimestamp", std::to_string(job.referenceTimestampNs) },
+            { "isHdr",  job.isHdr },
             { "postProcessSettings", postProcessSettings }
         };
-        
-        auto container = RawContainer::Create(metadata, 1, extraData);
-        
-        container->add(buffers, false);
 
-        // Return buffers
-        {
-            Lock lock(mMutex, "save()");
-            mReadyBuffers.insert(mReadyBuffers.end(), buffers.begin(), buffers.end());
-        }
+        auto container = RawContainer::Create(*job.metadata, 1, extraData);
 
-        // Save container
+        // Keep the container in memory when the backlog allows it; otherwise
+        // defer the disk write behind any further capture jobs
         if(AlwaysSaveToDisk || mPendingContainers.size_approx() > NumContainersToKeepInMemory) {
-            container->commit(outputPath);
+            container->add(job.buffers, false);
+
+            // Return the buffers now that the container owns its own copies
+            if(job.isHdr) {
+                discardBuffers(job.buffers);
+            }
+            else {
+                Lock lock(mMutex, "processSaveJob()");
+
+                for(const auto& buffer : job.buffers)
+                    insertReadyBuffer(buffer);
+            }
+
+            job.buffers.clear();
+
+            PendingCommit commit;
+
+            commit.container = std::move(container);
+            commit.outputPath = job.outputPath;
+
+            mPendingCommits.enqueue(std::move(commit));
         }
         else {
-            mPendingContainers.enqueue(std::move(container));
+            // The processing consumer reads the frames straight out of the
+            // container, so share the captured buffers with it instead of
+            // cloning every frame. The buffers stay checked out of the pools
+            // until the consumer releases the container.
+            container->addShared(job.buffers);
+
+            PendingContainer pending;
+
+            pending.container = std::move(container);
+            pending.sharedBuffers = std::move(job.buffers);
+
+            mPendingContainers.enqueue(std::move(pending));
+        }
+
+        --mInFlightSaves;
+    }
+
+    void RawBufferManager::writePendingCommit(PendingCommit& commit) {
+        // Write under a temporary name so the processing worker never picks
+        // up a half written container
+        const std::string tmpPath = commit.outputPath + ".tmp";
+
+        try {
+            commit.container->commit(tmpPath);
+
+            if(std::rename(tmpPath.c_str(), commit.outputPath.c_str()) != 0)
+                logger::log("Failed to rename " + tmpPath);
+        }
+        catch(const std::exception& e) {
+            logger::log(std::string("Failed to write container: ") + e.what());
         }
     }
 
     std::shared_ptr<RawContainer> RawBufferManager::popPendingContainer() {
-        std::shared_ptr<RawContainer> container;
-        mPendingContainers.try_dequeue(container);
-        
-        return container;
+        PendingContainer pending;
+
+        // A capture may still be in flight on the save worker. Wait for it
+        // instead of reporting that nothing was captured.
+        while(!mPendingContainers.try_dequeue(pending) && mInFlightSaves > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        if(!pending.container)
+            return nullptr;
+
+        if(pending.sharedBuffers.empty())
+            return std::shared_ptr<RawContainer>(std::move(pending.container));
+
+        // The container shares its frames with the buffer pool. Hand them
+        // back once the consumer drops its reference, the same way
+        // LockedBuffers returns consumed frames.
+        auto sharedBuffers = std::move(pending.sharedBuffers);
+
+        return std::shared_ptr<RawContainer>(
+            pending.container.release(),
+            [sharedBuffers](RawContainer* container) {
+                delete container;
+                RawBufferManager::get().discardBuffers(sharedBuffers);
+            });
     }
 
     std::unique_ptr<RawBufferManager::LockedBuffers> RawBufferManager::consumeLatestBuffer() {
         Lock lock(mMutex, "consumeLatestBuffer()");
 
+        drainIncomingBuffers();
+
         if(mReadyBuffers.empty()) {
             return std::unique_ptr<LockedBuffers>(new LockedBuffers());
         }
@@ -386,33 +699,67 @@ namespace motioncam {
     std::unique_ptr<RawBufferManager::LockedBuffers> RawBufferManager::consumeBuffer(int64_t timestampNs) {
         Lock lock(mMutex, "consumeBuffer()");
 
-        auto it = std::find_if(
-            mReadyBuffers.begin(), mReadyBuffers.end(),
-            [&](const std::shared_ptr<RawImageBuffer>& x) { return x->metadata.timestampNs == timestampNs; }
-        );
+        drainIncomingBuffers();
 
-        if(it != mReadyBuffers.end()) {
+        // The ready list is timestamp ordered, so the shutter-critical
+        // lookup is a binary search instead of a scan of the ZSL history
+        auto it = std::lower_bound(
+            mReadyBuffers.begin(), mReadyBuffers.end(), timestampNs,
+            [](const std::shared_ptr<RawImageBuffer>& x, const int64_t timestamp) {
+                return x->metadata.timestampNs < timestamp;
+            });
+
+        if(it != mReadyBuffers.end() && (*it)->metadata.timestampNs == timestampNs) {
             auto lockedBuffers = std::unique_ptr<LockedBuffers>(new LockedBuffers( { *it }));
             mReadyBuffers.erase(it);
 
             return lockedBuffers;
         }
 
+        // The frame may have been spilled to disk
+        if(mSpill) {
+            auto buffer = mSpill->rehydrate(timestampNs);
+
+            if(buffer) {
+                // The rehydrated buffer joins the pool when it is returned
+                ++mNumBuffers;
+                mMemoryUseBytes += buffer->data->len();
+
+                return std::unique_ptr<LockedBuffers>(new LockedBuffers( { buffer } ));
+            }
+        }
+
         return std::unique_ptr<LockedBuffers>(new LockedBuffers());
     }
 
     std::unique_ptr<RawBufferManager::LockedBuffers> RawBufferManager::consumeAllBuffers() {
         Lock lock(mMutex, "consumeAllBuffers()");
 
-        auto lockedBuffers = std::unique_ptr<LockedBuffers>(new LockedBuffers(mReadyBuffers));
+        drainIncomingBuffers();
+
+        std::vector<std::shared_ptr<RawImageBuffer>> buffers;
+
+        // Spilled frames are older than anything still in RAM
+        if(mSpill) {
+            buffers = mSpill->rehydrateAll();
+
+            for(auto& buffer : buffers) {
+                ++mNumBuffers;
+                mMemoryUseBytes += buffer->data->len();
+            }
+        }
+
+        buffers.insert(buffers.end(), mReadyBuffers.begin(), mReadyBuffers.end());
         mReadyBuffers.clear();
 
-        return lockedBuffers;
+        return std::unique_ptr<LockedBuffers>(new LockedBuffers(buffers));
     }
 
     int64_t RawBufferManager::latestTimeStamp() {
         Lock lock(mMutex, "latestTimeStamp()");
-        
+
+        drainIncomingBuffers();
+
         if(mReadyBuffers.empty())
             return -1;
         
@@ -424,25 +771,69 @@ namespace motioncam {
                                            const int audioFd,
                                            std::shared_ptr<AudioInterface> audioInterface,
                                            const int numThreads,
-                                           const RawCameraMetadata& metadata)
+                                           const RawCameraMetadata& metadata,
+                                           const int preRollMs)
     {
         // Clear out buffers before streaming
         {
             consumeAllBuffers();
         }
-        
+
         Lock lock(mMutex, "enableStreaming()");
-        
-        if(mStreamer) {
+
+        if(std::atomic_load(&mStreamer)) {
             logger::log("Failed to start streaming, already in progress");
             return;
         }
-        
-        mStreamer = std::make_shared<RawBufferStreamer>();
-        
-        mStreamer->setBin(mBin);
-        mStreamer->setCropAmount(mHorizontalCrop, mVerticalCrop);
-        mStreamer->start(fds, audioFd, audioInterface, numThreads, metadata);
+
+        drainIncomingBuffers();
+
+        // Pull the most recent history out of the ZSL ring so the recording
+        // starts before the button press
+        std::vector<std::shared_ptr<RawImageBuffer>> preRollBuffers;
+
+        if(preRollMs > 0 && !mReadyBuffers.empty()) {
+            const int64_t cutoffNs =
+                mReadyBuffers.back()->metadata.timestampNs - preRollMs * static_cast<int64_t>(1000*1000);
+
+            for(auto& buffer : mReadyBuffers) {
+                if(buffer->metadata.rawType == RawType::ZSL && buffer->metadata.timestampNs >= cutoffNs)
+                    preRollBuffers.push_back(buffer);
+            }
+
+            mReadyBuffers.erase(
+                std::remove_if(
+                    mReadyBuffers.begin(),
+                    mReadyBuffers.end(),
+                    [&preRollBuffers](std::shared_ptr<RawImageBuffer>& e) {
+                        return std::find(preRollBuffers.begin(), preRollBuffers.end(), e) != preRollBuffers.end();
+                    }),
+                mReadyBuffers.end());
+
+            std::sort(preRollBuffers.begin(), preRollBuffers.end(), [](std::shared_ptr<RawImageBuffer> a, std::shared_ptr<RawImageBuffer> b) {
+                return a->metadata.timestampNs < b->metadata.timestampNs;
+            });
+        }
+
+        auto streamer = std::make_shared<RawBufferStreamer>();
+
+        streamer->setBin(mBin);
+        streamer->setCropAmount(mHorizontalCrop, mVerticalCrop);
+        // Snapshot the metadata once; the streamer threads all share the
+        // immutable copy instead of each taking their own
+        streamer->start(fds, audioFd, audioInterface, numThreads, std::make_shared<const RawCameraMetadata>(metadata));
+
+        // Queue the pre-roll before the streamer is published, then forward
+        // anything the camera staged while it was starting. The staging
+        // queue is FIFO, so the stream stays in timestamp order.
+        for(auto& buffer : preRollBuffers)
+            streamer->add(buffer);
+
+        std::atomic_store(&mStreamer, streamer);
+
+        std::shared_ptr<RawImageBuffer> staged;
+        while(mIncomingBuffers.try_dequeue(staged))
+            streamer->add(staged);
     }
 
     void RawBufferManager::setCropAmount(int horizontal, int vertical) {
@@ -461,6 +852,8 @@ namespace motioncam {
     float RawBufferManager::bufferSpaceUse() {
         Lock lock(mMutex, "bufferSpaceUse()");
 
+        drainIncomingBuffers();
+
         float bufferUseAmount = (mNumBuffers - (mReadyBuffers.size() + mUnusedBuffers.size_approx())) / (float) mNumBuffers;
 
         bufferUseAmount = std::max(0.0f, bufferUseAmount);
@@ -469,12 +862,53 @@ namespace motioncam {
         return bufferUseAmount;
     }
 
+    void RawBufferManager::enableSpill(const std::string& spillPath,
+                                       const size_t spillSizeBytes,
+                                       const size_t ramWatermarkBytes)
+    {
+        Lock lock(mMutex, "enableSpill()");
+
+        if(mSpill) {
+            logger::log("Spill ring already enabled");
+            return;
+        }
+
+        auto spill = std::make_shared<RawBufferSpill>(spillPath, spillSizeBytes);
+
+        if(!spill->isValid())
+            return;
+
+        mSpill = spill;
+        mSpillWatermarkBytes = ramWatermarkBytes;
+    }
+
+    void RawBufferManager::disableSpill() {
+        std::shared_ptr<RawBufferSpill> spill;
+
+        {
+            Lock lock(mMutex, "disableSpill()");
+
+            spill = mSpill;
+
+            mSpill = nullptr;
+            mSpillWatermarkBytes = 0;
+        }
+
+        // Destroy outside the lock. The spill thread returns its pending
+        // buffers through discardBuffer() while shutting down.
+        spill = nullptr;
+    }
+
     void RawBufferManager::endStreaming() {
         Lock lock(mMutex, "endStreaming()");
-        
-        if(mStreamer)
-            mStreamer->stop();
-        
-        mStreamer = nullptr;
+
+        // Unpublish first so the camera callback goes back to staging
+        // frames while the streamer drains
+        const auto streamer = std::atomic_load(&mStreamer);
+
+        std::atomic_store(&mStreamer, std::shared_ptr<RawBufferStreamer>());
+
+        if(streamer)
+            streamer->stop();
     }
 }
@@ -0,0 +1,273 @@
+#include "motioncam/RawBufferSpill.h"
+#include "motioncam/RawBufferManager.h"
+#include "motioncam/RawImageBuffer.h"
+#include "motioncam/RawEncoder.h"
+#include "motioncam/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+
+#if defined(_WIN32)
+    #define FSEEK _fseeki64
+    #define FTELL _ftelli64
+#else
+    #define FSEEK fseeko
+    #define FTELL ftello
+#endif
+
+namespace motioncam {
+
+    RawBufferSpill::RawBufferSpill(const std::string& path, const size_t maxSizeBytes) :
+        mFile(nullptr),
+        mMaxSizeBytes(maxSizeBytes),
+        mHead(0),
+        mSpilledBytes(0),
+        mRunning(false)
+    {
+        mFile = fopen(path.c_str(), "wb+");
+
+        if(!mFile) {
+            logger::log("Failed to create spill ring " + path);
+            return;
+        }
+
+        // Reserve the full extent up front so spilling never grows the file
+        // while recording is in flight
+        if(maxSizeBytes > 0) {
+            const uint8_t zero = 0;
+
+            if(FSEEK(mFile, static_cast<int64_t>(maxSizeBytes) - 1, SEEK_SET) != 0 ||
+               fwrite(&zero, 1, 1, mFile) != 1)
+            {
+                logger::log("Failed to preallocate spill ring " + path);
+
+                fclose(mFile);
+                mFile = nullptr;
+
+                return;
+            }
+        }
+
+        mRunning = true;
+        mSpillThread = std::unique_ptr<std::thread>(new std::thread(&RawBufferSpill::doSpill, this));
+    }
+
+    RawBufferSpill::~RawBufferSpill() {
+        mRunning = false;
+
+        if(mSpillThread)
+            mSpillThread->join();
+
+        // Return any buffers that never made it to disk
+        std::shared_ptr<RawImageBuffer> buffer;
+
+        while(mPendingBuffers.try_dequeue(buffer))
+            RawBufferManager::get().discardBuffer(buffer);
+
+        if(mFile)
+            fclose(mFile);
+    }
+
+    bool RawBufferSpill::isValid() const {
+        return mFile != nullptr;
+    }
+
+    void RawBufferSpill::add(const std::shared_ptr<RawImageBuffer>& buffer) {
+        if(!mRunning) {
+            RawBufferManager::get().discardBuffer(buffer);
+            return;
+        }
+
+        mPendingBuffers.enqueue(buffer);
+    }
+
+    void RawBufferSpill::doSpill() {
+        while(mRunning) {
+            std::shared_ptr<RawImageBuffer> buffer;
+
+            if(!mPendingBuffers.wait_dequeue_timed(buffer, std::chrono::milliseconds(100)))
+                continue;
+
+            // Compress in place before writing. The buffer is being recycled,
+            // so clobbering its contents is fine.
+            if(!buffer->isCompressed) {
+                auto data = buffer->data->lock(true);
+                size_t end = 0;
+
+                if(buffer->pixelFormat == PixelFormat::RAW10) {
+                    end = encoder::encode(data, encoder::ANDROID_RAW10, 0, buffer->width, 0, buffer->height, buffer->rowStride);
+                }
+                else if(buffer->pixelFormat == PixelFormat::RAW12) {
+                    end = encoder::encode(data, encoder::ANDROID_RAW12, 0, buffer->width, 0, buffer->height, buffer->rowStride);
+                }
+                else if(buffer->pixelFormat == PixelFormat::RAW16) {
+                    end = encoder::encode(data, encoder::ANDROID_RAW16, 0, buffer->width, 0, buffer->height, buffer->rowStride);
+                }
+
+                buffer->data->unlock();
+
+                if(end == 0) {
+                    // Not supported, drop the frame
+                    RawBufferManager::get().discardBuffer(buffer);
+                    continue;
+                }
+
+                buffer->pixelFormat = PixelFormat::RAW16;
+                buffer->rowStride = 2 * buffer->width;
+                buffer->isCompressed = true;
+                buffer->compressionType = CompressionType::MOTIONCAM;
+
+                buffer->data->setValidRange(0, end);
+            }
+
+            writeFrame(buffer);
+
+            // Hand the backing memory back to the capture pool
+            RawBufferManager::get().discardBuffer(buffer);
+        }
+    }
+
+    void RawBufferSpill::writeFrame(const std::shared_ptr<RawImageBuffer>& buffer) {
+        size_t start, end;
+        buffer->data->getValidRange(start, end);
+
+        const size_t size = end - start;
+
+        if(size == 0 || size > mMaxSizeBytes)
+            return;
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if(mHead + static_cast<int64_t>(size) > static_cast<int64_t>(mMaxSizeBytes))
+            mHead = 0;
+
+        // Drop the oldest frames this write overlaps
+        while(!mFrames.empty()) {
+            const auto& oldest = mFrames.front();
+
+            if(oldest.offset < mHead + static_cast<int64_t>(size) &&
+               oldest.offset + static_cast<int64_t>(oldest.size) > mHead)
+            {
+                mSpilledBytes -= oldest.size;
+                mFrames.pop_front();
+            }
+            else
+                break;
+        }
+
+        if(FSEEK(mFile, mHead, SEEK_SET) != 0)
+            return;
+
+        auto data = buffer->data->lock(false);
+        const size_t written = fwrite(data + start, 1, size, mFile);
+        buffer->data->unlock();
+
+        if(written != size) {
+            logger::log("Failed to spill frame");
+            return;
+        }
+
+        SpilledFrame frame;
+
+        frame.offset            = mHead;
+        frame.size              = size;
+        frame.metadata          = buffer->metadata;
+        frame.pixelFormat       = buffer->pixelFormat;
+        frame.width             = buffer->width;
+        frame.height            = buffer->height;
+        frame.originalWidth     = buffer->originalWidth;
+        frame.originalHeight    = buffer->originalHeight;
+        frame.isBinned          = buffer->isBinned;
+        frame.rowStride         = buffer->rowStride;
+        frame.compressionType   = buffer->compressionType;
+
+        mFrames.push_back(frame);
+
+        mHead += static_cast<int64_t>(size);
+        mSpilledBytes += size;
+    }
+
+    std::shared_ptr<RawImageBuffer> RawBufferSpill::readFrame(const SpilledFrame& frame) {
+        if(FSEEK(mFile, frame.offset, SEEK_SET) != 0)
+            return nullptr;
+
+        auto image = std::make_shared<RawImageBuffer>(
+            std::unique_ptr<NativeBuffer>(new NativeHostBuffer(frame.size)));
+
+        auto data = image->data->lock(true);
+        const size_t read = fread(data, 1, frame.size, mFile);
+        image->data->unlock();
+
+        if(read != frame.size)
+            return nullptr;
+
+        image->data->setValidRange(0, frame.size);
+
+        image->metadata         = frame.metadata;
+        image->pixelFormat      = frame.pixelFormat;
+        image->width            = frame.width;
+        image->height           = frame.height;
+        image->originalWidth    = frame.originalWidth;
+        image->originalHeight   = frame.originalHeight;
+        image->isBinned         = frame.isBinned;
+        image->rowStride        = frame.rowStride;
+        image->isCompressed     = true;
+        image->compressionType  = frame.compressionType;
+
+        return image;
+    }
+
+    std::shared_ptr<RawImageBuffer> RawBufferSpill::rehydrate(const int64_t timestampNs) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto it = std::find_if(
+            mFrames.begin(), mFrames.end(),
+            [&](const SpilledFrame& x) { return x.metadata.timestampNs == timestampNs; });
+
+        if(it == mFrames.end())
+            return nullptr;
+
+        auto image = readFrame(*it);
+
+        mSpilledBytes -= it->size;
+        mFrames.erase(it);
+
+        return image;
+    }
+
+    std::vector<std::shared_ptr<RawImageBuffer>> RawBufferSpill::rehydrateAll() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        std::vector<std::shared_ptr<RawImageBuffer>> images;
+
+        for(const auto& frame : mFrames) {
+            auto image = readFrame(frame);
+
+            if(image)
+                images.push_back(image);
+        }
+
+        mFrames.clear();
+        mSpilledBytes = 0;
+
+        return images;
+    }
+
+    void RawBufferSpill::clear() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mFrames.clear();
+        mHead = 0;
+        mSpilledBytes = 0;
+    }
+
+    int RawBufferSpill::numSpilledFrames() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return static_cast<int>(mFrames.size());
+    }
+
+    size_t RawBufferSpill::spilledBytes() {
+        return mSpilledBytes;
+    }
+}
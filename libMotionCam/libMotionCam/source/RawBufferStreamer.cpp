@@ -8,27 +8,139 @@
 #include "motioncam/RawImageBuffer.h"
 #include "motioncam/RawCameraMetadata.h"
 #include "motioncam/RawEncoder.h"
+#include "motioncam/Color.h"
+#include "motioncam/ThreadTopology.h"
 
 #include <tinywav.h>
+#include <cstring>
 #include <memory>
 
 #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
     #include <unistd.h>
+    #include <sys/socket.h>
+    #include <cerrno>
+#endif
+
+#ifndef MSG_NOSIGNAL
+    #define MSG_NOSIGNAL 0
 #endif
 
 namespace motioncam {
     const int SoundSampleRateHz       = 48000;
     const int SoundChannelCount       = 2;
 
+    // How often the audio flush thread drains captured samples into the
+    // side wav. Half a second of 48 kHz stereo is ~96KB, so each flush is
+    // one large write.
+    const int AudioFlushIntervalMs    = 500;
+
+    // Network sink tuning. Small records are coalesced into batches of this
+    // size before hitting the socket
+    const size_t NetworkBatchBytes      = 1 * 1024 * 1024;
+
+    // Frames divert to local storage once this many bytes are queued behind
+    // the socket
+    const size_t NetworkSendBudgetBytes = 64 * 1024 * 1024;
+
+    // Frames move between the process and IO threads in batches of up to
+    // this many, amortizing queue synchronization at high frame rates
+    const size_t StreamBatchSize        = 8;
+
+    // Adaptive compression watermarks. When the unprocessed queue backs up
+    // past the high watermark the encoder can't keep up with the sensor, so
+    // the process threads switch to passing frames through uncompressed -
+    // larger files, but no dropped frames - and resume compressing once the
+    // queue drains below the low watermark. Passthrough only helps while
+    // the writers keep up, so it is skipped when the IO queues are just as
+    // deep.
+    const size_t CompressHighWatermark  = 24;
+    const size_t CompressLowWatermark   = 8;
+
+    // Writes slower than this are considered stalled and reported by the watchdog
+    const int64_t WriteStallThresholdMs = 1000;
+    const int WatchdogIntervalMs        = 250;
+
+    // Width of the thumbnail embedded into the container for gallery listing
+    const int ThumbnailWidth            = 256;
+
+    // Storage probe tuning. Each chunk is written and synced before the
+    // next so the page cache can't absorb the probe; the whole probe is a
+    // few tens of milliseconds on internal storage.
+    const size_t ProbeChunkBytes        = 2 * 1024 * 1024;
+    const int ProbeNumChunks            = 8;
+
+    // Auto-tune thresholds. Slow removable media degrades under concurrent
+    // writers and prefers fewer, larger writes; fast internal storage
+    // overlaps segments without penalty.
+    const float SlowStorageMBps         = 100.0f;
+    const float MidStorageMBps          = 400.0f;
+
+    IoStreamStats::IoStreamStats(const int fd) :
+        fd(fd),
+        maxLatencyUs(0),
+        writeStartTimeMs(0),
+        writtenFrames(0),
+        writtenBytes(0),
+        numWrites(0),
+        totalLatencyUs(0)
+    {
+        for(int i = 0; i < NUM_LATENCY_BUCKETS; i++)
+            latencyBuckets[i] = 0;
+    }
+
+    IoLane::IoLane() :
+        queuedBytes(0)
+    {
+    }
+
+    void IoStreamStats::recordWrite(const int64_t latencyUs) {
+        int bucket = 0;
+
+        while( (1LL << (bucket + 1)) <= latencyUs && bucket < NUM_LATENCY_BUCKETS - 1 )
+            ++bucket;
+
+        latencyBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+        numWrites.fetch_add(1, std::memory_order_relaxed);
+        totalLatencyUs.fetch_add(latencyUs, std::memory_order_relaxed);
+
+        uint64_t prevMax = maxLatencyUs.load(std::memory_order_relaxed);
+        while(static_cast<uint64_t>(latencyUs) > prevMax &&
+              !maxLatencyUs.compare_exchange_weak(prevMax, latencyUs, std::memory_order_relaxed))
+        {
+        }
+    }
+
     RawBufferStreamer::RawBufferStreamer() :
         mRunning(false),
         mAudioFd(-1),
+        mHaveAudio(false),
+        mAudioReady(false),
+        mPendingAudioSampleRate(0),
+        mPendingAudioChannels(0),
         mCropHeight(0),
         mCropWidth(0),
         mBin(false),
+        mStorageAutoTune(false),
+        mIoBatchSize(StreamBatchSize),
         mWrittenFrames(0),
         mAcceptedFrames(0),
-        mWrittenBytes(0)
+        mWrittenBytes(0),
+        mMaxUnprocessedQueueDepth(0),
+        mMaxReadyQueueDepth(0),
+        mProcessTimeUs(0),
+        mProcessedFrames(0),
+        mPassthroughMode(false),
+        mHaveThumbnail(false),
+        mOutputWidth(0),
+        mOutputHeight(0),
+        mSocketFd(-1),
+        mHaveFallback(false),
+        mNetworkMode(false),
+        mNetworkFailed(false),
+        mNetworkDone(false),
+        mFallbackFrames(0),
+        mNetworkQueuedBytes(0)
     {
     }
 
@@ -40,32 +152,154 @@ namespace motioncam {
                                   const int& audioFd,
                                   const std::shared_ptr<AudioInterface>& audioInterface,
                                   const int numThreads,
-                                  const RawCameraMetadata& cameraMetadata) {
+                                  const std::shared_ptr<const RawCameraMetadata>& cameraMetadata) {
         stop();
-        
-        if(fds.empty()) {
-            logger::log("No file descriptors found");
+
+        mNetworkMode = false;
+
+        startImpl(fds, audioFd, audioInterface, numThreads, cameraMetadata);
+    }
+
+    void RawBufferStreamer::startNetworkStream(const int socketFd,
+                                               const std::vector<int>& fallbackFds,
+                                               const int& audioFd,
+                                               const std::shared_ptr<AudioInterface>& audioInterface,
+                                               const int numThreads,
+                                               const std::shared_ptr<const RawCameraMetadata>& cameraMetadata) {
+        stop();
+
+        if(socketFd < 0) {
+            LOG_INFO("Invalid socket, recording to local storage");
+
+            mNetworkMode = false;
+            startImpl(fallbackFds, audioFd, audioInterface, numThreads, cameraMetadata);
+
             return;
         }
-        
+
+        mNetworkMode = true;
+        mNetworkFailed = false;
+        mNetworkDone = false;
+        mNetworkQueuedBytes = 0;
+        mFallbackFrames = 0;
+        mSocketFd = socketFd;
+
+        startImpl(fallbackFds, audioFd, audioInterface, numThreads, cameraMetadata);
+    }
+
+    void RawBufferStreamer::startImpl(const std::vector<int>& fds,
+                                      const int& audioFd,
+                                      const std::shared_ptr<AudioInterface>& audioInterface,
+                                      const int numThreads,
+                                      const std::shared_ptr<const RawCameraMetadata>& cameraMetadata) {
+        if(fds.empty() && !mNetworkMode) {
+            LOG_INFO("No file descriptors found");
+            return;
+        }
+
+        mHaveFallback = !fds.empty();
         mRunning = true;
         mWrittenFrames = 0;
         mWrittenBytes = 0;
         mAcceptedFrames = 0;
-        
-        // Start audio interface
-        if(audioInterface && audioFd >= 0) {
+        mMaxUnprocessedQueueDepth = 0;
+        mMaxReadyQueueDepth = 0;
+        mProcessTimeUs = 0;
+        mProcessedFrames = 0;
+        mPassthroughMode = false;
+        mIoStats.clear();
+
+        // Every thread shares the same immutable snapshot instead of taking
+        // its own copy of the metadata
+        mCameraMetadata = cameraMetadata;
+        mHaveThumbnail = false;
+        mThumbnailJpeg.clear();
+        mOutputWidth = 0;
+        mOutputHeight = 0;
+
+        // Start audio interface. The samples are muxed into the container on
+        // stop(); the wav fd is optional and only kept as a side copy.
+        mHaveAudio = false;
+        mAudioReady = false;
+        mPendingAudioSamples.clear();
+
+        if(audioInterface) {
             mAudioInterface = audioInterface;
             mAudioFd = audioFd;
-            
+            mHaveAudio = true;
+
             mAudioInterface->start(SoundSampleRateHz, SoundChannelCount);
+
+            // The side wav is written by its own thread in large chunks so
+            // audio writes never interleave into the video write stream
+            if(mAudioFd >= 0) {
+                mAudioFlushThread = std::unique_ptr<std::thread>(
+                    new std::thread(&RawBufferStreamer::doAudioFlush, this, mAudioFd));
+
+            #if defined(__ANDROID__) || defined(__linux__)
+                // Lowest priority; a flush that gets starved just catches up
+                // on the next one
+                sched_param audioPriority{};
+                pthread_setschedparam(mAudioFlushThread->native_handle(), SCHED_IDLE, &audioPriority);
+            #endif
+            }
         }
 
         mStartTime = std::chrono::steady_clock::now();
-        
+
+        // Size the IO side to the storage when asked to. Slow removable
+        // media drops to a single segment with bigger coalesced writes;
+        // fast internal storage keeps every segment the caller provided.
+        std::vector<int> ioFds = fds;
+        mIoBatchSize = StreamBatchSize;
+
+        if(mStorageAutoTune && !ioFds.empty() && !mNetworkMode) {
+            StorageProfile profile{};
+
+            if(probeStorage(ioFds[0], profile)) {
+                size_t segments = ioFds.size();
+
+                if(profile.sequentialMBps < SlowStorageMBps) {
+                    segments = 1;
+                    mIoBatchSize = 4 * StreamBatchSize;
+                }
+                else if(profile.sequentialMBps < MidStorageMBps) {
+                    segments = 2;
+                    mIoBatchSize = 2 * StreamBatchSize;
+                }
+
+                if(segments < ioFds.size()) {
+                #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+                    for(size_t i = segments; i < ioFds.size(); i++)
+                        close(ioFds[i]);
+                #endif
+
+                    ioFds.resize(segments);
+                }
+
+                LOG_INFO("Storage probe: " + std::to_string(profile.sequentialMBps) + " MB/s, max latency " +
+                         std::to_string(profile.maxWriteLatencyMs) + " ms, using " + std::to_string(ioFds.size()) +
+                         " segment(s), batch size " + std::to_string(mIoBatchSize));
+            }
+        }
+
+        // One dispatch lane per segment. Network mode has none; there the
+        // ready queue feeds the network thread and the local containers
+        // only receive diverted frames.
+        mIoLanes.clear();
+
+        if(!mNetworkMode) {
+            for(size_t i = 0; i < ioFds.size(); i++)
+                mIoLanes.push_back(std::unique_ptr<IoLane>(new IoLane()));
+        }
+
         // Create IO threads with maximum priority
-        for(int i = 0; i < fds.size(); i++) {
-            auto ioThread = std::unique_ptr<std::thread>(new std::thread(&RawBufferStreamer::doStream, this, fds[i], cameraMetadata, (int)fds.size()));
+        for(int i = 0; i < ioFds.size(); i++) {
+            auto stats = std::make_shared<IoStreamStats>(ioFds[i]);
+            mIoStats.push_back(stats);
+
+            // The first segment carries the audio track
+            auto ioThread = std::unique_ptr<std::thread>(new std::thread(&RawBufferStreamer::doStream, this, ioFds[i], cameraMetadata, (int)ioFds.size(), stats, mNetworkMode ? -1 : i, (bool)mNetworkMode, i == 0));
 
         #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
             // Update priority
@@ -81,16 +315,40 @@ namespace motioncam {
         // Create process threads
         int processThreads = (std::max)(numThreads, 1);
 
+        mNumProcessThreads = processThreads;
+
         for(int i = 0; i < processThreads; i++) {
             auto t = std::unique_ptr<std::thread>(new std::thread(&RawBufferStreamer::doProcess, this));
             
             mProcessThreads.push_back(std::move(t));
         }
+
+        // Network sink thread. Shares the per-fd stats so the watchdog
+        // reports stalled sends the same way as stalled local writes
+        if(mNetworkMode) {
+            auto stats = std::make_shared<IoStreamStats>(mSocketFd);
+            mIoStats.push_back(stats);
+
+            mNetworkThread = std::unique_ptr<std::thread>(
+                new std::thread(&RawBufferStreamer::doStreamNetwork, this, mSocketFd, cameraMetadata, stats));
+        }
+
+        // Watchdog for stalled writes
+        mWatchdogThread = std::unique_ptr<std::thread>(new std::thread(&RawBufferStreamer::doWatchdog, this));
     }
 
     void RawBufferStreamer::add(const std::shared_ptr<RawImageBuffer>& frame) {
         mUnprocessedBuffers.enqueue(frame);
         mAcceptedFrames++;
+
+        // Track queue high-water mark
+        size_t depth = mUnprocessedBuffers.size_approx();
+        size_t prevMax = mMaxUnprocessedQueueDepth.load(std::memory_order_relaxed);
+
+        while(depth > prevMax &&
+              !mMaxUnprocessedQueueDepth.compare_exchange_weak(prevMax, depth, std::memory_order_relaxed))
+        {
+        }
     }
 
     void RawBufferStreamer::stop() {
@@ -98,35 +356,29 @@ namespace motioncam {
 
         if(mAudioInterface) {
             mAudioInterface->stop();
-            
-            // Flush to disk
+
+            // Hand the samples to the designated IO thread so they land in
+            // the container next to the frames
             uint32_t numFrames = 0;
             auto& buffer = mAudioInterface->getAudioData(numFrames);
 
-            FILE* audioFile = fdopen(mAudioFd, "w");
-            if(audioFile != nullptr) {
-                TinyWav tw = {nullptr};
-
-                if(tinywav_open_write_f(
-                    &tw,
-                    mAudioInterface->getChannels(),
-                    mAudioInterface->getSampleRate(),
-                    TW_INT16,
-                    TW_INTERLEAVED,
-                    audioFile) == 0)
-                {
-                    tinywav_write_f(&tw, (void*)buffer.data(), (int)(numFrames));
-                }
-                
-                tinywav_close_write(&tw);
-            }
-            else {
-                #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
-                    close(mAudioFd);
-                #endif
-            }
+            const size_t numSamples =
+                (std::min)(buffer.size(), static_cast<size_t>(numFrames) * mAudioInterface->getChannels());
+
+            mPendingAudioSamples.assign(buffer.begin(), buffer.begin() + numSamples);
+            mPendingAudioSampleRate = mAudioInterface->getSampleRate();
+            mPendingAudioChannels = mAudioInterface->getChannels();
         }
-        
+
+        // Unblocks the IO thread waiting to mux the audio and the flush
+        // thread finishing the side wav
+        mAudioReady = true;
+
+        if(mAudioFlushThread) {
+            mAudioFlushThread->join();
+            mAudioFlushThread = nullptr;
+        }
+
         mAudioInterface = nullptr;
         mAudioFd = -1;
 
@@ -139,8 +391,82 @@ namespace motioncam {
         for(auto& thread : mIoThreads) {
             thread->join();
         }
-        
+
         mIoThreads.clear();
+
+        if(mNetworkThread) {
+            mNetworkThread->join();
+            mNetworkThread = nullptr;
+        }
+
+        if(mWatchdogThread) {
+            mWatchdogThread->join();
+            mWatchdogThread = nullptr;
+        }
+    }
+
+    // Writes the side wav from its own low priority thread, draining the
+    // captured samples in large chunks while the recording runs. The
+    // SCHED_FIFO video IO threads never see an audio write, and stop()
+    // doesn't block writing the whole capture in one go.
+    void RawBufferStreamer::doAudioFlush(const int audioFd) {
+        FILE* audioFile = fdopen(audioFd, "w");
+
+        if(audioFile == nullptr) {
+        #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+            close(audioFd);
+        #endif
+            return;
+        }
+
+        const int channels = mAudioInterface->getChannels();
+
+        TinyWav tw = {nullptr};
+
+        if(tinywav_open_write_f(
+            &tw,
+            channels,
+            mAudioInterface->getSampleRate(),
+            TW_INT16,
+            TW_INTERLEAVED,
+            audioFile) != 0)
+        {
+            fclose(audioFile);
+            return;
+        }
+
+        std::vector<int16_t> samples;
+        bool incremental = true;
+
+        while(mRunning) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(AudioFlushIntervalMs));
+
+            if(!mAudioInterface->drainAudioData(samples)) {
+                // The interface only exposes the capture after stop();
+                // fall back to writing the wav in one go below
+                incremental = false;
+                break;
+            }
+
+            if(!samples.empty() && channels > 0)
+                tinywav_write_f(&tw, (void*) samples.data(), (int)(samples.size() / channels));
+        }
+
+        // stop() publishes the final samples before setting mAudioReady
+        while(!mAudioReady)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        if(incremental) {
+            // Catch the tail captured since the last flush
+            if(mAudioInterface->drainAudioData(samples) && !samples.empty() && channels > 0)
+                tinywav_write_f(&tw, (void*) samples.data(), (int)(samples.size() / channels));
+        }
+        else if(!mPendingAudioSamples.empty() && mPendingAudioChannels > 0) {
+            tinywav_write_f(&tw, (void*) mPendingAudioSamples.data(),
+                            (int)(mPendingAudioSamples.size() / mPendingAudioChannels));
+        }
+
+        tinywav_close_write(&tw);
     }
 
     void RawBufferStreamer::setCropAmount(int width, int height) {
@@ -155,8 +481,85 @@ namespace motioncam {
         mBin = bin;
     }
 
+    void RawBufferStreamer::setStorageAutoTune(const bool enabled) {
+        // Only allow changing when not running
+        if(!mRunning) {
+            mStorageAutoTune = enabled;
+        }
+    }
+
+    bool RawBufferStreamer::probeStorage(const int fd, StorageProfile& outProfile) {
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+        if(fd < 0)
+            return false;
+
+        const int64_t startOffset = lseek(fd, 0, SEEK_CUR);
+        if(startOffset < 0)
+            return false;
+
+        std::vector<uint8_t> chunk(ProbeChunkBytes, 0xA5);
+
+        float maxLatencyMs = 0;
+        int64_t totalBytes = 0;
+
+        const auto probeStart = std::chrono::steady_clock::now();
+
+        for(int i = 0; i < ProbeNumChunks; i++) {
+            const auto chunkStart = std::chrono::steady_clock::now();
+
+            size_t written = 0;
+
+            while(written < chunk.size()) {
+                const ssize_t result = write(fd, chunk.data() + written, chunk.size() - written);
+
+                if(result < 0) {
+                    if(errno == EINTR)
+                        continue;
+
+                    ftruncate(fd, startOffset);
+                    lseek(fd, startOffset, SEEK_SET);
+
+                    return false;
+                }
+
+                written += static_cast<size_t>(result);
+            }
+
+        #if defined(__APPLE__)
+            fsync(fd);
+        #else
+            fdatasync(fd);
+        #endif
+
+            const auto chunkEnd = std::chrono::steady_clock::now();
+
+            maxLatencyMs = (std::max)(maxLatencyMs,
+                std::chrono::duration<float, std::milli>(chunkEnd - chunkStart).count());
+
+            totalBytes += static_cast<int64_t>(chunk.size());
+        }
+
+        const float totalSecs =
+            std::chrono::duration<float>(std::chrono::steady_clock::now() - probeStart).count();
+
+        // Remove the probe data and rewind so the recording starts clean
+        if(ftruncate(fd, startOffset) != 0 || lseek(fd, startOffset, SEEK_SET) < 0)
+            return false;
+
+        outProfile.sequentialMBps = (totalBytes / (1024.0f * 1024.0f)) / (std::max)(1e-3f, totalSecs);
+        outProfile.maxWriteLatencyMs = maxLatencyMs;
+
+        return true;
+#else
+        (void) fd;
+        (void) outProfile;
+
+        return false;
+#endif
+    }
+
     void RawBufferStreamer::cropAndBin(RawImageBuffer& buffer) const {
-        //Measure m("cropAndBin");
+        Measure m("cropAndBin");
         
         const int horizontalCrop = static_cast<const int>(4 * (lround(0.5f * (mCropWidth/100.0 * buffer.width)) / 4));
 
@@ -172,24 +575,26 @@ namespace motioncam {
         const int xstart = horizontalCrop;
         const int xend = buffer.width - horizontalCrop;
 
-        auto data = buffer.data->lock(true);
-        size_t end;
+        encoder::PixelFormat encoderFormat;
 
-        if(buffer.pixelFormat == PixelFormat::RAW10) {
-            end = encoder::encodeAndBin(data, encoder::ANDROID_RAW10, xstart, xend, ystart, yend, buffer.rowStride);
-        }
-        else if(buffer.pixelFormat == PixelFormat::RAW12) {
-            end = encoder::encodeAndBin(data, encoder::ANDROID_RAW12, xstart, xend, ystart, yend, buffer.rowStride);
-        }
-        else if(buffer.pixelFormat == PixelFormat::RAW16) {
-            end = encoder::encodeAndBin(data, encoder::ANDROID_RAW16, xstart, xend, ystart, yend, buffer.rowStride);
-        }
+        if(buffer.pixelFormat == PixelFormat::RAW10)
+            encoderFormat = encoder::ANDROID_RAW10;
+        else if(buffer.pixelFormat == PixelFormat::RAW12)
+            encoderFormat = encoder::ANDROID_RAW12;
+        else if(buffer.pixelFormat == PixelFormat::RAW16)
+            encoderFormat = encoder::ANDROID_RAW16;
         else {
             // Not supported
-            buffer.data->unlock();
             return;
         }
 
+        auto data = buffer.data->lock(true);
+
+        bool banded = false;
+
+        const size_t end = encoder::encodeBanded(
+            data, encoderFormat, xstart, xend, ystart, yend, buffer.rowStride, buffer.data->len(), true, banded);
+
         buffer.data->unlock();
 
         buffer.width = croppedWidth / 2;
@@ -197,7 +602,7 @@ namespace motioncam {
         buffer.isBinned = true;
         buffer.pixelFormat = PixelFormat::RAW16;
         buffer.isCompressed = true;
-        buffer.compressionType = CompressionType::MOTIONCAM;
+        buffer.compressionType = banded ? CompressionType::MOTIONCAM_BANDED : CompressionType::MOTIONCAM;
         buffer.rowStride = 2 * buffer.width;
         
         // Update valid range
@@ -205,7 +610,7 @@ namespace motioncam {
     }
 
     void RawBufferStreamer::crop(RawImageBuffer& buffer) const {
-        //Measure m("crop");
+        Measure m("crop");
 
         const int horizontalCrop = static_cast<const int>(4 * (lround(0.5 * (mCropWidth/100.0 * buffer.width)) / 4));
 
@@ -215,31 +620,32 @@ namespace motioncam {
         const int croppedWidth  = static_cast<const int>(buffer.width - horizontalCrop*2);
         const int croppedHeight = static_cast<const int>(buffer.height - verticalCrop*2);
         
-        auto data = buffer.data->lock(true);
-
         const int xstart = horizontalCrop;
         const int xend = buffer.width - xstart;
 
         const int ystart = verticalCrop;
         const int yend = buffer.height - ystart;
-        
-        size_t end = 0;
-        
-        if(buffer.pixelFormat == PixelFormat::RAW10) {
-            end = encoder::encode(data, encoder::ANDROID_RAW10, xstart, xend, ystart, yend, buffer.rowStride);
-        }
-        else if(buffer.pixelFormat == PixelFormat::RAW12) {
-            end = encoder::encode(data, encoder::ANDROID_RAW12, xstart, xend, ystart, yend, buffer.rowStride);
-        }
-        else if(buffer.pixelFormat == PixelFormat::RAW16) {
-            end = encoder::encode(data, encoder::ANDROID_RAW16, xstart, xend, ystart, yend, buffer.rowStride);
-        }
+
+        encoder::PixelFormat encoderFormat;
+
+        if(buffer.pixelFormat == PixelFormat::RAW10)
+            encoderFormat = encoder::ANDROID_RAW10;
+        else if(buffer.pixelFormat == PixelFormat::RAW12)
+            encoderFormat = encoder::ANDROID_RAW12;
+        else if(buffer.pixelFormat == PixelFormat::RAW16)
+            encoderFormat = encoder::ANDROID_RAW16;
         else {
             // Not supported
-            buffer.data->unlock();
             return;
         }
 
+        auto data = buffer.data->lock(true);
+
+        bool banded = false;
+
+        const size_t end = encoder::encodeBanded(
+            data, encoderFormat, xstart, xend, ystart, yend, buffer.rowStride, buffer.data->len(), false, banded);
+
         buffer.data->unlock();
 
         // Update buffer
@@ -249,55 +655,686 @@ namespace motioncam {
         buffer.height = croppedHeight;
         buffer.isCompressed = true;
         buffer.isBinned = false;
-        buffer.compressionType = CompressionType::MOTIONCAM;
+        buffer.compressionType = banded ? CompressionType::MOTIONCAM_BANDED : CompressionType::MOTIONCAM;
 
         buffer.data->setValidRange(0, end);
     }
 
+    bool RawBufferStreamer::cropPassthrough(RawImageBuffer& buffer) const {
+        int bitsPerPixel;
+
+        if(buffer.pixelFormat == PixelFormat::RAW10)
+            bitsPerPixel = 10;
+        else if(buffer.pixelFormat == PixelFormat::RAW12)
+            bitsPerPixel = 12;
+        else if(buffer.pixelFormat == PixelFormat::RAW16)
+            bitsPerPixel = 16;
+        else {
+            // Not supported
+            return false;
+        }
+
+        const int horizontalCrop = static_cast<const int>(4 * (lround(0.5 * (mCropWidth/100.0 * buffer.width)) / 4));
+
+        // Even vertical crop to match bayer pattern
+        const int verticalCrop   = static_cast<const int>(2 * (lround(0.5 * (mCropHeight/100.0 * buffer.height)) / 2));
+
+        const int croppedWidth  = static_cast<const int>(buffer.width - horizontalCrop*2);
+        const int croppedHeight = static_cast<const int>(buffer.height - verticalCrop*2);
+
+        // The horizontal crop is a multiple of 4 pixels, so the packed
+        // RAW10/RAW12 row segments stay byte aligned and rows compact with
+        // a plain copy
+        const size_t xOffsetBytes = (static_cast<size_t>(horizontalCrop) * bitsPerPixel) / 8;
+        const size_t rowBytes     = (static_cast<size_t>(croppedWidth) * bitsPerPixel) / 8;
+
+        auto data = buffer.data->lock(true);
+        uint8_t* dst = data;
+
+        for(int y = verticalCrop; y < verticalCrop + croppedHeight; y++) {
+            const uint8_t* src = data + static_cast<size_t>(y) * buffer.rowStride + xOffsetBytes;
+
+            std::memmove(dst, src, rowBytes);
+            dst += rowBytes;
+        }
+
+        buffer.data->unlock();
+
+        buffer.width = croppedWidth;
+        buffer.height = croppedHeight;
+        buffer.rowStride = static_cast<int>(rowBytes);
+        buffer.isBinned = false;
+        buffer.isCompressed = false;
+        buffer.compressionType = CompressionType::UNCOMPRESSED;
+
+        buffer.data->setValidRange(0, static_cast<size_t>(croppedHeight) * rowBytes);
+
+        return true;
+    }
+
+    void RawBufferStreamer::captureThumbnail(const RawImageBuffer& buffer) const {
+        if(!mCameraMetadata ||
+           (buffer.compressionType != CompressionType::MOTIONCAM &&
+            buffer.compressionType != CompressionType::MOTIONCAM_BANDED))
+        {
+            return;
+        }
+
+        size_t start, end;
+        buffer.data->getValidRange(start, end);
+
+        if(end <= start)
+            return;
+
+        // Decode the frame we just compressed
+        std::vector<uint16_t> rawImage(buffer.width * buffer.height);
+
+        auto* data = buffer.data->lock(false);
+
+        if(buffer.compressionType == CompressionType::MOTIONCAM_BANDED) {
+            if(!encoder::decodeBanded(rawImage.data(), buffer.width, buffer.height, data + start, end - start)) {
+                buffer.data->unlock();
+                return;
+            }
+        }
+        else {
+            encoder::decode(rawImage.data(), buffer.width, buffer.height, data + start, end - start);
+        }
+
+        buffer.data->unlock();
+
+        const float whiteLevel = mCameraMetadata->getWhiteLevel(buffer.metadata);
+        const auto& blackLevel = mCameraMetadata->getBlackLevel(buffer.metadata);
+
+        // Offsets of the red/green/blue samples within the bayer quad
+        int rOffset, g0Offset, g1Offset, bOffset;
+
+        switch(mCameraMetadata->sensorArrangment) {
+            case ColorFilterArrangment::GRBG:
+                g0Offset = 0; rOffset = 1; bOffset = 2; g1Offset = 3;
+                break;
+
+            default:
+            case ColorFilterArrangment::RGGB:
+                rOffset = 0; g0Offset = 1; g1Offset = 2; bOffset = 3;
+                break;
+
+            case ColorFilterArrangment::BGGR:
+                bOffset = 0; g0Offset = 1; g1Offset = 2; rOffset = 3;
+                break;
+
+            case ColorFilterArrangment::GBRG:
+                g0Offset = 0; bOffset = 1; rOffset = 2; g1Offset = 3;
+                break;
+        }
+
+        const float rScale = 1.0f / (std::max)(1e-5f, buffer.metadata.asShot[0]);
+        const float bScale = 1.0f / (std::max)(1e-5f, buffer.metadata.asShot[2]);
+
+        // Decimate bayer quads straight to the thumbnail size
+        const int quadWidth  = buffer.width / 2;
+        const int quadHeight = buffer.height / 2;
+
+        const int skip = (std::max)(1, quadWidth / ThumbnailWidth);
+
+        const int thumbWidth  = quadWidth / skip;
+        const int thumbHeight = quadHeight / skip;
+
+        if(thumbWidth <= 0 || thumbHeight <= 0)
+            return;
+
+        cv::Mat thumbnail(thumbHeight, thumbWidth, CV_8UC3);
+
+        // Encode through the baked sRGB table instead of transcendental
+        // math per pixel
+        const uint8_t* toSRGB8 = color::LinearToSRGB8Table();
+
+        const auto encode = [toSRGB8](const float v) -> uint8_t {
+            const float c = (std::min)(1.0f, (std::max)(0.0f, v));
+            return toSRGB8[static_cast<int>(c * (color::TRANSFER_LUT_SIZE - 1) + 0.5f)];
+        };
+
+        for(int y = 0; y < thumbHeight; y++) {
+            const uint16_t* row0 = rawImage.data() + (2*y*skip) * buffer.width;
+            const uint16_t* row1 = row0 + buffer.width;
+            const uint16_t* rows[2] = { row0, row1 };
+
+            uint8_t* dst = thumbnail.ptr<uint8_t>(y);
+
+            for(int x = 0; x < thumbWidth; x++) {
+                float p[4];
+
+                for(int c = 0; c < 4; c++) {
+                    const int dy = c / 2;
+                    const int dx = c % 2;
+
+                    p[c] = (rows[dy][2*x*skip + dx] - blackLevel[c]) / (whiteLevel - blackLevel[c]);
+                }
+
+                const float r = rScale * p[rOffset];
+                const float g = 0.5f * (p[g0Offset] + p[g1Offset]);
+                const float b = bScale * p[bOffset];
+
+                dst[x*3 + 0] = encode(b);
+                dst[x*3 + 1] = encode(g);
+                dst[x*3 + 2] = encode(r);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mThumbnailMutex);
+
+        cv::imencode(".jpg", thumbnail, mThumbnailJpeg, { cv::IMWRITE_JPEG_QUALITY, 90 });
+    }
+
     void RawBufferStreamer::processBuffer(const std::shared_ptr<RawImageBuffer>& buffer) const {
+        // While compression is behind, frames pass through uncompressed
+        // instead of piling up until they drop. Binned recordings always
+        // encode; binning is what produces their output geometry.
         if(mBin)
             cropAndBin(*buffer);
+        else if(mPassthroughMode.load(std::memory_order_relaxed)) {
+            if(!cropPassthrough(*buffer))
+                crop(*buffer);
+        }
         else {
             crop(*buffer);
         }
+
+        mOutputWidth = buffer->width;
+        mOutputHeight = buffer->height;
+
+        // Keep a thumbnail of the first processed frame for the gallery
+        if(!mHaveThumbnail.exchange(true))
+            captureThumbnail(*buffer);
     }
 
     void RawBufferStreamer::doProcess() {
-        std::shared_ptr<RawImageBuffer> buffer;
-        
+        std::shared_ptr<RawImageBuffer> buffers[StreamBatchSize];
+        std::vector<std::shared_ptr<RawImageBuffer>> readyBatch;
+
+        readyBatch.reserve(StreamBatchSize);
+
         while(mRunning) {
-            if(!mUnprocessedBuffers.wait_dequeue_timed(buffer, std::chrono::milliseconds(67))) {
+            topology::PinCurrentThread(topology::ThreadClass::COMPUTE);
+
+            // Claim at most an even share of the queue. Bulk claims are
+            // cheap, but a thread that grabs a whole batch of
+            // hard-to-compress frames would sit on them while the other
+            // process threads idle; the per-band encode already spreads
+            // across the task engine, so the claim granularity has to
+            // follow the load instead of the batch size.
+            const size_t depth = mUnprocessedBuffers.size_approx();
+            const size_t share = depth / static_cast<size_t>(mNumProcessThreads);
+            const size_t claim = (std::max)(static_cast<size_t>(1), (std::min)(share, StreamBatchSize));
+
+            const size_t count = mUnprocessedBuffers.wait_dequeue_bulk_timed(
+                buffers, claim, std::chrono::milliseconds(67));
+
+            if(count == 0) {
                 continue;
             }
-            
-            processBuffer(buffer);
-            
-            // Add to the ready list
-            mReadyBuffers.enqueue(buffer);
+
+            // Closed-loop compression control: pass frames through when the
+            // encoder is the bottleneck, never when the writers are
+            const size_t unprocessedDepth = mUnprocessedBuffers.size_approx();
+
+            size_t ioDepth = mReadyBuffers.size_approx();
+
+            for(const auto& lane : mIoLanes)
+                ioDepth += lane->queue.size_approx();
+
+            if(!mPassthroughMode.load(std::memory_order_relaxed)) {
+                if(unprocessedDepth >= CompressHighWatermark && ioDepth < CompressHighWatermark) {
+                    mPassthroughMode = true;
+
+                    LOG_INFO("Compression falling behind (unprocessed=" + std::to_string(unprocessedDepth) +
+                             "), passing frames through uncompressed");
+                }
+            }
+            else if(unprocessedDepth <= CompressLowWatermark || ioDepth >= CompressHighWatermark) {
+                mPassthroughMode = false;
+
+                LOG_INFO("Resuming compression (unprocessed=" + std::to_string(unprocessedDepth) +
+                         ", ready=" + std::to_string(ioDepth) + ")");
+            }
+
+            readyBatch.clear();
+
+            const auto processStart = std::chrono::steady_clock::now();
+
+            for(size_t i = 0; i < count; i++) {
+                auto& buffer = buffers[i];
+
+                processBuffer(buffer);
+
+                // Add to the ready list. In network mode, divert to local
+                // storage when the link is down or too far behind
+                if(mNetworkMode) {
+                    size_t start = 0, end = 0;
+                    buffer->data->getValidRange(start, end);
+
+                    const size_t bytes = end - start;
+
+                    if(!mNetworkFailed &&
+                       mNetworkQueuedBytes.load(std::memory_order_relaxed) + bytes <= NetworkSendBudgetBytes)
+                    {
+                        mNetworkQueuedBytes += bytes;
+                        readyBatch.push_back(buffer);
+                    }
+                    else if(mHaveFallback) {
+                        mFallbackFrames++;
+                        mFallbackBuffers.enqueue(buffer);
+                    }
+                    else {
+                        // No local fallback; dropping is better than stalling the capture
+                        mDroppedFrames++;
+                        RawBufferManager::get().discardBuffer(buffer);
+                    }
+                }
+                else {
+                    readyBatch.push_back(buffer);
+                }
+
+                buffer = nullptr;
+            }
+
+            const auto processEnd = std::chrono::steady_clock::now();
+
+            mProcessTimeUs.fetch_add(
+                std::chrono::duration_cast<std::chrono::microseconds>(processEnd - processStart).count(),
+                std::memory_order_relaxed);
+            mProcessedFrames.fetch_add(count, std::memory_order_relaxed);
+
+            if(!readyBatch.empty()) {
+                if(mIoLanes.empty()) {
+                    mReadyBuffers.enqueue_bulk(readyBatch.begin(), readyBatch.size());
+                }
+                else {
+                    for(const auto& ready : readyBatch)
+                        dispatchFrame(ready);
+                }
+            }
+
+            // Track queue high-water mark
+            size_t depth = mReadyBuffers.size_approx();
+
+            for(const auto& lane : mIoLanes)
+                depth += lane->queue.size_approx();
+            size_t prevMax = mMaxReadyQueueDepth.load(std::memory_order_relaxed);
+
+            while(depth > prevMax &&
+                  !mMaxReadyQueueDepth.compare_exchange_weak(prevMax, depth, std::memory_order_relaxed))
+            {
+            }
         }
 
     }
 
-    void RawBufferStreamer::doStream(const int fd, const RawCameraMetadata& cameraMetadata, const int numContainers) {
+    void RawBufferStreamer::dispatchFrame(const std::shared_ptr<RawImageBuffer>& buffer) {
+        size_t start = 0, end = 0;
+        buffer->data->getValidRange(start, end);
+
+        const size_t frameBytes = end - start;
+
+        // Route to the lane with the least bytes queued or in flight. A
+        // slow segment drains slower, keeps more queued and automatically
+        // receives fewer frames; nothing here blocks on the IO threads.
+        size_t best = 0;
+        size_t bestBytes = mIoLanes[0]->queuedBytes.load(std::memory_order_relaxed);
+
+        for(size_t i = 1; i < mIoLanes.size(); i++) {
+            const size_t queued = mIoLanes[i]->queuedBytes.load(std::memory_order_relaxed);
+
+            if(queued < bestBytes) {
+                bestBytes = queued;
+                best = i;
+            }
+        }
+
+        mIoLanes[best]->queuedBytes += frameBytes;
+        mIoLanes[best]->queue.enqueue(buffer);
+    }
+
+    void RawBufferStreamer::doWatchdog() {
+        while(mRunning) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(WatchdogIntervalMs));
+
+            auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+
+            size_t readyDepth = mReadyBuffers.size_approx();
+
+            for(const auto& lane : mIoLanes)
+                readyDepth += lane->queue.size_approx();
+
+            for(const auto& stats : mIoStats) {
+                int64_t writeStartMs = stats->writeStartTimeMs.load(std::memory_order_relaxed);
+
+                if(writeStartMs > 0 && nowMs - writeStartMs > WriteStallThresholdMs) {
+                    LOG_INFO_EVERY_MS(1000,
+                        "Write stall on fd " + std::to_string(stats->fd) +
+                        " (" + std::to_string(nowMs - writeStartMs) + " ms)" +
+                        ", unprocessed=" + std::to_string(mUnprocessedBuffers.size_approx()) +
+                        ", ready=" + std::to_string(readyDepth));
+                }
+            }
+        }
+    }
+
+    void RawBufferStreamer::doStream(const int fd, const std::shared_ptr<const RawCameraMetadata> cameraMetadata, const int numContainers, const std::shared_ptr<IoStreamStats> stats, const int laneIndex, const bool fallback, const bool muxAudio) {
         std::shared_ptr<RawImageBuffer> buffer;
+        std::vector<std::shared_ptr<RawImageBuffer>> batch;
         size_t start, end;
 
-        auto container = RawContainer::Create(fd, cameraMetadata, numContainers);
+        auto container = RawContainer::Create(fd, *cameraMetadata, numContainers);
+
+        // Fallback containers only receive frames the network sink diverts;
+        // local segments drain their own dispatch lane
+        IoLane* lane = laneIndex >= 0 ? mIoLanes[laneIndex].get() : nullptr;
+
+        auto& queue = fallback ? mFallbackBuffers : (lane ? lane->queue : mReadyBuffers);
 
         while(mRunning) {
-            if(!mReadyBuffers.wait_dequeue_timed(buffer, std::chrono::milliseconds(100))) {
+            topology::PinCurrentThread(topology::ThreadClass::IO);
+
+            batch.resize(mIoBatchSize);
+
+            const size_t count = queue.wait_dequeue_bulk_timed(
+                batch.data(), batch.size(), std::chrono::milliseconds(100));
+
+            if(count == 0) {
+                batch.clear();
                 continue;
             }
 
-            container->add(*buffer, true);
+            batch.resize(count);
+
+            auto writeStart = std::chrono::steady_clock::now();
+
+            stats->writeStartTimeMs =
+                std::chrono::duration_cast<std::chrono::milliseconds>(writeStart.time_since_epoch()).count();
+
+            // One coalesced write for the whole batch
+            container->add(batch, true);
+
+            auto writeEnd = std::chrono::steady_clock::now();
+
+            stats->writeStartTimeMs = 0;
+            stats->recordWrite(std::chrono::duration_cast<std::chrono::microseconds>(writeEnd - writeStart).count());
+
+            size_t writtenBytes = 0;
+
+            for(auto& written : batch) {
+                start = end = 0;
+                written->data->getValidRange(start, end);
+
+                writtenBytes += (end - start);
+
+                // Return the buffer after it has been written
+                RawBufferManager::get().discardBuffer(written);
+            }
+
+            batch.clear();
+
+            // The lane's bytes stay counted until the write commits, so the
+            // dispatcher sees in-flight batches as load
+            if(lane)
+                lane->queuedBytes -= writtenBytes;
+
+            stats->writtenBytes += writtenBytes;
+            stats->writtenFrames += count;
+
+            mWrittenBytes += writtenBytes;
+            mWrittenFrames += static_cast<int>(count);
+        }
+
+        //
+        // Flush buffers
+        //
+
+        if(fallback) {
+            // Keep draining until the network thread has finished handing
+            // over any remaining frames
+            while(!mNetworkDone || mFallbackBuffers.size_approx() > 0) {
+                if(!mFallbackBuffers.wait_dequeue_timed(buffer, std::chrono::milliseconds(10)))
+                    continue;
+
+                container->add(*buffer, true);
+
+                buffer->data->getValidRange(start, end);
+                mWrittenBytes += (end - start);
+                mWrittenFrames++;
+
+                RawBufferManager::get().discardBuffer(buffer);
+            }
+        }
+        else {
+            // This segment's lane
+            while(lane && lane->queue.try_dequeue(buffer)) {
+                container->add(*buffer, true);
+
+                buffer->data->getValidRange(start, end);
+                mWrittenBytes += (end - start);
+                mWrittenFrames++;
+
+                RawBufferManager::get().discardBuffer(buffer);
+            }
+
+            // Ready buffers
+            while(mReadyBuffers.try_dequeue(buffer)) {
+                container->add(*buffer, true);
+
+                buffer->data->getValidRange(start, end);
+                mWrittenBytes += (end - start);
+                mWrittenFrames++;
+
+                RawBufferManager::get().discardBuffer(buffer);
+            }
+
+            // Unprocessed buffers
+            while(mUnprocessedBuffers.try_dequeue(buffer)) {
+                processBuffer(buffer);
 
-            start = end = 0;
+                container->add(*buffer, true);
+
+                buffer->data->getValidRange(start, end);
+                mWrittenBytes += (end - start);
+                mWrittenFrames++;
+
+                RawBufferManager::get().discardBuffer(buffer);
+            }
+        }
+
+        // Mux the audio track after the last frame. stop() publishes the
+        // samples once the audio interface has drained; the chunked write is
+        // a few large sequential writes on the same fd as the frames.
+        if(muxAudio && mHaveAudio) {
+            while(!mAudioReady)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            if(!mPendingAudioSamples.empty()) {
+                container->addAudio(mPendingAudioSamples.data(),
+                                    mPendingAudioSamples.size(),
+                                    mPendingAudioSampleRate,
+                                    mPendingAudioChannels);
+            }
+        }
+
+        // Embed the thumbnail and capture summary so the gallery can list
+        // this file without probing frames
+        {
+            std::lock_guard<std::mutex> lock(mThumbnailMutex);
+
+            container->setSummary(mThumbnailJpeg, mOutputWidth, mOutputHeight, mDroppedFrames);
+        }
+
+        container->commit();
+    }
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+    static bool SendAll(const int socketFd, const void* data, size_t size) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+
+        while(size > 0) {
+            const ssize_t written = send(socketFd, p, size, MSG_NOSIGNAL);
+
+            if(written < 0) {
+                if(errno == EINTR)
+                    continue;
+
+                return false;
+            }
+
+            p += written;
+            size -= written;
+        }
+
+        return true;
+    }
+#endif
+
+    void RawBufferStreamer::doStreamNetwork(const int socketFd, const std::shared_ptr<const RawCameraMetadata> cameraMetadata, const std::shared_ptr<IoStreamStats> stats) {
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+        std::shared_ptr<RawImageBuffer> buffer;
+
+        std::vector<uint8_t> batch;
+        batch.reserve(NetworkBatchBytes);
+
+        auto append = [&batch](const void* data, size_t size) {
+            const uint8_t* p = static_cast<const uint8_t*>(data);
+            batch.insert(batch.end(), p, p + size);
+        };
+
+        auto flush = [&]() -> bool {
+            if(batch.empty())
+                return true;
+
+            const bool ok = SendAll(socketFd, batch.data(), batch.size());
+            batch.clear();
+
+            return ok;
+        };
+
+        // Moves a frame to local storage after a link failure
+        auto divert = [this](const std::shared_ptr<RawImageBuffer>& frame) {
+            if(mHaveFallback) {
+                mFallbackFrames++;
+                mFallbackBuffers.enqueue(frame);
+            }
+            else {
+                mDroppedFrames++;
+                RawBufferManager::get().discardBuffer(frame);
+            }
+        };
+
+        auto sendFrame = [&](const std::shared_ptr<RawImageBuffer>& frame) -> bool {
+            json11::Json::object frameMetadata;
+            frame->toJson(frameMetadata);
+
+            const auto json = json11::Json(frameMetadata).dump();
+
+            size_t start = 0, end = 0;
+            frame->data->getValidRange(start, end);
+
+            NetPacketHeader header {
+                NET_PACKET_MAGIC,
+                NetPacketType::FRAME,
+                static_cast<uint32_t>(json.size()),
+                static_cast<uint32_t>(end - start)
+            };
+
+            append(&header, sizeof(header));
+            append(json.data(), json.size());
+
+            auto* data = frame->data->lock(false);
+            bool ok;
+
+            // Coalesce small records; large payloads go straight from the
+            // frame buffer to skip the copy
+            if(end - start >= NetworkBatchBytes)
+                ok = flush() && SendAll(socketFd, data + start, end - start);
+            else {
+                append(data + start, end - start);
+                ok = batch.size() >= NetworkBatchBytes ? flush() : true;
+            }
+
+            frame->data->unlock();
+
+            return ok;
+        };
+
+        // The stream opens with the camera metadata, like a local container
+        {
+            RawCameraMetadata metadataCopy(*cameraMetadata);
+
+            json11::Json::object metadata;
+            metadataCopy.toJson(metadata);
+
+            const auto json = json11::Json(metadata).dump();
+
+            NetPacketHeader header {
+                NET_PACKET_MAGIC,
+                NetPacketType::CAMERA_METADATA,
+                static_cast<uint32_t>(json.size()),
+                0
+            };
+
+            append(&header, sizeof(header));
+            append(json.data(), json.size());
+        }
+
+        while(mRunning) {
+            topology::PinCurrentThread(topology::ThreadClass::IO);
+
+            if(!mReadyBuffers.wait_dequeue_timed(buffer, std::chrono::milliseconds(100))) {
+                // Don't sit on a partial batch while the capture idles
+                if(!mNetworkFailed && !flush()) {
+                    LOG_INFO("Network sink failed, diverting to local storage");
+                    mNetworkFailed = true;
+                }
+
+                continue;
+            }
+
+            size_t start = 0, end = 0;
             buffer->data->getValidRange(start, end);
 
-            // Return the buffer after it has been written
+            const size_t bytes = end - start;
+
+            if(mNetworkFailed) {
+                mNetworkQueuedBytes -= bytes;
+                divert(buffer);
+                continue;
+            }
+
+            auto writeStart = std::chrono::steady_clock::now();
+
+            stats->writeStartTimeMs =
+                std::chrono::duration_cast<std::chrono::milliseconds>(writeStart.time_since_epoch()).count();
+
+            const bool ok = sendFrame(buffer);
+
+            auto writeEnd = std::chrono::steady_clock::now();
+
+            stats->writeStartTimeMs = 0;
+            mNetworkQueuedBytes -= bytes;
+
+            if(!ok) {
+                LOG_INFO("Network sink failed, diverting to local storage");
+                mNetworkFailed = true;
+
+                divert(buffer);
+                continue;
+            }
+
+            stats->recordWrite(std::chrono::duration_cast<std::chrono::microseconds>(writeEnd - writeStart).count());
+
             RawBufferManager::get().discardBuffer(buffer);
 
-            mWrittenBytes += (end - start);
+            stats->writtenBytes += bytes;
+            stats->writtenFrames++;
+
+            mWrittenBytes += bytes;
             mWrittenFrames++;
         }
 
@@ -305,31 +1342,52 @@ namespace motioncam {
         // Flush buffers
         //
 
-        // Ready buffers
         while(mReadyBuffers.try_dequeue(buffer)) {
-            container->add(*buffer, true);
-            
+            size_t start = 0, end = 0;
             buffer->data->getValidRange(start, end);
-            mWrittenBytes += (end - start);
-            mWrittenFrames++;
+
+            mNetworkQueuedBytes -= (end - start);
+
+            if(mNetworkFailed || !sendFrame(buffer)) {
+                mNetworkFailed = true;
+                divert(buffer);
+                continue;
+            }
 
             RawBufferManager::get().discardBuffer(buffer);
+
+            mWrittenBytes += (end - start);
+            mWrittenFrames++;
         }
 
-        // Unprocessed buffers
         while(mUnprocessedBuffers.try_dequeue(buffer)) {
             processBuffer(buffer);
-            
-            container->add(*buffer, true);
 
+            if(mNetworkFailed || !sendFrame(buffer)) {
+                mNetworkFailed = true;
+                divert(buffer);
+                continue;
+            }
+
+            size_t start = 0, end = 0;
             buffer->data->getValidRange(start, end);
+
+            RawBufferManager::get().discardBuffer(buffer);
+
             mWrittenBytes += (end - start);
             mWrittenFrames++;
+        }
 
-            RawBufferManager::get().discardBuffer(buffer);
+        if(!mNetworkFailed) {
+            NetPacketHeader header { NET_PACKET_MAGIC, NetPacketType::END, 0, 0 };
+
+            append(&header, sizeof(header));
+            flush();
         }
+#endif
 
-        container->commit();
+        // Release the fallback writers
+        mNetworkDone = true;
     }
 
     bool RawBufferStreamer::isRunning() const {
@@ -350,4 +1408,38 @@ namespace motioncam {
     int RawBufferStreamer::droppedFrames() const {
         return mDroppedFrames;
     }
+
+    int RawBufferStreamer::fallbackFrames() const {
+        return mFallbackFrames;
+    }
+
+    const std::vector<std::shared_ptr<IoStreamStats>>& RawBufferStreamer::ioStats() const {
+        return mIoStats;
+    }
+
+    size_t RawBufferStreamer::maxUnprocessedQueueDepth() const {
+        return mMaxUnprocessedQueueDepth;
+    }
+
+    size_t RawBufferStreamer::maxReadyQueueDepth() const {
+        return mMaxReadyQueueDepth;
+    }
+
+    size_t RawBufferStreamer::unprocessedQueueDepth() const {
+        return mUnprocessedBuffers.size_approx();
+    }
+
+    size_t RawBufferStreamer::readyQueueDepth() const {
+        size_t depth = mReadyBuffers.size_approx();
+
+        for(const auto& lane : mIoLanes)
+            depth += lane->queue.size_approx();
+
+        return depth;
+    }
+
+    void RawBufferStreamer::processStats(uint64_t& outTotalTimeUs, uint64_t& outFrames) const {
+        outTotalTimeUs = mProcessTimeUs.load(std::memory_order_relaxed);
+        outFrames = mProcessedFrames.load(std::memory_order_relaxed);
+    }
 }
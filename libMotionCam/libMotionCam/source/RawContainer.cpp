@@ -5,6 +5,72 @@
 #include "motioncam/Exceptions.h"
 
 namespace motioncam {
+    std::shared_ptr<RawImageBuffer> RawContainer::tryLoadFrame(const std::string& frame, std::string& outError) noexcept {
+        try {
+            return loadFrame(frame);
+        }
+        catch(std::exception& e) {
+            outError = e.what();
+            return nullptr;
+        }
+    }
+
+    std::unique_ptr<RawContainerReader> RawContainer::createReader() {
+        return nullptr;
+    }
+
+    size_t RawContainer::getFrameCount() const {
+        return getFrames().size();
+    }
+
+    int64_t RawContainer::getFrameTimestamp(const size_t index) const {
+        const auto frames = getFrames();
+        if(index >= frames.size())
+            return 0;
+
+        return getFrameTimestamp(frames[index]);
+    }
+
+    std::shared_ptr<RawImageBuffer> RawContainer::loadFrame(const size_t index) {
+        const auto frames = getFrames();
+        if(index >= frames.size())
+            return nullptr;
+
+        return loadFrame(frames[index]);
+    }
+
+    size_t RawContainer::seekFrameIndex(const int64_t timestampNs) const {
+        const size_t count = getFrameCount();
+        if(count == 0)
+            return 0;
+
+        size_t lo = 0;
+        size_t hi = count;
+
+        while(lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+
+            if(getFrameTimestamp(mid) < timestampNs)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        // lo is the first frame at or past the target; its predecessor can
+        // still be the closer one
+        if(lo == count)
+            return count - 1;
+
+        if(lo > 0 && timestampNs - getFrameTimestamp(lo - 1) <= getFrameTimestamp(lo) - timestampNs)
+            return lo - 1;
+
+        return lo;
+    }
+
+    void RawContainer::addShared(const std::vector<std::shared_ptr<RawImageBuffer>>& buffers) {
+        add(buffers, false);
+    }
+
     std::unique_ptr<RawContainer> determineContainerType(FILE* file) {
         Header header;
         
@@ -23,7 +89,7 @@ namespace motioncam {
         rewind(file);
         
         // Current version of container
-        if(header.version == CONTAINER_VERSION) {
+        if(header.version >= CONTAINER_MIN_VERSION && header.version <= CONTAINER_VERSION) {
             return std::unique_ptr<RawContainerImpl>(new RawContainerImpl(file));
         }
         // Legacy container
@@ -4,9 +4,15 @@
 #include "motioncam/Exceptions.h"
 #include "motioncam/Util.h"
 #include "motioncam/RawEncoder.h"
+#include "motioncam/Measure.h"
 
+#include <atomic>
+#include <cstring>
+#include <limits>
 #include <utility>
 
+#include <zstd.h>
+
 #define _FILE_OFFSET_BITS 64
 
 #if defined(_WIN32)
@@ -17,7 +23,314 @@
     #define FTELL ftello
 #endif
 
+#if defined(__ANDROID__) || defined(__linux__)
+    #include <fcntl.h>
+#endif
+
+#if !defined(_WIN32)
+    #include <unistd.h>
+    #include <sys/uio.h>
+    #include <sys/mman.h>
+    #include <cerrno>
+#endif
+
+#if defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+#elif defined(__SSE4_2__)
+    #include <nmmintrin.h>
+#endif
+
 namespace motioncam {
+    // Number of index entries per page and maximum number of cached pages.
+    // Bounds open time and index memory for very long takes.
+    static const size_t INDEX_PAGE_SIZE = 4096;
+    static const size_t MAX_CACHED_INDEX_PAGES = 64;
+
+    // How far ahead of the read cursor to request readahead
+    static const int64_t READAHEAD_WINDOW = 8 * 1024 * 1024;
+
+    // Interleaved audio is chunked into items of roughly this size so the
+    // audio flush is a few large sequential writes
+    static const size_t AUDIO_CHUNK_BYTES = 256 * 1024;
+
+    // Upper bound on a metadata dictionary loaded from a pre version 6
+    // container, used to reject corrupted size fields
+    static const size_t METADATA_DICT_MAX_BYTES = 8 * 1024;
+
+    // Upper bound on a single uncompressed metadata item, used to reject
+    // corrupted size fields before allocating
+    static const uint64_t MAX_METADATA_BYTES = 16 * 1024 * 1024;
+
+    // A cumulative copy of the frame index is checkpointed into the stream
+    // each time this many bytes go by, bounding how much of an interrupted
+    // recording attemptToRecover() has to scan
+    static const int64_t CHECKPOINT_INTERVAL_BYTES = 64 * 1024 * 1024;
+
+    // Bound on decoded frames held by the prefetcher. Consumers take
+    // entries as they go, so in steady state the map holds at most one
+    // prefetch window.
+    static const size_t MAX_PREFETCHED_FRAMES = 16;
+
+    // Reader sessions a prefetch window is fanned out across. More than a
+    // few and the sessions fight over the same storage bandwidth.
+    static const size_t MAX_PREFETCH_READERS = 4;
+
+    // Upper bound on the entries of an index checkpoint, used to reject
+    // payload bytes that happen to look like one
+    static const uint32_t CHECKPOINT_MAX_OFFSETS = 1000000;
+
+    // Staging buffer for direct I/O streaming. Writes accumulate here and
+    // are flushed to the descriptor in aligned blocks.
+    static const size_t DIRECT_IO_STAGING_BYTES = 4 * 1024 * 1024;
+
+    // Opt-in direct I/O for streamed recordings, set by the app layer.
+    // Off by default.
+    static std::atomic<bool> gUseDirectIo(false);
+
+    // Upper bound on a single uncompressed proxy frame, used to reject
+    // corrupted headers before allocating
+    static const uint64_t MAX_PROXY_BYTES = 64 * 1024 * 1024;
+
+    // Scalar IEEE 754 half conversions for the packed shading map records.
+    // Shading map grids are tiny (hundreds of points) so there is nothing to
+    // gain from vectorising these.
+    static uint16_t FloatToHalf(const float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        const uint32_t sign = (bits >> 16) & 0x8000;
+        int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+        uint32_t mantissa = bits & 0x007FFFFF;
+
+        // Flush underflows to zero; shading map gains are small positive
+        // values so precision below half range doesn't matter
+        if(exponent <= 0)
+            return static_cast<uint16_t>(sign);
+
+        // Round to nearest
+        mantissa += 0x00001000;
+        if(mantissa & 0x00800000) {
+            mantissa = 0;
+            ++exponent;
+        }
+
+        // Overflow/Inf/NaN saturate to the largest half
+        if(exponent >= 31)
+            return static_cast<uint16_t>(sign | 0x7BFF);
+
+        return static_cast<uint16_t>(sign | (exponent << 10) | (mantissa >> 13));
+    }
+
+    static float HalfToFloat(const uint16_t value) {
+        const uint32_t sign = (value & 0x8000) << 16;
+        const uint32_t exponent = (value >> 10) & 0x1F;
+        const uint32_t mantissa = value & 0x03FF;
+
+        uint32_t bits;
+
+        if(exponent == 0) {
+            // Denormals were flushed on write
+            bits = sign;
+        }
+        else if(exponent == 31) {
+            bits = sign | 0x7F800000 | (mantissa << 13);
+        }
+        else {
+            bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+        }
+
+        float result;
+        std::memcpy(&result, &bits, sizeof(result));
+
+        return result;
+    }
+
+    // CRC32C (Castagnoli) over a frame payload. Uses the dedicated CPU
+    // instructions where the target has them; at hardware CRC throughput the
+    // checksum is a negligible fraction of the payload write itself.
+    static uint32_t Crc32c(const uint8_t* data, size_t size) {
+        uint32_t crc = 0xFFFFFFFF;
+
+#if defined(__ARM_FEATURE_CRC32) || defined(__SSE4_2__)
+        while(size >= 8) {
+            uint64_t v;
+            std::memcpy(&v, data, sizeof(v));
+
+    #if defined(__ARM_FEATURE_CRC32)
+            crc = __crc32cd(crc, v);
+    #else
+            crc = static_cast<uint32_t>(_mm_crc32_u64(crc, v));
+    #endif
+
+            data += 8;
+            size -= 8;
+        }
+
+        while(size > 0) {
+    #if defined(__ARM_FEATURE_CRC32)
+            crc = __crc32cb(crc, *data++);
+    #else
+            crc = _mm_crc32_u8(crc, *data++);
+    #endif
+            --size;
+        }
+#else
+        // Table fallback for targets without hardware CRC
+        static uint32_t table[256];
+        static bool tableInitialized = false;
+
+        if(!tableInitialized) {
+            for(uint32_t i = 0; i < 256; i++) {
+                uint32_t c = i;
+
+                for(int k = 0; k < 8; k++)
+                    c = (c & 1) ? (c >> 1) ^ 0x82F63B78 : c >> 1;
+
+                table[i] = c;
+            }
+
+            tableInitialized = true;
+        }
+
+        while(size > 0) {
+            crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+            --size;
+        }
+#endif
+
+        return crc ^ 0xFFFFFFFF;
+    }
+
+    // Crop the per-frame shading map to the buffer, substituting an identity
+    // map when the frame was written without one
+    static void FinalizeShadingMap(const std::shared_ptr<RawImageBuffer>& buffer) {
+        auto shadingMap = buffer->metadata.shadingMap();
+
+        if(shadingMap.empty()) {
+            std::vector<cv::Mat> emptyShadingMap;
+            cv::Mat m(24, 18, CV_32F, cv::Scalar(1.0f));
+
+            for(int i = 0; i < 4; i++)
+                emptyShadingMap.push_back(m.clone());
+
+            buffer->metadata.updateShadingMap(emptyShadingMap);
+        }
+        else {
+            util::CropShadingMap(shadingMap,
+                                 buffer->width,
+                                 buffer->height,
+                                 buffer->originalWidth,
+                                 buffer->originalHeight,
+                                 buffer->isBinned);
+
+            buffer->metadata.updateShadingMap(shadingMap);
+        }
+    }
+
+    // Copies a 3x3 CV_32F matrix into a record slot, returning the presence
+    // bit to set, or 0 when the matrix is absent
+    static uint32_t PackMatrix(float* dst, const cv::Mat& m, const uint32_t presenceBit) {
+        if(m.empty())
+            return 0;
+
+        std::memcpy(dst, m.ptr<float>(0), 9 * sizeof(float));
+
+        return presenceBit;
+    }
+
+    static cv::Mat UnpackMatrix(const float* src) {
+        cv::Mat m(3, 3, CV_32F);
+
+        std::memcpy(m.ptr<float>(0), src, 9 * sizeof(float));
+
+        return m;
+    }
+
+    // Packs the per-frame metadata into the fixed binary record written as a
+    // METADATA_BIN item (version 6 onwards)
+    static void BuildFrameMetadataRecord(const RawImageBuffer& buffer, FrameMetadataRecord& record) {
+        record.timestamp            = buffer.metadata.timestampNs;
+        record.offset               = buffer.offset;
+        record.exposureTime         = buffer.metadata.exposureTime;
+        record.iso                  = buffer.metadata.iso;
+        record.exposureCompensation = buffer.metadata.exposureCompensation;
+        record.orientation          = static_cast<int32_t>(buffer.metadata.screenOrientation);
+        record.width                = buffer.width;
+        record.height               = buffer.height;
+        record.originalWidth        = buffer.originalWidth;
+        record.originalHeight       = buffer.originalHeight;
+        record.rowStride            = buffer.rowStride;
+        record.pixelFormat          = static_cast<uint32_t>(buffer.pixelFormat);
+        record.compressionType      = static_cast<uint32_t>(buffer.compressionType);
+        record.isBinned             = buffer.isBinned ? 1 : 0;
+        record.isCompressed         = buffer.isCompressed ? 1 : 0;
+
+        for(int i = 0; i < 3; i++)
+            record.asShot[i] = buffer.metadata.asShot[i];
+
+        record.dynamicWhiteLevel = buffer.metadata.dynamicWhiteLevel;
+
+        if(buffer.metadata.dynamicBlackLevel.size() == 4) {
+            record.flags |= FRAME_METADATA_HAS_DYNAMIC_BLACK_LEVEL;
+
+            for(int c = 0; c < 4; c++)
+                record.dynamicBlackLevel[c] = buffer.metadata.dynamicBlackLevel[c];
+        }
+
+        record.flags |= PackMatrix(record.matrices[0], buffer.metadata.colorMatrix1, FRAME_METADATA_HAS_COLOR_MATRIX_1);
+        record.flags |= PackMatrix(record.matrices[1], buffer.metadata.colorMatrix2, FRAME_METADATA_HAS_COLOR_MATRIX_2);
+        record.flags |= PackMatrix(record.matrices[2], buffer.metadata.calibrationMatrix1, FRAME_METADATA_HAS_CALIBRATION_MATRIX_1);
+        record.flags |= PackMatrix(record.matrices[3], buffer.metadata.calibrationMatrix2, FRAME_METADATA_HAS_CALIBRATION_MATRIX_2);
+        record.flags |= PackMatrix(record.matrices[4], buffer.metadata.forwardMatrix1, FRAME_METADATA_HAS_FORWARD_MATRIX_1);
+        record.flags |= PackMatrix(record.matrices[5], buffer.metadata.forwardMatrix2, FRAME_METADATA_HAS_FORWARD_MATRIX_2);
+    }
+
+    // Restores a buffer's metadata from the binary record
+    static void ApplyFrameMetadataRecord(const FrameMetadataRecord& record, RawImageBuffer& buffer) {
+        buffer.width           = record.width;
+        buffer.height          = record.height;
+        buffer.originalWidth   = record.originalWidth;
+        buffer.originalHeight  = record.originalHeight;
+        buffer.rowStride       = record.rowStride;
+        buffer.pixelFormat     = static_cast<PixelFormat>(record.pixelFormat);
+        buffer.compressionType = static_cast<CompressionType>(record.compressionType);
+        buffer.isBinned        = record.isBinned != 0;
+        buffer.isCompressed    = record.isCompressed != 0;
+        buffer.offset          = record.offset;
+
+        buffer.metadata.timestampNs          = record.timestamp;
+        buffer.metadata.exposureTime         = record.exposureTime;
+        buffer.metadata.iso                  = record.iso;
+        buffer.metadata.exposureCompensation = record.exposureCompensation;
+        buffer.metadata.screenOrientation    = static_cast<ScreenOrientation>(record.orientation);
+        buffer.metadata.asShot               = cv::Vec3f(record.asShot[0], record.asShot[1], record.asShot[2]);
+        buffer.metadata.dynamicWhiteLevel    = record.dynamicWhiteLevel;
+
+        if(record.flags & FRAME_METADATA_HAS_DYNAMIC_BLACK_LEVEL) {
+            buffer.metadata.dynamicBlackLevel.resize(4);
+
+            for(int c = 0; c < 4; c++)
+                buffer.metadata.dynamicBlackLevel[c] = record.dynamicBlackLevel[c];
+        }
+
+        if(record.flags & FRAME_METADATA_HAS_COLOR_MATRIX_1)
+            buffer.metadata.colorMatrix1 = UnpackMatrix(record.matrices[0]);
+
+        if(record.flags & FRAME_METADATA_HAS_COLOR_MATRIX_2)
+            buffer.metadata.colorMatrix2 = UnpackMatrix(record.matrices[1]);
+
+        if(record.flags & FRAME_METADATA_HAS_CALIBRATION_MATRIX_1)
+            buffer.metadata.calibrationMatrix1 = UnpackMatrix(record.matrices[2]);
+
+        if(record.flags & FRAME_METADATA_HAS_CALIBRATION_MATRIX_2)
+            buffer.metadata.calibrationMatrix2 = UnpackMatrix(record.matrices[3]);
+
+        if(record.flags & FRAME_METADATA_HAS_FORWARD_MATRIX_1)
+            buffer.metadata.forwardMatrix1 = UnpackMatrix(record.matrices[4]);
+
+        if(record.flags & FRAME_METADATA_HAS_FORWARD_MATRIX_2)
+            buffer.metadata.forwardMatrix2 = UnpackMatrix(record.matrices[5]);
+    }
 
     std::string GetBufferName(const int64_t timestampNs) {
         return std::to_string(timestampNs);
@@ -30,10 +343,37 @@ namespace motioncam {
     RawContainerImpl::RawContainerImpl(FILE* file) :
         mMode(Mode::READ),
         mFile(file),
+        mVersion(0),
         mNumSegments(1),
         mIsInMemory(false),
         mExtraData(json11::Json()),
-        mBufferStartOffset(0)
+        mBufferStartOffset(0),
+        mMetadataOffset(0),
+        mMetadataSize(0),
+        mLoadedMetadata(false),
+        mNextCheckpointPosition(CHECKPOINT_INTERVAL_BYTES),
+        mNumOffsets(0),
+        mIndexStartOffset(0),
+        mSummary(),
+        mHasSummary(false),
+        mPendingAudioSampleRate(0),
+        mPendingAudioChannels(0),
+        mAudioOffset(0),
+        mMapped(nullptr),
+        mMappedSize(0),
+        mFrameCacheMaxBytes(0),
+        mFrameCacheBytes(0),
+        mPrefetchActive(false),
+        mPrefetchPending(0),
+        mProxyFile(nullptr),
+        mProxyStartOffset(0),
+        mLoadedProxyIndex(false),
+        mDirectIo(false),
+        mStaging(nullptr),
+        mStagingOffset(0),
+        mStagingBytes(0),
+        mStagingNext(nullptr),
+        mWriteBehindFailed(false)
     {
         init();
     }
@@ -44,10 +384,37 @@ namespace motioncam {
                                        const json11::Json& extraData) :
         mMode(Mode::CREATE),
         mFile(fdopen(fd, "w")),
+        mVersion(CONTAINER_VERSION),
         mNumSegments(numSegments),
         mIsInMemory(true),
         mExtraData(extraData),
         mBufferStartOffset(0),
+        mMetadataOffset(0),
+        mMetadataSize(0),
+        mLoadedMetadata(true),
+        mNextCheckpointPosition(CHECKPOINT_INTERVAL_BYTES),
+        mNumOffsets(0),
+        mIndexStartOffset(0),
+        mSummary(),
+        mHasSummary(false),
+        mPendingAudioSampleRate(0),
+        mPendingAudioChannels(0),
+        mAudioOffset(0),
+        mMapped(nullptr),
+        mMappedSize(0),
+        mFrameCacheMaxBytes(0),
+        mFrameCacheBytes(0),
+        mPrefetchActive(false),
+        mPrefetchPending(0),
+        mProxyFile(nullptr),
+        mProxyStartOffset(0),
+        mLoadedProxyIndex(false),
+        mDirectIo(false),
+        mStaging(nullptr),
+        mStagingOffset(0),
+        mStagingBytes(0),
+        mStagingNext(nullptr),
+        mWriteBehindFailed(false),
         mCameraMetadata(new RawCameraMetadata(cameraMetadata)),
         mPostProcessSettings(new PostProcessSettings())
     {
@@ -59,25 +426,82 @@ namespace motioncam {
                                        const json11::Json& extraData) :
         mMode(Mode::CREATE),
         mFile(nullptr),
+        mVersion(CONTAINER_VERSION),
         mNumSegments(numSegments),
         mIsInMemory(true),
         mExtraData(extraData),
         mBufferStartOffset(0),
+        mMetadataOffset(0),
+        mMetadataSize(0),
+        mLoadedMetadata(true),
+        mNextCheckpointPosition(CHECKPOINT_INTERVAL_BYTES),
+        mNumOffsets(0),
+        mIndexStartOffset(0),
+        mSummary(),
+        mHasSummary(false),
+        mPendingAudioSampleRate(0),
+        mPendingAudioChannels(0),
+        mAudioOffset(0),
+        mMapped(nullptr),
+        mMappedSize(0),
+        mFrameCacheMaxBytes(0),
+        mFrameCacheBytes(0),
+        mPrefetchActive(false),
+        mPrefetchPending(0),
+        mProxyFile(nullptr),
+        mProxyStartOffset(0),
+        mLoadedProxyIndex(false),
+        mDirectIo(false),
+        mStaging(nullptr),
+        mStagingOffset(0),
+        mStagingBytes(0),
+        mStagingNext(nullptr),
+        mWriteBehindFailed(false),
         mCameraMetadata(new RawCameraMetadata(cameraMetadata))
     {
         mPostProcessSettings = std::unique_ptr<PostProcessSettings>(
                 new PostProcessSettings(mExtraData["postProcessSettings"]));
     }
 
+    void RawContainerImpl::setUseDirectIo(const bool enabled) {
+        gUseDirectIo = enabled;
+    }
+
     RawContainerImpl::~RawContainerImpl() {
+        // A prefetch task may still be reading through our descriptor
+        mPrefetchGroup.wait();
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+        if(mMapped)
+            munmap(const_cast<uint8_t*>(mMapped), mMappedSize);
+
+        mMapped = nullptr;
+#endif
+
+        // Recordings torn down without a commit still flush their staged
+        // tail; best effort, the index is lost either way
+        if(mDirectIo) {
+            try {
+                finishDirectIo();
+            }
+            catch(const IOException&) {
+            }
+        }
+
+        if(mProxyFile)
+            fclose(mProxyFile);
+        mProxyFile = nullptr;
+
         if(mFile)
             fclose(mFile);
         mFile = nullptr;
     }
 
     void RawContainerImpl::writeBuffer(const RawImageBuffer& buffer) {
+        Measure measure("RawContainerImpl::writeBuffer()");
+
         // Keep offset
-        int64_t offset = FTELL(mFile);
+        int64_t offset = streamPosition();
 
         // Get buffer size
         size_t start, end;
@@ -87,35 +511,211 @@ namespace motioncam {
         const int64_t bufferSize = end - start;
         if(bufferSize <= 0)
             return;
-        
-        // Write buffer
+
+        // The frame's items are gathered below and written through a single
+        // scatter-gather call
+        WriteSegment segments[8];
+        int numSegments = 0;
+
+        // Align the payload so exports can read it with O_DIRECT. The padding
+        // is written as its own item so the recovery scan can step over it.
+        Item paddingItem { Type::PADDING, 0 };
+        std::vector<uint8_t> padding;
+
+        if((offset + static_cast<int64_t>(sizeof(Item))) % PAYLOAD_ALIGNMENT != 0) {
+            const int64_t payloadOffset = offset + 2 * static_cast<int64_t>(sizeof(Item));
+            const uint32_t padSize =
+                static_cast<uint32_t>((PAYLOAD_ALIGNMENT - (payloadOffset % PAYLOAD_ALIGNMENT)) % PAYLOAD_ALIGNMENT);
+
+            paddingItem.size = padSize;
+            segments[numSegments++] = { &paddingItem, sizeof(Item) };
+
+            if(padSize > 0) {
+                padding.assign(padSize, 0);
+                segments[numSegments++] = { padding.data(), padSize };
+            }
+
+            offset += static_cast<int64_t>(sizeof(Item)) + padSize;
+        }
+
+        // Buffer item and payload
         Item bufferItem { Type::BUFFER, static_cast<uint32_t>(bufferSize) };
-        write(&bufferItem, sizeof(Item));
-                
+        segments[numSegments++] = { &bufferItem, sizeof(Item) };
+
         auto* data = buffer.data->lock(false);
+
+        const uint32_t crc = Crc32c(data+start, end-start);
+
+        segments[numSegments++] = { data+start, static_cast<size_t>(bufferSize) };
+
+        // Payload checksum, written as its own item directly after the
+        // payload so the recovery scan can step over it
+        Item crcItem { Type::CRC32, static_cast<uint32_t>(sizeof(uint32_t)) };
+
+        segments[numSegments++] = { &crcItem, sizeof(Item) };
+        segments[numSegments++] = { &crc, sizeof(uint32_t) };
+
+        // Write metadata as a fixed binary record. The shading map is left
+        // out of the record and follows as a packed f16 record, like before.
+        FrameMetadataRecord record{};
+        BuildFrameMetadataRecord(buffer, record);
+
+        Item metadataItem { Type::METADATA_BIN, static_cast<uint32_t>(sizeof(FrameMetadataRecord)) };
+
+        segments[numSegments++] = { &metadataItem, sizeof(Item) };
+        segments[numSegments++] = { &record, sizeof(FrameMetadataRecord) };
+
         try {
-            write(data+start, end-start);
+            writeGather(segments, numSegments);
         }
         catch(const IOException& e) {
             buffer.data->unlock();
             throw e;
         }
-        
+
         buffer.data->unlock();
-        
-        // Write metadata
-        json11::Json::object metadata;
-        buffer.toJson(metadata);
-        
-        auto json = json11::Json(metadata).dump();
-        
-        // Write the buffer metadata
-        Item metadataItem { Type::METADATA, static_cast<uint32_t>(json.size()) };
-        
-        write(&metadataItem, sizeof(Item));
-        write(json.data(), json.size());
+
+        writeShadingMap(buffer.metadata.shadingMap());
 
         mOffsets.push_back( { offset, buffer.metadata.timestampNs } );
+
+        mFrameRecords.push_back( { buffer.metadata.timestampNs,
+                                   buffer.metadata.exposureTime,
+                                   buffer.metadata.iso,
+                                   static_cast<uint32_t>(bufferSize),
+                                   0.0f } );
+
+        // Checkpoint the index periodically so an interrupted recording
+        // recovers with a bounded tail scan
+        if(streamPosition() >= mNextCheckpointPosition) {
+            writeIndexCheckpoint();
+            mNextCheckpointPosition = streamPosition() + CHECKPOINT_INTERVAL_BYTES;
+        }
+    }
+
+    void RawContainerImpl::loadMetadataDict(const std::vector<uint8_t>& dict) {
+        mMetadataDict = dict;
+        mMetadataDDict = std::shared_ptr<ZSTD_DDict>(
+            ZSTD_createDDict(dict.data(), dict.size()), ZSTD_freeDDict);
+    }
+
+    bool RawContainerImpl::decompressMetadata(const std::vector<uint8_t>& compressed, std::string& outJson) const {
+        if(!mMetadataDDict)
+            return false;
+
+        const unsigned long long contentSize =
+            ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+
+        if(contentSize == ZSTD_CONTENTSIZE_ERROR ||
+           contentSize == ZSTD_CONTENTSIZE_UNKNOWN ||
+           contentSize > MAX_METADATA_BYTES)
+        {
+            return false;
+        }
+
+        outJson.resize(static_cast<size_t>(contentSize));
+
+        // A context per call is cheap next to the item itself and keeps
+        // this safe to use from concurrent reader sessions
+        std::shared_ptr<ZSTD_DCtx> ctx(ZSTD_createDCtx(), ZSTD_freeDCtx);
+
+        if(!ctx)
+            return false;
+
+        const size_t result = ZSTD_decompress_usingDDict(
+            ctx.get(), &outJson[0], outJson.size(), compressed.data(), compressed.size(), mMetadataDDict.get());
+
+        return !ZSTD_isError(result) && result == outJson.size();
+    }
+
+    void RawContainerImpl::writeShadingMap(const std::vector<cv::Mat>& shadingMap) {
+        if(shadingMap.empty())
+            return;
+
+        ShadingMapHeader header {
+            static_cast<uint32_t>(shadingMap.size()),
+            static_cast<uint32_t>(shadingMap[0].cols),
+            static_cast<uint32_t>(shadingMap[0].rows)
+        };
+
+        std::vector<uint16_t> packed;
+        packed.reserve(header.numChannels * header.width * header.height);
+
+        for(const auto& channel : shadingMap) {
+            for(int y = 0; y < channel.rows; y++) {
+                for(int x = 0; x < channel.cols; x++) {
+                    packed.push_back(FloatToHalf(channel.at<float>(y, x)));
+                }
+            }
+        }
+
+        Item shadingMapItem {
+            Type::SHADING_MAP,
+            static_cast<uint32_t>(sizeof(ShadingMapHeader) + packed.size() * sizeof(uint16_t))
+        };
+
+        write(&shadingMapItem, sizeof(Item));
+        write(&header, sizeof(ShadingMapHeader));
+        write(packed.data(), sizeof(uint16_t), packed.size());
+    }
+
+    // Unpack a f16 shading map record into the buffer metadata. The payload
+    // starts with a ShadingMapHeader.
+    static bool ParseShadingMapRecord(const std::vector<uint8_t>& payload, const std::shared_ptr<RawImageBuffer>& buffer) {
+        if(payload.size() < sizeof(ShadingMapHeader))
+            return false;
+
+        ShadingMapHeader header{};
+        std::memcpy(&header, payload.data(), sizeof(ShadingMapHeader));
+
+        if(header.numChannels == 0 || header.numChannels > 4 || header.width == 0 || header.height == 0)
+            return false;
+
+        const size_t numPoints = header.numChannels * header.width * header.height;
+
+        if(payload.size() != sizeof(ShadingMapHeader) + numPoints * sizeof(uint16_t))
+            return false;
+
+        const auto* packed = reinterpret_cast<const uint16_t*>(payload.data() + sizeof(ShadingMapHeader));
+
+        std::vector<cv::Mat> shadingMap;
+
+        for(uint32_t c = 0; c < header.numChannels; c++) {
+            cv::Mat channel(header.height, header.width, CV_32F);
+
+            for(uint32_t y = 0; y < header.height; y++) {
+                for(uint32_t x = 0; x < header.width; x++) {
+                    channel.at<float>(y, x) = HalfToFloat(*packed++);
+                }
+            }
+
+            shadingMap.push_back(channel);
+        }
+
+        buffer->metadata.updateShadingMap(shadingMap);
+
+        return true;
+    }
+
+    void RawContainerImpl::tryReadShadingMap(const std::shared_ptr<RawImageBuffer>& buffer) const {
+        const int64_t pos = FTELL(mFile);
+
+        Item shadingMapItem{};
+
+        if(!tryRead(&shadingMapItem, sizeof(Item)) || shadingMapItem.type != Type::SHADING_MAP) {
+            // Written before version 4; the shading map is in the json
+            FSEEK(mFile, pos, SEEK_SET);
+            return;
+        }
+
+        std::vector<uint8_t> payload(shadingMapItem.size);
+
+        if(!tryRead(payload.data(), shadingMapItem.size)) {
+            FSEEK(mFile, pos, SEEK_SET);
+            return;
+        }
+
+        ParseShadingMapRecord(payload, buffer);
     }
 
     void RawContainerImpl::add(const RawImageBuffer& buffer, bool flush) {
@@ -147,131 +747,1134 @@ namespace motioncam {
         }
     }
 
-    void RawContainerImpl::writeIndex() {
-        if(FSEEK(mFile, 0, SEEK_END) != 0)
-            throw IOException("Failed to write index");
+    void RawContainerImpl::addShared(const std::vector<std::shared_ptr<RawImageBuffer>>& buffers) {
+        if(mMode != Mode::CREATE)
+            throw IOException("Can't add. Container not it create mode");
 
-        // Write offsets
-        write(mOffsets.data(), sizeof(ItemOffset), mOffsets.size());
-        
-        // Write index
-        Index index { INDEX_MAGIC_NUMBER, static_cast<uint32_t>(mOffsets.size()) };
-        write(&index, sizeof(Index));
+        // The buffers are referenced, not cloned, so the capture path skips
+        // a copy per frame. commit() still serializes them like any other
+        // in-memory frame, so a deferred disk write keeps working.
+        for(const auto& buffer : buffers) {
+            auto name = GetBufferName(*buffer);
+
+            mFrameList.push_back(name);
+            mBuffers.insert(std::make_pair(name, buffer));
+        }
     }
 
-    void RawContainerImpl::commit(const std::string& outputPath) {
-        if(mMode != Mode::CREATE || mFile != nullptr)
-            throw IOException("Can't commit. Container is not in a valid state");
+    void RawContainerImpl::addAudio(const int16_t* samples, const size_t numSamples, const int sampleRate, const int channels) {
+        if(mMode != Mode::CREATE)
+            throw IOException("Can't add audio. Container not it create mode");
 
-        mFile = fopen(outputPath.c_str(), "wb");
-        if(!mFile)
-            throw IOException("Failed to open file " + outputPath);
+        if(samples == nullptr || numSamples == 0 || sampleRate <= 0 || channels <= 0)
+            return;
 
-        create(mExtraData);
+        // In-memory containers write their audio on commit
+        if(!mFile) {
+            mPendingAudio.insert(mPendingAudio.end(), samples, samples + numSamples);
+            mPendingAudioSampleRate = sampleRate;
+            mPendingAudioChannels = channels;
 
-        commit();
+            return;
+        }
+
+        writeAudioChunks(samples, numSamples, sampleRate, channels);
     }
 
-    void RawContainerImpl::commit() {
-        if(mMode != Mode::CREATE)
-            throw IOException("Can't commit. Container not it create mode");
+    void RawContainerImpl::writeAudioChunks(const int16_t* samples, const size_t numSamples, const int sampleRate, const int channels) {
+        if(mAudioOffset <= 0)
+            mAudioOffset = streamPosition();
 
-        // Flush buffers
-        for(const auto& buffer : mBuffers) {
-            writeBuffer(*(buffer.second));
+        const size_t numFrames = numSamples / channels;
+        const size_t framesPerChunk = (std::max)((size_t) 1, AUDIO_CHUNK_BYTES / (channels * sizeof(int16_t)));
+
+        size_t frame = 0;
+
+        while(frame < numFrames) {
+            const size_t chunkFrames = (std::min)(framesPerChunk, numFrames - frame);
+
+            AudioChunkHeader header {
+                static_cast<uint32_t>(sampleRate),
+                static_cast<uint32_t>(channels),
+                static_cast<uint32_t>(chunkFrames)
+            };
+
+            Item audioItem {
+                Type::AUDIO,
+                static_cast<uint32_t>(sizeof(AudioChunkHeader) + chunkFrames * channels * sizeof(int16_t))
+            };
+
+            write(&audioItem, sizeof(Item));
+            write(&header, sizeof(AudioChunkHeader));
+            write(samples + frame * channels, sizeof(int16_t), chunkFrames * channels);
+
+            frame += chunkFrames;
         }
-        
-        mBuffers.clear();
-        mFrameList.clear();
-        
-        writeIndex();
-        
-        mMode = Mode::CLOSED;
     }
 
-    void RawContainerImpl::init() {
-        if(!mFile)
-            throw IOException("Can't open container");
+    bool RawContainerImpl::getAudio(std::vector<int16_t>& outSamples, int& outSampleRate, int& outChannels) const {
+        outSamples.clear();
+        outSampleRate = 0;
+        outChannels = 0;
 
-        Header header{};
-        
-        // Check validity of file
-        read(&header, sizeof(Header));
-        
-        if(header.version != CONTAINER_VERSION) {
-            throw IOException("Invalid container version");
-        }
-        
-        if(memcmp(header.ident, CONTAINER_ID, sizeof(CONTAINER_ID)) != 0) {
-            throw IOException("Invalid header id");
-        }
-        
-        // Read camera metadata
-        Item metadataItem{};
-        read(&metadataItem, sizeof(Item));
-        
-        if(metadataItem.type != Type::METADATA) {
-            throw IOException("Invalid camera metadata");
+        if(!mFile || !mHasSummary || mSummary.audioOffset <= 0)
+            return false;
+
+        if(FSEEK(mFile, mSummary.audioOffset, SEEK_SET) != 0)
+            return false;
+
+        // Audio chunks are written back to back; keep reading until the
+        // chain ends
+        while(true) {
+            Item audioItem{};
+
+            if(!tryRead(&audioItem, sizeof(Item)) || audioItem.type != Type::AUDIO)
+                break;
+
+            AudioChunkHeader header{};
+
+            if(audioItem.size < sizeof(AudioChunkHeader) || !tryRead(&header, sizeof(AudioChunkHeader)))
+                return false;
+
+            const size_t numSamples = static_cast<size_t>(header.numFrames) * header.channels;
+
+            if(audioItem.size != sizeof(AudioChunkHeader) + numSamples * sizeof(int16_t))
+                return false;
+
+            outSampleRate = static_cast<int>(header.sampleRate);
+            outChannels = static_cast<int>(header.channels);
+
+            const size_t existing = outSamples.size();
+            outSamples.resize(existing + numSamples);
+
+            if(!tryRead(outSamples.data() + existing, sizeof(int16_t), numSamples))
+                return false;
         }
+
+        return !outSamples.empty();
+    }
+
+    void RawContainerImpl::setSummary(const std::vector<uint8_t>& thumbnailJpeg, const int width, const int height, const int droppedFrames) {
+        if(mMode != Mode::CREATE)
+            throw IOException("Can't set summary. Container not it create mode");
+
+        mThumbnailJpeg = thumbnailJpeg;
+
+        mSummary.width = static_cast<uint32_t>(width);
+        mSummary.height = static_cast<uint32_t>(height);
+        mSummary.droppedFrames = static_cast<uint32_t>(droppedFrames);
+
+        mHasSummary = true;
+    }
+
+    bool RawContainerImpl::getSummary(float& outDurationMs, float& outFrameRate, int& outNumFrames, int& outDroppedFrames, int& outWidth, int& outHeight) const {
+        if(!mHasSummary)
+            return false;
+
+        outDurationMs = mSummary.durationMs;
+        outFrameRate = mSummary.frameRate;
+        outNumFrames = static_cast<int>(mSummary.numFrames);
+        outDroppedFrames = static_cast<int>(mSummary.droppedFrames);
+        outWidth = static_cast<int>(mSummary.width);
+        outHeight = static_cast<int>(mSummary.height);
+
+        return true;
+    }
+
+    bool RawContainerImpl::getThumbnail(std::vector<uint8_t>& outJpeg) const {
+        if(!mFile || !mHasSummary || mSummary.thumbnailOffset <= 0)
+            return false;
+
+        if(FSEEK(mFile, mSummary.thumbnailOffset, SEEK_SET) != 0)
+            return false;
+
+        Item thumbnailItem{};
+        read(&thumbnailItem, sizeof(Item));
+
+        if(thumbnailItem.type != Type::THUMBNAIL)
+            return false;
+
+        outJpeg.resize(thumbnailItem.size);
+        read(outJpeg.data(), thumbnailItem.size);
+
+        return true;
+    }
+
+    bool RawContainerImpl::getFrameRecords(std::vector<FrameRecord>& outRecords) const {
+        outRecords.clear();
+
+        if(!mFile || !mHasSummary || mSummary.frameRecordsOffset <= 0)
+            return false;
+
+        if(FSEEK(mFile, mSummary.frameRecordsOffset, SEEK_SET) != 0)
+            return false;
+
+        Item frameIndexItem{};
+
+        if(!tryRead(&frameIndexItem, sizeof(Item)) || frameIndexItem.type != Type::FRAME_INDEX)
+            return false;
+
+        if(frameIndexItem.size == 0 || frameIndexItem.size % sizeof(FrameRecord) != 0)
+            return false;
+
+        outRecords.resize(frameIndexItem.size / sizeof(FrameRecord));
+
+        if(!tryRead(outRecords.data(), sizeof(FrameRecord), outRecords.size())) {
+            outRecords.clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    void RawContainerImpl::setDecodedFrameCache(const size_t maxBytes) {
+        std::lock_guard<std::mutex> lock(mFrameCacheMutex);
+
+        mFrameCacheMaxBytes = maxBytes;
+
+        // Trim to the new budget, oldest first
+        while(mFrameCacheBytes > mFrameCacheMaxBytes && !mFrameCacheOrder.empty()) {
+            auto it = mFrameCache.find(mFrameCacheOrder.back());
+
+            if(it != mFrameCache.end()) {
+                mFrameCacheBytes -= it->second.second->data->len();
+                mFrameCache.erase(it);
+            }
+
+            mFrameCacheOrder.pop_back();
+        }
+    }
+
+    std::shared_ptr<RawImageBuffer> RawContainerImpl::cachedFrame(const std::string& frame) {
+        if(mFrameCacheMaxBytes == 0)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock(mFrameCacheMutex);
+
+        auto it = mFrameCache.find(frame);
+        if(it == mFrameCache.end())
+            return nullptr;
+
+        // Move to the front of the LRU order
+        mFrameCacheOrder.splice(mFrameCacheOrder.begin(), mFrameCacheOrder, it->second.first);
+
+        return it->second.second;
+    }
+
+    void RawContainerImpl::cacheFrame(const std::string& frame, const std::shared_ptr<RawImageBuffer>& buffer) {
+        if(mFrameCacheMaxBytes == 0 || !buffer || !buffer->data)
+            return;
+
+        const size_t bytes = buffer->data->len();
+
+        if(bytes == 0 || bytes > mFrameCacheMaxBytes)
+            return;
+
+        std::lock_guard<std::mutex> lock(mFrameCacheMutex);
+
+        auto it = mFrameCache.find(frame);
+        if(it != mFrameCache.end()) {
+            mFrameCacheOrder.splice(mFrameCacheOrder.begin(), mFrameCacheOrder, it->second.first);
+            return;
+        }
+
+        mFrameCacheOrder.push_front(frame);
+        mFrameCache.insert(std::make_pair(frame, std::make_pair(mFrameCacheOrder.begin(), buffer)));
+
+        mFrameCacheBytes += bytes;
+
+        // Evict the least recently used frames until the budget holds
+        while(mFrameCacheBytes > mFrameCacheMaxBytes && mFrameCacheOrder.size() > 1) {
+            auto evictIt = mFrameCache.find(mFrameCacheOrder.back());
+
+            if(evictIt != mFrameCache.end()) {
+                mFrameCacheBytes -= evictIt->second.second->data->len();
+                mFrameCache.erase(evictIt);
+            }
+
+            mFrameCacheOrder.pop_back();
+        }
+    }
+
+    void RawContainerImpl::evictCachedFrame(const std::string& frame) {
+        std::lock_guard<std::mutex> lock(mFrameCacheMutex);
+
+        auto it = mFrameCache.find(frame);
+        if(it == mFrameCache.end())
+            return;
+
+        mFrameCacheBytes -= it->second.second->data->len();
+        mFrameCacheOrder.erase(it->second.first);
+        mFrameCache.erase(it);
+    }
+
+    void RawContainerImpl::prefetchFrames(const std::vector<std::string>& frames) {
+        if(frames.empty() || mMode != Mode::READ)
+            return;
+
+        // One window in flight. When the previous window is still being
+        // read the new request is dropped rather than queued behind it; the
+        // consumer is outrunning the disk and will load those frames itself.
+        if(mPrefetchActive.exchange(true))
+            return;
+
+        if(mPrefetchReaders.empty()) {
+            auto reader = createReader();
+
+            // Containers without reader sessions can't read concurrently
+            // with their consumer, so there is nothing to overlap
+            if(!reader) {
+                mPrefetchActive = false;
+                return;
+            }
+
+            mPrefetchReaders.push_back(std::move(reader));
+        }
+
+        // Fan the window out across a few sessions so several frames decode
+        // concurrently. Round-robin assignment keeps every session working
+        // on the earliest frames the consumer will want next.
+        const size_t numReaders = (std::min)((std::min)(MAX_PREFETCH_READERS, frames.size()),
+                                             static_cast<size_t>((std::max)(1, TaskEngine::get().numWorkers() / 2)));
+
+        while(mPrefetchReaders.size() < numReaders) {
+            auto reader = createReader();
+            if(!reader)
+                break;
+
+            mPrefetchReaders.push_back(std::move(reader));
+        }
+
+        const size_t numTasks = (std::min)(numReaders, mPrefetchReaders.size());
+
+        mPrefetchPending = static_cast<int>(numTasks);
+
+        for(size_t taskIdx = 0; taskIdx < numTasks; taskIdx++) {
+            RawContainerReader* reader = mPrefetchReaders[taskIdx].get();
+
+            TaskEngine::get().run(TaskPriority::EXPORT, [this, frames, reader, taskIdx, numTasks] {
+                for(size_t i = taskIdx; i < frames.size(); i += numTasks) {
+                    const auto& frame = frames[i];
+
+                    {
+                        std::lock_guard<std::mutex> lock(mPrefetchMutex);
+
+                        if(mPrefetchedFrames.size() >= MAX_PREFETCHED_FRAMES)
+                            break;
+
+                        if(mPrefetchedFrames.find(frame) != mPrefetchedFrames.end())
+                            continue;
+                    }
+
+                    std::string error;
+
+                    auto buffer = reader->tryLoadFrame(frame, error);
+                    if(!buffer)
+                        continue;
+
+                    std::lock_guard<std::mutex> lock(mPrefetchMutex);
+
+                    mPrefetchedFrames.insert(std::make_pair(frame, buffer));
+                }
+
+                if(--mPrefetchPending == 0)
+                    mPrefetchActive = false;
+            }, mPrefetchGroup);
+        }
+    }
+
+    std::shared_ptr<RawImageBuffer> RawContainerImpl::takePrefetchedFrame(const std::string& frame) {
+        std::lock_guard<std::mutex> lock(mPrefetchMutex);
+
+        auto it = mPrefetchedFrames.find(frame);
+        if(it == mPrefetchedFrames.end())
+            return nullptr;
+
+        auto buffer = it->second;
+
+        mPrefetchedFrames.erase(it);
+
+        return buffer;
+    }
+
+    bool RawContainerImpl::hasProxyTrack() const {
+        return mSummary.proxyOffset > 0;
+    }
+
+    bool RawContainerImpl::beginProxyTrack(const int fd) {
+        if(mMode != Mode::READ || mIsInMemory || mProxyFile || mSummary.proxyOffset > 0)
+            return false;
+
+        FILE* file = fdopen(fd, "r+");
+        if(!file)
+            return false;
+
+        // Proxy items are appended past the existing index, which stays in
+        // place until commitProxyTrack() re-emits the footer behind them
+        if(FSEEK(file, 0, SEEK_END) != 0) {
+            fclose(file);
+            return false;
+        }
+
+        mProxyFile = file;
+        mProxyStartOffset = FTELL(mProxyFile);
+
+        return true;
+    }
+
+    void RawContainerImpl::appendProxyFrame(const int64_t timestamp, const uint8_t* rgba, const int width, const int height) {
+        if(!mProxyFile || width <= 0 || height <= 0)
+            return;
+
+        const size_t rgbaSize = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+
+        std::vector<uint8_t> compressed(ZSTD_compressBound(rgbaSize));
+
+        const size_t compressedSize =
+            ZSTD_compress(compressed.data(), compressed.size(), rgba, rgbaSize, 1);
+
+        if(ZSTD_isError(compressedSize))
+            throw IOException("Failed to compress proxy frame");
+
+        ProxyFrameHeader header {
+            timestamp,
+            static_cast<uint32_t>(width),
+            static_cast<uint32_t>(height)
+        };
+
+        Item proxyItem { Type::PROXY, static_cast<uint32_t>(sizeof(ProxyFrameHeader) + compressedSize) };
+
+        // Generation tasks append concurrently; the chain is unordered and
+        // each header carries its timestamp, so only the writes themselves
+        // need serializing
+        std::lock_guard<std::mutex> lock(mProxyMutex);
+
+        if(fwrite(&proxyItem, sizeof(Item), 1, mProxyFile) != 1 ||
+           fwrite(&header, sizeof(ProxyFrameHeader), 1, mProxyFile) != 1 ||
+           fwrite(compressed.data(), compressedSize, 1, mProxyFile) != 1)
+        {
+            throw IOException("Failed to write proxy frame");
+        }
+    }
+
+    void RawContainerImpl::commitProxyTrack() {
+        if(!mProxyFile)
+            return;
+
+        // Collect the footer contents before re-emitting them behind the
+        // proxy chain. The original footer bytes stay in place so cursors
+        // over this container remain valid; the next open finds the new
+        // index at the end of the file.
+        std::vector<FrameRecord> records;
+        getFrameRecords(records);
+
+        std::vector<uint8_t> thumbnail;
+        getThumbnail(thumbnail);
+
+        std::vector<ItemOffset> offsets;
+        offsets.reserve(mNumOffsets);
+
+        for(size_t i = 0; i < mNumOffsets; i++)
+            offsets.push_back(indexEntryAt(i));
+
+        auto writeProxy = [this](const void* data, const size_t size) {
+            if(fwrite(data, size, 1, mProxyFile) != 1)
+                throw IOException("Failed to write proxy track index");
+        };
+
+        mSummary.summaryMagicNumber = SUMMARY_MAGIC_NUMBER;
+        mSummary.proxyOffset = mProxyStartOffset;
+
+        if(mSummary.numFrames == 0)
+            mSummary.numFrames = static_cast<uint32_t>(offsets.size());
+
+        if(mSummary.durationMs <= 0 && offsets.size() > 1) {
+            mSummary.durationMs = static_cast<float>(
+                (offsets.back().timestamp - offsets.front().timestamp) / (1000.0 * 1000.0));
+
+            if(mSummary.durationMs > 0)
+                mSummary.frameRate = offsets.size() / (mSummary.durationMs / 1000.0f);
+        }
+
+        if(!records.empty()) {
+            mSummary.frameRecordsOffset = FTELL(mProxyFile);
+
+            Item frameIndexItem {
+                Type::FRAME_INDEX,
+                static_cast<uint32_t>(records.size() * sizeof(FrameRecord))
+            };
+
+            writeProxy(&frameIndexItem, sizeof(Item));
+            writeProxy(records.data(), records.size() * sizeof(FrameRecord));
+        }
+
+        if(!thumbnail.empty()) {
+            mSummary.thumbnailOffset = FTELL(mProxyFile);
+
+            Item thumbnailItem { Type::THUMBNAIL, static_cast<uint32_t>(thumbnail.size()) };
+
+            writeProxy(&thumbnailItem, sizeof(Item));
+            writeProxy(thumbnail.data(), thumbnail.size());
+        }
+
+        Item summaryItem { Type::SUMMARY, static_cast<uint32_t>(sizeof(Summary)) };
+
+        writeProxy(&summaryItem, sizeof(Item));
+        writeProxy(&mSummary, sizeof(Summary));
+
+        const int64_t indexStartOffset = FTELL(mProxyFile);
+
+        if(!offsets.empty())
+            writeProxy(offsets.data(), offsets.size() * sizeof(ItemOffset));
+
+        Index index { INDEX_MAGIC_NUMBER, static_cast<uint32_t>(offsets.size()) };
+        writeProxy(&index, sizeof(Index));
+
+        fflush(mProxyFile);
+        fclose(mProxyFile);
+        mProxyFile = nullptr;
+
+        // Point this container at the rewritten index so later lookups and
+        // the proxy chain scan agree on the file layout
+        {
+            std::lock_guard<std::mutex> lock(mIndexMutex);
+
+            mIndexStartOffset = indexStartOffset;
+            mIndexPages.clear();
+        }
+
+        mHasSummary = true;
+
+        std::lock_guard<std::mutex> lock(mProxyMutex);
+
+        mLoadedProxyIndex = false;
+        mProxyOffsets.clear();
+    }
+
+    // Builds the timestamp to offset map for the proxy chain. Whatever
+    // follows the last PROXY item is the rewritten footer, which always
+    // starts with a different item type, so the walk ends there. The caller
+    // holds mProxyMutex.
+    bool RawContainerImpl::loadProxyIndex() {
+        if(mLoadedProxyIndex)
+            return !mProxyOffsets.empty();
+
+        mLoadedProxyIndex = true;
+
+#if !defined(_WIN32)
+        if(!mFile || mSummary.proxyOffset <= 0)
+            return false;
+
+        const int fd = fileno(mFile);
+        if(fd < 0)
+            return false;
+
+        int64_t offset = mSummary.proxyOffset;
+
+        while(true) {
+            Item proxyItem{};
+
+            if(pread(fd, &proxyItem, sizeof(Item), offset) != static_cast<ssize_t>(sizeof(Item)) ||
+               proxyItem.type != Type::PROXY                                                    ||
+               proxyItem.size < sizeof(ProxyFrameHeader))
+            {
+                break;
+            }
+
+            ProxyFrameHeader header{};
+
+            if(pread(fd, &header, sizeof(ProxyFrameHeader), offset + static_cast<int64_t>(sizeof(Item))) !=
+               static_cast<ssize_t>(sizeof(ProxyFrameHeader)))
+            {
+                break;
+            }
+
+            mProxyOffsets[header.timestamp] = offset;
+
+            offset += static_cast<int64_t>(sizeof(Item)) + proxyItem.size;
+        }
+#endif
+
+        return !mProxyOffsets.empty();
+    }
+
+    bool RawContainerImpl::getProxyFrame(const std::string& frame, std::vector<uint8_t>& outRgba, int& outWidth, int& outHeight) {
+#if defined(_WIN32)
+        return false;
+#else
+        if(!mFile || mSummary.proxyOffset <= 0)
+            return false;
+
+        int64_t offset;
+
+        {
+            std::lock_guard<std::mutex> lock(mProxyMutex);
+
+            if(!loadProxyIndex())
+                return false;
+
+            const auto it = mProxyOffsets.find(getFrameTimestamp(frame));
+            if(it == mProxyOffsets.end())
+                return false;
+
+            offset = it->second;
+        }
+
+        // Frame data is read with pread so decode threads fetch proxy
+        // frames concurrently instead of serializing on the file cursor
+        const int fd = fileno(mFile);
+        if(fd < 0)
+            return false;
+
+        Item proxyItem{};
+
+        if(pread(fd, &proxyItem, sizeof(Item), offset) != static_cast<ssize_t>(sizeof(Item)) ||
+           proxyItem.type != Type::PROXY                                                    ||
+           proxyItem.size < sizeof(ProxyFrameHeader))
+        {
+            return false;
+        }
+
+        ProxyFrameHeader header{};
+
+        if(pread(fd, &header, sizeof(ProxyFrameHeader), offset + static_cast<int64_t>(sizeof(Item))) !=
+           static_cast<ssize_t>(sizeof(ProxyFrameHeader)))
+        {
+            return false;
+        }
+
+        const uint64_t rgbaSize = static_cast<uint64_t>(header.width) * header.height * 4;
+
+        if(rgbaSize == 0 || rgbaSize > MAX_PROXY_BYTES)
+            return false;
+
+        const size_t compressedSize = proxyItem.size - sizeof(ProxyFrameHeader);
+
+        std::vector<uint8_t> compressed(compressedSize);
+
+        auto* dst = compressed.data();
+        size_t remaining = compressedSize;
+        int64_t readOffset = offset + static_cast<int64_t>(sizeof(Item) + sizeof(ProxyFrameHeader));
+
+        while(remaining > 0) {
+            const ssize_t bytesRead = pread(fd, dst, remaining, readOffset);
+
+            if(bytesRead <= 0) {
+                if(bytesRead < 0 && errno == EINTR)
+                    continue;
+
+                return false;
+            }
+
+            dst += bytesRead;
+            readOffset += bytesRead;
+            remaining -= bytesRead;
+        }
+
+        outRgba.resize(static_cast<size_t>(rgbaSize));
+
+        const size_t result =
+            ZSTD_decompress(outRgba.data(), outRgba.size(), compressed.data(), compressedSize);
+
+        if(ZSTD_isError(result) || result != outRgba.size())
+            return false;
+
+        outWidth = static_cast<int>(header.width);
+        outHeight = static_cast<int>(header.height);
+
+        return true;
+#endif
+    }
+
+    void RawContainerImpl::writeIndex() {
+        // Streamed recordings leave direct I/O mode here; the footer seeks
+        // and is written buffered
+        finishDirectIo();
+
+        if(FSEEK(mFile, 0, SEEK_END) != 0)
+            throw IOException("Failed to write index");
+
+        // Write the thumbnail and summary just ahead of the index so they can
+        // be found from the footer without scanning the file. A summary is
+        // also written when only the metadata dictionary offset needs to be
+        // carried, so writers that never set one still produce readable
+        // compressed metadata.
+        if(mHasSummary || mSummary.metadataDictOffset > 0) {
+            // Frame records go just ahead of the thumbnail and summary so
+            // EV selection and frame ordering can run off the footer
+            if(!mFrameRecords.empty()) {
+                mSummary.frameRecordsOffset = FTELL(mFile);
+
+                Item frameIndexItem {
+                    Type::FRAME_INDEX,
+                    static_cast<uint32_t>(mFrameRecords.size() * sizeof(FrameRecord))
+                };
+
+                write(&frameIndexItem, sizeof(Item));
+                write(mFrameRecords.data(), sizeof(FrameRecord), mFrameRecords.size());
+            }
+
+            if(!mThumbnailJpeg.empty()) {
+                mSummary.thumbnailOffset = FTELL(mFile);
+
+                Item thumbnailItem { Type::THUMBNAIL, static_cast<uint32_t>(mThumbnailJpeg.size()) };
+
+                write(&thumbnailItem, sizeof(Item));
+                write(mThumbnailJpeg.data(), mThumbnailJpeg.size());
+            }
+
+            mSummary.summaryMagicNumber = SUMMARY_MAGIC_NUMBER;
+            mSummary.numFrames = static_cast<uint32_t>(mOffsets.size());
+            mSummary.audioOffset = mAudioOffset;
+
+            if(mOffsets.size() > 1) {
+                mSummary.durationMs = static_cast<float>(
+                    (mOffsets.back().timestamp - mOffsets.front().timestamp) / (1000.0 * 1000.0));
+
+                if(mSummary.durationMs > 0)
+                    mSummary.frameRate = mOffsets.size() / (mSummary.durationMs / 1000.0f);
+            }
+
+            Item summaryItem { Type::SUMMARY, static_cast<uint32_t>(sizeof(Summary)) };
+
+            write(&summaryItem, sizeof(Item));
+            write(&mSummary, sizeof(Summary));
+        }
+
+        // Write offsets
+        write(mOffsets.data(), sizeof(ItemOffset), mOffsets.size());
+        
+        // Write index
+        Index index { INDEX_MAGIC_NUMBER, static_cast<uint32_t>(mOffsets.size()) };
+        write(&index, sizeof(Index));
+    }
+
+    // Writes a cumulative copy of the frame index into the stream. The
+    // checkpoint header is padded onto a payload aligned position so
+    // findIndexCheckpoint() only has to probe aligned offsets.
+    void RawContainerImpl::writeIndexCheckpoint() {
+        if(mOffsets.empty())
+            return;
+
+        const int64_t offset = streamPosition();
+        const int64_t alignment = static_cast<int64_t>(PAYLOAD_ALIGNMENT);
+
+        if(offset % alignment != 0) {
+            const uint32_t padSize = static_cast<uint32_t>(
+                (alignment - ((offset + static_cast<int64_t>(sizeof(Item))) % alignment)) % alignment);
+
+            Item paddingItem { Type::PADDING, padSize };
+
+            write(&paddingItem, sizeof(Item));
+
+            if(padSize > 0) {
+                std::vector<uint8_t> padding(padSize, 0);
+                write(padding.data(), padSize);
+            }
+        }
+
+        Item checkpointItem {
+            Type::INDEX_CHECKPOINT,
+            static_cast<uint32_t>(sizeof(IndexCheckpoint) + mOffsets.size() * sizeof(ItemOffset))
+        };
+
+        IndexCheckpoint checkpoint { CHECKPOINT_MAGIC_NUMBER, static_cast<uint32_t>(mOffsets.size()) };
+
+        write(&checkpointItem, sizeof(Item));
+        write(&checkpoint, sizeof(IndexCheckpoint));
+        write(mOffsets.data(), sizeof(ItemOffset), mOffsets.size());
+    }
+
+    void RawContainerImpl::commit(const std::string& outputPath) {
+        if(mMode != Mode::CREATE || mFile != nullptr)
+            throw IOException("Can't commit. Container is not in a valid state");
+
+        mFile = fopen(outputPath.c_str(), "wb");
+        if(!mFile)
+            throw IOException("Failed to open file " + outputPath);
+
+        create(mExtraData);
+
+        commit();
+    }
+
+    void RawContainerImpl::commit() {
+        if(mMode != Mode::CREATE)
+            throw IOException("Can't commit. Container not it create mode");
+
+        // Flush buffers
+        for(const auto& buffer : mBuffers) {
+            writeBuffer(*(buffer.second));
+        }
+        
+        mBuffers.clear();
+        mFrameList.clear();
+
+        // Flush audio added while the container was in memory
+        if(!mPendingAudio.empty()) {
+            writeAudioChunks(mPendingAudio.data(), mPendingAudio.size(), mPendingAudioSampleRate, mPendingAudioChannels);
+            mPendingAudio.clear();
+        }
+
+        writeIndex();
+
+        mMode = Mode::CLOSED;
+    }
+
+    void RawContainerImpl::adviseSequentialRead(const int64_t start, const int64_t end) const {
+#if defined(__ANDROID__) || defined(__linux__)
+        const int fd = fileno(mFile);
+        if(fd < 0)
+            return;
+
+        const int64_t pageSize = 4096;
+        const int64_t alignedStart = start & ~(pageSize - 1);
+
+        // Drop the pages of the frame we just consumed so exports don't push
+        // the rest of the system's working set out of the page cache
+        posix_fadvise(fd, alignedStart, end - alignedStart, POSIX_FADV_DONTNEED);
+
+        // Prefetch ahead of the cursor. Frames are laid out in write order,
+        // which matches the iteration order of the export path.
+        posix_fadvise(fd, end, READAHEAD_WINDOW, POSIX_FADV_WILLNEED);
+#else
+        (void) start;
+        (void) end;
+#endif
+    }
+
+    void RawContainerImpl::init() {
+        if(!mFile)
+            throw IOException("Can't open container");
+
+#if defined(__ANDROID__) || defined(__linux__)
+        // Frames are read mostly in file order
+        posix_fadvise(fileno(mFile), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+        Header header{};
         
-        std::vector<uint8_t> metadataJson(metadataItem.size);
-        read(metadataJson.data(), metadataItem.size);
-        
+        // Check validity of file
+        read(&header, sizeof(Header));
+        
+        if(header.version < CONTAINER_MIN_VERSION || header.version > CONTAINER_VERSION) {
+            throw IOException("Invalid container version");
+        }
+
+        if(memcmp(header.ident, CONTAINER_ID, sizeof(CONTAINER_ID)) != 0) {
+            throw IOException("Invalid header id");
+        }
+
+        mVersion = header.version;
+        
+        // Locate the camera metadata but don't parse it yet. The JSON holds large
+        // arrays (noise profiles, shading maps) and index-only consumers never
+        // touch it, so the parse is deferred until an accessor needs it.
+        Item metadataItem{};
+        read(&metadataItem, sizeof(Item));
+
+        if(metadataItem.type != Type::METADATA) {
+            throw IOException("Invalid camera metadata");
+        }
+
+        mMetadataOffset = FTELL(mFile);
+        mMetadataSize = metadataItem.size;
+
+        if(FSEEK(mFile, metadataItem.size, SEEK_CUR) != 0) {
+            throw IOException("Invalid camera metadata");
+        }
+
+        // Keep offset of where the buffers begin
+        mBufferStartOffset = FTELL(mFile);
+
+        // Read index
+        if(FSEEK(mFile, -static_cast<long>(sizeof(Index)), SEEK_END) != 0) {
+            throw IOException("Failed to get end chunk");
+        }
+
+        int64_t fileSize = FTELL(mFile) + static_cast<int64_t>(sizeof(Index));
+
+        Index index{};
+        read(&index, sizeof(Index));
+
+        // Check validity of index
+        if(index.indexMagicNumber != INDEX_MAGIC_NUMBER) {
+            mMode = Mode::CORRUPTED;
+            reindexOffsets();
+        }
+        else {
+            // Don't load the index eagerly. Entries are read in pages on
+            // demand so open time and memory stay bounded for long takes.
+            mNumOffsets = index.numOffsets;
+            mIndexStartOffset =
+                fileSize - static_cast<int64_t>(sizeof(Index)) - static_cast<int64_t>(mNumOffsets * sizeof(ItemOffset));
+
+            if(mIndexStartOffset < mBufferStartOffset) {
+                mMode = Mode::CORRUPTED;
+                mNumOffsets = 0;
+            }
+            else {
+                // Read the summary, if this container was written with one.
+                // Older summaries are shorter: the audio offset, frame
+                // records offset, metadata dictionary offset and proxy
+                // offset fields were added over time. Accept every size;
+                // missing fields stay zeroed.
+                const int64_t summarySizes[5] = {
+                    static_cast<int64_t>(sizeof(Summary)),
+                    static_cast<int64_t>(sizeof(Summary) - sizeof(int64_t)),
+                    static_cast<int64_t>(sizeof(Summary) - 2 * sizeof(int64_t)),
+                    static_cast<int64_t>(sizeof(Summary) - 3 * sizeof(int64_t)),
+                    static_cast<int64_t>(sizeof(Summary) - 4 * sizeof(int64_t))
+                };
+
+                for(int i = 0; i < 5 && !mHasSummary; i++) {
+                    const int64_t summaryOffset =
+                        mIndexStartOffset - static_cast<int64_t>(sizeof(Item)) - summarySizes[i];
+
+                    if(summaryOffset < mBufferStartOffset || FSEEK(mFile, summaryOffset, SEEK_SET) != 0)
+                        continue;
+
+                    try {
+                        Item summaryItem{};
+                        read(&summaryItem, sizeof(Item));
+
+                        if(summaryItem.type == Type::SUMMARY && summaryItem.size == summarySizes[i]) {
+                            read(&mSummary, summarySizes[i]);
+
+                            mHasSummary = mSummary.summaryMagicNumber == SUMMARY_MAGIC_NUMBER;
+                        }
+                    }
+                    catch(const IOException& e) {
+                        // Older containers don't have a summary
+                    }
+                }
+
+                // Load the metadata dictionary eagerly; it's a few KB and
+                // reader sessions need it without touching the file cursor
+                if(mHasSummary &&
+                   mSummary.metadataDictOffset >= mBufferStartOffset &&
+                   FSEEK(mFile, mSummary.metadataDictOffset, SEEK_SET) == 0)
+                {
+                    Item dictItem{};
+
+                    if(tryRead(&dictItem, sizeof(Item)) &&
+                       dictItem.type == Type::METADATA_DICT &&
+                       dictItem.size > 0 &&
+                       dictItem.size <= METADATA_DICT_MAX_BYTES)
+                    {
+                        std::vector<uint8_t> dict(dictItem.size);
+
+                        if(tryRead(dict.data(), dictItem.size))
+                            loadMetadataDict(dict);
+                    }
+                }
+            }
+        }
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+        // Map the container for reading. Frame loads are then served
+        // straight from the page cache instead of being copied through
+        // fread, and compressed payloads decode from the mapping with no
+        // scratch read; merging exports that revisit the same regions keep
+        // the pages warm across passes.
+        if(mMode == Mode::READ &&
+           fileSize > 0 &&
+           static_cast<uint64_t>(fileSize) <= (std::numeric_limits<size_t>::max)())
+        {
+            const int fd = fileno(mFile);
+
+            if(fd >= 0) {
+                void* mapped = mmap(nullptr, static_cast<size_t>(fileSize), PROT_READ, MAP_SHARED, fd, 0);
+
+                if(mapped != MAP_FAILED) {
+                    mMapped = static_cast<const uint8_t*>(mapped);
+                    mMappedSize = static_cast<size_t>(fileSize);
+                }
+            }
+        }
+#endif
+    }
+
+    void RawContainerImpl::loadMetadata() const {
+        if(mLoadedMetadata)
+            return;
+
+        if(!mFile || mMetadataOffset <= 0)
+            throw IOException("Invalid camera metadata");
+
+        if(FSEEK(mFile, mMetadataOffset, SEEK_SET) != 0)
+            throw IOException("Invalid camera metadata");
+
+        std::vector<uint8_t> metadataJson(mMetadataSize);
+        read(metadataJson.data(), mMetadataSize);
+
         // Parse the camera metadata
         std::string m(metadataJson.begin(), metadataJson.end());
         std::string err;
-        
+
         auto metadata = json11::Json::parse(m, err);
         if(!err.empty()) {
             throw IOException("Invalid camera metadata");
         }
-        
+
         mCameraMetadata = std::unique_ptr<RawCameraMetadata>(new RawCameraMetadata(metadata));
         mNumSegments = util::GetOptionalSetting(metadata, "numSegments", 1);
-        
+
         // Store extra data
         mExtraData = metadata["extraData"];
-        
+
         // Get post process settings if available
         if(!mPostProcessSettings) {
             auto settings = std::unique_ptr<PostProcessSettings>(new PostProcessSettings(mExtraData["postProcessSettings"]));
             mPostProcessSettings = std::move(settings);
         }
-        
-        // Keep offset of where the buffers begin
-        mBufferStartOffset = FTELL(mFile);
-        
-        // Read index
-        if(FSEEK(mFile, -static_cast<long>(sizeof(Index)), SEEK_END) != 0) {
-            throw IOException("Failed to get end chunk");
+
+        mLoadedMetadata = true;
+    }
+
+    const std::vector<ItemOffset>& RawContainerImpl::indexPage(const size_t page) const {
+        // Requires mIndexMutex to be held
+        auto it = mIndexPages.find(page);
+        if(it != mIndexPages.end())
+            return it->second;
+
+        // Keep the page cache bounded
+        if(mIndexPages.size() >= MAX_CACHED_INDEX_PAGES)
+            mIndexPages.clear();
+
+        const size_t start = page * INDEX_PAGE_SIZE;
+        const size_t count = (std::min)(INDEX_PAGE_SIZE, mNumOffsets - start);
+        const int64_t offset = mIndexStartOffset + static_cast<int64_t>(start * sizeof(ItemOffset));
+
+        std::vector<ItemOffset> entries(count);
+
+#if !defined(_WIN32)
+        // Read the page with pread() so index lookups from reader sessions
+        // don't disturb the FILE* cursor the owning thread is using
+        uint8_t* dst = reinterpret_cast<uint8_t*>(entries.data());
+        size_t remaining = count * sizeof(ItemOffset);
+        int64_t readOffset = offset;
+
+        while(remaining > 0) {
+            const ssize_t bytesRead = pread(fileno(mFile), dst, remaining, readOffset);
+            if(bytesRead <= 0) {
+                if(bytesRead < 0 && errno == EINTR)
+                    continue;
+
+                throw IOException("Failed to read index page");
+            }
+
+            dst += bytesRead;
+            readOffset += bytesRead;
+            remaining -= bytesRead;
         }
-        
-        Index index{};
-        read(&index, sizeof(Index));
-        
-        // Check validity of index
-        if(index.indexMagicNumber != INDEX_MAGIC_NUMBER) {
-            mMode = Mode::CORRUPTED;
+#else
+        if(FSEEK(mFile, offset, SEEK_SET) != 0)
+            throw IOException("Failed to read index page");
+
+        read(entries.data(), sizeof(ItemOffset), count);
+#endif
+
+        return mIndexPages.insert(std::make_pair(page, std::move(entries))).first->second;
+    }
+
+    ItemOffset RawContainerImpl::indexEntryAt(const size_t i) const {
+        // Return by value. Another reader session can evict the page as soon
+        // as the lock is released.
+        std::lock_guard<std::mutex> lock(mIndexMutex);
+
+        return indexPage(i / INDEX_PAGE_SIZE)[i % INDEX_PAGE_SIZE];
+    }
+
+    bool RawContainerImpl::findOffset(const std::string& frame, ItemOffset& outOffset) const {
+        int64_t timestamp;
+
+        try {
+            timestamp = std::stoll(frame);
         }
-        else {
-            mOffsets.resize(index.numOffsets);
-            
-            // Read the index
-            int64_t offsetIndex = sizeof(Index) + index.numOffsets * sizeof(ItemOffset);
-            if(FSEEK(mFile, -offsetIndex, SEEK_END) != 0) {
-                throw IOException("Failed to get index");
+        catch(std::exception& e) {
+            return false;
+        }
+
+        if(mRemovedFrames.find(timestamp) != mRemovedFrames.end())
+            return false;
+
+        // Created and recovered containers keep their offsets in memory
+        if(!mOffsets.empty()) {
+            auto it = std::lower_bound(
+                mOffsets.begin(), mOffsets.end(), timestamp,
+                [](const ItemOffset& a, int64_t t) { return a.timestamp < t; });
+
+            if(it != mOffsets.end() && it->timestamp == timestamp) {
+                outOffset = *it;
+                return true;
             }
-            
-            read(mOffsets.data(), sizeof(ItemOffset), mOffsets.size());
+
+            return false;
         }
-        
-        reindexOffsets();
+
+        if(mNumOffsets == 0)
+            return false;
+
+        // The index is written in capture order so entries are sorted by
+        // timestamp. Binary search through the paged index.
+        size_t lo = 0;
+        size_t hi = mNumOffsets;
+
+        while(lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+
+            if(indexEntryAt(mid).timestamp < timestamp)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        if(lo < mNumOffsets) {
+            const ItemOffset& entry = indexEntryAt(lo);
+
+            if(entry.timestamp == timestamp) {
+                outOffset = entry;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool RawContainerImpl::frameOffsetAt(const size_t index, ItemOffset& outOffset) const {
+        // Removed frames shift the numbering, so those containers go back
+        // through the name based path
+        if(mMode != Mode::READ || !mRemovedFrames.empty())
+            return false;
+
+        // Created and recovered containers keep their offsets in memory,
+        // sorted by timestamp
+        if(!mOffsets.empty()) {
+            if(index >= mOffsets.size())
+                return false;
+
+            outOffset = mOffsets[index];
+            return true;
+        }
+
+        // The on-disk index is written in capture order so entries are
+        // already sorted by timestamp, matching getFrames()
+        if(index >= mNumOffsets)
+            return false;
+
+        outOffset = indexEntryAt(index);
+        return true;
     }
 
     void RawContainerImpl::create(const json11::Json& extraData) {
         if(!mFile)
             throw IOException("Invalid file");
-        
+
+        // Streamed recordings optionally bypass the page cache from the
+        // first byte
+        setupDirectIo();
+
         Header h{};
         
         h.version = CONTAINER_VERSION;
@@ -302,15 +1905,11 @@ namespace motioncam {
         std::sort(mOffsets.begin(), mOffsets.end(), [](const auto& a, const auto&b) {
             return a.timestamp < b.timestamp;
         });
-        
+
         mFrameList.clear();
-        mFrameOffsetMap.clear();
-        
-        for(const auto& i : mOffsets) {
-            auto name = GetBufferName(i.timestamp);
 
-            mFrameList.push_back(name);
-            mFrameOffsetMap.insert({ name, i });
+        for(const auto& i : mOffsets) {
+            mFrameList.push_back(GetBufferName(i.timestamp));
         }
     }
 
@@ -326,16 +1925,77 @@ namespace motioncam {
         mMode = Mode::READ;
     }
 
+    // Probes payload aligned offsets backwards from the end of the file for
+    // the newest index checkpoint. Checkpoints are cumulative, so the first
+    // valid one bounds the remaining scan to the tail it doesn't cover.
+    // Returns false when the container predates checkpoints or none
+    // survived intact.
+    bool RawContainerImpl::findIndexCheckpoint(const int64_t fileSize, std::vector<ItemOffset>& outOffsets, int64_t& outResumeOffset) {
+        const int64_t alignment = static_cast<int64_t>(PAYLOAD_ALIGNMENT);
+        int64_t probeOffset = ((fileSize - static_cast<int64_t>(sizeof(Item))) / alignment) * alignment;
+
+        while(probeOffset >= mBufferStartOffset) {
+            if(FSEEK(mFile, probeOffset, SEEK_SET) != 0)
+                return false;
+
+            Item checkpointItem{};
+            IndexCheckpoint checkpoint{};
+
+            if(tryRead(&checkpointItem, sizeof(Item))             &&
+               checkpointItem.type == Type::INDEX_CHECKPOINT      &&
+               tryRead(&checkpoint, sizeof(IndexCheckpoint))      &&
+               checkpoint.checkpointMagicNumber == CHECKPOINT_MAGIC_NUMBER &&
+               checkpoint.numOffsets > 0                          &&
+               checkpoint.numOffsets <= CHECKPOINT_MAX_OFFSETS    &&
+               checkpointItem.size ==
+                   sizeof(IndexCheckpoint) + checkpoint.numOffsets * sizeof(ItemOffset))
+            {
+                std::vector<ItemOffset> entries(checkpoint.numOffsets);
+
+                if(tryRead(entries.data(), sizeof(ItemOffset), entries.size())) {
+                    // The newest entry must point at a frame before the
+                    // checkpoint, otherwise this is payload that happens
+                    // to look like one
+                    Item bufferItem{};
+
+                    if(entries.back().offset >= mBufferStartOffset         &&
+                       entries.back().offset < probeOffset                 &&
+                       FSEEK(mFile, entries.back().offset, SEEK_SET) == 0  &&
+                       tryRead(&bufferItem, sizeof(Item))                  &&
+                       bufferItem.type == Type::BUFFER)
+                    {
+                        outOffsets = std::move(entries);
+                        outResumeOffset =
+                            probeOffset + static_cast<int64_t>(sizeof(Item)) + checkpointItem.size;
+
+                        return true;
+                    }
+                }
+            }
+
+            probeOffset -= alignment;
+        }
+
+        return false;
+    }
+
     std::vector<ItemOffset> RawContainerImpl::attemptToRecover() {
         int64_t currentOffset = mBufferStartOffset;
         std::vector<ItemOffset> offsets;
-        
+
         // Get file size
         if(FSEEK(mFile, 0, SEEK_END) != 0)
             return offsets;
-        
+
         int64_t fileSize = FTELL(mFile);
-        
+
+        // Resume from the newest index checkpoint when the container was
+        // written with them, so only the tail after it needs scanning. The
+        // frames a checkpoint covers get their metadata read lazily on
+        // first access.
+        if(mVersion >= 7)
+            findIndexCheckpoint(fileSize, offsets, currentOffset);
+
         while(currentOffset < fileSize) {
             if(FSEEK(mFile, currentOffset, SEEK_SET) != 0)
                 break;
@@ -343,6 +2003,39 @@ namespace motioncam {
             Item bufferItem{};
             read(&bufferItem, sizeof(Item));
 
+            // Step over payload alignment padding
+            if(bufferItem.type == Type::PADDING) {
+                if(FSEEK(mFile, bufferItem.size, SEEK_CUR) != 0)
+                    break;
+
+                currentOffset = FTELL(mFile);
+                continue;
+            }
+
+            // Step over index checkpoints; the scan rebuilds the offsets
+            // itself from this point on
+            if(bufferItem.type == Type::INDEX_CHECKPOINT) {
+                if(FSEEK(mFile, bufferItem.size, SEEK_CUR) != 0)
+                    break;
+
+                currentOffset = FTELL(mFile);
+                continue;
+            }
+
+            // The metadata dictionary rides in the stream between frames.
+            // Load it so the compressed metadata that follows can be parsed.
+            if(bufferItem.type == Type::METADATA_DICT) {
+                std::vector<uint8_t> dict(bufferItem.size);
+
+                if(!tryRead(dict.data(), bufferItem.size))
+                    break;
+
+                loadMetadataDict(dict);
+
+                currentOffset = FTELL(mFile);
+                continue;
+            }
+
             if(bufferItem.type != Type::BUFFER)
                 break;
 
@@ -353,6 +2046,18 @@ namespace motioncam {
             if(FSEEK(mFile, bufferItem.size, SEEK_CUR) != 0)
                 break;
 
+            // Step over the payload checksum, if present
+            const int64_t metadataPos = FTELL(mFile);
+            Item crcItem{};
+
+            if(tryRead(&crcItem, sizeof(Item)) && crcItem.type == Type::CRC32) {
+                if(FSEEK(mFile, crcItem.size, SEEK_CUR) != 0)
+                    break;
+            }
+            else {
+                FSEEK(mFile, metadataPos, SEEK_SET);
+            }
+
             // Create and insert the buffer, if possible
             auto buffer = readMetadata();
             if(!buffer)
@@ -373,48 +2078,132 @@ namespace motioncam {
     }
 
     RawCameraMetadata& RawContainerImpl::getCameraMetadata() const {
+        loadMetadata();
         return *mCameraMetadata;
     }
 
     PostProcessSettings& RawContainerImpl::getPostProcessSettings() const {
+        loadMetadata();
         return *mPostProcessSettings;
     }
 
     bool RawContainerImpl::isHdr() const {
+        loadMetadata();
         return util::GetOptionalSetting(mExtraData, "isHdr", false);
     }
 
     std::vector<std::string> RawContainerImpl::getFrames() const {
+        // Build the frame list the first time it is requested instead of at
+        // open time
+        if(mFrameList.empty() && mNumOffsets > 0) {
+            std::vector<int64_t> timestamps;
+            timestamps.reserve(mNumOffsets);
+
+            for(size_t i = 0; i < mNumOffsets; i++) {
+                const int64_t timestamp = indexEntryAt(i).timestamp;
+
+                if(mRemovedFrames.find(timestamp) == mRemovedFrames.end())
+                    timestamps.push_back(timestamp);
+            }
+
+            std::sort(timestamps.begin(), timestamps.end());
+
+            for(const auto& timestamp : timestamps)
+                mFrameList.push_back(GetBufferName(timestamp));
+        }
+
         return mFrameList;
     }
 
-    void RawContainerImpl::uncompressBuffer(std::vector<uint8_t>& compressedBuffer, const std::shared_ptr<RawImageBuffer>& dst) const {
-        std::vector<uint8_t> uncompressedBuffer(2 * dst->width * dst->height);
-        
-        if(dst->compressionType != CompressionType::MOTIONCAM)
-            throw IOException("Invalid compression type");
-
-        encoder::decode(reinterpret_cast<uint16_t*>(uncompressedBuffer.data()),
-                        dst->width,
-                        dst->height,
-                        compressedBuffer.data(),
-                        compressedBuffer.size());
-                
-        dst->data->copyHostData(uncompressedBuffer);
+    bool RawContainerImpl::uncompressBuffer(const uint8_t* compressed, const size_t compressedSize, const std::shared_ptr<RawImageBuffer>& dst) const {
+        if(dst->compressionType != CompressionType::MOTIONCAM &&
+           dst->compressionType != CompressionType::MOTIONCAM_BANDED)
+        {
+            return false;
+        }
+
+        // Decode straight into the destination buffer. For CL backed buffers
+        // lock() maps the device memory, so playback frames land in the
+        // buffer the preview pipeline consumes instead of going through an
+        // intermediate host copy.
+        const size_t uncompressedSize = 2 * dst->width * dst->height;
+
+        dst->data->allocate(uncompressedSize);
+
+        if(dst->data->len() < uncompressedSize)
+            return false;
+
+        auto* output = dst->data->lock(true);
+
+        if(dst->compressionType == CompressionType::MOTIONCAM_BANDED) {
+            // The bands decode in parallel on the task engine
+            if(!encoder::decodeBanded(reinterpret_cast<uint16_t*>(output),
+                                      dst->width,
+                                      dst->height,
+                                      compressed,
+                                      compressedSize))
+            {
+                dst->data->unlock();
+                return false;
+            }
+        }
+        else {
+            encoder::decode(reinterpret_cast<uint16_t*>(output),
+                            dst->width,
+                            dst->height,
+                            compressed,
+                            compressedSize);
+        }
+
+        dst->data->unlock();
+        dst->data->setValidRange(0, uncompressedSize);
+
+        return true;
     }
 
     std::shared_ptr<RawImageBuffer> RawContainerImpl::readMetadata() {
         Item metadataItem{};
-        read(&metadataItem, sizeof(Item));
-        
-        if(metadataItem.type != Type::METADATA)
+
+        if(!tryRead(&metadataItem, sizeof(Item)))
             return nullptr;
-        
+
+        // Version 6 containers write the metadata as a fixed binary record
+        if(metadataItem.type == Type::METADATA_BIN) {
+            if(metadataItem.size != sizeof(FrameMetadataRecord))
+                return nullptr;
+
+            FrameMetadataRecord record{};
+
+            if(!tryRead(&record, sizeof(FrameMetadataRecord)))
+                return nullptr;
+
+            auto buffer = std::make_shared<RawImageBuffer>();
+            ApplyFrameMetadataRecord(record, *buffer);
+
+            tryReadShadingMap(buffer);
+
+            return buffer;
+        }
+
+        if(metadataItem.type != Type::METADATA && metadataItem.type != Type::METADATA_ZSTD)
+            return nullptr;
+
         std::vector<uint8_t> metadataJson(metadataItem.size);
-        read(metadataJson.data(), metadataItem.size);
-        
+
+        if(!tryRead(metadataJson.data(), metadataItem.size))
+            return nullptr;
+
         // Parse the metadata
-        std::string m(metadataJson.begin(), metadataJson.end());
+        std::string m;
+
+        if(metadataItem.type == Type::METADATA_ZSTD) {
+            if(!decompressMetadata(metadataJson, m))
+                return nullptr;
+        }
+        else {
+            m.assign(metadataJson.begin(), metadataJson.end());
+        }
+
         std::string err;
         
         // Create and insert the buffer
@@ -422,36 +2211,96 @@ namespace motioncam {
         if(!err.empty()) {
             return nullptr;
         }
-        
-        return std::make_shared<RawImageBuffer>(metadata);
+
+        auto buffer = std::make_shared<RawImageBuffer>(metadata);
+
+        // Version 4 containers write the shading map as a packed f16 record
+        // directly after the metadata
+        tryReadShadingMap(buffer);
+
+        return buffer;
     }
 
-    std::shared_ptr<RawImageBuffer> RawContainerImpl::readFrame(const std::string& frame, bool readData) {
-        // Load the metadata
-        if(mFrameOffsetMap.find(frame) == mFrameOffsetMap.end())
+    std::shared_ptr<RawImageBuffer> RawContainerImpl::readFrame(const std::string& frame, const bool readData, std::string& outError) {
+        ItemOffset itemOffset;
+
+        if(!findOffset(frame, itemOffset))
             return nullptr;
-        
-        int64_t offset = mFrameOffsetMap.at(frame).offset;
-        
-        if(FSEEK(mFile, offset, SEEK_SET) != 0)
-            throw IOException("Invalid offset");
-        
-        Item bufferItem{};
-        read(&bufferItem, sizeof(Item));
 
-        if(bufferItem.type != Type::BUFFER)
-            throw IOException("Invalid buffer type");
+        return readFrameAt(itemOffset, frame, readData, outError);
+    }
 
-        std::vector<uint8_t> data(bufferItem.size);
+    std::shared_ptr<RawImageBuffer> RawContainerImpl::readFrameAt(const ItemOffset& itemOffset, const std::string& frame, const bool readData, std::string& outError) {
+        Measure measure("RawContainerImpl::readFrameAt()");
 
+        // Scrubbing players bounce between the same few frames; serve those
+        // from the decoded cache instead of re-reading and re-decoding
         if(readData) {
-            read(data.data(), bufferItem.size);
+            auto prefetched = takePrefetchedFrame(frame);
+            if(prefetched)
+                return prefetched;
+
+            auto cached = cachedFrame(frame);
+            if(cached)
+                return cached;
         }
-        else {
-            if(FSEEK(mFile, bufferItem.size, SEEK_CUR) != 0)
-                throw IOException("Invalid metadata");
+
+        int64_t offset = itemOffset.offset;
+
+        if(FSEEK(mFile, offset, SEEK_SET) != 0) {
+            outError = "Invalid offset";
+            return nullptr;
         }
-        
+
+        Item bufferItem{};
+
+        if(!tryRead(&bufferItem, sizeof(Item))) {
+            outError = "Failed to read data";
+            return nullptr;
+        }
+
+        if(bufferItem.type != Type::BUFFER) {
+            outError = "Invalid buffer type";
+            return nullptr;
+        }
+
+        // The payload is read after the metadata, once the destination
+        // buffer is known, so uncompressed frames land directly in the
+        // destination instead of passing through a scratch copy
+        const int64_t payloadOffset = FTELL(mFile);
+
+        if(FSEEK(mFile, bufferItem.size, SEEK_CUR) != 0) {
+            outError = "Invalid metadata";
+            return nullptr;
+        }
+
+        // Version 5 containers write a CRC32C of the payload directly after
+        // it. Verifying on read lets the export path skip corrupted frames
+        // instead of throwing deep inside decode.
+        bool haveCrc = false;
+        uint32_t expectedCrc = 0;
+
+        {
+            const int64_t pos = FTELL(mFile);
+            Item crcItem{};
+
+            if(tryRead(&crcItem, sizeof(Item)) &&
+               crcItem.type == Type::CRC32 &&
+               crcItem.size == sizeof(uint32_t))
+            {
+                if(!tryRead(&expectedCrc, sizeof(uint32_t))) {
+                    outError = "Failed to read data";
+                    return nullptr;
+                }
+
+                haveCrc = true;
+            }
+            else {
+                // Written before version 5
+                FSEEK(mFile, pos, SEEK_SET);
+            }
+        }
+
         std::shared_ptr<RawImageBuffer> buffer;
         
         auto bufferIt = mBuffers.find(frame);
@@ -459,58 +2308,142 @@ namespace motioncam {
             buffer = bufferIt->second;
         }
         
-        // Read metadata if buffer was not found
+        // Read metadata if buffer was not found. Parsing the metadata can
+        // throw on malformed frames, keep that off the exception-free path.
         if(!buffer) {
-            buffer = readMetadata();
-            
+            try {
+                buffer = readMetadata();
+            }
+            catch(std::exception& e) {
+                outError = e.what();
+                return nullptr;
+            }
+
             // If we can't read the metadata, return
             if(!buffer)
                 return nullptr;
-            
+
             mBuffers.insert(std::make_pair(frame, buffer));
         }
         
-        // If we have read the buffer, uncompress it if necessary
+        // Read the payload now that the destination is known
         if(readData) {
-            if(buffer->isCompressed) {
-                uncompressBuffer(data, buffer);
+            if(mMapped &&
+               payloadOffset >= 0 &&
+               static_cast<uint64_t>(payloadOffset) + bufferItem.size <= mMappedSize)
+            {
+                // Serve the payload straight from the mapping. Compressed
+                // frames decode from the page cache with no scratch read and
+                // no copy; residency is left to the kernel since merging
+                // exports revisit the same regions.
+                const uint8_t* payload = mMapped + payloadOffset;
+
+                if(haveCrc && Crc32c(payload, bufferItem.size) != expectedCrc) {
+                    outError = "Frame checksum mismatch";
+                    return nullptr;
+                }
+
+                if(buffer->isCompressed) {
+                    if(!uncompressBuffer(payload, bufferItem.size, buffer)) {
+                        outError = "Failed to uncompress buffer";
+                        return nullptr;
+                    }
+                }
+                else {
+                    buffer->data->allocate(bufferItem.size);
+
+                    if(buffer->data->len() < bufferItem.size) {
+                        outError = "Failed to allocate buffer";
+                        return nullptr;
+                    }
+
+                    auto* output = buffer->data->lock(true);
+
+                    std::memcpy(output, payload, bufferItem.size);
+
+                    buffer->data->unlock();
+                    buffer->data->setValidRange(0, bufferItem.size);
+                }
             }
-            else {
-                buffer->data->copyHostData(data);
+            else if(buffer->isCompressed) {
+                if(FSEEK(mFile, payloadOffset, SEEK_SET) != 0) {
+                    outError = "Invalid offset";
+                    return nullptr;
+                }
+
+                // resize() keeps the capacity, so steady state reads reuse
+                // the same scratch instead of allocating per frame
+                mReadScratch.resize(bufferItem.size);
+
+                if(!tryRead(mReadScratch.data(), bufferItem.size)) {
+                    outError = "Failed to read data";
+                    return nullptr;
+                }
+
+                if(haveCrc && Crc32c(mReadScratch.data(), mReadScratch.size()) != expectedCrc) {
+                    outError = "Frame checksum mismatch";
+                    return nullptr;
+                }
+
+                if(!uncompressBuffer(mReadScratch.data(), bufferItem.size, buffer)) {
+                    outError = "Failed to uncompress buffer";
+                    return nullptr;
+                }
+
+                adviseSequentialRead(offset, payloadOffset + bufferItem.size);
             }
-        }
-        
-        // Finally crop shading map
-        auto shadingMap = buffer->metadata.shadingMap();
+            else {
+                if(FSEEK(mFile, payloadOffset, SEEK_SET) != 0) {
+                    outError = "Invalid offset";
+                    return nullptr;
+                }
 
-        if(shadingMap.empty()) {
-            std::vector<cv::Mat> emptyShadingMap;
-            cv::Mat m(24, 18, CV_32F, cv::Scalar(1.0f));
+                // Uncompressed frames read straight into the destination
+                // buffer, skipping the intermediate copy
+                buffer->data->allocate(bufferItem.size);
 
-            for(int i = 0; i < 4; i++)
-                emptyShadingMap.push_back(m.clone());
+                if(buffer->data->len() < bufferItem.size) {
+                    outError = "Failed to allocate buffer";
+                    return nullptr;
+                }
 
-            buffer->metadata.updateShadingMap(emptyShadingMap);
-        }
-        else {
-            util::CropShadingMap(shadingMap,
-                                 buffer->width,
-                                 buffer->height,
-                                 buffer->originalWidth,
-                                 buffer->originalHeight,
-                                 buffer->isBinned);
+                auto* output = buffer->data->lock(true);
 
-            buffer->metadata.updateShadingMap(shadingMap);
+                const bool readOk = tryRead(output, bufferItem.size);
+                const bool crcOk = !readOk || !haveCrc || Crc32c(output, bufferItem.size) == expectedCrc;
+
+                buffer->data->unlock();
+
+                if(!readOk) {
+                    outError = "Failed to read data";
+                    return nullptr;
+                }
+
+                if(!crcOk) {
+                    outError = "Frame checksum mismatch";
+                    return nullptr;
+                }
+
+                buffer->data->setValidRange(0, bufferItem.size);
+            }
         }
+        
+        // Finally crop shading map
+        FinalizeShadingMap(buffer);
+
+        if(readData)
+            cacheFrame(frame, buffer);
 
         return buffer;
     }
 
     int64_t RawContainerImpl::getFrameTimestamp(const std::string& frame) const {
-        if(mFrameOffsetMap.find(frame) != mFrameOffsetMap.end()) {
-            return mFrameOffsetMap.at(frame).timestamp;
+        ItemOffset itemOffset;
+
+        if(findOffset(frame, itemOffset)) {
+            return itemOffset.timestamp;
         }
-        
+
         if(mBuffers.find(frame) != mBuffers.end()) {
             return mBuffers.at(frame)->metadata.timestampNs;
         }
@@ -521,24 +2454,137 @@ namespace motioncam {
     std::shared_ptr<RawImageBuffer> RawContainerImpl::getFrame(const std::string& frame) {
         if(mBuffers.find(frame) != mBuffers.end())
             return mBuffers.at(frame);
-                
-        return readFrame(frame, false);
+
+        std::string error;
+        auto buffer = readFrame(frame, false, error);
+
+        if(!buffer && !error.empty())
+            throw IOException(error);
+
+        return buffer;
     }
 
     std::shared_ptr<RawImageBuffer> RawContainerImpl::loadFrame(const std::string& frame) {
+        std::string error;
+        auto buffer = tryLoadFrame(frame, error);
+
+        if(!buffer && !error.empty())
+            throw IOException(error);
+
+        return buffer;
+    }
+
+    size_t RawContainerImpl::getFrameCount() const {
+        if(mMode == Mode::READ && mRemovedFrames.empty()) {
+            if(!mOffsets.empty())
+                return mOffsets.size();
+
+            if(mNumOffsets > 0)
+                return mNumOffsets;
+        }
+
+        return RawContainer::getFrameCount();
+    }
+
+    int64_t RawContainerImpl::getFrameTimestamp(const size_t index) const {
+        ItemOffset itemOffset;
+
+        if(frameOffsetAt(index, itemOffset))
+            return itemOffset.timestamp;
+
+        return RawContainer::getFrameTimestamp(index);
+    }
+
+    size_t RawContainerImpl::seekFrameIndex(const int64_t timestampNs) const {
+        // Removed frames shift the numbering, so those containers go back
+        // through the generic path
+        if(mMode != Mode::READ || !mRemovedFrames.empty())
+            return RawContainer::seekFrameIndex(timestampNs);
+
+        // Created and recovered containers keep their offsets in memory,
+        // sorted by timestamp
+        if(!mOffsets.empty()) {
+            auto it = std::lower_bound(
+                mOffsets.begin(), mOffsets.end(), timestampNs,
+                [](const ItemOffset& a, int64_t t) { return a.timestamp < t; });
+
+            if(it == mOffsets.end())
+                return mOffsets.size() - 1;
+
+            const size_t lo = static_cast<size_t>(it - mOffsets.begin());
+
+            if(lo > 0 && timestampNs - mOffsets[lo - 1].timestamp <= it->timestamp - timestampNs)
+                return lo - 1;
+
+            return lo;
+        }
+
+        if(mNumOffsets == 0)
+            return 0;
+
+        // Binary search through the paged index, without constructing a
+        // frame name per probe
+        size_t lo = 0;
+        size_t hi = mNumOffsets;
+
+        while(lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+
+            if(indexEntryAt(mid).timestamp < timestampNs)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        if(lo == mNumOffsets)
+            return mNumOffsets - 1;
+
+        if(lo > 0 && timestampNs - indexEntryAt(lo - 1).timestamp <= indexEntryAt(lo).timestamp - timestampNs)
+            return lo - 1;
+
+        return lo;
+    }
+
+    std::shared_ptr<RawImageBuffer> RawContainerImpl::loadFrame(const size_t index) {
+        ItemOffset itemOffset;
+
+        if(!frameOffsetAt(index, itemOffset))
+            return RawContainer::loadFrame(index);
+
+        // The metadata map and decoded cache stay keyed by name, so build
+        // the name once from the timestamp instead of parsing it back out
+        // and searching the index for it
+        const auto frame = GetBufferName(itemOffset.timestamp);
+
+        auto bufferIt = mBuffers.find(frame);
+        if(bufferIt != mBuffers.end() && bufferIt->second->data->len() > 0)
+            return bufferIt->second;
+
+        std::string error;
+        auto buffer = readFrameAt(itemOffset, frame, true, error);
+
+        if(!buffer && !error.empty())
+            throw IOException(error);
+
+        return buffer;
+    }
+
+    std::shared_ptr<RawImageBuffer> RawContainerImpl::tryLoadFrame(const std::string& frame, std::string& outError) noexcept {
         std::shared_ptr<RawImageBuffer> buffer;
-        
+
         if(mBuffers.find(frame) != mBuffers.end())
             buffer = mBuffers.at(frame);
 
         if(buffer && buffer->data->len() > 0) {
             return buffer;
         }
-        
-        return readFrame(frame, true);
+
+        return readFrame(frame, true, outError);
     }
 
     void RawContainerImpl::removeFrame(const std::string& frame) {
+        evictCachedFrame(frame);
+
         // Remove from buffers map, frame list and offset map
         auto frameMapIt = mBuffers.find(frame);
         if(frameMapIt != mBuffers.end()) {
@@ -548,10 +2594,12 @@ namespace motioncam {
         auto frameIt = std::find(mFrameList.begin(), mFrameList.end(), frame);
         if(frameIt != mFrameList.end())
             mFrameList.erase(frameIt);
-        
-        auto offsetIt = mFrameOffsetMap.find(frame);
-        if(offsetIt != mFrameOffsetMap.end())
-            mFrameOffsetMap.erase(offsetIt);
+
+        try {
+            mRemovedFrames.insert(std::stoll(frame));
+        }
+        catch(std::exception& e) {
+        }
     }
 
     bool RawContainerImpl::isInMemory() const {
@@ -559,6 +2607,7 @@ namespace motioncam {
     }
 
     int RawContainerImpl::getNumSegments() const {
+        loadMetadata();
         return mNumSegments;
     }
 
@@ -567,14 +2616,539 @@ namespace motioncam {
     }
 
     void RawContainerImpl::write(const void* data, size_t size, size_t items) const {
+        if(mDirectIo) {
+            stageWrite(data, size * items);
+            return;
+        }
+
         if(fwrite(data, size, items, mFile) != items) {
             throw IOException("Failed to write data");
         }
     }
 
+    // Puts the descriptor into direct I/O mode for streamed recordings.
+    // Writes accumulate in an aligned staging buffer and are flushed in
+    // aligned blocks, so sustained recording doesn't fill the page cache
+    // and push the capture working set out of memory. Falls back silently
+    // to buffered writes when the filesystem rejects O_DIRECT.
+    void RawContainerImpl::setupDirectIo() {
+#if defined(__ANDROID__) || defined(__linux__)
+        if(!gUseDirectIo)
+            return;
+
+        const int fd = fileno(mFile);
+        if(fd < 0)
+            return;
+
+        // Staging starts at the current position, which has to sit on a
+        // block boundary
+        const int64_t offset = FTELL(mFile);
+        if(offset < 0 || (offset % PAYLOAD_ALIGNMENT) != 0)
+            return;
+
+        if(fflush(mFile) != 0)
+            return;
+
+        const int flags = fcntl(fd, F_GETFL);
+        if(flags < 0 || fcntl(fd, F_SETFL, flags | O_DIRECT) != 0)
+            return;
+
+        mStagingPool.resize(2 * DIRECT_IO_STAGING_BYTES + PAYLOAD_ALIGNMENT);
+
+        const uintptr_t base = reinterpret_cast<uintptr_t>(mStagingPool.data());
+        const uintptr_t aligned =
+            (base + PAYLOAD_ALIGNMENT - 1) & ~static_cast<uintptr_t>(PAYLOAD_ALIGNMENT - 1);
+
+        mStaging = reinterpret_cast<uint8_t*>(aligned);
+        mStagingNext = mStaging + DIRECT_IO_STAGING_BYTES;
+        mStagingOffset = offset;
+        mStagingBytes = 0;
+        mWriteBehindFailed = false;
+        mDirectIo = true;
+#endif
+    }
+
+    // Leaves direct I/O mode: flushes the staged blocks, restores buffered
+    // writes and hands the unaligned tail back to stdio. The footer is
+    // written buffered since it seeks and ends off-alignment.
+    void RawContainerImpl::finishDirectIo() {
+        if(!mDirectIo)
+            return;
+
+#if defined(__ANDROID__) || defined(__linux__)
+        flushStagedBlocks();
+
+        // Wait for the in-flight block before the tail goes back through
+        // stdio
+        mWriteBehindGroup.wait();
+
+        if(mWriteBehindFailed)
+            throw IOException("Failed to write data");
+
+        const int fd = fileno(mFile);
+        const int flags = fcntl(fd, F_GETFL);
+
+        if(flags >= 0)
+            fcntl(fd, F_SETFL, flags & ~O_DIRECT);
+
+        mDirectIo = false;
+
+        if(FSEEK(mFile, mStagingOffset, SEEK_SET) != 0)
+            throw IOException("Failed to write data");
+
+        if(mStagingBytes > 0) {
+            write(mStaging, mStagingBytes);
+            mStagingBytes = 0;
+        }
+
+        mStaging = nullptr;
+        mStagingNext = nullptr;
+        mStagingPool.clear();
+        mStagingPool.shrink_to_fit();
+#endif
+    }
+
+    void RawContainerImpl::stageWrite(const void* data, size_t size) const {
+        const uint8_t* src = static_cast<const uint8_t*>(data);
+
+        while(size > 0) {
+            const size_t chunk = (std::min)(size, DIRECT_IO_STAGING_BYTES - mStagingBytes);
+
+            std::memcpy(mStaging + mStagingBytes, src, chunk);
+
+            mStagingBytes += chunk;
+            src += chunk;
+            size -= chunk;
+
+            if(mStagingBytes == DIRECT_IO_STAGING_BYTES)
+                flushStagedBlocks();
+        }
+    }
+
+    // Hands the aligned prefix of the staging buffer to a background write
+    // and keeps filling the other block, so the IO thread runs at memcpy
+    // speed instead of at flash latency. The unaligned tail carries over
+    // into the block the IO thread fills next.
+    void RawContainerImpl::flushStagedBlocks() const {
+#if defined(__ANDROID__) || defined(__linux__)
+        const size_t alignedBytes = mStagingBytes & ~static_cast<size_t>(PAYLOAD_ALIGNMENT - 1);
+
+        if(alignedBytes == 0)
+            return;
+
+        // Only one block is ever in flight; its buffer can't be reused
+        // until the write lands
+        mWriteBehindGroup.wait();
+
+        if(mWriteBehindFailed)
+            throw IOException("Failed to write data");
+
+        uint8_t* block = mStaging;
+        const int64_t blockOffset = mStagingOffset;
+
+        if(mStagingBytes > alignedBytes)
+            std::memcpy(mStagingNext, block + alignedBytes, mStagingBytes - alignedBytes);
+
+        std::swap(mStaging, mStagingNext);
+
+        mStagingOffset += static_cast<int64_t>(alignedBytes);
+        mStagingBytes -= alignedBytes;
+
+        const int fd = fileno(mFile);
+
+        TaskEngine::get().run(TaskPriority::CAPTURE, [this, fd, block, alignedBytes, blockOffset] {
+            size_t written = 0;
+
+            while(written < alignedBytes) {
+                const ssize_t result =
+                    pwrite(fd, block + written, alignedBytes - written, blockOffset + written);
+
+                if(result < 0) {
+                    if(errno == EINTR)
+                        continue;
+
+                    mWriteBehindFailed = true;
+                    return;
+                }
+
+                written += static_cast<size_t>(result);
+            }
+        }, mWriteBehindGroup);
+#endif
+    }
+
+    // Position the next write lands at, accounting for staged bytes that
+    // haven't reached the descriptor yet
+    int64_t RawContainerImpl::streamPosition() const {
+        if(mDirectIo)
+            return mStagingOffset + static_cast<int64_t>(mStagingBytes);
+
+        return FTELL(mFile);
+    }
+
+    // Writes the segments through a single writev() where the platform has
+    // it. writeBuffer() gathers a frame's item headers, payload and metadata
+    // through this so a frame costs one syscall instead of one per item.
+    void RawContainerImpl::writeGather(const WriteSegment* segments, const int count) const {
+        // Direct mode already coalesces through the staging buffer
+        if(mDirectIo) {
+            for(int i = 0; i < count; i++)
+                stageWrite(segments[i].data, segments[i].size);
+
+            return;
+        }
+
+#if defined(_WIN32)
+        for(int i = 0; i < count; i++)
+            write(segments[i].data, segments[i].size);
+#else
+        // Flush so the descriptor offset matches the stream position before
+        // writing past stdio
+        if(fflush(mFile) != 0)
+            throw IOException("Failed to write data");
+
+        const int64_t offset = FTELL(mFile);
+
+        std::vector<struct iovec> iov(count);
+        int64_t total = 0;
+
+        for(int i = 0; i < count; i++) {
+            iov[i].iov_base = const_cast<void*>(segments[i].data);
+            iov[i].iov_len = segments[i].size;
+
+            total += static_cast<int64_t>(segments[i].size);
+        }
+
+        const int fd = fileno(mFile);
+
+        struct iovec* cur = iov.data();
+        int remaining = count;
+
+        while(remaining > 0) {
+            const ssize_t bytesWritten = ::writev(fd, cur, remaining);
+
+            if(bytesWritten < 0) {
+                if(errno == EINTR)
+                    continue;
+
+                throw IOException("Failed to write data");
+            }
+
+            // Step past fully written segments and trim a partially
+            // written one
+            size_t skip = static_cast<size_t>(bytesWritten);
+
+            while(remaining > 0 && skip >= cur->iov_len) {
+                skip -= cur->iov_len;
+
+                ++cur;
+                --remaining;
+            }
+
+            if(remaining > 0 && skip > 0) {
+                cur->iov_base = static_cast<uint8_t*>(cur->iov_base) + skip;
+                cur->iov_len -= skip;
+            }
+        }
+
+        // Bring the stream position back in line with the descriptor
+        if(FSEEK(mFile, offset + total, SEEK_SET) != 0)
+            throw IOException("Failed to write data");
+#endif
+    }
+
     void RawContainerImpl::read(void* data, size_t size, size_t items) const {
-        if(fread(data, size, items, mFile) != items) {
+        if(!tryRead(data, size, items)) {
             throw IOException("Failed to read data");
         }
     }
+
+    bool RawContainerImpl::tryRead(void* data, size_t size, size_t items) const {
+        return fread(data, size, items, mFile) == items;
+    }
+
+    std::unique_ptr<RawContainerReader> RawContainerImpl::createReader() {
+#if defined(_WIN32)
+        // No pread() equivalent; callers fall back to serialized loads
+        return nullptr;
+#else
+        if(mMode != Mode::READ || !mFile)
+            return nullptr;
+
+        const int fd = fileno(mFile);
+        if(fd < 0)
+            return nullptr;
+
+        return std::unique_ptr<RawContainerReader>(new RawContainerReader(*this, fd));
+#endif
+    }
+
+    RawContainerReader::RawContainerReader(RawContainerImpl& container, const int fd) :
+        mContainer(container),
+        mFd(fd)
+    {
+    }
+
+    bool RawContainerReader::readAt(void* data, size_t size, int64_t offset) const {
+#if defined(_WIN32)
+        return false;
+#else
+        auto* dst = static_cast<uint8_t*>(data);
+
+        // Ranges inside the container mapping are a straight copy from the
+        // page cache. Data past the mapped size (a proxy track appended
+        // after the container was opened) still goes through the descriptor.
+        if(mContainer.mMapped &&
+           offset >= 0 &&
+           static_cast<uint64_t>(offset) + size <= mContainer.mMappedSize)
+        {
+            std::memcpy(dst, mContainer.mMapped + offset, size);
+            return true;
+        }
+
+        while(size > 0) {
+            const ssize_t bytesRead = pread(mFd, dst, size, offset);
+
+            if(bytesRead <= 0) {
+                if(bytesRead < 0 && errno == EINTR)
+                    continue;
+
+                return false;
+            }
+
+            dst += bytesRead;
+            offset += bytesRead;
+            size -= bytesRead;
+        }
+
+        return true;
+#endif
+    }
+
+    std::shared_ptr<RawImageBuffer> RawContainerReader::loadFrame(const std::string& frame) {
+        std::string error;
+        auto buffer = tryLoadFrame(frame, error);
+
+        if(!buffer && !error.empty())
+            throw IOException(error);
+
+        return buffer;
+    }
+
+    std::shared_ptr<RawImageBuffer> RawContainerReader::tryLoadFrame(const std::string& frame, std::string& outError) noexcept {
+        // The decoded cache is shared with the owning container, so every
+        // session benefits when a player scrubs over the same region
+        auto cached = mContainer.cachedFrame(frame);
+        if(cached)
+            return cached;
+
+        auto prefetched = mContainer.takePrefetchedFrame(frame);
+        if(prefetched)
+            return prefetched;
+
+        ItemOffset itemOffset;
+
+        if(!mContainer.findOffset(frame, itemOffset))
+            return nullptr;
+
+        const int64_t offset = itemOffset.offset;
+
+        Item bufferItem{};
+
+        if(!readAt(&bufferItem, sizeof(Item), offset)) {
+            outError = "Failed to read data";
+            return nullptr;
+        }
+
+        if(bufferItem.type != Type::BUFFER) {
+            outError = "Invalid buffer type";
+            return nullptr;
+        }
+
+        // The payload is read after the metadata, once the destination
+        // buffer is known, so uncompressed frames land directly in the
+        // destination instead of passing through a scratch copy
+        const int64_t payloadOffset = offset + static_cast<int64_t>(sizeof(Item));
+
+        // The frame metadata is written directly after the payload, with the
+        // payload checksum in between from version 5 onwards
+        int64_t metadataOffset = payloadOffset + bufferItem.size;
+
+        bool haveCrc = false;
+        uint32_t expectedCrc = 0;
+
+        Item crcItem{};
+
+        if(readAt(&crcItem, sizeof(Item), metadataOffset) &&
+           crcItem.type == Type::CRC32 &&
+           crcItem.size == sizeof(uint32_t))
+        {
+            if(!readAt(&expectedCrc, sizeof(uint32_t), metadataOffset + static_cast<int64_t>(sizeof(Item)))) {
+                outError = "Failed to read data";
+                return nullptr;
+            }
+
+            haveCrc = true;
+
+            metadataOffset += static_cast<int64_t>(sizeof(Item)) + static_cast<int64_t>(sizeof(uint32_t));
+        }
+
+        Item metadataItem{};
+
+        if(!readAt(&metadataItem, sizeof(Item), metadataOffset)) {
+            outError = "Failed to read data";
+            return nullptr;
+        }
+
+        if(metadataItem.type != Type::METADATA &&
+           metadataItem.type != Type::METADATA_ZSTD &&
+           metadataItem.type != Type::METADATA_BIN)
+        {
+            outError = "Invalid metadata";
+            return nullptr;
+        }
+
+        // Each session parses the frame metadata itself instead of sharing
+        // the container's buffer cache, so no locking is needed on the load
+        // path
+        std::shared_ptr<RawImageBuffer> buffer;
+
+        try {
+            if(metadataItem.type == Type::METADATA_BIN) {
+                // Version 6 containers write the metadata as a fixed binary
+                // record
+                FrameMetadataRecord record{};
+
+                if(metadataItem.size != sizeof(FrameMetadataRecord) ||
+                   !readAt(&record, sizeof(FrameMetadataRecord), metadataOffset + static_cast<int64_t>(sizeof(Item))))
+                {
+                    outError = "Invalid metadata";
+                    return nullptr;
+                }
+
+                buffer = std::make_shared<RawImageBuffer>();
+                ApplyFrameMetadataRecord(record, *buffer);
+            }
+            else {
+                std::vector<uint8_t> metadataJson(metadataItem.size);
+
+                if(!readAt(metadataJson.data(), metadataItem.size, metadataOffset + static_cast<int64_t>(sizeof(Item)))) {
+                    outError = "Failed to read data";
+                    return nullptr;
+                }
+
+                std::string m;
+
+                if(metadataItem.type == Type::METADATA_ZSTD) {
+                    if(!mContainer.decompressMetadata(metadataJson, m)) {
+                        outError = "Invalid metadata";
+                        return nullptr;
+                    }
+                }
+                else {
+                    m.assign(metadataJson.begin(), metadataJson.end());
+                }
+
+                std::string err;
+
+                auto metadata = json11::Json::parse(m, err);
+                if(!err.empty()) {
+                    outError = "Invalid metadata";
+                    return nullptr;
+                }
+
+                buffer = std::make_shared<RawImageBuffer>(metadata);
+            }
+
+            // Version 4 containers write the shading map as a packed f16
+            // record directly after the metadata
+            const int64_t shadingMapOffset =
+                metadataOffset + static_cast<int64_t>(sizeof(Item)) + metadataItem.size;
+
+            Item shadingMapItem{};
+
+            if(readAt(&shadingMapItem, sizeof(Item), shadingMapOffset) &&
+               shadingMapItem.type == Type::SHADING_MAP)
+            {
+                std::vector<uint8_t> payload(shadingMapItem.size);
+
+                if(readAt(payload.data(), shadingMapItem.size, shadingMapOffset + static_cast<int64_t>(sizeof(Item))))
+                    ParseShadingMapRecord(payload, buffer);
+            }
+
+            if(buffer->isCompressed) {
+                const uint8_t* payload = nullptr;
+
+                if(mContainer.mMapped &&
+                   payloadOffset >= 0 &&
+                   static_cast<uint64_t>(payloadOffset) + bufferItem.size <= mContainer.mMappedSize)
+                {
+                    // Decode straight from the mapping, skipping the
+                    // scratch copy entirely
+                    payload = mContainer.mMapped + payloadOffset;
+                }
+                else {
+                    // resize() keeps the capacity, so each session reuses
+                    // its scratch instead of allocating per frame
+                    mScratch.resize(bufferItem.size);
+
+                    if(!readAt(mScratch.data(), bufferItem.size, payloadOffset)) {
+                        outError = "Failed to read data";
+                        return nullptr;
+                    }
+
+                    payload = mScratch.data();
+                }
+
+                if(haveCrc && Crc32c(payload, bufferItem.size) != expectedCrc) {
+                    outError = "Frame checksum mismatch";
+                    return nullptr;
+                }
+
+                if(!mContainer.uncompressBuffer(payload, bufferItem.size, buffer)) {
+                    outError = "Failed to uncompress buffer";
+                    return nullptr;
+                }
+            }
+            else {
+                // Uncompressed frames read straight into the destination
+                // buffer, skipping the intermediate copy
+                buffer->data->allocate(bufferItem.size);
+
+                if(buffer->data->len() < bufferItem.size) {
+                    outError = "Failed to allocate buffer";
+                    return nullptr;
+                }
+
+                auto* output = buffer->data->lock(true);
+
+                const bool readOk = readAt(output, bufferItem.size, payloadOffset);
+                const bool crcOk = !readOk || !haveCrc || Crc32c(output, bufferItem.size) == expectedCrc;
+
+                buffer->data->unlock();
+
+                if(!readOk) {
+                    outError = "Failed to read data";
+                    return nullptr;
+                }
+
+                if(!crcOk) {
+                    outError = "Frame checksum mismatch";
+                    return nullptr;
+                }
+
+                buffer->data->setValidRange(0, bufferItem.size);
+            }
+
+            FinalizeShadingMap(buffer);
+        }
+        catch(std::exception& e) {
+            outError = e.what();
+            return nullptr;
+        }
+
+        mContainer.cacheFrame(frame, buffer);
+
+        return buffer;
+    }
 }
@@ -5,8 +5,10 @@
 #include "motioncam/RawImageBuffer.h"
 #include "motioncam/RawCameraMetadata.h"
 #include "motioncam/Settings.h"
+#include "motioncam/TaskEngine.h"
 
 #include <zstd.h>
+#include <cstring>
 #include <utility>
 #include <vector>
 #include <vint.h>
@@ -282,103 +284,64 @@ namespace motioncam {
         return 0;
     }
 
-    shared_ptr<RawImageBuffer> RawContainerImpl_Legacy::loadFrame(const string& frame) {
-        auto buffer = mFrameBuffers.find(frame);
-        if(buffer == mFrameBuffers.end()) {
-            throw IOException("Cannot find " + frame + " in container");
-        }
-        
-        // If we've already loaded the data, return it
-        if(buffer->second->data->len() > 0)
-            return buffer->second;
-        
-        // Load the data into the buffer
-        vector<uint8_t> data;
-
-        if(mZipReader) {
-            mZipReader->read(frame, data);
-        }
-        else if(mFile) {
-            int result = FSEEK(mFile, buffer->second->offset, SEEK_SET);
-
-            if(result != 0)
-                throw IOException("Cannot read " + frame + " in container");
-
-            FrameChunk frameChunk;
-            
-            if(fread(&frameChunk, sizeof(frameChunk), 1, mFile) != 1) {
-                throw IOException("Cannot read frame chunk header");
-            }
-            
-            if(frameChunk.chunkId[1] != FRAME_CHUNK) {
-                throw IOException("Invalid frame chunk id");
-            }
-            
-            data.reserve(frameChunk.frameSize + (buffer->second->rowStride * 4)); // Reserve extra space at the end
-            data.resize(frameChunk.frameSize);
-            
-            if(fread(data.data(), frameChunk.frameSize, 1, mFile) != 1) {
-                throw IOException("Invalid frame chunk id");
-            }
-        }
-        else {
-            throw IOException("Cannot read frame chunk");
-        }
-        
-        if(buffer->second->isCompressed) {
-            if(buffer->second->compressionType == CompressionType::ZSTD) {
+    // Decompresses the raw entry bytes into the buffer and crops its shading
+    // map. Touches only the given buffer so decodes of different frames can
+    // run concurrently. Returns false if the data is invalid.
+    static bool DecodeFrameData(vector<uint8_t>& data, const shared_ptr<RawImageBuffer>& buffer) {
+        if(buffer->isCompressed) {
+            if(buffer->compressionType == CompressionType::ZSTD) {
                 vector<uint8_t> tmp;
-                
+
                 size_t outputSize = ZSTD_getFrameContentSize(static_cast<void*>(&data[0]), data.size());
                 if( outputSize == ZSTD_CONTENTSIZE_UNKNOWN ||
                     outputSize == ZSTD_CONTENTSIZE_ERROR )
                 {
                     // Invalid data
-                    return nullptr;
+                    return false;
                 }
 
                 tmp.resize(outputSize);
-                
+
                 long readBytes =
                     ZSTD_decompress(static_cast<void*>(&tmp[0]), tmp.size(), &data[0], data.size());
-                
+
                 tmp.resize(readBytes);
-                
-                buffer->second->data->copyHostData(tmp);
+
+                buffer->data->copyHostData(tmp);
             }
-            else if(buffer->second->compressionType == CompressionType::V8NZENC     ||
-                    buffer->second->compressionType == CompressionType::P4NZENC     ||
-                    buffer->second->compressionType == CompressionType::BITNZPACK   ||
-                    buffer->second->compressionType == CompressionType::BITNZPACK_2)
+            else if(buffer->compressionType == CompressionType::V8NZENC     ||
+                    buffer->compressionType == CompressionType::P4NZENC     ||
+                    buffer->compressionType == CompressionType::BITNZPACK   ||
+                    buffer->compressionType == CompressionType::BITNZPACK_2)
             {
-                std::vector<uint16_t> rowOutput(2*buffer->second->width);
-                std::vector<uint8_t> uncompressedBuffer(2*buffer->second->width*buffer->second->height);
-                
-                const uint16_t rowSize = buffer->second->width;
-            
+                std::vector<uint16_t> rowOutput(2*buffer->width);
+                std::vector<uint8_t> uncompressedBuffer(2*buffer->width*buffer->height);
+
+                const uint16_t rowSize = buffer->width;
+
                 auto decodeFunc = &v8nzdec128v16;
-                
-                if(buffer->second->compressionType == CompressionType::P4NZENC)
+
+                if(buffer->compressionType == CompressionType::P4NZENC)
                     decodeFunc = &p4nzdec128v16;
-                else if(buffer->second->compressionType == CompressionType::BITNZPACK)
+                else if(buffer->compressionType == CompressionType::BITNZPACK)
                     decodeFunc = &bitnzunpack128v16;
-                else if(buffer->second->compressionType == CompressionType::BITNZPACK_2)
+                else if(buffer->compressionType == CompressionType::BITNZPACK_2)
                     decodeFunc = &bitnzunpack16;
-                else if(buffer->second->compressionType == CompressionType::V8NZENC)
+                else if(buffer->compressionType == CompressionType::V8NZENC)
                     decodeFunc = &v8nzdec128v16;
                 else
-                    return nullptr;
-                
+                    return false;
+
                 size_t offset = 0;
                 size_t p = 0;
 
                 // Allocate extra padding on the input
-                data.resize(data.size() + buffer->second->rowStride * 4);
-                
+                data.resize(data.size() + buffer->rowStride * 4);
+
                 // Read the image
-                for(int y = 0; y < buffer->second->height; y++) {
+                for(int y = 0; y < buffer->height; y++) {
                     size_t readBytes = decodeFunc(data.data() + offset, rowSize, rowOutput.data());
-                    
+
                     // Reshuffle the row
                     for(size_t i = 0; i < rowSize/2; i++) {
                         uncompressedBuffer[p]   = rowOutput[i];
@@ -389,36 +352,193 @@ namespace motioncam {
 
                         p+=4;
                     }
-                    
+
                     offset += readBytes;
                 }
-                
-                buffer->second->data->copyHostData(uncompressedBuffer);
+
+                buffer->data->copyHostData(uncompressedBuffer);
             }
             else {
                 // Unknown compression type
-                return nullptr;
+                return false;
             }
         }
         else {
-            buffer->second->data->copyHostData(data);
+            buffer->data->copyHostData(data);
         }
-        
+
         // Crop the shading map at the point that it is loaded
-        auto shadingMap = buffer->second->metadata.shadingMap();
-        
+        auto shadingMap = buffer->metadata.shadingMap();
+
         util::CropShadingMap(shadingMap,
-                             buffer->second->width,
-                             buffer->second->height,
-                             buffer->second->originalWidth,
-                             buffer->second->originalHeight,
-                             buffer->second->isBinned);
+                             buffer->width,
+                             buffer->height,
+                             buffer->originalWidth,
+                             buffer->originalHeight,
+                             buffer->isBinned);
+
+        buffer->metadata.updateShadingMap(shadingMap);
+
+        return true;
+    }
+
+    // Variant for views into an mmap backed archive. ZSTD decompresses
+    // straight out of the mapping and uncompressed payloads copy into the
+    // buffer directly, skipping the intermediate entry copy. The row codecs
+    // need mutable padded input, so they fall back to the copying path.
+    static bool DecodeFrameData(const uint8_t* data, const size_t size, const shared_ptr<RawImageBuffer>& buffer) {
+        if(buffer->isCompressed && buffer->compressionType == CompressionType::ZSTD) {
+            vector<uint8_t> tmp;
+
+            size_t outputSize = ZSTD_getFrameContentSize(data, size);
+            if( outputSize == ZSTD_CONTENTSIZE_UNKNOWN ||
+                outputSize == ZSTD_CONTENTSIZE_ERROR )
+            {
+                // Invalid data
+                return false;
+            }
+
+            tmp.resize(outputSize);
+
+            long readBytes =
+                ZSTD_decompress(static_cast<void*>(&tmp[0]), tmp.size(), data, size);
+
+            tmp.resize(readBytes);
+
+            buffer->data->copyHostData(tmp);
+        }
+        else if(!buffer->isCompressed) {
+            buffer->data->allocate(size);
+
+            auto* dst = buffer->data->lock(true);
+            std::memcpy(dst, data, size);
+            buffer->data->unlock();
+        }
+        else {
+            vector<uint8_t> copy(data, data + size);
+
+            return DecodeFrameData(copy, buffer);
+        }
+
+        // Crop the shading map at the point that it is loaded
+        auto shadingMap = buffer->metadata.shadingMap();
+
+        util::CropShadingMap(shadingMap,
+                             buffer->width,
+                             buffer->height,
+                             buffer->originalWidth,
+                             buffer->originalHeight,
+                             buffer->isBinned);
+
+        buffer->metadata.updateShadingMap(shadingMap);
+
+        return true;
+    }
+
+    void RawContainerImpl_Legacy::readFrameBytes(const shared_ptr<RawImageBuffer>& buffer, const string& frame, vector<uint8_t>& outData) {
+        // The zip reader and the container file keep a single read position,
+        // so entry reads are serialized here
+        std::lock_guard<std::mutex> lock(mIoMutex);
+
+        if(mZipReader) {
+            mZipReader->read(frame, outData);
+        }
+        else if(mFile) {
+            int result = FSEEK(mFile, buffer->offset, SEEK_SET);
+
+            if(result != 0)
+                throw IOException("Cannot read " + frame + " in container");
+
+            FrameChunk frameChunk;
+
+            if(fread(&frameChunk, sizeof(frameChunk), 1, mFile) != 1) {
+                throw IOException("Cannot read frame chunk header");
+            }
+
+            if(frameChunk.chunkId[1] != FRAME_CHUNK) {
+                throw IOException("Invalid frame chunk id");
+            }
+
+            outData.reserve(frameChunk.frameSize + (buffer->rowStride * 4)); // Reserve extra space at the end
+            outData.resize(frameChunk.frameSize);
+
+            if(fread(outData.data(), frameChunk.frameSize, 1, mFile) != 1) {
+                throw IOException("Invalid frame chunk id");
+            }
+        }
+        else {
+            throw IOException("Cannot read frame chunk");
+        }
+    }
+
+    shared_ptr<RawImageBuffer> RawContainerImpl_Legacy::loadFrame(const string& frame) {
+        auto buffer = mFrameBuffers.find(frame);
+        if(buffer == mFrameBuffers.end()) {
+            throw IOException("Cannot find " + frame + " in container");
+        }
+
+        // If we've already loaded the data, return it
+        if(buffer->second->data->len() > 0)
+            return buffer->second;
+
+        // When the archive is memory mapped and the entry is stored, decode
+        // straight out of the mapping instead of extracting it first
+        const uint8_t* viewData = nullptr;
+        size_t viewSize = 0;
+
+        if(mZipReader) {
+            std::lock_guard<std::mutex> lock(mIoMutex);
+
+            mZipReader->view(frame, viewData, viewSize);
+        }
+
+        if(viewData) {
+            if(!DecodeFrameData(viewData, viewSize, buffer->second))
+                return nullptr;
+
+            return buffer->second;
+        }
+
+        // Load the data into the buffer
+        vector<uint8_t> data;
+
+        readFrameBytes(buffer->second, frame, data);
+
+        if(!DecodeFrameData(data, buffer->second))
+            return nullptr;
 
-        buffer->second->metadata.updateShadingMap(shadingMap);
-        
         return buffer->second;
     }
 
+    void RawContainerImpl_Legacy::preloadFrames(const vector<string>& frames) {
+        TaskGroup group;
+
+        try {
+            for(const auto& frame : frames) {
+                auto it = mFrameBuffers.find(frame);
+                if(it == mFrameBuffers.end() || it->second->data->len() > 0)
+                    continue;
+
+                auto buffer = it->second;
+                auto data = std::make_shared<vector<uint8_t>>();
+
+                // Read the next entry while the decodes of the previous ones run
+                readFrameBytes(buffer, frame, *data);
+
+                TaskEngine::get().run(TaskPriority::EXPORT, [buffer, data] {
+                    DecodeFrameData(*data, buffer);
+                }, group);
+            }
+        }
+        catch(...) {
+            // Don't leave tasks pointing at a destroyed group
+            group.wait();
+            throw;
+        }
+
+        group.wait();
+    }
+
     shared_ptr<RawImageBuffer> RawContainerImpl_Legacy::getFrame(const string& frame) {
         auto buffer = mFrameBuffers.find(frame);
         if(buffer == mFrameBuffers.end()) {
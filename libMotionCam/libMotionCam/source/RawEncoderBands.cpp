@@ -0,0 +1,226 @@
+#include "motioncam/RawEncoder.h"
+#include "motioncam/TaskEngine.h"
+#include "motioncam/HalidePool.h"
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+namespace motioncam {
+    namespace encoder {
+        // Most bands a frame is split into. Beyond the core count the extra
+        // headers and scratch copies stop paying for themselves.
+        static const int MaxBands = 8;
+
+        // Bands below this many source rows aren't worth the scheduling and
+        // copy overhead; small frames encode as a single stream.
+        static const int MinBandRows = 512;
+
+        // Upper bound accepted when parsing a payload, so a corrupted band
+        // count can't drive the record loop off the end
+        static const uint32_t MaxPayloadBands = 64;
+
+        namespace {
+            struct BandHeader {
+                uint32_t numBands;
+            };
+
+            struct BandRecord {
+                uint32_t compressedSize;
+                uint32_t rows;
+            };
+
+            struct Band {
+                int ystart;
+                int yend;
+                uint8_t* scratch;
+                size_t size;
+            };
+        }
+
+        size_t encodeBanded(uint8_t* data,
+                            PixelFormat pixelFormat,
+                            const int xstart,
+                            const int xend,
+                            const int ystart,
+                            const int yend,
+                            const int rowStride,
+                            const size_t capacity,
+                            const bool bin,
+                            bool& outBanded)
+        {
+            const int rows = yend - ystart;
+
+            int numBands = (std::min)(MaxBands, (std::max)(1, TaskEngine::get().numWorkers()));
+            numBands = (std::min)(numBands, rows / MinBandRows);
+
+            outBanded = false;
+
+            if(numBands <= 1) {
+                return bin ? encodeAndBin(data, pixelFormat, xstart, xend, ystart, yend, rowStride)
+                           : encode(data, pixelFormat, xstart, xend, ystart, yend, rowStride);
+            }
+
+            // Band edges stay on multiples of four source rows so every band
+            // keeps the bayer phase and, when binning, whole 2x2 bin groups
+            const int bandRows = (((rows + numBands - 1) / numBands + 3) / 4) * 4;
+
+            std::vector<Band> bands;
+
+            for(int y = ystart; y < yend; y += bandRows) {
+                Band band;
+
+                band.ystart = y;
+                band.yend = (std::min)(yend, y + bandRows);
+                band.scratch = nullptr;
+                band.size = 0;
+
+                bands.push_back(band);
+            }
+
+            // The codec works in place, so each band encodes a copy of its
+            // source rows. The frame itself stays intact until every band
+            // has finished, which also keeps the plain fallback possible.
+            std::atomic<bool> failed(false);
+
+            TaskGroup group;
+
+            for(auto& band : bands) {
+                TaskEngine::get().run(TaskPriority::CAPTURE,
+                    [&band, &failed, data, pixelFormat, bin, xstart, xend, rowStride] {
+                        const int bandHeight = band.yend - band.ystart;
+                        const size_t bandBytes = static_cast<size_t>(bandHeight) * rowStride;
+
+                        band.scratch = static_cast<uint8_t*>(halidepool::PoolMalloc(bandBytes));
+                        if(!band.scratch) {
+                            failed = true;
+                            return;
+                        }
+
+                        std::memcpy(band.scratch, data + static_cast<size_t>(band.ystart) * rowStride, bandBytes);
+
+                        if(bin)
+                            band.size = encodeAndBin(band.scratch, pixelFormat, xstart, xend, 0, bandHeight, rowStride);
+                        else
+                            band.size = encode(band.scratch, pixelFormat, xstart, xend, 0, bandHeight, rowStride);
+
+                        if(band.size == 0)
+                            failed = true;
+                    }, group);
+            }
+
+            group.wait();
+
+            size_t total = sizeof(BandHeader) + bands.size() * sizeof(BandRecord);
+
+            for(const auto& band : bands)
+                total += band.size;
+
+            // Incompressible frames can leave no room for the band table;
+            // the source is still intact, so encode it as a single stream
+            if(failed || total > capacity) {
+                for(auto& band : bands)
+                    halidepool::PoolFree(band.scratch);
+
+                return bin ? encodeAndBin(data, pixelFormat, xstart, xend, ystart, yend, rowStride)
+                           : encode(data, pixelFormat, xstart, xend, ystart, yend, rowStride);
+            }
+
+            uint8_t* out = data;
+
+            BandHeader header { static_cast<uint32_t>(bands.size()) };
+
+            std::memcpy(out, &header, sizeof(header));
+            out += sizeof(header);
+
+            for(const auto& band : bands) {
+                const int bandHeight = band.yend - band.ystart;
+
+                BandRecord record {
+                    static_cast<uint32_t>(band.size),
+                    static_cast<uint32_t>(bin ? bandHeight / 2 : bandHeight)
+                };
+
+                std::memcpy(out, &record, sizeof(record));
+                out += sizeof(record);
+            }
+
+            for(auto& band : bands) {
+                std::memcpy(out, band.scratch, band.size);
+                out += band.size;
+
+                halidepool::PoolFree(band.scratch);
+            }
+
+            outBanded = true;
+
+            return total;
+        }
+
+        bool decodeBanded(uint16_t* output, const int width, const int height, const uint8_t* input, const size_t len) {
+            if(len < sizeof(BandHeader))
+                return false;
+
+            BandHeader header;
+            std::memcpy(&header, input, sizeof(header));
+
+            if(header.numBands == 0 || header.numBands > MaxPayloadBands)
+                return false;
+
+            size_t offset = sizeof(header);
+
+            if(len < offset + header.numBands * sizeof(BandRecord))
+                return false;
+
+            std::vector<BandRecord> records(header.numBands);
+
+            std::memcpy(records.data(), input + offset, header.numBands * sizeof(BandRecord));
+            offset += header.numBands * sizeof(BandRecord);
+
+            // Validate the table against the payload and frame bounds
+            // before scheduling anything
+            struct BandDecode {
+                const uint8_t* input;
+                size_t size;
+                uint16_t* output;
+                int rows;
+            };
+
+            std::vector<BandDecode> bands;
+            bands.reserve(header.numBands);
+
+            int row = 0;
+
+            for(const auto& record : records) {
+                if(record.compressedSize > len - offset || record.rows > static_cast<uint32_t>(height - row))
+                    return false;
+
+                bands.push_back(BandDecode {
+                    input + offset,
+                    record.compressedSize,
+                    output + static_cast<size_t>(row) * width,
+                    static_cast<int>(record.rows)
+                });
+
+                offset += record.compressedSize;
+                row += static_cast<int>(record.rows);
+            }
+
+            if(row != height)
+                return false;
+
+            // Bands cover disjoint output rows, so they decode concurrently
+            TaskGroup group;
+
+            for(const auto& band : bands) {
+                TaskEngine::get().run(TaskPriority::EXPORT, [&band, width] {
+                    decode(band.output, width, band.rows, band.input, band.size);
+                }, group);
+            }
+
+            group.wait();
+
+            return true;
+        }
+    }
+}
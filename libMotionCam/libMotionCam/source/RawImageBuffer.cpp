@@ -4,7 +4,8 @@
 namespace motioncam {
 
     RawImageBuffer::RawImageBuffer(const json11::Json metadata) :
-        data(new NativeHostBuffer())
+        data(new NativeHostBuffer()),
+        isForeign(false)
     {
         parse(metadata);
     }
@@ -20,7 +21,8 @@ namespace motioncam {
         rowStride(0),
         isCompressed(false),
         compressionType(CompressionType::UNCOMPRESSED),
-        offset(0)
+        offset(0),
+        isForeign(false)
     {
     }
 
@@ -35,7 +37,8 @@ namespace motioncam {
         rowStride(0),
         isCompressed(false),
         compressionType(CompressionType::UNCOMPRESSED),
-        offset(0)
+        offset(0),
+        isForeign(false)
     {
     }
 
@@ -50,7 +53,8 @@ namespace motioncam {
         rowStride(other.rowStride),
         isCompressed(other.isCompressed),
         compressionType(other.compressionType),
-        offset(other.offset)
+        offset(other.offset),
+        isForeign(false)  // clone() below always produces an owned copy
     {
         data = other.data->clone();
     }
@@ -67,7 +71,8 @@ namespace motioncam {
             rowStride(other.rowStride),
             isCompressed(other.isCompressed),
             compressionType(other.compressionType),
-            offset(other.offset)
+            offset(other.offset),
+            isForeign(other.isForeign)
     {
     }
 
@@ -84,6 +89,7 @@ namespace motioncam {
         isCompressed = obj.isCompressed;
         compressionType = obj.compressionType;
         offset = obj.offset;
+        isForeign = false;
         
         return *this;
     }
@@ -187,7 +193,7 @@ namespace motioncam {
         this->metadata.updateShadingMap(GetLensShadingMap(metadata));
     }
 
-    void RawImageBuffer::toJson(json11::Json::object& metadata) const {
+    void RawImageBuffer::toJson(json11::Json::object& metadata, const bool includeShadingMap) const {
         metadata["timestamp"]       = std::to_string(this->metadata.timestampNs);
         metadata["filename"]        = std::to_string(this->metadata.timestampNs);
         metadata["width"]           = this->width;
@@ -248,25 +254,30 @@ namespace motioncam {
         
         if(!this->metadata.shadingMap().empty()) {
             const auto& shadingMap = this->metadata.shadingMap();
-            
+
             metadata["lensShadingMapWidth"]    = shadingMap[0].cols;
             metadata["lensShadingMapHeight"]   = shadingMap[0].rows;
-        
-            std::vector<std::vector<float>> points;
-            
-            for(auto& i : shadingMap) {
-                std::vector<float> p;
-                
-                for(int y = 0; y < i.rows; y++) {
-                    for(int x = 0; x < i.cols; x++) {
-                        p.push_back(i.at<float>(y, x));
+
+            // Skipped when the shading map is written as a binary record
+            // next to the json. Building these arrays per frame is too
+            // expensive for the streamer thread.
+            if(includeShadingMap) {
+                std::vector<std::vector<float>> points;
+
+                for(auto& i : shadingMap) {
+                    std::vector<float> p;
+
+                    for(int y = 0; y < i.rows; y++) {
+                        for(int x = 0; x < i.cols; x++) {
+                            p.push_back(i.at<float>(y, x));
+                        }
                     }
+
+                    points.push_back(p);
                 }
-                
-                points.push_back(p);
+
+                metadata["lensShadingMap"] = std::move(points);
             }
-            
-            metadata["lensShadingMap"] = std::move(points);
         }
         else {
             metadata["lensShadingMapWidth"] = 0;
@@ -2,6 +2,9 @@
 
 #include <json11/json11.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace motioncam {
     std::string getSetting(const json11::Json& json, const std::string& key, const std::string& defaultValue) {
         auto objs = json.object_items();
@@ -146,4 +149,91 @@ namespace motioncam {
 
         json["captureMode"]                     = captureMode;
     }
+
+    static void PackString(char* dst, const std::string& src) {
+        const size_t len = (std::min)(src.size(), PACKED_SETTINGS_STRING_SIZE - 1);
+
+        std::memcpy(dst, src.data(), len);
+        dst[len] = '\0';
+    }
+
+    void PostProcessSettings::pack(PackedPostProcessSettings& packed) const {
+        packed.version              = PACKED_SETTINGS_VERSION;
+
+        packed.spatialDenoiseLevel  = spatialDenoiseLevel;
+
+        packed.temperature          = temperature;
+        packed.tint                 = tint;
+        packed.gamma                = gamma;
+        packed.tonemapVariance      = tonemapVariance;
+        packed.shadows              = shadows;
+        packed.whitePoint           = whitePoint;
+        packed.contrast             = contrast;
+        packed.brightness           = brightness;
+        packed.sharpen0             = sharpen0;
+        packed.sharpen1             = sharpen1;
+        packed.pop                  = pop;
+        packed.blacks               = blacks;
+        packed.exposure             = exposure;
+        packed.clippedLows          = clippedLows;
+        packed.clippedHighs         = clippedHighs;
+        packed.noiseSigma           = noiseSigma;
+        packed.sceneLuminance       = sceneLuminance;
+        packed.saturation           = saturation;
+        packed.blues                = blues;
+        packed.greens               = greens;
+
+        packed.jpegQuality          = jpegQuality;
+        packed.flipped              = flipped ? 1 : 0;
+        packed.dng                  = dng ? 1 : 0;
+
+        packed.gpsLatitude          = gpsLatitude;
+        packed.gpsLongitude         = gpsLongitude;
+        packed.gpsAltitude          = gpsAltitude;
+
+        PackString(packed.gpsTime, gpsTime);
+        PackString(packed.captureMode, captureMode);
+    }
+
+    bool PostProcessSettings::unpack(const PackedPostProcessSettings& packed) {
+        if(packed.version != PACKED_SETTINGS_VERSION)
+            return false;
+
+        spatialDenoiseLevel = packed.spatialDenoiseLevel;
+
+        temperature         = packed.temperature;
+        tint                = packed.tint;
+        gamma               = packed.gamma;
+        tonemapVariance     = packed.tonemapVariance;
+        shadows             = packed.shadows;
+        whitePoint          = packed.whitePoint;
+        contrast            = packed.contrast;
+        brightness          = packed.brightness;
+        sharpen0            = packed.sharpen0;
+        sharpen1            = packed.sharpen1;
+        pop                 = packed.pop;
+        blacks              = packed.blacks;
+        exposure            = packed.exposure;
+        clippedLows         = packed.clippedLows;
+        clippedHighs        = packed.clippedHighs;
+        noiseSigma          = packed.noiseSigma;
+        sceneLuminance      = packed.sceneLuminance;
+        saturation          = packed.saturation;
+        blues               = packed.blues;
+        greens              = packed.greens;
+
+        jpegQuality         = packed.jpegQuality;
+        flipped             = packed.flipped != 0;
+        dng                 = packed.dng != 0;
+
+        gpsLatitude         = packed.gpsLatitude;
+        gpsLongitude        = packed.gpsLongitude;
+        gpsAltitude         = packed.gpsAltitude;
+
+        // The fixed-size fields are null terminated by pack()
+        gpsTime             = std::string(packed.gpsTime);
+        captureMode         = std::string(packed.captureMode);
+
+        return true;
+    }
 }
@@ -0,0 +1,219 @@
+#include "motioncam/SettingsStore.h"
+#include "motioncam/Settings.h"
+#include "motioncam/Logger.h"
+
+#include <cstdio>
+#include <cstring>
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+namespace motioncam {
+    namespace {
+        const uint32_t SETTINGS_MAGIC_NUMBER = 0x4D435354;
+        const uint32_t SETTINGS_VERSION      = 1;
+
+        const size_t MAX_GPS_TIME_LEN      = 32;
+        const size_t MAX_CAPTURE_MODE_LEN  = 64;
+
+        // Fixed layout image of PostProcessSettings. Fields are only ever
+        // appended, together with a version bump.
+        struct SettingsImage {
+            uint32_t magic;
+            uint32_t version;
+
+            int32_t spatialDenoiseLevel;
+
+            float temperature;
+            float tint;
+
+            float gamma;
+            float tonemapVariance;
+            float shadows;
+            float whitePoint;
+            float contrast;
+            float brightness;
+            float sharpen0;
+            float sharpen1;
+            float pop;
+            float blacks;
+            float exposure;
+            float clippedLows;
+            float clippedHighs;
+
+            float noiseSigma;
+            float sceneLuminance;
+
+            float saturation;
+            float blues;
+            float greens;
+
+            int32_t jpegQuality;
+            uint8_t flipped;
+            uint8_t dng;
+            uint8_t padding[2];
+
+            float gpsLatitude;
+            float gpsLongitude;
+            float gpsAltitude;
+
+            char gpsTime[MAX_GPS_TIME_LEN];
+            char captureMode[MAX_CAPTURE_MODE_LEN];
+        };
+
+        void ToImage(const PostProcessSettings& settings, SettingsImage& image) {
+            std::memset(&image, 0, sizeof(SettingsImage));
+
+            image.magic   = SETTINGS_MAGIC_NUMBER;
+            image.version = SETTINGS_VERSION;
+
+            image.spatialDenoiseLevel   = settings.spatialDenoiseLevel;
+            image.temperature           = settings.temperature;
+            image.tint                  = settings.tint;
+            image.gamma                 = settings.gamma;
+            image.tonemapVariance       = settings.tonemapVariance;
+            image.shadows               = settings.shadows;
+            image.whitePoint            = settings.whitePoint;
+            image.contrast              = settings.contrast;
+            image.brightness            = settings.brightness;
+            image.sharpen0              = settings.sharpen0;
+            image.sharpen1              = settings.sharpen1;
+            image.pop                   = settings.pop;
+            image.blacks                = settings.blacks;
+            image.exposure              = settings.exposure;
+            image.clippedLows           = settings.clippedLows;
+            image.clippedHighs          = settings.clippedHighs;
+            image.noiseSigma            = settings.noiseSigma;
+            image.sceneLuminance        = settings.sceneLuminance;
+            image.saturation            = settings.saturation;
+            image.blues                 = settings.blues;
+            image.greens                = settings.greens;
+            image.jpegQuality           = settings.jpegQuality;
+            image.flipped               = settings.flipped ? 1 : 0;
+            image.dng                   = settings.dng ? 1 : 0;
+            image.gpsLatitude           = settings.gpsLatitude;
+            image.gpsLongitude          = settings.gpsLongitude;
+            image.gpsAltitude           = settings.gpsAltitude;
+
+            std::strncpy(image.gpsTime, settings.gpsTime.c_str(), MAX_GPS_TIME_LEN - 1);
+            std::strncpy(image.captureMode, settings.captureMode.c_str(), MAX_CAPTURE_MODE_LEN - 1);
+        }
+
+        void FromImage(const SettingsImage& image, PostProcessSettings& settings) {
+            settings.spatialDenoiseLevel    = image.spatialDenoiseLevel;
+            settings.temperature            = image.temperature;
+            settings.tint                   = image.tint;
+            settings.gamma                  = image.gamma;
+            settings.tonemapVariance        = image.tonemapVariance;
+            settings.shadows                = image.shadows;
+            settings.whitePoint             = image.whitePoint;
+            settings.contrast               = image.contrast;
+            settings.brightness             = image.brightness;
+            settings.sharpen0               = image.sharpen0;
+            settings.sharpen1               = image.sharpen1;
+            settings.pop                    = image.pop;
+            settings.blacks                 = image.blacks;
+            settings.exposure               = image.exposure;
+            settings.clippedLows            = image.clippedLows;
+            settings.clippedHighs           = image.clippedHighs;
+            settings.noiseSigma             = image.noiseSigma;
+            settings.sceneLuminance         = image.sceneLuminance;
+            settings.saturation             = image.saturation;
+            settings.blues                  = image.blues;
+            settings.greens                 = image.greens;
+            settings.jpegQuality            = image.jpegQuality;
+            settings.flipped                = image.flipped != 0;
+            settings.dng                    = image.dng != 0;
+            settings.gpsLatitude            = image.gpsLatitude;
+            settings.gpsLongitude           = image.gpsLongitude;
+            settings.gpsAltitude            = image.gpsAltitude;
+
+            settings.gpsTime        = std::string(image.gpsTime, strnlen(image.gpsTime, MAX_GPS_TIME_LEN));
+            settings.captureMode    = std::string(image.captureMode, strnlen(image.captureMode, MAX_CAPTURE_MODE_LEN));
+        }
+    }
+
+    bool SettingsStore::Load(const std::string& path, PostProcessSettings& outSettings) {
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+        int fd = open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            return false;
+
+        struct stat st;
+
+        if(fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(SettingsImage)) {
+            close(fd);
+            return false;
+        }
+
+        void* mapped = mmap(nullptr, sizeof(SettingsImage), PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapped == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+
+        const auto* image = reinterpret_cast<const SettingsImage*>(mapped);
+        bool valid = image->magic == SETTINGS_MAGIC_NUMBER && image->version == SETTINGS_VERSION;
+
+        if(valid)
+            FromImage(*image, outSettings);
+
+        munmap(mapped, sizeof(SettingsImage));
+        close(fd);
+
+        return valid;
+#else
+        FILE* file = fopen(path.c_str(), "rb");
+        if(!file)
+            return false;
+
+        SettingsImage image;
+        bool valid = fread(&image, sizeof(SettingsImage), 1, file) == 1 &&
+                     image.magic == SETTINGS_MAGIC_NUMBER &&
+                     image.version == SETTINGS_VERSION;
+
+        if(valid)
+            FromImage(image, outSettings);
+
+        fclose(file);
+
+        return valid;
+#endif
+    }
+
+    bool SettingsStore::Save(const PostProcessSettings& settings, const std::string& path) {
+        SettingsImage image;
+        ToImage(settings, image);
+
+        const std::string tmpPath = path + ".tmp";
+
+        FILE* file = fopen(tmpPath.c_str(), "wb");
+        if(!file)
+            return false;
+
+        if(fwrite(&image, sizeof(SettingsImage), 1, file) != 1) {
+            fclose(file);
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+        fflush(file);
+        fsync(fileno(file));
+#endif
+
+        fclose(file);
+
+        // Replace the existing image atomically
+        if(std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+
+        return true;
+    }
+}
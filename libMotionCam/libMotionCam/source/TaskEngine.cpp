@@ -0,0 +1,174 @@
+#include "motioncam/TaskEngine.h"
+#include "motioncam/Logger.h"
+#include "motioncam/ThreadTopology.h"
+
+#include <deque>
+
+namespace motioncam {
+    // Index of the worker owned by the current thread, or -1 on threads
+    // outside the pool
+    thread_local int gWorkerIndex = -1;
+
+    struct TaskEngine::Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    TaskGroup::TaskGroup() : mPending(0) {
+    }
+
+    void TaskGroup::wait() {
+        auto& engine = TaskEngine::get();
+
+        while(mPending.load(std::memory_order_acquire) > 0) {
+            // Help with queued work instead of blocking. This can pick up
+            // unrelated tasks, but keeps the pool making progress when a
+            // task waits on its children.
+            if(engine.tryExecute(gWorkerIndex))
+                continue;
+
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            if(mPending.load(std::memory_order_acquire) > 0)
+                mCondition.wait_for(lock, std::chrono::milliseconds(1));
+        }
+
+        // Make sure the last executor has released the group before the
+        // caller can destroy it
+        std::lock_guard<std::mutex> lock(mMutex);
+    }
+
+    TaskEngine& TaskEngine::get() {
+        static TaskEngine instance;
+        return instance;
+    }
+
+    TaskEngine::TaskEngine() : mRunning(true) {
+        const int numWorkers = static_cast<int>((std::max)(2u, std::thread::hardware_concurrency()));
+
+        for(int i = 0; i < numWorkers; i++)
+            mWorkers.push_back(std::unique_ptr<Worker>(new Worker()));
+
+        for(int i = 0; i < numWorkers; i++)
+            mThreads.push_back(std::unique_ptr<std::thread>(new std::thread(&TaskEngine::doWork, this, i)));
+    }
+
+    TaskEngine::~TaskEngine() {
+        mRunning = false;
+        mSleepCondition.notify_all();
+
+        for(auto& thread : mThreads)
+            thread->join();
+    }
+
+    int TaskEngine::numWorkers() const {
+        return static_cast<int>(mWorkers.size());
+    }
+
+    void TaskEngine::run(const TaskPriority priority, std::function<void()> task) {
+        schedule(priority, Task { std::move(task), nullptr });
+    }
+
+    void TaskEngine::run(const TaskPriority priority, std::function<void()> task, TaskGroup& group) {
+        group.mPending.fetch_add(1, std::memory_order_acq_rel);
+
+        schedule(priority, Task { std::move(task), &group });
+    }
+
+    void TaskEngine::schedule(const TaskPriority priority, Task task) {
+        // Tasks scheduled from a worker go onto its own deque so child
+        // tasks run close to their parent; everything else goes through the
+        // priority intake queues
+        if(gWorkerIndex >= 0) {
+            auto& worker = *mWorkers[gWorkerIndex];
+
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.tasks.push_front(std::move(task));
+        }
+        else {
+            mQueues[static_cast<int>(priority)].enqueue(std::move(task));
+        }
+
+        mSleepCondition.notify_one();
+    }
+
+    bool TaskEngine::tryExecute(const int workerIdx) {
+        Task task;
+
+        // Local work first
+        if(workerIdx >= 0) {
+            auto& worker = *mWorkers[workerIdx];
+            std::unique_lock<std::mutex> lock(worker.mutex);
+
+            if(!worker.tasks.empty()) {
+                task = std::move(worker.tasks.front());
+                worker.tasks.pop_front();
+                lock.unlock();
+
+                execute(task);
+                return true;
+            }
+        }
+
+        // Then the intake queues, in priority order
+        for(int i = 0; i < static_cast<int>(TaskPriority::NUM_PRIORITIES); i++) {
+            if(mQueues[i].try_dequeue(task)) {
+                execute(task);
+                return true;
+            }
+        }
+
+        // Finally steal from the back of another worker's deque
+        const size_t numWorkers = mWorkers.size();
+        const size_t start = workerIdx >= 0 ? workerIdx + 1 : 0;
+
+        for(size_t i = 0; i < numWorkers; i++) {
+            auto& victim = *mWorkers[(start + i) % numWorkers];
+            std::unique_lock<std::mutex> lock(victim.mutex);
+
+            if(victim.tasks.empty())
+                continue;
+
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            lock.unlock();
+
+            execute(task);
+            return true;
+        }
+
+        return false;
+    }
+
+    void TaskEngine::execute(Task& task) {
+        try {
+            task.fn();
+        }
+        catch(std::exception& e) {
+            logger::log(std::string("Task failed: ") + e.what());
+        }
+
+        if(task.group) {
+            // Decrement under the group's mutex so wait() can safely let the
+            // caller destroy the group once it observes zero
+            std::lock_guard<std::mutex> lock(task.group->mMutex);
+
+            if(task.group->mPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                task.group->mCondition.notify_all();
+        }
+    }
+
+    void TaskEngine::doWork(const int workerIdx) {
+        gWorkerIndex = workerIdx;
+
+        while(mRunning) {
+            topology::PinCurrentThread(topology::ThreadClass::COMPUTE);
+
+            if(tryExecute(workerIdx))
+                continue;
+
+            std::unique_lock<std::mutex> lock(mSleepMutex);
+            mSleepCondition.wait_for(lock, std::chrono::milliseconds(100));
+        }
+    }
+}
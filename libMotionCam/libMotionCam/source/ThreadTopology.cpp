@@ -0,0 +1,207 @@
+#include "motioncam/ThreadTopology.h"
+#include "motioncam/Logger.h"
+
+#include <atomic>
+
+#if defined(__ANDROID__) || defined(__linux__)
+    #include <cstdio>
+    #include <mutex>
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+#endif
+
+namespace motioncam {
+    namespace topology {
+        static std::atomic<bool> gEnabled(false);
+
+        // Bumped whenever the enabled state changes so pinned threads can
+        // notice and reapply their affinity from their work loops
+        static std::atomic<int> gGeneration(0);
+
+#if defined(__ANDROID__) || defined(__linux__)
+        struct Topology {
+            cpu_set_t performanceCores;
+            cpu_set_t efficiencyCores;
+            cpu_set_t allCores;
+            int numPerformanceCores;
+            int numEfficiencyCores;
+        };
+
+        static Topology gTopology;
+        static std::once_flag gTopologyFlag;
+
+        // Maximum frequency of a core from cpufreq, or 0 when the node
+        // can't be read
+        static long ReadMaxFreq(const int cpu) {
+            char path[128];
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", cpu);
+
+            FILE* file = fopen(path, "r");
+            if(!file)
+                return 0;
+
+            long freq = 0;
+
+            if(fscanf(file, "%ld", &freq) != 1)
+                freq = 0;
+
+            fclose(file);
+
+            return freq;
+        }
+
+        // Classify cores by their maximum frequency. Cores that reach the
+        // highest frequency form the performance cluster and everything
+        // slower the efficiency cluster. On symmetric parts the efficiency
+        // cluster comes out empty and pinning stays a no-op.
+        static void DiscoverTopology() {
+            CPU_ZERO(&gTopology.performanceCores);
+            CPU_ZERO(&gTopology.efficiencyCores);
+            CPU_ZERO(&gTopology.allCores);
+
+            gTopology.numPerformanceCores = 0;
+            gTopology.numEfficiencyCores = 0;
+
+            const int numCpus = static_cast<int>(sysconf(_SC_NPROCESSORS_CONF));
+
+            if(numCpus <= 1 || numCpus > CPU_SETSIZE)
+                return;
+
+            long maxFreq = 0;
+
+            for(int cpu = 0; cpu < numCpus; cpu++) {
+                const long freq = ReadMaxFreq(cpu);
+                if(freq > maxFreq)
+                    maxFreq = freq;
+            }
+
+            if(maxFreq <= 0)
+                return;
+
+            for(int cpu = 0; cpu < numCpus; cpu++) {
+                const long freq = ReadMaxFreq(cpu);
+
+                if(freq <= 0)
+                    continue;
+
+                CPU_SET(cpu, &gTopology.allCores);
+
+                if(freq == maxFreq) {
+                    CPU_SET(cpu, &gTopology.performanceCores);
+                    ++gTopology.numPerformanceCores;
+                }
+                else {
+                    CPU_SET(cpu, &gTopology.efficiencyCores);
+                    ++gTopology.numEfficiencyCores;
+                }
+            }
+
+            // A flat topology has nothing to pin to
+            if(gTopology.numEfficiencyCores == 0) {
+                gTopology.numPerformanceCores = 0;
+                return;
+            }
+
+            LOG_INFO("Core topology: " + std::to_string(gTopology.numPerformanceCores) + " performance, " +
+                     std::to_string(gTopology.numEfficiencyCores) + " efficiency");
+        }
+
+        static const Topology& GetTopology() {
+            std::call_once(gTopologyFlag, DiscoverTopology);
+            return gTopology;
+        }
+#endif
+
+        void SetEnabled(const bool enabled) {
+            if(gEnabled.exchange(enabled) != enabled)
+                ++gGeneration;
+        }
+
+        bool IsEnabled() {
+            return gEnabled;
+        }
+
+        void PinCurrentThread(const ThreadClass threadClass) {
+#if defined(__ANDROID__) || defined(__linux__)
+            // Reapply only when the enabled state changed since this thread
+            // last looked
+            static thread_local int sAppliedGeneration = -1;
+
+            const int generation = gGeneration.load(std::memory_order_relaxed);
+
+            if(generation == sAppliedGeneration)
+                return;
+
+            sAppliedGeneration = generation;
+
+            const auto& topology = GetTopology();
+
+            if(topology.numPerformanceCores == 0)
+                return;
+
+            const cpu_set_t* cores;
+
+            if(!gEnabled)
+                cores = &topology.allCores;
+            else if(threadClass == ThreadClass::IO)
+                cores = &topology.efficiencyCores;
+            else
+                cores = &topology.performanceCores;
+
+            // Best effort; a failure just leaves the thread floating
+            sched_setaffinity(0, sizeof(cpu_set_t), cores);
+#else
+            (void) threadClass;
+#endif
+        }
+    }
+}
+
+#if defined(__ANDROID__) || defined(__linux__)
+
+namespace {
+    struct SpawnedThread {
+        void (*fn)(void*);
+        void* closure;
+        pthread_t thread;
+    };
+
+    void* ThreadTrampoline(void* arg) {
+        auto* spawned = static_cast<SpawnedThread*>(arg);
+
+        // Halide workers run the compute kernels; keep them on the
+        // performance cores when pinning is enabled
+        motioncam::topology::PinCurrentThread(motioncam::topology::ThreadClass::COMPUTE);
+
+        spawned->fn(spawned->closure);
+
+        return nullptr;
+    }
+}
+
+// Override the weak thread hooks in the Halide runtime so the workers its
+// pool spawns go through the topology layer
+extern "C" struct halide_thread* halide_spawn_thread(void (*f)(void*), void* closure) {
+    auto* spawned = new SpawnedThread { f, closure, {} };
+
+    if(pthread_create(&spawned->thread, nullptr, ThreadTrampoline, spawned) != 0) {
+        delete spawned;
+        return nullptr;
+    }
+
+    return reinterpret_cast<halide_thread*>(spawned);
+}
+
+extern "C" void halide_join_thread(struct halide_thread* thread) {
+    auto* spawned = reinterpret_cast<SpawnedThread*>(thread);
+
+    if(!spawned)
+        return;
+
+    pthread_join(spawned->thread, nullptr);
+
+    delete spawned;
+}
+
+#endif
@@ -0,0 +1,137 @@
+#include "motioncam/Trace.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace motioncam {
+    namespace trace {
+        // Events each thread holds before its oldest are overwritten. At
+        // roughly 64 bytes per event this is about half a megabyte per
+        // traced thread.
+        static const size_t EventsPerThread = 8192;
+
+        namespace {
+            struct Event {
+                std::string name;
+                int64_t beginUs;
+                int64_t endUs;
+            };
+
+            struct ThreadBuffer {
+                explicit ThreadBuffer(const int threadId) :
+                    threadId(threadId), head(0), count(0)
+                {
+                    events.resize(EventsPerThread);
+                }
+
+                const int threadId;
+
+                // Only ever contended while a dump runs
+                std::mutex mutex;
+
+                std::vector<Event> events;
+                size_t head;
+                size_t count;
+            };
+
+            std::atomic<bool> gEnabled(false);
+
+            // Buffers outlive their threads so a dump still sees the events
+            // of workers that have already exited
+            std::mutex gRegistryMutex;
+            std::vector<std::shared_ptr<ThreadBuffer>> gRegistry;
+            int gNextThreadId = 0;
+
+            ThreadBuffer& LocalBuffer() {
+                thread_local std::shared_ptr<ThreadBuffer> buffer;
+
+                if(!buffer) {
+                    std::lock_guard<std::mutex> lock(gRegistryMutex);
+
+                    buffer = std::make_shared<ThreadBuffer>(gNextThreadId++);
+                    gRegistry.push_back(buffer);
+                }
+
+                return *buffer;
+            }
+        }
+
+        void SetEnabled(const bool enabled) {
+            gEnabled.store(enabled, std::memory_order_relaxed);
+        }
+
+        bool IsEnabled() {
+            return gEnabled.load(std::memory_order_relaxed);
+        }
+
+        int64_t NowUs() {
+            using namespace std::chrono;
+
+            return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+        }
+
+        void Emit(const std::string& name, const int64_t beginUs, const int64_t endUs) {
+            auto& buffer = LocalBuffer();
+
+            std::lock_guard<std::mutex> lock(buffer.mutex);
+
+            Event& e = buffer.events[buffer.head];
+
+            e.name = name;
+            e.beginUs = beginUs;
+            e.endUs = endUs;
+
+            buffer.head = (buffer.head + 1) % EventsPerThread;
+
+            if(buffer.count < EventsPerThread)
+                ++buffer.count;
+        }
+
+        std::string Dump() {
+            std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+            {
+                std::lock_guard<std::mutex> lock(gRegistryMutex);
+                buffers = gRegistry;
+            }
+
+            std::ostringstream json;
+
+            json << "{\"traceEvents\":[";
+
+            bool first = true;
+
+            for(auto& buffer : buffers) {
+                std::lock_guard<std::mutex> lock(buffer->mutex);
+
+                // Oldest first
+                const size_t start = (buffer->head + EventsPerThread - buffer->count) % EventsPerThread;
+
+                for(size_t i = 0; i < buffer->count; i++) {
+                    const Event& e = buffer->events[(start + i) % EventsPerThread];
+
+                    if(!first)
+                        json << ",";
+
+                    first = false;
+
+                    json << "{\"name\":\"" << e.name
+                         << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->threadId
+                         << ",\"ts\":" << e.beginUs
+                         << ",\"dur\":" << (e.endUs - e.beginUs)
+                         << "}";
+                }
+
+                buffer->head = 0;
+                buffer->count = 0;
+            }
+
+            json << "]}";
+
+            return json.str();
+        }
+    }
+}
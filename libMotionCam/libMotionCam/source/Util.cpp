@@ -6,86 +6,26 @@
 #include "motioncam/RawContainer.h"
 #include "motioncam/Measure.h"
 
+#include <chrono>
+#include <cstring>
 #include <fstream>
+#include <miniz.h>
+#include <miniz_tdef.h>
 #include <zstd.h>
 
 #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+    #include <fcntl.h>
     #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
 #endif
 
-#include <dng/dng_host.h>
-#include <dng/dng_negative.h>
-#include <dng/dng_camera_profile.h>
-#include <dng/dng_file_stream.h>
-#include <dng/dng_memory_stream.h>
-#include <dng/dng_image_writer.h>
-#include <dng/dng_render.h>
-#include <dng/dng_gain_map.h>
-#include <dng/dng_exif.h>
 
 using std::string;
 using std::vector;
 using std::ios;
 using std::set;
 
-#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
-
-class dng_fd_stream : public dng_stream {
-public:
-    dng_fd_stream(const int fd, bool output) :
-        dng_stream ((dng_abort_sniffer *) nullptr, kDefaultBufferSize, 0),
-    fFd(fd)
-    {
-        if(fd < 0)
-            ThrowFileIsDamaged();
-    }
-    
-    ~dng_fd_stream () override {
-        if (fFd < 0)
-            return;
-
-        fsync(fFd);
-        close(fFd);
-    }
-
-    uint64 DoGetLength () override {
-        if (lseek (fFd, 0, SEEK_END) < 0) {
-            ThrowReadFile ();
-        }
-        
-        return (uint64) lseek(fFd, 0, SEEK_CUR);
-    }
-            
-    void DoRead(void *data, uint32 count, uint64 offset) override {
-        if (lseek (fFd, (long) offset, SEEK_SET) < 0) {
-            ThrowReadFile ();
-        }
-        
-        auto bytesRead = (uint32) read (fFd, data, count);
-        
-        if (bytesRead != count) {
-            ThrowReadFile ();
-        }
-    }
-    
-    void DoWrite(const void *data, uint32 count, uint64 offset) override {
-        if (lseek (fFd, (uint32) offset, SEEK_SET) < 0) {
-            ThrowWriteFile ();
-        }
-                
-        auto bytesWritten = (uint32) write (fFd, data, count);
-
-        if (bytesWritten != count) {
-            ThrowWriteFile ();
-        }
-    }
-    
-private:
-    int fFd;
-};
-
-#endif
-
 namespace motioncam {
     namespace util {
         CloseableFd::CloseableFd(const int fd) : mFd(fd) {
@@ -102,7 +42,7 @@ namespace motioncam {
         // Very basic zip writer
         //
     
-        ZipWriter::ZipWriter(const int fd, bool append) : mFile(nullptr), mZip{ 0 }, mCommited(false) {
+        ZipWriter::ZipWriter(const int fd, bool append) : mFile(nullptr), mZip{ 0 }, mCommited(false), mCompressRunning(false), mEntriesInFlight(0) {
             if(append) {
                 mFile = fdopen(fd, "w");
 
@@ -128,7 +68,7 @@ namespace motioncam {
             }
         }
     
-        ZipWriter::ZipWriter(const string& filename, bool append) : mZip{ 0 }, mFile(nullptr), mCommited(false) {
+        ZipWriter::ZipWriter(const string& filename, bool append) : mZip{ 0 }, mFile(nullptr), mCommited(false), mCompressRunning(false), mEntriesInFlight(0) {
             if(append) {
                 if(!mz_zip_reader_init_file(&mZip, filename.c_str(), 0)) {
                     throw IOException("Can't read " + filename);
@@ -157,34 +97,193 @@ namespace motioncam {
             if(mCommited) {
                 throw IOException("Can't add " + filename + " because archive has been commited");
             }
-            
+
+            // Queue the entry for the worker pool when parallel compression
+            // is enabled. The data is copied because the caller's buffer
+            // only lives for the duration of this call.
+            if(mCompressRunning) {
+                auto entry = std::make_shared<PendingEntry>();
+
+                entry->name = filename;
+                entry->data.assign(
+                    static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + numBytes);
+
+                ++mEntriesInFlight;
+                mPendingEntries.enqueue(std::move(entry));
+
+                return;
+            }
+
             if(!mz_zip_writer_add_mem(&mZip, filename.c_str(), data, numBytes, MZ_NO_COMPRESSION)) {
                 throw IOException("Can't add " + filename);
             }
         }
-    
+
+        ZipWriter::CompressedEntry::~CompressedEntry() {
+            if(compressedData)
+                mz_free(compressedData);
+        }
+
+        void ZipWriter::enableParallelCompression(const int numThreads) {
+            if(mCommited) {
+                throw IOException("Can't enable parallel compression because archive has been commited");
+            }
+
+            if(mCompressRunning)
+                return;
+
+            mCompressRunning = true;
+
+            const int threads = (std::max)(1, numThreads);
+
+            for(int i = 0; i < threads; i++) {
+                mCompressThreads.push_back(
+                    std::unique_ptr<std::thread>(new std::thread(&ZipWriter::doCompress, this)));
+            }
+
+            // A single thread owns the archive while the pool is running, so
+            // the miniz writer is never touched concurrently
+            mWriteThread = std::unique_ptr<std::thread>(new std::thread(&ZipWriter::doWrite, this));
+        }
+
+        void ZipWriter::doCompress() {
+            // Raw deflate; the zip entry carries its own header and the
+            // lowest level keeps the pool ahead of the writer
+            const mz_uint compFlags =
+                tdefl_create_comp_flags_from_zip_params(MZ_BEST_SPEED, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY);
+
+            while(mCompressRunning) {
+                std::shared_ptr<PendingEntry> entry;
+
+                if(!mPendingEntries.wait_dequeue_timed(entry, std::chrono::milliseconds(100)))
+                    continue;
+
+                auto result = std::make_shared<CompressedEntry>();
+
+                result->name = std::move(entry->name);
+                result->uncompressedSize = entry->data.size();
+                result->crc32 = static_cast<uint32_t>(
+                    mz_crc32(MZ_CRC32_INIT, entry->data.data(), entry->data.size()));
+
+                size_t compressedSize = 0;
+                void* compressedData = nullptr;
+
+                if(!entry->data.empty())
+                    compressedData = tdefl_compress_mem_to_heap(entry->data.data(), entry->data.size(), &compressedSize, compFlags);
+
+                if(compressedData && compressedSize < entry->data.size()) {
+                    result->compressedData = compressedData;
+                    result->compressedSize = compressedSize;
+                }
+                else {
+                    // Didn't shrink (or empty); store it like the
+                    // synchronous path does
+                    if(compressedData)
+                        mz_free(compressedData);
+
+                    result->storedData = std::move(entry->data);
+                }
+
+                mCompressedEntries.enqueue(std::move(result));
+            }
+        }
+
+        void ZipWriter::doWrite() {
+            while(mCompressRunning) {
+                std::shared_ptr<CompressedEntry> entry;
+
+                if(!mCompressedEntries.wait_dequeue_timed(entry, std::chrono::milliseconds(100)))
+                    continue;
+
+                addEntry(*entry);
+
+                --mEntriesInFlight;
+            }
+        }
+
+        void ZipWriter::addEntry(const CompressedEntry& entry) {
+            bool result;
+
+            if(entry.compressedData) {
+                result = mz_zip_writer_add_mem_ex(
+                    &mZip,
+                    entry.name.c_str(),
+                    entry.compressedData,
+                    entry.compressedSize,
+                    nullptr,
+                    0,
+                    MZ_ZIP_FLAG_COMPRESSED_DATA,
+                    entry.uncompressedSize,
+                    entry.crc32);
+            }
+            else {
+                result = mz_zip_writer_add_mem(
+                    &mZip, entry.name.c_str(), entry.storedData.data(), entry.storedData.size(), MZ_NO_COMPRESSION);
+            }
+
+            if(!result) {
+                std::lock_guard<std::mutex> lock(mErrorMutex);
+
+                if(mCompressError.empty())
+                    mCompressError = "Can't add " + entry.name;
+            }
+        }
+
+        void ZipWriter::finishParallelCompression() {
+            if(!mCompressRunning)
+                return;
+
+            // Wait for every queued entry to land in the archive before
+            // stopping the pool
+            while(mEntriesInFlight > 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+            mCompressRunning = false;
+
+            for(auto& thread : mCompressThreads)
+                thread->join();
+
+            mCompressThreads.clear();
+
+            if(mWriteThread) {
+                mWriteThread->join();
+                mWriteThread = nullptr;
+            }
+        }
+
         void ZipWriter::commit() {
+            finishParallelCompression();
+
+            {
+                std::lock_guard<std::mutex> lock(mErrorMutex);
+
+                if(!mCompressError.empty())
+                    throw IOException(mCompressError);
+            }
+
             if(!mz_zip_writer_finalize_archive(&mZip)) {
                 throw IOException("Failed to finalize archive!");
             }
-        
+
             if(!mz_zip_writer_end(&mZip)) {
                 throw IOException("Failed to complete archive!");
             }
-            
+
             mCommited = true;
-            
+
             if(mFile) {
                 fflush(mFile);
             }
         }
-        
+
         ZipWriter::~ZipWriter() {
+            finishParallelCompression();
+
             if(!mCommited) {
                 mz_zip_writer_finalize_archive(&mZip);
                 mz_zip_writer_end(&mZip);
             }
-            
+
             if(mFile) {
                 fclose(mFile);
             }
@@ -194,12 +293,43 @@ namespace motioncam {
         // Very basic zip reader
         //
 
-        ZipReader::ZipReader(FILE* file) : mZip{ 0 }, mFile(file)
+        // Maps the archive read-only and initialises miniz over the mapped
+        // memory, so entry reads come straight from the page cache instead
+        // of seeking the FILE* cursor, and stored entries can be served as
+        // views into the mapping. Falls back to the stream based reader
+        // when mapping isn't possible.
+        bool ZipReader::tryMap(const int fd) {
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+            struct stat st;
+
+            if(fd < 0 || fstat(fd, &st) != 0 || st.st_size <= 0)
+                return false;
+
+            void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if(mapped == MAP_FAILED)
+                return false;
+
+            if(!mz_zip_reader_init_mem(&mZip, mapped, st.st_size, 0)) {
+                munmap(mapped, st.st_size);
+                return false;
+            }
+
+            mMapped = static_cast<const uint8_t*>(mapped);
+            mMappedSize = st.st_size;
+
+            return true;
+#else
+            (void) fd;
+            return false;
+#endif
+        }
+
+        ZipReader::ZipReader(FILE* file) : mZip{ 0 }, mFile(file), mMapped(nullptr), mMappedSize(0)
         {
-            if(!mz_zip_reader_init_cfile(&mZip, mFile, 0, 0)) {
+            if(!tryMap(fileno(mFile)) && !mz_zip_reader_init_cfile(&mZip, mFile, 0, 0)) {
                 throw IOException("Can't read from file");
             }
-            
+
             auto numFiles = mz_zip_reader_get_num_files(&mZip);
             char entry[512];
 
@@ -208,16 +338,26 @@ namespace motioncam {
                 if(len == 0) {
                     throw IOException("Failed to parse entry");
                 }
-                
+
                 mFiles.emplace_back(entry, len - 1);
             }
         }
 
-        ZipReader::ZipReader(const string& filename) : mFile(nullptr), mZip{ 0 } {
-            if(!mz_zip_reader_init_file(&mZip, filename.c_str(), 0)) {
+        ZipReader::ZipReader(const string& filename) : mFile(nullptr), mZip{ 0 }, mMapped(nullptr), mMappedSize(0) {
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+            const int fd = open(filename.c_str(), O_RDONLY);
+
+            if(fd >= 0) {
+                // The mapping outlives the descriptor
+                tryMap(fd);
+                close(fd);
+            }
+#endif
+
+            if(!mMapped && !mz_zip_reader_init_file(&mZip, filename.c_str(), 0)) {
                 throw IOException("Can't read " + filename);
             }
-            
+
             auto numFiles = mz_zip_reader_get_num_files(&mZip);
             char entry[512];
 
@@ -226,14 +366,20 @@ namespace motioncam {
                 if(len == 0) {
                     throw IOException("Failed to parse " + filename);
                 }
-                
+
                 mFiles.emplace_back(entry, len - 1);
             }
         }
-    
+
         ZipReader::~ZipReader() {
             mz_zip_reader_end(&mZip);
-            
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+            if(mMapped) {
+                munmap((void*) mMapped, mMappedSize);
+            }
+#endif
+
             if(mFile) {
                 fclose(mFile);
             }
@@ -266,16 +412,61 @@ namespace motioncam {
                 throw IOException("Failed to load " + filename);
             }
         }
-    
+
+        bool ZipReader::view(const std::string& filename, const uint8_t*& outData, size_t& outSize) {
+            if(!mMapped)
+                return false;
+
+            auto it = std::find(mFiles.begin(), mFiles.end(), filename);
+            if(it == mFiles.end())
+                return false;
+
+            const auto index = static_cast<mz_uint>(it - mFiles.begin());
+            mz_zip_archive_file_stat stat;
+
+            if(!mz_zip_reader_file_stat(&mZip, index, &stat))
+                return false;
+
+            // Only stored entries can be handed out directly
+            if(stat.m_method != 0 || stat.m_is_directory || stat.m_comp_size != stat.m_uncomp_size)
+                return false;
+
+            // The entry data sits behind its local header and the header's
+            // variable length filename/extra fields
+            const uint64_t headerOfs = stat.m_local_header_ofs;
+
+            if(headerOfs + 30 > mMappedSize)
+                return false;
+
+            const uint8_t* header = mMapped + headerOfs;
+
+            // Local header signature, PK\x03\x04
+            if(header[0] != 0x50 || header[1] != 0x4b || header[2] != 0x03 || header[3] != 0x04)
+                return false;
+
+            const uint32_t filenameLength = header[26] | (header[27] << 8);
+            const uint32_t extraLength = header[28] | (header[29] << 8);
+
+            const uint64_t dataOfs = headerOfs + 30 + filenameLength + extraLength;
+
+            if(dataOfs + stat.m_comp_size > mMappedSize)
+                return false;
+
+            outData = mMapped + dataOfs;
+            outSize = static_cast<size_t>(stat.m_uncomp_size);
+
+            return true;
+        }
+
         const std::vector<std::string>& ZipReader::getFiles() const {
             return mFiles;
         }
     
         //
 
-        void ReadCompressedFile(const string& inputPath, vector<uint8_t>& output) {
+        void ReadCompressedFile(const string& inputPath, const std::function<bool(const uint8_t* data, size_t size)>& sink) {
             std::ifstream file(inputPath, std::ios::binary);
-            
+
             if (file.eof() || file.fail())
                 throw IOException("Can't read file " + inputPath);
 
@@ -288,13 +479,13 @@ namespace motioncam {
             std::shared_ptr<ZSTD_DCtx> ctx(ZSTD_createDCtx(), ZSTD_freeDCtx);
 
             size_t err = 0;
-            
+
             while(!file.eof() || !file.fail()) {
                 file.read(reinterpret_cast<char*>(buffIn.data()), buffInSize);
                 size_t readBytes = file.gcount();
-                
+
                 ZSTD_inBuffer inputBuffer = { buffIn.data(), readBytes, 0 };
-                
+
                 while (inputBuffer.pos < inputBuffer.size) {
                     ZSTD_outBuffer outputBuffer = { buffOut.data(), buffOut.size(), 0 };
 
@@ -302,8 +493,10 @@ namespace motioncam {
                     if(ZSTD_isError(err)) {
                         throw IOException("Failed to decompress file " + inputPath + " error: " + ZSTD_getErrorName(err));
                     }
-                    
-                    output.insert(output.end(), buffOut.begin(), buffOut.end());
+
+                    if(outputBuffer.pos > 0 && !sink(buffOut.data(), outputBuffer.pos)) {
+                        throw IOException("Failed to decompress file " + inputPath + " sink aborted the read");
+                    }
                 }
             }
 
@@ -311,10 +504,17 @@ namespace motioncam {
                 throw IOException("Failed to decompress file " + inputPath + " input is truncated." + ZSTD_getErrorName(err));
             }
         }
-    
-        void WriteCompressedFile(const vector<uint8_t>& data, const string& outputPath) {
+
+        void ReadCompressedFile(const string& inputPath, vector<uint8_t>& output) {
+            ReadCompressedFile(inputPath, [&output](const uint8_t* data, size_t size) {
+                output.insert(output.end(), data, data + size);
+                return true;
+            });
+        }
+
+        void WriteCompressedFile(const std::function<size_t(uint8_t* data, size_t capacity)>& source, const string& outputPath) {
             std::ofstream file(outputPath, std::ios::binary);
-            
+
             // If we have a problem
             if(!file.is_open() || file.fail()) {
                 throw IOException("Cannot write to " + outputPath);
@@ -322,50 +522,58 @@ namespace motioncam {
 
             // Create compression context
             std::shared_ptr<ZSTD_CCtx> ctx(ZSTD_createCCtx(), ZSTD_freeCCtx);
-            
+
             const size_t buffInSize = ZSTD_CStreamInSize();
             const size_t buffOutSize = ZSTD_CStreamOutSize();
 
+            vector<uint8_t> buffIn(buffInSize);
             vector<uint8_t> buffOut(buffOutSize);
-            
+
             ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_compressionLevel, 1);
             ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_checksumFlag, 1);
-            
-            size_t pos = 0;
+
             bool lastChunk = false;
-            
+
             while (!lastChunk) {
-                size_t read = buffInSize;
-                
-                if(pos + buffInSize >= data.size()) {
-                    read = data.size() - pos;
-                    lastChunk = true;
-                }
+                const size_t read = source(buffIn.data(), buffInSize);
+
+                // The payload ends when the source runs dry
+                lastChunk = read < buffInSize;
 
                 const ZSTD_EndDirective mode = lastChunk ? ZSTD_e_end : ZSTD_e_continue;
-                const char* buffIn = reinterpret_cast<const char*>(data.data() + pos);
-                
-                ZSTD_inBuffer input = { buffIn, read, 0 };
-                
+
+                ZSTD_inBuffer input = { buffIn.data(), read, 0 };
+
                 int finished;
-                
+
                 do {
                    ZSTD_outBuffer output = { buffOut.data(), buffOutSize, 0 };
                    const size_t remaining = ZSTD_compressStream2(ctx.get(), &output, &input, mode);
-                   
+
                     file.write(reinterpret_cast<char*>(buffOut.data()), output.pos);
-                    
+
                     if(file.fail()) {
                         throw IOException("Cannot write to " + outputPath);
                     }
-                    
+
                    finished = lastChunk ? (remaining == 0) : (input.pos == input.size);
                 } while (!finished);
-                
-                pos += read;
             }
         }
 
+        void WriteCompressedFile(const vector<uint8_t>& data, const string& outputPath) {
+            size_t pos = 0;
+
+            WriteCompressedFile([&data, &pos](uint8_t* dst, size_t capacity) {
+                const size_t read = (std::min)(capacity, data.size() - pos);
+
+                memcpy(dst, data.data() + pos, read);
+                pos += read;
+
+                return read;
+            }, outputPath);
+        }
+
         void ReadFile(const string& inputPath, vector<uint8_t>& output) {
             std::ifstream file(inputPath, std::ios::binary);
             
@@ -474,356 +682,6 @@ namespace motioncam {
             return outputImage(cv::Rect(cropX, cropY, width - cropX*2, height - cropY*2)).clone();
         }
 
-        void WriteDng(cv::Mat rawImage,
-                      const RawCameraMetadata& cameraMetadata,
-                      const RawImageMetadata& imageMetadata,
-                      const ScreenOrientation orientation,
-                      const bool enableCompression,
-                      const bool saveShadingMap,
-                      dng_stream& dngStream)
-        {
-            //Measure m{"WriteDng"};
-            
-            const int width  = rawImage.cols;
-            const int height = rawImage.rows;
-            
-            dng_host host;
-
-            host.SetSaveLinearDNG(false);
-            host.SetSaveDNGVersion(dngVersion_SaveDefault);
-            
-            AutoPtr<dng_negative> negative(host.Make_dng_negative());
-            
-            auto whiteLevel = cameraMetadata.getWhiteLevel(imageMetadata);
-            const auto& blackLevel = cameraMetadata.getBlackLevel(imageMetadata);
-            
-            // Create lens shading map for each channel
-            if(saveShadingMap) {
-                // Rearrange the shading map channels to match the sensor layout
-                const auto& rggbShadingMap = imageMetadata.shadingMap();
-                
-                for(int c = 0; c < 4; c++) {
-                    dng_point channelGainMapPoints(rggbShadingMap[c].rows, rggbShadingMap[c].cols);
-
-                    AutoPtr<dng_gain_map> gainMap(new dng_gain_map(host.Allocator(),
-                                                                   channelGainMapPoints,
-                                                                   dng_point_real64(1.0 / (rggbShadingMap[c].rows),
-                                                                                    1.0 / (rggbShadingMap[c].cols)),
-                                                                   dng_point_real64(0, 0),
-                                                                   1));
-
-                    for(int y = 0; y < rggbShadingMap[c].rows; y++) {
-                        for(int x = 0; x < rggbShadingMap[c].cols; x++) {
-                            gainMap->Entry(y, x, 0) = rggbShadingMap[c].at<float>(y, x);
-                        }
-                    }
-
-                    int left = 0;
-                    int top  = 0;
-
-                    if(c == 0) {
-                        left = 0;
-                        top = 0;
-                    }
-                    else if(c == 1) {
-                        left = 1;
-                        top = 0;
-                    }
-                    else if(c == 2) {
-                        left = 0;
-                        top = 1;
-                    }
-                    else if(c == 3) {
-                        left = 1;
-                        top = 1;
-                    }
-
-                    dng_rect gainMapArea(top, left, height, width);
-                    AutoPtr<dng_opcode> gainMapOpCode(new dng_opcode_GainMap(dng_area_spec(gainMapArea, 0, 1, 2, 2), gainMap));
-
-                    negative->OpcodeList2().Append(gainMapOpCode);
-                }
-            }
-            
-            negative->SetModelName("MotionCam");
-            negative->SetLocalName("MotionCam");
-            
-            negative->SetColorKeys(colorKeyRed, colorKeyGreen, colorKeyBlue);
-            
-            uint32_t phase;
-                        
-            switch(cameraMetadata.sensorArrangment) {
-                case ColorFilterArrangment::GRBG:
-                    phase = 0;
-                    break;
-
-                default:
-                case ColorFilterArrangment::RGGB:
-                    phase = 1;
-                    break;
-
-                case ColorFilterArrangment::BGGR:
-                    phase = 2;
-                    break;
-                    
-                case ColorFilterArrangment::GBRG:
-                    phase = 3;
-                    break;
-            }
-            
-            negative->SetBayerMosaic(phase);
-            negative->SetColorChannels(3);
-                        
-            negative->SetQuadBlacks(blackLevel[0],
-                                    blackLevel[1],
-                                    blackLevel[2],
-                                    blackLevel[3]);
-            
-            negative->SetWhiteLevel(whiteLevel);
-            
-            // Square pixels
-            negative->SetDefaultScale(dng_urational(1,1), dng_urational(1,1));
-            
-            negative->SetDefaultCropSize(width, height);
-            negative->SetCameraNeutral(dng_vector_3(imageMetadata.asShot[0], imageMetadata.asShot[1], imageMetadata.asShot[2]));
-
-            // Set metadata
-            auto exif = negative->Metadata().GetExif();
-
-            exif->SetExposureTime(imageMetadata.exposureTime / 1.0e9);
-            exif->fISOSpeedRatings[0] = imageMetadata.iso;
-            exif->fISOSpeedRatings[1] = imageMetadata.iso;
-            exif->fISOSpeedRatings[2] = imageMetadata.iso;
-            exif->SetApertureValue(cameraMetadata.apertures[0]);
-                        
-            dng_orientation dngOrientation;
-            
-            switch(orientation)
-            {
-                default:
-                case ScreenOrientation::PORTRAIT:
-                    dngOrientation = dng_orientation::Rotate90CW();
-                    break;
-                
-                case ScreenOrientation::REVERSE_PORTRAIT:
-                    dngOrientation = dng_orientation::Rotate90CCW();
-                    break;
-                    
-                case ScreenOrientation::LANDSCAPE:
-                    dngOrientation = dng_orientation::Normal();
-                    break;
-                    
-                case ScreenOrientation::REVERSE_LANDSCAPE:
-                    dngOrientation = dng_orientation::Rotate180();
-                    break;
-            }
-            
-            negative->SetBaseOrientation(dngOrientation);
-
-            // Set up camera profile
-            AutoPtr<dng_camera_profile> cameraProfile(new dng_camera_profile());
-            
-            // Color matrices
-            cv::Mat color1 = cameraMetadata.colorMatrix1;
-            cv::Mat color2 = cameraMetadata.colorMatrix2;
-            
-            dng_matrix_3by3 dngColor1 = dng_matrix_3by3(color1.at<float>(0, 0), color1.at<float>(0, 1), color1.at<float>(0, 2),
-                                                        color1.at<float>(1, 0), color1.at<float>(1, 1), color1.at<float>(1, 2),
-                                                        color1.at<float>(2, 0), color1.at<float>(2, 1), color1.at<float>(2, 2));
-            
-            dng_matrix_3by3 dngColor2 = dng_matrix_3by3(color2.at<float>(0, 0), color2.at<float>(0, 1), color2.at<float>(0, 2),
-                                                        color2.at<float>(1, 0), color2.at<float>(1, 1), color2.at<float>(1, 2),
-                                                        color2.at<float>(2, 0), color2.at<float>(2, 1), color2.at<float>(2, 2));
-            
-            cameraProfile->SetColorMatrix1(dngColor1);
-            cameraProfile->SetColorMatrix2(dngColor2);
-            
-            // Forward matrices
-            cv::Mat forward1 = cameraMetadata.forwardMatrix1;
-            cv::Mat forward2 = cameraMetadata.forwardMatrix2;
-            
-            if(!forward1.empty() && !forward2.empty()) {
-                dng_matrix_3by3 dngForward1 = dng_matrix_3by3( forward1.at<float>(0, 0), forward1.at<float>(0, 1), forward1.at<float>(0, 2),
-                                                               forward1.at<float>(1, 0), forward1.at<float>(1, 1), forward1.at<float>(1, 2),
-                                                               forward1.at<float>(2, 0), forward1.at<float>(2, 1), forward1.at<float>(2, 2) );
-                
-                dng_matrix_3by3 dngForward2 = dng_matrix_3by3( forward2.at<float>(0, 0), forward2.at<float>(0, 1), forward2.at<float>(0, 2),
-                                                               forward2.at<float>(1, 0), forward2.at<float>(1, 1), forward2.at<float>(1, 2),
-                                                               forward2.at<float>(2, 0), forward2.at<float>(2, 1), forward2.at<float>(2, 2) );
-                
-                cameraProfile->SetForwardMatrix1(dngForward1);
-                cameraProfile->SetForwardMatrix2(dngForward2);
-            }
-
-            // Set camera calibration matrix
-            cv::Mat calibration1 = cameraMetadata.calibrationMatrix1;
-            cv::Mat calibration2 = cameraMetadata.calibrationMatrix2;
-
-            if(!calibration1.empty() && !calibration2.empty()) {
-                dng_matrix_3by3 dngCalibration1 = dng_matrix_3by3( calibration1.at<float>(0, 0), calibration1.at<float>(0, 1), calibration1.at<float>(0, 2),
-                                                                   calibration1.at<float>(1, 0), calibration1.at<float>(1, 1), calibration1.at<float>(1, 2),
-                                                                   calibration1.at<float>(2, 0), calibration1.at<float>(2, 1), calibration1.at<float>(2, 2) );
-                
-                dng_matrix_3by3 dngCalibration2 = dng_matrix_3by3( calibration2.at<float>(0, 0), calibration2.at<float>(0, 1), calibration2.at<float>(0, 2),
-                                                                   calibration2.at<float>(1, 0), calibration2.at<float>(1, 1), calibration2.at<float>(1, 2),
-                                                                   calibration2.at<float>(2, 0), calibration2.at<float>(2, 1), calibration2.at<float>(2, 2) );
-                
-                negative->SetCameraCalibration1(dngCalibration1);
-                negative->SetCameraCalibration2(dngCalibration2);
-            }
-            
-            uint32_t illuminant1 = 0;
-            uint32_t illuminant2 = 0;
-            
-            // Convert to DNG format
-            switch(cameraMetadata.colorIlluminant1) {
-                case color::StandardA:
-                    illuminant1 = lsStandardLightA;
-                    break;
-                case color::StandardB:
-                    illuminant1 = lsStandardLightB;
-                    break;
-                case color::StandardC:
-                    illuminant1 = lsStandardLightC;
-                    break;
-                case color::D50:
-                    illuminant1 = lsD50;
-                    break;
-                case color::D55:
-                    illuminant1 = lsD55;
-                    break;
-                case color::D65:
-                    illuminant1 = lsD65;
-                    break;
-                case color::D75:
-                    illuminant1 = lsD75;
-                    break;
-            }
-            
-            switch(cameraMetadata.colorIlluminant2) {
-                case color::StandardA:
-                    illuminant2 = lsStandardLightA;
-                    break;
-                case color::StandardB:
-                    illuminant2 = lsStandardLightB;
-                    break;
-                case color::StandardC:
-                    illuminant2 = lsStandardLightC;
-                    break;
-                case color::D50:
-                    illuminant2 = lsD50;
-                    break;
-                case color::D55:
-                    illuminant2 = lsD55;
-                    break;
-                case color::D65:
-                    illuminant2 = lsD65;
-                    break;
-                case color::D75:
-                    illuminant2 = lsD75;
-                    break;
-            }
-            
-            cameraProfile->SetCalibrationIlluminant1(illuminant1);
-            cameraProfile->SetCalibrationIlluminant2(illuminant2);
-            
-            cameraProfile->SetName("MotionCam");
-            cameraProfile->SetEmbedPolicy(pepAllowCopying);
-            
-            // This ensures profile is saved
-            cameraProfile->SetWasReadFromDNG();
-            
-            negative->AddProfile(cameraProfile);
-            
-            // Finally add the raw data to the negative
-            dng_rect dngArea(height, width);
-            dng_pixel_buffer dngBuffer;
-
-            AutoPtr<dng_image> dngImage(host.Make_dng_image(dngArea, 1, ttShort));
-
-            dngBuffer.fArea         = dngArea;
-            dngBuffer.fPlane        = 0;
-            dngBuffer.fPlanes       = 1;
-            dngBuffer.fRowStep      = dngBuffer.fPlanes * width;
-            dngBuffer.fColStep      = dngBuffer.fPlanes;
-            dngBuffer.fPixelType    = ttShort;
-            dngBuffer.fPixelSize    = TagTypeSize(ttShort);
-            dngBuffer.fData         = rawImage.ptr();
-            
-            dngImage->Put(dngBuffer);
-            
-            // Build the DNG images
-            negative->SetStage1Image(dngImage);
-            negative->BuildStage2Image(host);
-            negative->BuildStage3Image(host);
-            
-            negative->SynchronizeMetadata();
-
-            // Write DNG file to disk
-            AutoPtr<dng_image_writer> dngWriter(new dng_image_writer());
-
-            dngWriter->WriteDNG(host, dngStream, *negative.Get(), nullptr, dngVersion_SaveDefault, !enableCompression);
-        }
-
-        void WriteDng(const cv::Mat& rawImage,
-                      const RawCameraMetadata& cameraMetadata,
-                      const RawImageMetadata& imageMetadata,
-                      const ScreenOrientation orientation,
-                      const bool enableCompression,
-                      const bool saveShadingMap,
-                      const std::string& outputPath)
-        {
-            dng_file_stream stream(outputPath.c_str(), true);
-            
-            WriteDng(rawImage, cameraMetadata, imageMetadata, orientation, enableCompression, saveShadingMap, stream);
-            
-            stream.Flush();
-        }
-
-        void WriteDng(const cv::Mat& rawImage,
-                      const RawCameraMetadata& cameraMetadata,
-                      const RawImageMetadata& imageMetadata,
-                      const ScreenOrientation orientation,
-                      const bool enableCompression,
-                      const bool saveShadingMap,
-                      const int fd)
-        {
-            #if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
-                dng_fd_stream stream(fd, true);
-
-                WriteDng(rawImage, cameraMetadata, imageMetadata, orientation, enableCompression, saveShadingMap, stream);
-
-                stream.Flush();
-            #endif
-        }
-
-        void WriteDng(const cv::Mat& rawImage,
-                      const RawCameraMetadata& cameraMetadata,
-                      const RawImageMetadata& imageMetadata,
-                      const ScreenOrientation orientation,
-                      const bool enableCompression,
-                      const bool saveShadingMap,
-                      ZipWriter& zipWriter,
-                      const std::string& outputName)
-        {
-            dng_memory_stream stream(gDefaultDNGMemoryAllocator);
-            
-            WriteDng(rawImage, cameraMetadata, imageMetadata, orientation, enableCompression, saveShadingMap, stream);
-            
-            stream.Flush();
-            
-            auto memoryBlock = stream.AsMemoryBlock(gDefaultDNGMemoryAllocator);
-            
-            try {
-                if(memoryBlock)
-                    zipWriter.addFile(outputName, memoryBlock->Buffer_uint8(), memoryBlock->LogicalSize());
-            }
-            catch(std::runtime_error& e) {
-            }
-            
-            delete memoryBlock;
-        }
-    
         bool EndsWith(const std::string& str, const std::string& ending) {
             if (str.length() >= ending.length()) {
                 return str.compare(str.length() - ending.length(), ending.length(), ending) == 0;
@@ -893,12 +751,27 @@ namespace motioncam {
             return json[key].string_value();
         }
     
-        void GetNearestBuffers(
-                const std::vector<std::unique_ptr<RawContainer>>& containers,
-                const std::vector<ContainerFrame>& orderedFrames,
+        FrameTimeline::FrameTimeline(const std::vector<std::unique_ptr<RawContainer>>& containers) :
+            mReleasedUpTo(-1)
+        {
+            for(auto& container : containers)
+                mContainers.push_back(container.get());
+
+            GetOrderedFrames(mContainers, mFrames);
+        }
+
+        const std::vector<ContainerFrame>& FrameTimeline::frames() const {
+            return mFrames;
+        }
+
+        RawContainer& FrameTimeline::container(const int frameIdx) const {
+            return *mContainers[mFrames[frameIdx].containerIndex];
+        }
+
+        void FrameTimeline::loadNearestBuffers(
                 const int startIdx,
                 const int numBuffers,
-                std::vector<std::shared_ptr<RawImageBuffer>>& outNearestBuffers)
+                std::vector<std::shared_ptr<RawImageBuffer>>& outNearestBuffers) const
         {
             int leftOffset = -1;
             int rightOffset = 1;
@@ -913,8 +786,7 @@ namespace motioncam {
                 if(startIdx + leftOffset >= 0) {
                     int leftIndex = startIdx + leftOffset;
 
-                    auto& container = containers[orderedFrames[leftIndex].containerIndex];
-                    auto left = container->loadFrame(orderedFrames[leftIndex].frameName);
+                    auto left = container(leftIndex).loadFrame(mFrames[leftIndex].frameIndex);
 
                     if(!left) {
                         left = nullptr;
@@ -925,11 +797,10 @@ namespace motioncam {
                     leftOffset--;
                 }
 
-                if(startIdx + rightOffset < orderedFrames.size()) {
+                if(startIdx + rightOffset < mFrames.size()) {
                     int rightIndex = startIdx + rightOffset;
 
-                    auto& container = containers[orderedFrames[rightIndex].containerIndex];
-                    auto right = container->loadFrame(orderedFrames[rightIndex].frameName);
+                    auto right = container(rightIndex).loadFrame(mFrames[rightIndex].frameIndex);
 
                     if(!right)
                         right = nullptr;
@@ -942,21 +813,51 @@ namespace motioncam {
                 if(outNearestBuffers.size() >= numBuffers)
                     break;
 
-                if(startIdx + leftOffset < 0 && startIdx + rightOffset >= orderedFrames.size())
+                if(startIdx + leftOffset < 0 && startIdx + rightOffset >= mFrames.size())
                     break;
             }
         }
 
+        void FrameTimeline::releaseExpiredFrames(const int frameIdx, const int windowSize) {
+            // Everything behind the merge window can go. The cursor makes
+            // this a couple of releases per frame instead of a rescan from
+            // the start of the timeline.
+            const int last = (std::min)(frameIdx - windowSize, (int) mFrames.size() - 1);
+
+            for(int m = mReleasedUpTo + 1; m <= last; m++) {
+                auto frame = container(m).getFrame(mFrames[m].frameName);
+
+                frame->data->release();
+            }
+
+            mReleasedUpTo = (std::max)(mReleasedUpTo, last);
+        }
+
         void GetOrderedFrames(const std::vector<std::unique_ptr<RawContainer>>& containers,
                               std::vector<ContainerFrame>& outOrderedFrames)
         {
-            // Get a list of all frames, ordered by timestamp
+            std::vector<RawContainer*> containerPtrs;
+
+            for(auto& container : containers)
+                containerPtrs.push_back(container.get());
+
+            GetOrderedFrames(containerPtrs, outOrderedFrames);
+        }
+
+        void GetOrderedFrames(const std::vector<RawContainer*>& containers,
+                              std::vector<ContainerFrame>& outOrderedFrames)
+        {
+            // Get a list of all frames, ordered by timestamp. Timestamps
+            // come through the index based accessor so building the
+            // timeline doesn't hash every frame name back through the
+            // container maps.
             for(size_t i = 0; i < containers.size(); i++) {
                 auto& container = containers[i];
-                
-                for(auto& frameName : container->getFrames()) {
-                    auto timestamp = container->getFrameTimestamp(frameName);
-                    outOrderedFrames.push_back({ frameName, timestamp, i} );
+                auto frameNames = container->getFrames();
+
+                for(size_t j = 0; j < frameNames.size(); j++) {
+                    auto timestamp = container->getFrameTimestamp(j);
+                    outOrderedFrames.push_back({ frameNames[j], timestamp, i, j } );
                 }
             }
             
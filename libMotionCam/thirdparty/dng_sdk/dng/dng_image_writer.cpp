@@ -4409,6 +4409,17 @@ class dng_write_tiles_task : public dng_area_task
 					subTileBlockBuffer.Reset (fHost.Allocate (fUncompressedSize));
 					}
 				
+				// Reused across tiles; the memory stream keeps its pages
+				// when truncated, so only the first tile pays for the
+				// compressed output scratch.
+				
+				dng_memory_stream tileStream (fHost.Allocator ());
+									   
+				tileStream.SetLittleEndian (fStream.LittleEndian ());
+				
+				dng_host host (&fHost.Allocator (),
+							   sniffer);
+				
 				while (true)
 					{
 					
@@ -4439,13 +4450,10 @@ class dng_write_tiles_task : public dng_area_task
 					
 					dng_rect tileArea = fIFD.TileArea (rowIndex, colIndex);
 					
-					dng_memory_stream tileStream (fHost.Allocator ());
-										   
-					tileStream.SetLittleEndian (fStream.LittleEndian ());
+					tileStream.SetLength (0);
+					
+					tileStream.SetReadPosition (0);
 					
-					dng_host host (&fHost.Allocator (),
-								   sniffer);
-								
 					fImageWriter.WriteTile (host,
 											fIFD,
 											tileStream,
@@ -2602,6 +2602,80 @@ void DecodeLosslessJPEG (dng_stream &stream,
 
 /*****************************************************************************/
 
+// Vector path for computing predictor residuals on the encode side. The
+// two channel case (Bayer data split into column pairs) dominates, and with
+// a contiguous row each sample differences against the sample two positions
+// back, which maps directly onto 16-bit SIMD subtraction.
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define qDNGVectorResiduals 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define qDNGVectorResiduals 2
+#else
+#define qDNGVectorResiduals 0
+#endif
+
+// Computes the residuals for one contiguous two channel row (colStep == 2)
+// into diff, which holds cols * 2 entries. Unsigned 16-bit subtraction
+// wraps to the same value as the scalar (int16) (pixel - predictor) cast,
+// so the emitted bitstream is unchanged.
+
+static void ComputeRowResiduals2 (const uint16 *sPtr,
+								  int32 pred0,
+								  int32 pred1,
+								  uint32 cols,
+								  int16 *diff)
+	{
+
+	uint32 count = cols * 2;
+
+	// The first pair differences against the row predictors; every later
+	// sample differences against the previous sample of its channel.
+
+	diff [0] = (int16) (sPtr [0] - pred0);
+	diff [1] = (int16) (sPtr [1] - pred1);
+
+	uint32 j = 2;
+
+	#if qDNGVectorResiduals == 1
+
+	for (; j + 8 <= count; j += 8)
+		{
+
+		uint16x8_t cur  = vld1q_u16 (sPtr + j);
+		uint16x8_t prev = vld1q_u16 (sPtr + j - 2);
+
+		vst1q_s16 (diff + j, vreinterpretq_s16_u16 (vsubq_u16 (cur, prev)));
+
+		}
+
+	#elif qDNGVectorResiduals == 2
+
+	for (; j + 8 <= count; j += 8)
+		{
+
+		__m128i cur  = _mm_loadu_si128 ((const __m128i *) (sPtr + j));
+		__m128i prev = _mm_loadu_si128 ((const __m128i *) (sPtr + j - 2));
+
+		_mm_storeu_si128 ((__m128i *) (diff + j), _mm_sub_epi16 (cur, prev));
+
+		}
+
+	#endif
+
+	for (; j < count; j++)
+		{
+
+		diff [j] = (int16) (sPtr [j] - sPtr [j - 2]);
+
+		}
+
+	}
+
+/*****************************************************************************/
+
 class dng_lossless_encoder
 	{
 	
@@ -2629,9 +2703,13 @@ class dng_lossless_encoder
 		int32 huffPutBits;
 		
 		// Lookup table for number of bits in an 8 bit value.
-		
+
 		int numBitsTable [256];
-		
+
+		// Scratch row of residuals for the vectorized two channel path.
+
+		dng_memory_data fRowDiffs;
+
 	public:
 	
 		dng_lossless_encoder (const uint16 *srcData,
@@ -2705,9 +2783,16 @@ dng_lossless_encoder::dng_lossless_encoder (const uint16 *srcData,
 	
 	,	huffPutBuffer (0)
 	,	huffPutBits   (0)
-	
+
 	{
-	
+
+	// Allocate the residual row used by the two channel fast path.
+
+	if (srcChannels == 2 && srcColStep == 2)
+		{
+		fRowDiffs.Allocate (srcCols * 2, sizeof (int16));
+		}
+
     // Initialize number of bits lookup table.
     
     numBitsTable [0] = 0;
@@ -2919,25 +3004,45 @@ inline void dng_lossless_encoder::EncodeOneDiff (int diff, HuffmanTable *dctbl)
     int nbits = temp >= 256 ? numBitsTable [temp >> 8  ] + 8
     						: numBitsTable [temp & 0xFF];
 
-    // Emit the Huffman-coded symbol for the number of bits
-
-    EmitBits (dctbl->ehufco [nbits],
-    		  dctbl->ehufsi [nbits]);
+    // Emit the Huffman-coded symbol for the number of bits, followed by
+    // that number of bits of the value, if positive, or the complement of
+    // its magnitude, if negative.
 
-    // Emit that number of bits of the value, if positive,
-    // or the complement of its magnitude, if negative.
-    
     // If the number of bits is 16, there is only one possible difference
     // value (-32786), so the lossless JPEG spec says not to output anything
     // in that case.  So we only need to output the diference value if
     // the number of bits is between 1 and 15.
 
-    if (nbits & 15)
+    // When the symbol and value together fit in one EmitBits call (they
+    // almost always do), pack them into a single call to halve the trips
+    // through the bit buffer. The emitted bitstream is identical.
+
+    int size = dctbl->ehufsi [nbits];
+
+    if ((nbits & 15) == 0)
     	{
-    	
+
+    	EmitBits (dctbl->ehufco [nbits], size);
+
+    	}
+
+    else if (size + nbits <= 16)
+    	{
+
+    	EmitBits ((dctbl->ehufco [nbits] << nbits) |
+    			  (temp2 & (0x0FFFF >> (16 - nbits))),
+    			  size + nbits);
+
+    	}
+
+    else
+    	{
+
+    	EmitBits (dctbl->ehufco [nbits], size);
+
 		EmitBits (temp2 & (0x0FFFF >> (16 - nbits)),
 				  nbits);
-		
+
 		}
 
 	}
@@ -2988,36 +3093,58 @@ void dng_lossless_encoder::FreqCountSet ()
 			
 			}
 			
-		// Unroll most common case of two channels
-		
-		if (fSrcChannels == 2)
+		// Unroll most common case of two channels, computing the whole row
+		// of residuals up front so the subtraction loop vectorizes.
+
+		if (fSrcChannels == 2 && fSrcColStep == 2)
 			{
-			
+
+			int16 *diff = fRowDiffs.Buffer_int16 ();
+
+			ComputeRowResiduals2 (sPtr,
+								  predictor [0],
+								  predictor [1],
+								  fSrcCols,
+								  diff);
+
+	    	for (uint32 col = 0; col < fSrcCols; col++)
+	    		{
+
+    			CountOneDiff (diff [col * 2    ], freqCount [0]);
+    			CountOneDiff (diff [col * 2 + 1], freqCount [1]);
+
+	    		}
+
+			}
+
+		else if (fSrcChannels == 2)
+			{
+
 			int32 pred0 = predictor [0];
 			int32 pred1 = predictor [1];
-			
+
 			uint32 srcCols    = fSrcCols;
 			int32  srcColStep = fSrcColStep;
-			
+
 	    	for (uint32 col = 0; col < srcCols; col++)
 	    		{
-	    		
+
     			int32 pixel0 = sPtr [0];
 				int32 pixel1 = sPtr [1];
-    			
+
     			int16 diff0 = (int16) (pixel0 - pred0);
     			int16 diff1 = (int16) (pixel1 - pred1);
-    			
+
     			CountOneDiff (diff0, freqCount [0]);
     			CountOneDiff (diff1, freqCount [1]);
-    			
+
     			pred0 = pixel0;
    				pred1 = pixel1;
-	    			
+
 	    		sPtr += srcColStep;
-	    			
+
 	    		}
-			
+
 			}
 			
 		// General case.
@@ -3094,36 +3221,59 @@ void dng_lossless_encoder::HuffEncode ()
 			
 			}
 			
-		// Unroll most common case of two channels
-		
-		if (fSrcChannels == 2)
+		// Unroll most common case of two channels, computing the whole row
+		// of residuals up front so the subtraction loop vectorizes and the
+		// emit loop runs over plain int16s.
+
+		if (fSrcChannels == 2 && fSrcColStep == 2)
 			{
-			
+
+			int16 *diff = fRowDiffs.Buffer_int16 ();
+
+			ComputeRowResiduals2 (sPtr,
+								  predictor [0],
+								  predictor [1],
+								  fSrcCols,
+								  diff);
+
+	    	for (uint32 col = 0; col < fSrcCols; col++)
+	    		{
+
+    			EncodeOneDiff (diff [col * 2    ], &huffTable [0]);
+   				EncodeOneDiff (diff [col * 2 + 1], &huffTable [1]);
+
+	    		}
+
+			}
+
+		else if (fSrcChannels == 2)
+			{
+
 			int32 pred0 = predictor [0];
 			int32 pred1 = predictor [1];
-			
+
 			uint32 srcCols    = fSrcCols;
 			int32  srcColStep = fSrcColStep;
-			
+
 	    	for (uint32 col = 0; col < srcCols; col++)
 	    		{
-	    		
+
     			int32 pixel0 = sPtr [0];
 				int32 pixel1 = sPtr [1];
-    			
+
     			int16 diff0 = (int16) (pixel0 - pred0);
     			int16 diff1 = (int16) (pixel1 - pred1);
-    			
+
     			EncodeOneDiff (diff0, &huffTable [0]);
    				EncodeOneDiff (diff1, &huffTable [1]);
-    			
+
     			pred0 = pixel0;
    				pred1 = pixel1;
-	    			
+
 	    		sPtr += srcColStep;
-	    			
+
 	    		}
-			
+
 			}
 			
 		// General case.
@@ -0,0 +1,526 @@
+//
+// Microbenchmark suite for the capture path. Times the raw encoder
+// across pixel formats and noise levels, container add/load throughput
+// and a synthetic end-to-end capture through the streamer, so encoder
+// and IO regressions show up as numbers between releases instead of as
+// dropped frames in the field.
+//
+// Numbers are only comparable between runs on the same machine with the
+// same flags. Pin the governor and run on an idle system.
+//
+// Usage:
+//   mc_bench [options]
+//
+// Options:
+//   -n <count>      Iterations per encoder benchmark (default: 8)
+//   -f <frames>     Frames for the container benchmark (default: 60)
+//   -s <seconds>    Duration of the synthetic capture (default: 4)
+//   -o <dir>        Scratch directory for generated files (default: .)
+//
+
+#include <motioncam/RawBufferStreamer.h>
+#include <motioncam/RawContainer.h>
+#include <motioncam/RawEncoder.h>
+#include <motioncam/RawImageBuffer.h>
+#include <motioncam/RawCameraMetadata.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+    using namespace motioncam;
+
+    // Synthetic frame size, roughly a 12 MP sensor
+    const int BenchWidth  = 4032;
+    const int BenchHeight = 3024;
+
+    // The capture benchmark streams a 4K crop at the sensor frame rate
+    const int CaptureHeight = 2268;
+    const int CaptureFps = 30;
+
+    double ElapsedSecs(const std::chrono::steady_clock::time_point& start) {
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1e6;
+    }
+
+    size_t RowStride(const encoder::PixelFormat pixelFormat, const int width) {
+        switch(pixelFormat) {
+            case encoder::ANDROID_RAW10:
+                return width * 10 / 8;
+
+            case encoder::ANDROID_RAW12:
+                return width * 12 / 8;
+
+            default:
+                return width * 2;
+        }
+    }
+
+    const char* FormatName(const encoder::PixelFormat pixelFormat) {
+        switch(pixelFormat) {
+            case encoder::ANDROID_RAW10:
+                return "raw10";
+
+            case encoder::ANDROID_RAW12:
+                return "raw12";
+
+            default:
+                return "raw16";
+        }
+    }
+
+    // Smooth gradient plus gaussian noise approximates a real scene at a
+    // given gain. The encoder's entropy coding is sensitive to exactly
+    // this, so pure random data would only measure the worst case.
+    std::vector<uint16_t> MakeBayer(const int width, const int height, const int maxValue, const float noiseSigma) {
+        std::mt19937 rng(42);
+        std::normal_distribution<float> noise(0.0f, noiseSigma);
+
+        std::vector<uint16_t> bayer(static_cast<size_t>(width) * height);
+
+        const float range = 0.4f * maxValue;
+
+        for(int y = 0; y < height; y++) {
+            for(int x = 0; x < width; x++) {
+                // Offset the green sites so the CFA structure survives
+                const float channel = ((x & 1) == (y & 1)) ? 1.15f : 1.0f;
+                const float base = 64.0f + channel * range * (0.5f + 0.5f * std::sin(x * 0.002f) * std::sin(y * 0.0015f));
+
+                float v = base;
+                if(noiseSigma > 0.0f)
+                    v += noise(rng);
+
+                if(v < 0.0f)
+                    v = 0.0f;
+                if(v > maxValue)
+                    v = static_cast<float>(maxValue);
+
+                bayer[static_cast<size_t>(y) * width + x] = static_cast<uint16_t>(v);
+            }
+        }
+
+        return bayer;
+    }
+
+    // Packs 16 bit bayer samples into the Android raw wire formats the
+    // encoder consumes
+    std::vector<uint8_t> PackBayer(const std::vector<uint16_t>& bayer,
+                                   const encoder::PixelFormat pixelFormat,
+                                   const int width,
+                                   const int height)
+    {
+        const size_t rowStride = RowStride(pixelFormat, width);
+        std::vector<uint8_t> packed(rowStride * height);
+
+        for(int y = 0; y < height; y++) {
+            const uint16_t* src = bayer.data() + static_cast<size_t>(y) * width;
+            uint8_t* dst = packed.data() + static_cast<size_t>(y) * rowStride;
+
+            if(pixelFormat == encoder::ANDROID_RAW10) {
+                // 4 pixels in 5 bytes; high 8 bits first, then the packed
+                // 2 bit remainders
+                for(int x = 0; x < width; x += 4) {
+                    dst[0] = static_cast<uint8_t>(src[x+0] >> 2);
+                    dst[1] = static_cast<uint8_t>(src[x+1] >> 2);
+                    dst[2] = static_cast<uint8_t>(src[x+2] >> 2);
+                    dst[3] = static_cast<uint8_t>(src[x+3] >> 2);
+                    dst[4] = static_cast<uint8_t>( (src[x+0] & 0x3)       |
+                                                  ((src[x+1] & 0x3) << 2) |
+                                                  ((src[x+2] & 0x3) << 4) |
+                                                  ((src[x+3] & 0x3) << 6));
+                    dst += 5;
+                }
+            }
+            else if(pixelFormat == encoder::ANDROID_RAW12) {
+                // 2 pixels in 3 bytes
+                for(int x = 0; x < width; x += 2) {
+                    dst[0] = static_cast<uint8_t>(src[x+0] >> 4);
+                    dst[1] = static_cast<uint8_t>(src[x+1] >> 4);
+                    dst[2] = static_cast<uint8_t>( (src[x+0] & 0xF) |
+                                                  ((src[x+1] & 0xF) << 4));
+                    dst += 3;
+                }
+            }
+            else {
+                for(int x = 0; x < width; x++) {
+                    dst[0] = static_cast<uint8_t>(src[x] & 0xFF);
+                    dst[1] = static_cast<uint8_t>(src[x] >> 8);
+                    dst += 2;
+                }
+            }
+        }
+
+        return packed;
+    }
+
+    void Report(const std::string& name, const double megapixels, const double secs, const double ratio = -1.0) {
+        std::cout << std::left << std::setw(28) << name
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << (megapixels / secs) << " MPix/s";
+
+        if(ratio >= 0.0)
+            std::cout << "   ratio " << std::setprecision(2) << ratio;
+
+        std::cout << std::endl;
+    }
+
+    // encoder::encode/encodeAndBin/decode across pixel formats and noise
+    // levels. The compression ratio moves with the noise, and so does the
+    // throughput of the entropy coder.
+    void BenchEncoder(const int iterations) {
+        const encoder::PixelFormat formats[] = {
+            encoder::ANDROID_RAW10,
+            encoder::ANDROID_RAW12,
+            encoder::ANDROID_RAW16
+        };
+
+        // In sensor counts: flat synthetic, base ISO, high gain
+        const float noiseSigmas[] = { 0.0f, 2.0f, 16.0f };
+
+        const double megapixels = static_cast<double>(BenchWidth) * BenchHeight / 1e6 * iterations;
+
+        for(const auto pixelFormat : formats) {
+            const int maxValue = pixelFormat == encoder::ANDROID_RAW10 ? 1023 : 4095;
+            const size_t rowStride = RowStride(pixelFormat, BenchWidth);
+
+            for(const auto noiseSigma : noiseSigmas) {
+                const auto bayer = MakeBayer(BenchWidth, BenchHeight, maxValue, noiseSigma);
+                const auto source = PackBayer(bayer, pixelFormat, BenchWidth, BenchHeight);
+
+                std::vector<uint8_t> working(source.size());
+                std::vector<uint16_t> decoded(static_cast<size_t>(BenchWidth) * BenchHeight);
+
+                const std::string suffix =
+                    std::string(FormatName(pixelFormat)) + " noise " + std::to_string(static_cast<int>(noiseSigma));
+
+                // The encoder packs in place, so the copy happens outside
+                // the timed section
+                double encodeSecs = 0;
+                size_t encodedLen = 0;
+
+                for(int i = 0; i < iterations; i++) {
+                    working = source;
+
+                    const auto start = std::chrono::steady_clock::now();
+
+                    encodedLen = encoder::encode(
+                        working.data(), pixelFormat, 0, BenchWidth, 0, BenchHeight, static_cast<int>(rowStride));
+
+                    encodeSecs += ElapsedSecs(start);
+                }
+
+                Report("encode " + suffix, megapixels, encodeSecs,
+                       static_cast<double>(encodedLen) / source.size());
+
+                double decodeSecs = 0;
+
+                for(int i = 0; i < iterations; i++) {
+                    const auto start = std::chrono::steady_clock::now();
+
+                    encoder::decode(decoded.data(), BenchWidth, BenchHeight, working.data(), encodedLen);
+
+                    decodeSecs += ElapsedSecs(start);
+                }
+
+                Report("decode " + suffix, megapixels, decodeSecs);
+
+                double binSecs = 0;
+                size_t binnedLen = 0;
+
+                for(int i = 0; i < iterations; i++) {
+                    working = source;
+
+                    const auto start = std::chrono::steady_clock::now();
+
+                    binnedLen = encoder::encodeAndBin(
+                        working.data(), pixelFormat, 0, BenchWidth, 0, BenchHeight, static_cast<int>(rowStride));
+
+                    binSecs += ElapsedSecs(start);
+                }
+
+                Report("encodeAndBin " + suffix, megapixels, binSecs,
+                       static_cast<double>(binnedLen) / source.size());
+            }
+        }
+    }
+
+    // The capture path encodes each frame as parallel horizontal bands
+    // (RawBufferStreamer::cropAndBin), falling back to a single stream on
+    // small frames or few cores. This times the banded path against the
+    // single stream it replaces, so the speedup on a given device is a
+    // number instead of a guess.
+    void BenchBandedEncode(const int iterations) {
+        const size_t rowStride = RowStride(encoder::ANDROID_RAW10, BenchWidth);
+
+        const auto bayer = MakeBayer(BenchWidth, BenchHeight, 1023, 2.0f);
+        const auto source = PackBayer(bayer, encoder::ANDROID_RAW10, BenchWidth, BenchHeight);
+
+        std::vector<uint8_t> working(source.size());
+
+        const double megapixels = static_cast<double>(BenchWidth) * BenchHeight / 1e6 * iterations;
+
+        double singleSecs = 0;
+
+        for(int i = 0; i < iterations; i++) {
+            working = source;
+
+            const auto start = std::chrono::steady_clock::now();
+
+            encoder::encodeAndBin(
+                working.data(), encoder::ANDROID_RAW10, 0, BenchWidth, 0, BenchHeight, static_cast<int>(rowStride));
+
+            singleSecs += ElapsedSecs(start);
+        }
+
+        Report("bin single stream", megapixels, singleSecs);
+
+        double bandedSecs = 0;
+        bool banded = false;
+
+        for(int i = 0; i < iterations; i++) {
+            working = source;
+
+            const auto start = std::chrono::steady_clock::now();
+
+            encoder::encodeBanded(
+                working.data(), encoder::ANDROID_RAW10, 0, BenchWidth, 0, BenchHeight,
+                static_cast<int>(rowStride), working.size(), true, banded);
+
+            bandedSecs += ElapsedSecs(start);
+        }
+
+        Report(banded ? "bin banded" : "bin banded (fell back)", megapixels, bandedSecs);
+
+        std::cout << std::left << std::setw(28) << "banded speedup"
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(8) << (singleSecs / bandedSecs) << "x" << std::endl;
+    }
+
+#if !defined(_WIN32)
+    std::shared_ptr<RawImageBuffer> MakeFrame(const std::vector<uint8_t>& payload,
+                                              const int width,
+                                              const int height,
+                                              const size_t rowStride,
+                                              const bool compressed,
+                                              const int64_t timestampNs)
+    {
+        auto frame = std::make_shared<RawImageBuffer>(
+            std::unique_ptr<NativeBuffer>(new NativeHostBuffer(payload)));
+
+        frame->width = width;
+        frame->height = height;
+        frame->originalWidth = width;
+        frame->originalHeight = height;
+        frame->rowStride = static_cast<int>(rowStride);
+        frame->pixelFormat = compressed ? PixelFormat::RAW16 : PixelFormat::RAW10;
+        frame->isCompressed = compressed;
+        frame->compressionType = compressed ? CompressionType::MOTIONCAM : CompressionType::UNCOMPRESSED;
+        frame->metadata.timestampNs = timestampNs;
+        frame->metadata.exposureTime = 10000000;
+        frame->metadata.iso = 100;
+        frame->metadata.dynamicWhiteLevel = 1023;
+        frame->metadata.dynamicBlackLevel = { 64, 64, 64, 64 };
+
+        return frame;
+    }
+
+    // A plausible sensor description so the container header and the
+    // per-frame metadata carry realistic payloads
+    RawCameraMetadata MakeCameraMetadata() {
+        RawCameraMetadata metadata;
+
+        metadata.colorMatrix1 = cv::Mat::eye(3, 3, CV_32F);
+        metadata.colorMatrix2 = cv::Mat::eye(3, 3, CV_32F);
+        metadata.calibrationMatrix1 = cv::Mat::eye(3, 3, CV_32F);
+        metadata.calibrationMatrix2 = cv::Mat::eye(3, 3, CV_32F);
+        metadata.forwardMatrix1 = cv::Mat::eye(3, 3, CV_32F);
+        metadata.forwardMatrix2 = cv::Mat::eye(3, 3, CV_32F);
+        metadata.apertures = { 1.8f };
+        metadata.focalLengths = { 4.38f };
+        metadata.updateBayerOffsets({ 64, 64, 64, 64 }, 1023.0f);
+
+        return metadata;
+    }
+
+    // Container add/loadFrame throughput over an encoded synthetic frame.
+    // Covers the gathered frame writes on the way in and the index, CRC
+    // and decode path on the way out.
+    void BenchContainer(const int numFrames, const std::string& outputDir) {
+        const auto bayer = MakeBayer(BenchWidth, BenchHeight, 1023, 2.0f);
+        auto payload = PackBayer(bayer, encoder::ANDROID_RAW10, BenchWidth, BenchHeight);
+
+        const size_t encodedLen = encoder::encode(
+            payload.data(), encoder::ANDROID_RAW10, 0, BenchWidth, 0, BenchHeight,
+            static_cast<int>(RowStride(encoder::ANDROID_RAW10, BenchWidth)));
+
+        payload.resize(encodedLen);
+
+        const std::string path = outputDir + "/mc_bench.container";
+        const double totalMB = static_cast<double>(encodedLen) * numFrames / 1e6;
+
+        const auto cameraMetadata = MakeCameraMetadata();
+
+        {
+            const int fd = open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+            if(fd < 0) {
+                std::cerr << "Failed to create " << path << std::endl;
+                return;
+            }
+
+            auto container = RawContainer::Create(fd, cameraMetadata);
+
+            const auto start = std::chrono::steady_clock::now();
+
+            for(int i = 0; i < numFrames; i++) {
+                auto frame = MakeFrame(
+                    payload, BenchWidth, BenchHeight, BenchWidth * 2, true, i * 33333333LL);
+
+                container->add(*frame, true);
+            }
+
+            container->commit();
+
+            const double secs = ElapsedSecs(start);
+
+            std::cout << std::left << std::setw(28) << "container add"
+                      << std::right << std::fixed << std::setprecision(1)
+                      << std::setw(8) << (numFrames / secs) << " frames/s"
+                      << "   " << (totalMB / secs) << " MB/s" << std::endl;
+        }
+
+        {
+            auto container = RawContainer::Open(path);
+            if(!container) {
+                std::cerr << "Failed to open " << path << std::endl;
+                return;
+            }
+
+            const size_t frameCount = container->getFrameCount();
+
+            const auto start = std::chrono::steady_clock::now();
+            size_t loadedFrames = 0;
+
+            for(size_t i = 0; i < frameCount; i++) {
+                if(container->loadFrame(i))
+                    ++loadedFrames;
+            }
+
+            const double secs = ElapsedSecs(start);
+
+            std::cout << std::left << std::setw(28) << "container loadFrame"
+                      << std::right << std::fixed << std::setprecision(1)
+                      << std::setw(8) << (loadedFrames / secs) << " frames/s"
+                      << "   " << (totalMB / secs) << " MB/s" << std::endl;
+        }
+
+        std::remove(path.c_str());
+    }
+
+    // End-to-end synthetic capture: frames are added at the sensor frame
+    // rate and flow through the process and IO threads into a container,
+    // the way a recording does. A queue depth near the frame count means
+    // the storage couldn't keep up.
+    void BenchStreamer(const int seconds, const std::string& outputDir) {
+        const size_t rowStride = RowStride(encoder::ANDROID_RAW10, BenchWidth);
+
+        const auto bayer = MakeBayer(BenchWidth, CaptureHeight, 1023, 2.0f);
+        const auto source = PackBayer(bayer, encoder::ANDROID_RAW10, BenchWidth, CaptureHeight);
+
+        const std::string path = outputDir + "/mc_bench_capture.container";
+
+        const int fd = open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+        if(fd < 0) {
+            std::cerr << "Failed to create " << path << std::endl;
+            return;
+        }
+
+        const auto cameraMetadata =
+            std::make_shared<const RawCameraMetadata>(MakeCameraMetadata());
+
+        RawBufferStreamer streamer;
+
+        const int audioFd = -1;
+
+        streamer.start({ fd }, audioFd, nullptr, 2, cameraMetadata);
+
+        const auto start = std::chrono::steady_clock::now();
+        const int numFrames = seconds * CaptureFps;
+
+        for(int i = 0; i < numFrames; i++) {
+            auto frame = MakeFrame(
+                source, BenchWidth, CaptureHeight, rowStride, false, i * 33333333LL);
+
+            streamer.add(frame);
+
+            // Pace the adds like a sensor delivering frames
+            const auto next = start + std::chrono::milliseconds((i + 1) * 1000 / CaptureFps);
+            std::this_thread::sleep_until(next);
+        }
+
+        streamer.stop();
+
+        const double secs = ElapsedSecs(start);
+        const double writtenMB = static_cast<double>(streamer.writenOutputBytes()) / 1e6;
+
+        std::cout << std::left << std::setw(28) << "capture"
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << streamer.estimateFps() << " frames/s"
+                  << "   " << (writtenMB / secs) << " MB/s"
+                  << "   max queue " << streamer.maxUnprocessedQueueDepth() << std::endl;
+
+        std::remove(path.c_str());
+    }
+#endif
+}
+
+int main(int argc, const char* argv[]) {
+    int iterations = 8;
+    int numFrames = 60;
+    int seconds = 4;
+    std::string outputDir = ".";
+
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+
+        if(arg == "-n" && i + 1 < argc)
+            iterations = std::max(1, std::atoi(argv[++i]));
+        else if(arg == "-f" && i + 1 < argc)
+            numFrames = std::max(1, std::atoi(argv[++i]));
+        else if(arg == "-s" && i + 1 < argc)
+            seconds = std::max(1, std::atoi(argv[++i]));
+        else if(arg == "-o" && i + 1 < argc)
+            outputDir = argv[++i];
+    }
+
+    using namespace motioncam;
+
+    BenchEncoder(iterations);
+    BenchBandedEncode(iterations);
+
+#if !defined(_WIN32)
+    BenchContainer(numFrames, outputDir);
+    BenchStreamer(seconds, outputDir);
+#else
+    (void) numFrames;
+    (void) seconds;
+    (void) outputDir;
+
+    std::cerr << "The container and capture benchmarks need a POSIX file descriptor, skipping" << std::endl;
+#endif
+
+    return 0;
+}
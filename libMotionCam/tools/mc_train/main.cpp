@@ -0,0 +1,253 @@
+//
+// Profile guided optimization training harness. Exercises the hot paths
+// of the library - the raw encoder/decoder, container streaming reads,
+// the denoise merge and the postprocess pipeline - so an instrumented
+// build can emit representative profile data.
+//
+// Build the library with -DMOTIONCAM_PGO=GENERATE, run this over a few
+// sample containers, merge the profiles, then rebuild with
+// -DMOTIONCAM_PGO=USE.
+//
+// Usage:
+//   mc_train [options] <container> [<container>...]
+//
+// Options:
+//   -n <count>    Passes over each phase (default: 1)
+//   -o <dir>      Scratch directory for generated outputs (default: .)
+//
+// Without sample containers only the synthetic encoder phase runs.
+//
+
+#include <motioncam/MotionCam.h>
+#include <motioncam/RawContainer.h>
+#include <motioncam/RawEncoder.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+    using namespace motioncam;
+
+    // Synthetic frame size for the encoder phase, roughly a 12 MP sensor
+    const int TrainWidth  = 4096;
+    const int TrainHeight = 3072;
+
+    double ElapsedMs(const std::chrono::steady_clock::time_point& start) {
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+    }
+
+    class TrainImageProgress : public ImageProcessorProgress {
+    public:
+        std::string onPreviewSaved(const std::string& outputPath) const {
+            return "{}";
+        }
+
+        bool onProgressUpdate(int progress) const {
+            return true;
+        }
+
+        void onCompleted() const {
+        }
+
+        void onError(const std::string& error) const {
+            std::cerr << error << std::endl;
+        }
+    };
+
+    // Every frame is written to the same scratch path so training over a
+    // long clip doesn't fill the disk
+    class TrainDngProgress : public DngProcessorProgress {
+    public:
+        TrainDngProgress(std::string scratchPath) : mScratchPath(std::move(scratchPath)) {
+        }
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+        int onNeedFd(int frameNumber) {
+            return open(mScratchPath.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+        }
+#elif defined(_WIN32)
+        std::string onNeedFd(int frameNumber) {
+            return mScratchPath;
+        }
+#endif
+
+        bool onProgressUpdate(int progress) {
+            return true;
+        }
+
+        void onAttemptingRecovery() {
+        }
+
+        void onCompleted() {
+        }
+
+        void onError(const std::string& error) {
+            std::cerr << error << std::endl;
+        }
+
+    private:
+        const std::string mScratchPath;
+    };
+
+    size_t RowStride(const encoder::PixelFormat pixelFormat) {
+        switch(pixelFormat) {
+            case encoder::ANDROID_RAW10:
+                return TrainWidth * 10 / 8;
+
+            case encoder::ANDROID_RAW12:
+                return TrainWidth * 12 / 8;
+
+            default:
+                return TrainWidth * 2;
+        }
+    }
+
+    // Raw encoder/decoder over synthetic bayer data. Seeded so repeated
+    // training runs produce the same profile.
+    void TrainEncoder(const int iterations) {
+        const auto start = std::chrono::steady_clock::now();
+
+        std::mt19937 rng(42);
+
+        const encoder::PixelFormat formats[] = {
+            encoder::ANDROID_RAW10,
+            encoder::ANDROID_RAW12,
+            encoder::ANDROID_RAW16
+        };
+
+        size_t encodedBytes = 0;
+
+        for(const auto pixelFormat : formats) {
+            const size_t rowStride = RowStride(pixelFormat);
+
+            std::vector<uint8_t> source(rowStride * TrainHeight);
+            for(auto& v : source)
+                v = static_cast<uint8_t>(rng());
+
+            std::vector<uint8_t> working(source.size());
+            std::vector<uint16_t> decoded(TrainWidth * TrainHeight);
+
+            for(int i = 0; i < iterations; i++) {
+                // The encoder packs in place
+                working = source;
+
+                const size_t len = encoder::encode(
+                    working.data(), pixelFormat, 0, TrainWidth, 0, TrainHeight, static_cast<int>(rowStride));
+
+                encoder::decode(decoded.data(), TrainWidth, TrainHeight, working.data(), len);
+
+                working = source;
+
+                encodedBytes += encoder::encodeAndBin(
+                    working.data(), pixelFormat, 0, TrainWidth, 0, TrainHeight, static_cast<int>(rowStride));
+            }
+        }
+
+        std::cout << "encoder: " << ElapsedMs(start) << " ms (" << encodedBytes << " bytes)" << std::endl;
+    }
+
+    // Container streaming reads. Hits the index, the CRC check and frame
+    // decompression the way the export readahead does.
+    void TrainStreaming(const std::vector<std::string>& inputs, const int iterations) {
+        const auto start = std::chrono::steady_clock::now();
+
+        size_t loadedFrames = 0;
+
+        for(const auto& input : inputs) {
+            auto container = RawContainer::Open(input);
+            if(!container)
+                continue;
+
+            const auto frames = container->getFrames();
+
+            for(int i = 0; i < iterations; i++) {
+                for(const auto& frame : frames) {
+                    std::string error;
+
+                    if(container->tryLoadFrame(frame, error))
+                        ++loadedFrames;
+                    else if(!error.empty())
+                        std::cerr << input << ": " << error << std::endl;
+                }
+            }
+        }
+
+        std::cout << "streaming: " << ElapsedMs(start) << " ms (" << loadedFrames << " frames)" << std::endl;
+    }
+
+    // Still pipeline over the first container. Covers denoise, the tonemap
+    // and the postprocess kernels.
+    void TrainStillPipeline(const std::string& input, const std::string& outputDir) {
+        const auto start = std::chrono::steady_clock::now();
+
+        try {
+            TrainImageProgress listener;
+
+            MotionCam::ProcessImage(input, outputDir + "/mc_train_still", listener);
+        }
+        catch(const std::exception& e) {
+            std::cerr << input << ": " << e.what() << std::endl;
+        }
+
+        std::cout << "still: " << ElapsedMs(start) << " ms" << std::endl;
+    }
+
+    // DNG export with frame merging. Covers the fuse_denoise kernels, the
+    // shading map path and the DNG writer.
+    void TrainExport(const std::vector<std::string>& inputs, const std::string& outputDir) {
+        const auto start = std::chrono::steady_clock::now();
+
+        try {
+            TrainDngProgress listener(outputDir + "/mc_train_frame.dng");
+
+            MotionCam m;
+            m.convertVideoToDNG(inputs, listener, NO_DENOISE_WEIGHTS, 4, 2);
+        }
+        catch(const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+        }
+
+        std::cout << "export: " << ElapsedMs(start) << " ms" << std::endl;
+    }
+}
+
+int main(int argc, const char* argv[]) {
+    int iterations = 1;
+    std::string outputDir = ".";
+    std::vector<std::string> inputs;
+
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+
+        if(arg == "-n" && i + 1 < argc)
+            iterations = std::max(1, std::atoi(argv[++i]));
+        else if(arg == "-o" && i + 1 < argc)
+            outputDir = argv[++i];
+        else
+            inputs.push_back(arg);
+    }
+
+    TrainEncoder(iterations);
+
+    if(inputs.empty()) {
+        std::cerr << "No sample containers given, skipping the streaming, still and export phases" << std::endl;
+        return 0;
+    }
+
+    TrainStreaming(inputs, iterations);
+    TrainStillPipeline(inputs[0], outputDir);
+    TrainExport(inputs, outputDir);
+
+    return 0;
+}
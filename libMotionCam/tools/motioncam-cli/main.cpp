@@ -0,0 +1,451 @@
+//
+// Command line batch export tool. Runs many container exports inside one
+// process so a farm machine can be saturated without per-clip process
+// startup overhead.
+//
+// Usage:
+//   motioncam-cli video [options] <clip> [<clip>...]
+//   motioncam-cli image [options] <container> [<container>...]
+//
+// A video clip is a container path, or a comma separated list of segment
+// paths for multi-segment recordings.
+//
+// Options:
+//   -o <dir>      Output directory (default: current directory)
+//   -j <n>        Threads per job (default: 4)
+//   -p <n>        Jobs processed in parallel (default: cores / threads-per-job)
+//   -m <n>        Merge frames for denoising (default: 0)
+//   --no-compression    Write uncompressed DNGs
+//   --no-shading-map    Don't apply the lens shading map
+//   --stats       Write one json line per completed job to stdout
+//
+
+#include <motioncam/MotionCam.h>
+
+#include <json11/json11.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/stat.h>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+    using namespace motioncam;
+
+    struct Options {
+        Options() :
+            outputDir("."),
+            threadsPerJob(4),
+            parallelJobs(0),
+            mergeFrames(0),
+            enableCompression(true),
+            applyShadingMap(true),
+            stats(false)
+        {
+        }
+
+        std::string outputDir;
+        int threadsPerJob;
+        int parallelJobs;
+        int mergeFrames;
+        bool enableCompression;
+        bool applyShadingMap;
+        bool stats;
+        std::vector<std::string> inputs;
+    };
+
+    // Serializes stdout/stderr between job workers
+    std::mutex gOutputLock;
+
+    void PrintUsage() {
+        std::cerr << "Usage:"                                                            << std::endl
+                  << "  motioncam-cli video [options] <clip> [<clip>...]"                << std::endl
+                  << "  motioncam-cli image [options] <container> [<container>...]"      << std::endl
+                  << std::endl
+                  << "A clip is a container path, or a comma separated list of segment" << std::endl
+                  << "paths for multi-segment recordings."                               << std::endl
+                  << std::endl
+                  << "Options:"                                                          << std::endl
+                  << "  -o <dir>   Output directory (default: current directory)"        << std::endl
+                  << "  -j <n>     Threads per job (default: 4)"                         << std::endl
+                  << "  -p <n>     Jobs processed in parallel (default: cores/-j)"       << std::endl
+                  << "  -m <n>     Merge frames for denoising (default: 0)"              << std::endl
+                  << "  --no-compression   Write uncompressed DNGs"                      << std::endl
+                  << "  --no-shading-map   Don't apply the lens shading map"             << std::endl
+                  << "  --stats    Write one json line per completed job to stdout"      << std::endl;
+    }
+
+    bool ParseOptions(const int argc, const char** argv, Options& options) {
+        for(int i = 0; i < argc; i++) {
+            const std::string arg = argv[i];
+
+            if(arg == "-o" && i + 1 < argc) {
+                options.outputDir = argv[++i];
+            }
+            else if(arg == "-j" && i + 1 < argc) {
+                options.threadsPerJob = std::atoi(argv[++i]);
+            }
+            else if(arg == "-p" && i + 1 < argc) {
+                options.parallelJobs = std::atoi(argv[++i]);
+            }
+            else if(arg == "-m" && i + 1 < argc) {
+                options.mergeFrames = std::atoi(argv[++i]);
+            }
+            else if(arg == "--no-compression") {
+                options.enableCompression = false;
+            }
+            else if(arg == "--no-shading-map") {
+                options.applyShadingMap = false;
+            }
+            else if(arg == "--stats") {
+                options.stats = true;
+            }
+            else if(!arg.empty() && arg[0] == '-') {
+                std::cerr << "Unknown option " << arg << std::endl;
+                return false;
+            }
+            else {
+                options.inputs.push_back(arg);
+            }
+        }
+
+        if(options.inputs.empty()) {
+            std::cerr << "No inputs given" << std::endl;
+            return false;
+        }
+
+        if(options.threadsPerJob <= 0)
+            options.threadsPerJob = 4;
+
+        if(options.mergeFrames < 0)
+            options.mergeFrames = 0;
+
+        if(options.parallelJobs <= 0) {
+            const int cores = static_cast<int>(std::thread::hardware_concurrency());
+
+            options.parallelJobs = (std::max)(1, cores / options.threadsPerJob);
+        }
+
+        // No point running more jobs than there are inputs
+        options.parallelJobs = (std::min)(options.parallelJobs, static_cast<int>(options.inputs.size()));
+
+        return true;
+    }
+
+    std::vector<std::string> SplitSegments(const std::string& clip) {
+        std::vector<std::string> segments;
+        std::stringstream stream(clip);
+        std::string segment;
+
+        while(std::getline(stream, segment, ',')) {
+            if(!segment.empty())
+                segments.push_back(segment);
+        }
+
+        return segments;
+    }
+
+    std::string BaseName(const std::string& path) {
+        size_t start = path.find_last_of("/\\");
+        start = (start == std::string::npos) ? 0 : start + 1;
+
+        size_t end = path.find_last_of('.');
+        if(end == std::string::npos || end < start)
+            end = path.size();
+
+        return path.substr(start, end - start);
+    }
+
+    bool MakeDir(const std::string& path) {
+#if defined(_WIN32)
+        return mkdir(path.c_str()) == 0 || errno == EEXIST;
+#else
+        return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+    }
+
+    void WriteStats(const json11::Json::object& stats) {
+        std::lock_guard<std::mutex> lock(gOutputLock);
+
+        std::cout << json11::Json(stats).dump() << std::endl;
+    }
+
+    //
+    // Video export
+    //
+
+    class CliDngProgress : public DngProcessorProgress {
+    public:
+        CliDngProgress(std::string outputDir) :
+            mOutputDir(std::move(outputDir)),
+            mFramesWritten(0)
+        {
+        }
+
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__linux__)
+        int onNeedFd(int frameNumber) {
+            const int fd = open(framePath(frameNumber).c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+
+            if(fd >= 0)
+                ++mFramesWritten;
+
+            return fd;
+        }
+#elif defined(_WIN32)
+        std::string onNeedFd(int frameNumber) {
+            ++mFramesWritten;
+            return framePath(frameNumber);
+        }
+#endif
+
+        bool onProgressUpdate(int progress) {
+            return true;
+        }
+
+        void onAttemptingRecovery() {
+            std::lock_guard<std::mutex> lock(gOutputLock);
+            std::cerr << mOutputDir << ": attempting recovery" << std::endl;
+        }
+
+        void onCompleted() {
+        }
+
+        void onError(const std::string& error) {
+            std::lock_guard<std::mutex> lock(gOutputLock);
+            std::cerr << mOutputDir << ": " << error << std::endl;
+
+            mError = error;
+        }
+
+        int framesWritten() const {
+            return mFramesWritten;
+        }
+
+        const std::string& error() const {
+            return mError;
+        }
+
+    private:
+        std::string framePath(const int frameNumber) const {
+            char filename[64];
+            snprintf(filename, sizeof(filename), "frame_%06d.dng", frameNumber);
+
+            return mOutputDir + "/" + filename;
+        }
+
+    private:
+        const std::string mOutputDir;
+        std::atomic<int> mFramesWritten;
+        std::string mError;
+    };
+
+    bool ExportClip(const std::string& clip, const Options& options) {
+        const auto segments = SplitSegments(clip);
+        const std::string clipOutputDir = options.outputDir + "/" + BaseName(segments[0]);
+
+        if(!MakeDir(options.outputDir) || !MakeDir(clipOutputDir)) {
+            std::lock_guard<std::mutex> lock(gOutputLock);
+            std::cerr << "Failed to create " << clipOutputDir << std::endl;
+            return false;
+        }
+
+        CliDngProgress progress(clipOutputDir);
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        try {
+            // Each job runs in its own MotionCam instance with its own
+            // writer thread budget
+            MotionCam motionCam;
+
+            motionCam.convertVideoToDNG(segments,
+                                        progress,
+                                        NO_DENOISE_WEIGHTS,
+                                        options.threadsPerJob,
+                                        options.mergeFrames,
+                                        options.enableCompression,
+                                        options.applyShadingMap);
+        }
+        catch(std::exception& e) {
+            progress.onError(e.what());
+        }
+
+        const double seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+        if(options.stats) {
+            json11::Json::object stats = {
+                { "type", "video" },
+                { "clip", clip },
+                { "outputDir", clipOutputDir },
+                { "frames", progress.framesWritten() },
+                { "seconds", seconds },
+                { "framesPerSecond", seconds > 0 ? progress.framesWritten() / seconds : 0.0 },
+                { "error", progress.error() }
+            };
+
+            WriteStats(stats);
+        }
+
+        return progress.error().empty();
+    }
+
+    //
+    // Still image processing
+    //
+
+    class CliImageProgress : public ImageProcessorProgress {
+    public:
+        std::string onPreviewSaved(const std::string& outputPath) const {
+            return "{}";
+        }
+
+        bool onProgressUpdate(int progress) const {
+            return true;
+        }
+
+        void onCompleted() const {
+        }
+
+        void onError(const std::string& error) const {
+            std::lock_guard<std::mutex> lock(gOutputLock);
+            std::cerr << error << std::endl;
+
+            mError = error;
+        }
+
+        const std::string& error() const {
+            return mError;
+        }
+
+    private:
+        mutable std::string mError;
+    };
+
+    bool ProcessImageJob(const std::string& containerPath, const Options& options) {
+        const std::string outputPath = options.outputDir + "/" + BaseName(containerPath) + ".jpg";
+
+        if(!MakeDir(options.outputDir)) {
+            std::lock_guard<std::mutex> lock(gOutputLock);
+            std::cerr << "Failed to create " << options.outputDir << std::endl;
+            return false;
+        }
+
+        CliImageProgress progress;
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        try {
+            MotionCam::ProcessImage(containerPath, outputPath, progress);
+        }
+        catch(std::exception& e) {
+            progress.onError(e.what());
+        }
+
+        const double seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+        if(options.stats) {
+            json11::Json::object stats = {
+                { "type", "image" },
+                { "input", containerPath },
+                { "output", outputPath },
+                { "seconds", seconds },
+                { "error", progress.error() }
+            };
+
+            WriteStats(stats);
+        }
+
+        return progress.error().empty();
+    }
+
+    //
+    // Job scheduling
+    //
+
+    int RunJobs(const Options& options, bool (*runJob)(const std::string&, const Options&)) {
+        std::atomic<size_t> nextJob(0);
+        std::atomic<int> failedJobs(0);
+        std::vector<std::thread> workers;
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        for(int i = 0; i < options.parallelJobs; i++) {
+            workers.push_back(std::thread([&] {
+                while(true) {
+                    const size_t job = nextJob++;
+
+                    if(job >= options.inputs.size())
+                        break;
+
+                    if(!runJob(options.inputs[job], options))
+                        ++failedJobs;
+                }
+            }));
+        }
+
+        for(auto& worker : workers)
+            worker.join();
+
+        if(options.stats) {
+            const double seconds =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+            json11::Json::object stats = {
+                { "type", "summary" },
+                { "jobs", static_cast<int>(options.inputs.size()) },
+                { "failedJobs", failedJobs.load() },
+                { "parallelJobs", options.parallelJobs },
+                { "threadsPerJob", options.threadsPerJob },
+                { "seconds", seconds }
+            };
+
+            WriteStats(stats);
+        }
+
+        return failedJobs > 0 ? 1 : 0;
+    }
+}
+
+int main(int argc, const char** argv) {
+    if(argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+
+    const std::string mode = argv[1];
+
+    Options options;
+
+    if(!ParseOptions(argc - 2, argv + 2, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    if(mode == "video") {
+        return RunJobs(options, ExportClip);
+    }
+    else if(mode == "image") {
+        return RunJobs(options, ProcessImageJob);
+    }
+
+    std::cerr << "Unknown mode " << mode << std::endl;
+    PrintUsage();
+
+    return 1;
+}